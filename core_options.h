@@ -98,6 +98,19 @@ static retro_core_option_v2_definition option_defs[] =
 		},
 		"false"
 	},
+	{
+		"dosbox_pure_scratch_dirs",
+		"Keep Temporary Files in Memory", NULL,
+		"Files written into these directories on drive C: are kept in memory only and never stored in the save file." "\n"
+		"Useful for installers and compilers that create many temporary files. Takes effect after restarting.", NULL,
+		"Emulation",
+		{
+			{ "false", "Off" },
+			{ "TEMP,TMP", "C:\\TEMP and C:\\TMP" },
+			{ "TEMP,TMP,WORK", "C:\\TEMP, C:\\TMP and C:\\WORK" },
+		},
+		"false"
+	},
 	{
 		"dosbox_pure_menu_time",
 		"Advanced > Start Menu", NULL,
@@ -509,6 +522,19 @@ static retro_core_option_v2_definition option_defs[] =
 		},
 		"16"
 	},
+	{
+		"dosbox_pure_lowmemory",
+		"Low Memory Mode (restart required)", NULL,
+		"Reduce the memory used by the core for devices with little RAM." "\n"
+		"The code cache of the dynamic CPU core will be sized by the memory size of the emulated machine which can reduce performance of large protected mode games." "\n"
+		"Changes to read-only disk images beyond 16 MB get stored in a temporary file instead of memory.", NULL,
+		"System",
+		{
+			{ "false", "Off (default)" },
+			{ "true", "On" },
+		},
+		"false"
+	},
 	{
 		"dosbox_pure_modem",
 		"Modem Type", NULL,
@@ -561,6 +587,17 @@ static retro_core_option_v2_definition option_defs[] =
 		"normal"
 		#endif
 	},
+	{
+		"dosbox_pure_cpu_skip_polling",
+		"Advanced > Skip Polling Loops", NULL,
+		"Detect programs busy waiting for vertical retrace or keyboard input and fast forward to the moment the polled status can change. Saves host CPU time in many games, but can affect timing sensitive programs.", NULL,
+		"System",
+		{
+			{ "false", "Off (default)" },
+			{ "true", "On" },
+		},
+		"false"
+	},
 	{
 		"dosbox_pure_bootos_ramdisk",
 		"Advanced > OS Disk Modifications (restart required)", NULL,
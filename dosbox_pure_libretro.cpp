@@ -24,6 +24,7 @@
 #include <math.h>
 #include "include/dosbox.h"
 #include "include/cpu.h"
+#include "include/pic.h"
 #include "include/control.h"
 #include "include/render.h"
 #include "include/keyboard.h"
@@ -33,6 +34,10 @@
 #include "include/callback.h"
 #include "include/dbp_serialize.h"
 #include "include/dbp_threads.h"
+#include "include/dbp_memstats.h"
+#include "include/dbp_profiler.h"
+#include "include/dbp_audiolog.h"
+#include "include/dbp_simd.h"
 #include "src/ints/int10.h"
 #include "src/dos/drives.h"
 #include "keyb2joypad.h"
@@ -41,6 +46,7 @@
 #include <string>
 #include <sstream>
 #include <chrono>
+#include <atomic>
 
 // RETROARCH AUDIO/VIDEO
 #ifdef GEKKO // From RetroArch/config.def.h
@@ -66,6 +72,7 @@ static Bit8u dbp_alphablend_base;
 static float dbp_auto_target, dbp_targetrefreshrate;
 static Bit32u dbp_lastmenuticks, dbp_framecount, dbp_serialize_time;
 static Semaphore semDoContinue, semDidPause;
+static Waitable dbp_pacing_wake; // wakes up the emulation thread while it waits for frame pacing (variable latency)
 static retro_throttle_state dbp_throttle;
 static retro_time_t dbp_lastrun;
 static std::string dbp_crash_message;
@@ -78,7 +85,9 @@ static const Bit32s Cycles1981to1999[1+1999-1981] = { 900, 1400, 1800, 2300, 280
 
 // DOSBOX AUDIO/VIDEO
 static Bit8u buffer_active, dbp_overscan;
-static struct DBP_Buffer { Bit32u video[SCALER_MAXWIDTH * SCALER_MAXHEIGHT], width, height, border_color; float ratio; } dbp_buffers[2];
+static struct DBP_Buffer { Bit32u video[SCALER_MAXWIDTH * SCALER_MAXHEIGHT], width, height, border_color, serial; float ratio; bool overdrawn; } dbp_buffers[2];
+static Bit32u dbp_gfx_serial, dbp_video_lastserial;
+static bool dbp_video_candupe;
 enum { DBP_MAX_SAMPLES = 4096 }; // twice amount of mixer blocksize (96khz @ 30 fps max)
 static int16_t dbp_audio[DBP_MAX_SAMPLES * 2]; // stereo
 static double dbp_audio_remain;
@@ -246,6 +255,46 @@ static Bit32u dbp_perf_uniquedraw, dbp_perf_count, dbp_perf_emutime, dbp_perf_to
 static Bit32u dbp_wait_pause, dbp_wait_finish, dbp_wait_paused, dbp_wait_continue;
 #endif
 
+// PERF HISTOGRAMS
+struct DBP_PerfHistogram
+{
+	// Logarithmic buckets of microseconds with 4 steps per power of two (below 25% error on percentiles)
+	// Each histogram is added to by one thread (emulation or frontend) and read by the frontend thread, relaxed atomics keep that well defined
+	enum { BUCKETS = 124 };
+	std::atomic<Bit32u> counts[BUCKETS], total, max;
+	static Bit32u Index(Bit32u us) { if (us < 4) return us; Bit32u msb = 2; while (us >> (msb + 1)) msb++; return (msb - 1) * 4 + ((us >> (msb - 2)) & 3); }
+	static Bit32u Lower(Bit32u idx) { return (idx < 4 ? idx : ((4 + (idx & 3)) << (idx / 4 - 1))); }
+	void Add(Bit32u us)
+	{
+		counts[Index(us)].fetch_add(1, std::memory_order_relaxed);
+		total.fetch_add(1, std::memory_order_relaxed);
+		if (us > max.load(std::memory_order_relaxed)) max.store(us, std::memory_order_relaxed);
+	}
+	void Reset()
+	{
+		for (std::atomic<Bit32u>& c : counts) c.store(0, std::memory_order_relaxed);
+		total.store(0, std::memory_order_relaxed);
+		max.store(0, std::memory_order_relaxed);
+	}
+	Bit32u Percentile(Bit32u pct) const
+	{
+		// The total is read first so a concurrent Add can only make the bucket sum larger than the target
+		Bit32u target = (Bit32u)(((Bit64u)total.load(std::memory_order_relaxed) * pct + 99) / 100), sum = 0, mx = max.load(std::memory_order_relaxed);
+		for (Bit32u i = 0; i != BUCKETS; i++)
+			if ((sum += counts[i].load(std::memory_order_relaxed)) >= target && sum)
+				return (i + 1 == BUCKETS || Lower(i + 1) > mx ? mx : Lower(i + 1) - 1);
+		return mx;
+	}
+};
+enum DBP_PerfHistogramType { DBP_HIST_EMUFRAME, DBP_HIST_THREADWAIT, DBP_HIST_PRESENT, DBP_HIST_AUDIOMIX, _DBP_HIST_MAX };
+static const char* DBP_PerfHistogramNames[_DBP_HIST_MAX] = { "Emulation Frame", "Frontend Thread Wait", "EndUpdate to Video", "Audio Mix" };
+static DBP_PerfHistogram dbp_perf_hist[_DBP_HIST_MAX];
+static std::atomic<retro_time_t> dbp_perf_lastendupdate;
+
+// PERF MEMORY STATISTICS
+static Bit32u dbp_memstats_frames; // headless mode, log memory breakdown and exit after this many frames
+static Bit32u dbp_fat_benchmark; // number of rounds of opening all files on mounted FAT images
+
 // PERF FPS COUNTERS
 //#define DBP_ENABLE_FPS_COUNTERS
 #ifdef DBP_ENABLE_FPS_COUNTERS
@@ -296,6 +345,12 @@ void DBP_SetMountSwappingRequested();
 Bit32u DBP_MIXER_GetFrequency();
 Bit32u DBP_MIXER_DoneSamplesCount();
 void MIXER_CallBack(void *userdata, uint8_t *stream, int len);
+void DBP_MIXER_SetOutputRing(bool enable);
+Bit32u DBP_MIXER_OutputRingCount();
+bool DBP_MIXER_OutputRingWaiting();
+bool DBP_MIXER_OutputRingWait(Bit32u count);
+void DBP_MIXER_OutputRingWake();
+Bit32u DBP_MIXER_OutputRingRead(Bit16s* stream, Bit32u count);
 bool MSCDEX_HasDrive(char driveLetter);
 int MSCDEX_AddDrive(char driveLetter, const char* physicalPath, Bit8u& subUnit);
 int MSCDEX_RemoveDrive(char driveLetter);
@@ -395,6 +450,30 @@ static void DBP_QueueEvent(DBP_Event_Type type, int val = 0, int val2 = 0, DBP_I
 	dbp_event_queue_write_cursor = next;
 }
 
+static void DBP_LogMemStats()
+{
+	log_cb(RETRO_LOG_INFO, "[DOSBOX MEMORY] %-20s %10s %10s\n", "Subsystem", "Current KB", "Peak KB");
+	for (Bit8u i = 0; i != DBPMEM_TAG_COUNT; i++)
+	{
+		const DBP_MemStat& s = DBP_MemStats_Get((DBP_MemTag)i);
+		log_cb(RETRO_LOG_INFO, "[DOSBOX MEMORY] %-20s %10u %10u\n", DBP_MemStats_GetName((DBP_MemTag)i), (unsigned)(s.current / 1024), (unsigned)(s.peak / 1024));
+	}
+	log_cb(RETRO_LOG_INFO, "[DOSBOX MEMORY] %-20s %10u %10u\n", "Total", (unsigned)(DBP_MemStats_Total() / 1024), (unsigned)(DBP_MemStats_Total(true) / 1024));
+}
+
+static void DBP_LogPerfHistograms()
+{
+	log_cb(RETRO_LOG_INFO, "[DOSBOX TIMING] %-20s %8s %8s %8s %8s %8s\n", "Interval (us)", "Count", "p50", "p95", "p99", "Max");
+	for (const DBP_PerfHistogram& h : dbp_perf_hist)
+		log_cb(RETRO_LOG_INFO, "[DOSBOX TIMING] %-20s %8u %8u %8u %8u %8u\n", DBP_PerfHistogramNames[&h - dbp_perf_hist], h.total.load(), h.Percentile(50), h.Percentile(95), h.Percentile(99), h.max.load());
+	#ifdef C_DBP_ENABLE_VOODOO
+	bool VOODOO_GetPerfReportLine(Bitu line, char* buf, size_t bufsize);
+	char line[256];
+	for (Bitu i = 0; VOODOO_GetPerfReportLine(i, line, sizeof(line)); i++)
+		log_cb(RETRO_LOG_INFO, "[DOSBOX VOODOO] %s\n", line);
+	#endif
+}
+
 static void DBP_ReportCoreMemoryMaps()
 {
 	// Find first PSP belonging to a running program
@@ -460,22 +539,30 @@ static void DBP_ThreadControl(DBP_ThreadCtlMode m)
 		case TCM_PAUSE_FRAME:
 			if (!dbp_frame_pending || dbp_pause_events) goto case_TCM_EMULATION_PAUSED;
 			dbp_pause_events = true;
-			#ifdef DBP_ENABLE_WAITSTATS
-			{ retro_time_t t = time_cb(); semDidPause.Wait(); dbp_wait_pause += (Bit32u)(time_cb() - t); }
-			#else
-			semDidPause.Wait();
-			#endif
+			dbp_pacing_wake.Wake();
+			{
+				retro_time_t t = time_cb();
+				semDidPause.Wait();
+				Bit32u waited = (Bit32u)(time_cb() - t);
+				dbp_perf_hist[DBP_HIST_THREADWAIT].Add(waited);
+				#ifdef DBP_ENABLE_WAITSTATS
+				dbp_wait_pause += waited;
+				#endif
+			}
 			dbp_pause_events = dbp_frame_pending = dbp_paused_midframe;
 			goto case_TCM_EMULATION_PAUSED;
 		case TCM_ON_PAUSE_FRAME:
 			DBP_ASSERT(dbp_pause_events && !dbp_paused_midframe);
 			dbp_paused_midframe = true;
-			semDidPause.Post();
-			#ifdef DBP_ENABLE_WAITSTATS
-			{ retro_time_t t = time_cb(); semDoContinue.Wait(); dbp_wait_paused += (Bit32u)(time_cb() - t); }
-			#else
-			semDoContinue.Wait();
-			#endif
+			{
+				DBP_ProfilerScope prof(DBPPROF_WAIT);
+				semDidPause.Post();
+				#ifdef DBP_ENABLE_WAITSTATS
+				{ retro_time_t t = time_cb(); semDoContinue.Wait(); dbp_wait_paused += (Bit32u)(time_cb() - t); }
+				#else
+				semDoContinue.Wait();
+				#endif
+			}
 			dbp_paused_midframe = false;
 			return;
 		case TCM_RESUME_FRAME:
@@ -487,21 +574,28 @@ static void DBP_ThreadControl(DBP_ThreadCtlMode m)
 		case TCM_FINISH_FRAME:
 			if (!dbp_frame_pending) goto case_TCM_EMULATION_PAUSED;
 			if (dbp_pause_events) DBP_ThreadControl(TCM_RESUME_FRAME);
-			#ifdef DBP_ENABLE_WAITSTATS
-			{ retro_time_t t = time_cb(); semDidPause.Wait(); dbp_wait_finish += (Bit32u)(time_cb() - t); }
-			#else
-			semDidPause.Wait();
-			#endif
+			{
+				retro_time_t t = time_cb();
+				semDidPause.Wait();
+				Bit32u waited = (Bit32u)(time_cb() - t);
+				dbp_perf_hist[DBP_HIST_THREADWAIT].Add(waited);
+				#ifdef DBP_ENABLE_WAITSTATS
+				dbp_wait_finish += waited;
+				#endif
+			}
 			DBP_ASSERT(!dbp_paused_midframe);
 			dbp_frame_pending = false;
 			goto case_TCM_EMULATION_PAUSED;
 		case TCM_ON_FINISH_FRAME:
-			semDidPause.Post();
-			#ifdef DBP_ENABLE_WAITSTATS
-			{ retro_time_t t = time_cb(); semDoContinue.Wait(); dbp_wait_continue += (Bit32u)(time_cb() - t); }
-			#else
-			semDoContinue.Wait();
-			#endif
+			{
+				DBP_ProfilerScope prof(DBPPROF_WAIT);
+				semDidPause.Post();
+				#ifdef DBP_ENABLE_WAITSTATS
+				{ retro_time_t t = time_cb(); semDoContinue.Wait(); dbp_wait_continue += (Bit32u)(time_cb() - t); }
+				#else
+				semDoContinue.Wait();
+				#endif
+			}
 			return;
 		case TCM_NEXT_FRAME:
 			DBP_ASSERT(!dbp_frame_pending);
@@ -513,6 +607,7 @@ static void DBP_ThreadControl(DBP_ThreadCtlMode m)
 			if (dbp_frame_pending)
 			{
 				dbp_pause_events = true;
+				dbp_pacing_wake.Wake();
 				semDidPause.Wait();
 				dbp_pause_events = dbp_frame_pending = false;
 			}
@@ -526,6 +621,7 @@ static void DBP_ThreadControl(DBP_ThreadCtlMode m)
 			return;
 		case TCM_ON_SHUTDOWN:
 			dbp_state = DBPSTATE_EXITED;
+			DBP_MIXER_OutputRingWake();
 			semDidPause.Post();
 			return;
 		case_TCM_EMULATION_PAUSED:
@@ -655,7 +751,7 @@ static void DBP_Unmount(char drive)
 			i.mounted = false;
 }
 
-enum DBP_SaveFileType { SFT_GAMESAVE, SFT_VIRTUALDISK, SFT_DIFFDISK, _SFT_LAST_SAVE_DIRECTORY, SFT_SYSTEMDIR, SFT_NEWOSIMAGE };
+enum DBP_SaveFileType { SFT_GAMESAVE, SFT_VIRTUALDISK, SFT_DIFFDISK, SFT_PROFILE, SFT_ZIPDIRCACHE, _SFT_LAST_SAVE_DIRECTORY, SFT_SYSTEMDIR, SFT_NEWOSIMAGE };
 static std::string DBP_GetSaveFile(DBP_SaveFileType type, const char** out_filename = NULL, Bit32u* out_diskhash = NULL)
 {
 	std::string res;
@@ -702,6 +798,14 @@ static std::string DBP_GetSaveFile(DBP_SaveFileType type, const char** out_filen
 		{
 			res.append("-CDRIVE.sav");
 		}
+		else if (type == SFT_PROFILE)
+		{
+			res.append("-profile.txt");
+		}
+		else if (type == SFT_ZIPDIRCACHE)
+		{
+			res.append("-zipdir.zdc");
+		}
 	}
 	else if (type == SFT_NEWOSIMAGE)
 	{
@@ -764,7 +868,11 @@ static DOS_Drive* DBP_Mount(unsigned image_index = 0, bool unmount_existing = fa
 			retro_notify(0, RETRO_LOG_ERROR, "Unable to open %s file: %s%s", "ZIP", path, "");
 			return NULL;
 		}
-		drive = new zipDrive(new rawFile(zip_file_h, false), dbp_legacy_save);
+		// The content ZIP stores its parsed directory tree next to the save file to mount large archives faster next time if the file is unchanged
+		struct stat zip_stat;
+		Bit64u zip_mtime = (fstat(fileno(zip_file_h), &zip_stat) ? 0 : (Bit64u)zip_stat.st_mtime);
+		std::string cache_path = ((boot && zip_mtime) ? DBP_GetSaveFile(SFT_ZIPDIRCACHE) : std::string());
+		drive = new zipDrive(new rawFile(zip_file_h, false), dbp_legacy_save, (cache_path.empty() ? NULL : cache_path.c_str()), zip_mtime);
 		DBP_SetDriveLabelFromContentPath(drive, path, letter, path_file, ext);
 		if (ext[3] == 'Z' || ext[3] == 'z')
 		{
@@ -813,6 +921,7 @@ static DOS_Drive* DBP_Mount(unsigned image_index = 0, bool unmount_existing = fa
 			dta.SetupSearch(255, DOS_ATTR_VOLUME, (char*)"*.*");
 			fat->FindFirst((char*)"", dta);
 			dos.dta(save_dta);
+			if (dbp_fat_benchmark) fat->RunLookupBenchmark(dbp_fat_benchmark);
 
 			drive = fat;
 			disk = fat->loadedDisk;
@@ -1178,6 +1287,7 @@ static void DBP_Shutdown()
 	// to be called on the main thread
 	if (dbp_state == DBPSTATE_SHUTDOWN || dbp_state == DBPSTATE_BOOT) return;
 	DBP_ThreadControl(TCM_SHUTDOWN);
+	if (dbp_perf == DBP_PERF_DETAILED) { DBP_LogMemStats(); DBP_LogPerfHistograms(); }
 	if (!dbp_crash_message.empty())
 	{
 		retro_notify(0, RETRO_LOG_ERROR, "DOS crashed: %s", dbp_crash_message.c_str());
@@ -1190,6 +1300,7 @@ static void DBP_Shutdown()
 		delete control;
 		control = NULL;
 	}
+	DBP_LocalFileWriteBarrier(true);
 	dbp_state = DBPSTATE_SHUTDOWN;
 }
 
@@ -1334,8 +1445,11 @@ bool GFX_StartUpdate(Bit8u*& pixels, Bitu& pitch)
 	if (render.aspect) ratio /= (float)render.src.ratio;
 	if (ratio < 1) ratio *= 2; //because render.src.dblw is not reliable
 	if (ratio > 2) ratio /= 2; //because render.src.dblh is not reliable
+	bool intact = !buf.overdrawn; // false if something other than the renderer wrote into the buffer
+	buf.overdrawn = false;
 	if (buf.width != full_width || buf.height != full_height || buf.ratio != ratio)
 	{
+		intact = false;
 		buf.width = full_width;
 		buf.height = full_height;
 		buf.ratio = ratio;
@@ -1348,10 +1462,17 @@ bool GFX_StartUpdate(Bit8u*& pixels, Bitu& pitch)
 		if (border_color != buf.border_color)
 		{
 			buf.border_color = border_color;
+			intact = false;
 			for (Bit32u* p = (Bit32u*)buf.video, *pEnd = p + full_width*full_height; p != pEnd;) *(p++) = border_color;
 		}
 	}
 
+	// Let the renderer compare lines against the previous frame if its layout matches and nothing else was drawn over it
+	const DBP_Buffer& prev = dbp_buffers[buffer_active];
+	if (prev.width == buf.width && prev.height == buf.height && prev.border_color == buf.border_color && prev.serial && !prev.overdrawn)
+		render.scale.outCompare = (Bits)((Bit8u*)prev.video - (Bit8u*)buf.video);
+	render.scale.outIntact = intact;
+
 	return true;
 }
 
@@ -1362,16 +1483,21 @@ void GFX_EndUpdate(const Bit16u *changedLines)
 
 	buffer_active ^= 1;
 	DBP_Buffer& buf = dbp_buffers[buffer_active];
+	dbp_perf_lastendupdate = time_cb();
 	//DBP_ASSERT((Bit8u*)buf.video == render.scale.outWrite - render.scale.outPitch * render.src.height); // this assert can fail after loading a save game
 	DBP_ASSERT(render.scale.outWrite >= (Bit8u*)buf.video && render.scale.outWrite <= (Bit8u*)buf.video + sizeof(buf.video));
 
-	if (dbp_intercept_gfx) dbp_intercept_gfx(buf, dbp_intercept_data);
+	// A frame without changes keeps the serial of the previous frame
+	bool changed = render.scale.outChanged;
+	if (dbp_intercept_gfx)
+	{
+		dbp_intercept_gfx(buf, dbp_intercept_data);
+		buf.overdrawn = true;
+		changed = true;
+	}
+	buf.serial = (changed ? ++dbp_gfx_serial : dbp_buffers[buffer_active ^ 1].serial);
 
-	if (
-		#ifndef DBP_ENABLE_FPS_COUNTERS
-		dbp_perf == DBP_PERF_DETAILED &&
-		#endif
-		memcmp(dbp_buffers[0].video, dbp_buffers[1].video, buf.width * buf.height * 4))
+	if (changed)
 	{
 		DBP_FPSCOUNT(dbp_fpscount_gfxend)
 		dbp_perf_uniquedraw++;
@@ -1454,7 +1580,8 @@ static bool GFX_Events_AdvanceFrame(bool force_skip)
 	retro_time_t time_after = time_cb();
 	if (dbp_latency == DBP_LATENCY_VARIABLE)
 	{
-		while (time_after > dbp_lastrun + 100000 && !dbp_pause_events) retro_sleep(0); // paused or frame stepping
+		DBP_ProfilerScope prof(DBPPROF_WAIT);
+		while (time_after > dbp_lastrun + 100000 && !dbp_pause_events && !DBP_MIXER_OutputRingWaiting()) dbp_pacing_wake.Wait(); // paused or frame stepping, woken by retro_run or a pause request
 		if (dbp_pause_events) DBP_ThreadControl(TCM_ON_PAUSE_FRAME);
 		if (dbp_throttle.mode != RETRO_THROTTLE_FAST_FORWARD || dbp_throttle.rate > .1f)
 		{
@@ -1465,7 +1592,9 @@ static bool GFX_Events_AdvanceFrame(bool force_skip)
 				St.TimeSleepUntil += frameTime;
 			while ((Bit32s)(St.TimeSleepUntil - time_after) > 0)
 			{
-				retro_sleep(((St.TimeSleepUntil - time_after) > 1500 ? 1 : 0)); // double brackets because of missing brackets in macro...
+				// Timed waits can end late by the system timer granularity, so only wait until shortly before the deadline and yield for the rest
+				if ((Bit32s)(St.TimeSleepUntil - time_after) > 1500) dbp_pacing_wake.WaitUntil(St.TimeSleepUntil - 1500, time_after); // returns early on a pause request
+				else retro_sleep(0);
 				if (dbp_pause_events) DBP_ThreadControl(TCM_ON_PAUSE_FRAME);
 				time_after = time_cb();
 			}
@@ -1474,6 +1603,8 @@ static bool GFX_Events_AdvanceFrame(bool force_skip)
 	retro_time_t time_last = St.TimeLast;
 	St.TimeLast = time_after;
 
+	if (time_last && finishedframes) dbp_perf_hist[DBP_HIST_EMUFRAME].Add((Bit32u)(time_before - time_last) / finishedframes);
+
 	if (dbp_perf)
 	{
 		dbp_perf_count += finishedframes;
@@ -2376,6 +2507,7 @@ static bool check_variables(bool is_startup = false)
 	Variables::DosBoxSet("dos", "xms", (mem_use_extended ? "true" : "false"), true);
 	Variables::DosBoxSet("dos", "ems", (mem_use_extended ? "true" : "false"), true);
 	Variables::DosBoxSet("dosbox", "memsize", (mem_use_extended ? mem : "16"), false, true);
+	Variables::DosBoxSet("dosbox", "lowmemory", retro_get_variable("dosbox_pure_lowmemory", "false"), false, true);
 
 	const char* audiorate = retro_get_variable("dosbox_pure_audiorate", DBP_DEFAULT_SAMPLERATE_STRING);
 	Variables::DosBoxSet("mixer", "rate", audiorate, false, true);
@@ -2403,15 +2535,26 @@ static bool check_variables(bool is_startup = false)
 		case 'v': dbp_latency = DBP_LATENCY_VARIABLE; break;
 		default:  dbp_latency = DBP_LATENCY_DEFAULT;  break;
 	}
+	DBP_MIXER_SetOutputRing(dbp_latency == DBP_LATENCY_VARIABLE);
 	if (toggled_variable) DBP_ThreadControl(dbp_pause_events ? TCM_RESUME_FRAME : TCM_NEXT_FRAME);
 	retro_set_visibility("dosbox_pure_auto_target", (dbp_latency == DBP_LATENCY_LOW));
 
+	DBP_Perf old_perf = dbp_perf;
 	switch (retro_get_variable("dosbox_pure_perfstats", "none")[0])
 	{
 		case 's': dbp_perf = DBP_PERF_SIMPLE; break;
 		case 'd': dbp_perf = DBP_PERF_DETAILED; break;
 		default:  dbp_perf = DBP_PERF_NONE; break;
 	}
+	if (dbp_perf && !old_perf)
+	{
+		// Start the percentiles fresh when the statistics get shown
+		for (DBP_PerfHistogram& h : dbp_perf_hist) h.Reset();
+	}
+	#ifdef C_DBP_ENABLE_VOODOO
+	void VOODOO_SetPerfStats(bool enable);
+	VOODOO_SetPerfStats(dbp_perf == DBP_PERF_DETAILED);
+	#endif
 	switch (retro_get_variable("dosbox_pure_savestate", "on")[0])
 	{
 		case 'd': dbp_serializemode = DBPSERIALIZE_DISABLED; break;
@@ -2440,6 +2583,7 @@ static bool check_variables(bool is_startup = false)
 	extern const char* RunningProgram;
 	Variables::DosBoxSet("cpu", "core", ((!memcmp(RunningProgram, "BOOT", 5) && retro_get_variable("dosbox_pure_bootos_forcenormal", "false")[0] == 't') ? "normal" : retro_get_variable("dosbox_pure_cpu_core", "auto")));
 	Variables::DosBoxSet("cpu", "cputype", retro_get_variable("dosbox_pure_cpu_type", "auto"), true);
+	Variables::DosBoxSet("cpu", "skippolling", retro_get_variable("dosbox_pure_cpu_skip_polling", "false"));
 
 	retro_set_visibility("dosbox_pure_modem", dbp_use_network);
 	if (dbp_use_network)
@@ -2769,6 +2913,7 @@ static void init_dosbox(bool firsttime, bool forcemenu = false, void(*loadcfg)(c
 	if (loadcfg) loadcfg(*cfg, &autoexec);
 	dbp_boot_time = time_cb();
 	control->Init();
+	DBP_AudioLog_SetupPorts();
 	PROGRAMS_MakeFile("PUREMENU.COM", DBP_PureMenuProgram);
 	PROGRAMS_MakeFile("LABEL.COM", DBP_PureLabelProgram);
 	PROGRAMS_MakeFile("REMOUNT.COM", DBP_PureRemountProgram);
@@ -2792,6 +2937,8 @@ static void init_dosbox(bool firsttime, bool forcemenu = false, void(*loadcfg)(c
 			if (path) DBP_SetDriveLabelFromContentPath(union_underlay, path, 'C', path_file, path_ext);
 		}
 		unionDrive* uni = new unionDrive(*union_underlay, (save_file.empty() ? NULL : &save_file[0]), true, dbp_strict_mode);
+		const char* scratch_dirs = retro_get_variable("dosbox_pure_scratch_dirs", "false");
+		if (scratch_dirs[0] != 'f') uni->SetScratchDirs(scratch_dirs);
 		Drives['C'-'A'] = uni;
 		mem_writeb(Real2Phys(dos.tables.mediaid) + ('C'-'A') * 9, uni->GetMediaByte());
 	}
@@ -3175,6 +3322,20 @@ void retro_init(void) //#3
 	struct retro_perf_callback perf;
 	if (environ_cb(RETRO_ENVIRONMENT_GET_PERF_INTERFACE, &perf) && perf.get_time_usec) time_cb = perf.get_time_usec;
 
+	if (!environ_cb(RETRO_ENVIRONMENT_GET_CAN_DUPE, &dbp_video_candupe)) dbp_video_candupe = false;
+
+	// Pick the fastest self-tested kernels for the host CPU (can be limited with DOSBOX_PURE_SIMD=0 for scalar only)
+	const char* simd = getenv("DOSBOX_PURE_SIMD");
+	DBP_SIMD_Init(!simd || atoi(simd));
+
+	// Headless memory report for sizing deployments, i.e. DOSBOX_PURE_MEMSTATS_FRAMES=600 retroarch -L core content
+	const char* memstats_frames = getenv("DOSBOX_PURE_MEMSTATS_FRAMES");
+	dbp_memstats_frames = (memstats_frames ? (Bit32u)atoi(memstats_frames) : 0);
+
+	// Path lookup benchmark on FAT disk images, i.e. DOSBOX_PURE_FAT_BENCHMARK=10 to open every file 10 times when mounting
+	const char* fat_benchmark = getenv("DOSBOX_PURE_FAT_BENCHMARK");
+	dbp_fat_benchmark = (fat_benchmark ? (Bit32u)atoi(fat_benchmark) : 0);
+
 	// Set default ports (this will make games that run via autostart always see a joystick even if later during startup the frontend tells us the devices on the first two ports are non-joystick devices).
 	dbp_port_devices[0] = (DBP_Port_Device)DBP_DEVICE_DefaultJoypad;
 	dbp_port_devices[1] = (DBP_Port_Device)DBP_DEVICE_DefaultJoypad;
@@ -3209,6 +3370,20 @@ bool retro_load_game(const struct retro_game_info *info) //#4
 	//static const struct retro_audio_callback rac = { CallBacks::audio_callback, CallBacks::audio_set_state_callback };
 	//bool use_audio_callback = environ_cb(RETRO_ENVIRONMENT_SET_AUDIO_CALLBACK, (void*)&rac);
 
+	// Sampling profiler writing a report to the save directory when the content gets unloaded, i.e. DOSBOX_PURE_PROFILER=1 for sampling every millisecond
+	if (const char* profiler_interval = getenv("DOSBOX_PURE_PROFILER")) DBP_Profiler_Start((Bit32u)atoi(profiler_interval));
+
+	// Sound device port log for regression and benchmark runs, i.e. DOSBOX_PURE_AUDIO_RECORD=tune.dal or DOSBOX_PURE_AUDIO_REPLAY=tune.dal,60 to render 60 seconds and exit
+	if (const char* audio_record = getenv("DOSBOX_PURE_AUDIO_RECORD")) DBP_AudioLog_StartRecord(audio_record);
+	if (const char* audio_replay = getenv("DOSBOX_PURE_AUDIO_REPLAY"))
+	{
+		std::string replay_path(audio_replay);
+		const char* replay_seconds = strchr(audio_replay, ',');
+		if (replay_seconds) replay_path.resize(replay_seconds - audio_replay);
+		if (!DBP_AudioLog_StartReplay(replay_path.c_str(), (replay_seconds ? (Bit32u)atoi(replay_seconds + 1) : 0)))
+			log_cb(RETRO_LOG_ERROR, "[DOSBOX] Unable to load audio log %s\n", replay_path.c_str());
+	}
+
 	if (info && info->path && *info->path) dbp_content_path = info->path;
 	init_dosbox(true);
 
@@ -3247,6 +3422,9 @@ void retro_get_system_av_info(struct retro_system_av_info *info) // #5
 void retro_unload_game(void)
 {
 	DBP_Shutdown();
+	DBP_AudioLog_Stop();
+	std::string profile_path = DBP_GetSaveFile(SFT_PROFILE);
+	if (DBP_Profiler_Stop(profile_path.c_str())) log_cb(RETRO_LOG_INFO, "[DOSBOX] Wrote profiler report to %s\n", profile_path.c_str());
 }
 
 void retro_set_controller_port_device(unsigned port, unsigned device) //#5
@@ -3338,6 +3516,8 @@ void retro_run(void)
 				#else
 				// On statically linked platforms shutdown would exit the frontend, so don't do that. Just tint the screen red and sleep.
 				for (Bit8u *p = (Bit8u*)buf.video, *pEnd = p + sizeof(buf.video); p < pEnd; p += 56) p[2] = 255;
+				buf.overdrawn = true;
+				dbp_video_lastserial = 0;
 				retro_sleep(10);
 				#endif
 			}
@@ -3539,11 +3719,19 @@ void retro_run(void)
 			DBP_ThreadControl(TCM_FINISH_FRAME);
 			break;
 		case DBP_LATENCY_VARIABLE:
+			if (dbp_refresh_memmaps && !dbp_pause_events)
+			{
+				// The emulation thread keeps running with variable latency, briefly pause it so the memory maps get refreshed
+				DBP_ThreadControl(TCM_PAUSE_FRAME);
+				DBP_ThreadControl(TCM_RESUME_FRAME);
+			}
 			dbp_lastrun = time_cb();
+			dbp_pacing_wake.Wake();
 			break;
 	}
 
-	Bit32u tpfActual = 0, tpfTarget = 0, tpfDraws = 0;
+	Bit32u tpfActual = 0, tpfTarget = 0, tpfDraws = 0, histPct[_DBP_HIST_MAX][3]; float pollSkipped = 0;
+	char voodooStats[160] = "";
 	#ifdef DBP_ENABLE_WAITSTATS
 	Bit32u waitPause = 0, waitFinish = 0, waitPaused = 0, waitContinue = 0;
 	#endif
@@ -3552,6 +3740,17 @@ void retro_run(void)
 		tpfActual = dbp_perf_totaltime / dbp_perf_count;
 		tpfTarget = (Bit32u)(1000000.f / render.src.fps);
 		tpfDraws = dbp_perf_uniquedraw;
+		for (int i = 0; i != _DBP_HIST_MAX; i++)
+			for (int j = 0; j != 3; j++)
+				histPct[i][j] = dbp_perf_hist[i].Percentile(j == 0 ? 50 : (j == 1 ? 95 : 99));
+		static Bit64s lastPollingSkipped; static Bitu lastPollingTicks;
+		Bit64s pollingSkipped = CPU_PollingSkipped; Bitu pollingTicks = PIC_Ticks;
+		if (pollingTicks != lastPollingTicks) pollSkipped = (float)(pollingSkipped - lastPollingSkipped) * 100.f / ((float)CPU_CycleMax * (pollingTicks - lastPollingTicks));
+		lastPollingSkipped = pollingSkipped; lastPollingTicks = pollingTicks;
+		#ifdef C_DBP_ENABLE_VOODOO
+		bool VOODOO_GetPerfSummary(char* buf, size_t bufsize, Bit32u frames);
+		if (VOODOO_GetPerfSummary(voodooStats + 10, sizeof(voodooStats) - 10, dbp_perf_count)) memcpy(voodooStats, ", Voodoo: ", 10);
+		#endif
 		#ifdef DBP_ENABLE_WAITSTATS
 		waitPause = dbp_wait_pause / dbp_perf_count, waitFinish = dbp_wait_finish / dbp_perf_count, waitPaused = dbp_wait_paused / dbp_perf_count, waitContinue = dbp_wait_continue / dbp_perf_count;
 		dbp_wait_pause = dbp_wait_finish = dbp_wait_paused = dbp_wait_continue = 0;
@@ -3560,7 +3759,7 @@ void retro_run(void)
 	}
 
 	// mix audio
-	Bit32u haveSamples = DBP_MIXER_DoneSamplesCount(), mixSamples = 0; double numSamples;
+	Bit32u haveSamples = (dbp_latency == DBP_LATENCY_VARIABLE ? DBP_MIXER_OutputRingCount() : DBP_MIXER_DoneSamplesCount()), mixSamples = 0; double numSamples;
 	if (dbp_throttle.mode == RETRO_THROTTLE_FAST_FORWARD && dbp_throttle.rate < 1)
 		numSamples = haveSamples;
 	else if (dbp_throttle.mode == RETRO_THROTTLE_FAST_FORWARD || dbp_throttle.mode == RETRO_THROTTLE_SLOW_MOTION || dbp_throttle.rate < 1)
@@ -3570,23 +3769,30 @@ void retro_run(void)
 	if (numSamples && haveSamples > numSamples * .99) // Allow 1 percent stretch on underrun
 	{
 		mixSamples = (numSamples > haveSamples ? haveSamples : (Bit32u)numSamples);
-		dbp_audio_remain = ((numSamples <= mixSamples || numSamples > haveSamples) ? 0.0 : (numSamples - mixSamples));
 		if (mixSamples > DBP_MAX_SAMPLES) mixSamples = DBP_MAX_SAMPLES;
 		if (dbp_latency == DBP_LATENCY_VARIABLE)
 		{
+			// The emulation thread keeps pushing mixed samples into the output ring, wait until it is a bit ahead and take them without pausing it
 			if (dbp_pause_events) DBP_ThreadControl(TCM_RESUME_FRAME); // can be paused by serialize
-			while (DBP_MIXER_DoneSamplesCount() < mixSamples * 12 / 10) { dbp_lastrun = time_cb(); retro_sleep(0); } // buffer ahead a bit
-			DBP_ThreadControl(TCM_PAUSE_FRAME); 
+			while (!DBP_MIXER_OutputRingWait(mixSamples * 12 / 10) && dbp_state == DBPSTATE_RUNNING) dbp_lastrun = time_cb(); // buffer ahead a bit
+			dbp_lastrun = time_cb();
+			retro_time_t time_mix = time_cb();
+			mixSamples = DBP_MIXER_OutputRingRead(dbp_audio, mixSamples);
+			dbp_perf_hist[DBP_HIST_AUDIOMIX].Add((Bit32u)(time_cb() - time_mix));
 		}
-		MIXER_CallBack(0, (Bit8u*)dbp_audio, mixSamples * 4);
-		if (dbp_latency == DBP_LATENCY_VARIABLE)
+		else
 		{
-			DBP_ThreadControl(TCM_RESUME_FRAME);
+			retro_time_t time_mix = time_cb();
+			MIXER_CallBack(0, (Bit8u*)dbp_audio, mixSamples * 4);
+			dbp_perf_hist[DBP_HIST_AUDIOMIX].Add((Bit32u)(time_cb() - time_mix));
 		}
+		// Carry over the fraction of a sample not taken this frame but not the shortfall of an underrun
+		dbp_audio_remain = ((numSamples <= mixSamples || numSamples - mixSamples >= 1.0) ? 0.0 : (numSamples - mixSamples));
 	}
 
 	// Read buffer_active before waking up emulation thread
 	const DBP_Buffer& buf = dbp_buffers[buffer_active];
+	const Bit32u buf_serial = buf.serial;
 
 	if (dbp_latency == DBP_LATENCY_DEFAULT)
 	{
@@ -3601,11 +3807,14 @@ void retro_run(void)
 	{
 		extern const char* DBP_CPU_GetDecoderName();
 		if (dbp_perf == DBP_PERF_DETAILED)
-			retro_notify(-1500, RETRO_LOG_INFO, "Speed: %4.1f%%, DOS: %dx%d@%4.2ffps, Actual: %4.2ffps, Drawn: %dfps, Cycles: %u (%s)"
+			retro_notify(-1500, RETRO_LOG_INFO, "Speed: %4.1f%%, DOS: %dx%d@%4.2ffps, Actual: %4.2ffps, Drawn: %dfps, Cycles: %u (%s, Polling Skipped: %3.1f%%), Memory: %uMB (Peak: %uMB)"
+				", p50/p95/p99 us - Emu: %u/%u/%u, Wait: %u/%u/%u, Present: %u/%u/%u, Mix: %u/%u/%u%s"
 				#ifdef DBP_ENABLE_WAITSTATS
 				", Waits: p%u|f%u|z%u|c%u"
 				#endif
-				, ((float)tpfTarget / (float)tpfActual * 100), (int)render.src.width, (int)render.src.height, render.src.fps, (1000000.f / tpfActual), tpfDraws, CPU_CycleMax, DBP_CPU_GetDecoderName()
+				, ((float)tpfTarget / (float)tpfActual * 100), (int)render.src.width, (int)render.src.height, render.src.fps, (1000000.f / tpfActual), tpfDraws, CPU_CycleMax, DBP_CPU_GetDecoderName(), pollSkipped
+				, (unsigned)(DBP_MemStats_Total() >> 20), (unsigned)(DBP_MemStats_Total(true) >> 20)
+				, histPct[0][0], histPct[0][1], histPct[0][2], histPct[1][0], histPct[1][1], histPct[1][2], histPct[2][0], histPct[2][1], histPct[2][2], histPct[3][0], histPct[3][1], histPct[3][2], voodooStats
 				#ifdef DBP_ENABLE_WAITSTATS
 				, waitPause, waitFinish, waitPaused, waitContinue
 				#endif
@@ -3628,10 +3837,33 @@ void retro_run(void)
 		av_info.geometry.aspect_ratio = buf.ratio;
 		av_info.timing.fps = targetfps;
 		environ_cb((newfps ? RETRO_ENVIRONMENT_SET_SYSTEM_AV_INFO : RETRO_ENVIRONMENT_SET_GEOMETRY), &av_info);
+		dbp_video_lastserial = 0;
 	}
 
 	// submit video
-	video_cb(buf.video, buf.width, buf.height, buf.width * 4);
+	if (retro_time_t time_endupdate = dbp_perf_lastendupdate.exchange(0))
+	{
+		dbp_perf_hist[DBP_HIST_PRESENT].Add((Bit32u)(time_cb() - time_endupdate));
+	}
+	if (dbp_video_candupe && buf_serial && buf_serial == dbp_video_lastserial && !dbp_intercept_gfx)
+	{
+		// Frame content is identical to the last submitted one, let the frontend skip the upload
+		video_cb(NULL, buf.width, buf.height, buf.width * 4);
+	}
+	else
+	{
+		dbp_video_lastserial = buf_serial;
+		video_cb(buf.video, buf.width, buf.height, buf.width * 4);
+	}
+
+	if (dbp_memstats_frames && dbp_framecount >= dbp_memstats_frames)
+	{
+		DBP_LogMemStats();
+		dbp_memstats_frames = 0;
+		environ_cb(RETRO_ENVIRONMENT_SHUTDOWN, 0);
+	}
+	if (GCC_UNLIKELY(DBP_AudioLog_Replaying) && DBP_AudioLog_ReplayDone())
+		environ_cb(RETRO_ENVIRONMENT_SHUTDOWN, 0);
 }
 
 static bool retro_serialize_all(DBPArchive& ar, bool unlock_thread)
@@ -3641,9 +3873,11 @@ static bool retro_serialize_all(DBPArchive& ar, bool unlock_thread)
 	if (pauseThread) DBP_ThreadControl(TCM_PAUSE_FRAME);
 	retro_time_t timeStart = time_cb();
 	DBPSerialize_All(ar, (dbp_state == DBPSTATE_RUNNING), dbp_game_running);
+	if (ar.mode == DBPArchive::MODE_SAVE) DBP_LocalFileWriteBarrier(); // have files on disk match the saved state
 	dbp_serialize_time += (Bit32u)(time_cb() - timeStart);
 	//log_cb(RETRO_LOG_WARN, "[SERIALIZE] [%d] [%s] %u\n", (dbp_state == DBPSTATE_RUNNING && dbp_game_running), (ar.mode == DBPArchive::MODE_LOAD ? "LOAD" : ar.mode == DBPArchive::MODE_SAVE ? "SAVE" : ar.mode == DBPArchive::MODE_SIZE ? "SIZE" : ar.mode == DBPArchive::MODE_MAXSIZE ? "MAXX" : ar.mode == DBPArchive::MODE_ZERO ? "ZERO" : "???????"), (Bit32u)ar.GetOffset());
 	if (dbp_game_running && ar.mode == DBPArchive::MODE_LOAD) dbp_lastmenuticks = DBP_GetTicks(); // force show menu on immediate emulation crash
+	if (!pauseThread && ar.mode == DBPArchive::MODE_LOAD) DBP_Profiler_Reset(); // emulation will start over from the loaded state
 	if (pauseThread && unlock_thread) DBP_ThreadControl(TCM_RESUME_FRAME);
 
 	if (ar.had_error && (ar.mode == DBPArchive::MODE_LOAD || ar.mode == DBPArchive::MODE_SAVE))
@@ -3729,7 +3963,7 @@ size_t retro_get_memory_size(unsigned id) { (void)id; return 0; }
 void retro_cheat_reset(void) { }
 void retro_cheat_set(unsigned index, bool enabled, const char *code) { (void)index; (void)enabled; (void)code; }
 bool retro_load_game_special(unsigned type, const struct retro_game_info *info, size_t num) { return false; }
-void retro_deinit(void) { }
+void retro_deinit(void) { DBP_Profiler_Stop(NULL); }
 
 // UTF8 fopen
 #include "libretro-common/include/compat/fopen_utf8.h"
@@ -55,6 +55,8 @@ public:
 	Bit8u Write_Sector(Bit32u head,Bit32u cylinder,Bit32u sector,void * data);
 	Bit8u Read_AbsoluteSector(Bit32u sectnum, void * data);
 	Bit8u Write_AbsoluteSector(Bit32u sectnum, void * data);
+	Bit8u Read_AbsoluteSectors(Bit32u sectnum, Bit32u count, void * data);
+	Bit8u Write_AbsoluteSectors(Bit32u sectnum, Bit32u count, void * data);
 
 	void Set_Geometry(Bit32u setHeads, Bit32u setCyl, Bit32u setSect, Bit32u setSectSize);
 	void Get_Geometry(Bit32u * getHeads, Bit32u *getCyl, Bit32u *getSect, Bit32u *getSectSize);
@@ -86,6 +88,7 @@ public:
 
 	Bit32u sector_size;
 	Bit32u heads,cylinders,sectors;
+	Bit32u write_counter = 0; //DBP: incremented on every write so users caching disk contents can notice changes made through other paths
 private:
 	#ifdef C_DBP_SUPPORT_DISK_MOUNT_DOSFILE
 	Bit64u current_fpos;
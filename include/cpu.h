@@ -61,6 +61,8 @@ extern Bit64s CPU_IODelayRemoved;
 extern bool CPU_CycleAutoAdjust;
 extern bool CPU_SkipCycleAutoAdjust;
 extern Bitu CPU_AutoDetermineMode;
+extern bool CPU_SkipPolling;
+extern Bit64s CPU_PollingSkipped;
 
 extern Bitu CPU_ArchitectureType;
 
@@ -83,6 +85,8 @@ Bits CPU_Core_Dynrec_Trap_Run(void);
 Bits CPU_Core_Prefetch_Run(void);
 Bits CPU_Core_Prefetch_Trap_Run(void);
 
+void CPU_PollingCheck(PhysPt base,Bit32u eip,Bitu port,Bitu val,Bit32u eax_mask,double until);
+
 void CPU_Enable_SkipAutoAdjust(void);
 void CPU_Disable_SkipAutoAdjust(void);
 void CPU_Reset_AutoAdjust(void);
@@ -0,0 +1,44 @@
+/*
+ *  Copyright (C) 2020-2023 Bernhard Schelling
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef DOSBOX_DBP_AUDIOLOG_H
+#define DOSBOX_DBP_AUDIOLOG_H
+
+#include "config.h"
+
+// Recording of the port writes made to the sound devices and deterministic replay of such a log
+// A replay renders a fixed duration through the mixer and reports a hash of the output and the render time
+// The logged ports follow the configured sound devices, DMA controller writes and the data devices read by DMA are logged as well
+// During a replay the guest's own accesses to the logged ports are dropped so only the log drives the devices
+// Output only matches between runs with a fixed cycle count (cycles max adapts to the host speed)
+
+extern bool DBP_AudioLog_Recording, DBP_AudioLog_Replaying;
+
+bool DBP_AudioLog_StartRecord(const char* path);
+bool DBP_AudioLog_StartReplay(const char* path, Bit32u seconds);
+void DBP_AudioLog_SetupPorts();
+void DBP_AudioLog_PortWrite(Bitu port, Bitu val, Bitu iolen);
+void DBP_AudioLog_DmaRead(Bit8u channel, Bit8u* data, Bitu len);
+bool DBP_AudioLog_IsGuestAccessBlocked(Bitu port, Bitu val, bool read);
+void DBP_AudioLog_ReplayEvent(Bitu val);
+void DBP_AudioLog_MixBegin();
+void DBP_AudioLog_MixEnd(const Bit16s* samples, Bitu count, Bitu freq);
+bool DBP_AudioLog_ReplayDone();
+void DBP_AudioLog_Stop();
+
+#endif
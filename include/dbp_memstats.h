@@ -0,0 +1,53 @@
+/*
+ *  Copyright (C) 2020-2023 Bernhard Schelling
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef DOSBOX_DBP_MEMSTATS_H
+#define DOSBOX_DBP_MEMSTATS_H
+
+#include "config.h"
+#include <stddef.h> /* size_t */
+
+// Accounting of the large allocations made by the core, tagged by subsystem
+// Only the big buffers are tracked, small objects are not worth the overhead
+
+enum DBP_MemTag : Bit8u
+{
+	DBPMEM_PAGING,
+	DBPMEM_DYNCACHE,
+	DBPMEM_RAM,
+	DBPMEM_VGA,
+	DBPMEM_VOODOO,
+	DBPMEM_GUS,
+	DBPMEM_MIXER,
+	DBPMEM_ZIP,
+	DBPMEM_FATEMU,
+	DBPMEM_DISK,
+	DBPMEM_SOUNDFONT,
+	DBPMEM_MT32,
+	DBPMEM_TAG_COUNT
+};
+
+struct DBP_MemStat { size_t current, peak; };
+
+void DBP_MemStats_Alloc(DBP_MemTag tag, size_t size);
+void DBP_MemStats_Free(DBP_MemTag tag, size_t size);
+const DBP_MemStat& DBP_MemStats_Get(DBP_MemTag tag);
+const char* DBP_MemStats_GetName(DBP_MemTag tag);
+size_t DBP_MemStats_Total(bool peak = false);
+
+#endif
@@ -0,0 +1,50 @@
+/*
+ *  Copyright (C) 2020-2023 Bernhard Schelling
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef DOSBOX_DBP_PROFILER_H
+#define DOSBOX_DBP_PROFILER_H
+
+#include "config.h"
+
+// Sampling profiler running on its own thread which periodically records what the emulation thread is doing
+// The emulation thread only marks the subsystem it is currently in, everything else is read by the sampler
+
+enum DBP_ProfContext : Bit8u
+{
+	DBPPROF_CPU,
+	DBPPROF_PICEVENT,
+	DBPPROF_TIMERTICK,
+	DBPPROF_MIXER,
+	DBPPROF_WAIT,
+	DBPPROF_CONTEXT_COUNT
+};
+
+extern volatile DBP_ProfContext DBP_Profiler_Context;
+
+struct DBP_ProfilerScope
+{
+	DBP_ProfContext prev;
+	INLINE DBP_ProfilerScope(DBP_ProfContext ctx) : prev(DBP_Profiler_Context) { DBP_Profiler_Context = ctx; }
+	INLINE ~DBP_ProfilerScope() { DBP_Profiler_Context = prev; }
+};
+
+void DBP_Profiler_Start(Bit32u interval_ms);
+bool DBP_Profiler_Stop(const char* report_path);
+void DBP_Profiler_Reset();
+
+#endif
@@ -46,6 +46,7 @@ struct DBPArchive
 	template <typename T> INLINE DBPArchive& Serialize(T& v) { return SerializeBytes(&v, sizeof(v)); }
 	template <typename T, size_t N> INLINE DBPArchive& SerializeArray(T(& v)[N]) { return SerializeBytes(v, sizeof(v)); }
 	void SerializeSparse(void* p, size_t sz);
+	static void ClearSparse(void* p, size_t sz); // zero memory without writing to pages that are zero already
 	void SerializePointers(void** ptrs, size_t num_ptrs, bool ignore_unknown, size_t num_luts, ...);
 	void DoExceptionList(void* p, size_t sz, size_t num_exceptions, ...);
 	template <typename T, typename X1> INLINE DBPArchive& SerializeExcept(T& v, X1& x1) { DoExceptionList(&v, sizeof(v), 1, &x1, sizeof(x1)); return *this; }
@@ -0,0 +1,59 @@
+/*
+ *  Copyright (C) 2020-2023 Bernhard Schelling
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef DOSBOX_DBP_SIMD_H
+#define DOSBOX_DBP_SIMD_H
+
+#include "config.h"
+#include <stddef.h> /* size_t */
+
+// Host CPU feature detection and runtime selection of the best implementation of a few hot kernels
+// Every kernel starts out as the portable scalar version, DBP_SIMD_Init switches to the fastest variant that passes the self test
+
+enum DBP_SIMD_Feature : Bit32u
+{
+	DBP_SIMD_SSE2 = 1,
+	DBP_SIMD_AVX2 = 2,
+	DBP_SIMD_NEON = 4,
+};
+
+struct DBP_SIMD_Kernels
+{
+	// Returns true if both memory blocks are equal (used for frame/scanline change detection)
+	bool (*MemEqual)(const void* a, const void* b, size_t len);
+
+	// Converts interleaved 32-bit mixer samples to saturated 16-bit output after shifting them right and clears the source
+	void (*MixToS16)(Bit16s* out, Bit32s* work, size_t count, unsigned shift);
+
+	// Standard CRC-32 (zip) of a memory block, continuing from a previous crc value
+	Bit32u (*CRC32)(const Bit8u* ptr, size_t len, Bit32u crc);
+
+	// Converts a line of 8-bit palette indices to 32-bit XRGB pixels through a lookup table (render output without scaling)
+	void (*PaletteToXRGB)(Bit32u* out, const Bit8u* src, size_t count, const Bit32u* pal);
+
+	// Converts a line of 15-bit (xRRRRRGGGGGBBBBB) or 16-bit (RRRRRGGGGGGBBBBB) pixels to 32-bit XRGB with the top bits of each channel repeated in its low bits
+	void (*RGB15ToXRGB)(Bit32u* out, const Bit16u* src, size_t count);
+	void (*RGB16ToXRGB)(Bit32u* out, const Bit16u* src, size_t count);
+};
+
+extern DBP_SIMD_Kernels DBP_SIMD;
+
+void DBP_SIMD_Init(bool allow_simd = true);
+Bit32u DBP_SIMD_GetFeatures();
+
+#endif
@@ -5,7 +5,7 @@
 #define THREAD_CC WINAPI
 struct Thread { typedef DWORD RET_t; typedef RET_t (THREAD_CC *FUNC_t)(LPVOID); static void StartDetached(FUNC_t f, void* p = NULL) { HANDLE h = CreateThread(0,DBP_STACK_SIZE,f,p,0,0); CloseHandle(h); } };
 struct Mutex { Mutex() : h(CreateMutexA(0,0,0)) {} ~Mutex() { CloseHandle(h); } __inline void Lock() { WaitForSingleObject(h,INFINITE); } __inline void Unlock() { ReleaseMutex(h); } private:HANDLE h;Mutex(const Mutex&);Mutex& operator=(const Mutex&);};
-struct Semaphore { Semaphore() : h(CreateSemaphoreA(0,0,1,0)) {} ~Semaphore() { CloseHandle(h); } __inline void Post() { BOOL r = ReleaseSemaphore(h, 1, 0); DBP_ASSERT(r); } __inline void Wait() { WaitForSingleObject(h,INFINITE); } private:HANDLE h;Semaphore(const Semaphore&);Semaphore& operator=(const Semaphore&);};
+struct Semaphore { Semaphore() : h(CreateSemaphoreA(0,0,1,0)) {} ~Semaphore() { CloseHandle(h); } __inline void Post() { BOOL r = ReleaseSemaphore(h, 1, 0); DBP_ASSERT(r); } __inline void Wait() { WaitForSingleObject(h,INFINITE); } __inline void Signal() { ReleaseSemaphore(h, 1, 0); } __inline bool WaitFor(unsigned usec) { return (WaitForSingleObject(h,usec / 1000) == WAIT_OBJECT_0); } private:HANDLE h;Semaphore(const Semaphore&);Semaphore& operator=(const Semaphore&);};
 #else
 #if defined(WIIU)
 #include "../libretro-common/rthreads/wiiu_pthread.h"
@@ -19,6 +19,28 @@ struct Semaphore { Semaphore() : h(CreateSemaphoreA(0,0,1,0)) {} ~Semaphore() {
 #define THREAD_CC
 struct Thread { typedef void* RET_t; typedef RET_t (THREAD_CC *FUNC_t)(void*); static void StartDetached(FUNC_t f, void* p = NULL) { pthread_t h = 0; pthread_attr_t a; pthread_attr_init(&a); pthread_attr_setstacksize(&a, DBP_STACK_SIZE); pthread_create(&h, &a, f, p); pthread_attr_destroy(&a); pthread_detach(h); } };
 struct Mutex { Mutex() { pthread_mutex_init(&h,0); } ~Mutex() { pthread_mutex_destroy(&h); } __inline void Lock() { pthread_mutex_lock(&h); } __inline void Unlock() { pthread_mutex_unlock(&h); } private:pthread_mutex_t h;Mutex(const Mutex&);Mutex& operator=(const Mutex&);friend struct Conditional;};
-struct Conditional { Conditional() { pthread_cond_init(&h,0); } ~Conditional() { pthread_cond_destroy(&h); } __inline void Broadcast() { pthread_cond_broadcast(&h); } __inline void Wait(Mutex& m) { pthread_cond_wait(&h,&m.h); } private:pthread_cond_t h;Conditional(const Conditional&);Conditional& operator=(const Conditional&);};
-struct Semaphore { Semaphore() : v(0) {} __inline void Post() { m.Lock(); v = 1; c.Broadcast(); m.Unlock(); } __inline void Wait() { m.Lock(); while (!v) c.Wait(m); v = 0; m.Unlock(); } private:Mutex m;Conditional c;int v;Semaphore(const Semaphore&);Semaphore& operator=(const Semaphore&);};
+#if defined(WIIU) || defined(GEKKO) // no timed condition wait available, just give up the lock for a bit
+#include <unistd.h>
+#define DBP_COND_TIMEDWAIT(h, m, usec) (pthread_mutex_unlock(m), usleep(usec > 1000 ? 1000 : usec), pthread_mutex_lock(m))
+#elif defined(__APPLE__)
+#define DBP_COND_TIMEDWAIT(h, m, usec) do { struct timespec ts = { (time_t)(usec / 1000000), (long)(usec % 1000000) * 1000 }; pthread_cond_timedwait_relative_np(h, m, &ts); } while (0)
+#else
+#include <time.h>
+#if defined(__linux__) // use the monotonic clock so changing the system time doesn't affect waits
+#define DBP_COND_CLOCK CLOCK_MONOTONIC
+#define DBP_COND_INIT(h) do { pthread_condattr_t a; pthread_condattr_init(&a); pthread_condattr_setclock(&a, CLOCK_MONOTONIC); pthread_cond_init(h, &a); pthread_condattr_destroy(&a); } while (0)
+#else
+#define DBP_COND_CLOCK CLOCK_REALTIME
+#endif
+#define DBP_COND_TIMEDWAIT(h, m, usec) do { struct timespec ts; clock_gettime(DBP_COND_CLOCK, &ts); ts.tv_sec += (time_t)(usec / 1000000); ts.tv_nsec += (long)(usec % 1000000) * 1000; if (ts.tv_nsec >= 1000000000) { ts.tv_sec++; ts.tv_nsec -= 1000000000; } pthread_cond_timedwait(h, m, &ts); } while (0)
+#endif
+#ifndef DBP_COND_INIT
+#define DBP_COND_INIT(h) pthread_cond_init(h,0)
+#endif
+struct Conditional { Conditional() { DBP_COND_INIT(&h); } ~Conditional() { pthread_cond_destroy(&h); } __inline void Broadcast() { pthread_cond_broadcast(&h); } __inline void Wait(Mutex& m) { pthread_cond_wait(&h,&m.h); } __inline void WaitFor(Mutex& m, unsigned usec) { DBP_COND_TIMEDWAIT(&h,&m.h,usec); } private:pthread_cond_t h;Conditional(const Conditional&);Conditional& operator=(const Conditional&);};
+struct Semaphore { Semaphore() : v(0) {} __inline void Post() { m.Lock(); v = 1; c.Broadcast(); m.Unlock(); } __inline void Wait() { m.Lock(); while (!v) c.Wait(m); v = 0; m.Unlock(); } __inline void Signal() { Post(); } __inline bool WaitFor(unsigned usec) { m.Lock(); if (!v) c.WaitFor(m, usec); bool r = (v != 0); v = 0; m.Unlock(); return r; } private:Mutex m;Conditional c;int v;Semaphore(const Semaphore&);Semaphore& operator=(const Semaphore&);};
 #endif
+
+// Wakeup event for a thread that sleeps until an absolute deadline (in microseconds of the callers clock) or until Wake gets called from another thread
+// Wake can be called repeatedly, a wake that happens while nobody waits makes the next wait return early so callers loop on their own condition and deadline
+struct Waitable { __inline void Wake() { s.Signal(); } __inline void Wait() { s.Wait(); } __inline bool WaitUntil(long long deadline, long long now) { return (deadline > now && s.WaitFor((unsigned)(deadline - now > 1000000 ? 1000000 : deadline - now))); } private:Semaphore s; };
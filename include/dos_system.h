@@ -123,6 +123,7 @@ private:
 class localFile : public DOS_File {
 public:
 	localFile(const char* name, FILE * handle);
+	~localFile();
 	bool Read(Bit8u * data,Bit16u * size);
 	bool Write(Bit8u * data,Bit16u * size);
 	bool Seek(Bit32u * pos,Bit32u type);
@@ -130,13 +131,21 @@ public:
 	Bit16u GetInformation(void);
 	bool UpdateDateTimeFromHost(void);   
 	void FlagReadOnlyMedium(void);
-	void Flush(void);
+	bool Flush(void);
 	FILE * fhandle; //todo handle this properly
+	//DBP: Added write-behind, writes are queued and done by a background thread (see drive_local.cpp)
+	void WaitWriteBehind(void);
+	int TakeWriteBehindError(void);
+	Bit32u wb_pending, wb_pos;
+	int wb_error; // errno of the first failed write, latched until reported by Write, Flush or Close
 private:
 	bool read_only_medium;
 	enum { NONE,READ,WRITE } last_action;
 };
 
+//DBP: Wait until all queued local file writes are done (before saving state or shutting down)
+void DBP_LocalFileWriteBarrier(bool stop_thread = false);
+
 //DBP: Moved label out of DOS_Drive_Cache into its own class
 //DBP: Reason being DOS_Drive_Cache uses a lot of memory and is only used in a few
 //DBP: places, while DOS_Label is used in many.
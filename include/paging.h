@@ -213,6 +213,10 @@ bool mem_unalignedwrited_checked(PhysPt address,Bit32u val);
 
 #if defined(USE_FULL_TLB)
 
+//DBP: Unlinked TLB entries have a NULL handler which stands for the init page handler of the current core.
+//     That way the TLB never needs to be filled completely and the memory of unused parts of it is never committed.
+extern PageHandler* init_page_handler;
+
 static INLINE HostPt get_tlb_read(PhysPt address) {
 	return paging.tlb.read[address>>12];
 }
@@ -220,10 +224,12 @@ static INLINE HostPt get_tlb_write(PhysPt address) {
 	return paging.tlb.write[address>>12];
 }
 static INLINE PageHandler* get_tlb_readhandler(PhysPt address) {
-	return paging.tlb.readhandler[address>>12];
+	PageHandler* handler = paging.tlb.readhandler[address>>12];
+	return (GCC_UNLIKELY(!handler) ? init_page_handler : handler);
 }
 static INLINE PageHandler* get_tlb_writehandler(PhysPt address) {
-	return paging.tlb.writehandler[address>>12];
+	PageHandler* handler = paging.tlb.writehandler[address>>12];
+	return (GCC_UNLIKELY(!handler) ? init_page_handler : handler);
 }
 
 /* Use these helper functions to access linear addresses in readX/writeX functions */
@@ -60,4 +60,7 @@ void PIC_RemoveEvents(PIC_EventHandler handler);
 void PIC_RemoveSpecificEvents(PIC_EventHandler handler, Bitu val);
 
 void PIC_SetIRQMask(Bitu irq, bool masked);
+
+//DBP: True if the IRQ is requested but not yet acknowledged, raising it again has no effect then
+bool PIC_IsIRQPending(Bitu irq);
 #endif
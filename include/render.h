@@ -87,6 +87,10 @@ typedef struct {
 #ifdef C_DBP_ENABLE_SCALERCACHE
 		Bitu cachePitch;
 		Bit8u *cacheRead;
+#else
+		Bits outCompare; // offset from outWrite to the same line of the previous frame (set by GFX_StartUpdate, 0 if unavailable)
+		bool outIntact; // output buffer still holds what was last rendered into it (set by GFX_StartUpdate)
+		bool outChanged; // some line differs from the previous frame (read by GFX_EndUpdate)
 #endif
 		Bitu inHeight, inLine, outLine;
 	} scale;
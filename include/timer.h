@@ -42,4 +42,7 @@ void TIMER_DelTickHandler(TIMER_TickHandler handler);
 /* This will add 1 milliscond to all timers */
 void TIMER_AddTick(void);
 
+/* DBP: Called by the PIC when IRQ 0 gets acknowledged so coalesced PIT 0 expiries get realigned */
+void TIMER_IRQ0Acknowledged(void);
+
 #endif
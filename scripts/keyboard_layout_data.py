@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2020-2023 Bernhard Schelling
+#
+#  This program is free software; you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation; either version 2 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License along
+#  with this program; if not, write to the Free Software Foundation, Inc.,
+#  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+#
+
+# Generates src/dos/dos_keyboard_layout_data.h from the FreeDOS keyboard layout libraries
+#
+# Rebuild the header from the library files:
+#   python3 scripts/keyboard_layout_data.py build KEYBOARD.SYS KEYBRD2.SYS KEYBRD3.SYS > src/dos/dos_keyboard_layout_data.h
+#
+# Get the library files back out of the current header (to edit or update them):
+#   python3 scripts/keyboard_layout_data.py extract src/dos/dos_keyboard_layout_data.h <output directory>
+
+import os, re, sys, zlib
+
+LIBRARIES = [ 'keyboardsys', 'keybrd2sys', 'keybrd3sys' ]
+
+PREAMBLE = '''/*
+ *  Copyright (C)  Henrique Peron
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+
+/* This file contains data of .KL-files. They have been generated
+   by Henrique Peron using FreeDOS KC and are combined into .SYS files. */
+
+/* KC: compiles keyboard descriptors in KEY language to a KeybCB,
+   wrapped in a KL file (for use of FD-KEYB 2.X)
+   Copyright (C) 2004 by Aitor SANTAMARIA_MERINO */
+
+/* The libraries are stored deflate compressed and only inflated when a layout in them is selected.
+   The index keeps the library header and the language codes of each layout so it can be
+   searched with read_kcl_data without decompressing anything.
+   Generated by scripts/keyboard_layout_data.py, see there for how to rebuild it. */
+
+struct kcl_builtin_layout { Bit16u index_pos, offset, size; };
+struct kcl_builtin_library { const Bit8u* index; Bit32u index_size; const kcl_builtin_layout* layouts; Bit32u layout_count; const Bit8u* compressed; Bit32u compressed_size, size; };
+'''
+
+def byte_array(name, data):
+	lines = [', '.join('0x%02x' % b for b in data[i:i+16]) for i in range(0, len(data), 16)]
+	return 'static const Bit8u %s[%d] = {\n%s };\n' % (name, len(data), ', \n'.join(lines))
+
+def build_library(name, raw):
+	# Same layout as read_kcl_data walks: a header, then per layout a 16-bit length, the length of the language codes and the codes
+	if raw[0:3] != b'KCF': sys.exit('%s is not a keyboard layout library' % name)
+	index = bytearray(raw[0:7+raw[6]])
+	layouts = []
+	pos = len(index)
+	while pos + 5 <= len(raw):
+		length, data_len = raw[pos] | (raw[pos+1] << 8), raw[pos+2]
+		# The index entry keeps only the language codes, its length field is changed to skip just those
+		layouts.append((len(index), pos + 2, length + 1))
+		index += bytes((data_len & 0xFF, data_len >> 8)) + raw[pos+2:pos+3+data_len]
+		pos += 3 + length
+	comp = zlib.compressobj(9, zlib.DEFLATED, -15)
+	compressed = comp.compress(raw) + comp.flush()
+	assert zlib.decompress(compressed, -15) == raw
+
+	out = byte_array('layout_%s_index' % name, index) + '\n'
+	rows = [', '.join('{ %d, %d, %d }' % l for l in layouts[i:i+4]) for i in range(0, len(layouts), 4)]
+	out += 'static const kcl_builtin_layout layout_%s_layouts[%d] = {\n%s\n};\n\n' % (name, len(layouts), ',\n'.join(rows))
+	out += byte_array('layout_%s_compressed' % name, compressed) + '\n'
+	entry = '\t{ layout_%s_index, %d, layout_%s_layouts, %d, layout_%s_compressed, %d, %d }' % (name, len(index), name, len(layouts), name, len(compressed), len(raw))
+	return out, entry
+
+def build(paths):
+	if len(paths) != len(LIBRARIES): sys.exit('expected the files KEYBOARD.SYS, KEYBRD2.SYS and KEYBRD3.SYS')
+	out, entries = PREAMBLE + '\n', []
+	for name, path in zip(LIBRARIES, paths):
+		with open(path, 'rb') as f: lib, entry = build_library(name, f.read())
+		out += lib
+		entries.append(entry)
+	out += 'static const kcl_builtin_library layout_libraries[%d] = {\n%s\n};\n' % (len(entries), ',\n'.join(entries))
+	sys.stdout.write(out)
+
+def extract(header, outdir):
+	with open(header) as f: src = f.read()
+	for name in LIBRARIES:
+		m = re.search(r'layout_%s_compressed\[\d+\] = \{(.*?)\};' % name, src, re.S)
+		raw = zlib.decompress(bytes(int(x, 16) for x in re.findall(r'0x[0-9a-f]{2}', m.group(1))), -15)
+		with open(os.path.join(outdir, name[:-3].upper() + '.SYS'), 'wb') as f: f.write(raw)
+
+if len(sys.argv) >= 2 and sys.argv[1] == 'build': build(sys.argv[2:])
+elif len(sys.argv) == 4 and sys.argv[1] == 'extract': extract(sys.argv[2], sys.argv[3])
+else: sys.exit('usage: keyboard_layout_data.py build KEYBOARD.SYS KEYBRD2.SYS KEYBRD3.SYS | extract <header> <output directory>')
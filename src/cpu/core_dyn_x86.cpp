@@ -50,6 +50,8 @@
 #include "paging.h"
 #include "inout.h"
 #include "fpu.h"
+#include "dbp_memstats.h"
+#include "control.h"
 
 #define CACHE_MAXSIZE	(4096*3)
 #define CACHE_TOTAL		(1024*1024*8)
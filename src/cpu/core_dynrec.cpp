@@ -51,6 +51,8 @@
 #include "inout.h"
 #include "lazyflags.h"
 #include "pic.h"
+#include "dbp_memstats.h"
+#include "control.h"
 
 #define CACHE_MAXSIZE	(4096*2)
 #define CACHE_TOTAL		(1024*1024*8)
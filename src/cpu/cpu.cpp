@@ -32,6 +32,7 @@
 #include "callback.h"
 #include "lazyflags.h"
 #include "support.h"
+#include "pic.h"
 
 Bitu DEBUG_EnableDebugger(void);
 extern void GFX_SetTitle(Bit32s cycles ,int frameskip,bool paused);
@@ -65,6 +66,8 @@ CPU_Decoder * cpudecoder;
 bool CPU_CycleAutoAdjust = false;
 bool CPU_SkipCycleAutoAdjust = false;
 Bitu CPU_AutoDetermineMode = 0;
+bool CPU_SkipPolling = false;
+Bit64s CPU_PollingSkipped = 0;
 
 Bitu CPU_ArchitectureType = CPU_ARCHTYPE_MIXED;
 
@@ -2069,6 +2072,181 @@ void CPU_HLT(Bitu oldeip) {
 	cpudecoder=&HLT_Decode;
 }
 
+/* Detect guest loops busy polling a status (like waiting for vertical retrace or a key press).
+   When the same status is read again from the same place within a few cycles and no registers
+   besides the destination changed, the guest code is decoded to make sure it is a tight loop
+   closed by a backward branch around the polling instruction which doesn't write memory.
+   Only then the emulation fast forwards to the next PIC event (or the given time at which
+   the status can change next) the same way CPU_HLT gives back the remaining cycles. */
+enum { POLL_DETECT_COUNT = 8, POLL_MAX_LOOP_CYCLES = 64, POLL_MAX_LOOP_BYTES = 48, POLL_NO_BRANCH = 0xFFFFFFFF };
+static struct { PhysPt base; Bit32u eip, regs[8]; Bitu port, val, ticks, count; Bits index; Bit8s loop_ok; } cpu_poll;
+
+static bool CPU_PollingFetch(PhysPt addr, Bit8u& val) {
+	// Only read code through the TLB so decoding can never cause a page fault or call a memory handler
+	HostPt tlb_addr = get_tlb_read(addr);
+	if (!tlb_addr) return false;
+	val = host_readb(tlb_addr + addr);
+	return true;
+}
+
+// Returns the length of the instruction at ip or 0 if it is not something a polling loop is allowed to contain
+static Bitu CPU_PollingDecode(PhysPt base, Bit32u ip, bool big, Bitu port, Bit32u& target, bool& poll) {
+	bool opsize = big, addrsize = big;
+	Bitu len = 0, imm = 0, rel = 0;
+	Bit8u op, modrm = 0;
+	target = POLL_NO_BRANCH;
+	poll = false;
+	#define POLL_FETCH(v) if (len == 15 || !CPU_PollingFetch(base + ((ip + (Bit32u)len++) & (big ? 0xFFFFFFFF : 0xFFFF)), v)) return 0;
+	for (;;) {
+		POLL_FETCH(op)
+		if (op == 0x66) opsize = !big;
+		else if (op == 0x67) addrsize = !big;
+		else if (op != 0x26 && op != 0x2e && op != 0x36 && op != 0x3e && op != 0x64 && op != 0x65) break;
+	}
+	enum { MEM_READ = 1, MEM_NONE = 2 };
+	int mem = 0;
+	switch (op) {
+		case 0x02: case 0x03: case 0x0a: case 0x0b: case 0x12: case 0x13: case 0x1a: case 0x1b: // op reg,r/m
+		case 0x22: case 0x23: case 0x2a: case 0x2b: case 0x32: case 0x33:
+		case 0x38: case 0x39: case 0x3a: case 0x3b: case 0x84: case 0x85: case 0x8a: case 0x8b: // cmp, test, mov reg,r/m
+			mem = MEM_READ; break;
+		case 0x00: case 0x01: case 0x08: case 0x09: case 0x10: case 0x11: case 0x18: case 0x19: // op r/m,reg
+		case 0x20: case 0x21: case 0x28: case 0x29: case 0x30: case 0x31: case 0x86: case 0x87: case 0x88: case 0x89:
+		case 0xd0: case 0xd1: case 0xd2: case 0xd3: // shifts
+			mem = MEM_NONE; break;
+		case 0xc0: case 0xc1: mem = MEM_NONE; imm = 1; break;
+		case 0x80: case 0x82: case 0x83: mem = MEM_READ; imm = 1; break; // checked below, only cmp may access memory
+		case 0x81: mem = MEM_READ; imm = (opsize ? 4 : 2); break;
+		case 0xf6: case 0xf7: case 0xfe: case 0xff: mem = MEM_READ; break; // checked below
+		case 0x04: case 0x0c: case 0x14: case 0x1c: case 0x24: case 0x2c: case 0x34: case 0x3c: case 0xa8: // op al,imm8
+		case 0xb0: case 0xb1: case 0xb2: case 0xb3: case 0xb4: case 0xb5: case 0xb6: case 0xb7:
+			imm = 1; break;
+		case 0x05: case 0x0d: case 0x15: case 0x1d: case 0x25: case 0x2d: case 0x35: case 0x3d: case 0xa9: // op ax,imm
+		case 0xb8: case 0xb9: case 0xba: case 0xbb: case 0xbc: case 0xbd: case 0xbe: case 0xbf:
+			imm = (opsize ? 4 : 2); break;
+		case 0x40: case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: // inc/dec reg
+		case 0x48: case 0x49: case 0x4a: case 0x4b: case 0x4c: case 0x4d: case 0x4e: case 0x4f:
+		case 0x90: case 0x91: case 0x92: case 0x93: case 0x94: case 0x95: case 0x96: case 0x97: // nop, xchg
+		case 0x98: case 0x99: case 0x9e: case 0x9f: case 0xf5: case 0xf8: case 0xf9: case 0xfa: case 0xfb: case 0xfc: case 0xfd:
+			break;
+		case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: // jcc short
+		case 0x78: case 0x79: case 0x7a: case 0x7b: case 0x7c: case 0x7d: case 0x7e: case 0x7f:
+		case 0xe0: case 0xe1: case 0xe2: case 0xe3: case 0xeb: // loop, jcxz, jmp short
+			rel = 1; break;
+		case 0xe9: rel = (opsize ? 4 : 2); break;
+		case 0x0f:
+			POLL_FETCH(op)
+			if (op < 0x80 || op > 0x8f) return 0;
+			rel = (opsize ? 4 : 2);
+			break;
+		case 0xe4: case 0xe5: case 0xcd: imm = 1; break; // checked below
+		case 0xec: case 0xed: poll = ((reg_edx & 0xFFFF) == port); break;
+		default: return 0;
+	}
+	if (mem) {
+		POLL_FETCH(modrm)
+		Bitu mod = (modrm >> 6), reg = ((modrm >> 3) & 7), rm = (modrm & 7);
+		if (op == 0x80 || op == 0x81 || op == 0x82 || op == 0x83) { if (reg != 7) mem = MEM_NONE; } // only cmp doesn't write
+		else if (op == 0xf6 || op == 0xf7) { if (reg >= 4) return 0; if (reg >= 2) mem = MEM_NONE; else imm = (op == 0xf6 ? 1 : (opsize ? 4 : 2)); } // test, not/neg
+		else if (op == 0xfe || op == 0xff) { if (reg >= 2) return 0; mem = MEM_NONE; } // inc/dec
+		if (mod != 3) {
+			if (mem == MEM_NONE) return 0; // writes memory
+			Bitu disp;
+			if (!addrsize) disp = (mod == 1 ? 1 : ((mod == 2 || rm == 6) ? 2 : 0));
+			else {
+				if (rm == 4) {
+					Bit8u sib;
+					POLL_FETCH(sib)
+					if (mod == 0 && (sib & 7) == 5) disp = 4;
+					else disp = (mod == 1 ? 1 : (mod == 2 ? 4 : 0));
+				}
+				else disp = (mod == 1 ? 1 : ((mod == 2 || rm == 5) ? 4 : 0));
+			}
+			len += disp;
+		}
+	}
+	if (imm) {
+		Bit8u b = 0;
+		for (Bitu i = 0; i != imm; i++) { POLL_FETCH(b) }
+		if (op == 0xe4 || op == 0xe5) poll = (b == port);
+		else if (op == 0xcd) { if (b != 0x16) return 0; poll = (port == 0x16); } // int 16h key check
+	}
+	if (rel) {
+		Bit32u ofs = 0;
+		for (Bitu i = 0; i != rel; i++) { Bit8u b; POLL_FETCH(b) ofs |= (Bit32u)b << (i * 8); }
+		if (rel == 1) ofs = (Bit32u)(Bit32s)(Bit8s)ofs;
+		else if (rel == 2) ofs = (Bit32u)(Bit32s)(Bit16s)ofs;
+		target = ip + (Bit32u)len + ofs;
+		if (!opsize) target &= 0xFFFF;
+		if ((op == 0xeb || op == 0xe9) && target > ip) return 0; // code continues elsewhere
+	}
+	#undef POLL_FETCH
+	return len;
+}
+
+static bool CPU_PollingLoopValid(PhysPt base, Bit32u eip, Bitu port) {
+	// eip is the polling instruction (or the start of the block with it for the dynamic cores), find the branch closing the loop
+	const bool big = cpu.code.big;
+	Bit32u ip = eip, target, loop_start = POLL_NO_BRANCH;
+	bool poll, has_poll = false;
+	while (ip - eip < POLL_MAX_LOOP_BYTES) {
+		Bitu len = CPU_PollingDecode(base, ip, big, port, target, poll);
+		if (!len) return false;
+		has_poll |= poll;
+		ip += (Bit32u)len;
+		if (target <= eip) { loop_start = target; break; }
+		if (target < ip) return false; // nested loop not around the polling instruction
+	}
+	if (loop_start == POLL_NO_BRANCH || ip - loop_start > POLL_MAX_LOOP_BYTES) return false;
+	// The instructions between the start of the loop and eip need to qualify as well
+	for (Bit32u i = loop_start; i != eip;) {
+		if (i > eip) return false;
+		Bitu len = CPU_PollingDecode(base, i, big, port, target, poll);
+		if (!len) return false;
+		has_poll |= poll;
+		if (target != POLL_NO_BRANCH && target < i) return false;
+		i += (Bit32u)len;
+	}
+	return has_poll;
+}
+
+void CPU_PollingCheck(PhysPt base,Bit32u eip,Bitu port,Bitu val,Bit32u eax_mask,double until) {
+	if (!CPU_SkipPolling) return;
+	Bits index = PIC_TickIndexND();
+	Bit32u regs[8] = { reg_eax & eax_mask, reg_ebx, reg_ecx, reg_edx, reg_esi, reg_edi, reg_ebp, reg_esp };
+	Bits max_loop_cycles = POLL_MAX_LOOP_CYCLES + CPU_CycleMax / 1024; // plus the delay of port reads (IO_USEC_read_delay)
+	if (base == cpu_poll.base && eip == cpu_poll.eip && port == cpu_poll.port && !memcmp(regs, cpu_poll.regs, sizeof(regs))
+		&& (cpu_poll.count >= POLL_DETECT_COUNT || (PIC_Ticks == cpu_poll.ticks && index - cpu_poll.index < max_loop_cycles))) {
+		if (cpu_poll.count < POLL_DETECT_COUNT) cpu_poll.count++;
+	} else {
+		cpu_poll.base = base;
+		cpu_poll.eip = eip;
+		cpu_poll.port = port;
+		memcpy(cpu_poll.regs, regs, sizeof(regs));
+		cpu_poll.count = 0;
+		cpu_poll.loop_ok = -1;
+	}
+	Bitu lastval = cpu_poll.val;
+	cpu_poll.val = val;
+	cpu_poll.ticks = PIC_Ticks;
+	cpu_poll.index = index;
+
+	/* Only skip while the status stays the same, a changed value probably ends the loop */
+	if (cpu_poll.count < POLL_DETECT_COUNT || val != lastval) return;
+	if (cpu_poll.loop_ok < 0) cpu_poll.loop_ok = (CPU_PollingLoopValid(base, eip, port) ? 1 : 0);
+	if (!cpu_poll.loop_ok) return;
+	Bits skip = CPU_Cycles;
+	if (until > 0) {
+		Bits limit = (Bits)((until - PIC_FullIndex()) * CPU_CycleMax);
+		if (limit < skip) skip = limit;
+	}
+	if (skip <= 0) return;
+	CPU_Cycles -= skip;
+	CPU_IODelayRemoved += skip;
+	CPU_PollingSkipped += skip;
+	cpu_poll.index += skip;
+}
+
 void CPU_ENTER(bool use32,Bitu bytes,Bitu level) {
 	level&=0x1f;
 	Bitu sp_index=reg_esp&cpu.stack.mask;
@@ -2338,6 +2516,7 @@ public:
 		//CPU_CycleLeft=0;//needed ?
 		CPU_Cycles=0;
 		CPU_SkipCycleAutoAdjust=false;
+		CPU_SkipPolling=section->Get_bool("skippolling");
 
 		Prop_multival* p = section->Get_multival("cycles");
 		std::string type = p->GetSection()->Get_string("type");
@@ -2684,27 +2863,32 @@ void DBPSerialize_CPU(DBPArchive& ar)
 		CPU_IODelayRemoved = 0;
 }
 
-const char* DBP_CPU_GetDecoderName()
+const char* DBP_CPU_GetDecoderName(CPU_Decoder* decoder)
 {
-	if (cpudecoder == &CPU_Core_Full_Run         ) return "Full";
-	if (cpudecoder == &CPU_Core_Normal_Run       ) return "Normal";
-	if (cpudecoder == &CPU_Core_Prefetch_Run     ) return "Prefetch";
-	if (cpudecoder == &CPU_Core_Simple_Run       ) return "Simple";
-	if (cpudecoder == &CPU_Core_Normal_Trap_Run  ) return "Normal_Trap";
-	if (cpudecoder == &CPU_Core_Prefetch_Trap_Run) return "Prefetch_Trap";
-	if (cpudecoder == &CPU_Core_Simple_Trap_Run  ) return "Simple_Trap";
-	if (cpudecoder == &HLT_Decode                ) return "HLT_Decode";
+	if (decoder == &CPU_Core_Full_Run         ) return "Full";
+	if (decoder == &CPU_Core_Normal_Run       ) return "Normal";
+	if (decoder == &CPU_Core_Prefetch_Run     ) return "Prefetch";
+	if (decoder == &CPU_Core_Simple_Run       ) return "Simple";
+	if (decoder == &CPU_Core_Normal_Trap_Run  ) return "Normal_Trap";
+	if (decoder == &CPU_Core_Prefetch_Trap_Run) return "Prefetch_Trap";
+	if (decoder == &CPU_Core_Simple_Trap_Run  ) return "Simple_Trap";
+	if (decoder == &HLT_Decode                ) return "HLT_Decode";
 	#if (C_DYNAMIC_X86)
-	if (cpudecoder == &CPU_Core_Dyn_X86_Run      ) return "DynX86";
-	if (cpudecoder == &CPU_Core_Dyn_X86_Trap_Run ) return "DynX86_Trap";
+	if (decoder == &CPU_Core_Dyn_X86_Run      ) return "DynX86";
+	if (decoder == &CPU_Core_Dyn_X86_Trap_Run ) return "DynX86_Trap";
 	#elif (C_DYNREC)
-	if (cpudecoder == &CPU_Core_Dynrec_Run       ) return "DynRec";
-	if (cpudecoder == &CPU_Core_Dynrec_Trap_Run  ) return "DynRec_Trap";
+	if (decoder == &CPU_Core_Dynrec_Run       ) return "DynRec";
+	if (decoder == &CPU_Core_Dynrec_Trap_Run  ) return "DynRec_Trap";
 	#endif
 	typedef CPU_Decoder* CPU_DecoderPtr;
 	DBP_SERIALIZE_EXTERN_POINTER_LIST(CPU_DecoderPtr, IO);
-	if (cpudecoder == DBPSerializeCPU_DecoderPtrIOPtrs[0]) return "IO";
+	if (decoder == DBPSerializeCPU_DecoderPtrIOPtrs[0]) return "IO";
 	DBP_SERIALIZE_EXTERN_POINTER_LIST(CPU_DecoderPtr, Paging);
-	if (cpudecoder == DBPSerializeCPU_DecoderPtrPagingPtrs[0]) return "PageFault";
+	if (decoder == DBPSerializeCPU_DecoderPtrPagingPtrs[0]) return "PageFault";
 	return "???";
 }
+
+const char* DBP_CPU_GetDecoderName()
+{
+	return DBP_CPU_GetDecoderName(cpudecoder);
+}
@@ -125,6 +125,8 @@ static Bit8u * cache_code=NULL;
 static Bit8u * cache_code_link_blocks=NULL;
 
 static CacheBlockDynRec * cache_blocks=NULL;
+static Bitu cache_total=CACHE_TOTAL, cache_block_count=CACHE_BLOCKS; // reduced in low memory mode
+static size_t cache_memstat_size=0; // what got charged to the memory report, released as is in cache_close
 static CacheBlockDynRec link_blocks[2];		// default linking (specially marked)
 
 
@@ -596,7 +598,7 @@ static void cache_closeblock(void) {
 		}
 	}
 	// advance the active block pointer
-	if (!block->cache.next || (block->cache.next->cache.start>(cache_code_start_ptr + CACHE_TOTAL - CACHE_MAXSIZE))) {
+	if (!block->cache.next || (block->cache.next->cache.start>(cache_code_start_ptr + cache_total - CACHE_MAXSIZE))) {
 //		LOG_MSG("Cache full restarting");
 		cache.block.active=cache.block.first;
 	} else {
@@ -689,14 +691,31 @@ static void cache_init(bool enable) {
 		// see if cache is already initialized
 		if (cache_initialized) return;
 		cache_initialized = true;
+		if (cache_blocks == NULL && cache_code_start_ptr == NULL) {
+			//DBP: In low memory mode size the code cache to a quarter of the emulated RAM (at least 2MB)
+			cache_total = CACHE_TOTAL;
+			cache_block_count = CACHE_BLOCKS;
+			if (static_cast<Section_prop *>(control->GetSection("dosbox"))->Get_bool("lowmemory")) {
+				Bitu ramquarter = ((MEM_TotalPages() * 4096 / 4) & ~(Bitu)0xFFFFF);
+				if (ramquarter < 2*1024*1024) ramquarter = 2*1024*1024;
+				if (ramquarter < CACHE_TOTAL) {
+					cache_total = ramquarter;
+					cache_block_count = (Bitu)((Bit64u)CACHE_BLOCKS * ramquarter / CACHE_TOTAL);
+					LOG_MSG("[DOSBOX] Low memory mode reduced the dynamic core cache from %u KB to %u KB",
+						(unsigned)((CACHE_TOTAL + CACHE_BLOCKS*sizeof(CacheBlockDynRec)) / 1024), (unsigned)((cache_total + cache_block_count*sizeof(CacheBlockDynRec)) / 1024));
+				}
+			}
+		}
 		if (cache_blocks == NULL) {
 			// allocate the cache blocks memory
-			cache_blocks=(CacheBlockDynRec*)malloc(CACHE_BLOCKS*sizeof(CacheBlockDynRec));
+			cache_blocks=(CacheBlockDynRec*)malloc(cache_block_count*sizeof(CacheBlockDynRec));
 			if(!cache_blocks) E_Exit("Allocating cache_blocks has failed");
-			memset(cache_blocks,0,sizeof(CacheBlockDynRec)*CACHE_BLOCKS);
+			DBP_MemStats_Alloc(DBPMEM_DYNCACHE, cache_block_count*sizeof(CacheBlockDynRec));
+			cache_memstat_size += cache_block_count*sizeof(CacheBlockDynRec);
+			memset(cache_blocks,0,sizeof(CacheBlockDynRec)*cache_block_count);
 			cache.block.free=&cache_blocks[0];
 			// initialize the cache blocks
-			for (i=0;i<CACHE_BLOCKS-1;i++) {
+			for (i=0;i<(Bits)cache_block_count-1;i++) {
 				cache_blocks[i].link[0].to=(CacheBlockDynRec *)1;
 				cache_blocks[i].link[1].to=(CacheBlockDynRec *)1;
 				cache_blocks[i].cache.next=&cache_blocks[i+1];
@@ -705,12 +724,12 @@ static void cache_init(bool enable) {
 		if (cache_code_start_ptr==NULL) {
 			// allocate the code cache memory
 #if defined (WIN32)
-			cache_code_start_ptr=(Bit8u*)VirtualAlloc(0,CACHE_TOTAL+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP,
+			cache_code_start_ptr=(Bit8u*)VirtualAlloc(0,cache_total+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP,
 				MEM_COMMIT,PAGE_EXECUTE_READWRITE);
 			if (!cache_code_start_ptr)
-				cache_code_start_ptr=(Bit8u*)malloc(CACHE_TOTAL+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP);
+				cache_code_start_ptr=(Bit8u*)malloc(cache_total+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP);
 #elif defined (HAVE_LIBNX)
-			cache_code_start_ptr=(Bit8u*)nxmmap(NULL, CACHE_TOTAL+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP);
+			cache_code_start_ptr=(Bit8u*)nxmmap(NULL, cache_total+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP);
 #elif defined (VITA)
 			sceBlock = getVMBlock();
 			if (sceBlock >= 0) {
@@ -723,9 +742,11 @@ static void cache_init(bool enable) {
 			cache_code_start_ptr=(Bit8u*)WUP_RWX_MEM_BASE;
 			//memset(cache_code_start_ptr, 0, (WUP_RWX_MEM_END - WUP_RWX_MEM_BASE));
 #else
-			cache_code_start_ptr=(Bit8u*)malloc(CACHE_TOTAL+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP);
+			cache_code_start_ptr=(Bit8u*)malloc(cache_total+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP);
 #endif
 			if(!cache_code_start_ptr) E_Exit("Allocating dynamic cache failed");
+			DBP_MemStats_Alloc(DBPMEM_DYNCACHE, cache_total+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP);
+			cache_memstat_size += cache_total+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP;
 
 			// align the cache at a page boundary
 			cache_code=(Bit8u*)(((Bitu)cache_code_start_ptr + PAGESIZE_TEMP-1) & ~(PAGESIZE_TEMP-1));//Bitu is same size as a pointer.
@@ -734,14 +755,14 @@ static void cache_init(bool enable) {
 			cache_code=cache_code+PAGESIZE_TEMP;
 
 #if (C_HAVE_MPROTECT)
-			if(mprotect(cache_code_link_blocks,CACHE_TOTAL+CACHE_MAXSIZE+PAGESIZE_TEMP,PROT_WRITE|PROT_READ|PROT_EXEC))
+			if(mprotect(cache_code_link_blocks,cache_total+CACHE_MAXSIZE+PAGESIZE_TEMP,PROT_WRITE|PROT_READ|PROT_EXEC))
 				LOG_MSG("Setting execute permission on the code cache has failed");
 #endif
 			CacheBlockDynRec * block=cache_getblock();
 			cache.block.first=block;
 			cache.block.active=block;
 			block->cache.start=&cache_code[0];
-			block->cache.size=CACHE_TOTAL;
+			block->cache.size=cache_total;
 			block->cache.next=0;						// last block in the list
 		}
 		// setup the default blocks for block linkage returns
@@ -794,6 +815,8 @@ static void cache_init(bool enable) {
 			newpage->next=cache.free_pages;
 			cache.free_pages=newpage;
 		}
+		DBP_MemStats_Alloc(DBPMEM_DYNCACHE, CACHE_PAGES*sizeof(CodePageHandlerDynRec));
+		cache_memstat_size += CACHE_PAGES*sizeof(CodePageHandlerDynRec);
 	}
 }
 
@@ -817,7 +840,7 @@ static void cache_close(void) {
 		if (!VirtualFree(cache_code_start_ptr, 0, MEM_RELEASE))
 			free(cache_code_start_ptr);
 #elif defined (HAVE_LIBNX)
-		nxmunmap(cache_code_start_ptr, CACHE_TOTAL+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP);
+		nxmunmap(cache_code_start_ptr, cache_total+CACHE_MAXSIZE+PAGESIZE_TEMP-1+PAGESIZE_TEMP);
 #elif defined (VITA)
 		sceKernelFreeMemBlock(sceBlock);
 		sceBlock = 0;
@@ -827,6 +850,8 @@ static void cache_close(void) {
 #endif
 		cache_code_start_ptr = NULL;
 	}
+	DBP_MemStats_Free(DBPMEM_DYNCACHE, cache_memstat_size);
+	cache_memstat_size = 0;
 	cache_code = NULL;
 	cache_code_link_blocks = NULL;
 	cache_initialized = false;
@@ -840,9 +865,9 @@ static void DBPSerialize_cache_reset(void) {
 		}
 
 		DBP_ASSERT(cache_blocks);
-		memset(cache_blocks,0,sizeof(CacheBlockDynRec)*CACHE_BLOCKS);
+		memset(cache_blocks,0,sizeof(CacheBlockDynRec)*cache_block_count);
 		cache.block.free=&cache_blocks[0];
-		for (Bits i=0;i<CACHE_BLOCKS-1;i++) {
+		for (Bits i=0;i<(Bits)cache_block_count-1;i++) {
 			cache_blocks[i].link[0].to=(CacheBlockDynRec *)1;
 			cache_blocks[i].link[1].to=(CacheBlockDynRec *)1;
 			cache_blocks[i].cache.next=&cache_blocks[i+1];
@@ -853,7 +878,7 @@ static void DBPSerialize_cache_reset(void) {
 		cache.block.first=block;
 		cache.block.active=block;
 		block->cache.start=&cache_code[0];
-		block->cache.size=CACHE_TOTAL;
+		block->cache.size=cache_total;
 		block->cache.next=0;
 
 		/* Setup the default blocks for block linkage returns */
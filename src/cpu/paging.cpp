@@ -29,6 +29,7 @@
 #include "cpu.h"
 #include "debug.h"
 #include "setup.h"
+#include "dbp_memstats.h"
 
 /*
   DBP: Added improved paging implementation with C++ exception page faults from Taewoong's Daum branch
@@ -1346,7 +1347,7 @@ static InitPageUserROHandler dyncore_init_page_handler_userro;
 static NewInitPageHandler normalcore_init_page_handler;
 static ExceptionPageHandler normalcore_exception_handler;
 static PageFoilHandler normalcore_foiling_handler;
-static PageHandler* init_page_handler;
+PageHandler* init_page_handler;
 
 Bitu PAGING_GetDirBase(void) {
 	return paging.cr3;
@@ -1367,15 +1368,14 @@ bool PAGING_ForcePageInit(Bitu lin_addr) {
 
 #if defined(USE_FULL_TLB)
 void PAGING_InitTLB(void) {
-	//DBP: Performance improvement
-	memset(paging.tlb.read, 0, sizeof(paging.tlb.read));
-	memset(paging.tlb.write, 0, sizeof(paging.tlb.write));
-	for (Bitu i=0;i<TLB_SIZE;i++) paging.tlb.readhandler[i]=init_page_handler;
-	for (Bitu i=0;i<TLB_SIZE;i++) paging.tlb.writehandler[i]=init_page_handler;
-	paging.ur_links.used=0;
-	paging.krw_links.used=0;
-	paging.kr_links.used=0;
-	paging.links.used=0;
+	//DBP: Only reset the first MB and the linked entries instead of the entire TLB (see get_tlb_readhandler)
+	for (Bitu i=0;i<LINK_START;i++) {
+		paging.tlb.read[i]=0;
+		paging.tlb.write[i]=0;
+		paging.tlb.readhandler[i]=NULL;
+		paging.tlb.writehandler[i]=NULL;
+	}
+	PAGING_ClearTLB();
 }
 
 void PAGING_ClearTLB(void) {
@@ -1386,8 +1386,8 @@ void PAGING_ClearTLB(void) {
 		Bitu page=*entries++;
 		paging.tlb.read[page]=0;
 		paging.tlb.write[page]=0;
-		paging.tlb.readhandler[page]=init_page_handler;
-		paging.tlb.writehandler[page]=init_page_handler;
+		paging.tlb.readhandler[page]=NULL;
+		paging.tlb.writehandler[page]=NULL;
 	}
 	paging.ur_links.used=0;
 	paging.krw_links.used=0;
@@ -1399,8 +1399,8 @@ void PAGING_UnlinkPages(Bitu lin_page,Bitu pages) {
 	for (;pages>0;pages--) {
 		paging.tlb.read[lin_page]=0;
 		paging.tlb.write[lin_page]=0;
-		paging.tlb.readhandler[lin_page]=init_page_handler;
-		paging.tlb.writehandler[lin_page]=init_page_handler;
+		paging.tlb.readhandler[lin_page]=NULL;
+		paging.tlb.writehandler[lin_page]=NULL;
 		lin_page++;
 	}
 }
@@ -1411,8 +1411,8 @@ void PAGING_MapPage(Bitu lin_page,Bitu phys_page) {
 		paging.firstmb[lin_page]=phys_page;
 		paging.tlb.read[lin_page]=0;
 		paging.tlb.write[lin_page]=0;
-		paging.tlb.readhandler[lin_page]=init_page_handler;
-		paging.tlb.writehandler[lin_page]=init_page_handler;
+		paging.tlb.readhandler[lin_page]=NULL;
+		paging.tlb.writehandler[lin_page]=NULL;
 	} else {
 		PAGING_LinkPage(lin_page,phys_page);
 	}
@@ -1687,6 +1687,7 @@ bool PAGING_Enabled(void) {
 }
 
 static void PAGING_ShutDown(Section* /*sec*/) {
+	DBP_MemStats_Free(DBPMEM_PAGING, sizeof(paging));
 	init_page_handler = NULL;
 	paging_prevent_exception_jump = false;
 }
@@ -1694,6 +1695,7 @@ static void PAGING_ShutDown(Section* /*sec*/) {
 void PAGING_Init(Section * sec) {
 	//logcnt = 0;
 	sec->AddDestroyFunction(&PAGING_ShutDown);
+	DBP_MemStats_Alloc(DBPMEM_PAGING, sizeof(paging));
 
 	Bitu i;
 
@@ -1718,17 +1720,7 @@ void PAGING_OnChangeCore(void) {
 	// Use dynamic core compatible init page handler when core is set to 'dynamic' or 'auto'
 	const char* core = static_cast<Section_prop *>(control->GetSection("cpu"))->Get_string("core");
 	PageHandler* next_init_page_handler = ((core[0] == 'a' || core[0] == 'd') ? (PageHandler*)&dyncore_init_page_handler : (PageHandler*)&normalcore_init_page_handler);
-	PageHandler* prev_init_page_handler = init_page_handler;
-	if (prev_init_page_handler == next_init_page_handler) return;
-
-	if (prev_init_page_handler)
-	{
-		for (Bitu i=0;i<TLB_SIZE;i++)
-		{
-			if (paging.tlb.readhandler[i]==prev_init_page_handler) paging.tlb.readhandler[i]=next_init_page_handler;
-			if (paging.tlb.writehandler[i]==prev_init_page_handler) paging.tlb.writehandler[i]=next_init_page_handler;
-		}
-	}
+	// Unlinked TLB entries have a NULL handler so they don't need to be updated
 	init_page_handler = next_init_page_handler;
 }
 
@@ -1744,7 +1736,11 @@ void DBPSerialize_Paging(DBPArchive& ar)
 	ar.Serialize(paging.base);
 	ar.SerializeSparse(paging.tlb.phys_page, sizeof(paging.tlb.phys_page));
 	if (ar.version < 5)
+	{
+		// Unlink the pages of the current session before the old link list gets overwritten (it isn't used anymore after loading)
+		if (ar.mode == DBPArchive::MODE_LOAD) PAGING_ClearTLB();
 		ar.SerializeSparse(paging.links.entries, sizeof(paging.links.entries));
+	}
 	ar.SerializeArray(paging.firstmb);
 	ar.Serialize(paging.enabled);
 	if (ar.version >= 5)
@@ -1756,14 +1752,7 @@ void DBPSerialize_Paging(DBPArchive& ar)
 
 	if (ar.mode == DBPArchive::MODE_LOAD)
 	{
-		//PAGING_InitTLB();
-		memset(paging.tlb.read, 0, sizeof(paging.tlb.read));
-		memset(paging.tlb.write, 0, sizeof(paging.tlb.write));
-		for (Bitu i = 0; i != LINK_START; i++) {
-			paging.tlb.readhandler[i]=init_page_handler;
-			paging.tlb.writehandler[i]=init_page_handler;
-		}
-		PAGING_ClearTLB();
+		PAGING_InitTLB();
 	}
 	if (ar.mode == DBPArchive::MODE_ZERO)
 		pf_queue.used = 0;
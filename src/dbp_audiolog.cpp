@@ -0,0 +1,260 @@
+/*
+ *  Copyright (C) 2020-2023 Bernhard Schelling
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include "dosbox.h"
+#include "pic.h"
+#include "inout.h"
+#include "cross.h"
+#include "control.h"
+#include "dbp_audiolog.h"
+#include <string.h>
+#include <vector>
+#include <chrono>
+
+bool DBP_AudioLog_Recording, DBP_AudioLog_Replaying;
+
+struct DBP_AudioLogRecord
+{
+	double time; // milliseconds since the first write
+	Bit16u port; // DMA channel number for DMA reads
+	Bit8u iolen, pad; // iolen 0 marks a DMA read, the record is then followed by val bytes of data
+	Bit32u val;
+};
+
+// Version 1 logs had no DMA reads and can still be replayed
+static const char DBP_AudioLog_Magic[8] = { 'D','B','P','A','U','D','L','2' };
+
+static struct
+{
+	FILE* f;
+	double base;
+	std::vector<DBP_AudioLogRecord> records;
+	std::vector<Bit8u> dma_data[8]; // data read by each DMA channel in order
+	size_t dma_pos[8];
+	Bit32u ports[0x10000 / 32]; // bitmap of the logged ports
+	Bitu pos, freq;
+	Bit32u seconds;
+	Bit64u samples, target, hash, render_us, mix_start;
+	bool started, done, reported;
+} dbp_audlog;
+
+static Bit64u DBP_AudioLog_Time()
+{
+	return (Bit64u)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void DBP_AudioLog_AddPorts(Bitu first, Bitu last)
+{
+	for (Bitu port = first; port <= last && port <= 0xFFFF; port++)
+		dbp_audlog.ports[port >> 5] |= (1u << (port & 31));
+}
+
+void DBP_AudioLog_SetupPorts()
+{
+	if (!DBP_AudioLog_Recording && !DBP_AudioLog_Replaying) return;
+	memset(dbp_audlog.ports, 0, sizeof(dbp_audlog.ports));
+
+	// PC speaker (PIT channel 2 and the gate in port 61h) and the DMA controllers which feed sample data to the Sound Blaster and GUS
+	DBP_AudioLog_AddPorts(0x42, 0x43);
+	DBP_AudioLog_AddPorts(0x61, 0x61);
+	DBP_AudioLog_AddPorts(0x00, 0x0F);
+	DBP_AudioLog_AddPorts(0x81, 0x8F);
+	DBP_AudioLog_AddPorts(0xC0, 0xDF); // also the Tandy PSG at 0xC0
+
+	Section_prop* sb = static_cast<Section_prop*>(control->GetSection("sblaster"));
+	const char *sbtype = sb->Get_string("sbtype"), *oplmode = sb->Get_string("oplmode");
+	const bool auto_opl = !strcasecmp(oplmode, "auto");
+	if (strcasecmp(sbtype, "none") && strcasecmp(sbtype, "gb"))
+		DBP_AudioLog_AddPorts(sb->Get_hex("sbbase"), sb->Get_hex("sbbase") + 0xF); // Sound Blaster, its mixer and its OPL
+	else if (!strcasecmp(oplmode, "cms") || !strcasecmp(oplmode, "opl2") || (auto_opl && !strcasecmp(sbtype, "gb")))
+		DBP_AudioLog_AddPorts(sb->Get_hex("sbbase"), sb->Get_hex("sbbase") + 0x3); // CMS/Game Blaster
+	if (strcasecmp(oplmode, "none") && strcasecmp(oplmode, "cms") && (!auto_opl || (strcasecmp(sbtype, "none") && strcasecmp(sbtype, "gb"))))
+		DBP_AudioLog_AddPorts(0x388, 0x38B); // AdLib
+
+	Section_prop* gus = static_cast<Section_prop*>(control->GetSection("gus"));
+	if (gus->Get_bool("gus"))
+	{
+		DBP_AudioLog_AddPorts(gus->Get_hex("gusbase"), gus->Get_hex("gusbase") + 0xF);
+		DBP_AudioLog_AddPorts(gus->Get_hex("gusbase") + 0x100, gus->Get_hex("gusbase") + 0x107);
+		DBP_AudioLog_AddPorts(0x388, 0x389); // AdLib writes get forwarded to the GUS
+	}
+
+	Section_prop* midi = static_cast<Section_prop*>(control->GetSection("midi"));
+	const char* mpu401 = midi->Get_string("mpu401");
+	if (strcasecmp(mpu401, "none") && strcasecmp(mpu401, "off") && strcasecmp(mpu401, "false"))
+		DBP_AudioLog_AddPorts(0x330, 0x331); // MPU-401 (MT-32, TinySoundFont)
+
+	Section_prop* speaker = static_cast<Section_prop*>(control->GetSection("speaker"));
+	if (speaker->Get_bool("disney"))
+		DBP_AudioLog_AddPorts(0x378, 0x37A); // Disney Sound Source
+}
+
+static bool DBP_AudioLog_IsSoundPort(Bitu port, Bitu val)
+{
+	if (port == 0x43) return ((val >> 6) == 2); // only PIT control words for channel 2
+	return (port <= 0xFFFF && (dbp_audlog.ports[port >> 5] & (1u << (port & 31))));
+}
+
+bool DBP_AudioLog_StartRecord(const char* path)
+{
+	if (DBP_AudioLog_Recording || DBP_AudioLog_Replaying || !(dbp_audlog.f = fopen_wrap(path, "wb"))) return false;
+	fwrite(DBP_AudioLog_Magic, sizeof(DBP_AudioLog_Magic), 1, dbp_audlog.f);
+	dbp_audlog.started = false;
+	DBP_AudioLog_Recording = true;
+	return true;
+}
+
+void DBP_AudioLog_PortWrite(Bitu port, Bitu val, Bitu iolen)
+{
+	if (!DBP_AudioLog_IsSoundPort(port, val)) return;
+	double now = PIC_FullIndex();
+	if (!dbp_audlog.started) { dbp_audlog.base = now; dbp_audlog.started = true; }
+	DBP_AudioLogRecord r = { now - dbp_audlog.base, (Bit16u)port, (Bit8u)iolen, 0, (Bit32u)val };
+	fwrite(&r, sizeof(r), 1, dbp_audlog.f);
+}
+
+void DBP_AudioLog_DmaRead(Bit8u channel, Bit8u* data, Bitu len)
+{
+	if (!len) return;
+	if (DBP_AudioLog_Recording)
+	{
+		double now = PIC_FullIndex();
+		if (!dbp_audlog.started) { dbp_audlog.base = now; dbp_audlog.started = true; }
+		DBP_AudioLogRecord r = { now - dbp_audlog.base, (Bit16u)channel, 0, 0, (Bit32u)len };
+		fwrite(&r, sizeof(r), 1, dbp_audlog.f);
+		fwrite(data, len, 1, dbp_audlog.f);
+		return;
+	}
+	// Devices read DMA data in the same order during a replay, so each channel is a plain stream of bytes
+	std::vector<Bit8u>& stream = dbp_audlog.dma_data[channel & 7];
+	size_t& pos = dbp_audlog.dma_pos[channel & 7];
+	if (len > stream.size() - pos) len = stream.size() - pos;
+	if (len) memcpy(data, &stream[pos], len);
+	pos += len;
+}
+
+bool DBP_AudioLog_IsGuestAccessBlocked(Bitu port, Bitu val, bool read)
+{
+	// Reads of the PIT and port 61h don't change the sound output and stay available for guest timing loops
+	if (read && (port == 0x42 || port == 0x43 || port == 0x61)) return false;
+	return DBP_AudioLog_IsSoundPort(port, val);
+}
+
+bool DBP_AudioLog_StartReplay(const char* path, Bit32u seconds)
+{
+	if (DBP_AudioLog_Recording || DBP_AudioLog_Replaying) return false;
+	FILE* f = fopen_wrap(path, "rb");
+	if (!f) return false;
+	char magic[sizeof(DBP_AudioLog_Magic)];
+	DBP_AudioLogRecord r;
+	bool valid = (fread(magic, sizeof(magic), 1, f) && !memcmp(magic, DBP_AudioLog_Magic, sizeof(magic) - 1) && (magic[7] == '1' || magic[7] == '2'));
+	dbp_audlog.records.clear();
+	for (std::vector<Bit8u>& stream : dbp_audlog.dma_data) stream.clear();
+	memset(dbp_audlog.dma_pos, 0, sizeof(dbp_audlog.dma_pos));
+	while (valid && fread(&r, sizeof(r), 1, f))
+	{
+		if (r.iolen) { dbp_audlog.records.push_back(r); continue; }
+		std::vector<Bit8u>& stream = dbp_audlog.dma_data[r.port & 7];
+		stream.resize(stream.size() + r.val);
+		valid = (!r.val || fread(&stream[stream.size() - r.val], r.val, 1, f) == 1);
+	}
+	fclose(f);
+	if (!valid) return false;
+
+	// Without a given duration render until one second after the last write
+	dbp_audlog.seconds = (seconds ? seconds : (Bit32u)((dbp_audlog.records.size() ? dbp_audlog.records.back().time : 0) / 1000) + 1);
+	dbp_audlog.pos = 0;
+	dbp_audlog.samples = dbp_audlog.target = dbp_audlog.render_us = 0;
+	dbp_audlog.hash = 0xcbf29ce484222325ULL; // FNV-1a
+	dbp_audlog.started = dbp_audlog.done = dbp_audlog.reported = false;
+	DBP_AudioLog_Replaying = true;
+	return true;
+}
+
+void DBP_AudioLog_ReplayEvent(Bitu /*val*/)
+{
+	double now = PIC_FullIndex() - dbp_audlog.base;
+	const DBP_AudioLogRecord* recs = &dbp_audlog.records[0];
+	const Bit32s cycle_left = CPU_CycleLeft;
+	for (Bitu count = dbp_audlog.records.size(); dbp_audlog.pos != count; dbp_audlog.pos++)
+	{
+		const DBP_AudioLogRecord& r = recs[dbp_audlog.pos];
+		if (r.time > now + 0.0001)
+		{
+			CPU_CycleLeft = cycle_left;
+			PIC_AddEvent(DBP_AudioLog_ReplayEvent, (float)(r.time - now));
+			return;
+		}
+		// Events get serviced a few cycles late depending on what the guest executes, so move the tick index
+		// to the logged cycle while the device handles the write (CPU_Cycles is 0 while events are serviced)
+		Bits cycle = (Bits)((dbp_audlog.base + r.time - PIC_Ticks) * CPU_CycleMax + 0.5);
+		CPU_CycleLeft = (Bit32s)(CPU_CycleMax - (cycle < 0 ? 0 : (cycle >= CPU_CycleMax ? CPU_CycleMax - 1 : cycle)));
+		// Call the device handlers directly, IO_Write* drops writes to the logged ports during a replay
+		io_writehandlers[r.iolen == 4 ? 2 : (r.iolen == 2 ? 1 : 0)][r.port](r.port, r.val, (r.iolen == 4 || r.iolen == 2 ? r.iolen : 1));
+	}
+	CPU_CycleLeft = cycle_left;
+}
+
+void DBP_AudioLog_MixBegin()
+{
+	if (!dbp_audlog.started)
+	{
+		// Start feeding the log with the first mixer tick once the machine is running
+		dbp_audlog.started = true;
+		dbp_audlog.base = (double)PIC_Ticks; // start of the millisecond to not depend on the guest's position within it
+		if (dbp_audlog.records.size()) PIC_AddEvent(DBP_AudioLog_ReplayEvent, (float)dbp_audlog.records[0].time);
+	}
+	dbp_audlog.mix_start = DBP_AudioLog_Time();
+}
+
+void DBP_AudioLog_MixEnd(const Bit16s* samples, Bitu count, Bitu freq)
+{
+	Bit64u now = DBP_AudioLog_Time();
+	dbp_audlog.render_us += now - dbp_audlog.mix_start;
+	dbp_audlog.mix_start = now;
+	if (dbp_audlog.done) return;
+	if (!dbp_audlog.target) { dbp_audlog.freq = freq; dbp_audlog.target = (Bit64u)dbp_audlog.seconds * freq; }
+	if (count > dbp_audlog.target - dbp_audlog.samples) count = (Bitu)(dbp_audlog.target - dbp_audlog.samples);
+	for (const Bit8u *p = (const Bit8u*)samples, *pEnd = p + count * 4; p != pEnd; p++)
+		dbp_audlog.hash = (dbp_audlog.hash ^ *p) * 0x100000001b3ULL;
+	if ((dbp_audlog.samples += count) < dbp_audlog.target) return;
+
+	dbp_audlog.done = true;
+	LOG_MSG("[AUDIOLOG] Replayed %u of %u writes, %u seconds at %u Hz, output hash %016llx, render time %.3f ms per emulated second",
+		(unsigned)dbp_audlog.pos, (unsigned)dbp_audlog.records.size(), (unsigned)dbp_audlog.seconds, (unsigned)dbp_audlog.freq,
+		(unsigned long long)dbp_audlog.hash, dbp_audlog.render_us / 1000.0 / dbp_audlog.seconds);
+}
+
+bool DBP_AudioLog_ReplayDone()
+{
+	// Returns true only once so the frontend gets asked to shut down a single time
+	if (!DBP_AudioLog_Replaying || !dbp_audlog.done || dbp_audlog.reported) return false;
+	dbp_audlog.reported = true;
+	return true;
+}
+
+void DBP_AudioLog_Stop()
+{
+	if (DBP_AudioLog_Recording) fclose(dbp_audlog.f);
+	DBP_AudioLog_Recording = DBP_AudioLog_Replaying = false;
+	dbp_audlog.records.clear();
+	for (std::vector<Bit8u>& stream : dbp_audlog.dma_data) std::vector<Bit8u>().swap(stream);
+}
+
+#include <dbp_serialize.h>
+DBP_SERIALIZE_SET_POINTER_LIST(PIC_EventHandler, AudioLog, DBP_AudioLog_ReplayEvent);
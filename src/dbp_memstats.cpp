@@ -0,0 +1,59 @@
+/*
+ *  Copyright (C) 2020-2023 Bernhard Schelling
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <dbp_memstats.h>
+#include <stdio.h>
+
+// Allocations happen on the emulation thread (or while it is paused) so plain counters are enough here
+static DBP_MemStat dbp_memstats[DBPMEM_TAG_COUNT];
+
+static const char* dbp_memstat_names[DBPMEM_TAG_COUNT] =
+{
+	"Paging TLB", "Dynamic Core Cache", "System RAM", "VGA Memory", "Voodoo Memory", "GUS RAM", "Mixer Buffers", "ZIP Caches", "FAT Emulator", "Disk Overlays", "SoundFont", "MT-32",
+};
+
+void DBP_MemStats_Alloc(DBP_MemTag tag, size_t size)
+{
+	DBP_MemStat& s = dbp_memstats[tag];
+	s.current += size;
+	if (s.current > s.peak) s.peak = s.current;
+}
+
+void DBP_MemStats_Free(DBP_MemTag tag, size_t size)
+{
+	DBP_MemStat& s = dbp_memstats[tag];
+	DBP_ASSERT(s.current >= size);
+	s.current = (s.current > size ? s.current - size : 0);
+}
+
+const DBP_MemStat& DBP_MemStats_Get(DBP_MemTag tag)
+{
+	return dbp_memstats[tag];
+}
+
+const char* DBP_MemStats_GetName(DBP_MemTag tag)
+{
+	return dbp_memstat_names[tag];
+}
+
+size_t DBP_MemStats_Total(bool peak)
+{
+	size_t res = 0;
+	for (const DBP_MemStat& s : dbp_memstats) res += (peak ? s.peak : s.current);
+	return res;
+}
@@ -0,0 +1,139 @@
+/*
+ *  Copyright (C) 2020-2023 Bernhard Schelling
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include "dosbox.h"
+#include "cpu.h"
+#include "regs.h"
+#include "cross.h"
+#include "dbp_profiler.h"
+#include "dbp_threads.h"
+#include "../libretro-common/include/retro_timers.h"
+#include <map>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <string.h>
+
+volatile DBP_ProfContext DBP_Profiler_Context;
+
+static struct
+{
+	volatile bool running;
+	Semaphore stopped;
+	Bit32u interval_ms, total, contexts[DBPPROF_CONTEXT_COUNT];
+	std::map<CPU_Decoder*, Bit32u> decoders;
+	std::map<std::string, Bit32u> programs;
+	std::map<Bit64u, Bit32u> regions; // CS << 32 | EIP & ~0xFF
+	std::map<Bit64u, std::string> region_programs;
+} dbp_prof;
+
+static void DBP_Profiler_Sample()
+{
+	extern const char* RunningProgram;
+	char program[9];
+	strncpy(program, RunningProgram, 8);
+	program[8] = '\0';
+
+	DBP_ProfContext ctx = DBP_Profiler_Context;
+	dbp_prof.total++;
+	dbp_prof.contexts[ctx < DBPPROF_CONTEXT_COUNT ? ctx : DBPPROF_CPU]++;
+	if (ctx == DBPPROF_WAIT) return;
+	dbp_prof.programs[program]++;
+	if (ctx != DBPPROF_CPU) return;
+
+	dbp_prof.decoders[cpudecoder]++;
+	Bit64u region = ((Bit64u)SegValue(cs) << 32) | (reg_eip & ~(Bit32u)0xFF);
+	if (dbp_prof.regions[region]++ == 0) dbp_prof.region_programs[region] = program;
+}
+
+static Thread::RET_t THREAD_CC DBP_Profiler_Thread(void*)
+{
+	while (dbp_prof.running)
+	{
+		retro_sleep(dbp_prof.interval_ms);
+		if (dbp_prof.running) DBP_Profiler_Sample();
+	}
+	dbp_prof.stopped.Post();
+	return 0;
+}
+
+void DBP_Profiler_Start(Bit32u interval_ms)
+{
+	if (dbp_prof.running) return;
+	dbp_prof.interval_ms = (interval_ms ? interval_ms : 1);
+	dbp_prof.running = true;
+	Thread::StartDetached(DBP_Profiler_Thread);
+}
+
+void DBP_Profiler_Reset()
+{
+	// Only call while the emulation thread is not running, a paused thread restores its own context when it resumes
+	DBP_Profiler_Context = DBPPROF_CPU;
+}
+
+template <typename K> static void DBP_Profiler_Sorted(const std::map<K, Bit32u>& map, std::vector<std::pair<Bit32u, K> >& out)
+{
+	out.clear();
+	for (const auto& it : map) out.push_back(std::make_pair(it.second, it.first));
+	std::sort(out.begin(), out.end(), [](const std::pair<Bit32u, K>& a, const std::pair<Bit32u, K>& b) { return a.first > b.first; });
+}
+
+bool DBP_Profiler_Stop(const char* report_path)
+{
+	if (!dbp_prof.running) return false;
+	dbp_prof.running = false;
+	dbp_prof.stopped.Wait();
+
+	FILE* f = (dbp_prof.total && report_path ? fopen_wrap(report_path, "w") : NULL);
+	if (f)
+	{
+		static const char* context_names[DBPPROF_CONTEXT_COUNT] = { "CPU", "PIC Events", "Timer Ticks", "Mixer", "Waiting for Frontend" };
+		const double pct = 100.0 / dbp_prof.total;
+		fprintf(f, "DOSBox Pure Profile - %u samples every %u ms\n\nSubsystem:\n", dbp_prof.total, dbp_prof.interval_ms);
+		for (int i = 0; i != DBPPROF_CONTEXT_COUNT; i++)
+			fprintf(f, "  %-24s %8u %6.2f%%\n", context_names[i], dbp_prof.contexts[i], dbp_prof.contexts[i] * pct);
+
+		std::vector<std::pair<Bit32u, CPU_Decoder*> > decoders;
+		DBP_Profiler_Sorted(dbp_prof.decoders, decoders);
+		fprintf(f, "\nCPU Core:\n");
+		extern const char* DBP_CPU_GetDecoderName(CPU_Decoder* decoder);
+		for (const auto& it : decoders)
+			fprintf(f, "  %-24s %8u %6.2f%%\n", DBP_CPU_GetDecoderName(it.second), it.first, it.first * pct);
+
+		std::vector<std::pair<Bit32u, std::string> > programs;
+		DBP_Profiler_Sorted(dbp_prof.programs, programs);
+		fprintf(f, "\nProgram:\n");
+		for (const auto& it : programs)
+			fprintf(f, "  %-24s %8u %6.2f%%\n", it.second.c_str(), it.first, it.first * pct);
+
+		std::vector<std::pair<Bit32u, Bit64u> > regions;
+		DBP_Profiler_Sorted(dbp_prof.regions, regions);
+		fprintf(f, "\nCS:EIP Region (top %u of %u):\n", (unsigned)(regions.size() < 50 ? regions.size() : 50), (unsigned)regions.size());
+		for (size_t i = 0; i != regions.size() && i != 50; i++)
+			fprintf(f, "  %04X:%08X-%08X %-8s %8u %6.2f%%\n", (unsigned)(regions[i].second >> 32), (unsigned)regions[i].second, (unsigned)regions[i].second + 0xFF, dbp_prof.region_programs[regions[i].second].c_str(), regions[i].first, regions[i].first * pct);
+		fclose(f);
+	}
+
+	dbp_prof.total = 0;
+	memset(dbp_prof.contexts, 0, sizeof(dbp_prof.contexts));
+	dbp_prof.decoders.clear();
+	dbp_prof.programs.clear();
+	dbp_prof.regions.clear();
+	dbp_prof.region_programs.clear();
+	return (f != NULL);
+}
@@ -181,13 +181,30 @@ void DBPArchive::SerializeSparse(void* ptr, size_t sz)
 		Bit8u* p = (Bit8u*)ptr;
 		for (Serialize(skip).Serialize(len); len; Serialize(skip).Serialize(len))
 		{
-			memset(p, 0, skip);
+			ClearSparse(p, skip);
 			p += skip;
 			SerializeBytes(p, len);
 			p += len;
 			if (had_error) return;
 		}
-		memset(p, 0, (Bit8u*)ptr + sz - p);
+		ClearSparse(p, (Bit8u*)ptr + sz - p);
+	}
+}
+
+void DBPArchive::ClearSparse(void* ptr, size_t sz)
+{
+	// Large buffers are allocated with calloc and only get committed by the OS when written to. Reading them is
+	// free so instead of a plain memset check each 4 KB block first which keeps unused memory from being committed.
+	for (Bit8u *p = (Bit8u*)ptr, *end = p + sz, *block_end; p != end; p = block_end)
+	{
+		block_end = p + (4096 - ((size_t)p & 4095));
+		if (block_end > end) block_end = end;
+		const Bit8u* z = p;
+		for (; z != block_end && ((size_t)z & 7); z++) if (*z) goto clear;
+		for (; block_end - z >= 8; z += 8) if (*(const Bit64u*)z) goto clear;
+		for (; z != block_end; z++) if (*z) goto clear;
+		continue;
+		clear: memset(p, 0, block_end - p);
 	}
 }
 
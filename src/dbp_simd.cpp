@@ -0,0 +1,476 @@
+/*
+ *  Copyright (C) 2020-2023 Bernhard Schelling
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include "dbp_simd.h"
+#include "logging.h"
+#include <string.h>
+#include <stdlib.h>
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#define DBP_SIMD_HAVE_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#define DBP_SIMD_TARGET(t)
+#else
+#include <cpuid.h>
+#define DBP_SIMD_TARGET(t) __attribute__((target(t)))
+#endif
+#include <immintrin.h>
+#if defined(_MSC_VER) || defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+#define DBP_SIMD_HAVE_AVX2 // compilers that can build AVX2 functions without enabling it for the whole file
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DBP_SIMD_HAVE_NEON // NEON is only used when the compiler targets it (always the case on 64-bit ARM)
+#include <arm_neon.h>
+#endif
+
+static bool MemEqual_Scalar(const void* a, const void* b, size_t len)
+{
+	return !memcmp(a, b, len);
+}
+
+static void MixToS16_Scalar(Bit16s* out, Bit32s* work, size_t count, unsigned shift)
+{
+	for (Bit32s *p = work, *pEnd = work + count; p != pEnd; p++, out++)
+	{
+		Bit32s s = (*p >> shift);
+		*out = (Bit16s)(s < -32768 ? -32768 : (s > 32767 ? 32767 : s));
+		*p = 0;
+	}
+}
+
+static Bit32u CRC32_Scalar(const Bit8u* ptr, size_t len, Bit32u crc)
+{
+	// Karl Malbrain's compact CRC-32. See "A compact CCITT crc16 and crc32 C implementation that balances processor cache usage against speed": http://www.geocities.com/malbrain/
+	static const Bit32u s_crc32[16] = { 0, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c, 0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c };
+	Bit32u crcu32 = (Bit32u)~crc;
+	while (len--) { Bit8u b = *ptr++; crcu32 = (crcu32 >> 4) ^ s_crc32[(crcu32 & 0xF) ^ (b & 0xF)]; crcu32 = (crcu32 >> 4) ^ s_crc32[(crcu32 & 0xF) ^ (b >> 4)]; }
+	return ~crcu32;
+}
+
+static void PaletteToXRGB_Scalar(Bit32u* out, const Bit8u* src, size_t count, const Bit32u* pal)
+{
+	for (; count >= 4; count -= 4, src += 4, out += 4)
+	{
+		Bit32u p0 = pal[src[0]], p1 = pal[src[1]], p2 = pal[src[2]], p3 = pal[src[3]];
+		out[0] = p0; out[1] = p1; out[2] = p2; out[3] = p3;
+	}
+	while (count--) *(out++) = pal[*(src++)];
+}
+
+// Same bit expansion as PMAKE in render_templates.h (xRRRrrGGGggBBBbb -> RRRrrRRRGGGggGGGBBBbbBBB)
+static void RGB15ToXRGB_Scalar(Bit32u* out, const Bit16u* src, size_t count)
+{
+	for (const Bit16u* srcEnd = src + count; src != srcEnd; src++, out++)
+	{
+		Bit32u v = *src;
+		*out = ((v&(31<<10))<<9)|((v&(31<<5))<<6)|((v&31)<<3)|((v&(7<<12))<<4)|((v&(7<<7))<<1)|((v&(7<<2))>>2);
+	}
+}
+
+// Same bit expansion as PMAKE in render_templates.h (RRRrrGGggggBBBbb -> RRRrrRRRGGggggGGBBBbbBBB)
+static void RGB16ToXRGB_Scalar(Bit32u* out, const Bit16u* src, size_t count)
+{
+	for (const Bit16u* srcEnd = src + count; src != srcEnd; src++, out++)
+	{
+		Bit32u v = *src;
+		*out = ((v&(31<<11))<<8)|((v&(63<<5))<<5)|((v&0xE01F)<<3)|((v&(3<<9))>>1)|((v&(7<<2))>>2);
+	}
+}
+
+// Slicing-by-8 table driven CRC-32, processes 8 bytes per step (8 KB of tables built on init)
+static Bit32u crc32_slice8[8][256];
+
+static Bit32u CRC32_Slice8(const Bit8u* ptr, size_t len, Bit32u crc)
+{
+	Bit32u c = (Bit32u)~crc;
+	for (; len && ((size_t)ptr & 3); len--) c = (c >> 8) ^ crc32_slice8[0][(c ^ *ptr++) & 0xFF];
+	for (; len >= 8; len -= 8, ptr += 8)
+	{
+		Bit32u lo = c ^ (ptr[0] | (ptr[1] << 8) | (ptr[2] << 16) | ((Bit32u)ptr[3] << 24)), hi = (ptr[4] | (ptr[5] << 8) | (ptr[6] << 16) | ((Bit32u)ptr[7] << 24));
+		c = crc32_slice8[7][lo & 0xFF] ^ crc32_slice8[6][(lo >> 8) & 0xFF] ^ crc32_slice8[5][(lo >> 16) & 0xFF] ^ crc32_slice8[4][lo >> 24]
+		  ^ crc32_slice8[3][hi & 0xFF] ^ crc32_slice8[2][(hi >> 8) & 0xFF] ^ crc32_slice8[1][(hi >> 16) & 0xFF] ^ crc32_slice8[0][hi >> 24];
+	}
+	while (len--) c = (c >> 8) ^ crc32_slice8[0][(c ^ *ptr++) & 0xFF];
+	return ~c;
+}
+
+#ifdef DBP_SIMD_HAVE_X86
+DBP_SIMD_TARGET("sse2") static bool MemEqual_SSE2(const void* a, const void* b, size_t len)
+{
+	const Bit8u *pa = (const Bit8u*)a, *pb = (const Bit8u*)b;
+	for (; len >= 64; len -= 64, pa += 64, pb += 64)
+	{
+		__m128i x0 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)pa     ), _mm_loadu_si128((const __m128i*)pb     ));
+		__m128i x1 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)pa +  1), _mm_loadu_si128((const __m128i*)pb +  1));
+		__m128i x2 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)pa +  2), _mm_loadu_si128((const __m128i*)pb +  2));
+		__m128i x3 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)pa +  3), _mm_loadu_si128((const __m128i*)pb +  3));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(_mm_or_si128(x0, x1), _mm_or_si128(x2, x3)), _mm_setzero_si128())) != 0xFFFF) return false;
+	}
+	for (; len >= 16; len -= 16, pa += 16, pb += 16)
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)pa), _mm_loadu_si128((const __m128i*)pb))) != 0xFFFF) return false;
+	return !memcmp(pa, pb, len);
+}
+
+DBP_SIMD_TARGET("sse2") static void MixToS16_SSE2(Bit16s* out, Bit32s* work, size_t count, unsigned shift)
+{
+	const __m128i sh = _mm_cvtsi32_si128((int)shift), zero = _mm_setzero_si128();
+	for (; count >= 8; count -= 8, work += 8, out += 8)
+	{
+		__m128i a = _mm_sra_epi32(_mm_loadu_si128((const __m128i*)work), sh), b = _mm_sra_epi32(_mm_loadu_si128((const __m128i*)work + 1), sh);
+		_mm_storeu_si128((__m128i*)out, _mm_packs_epi32(a, b));
+		_mm_storeu_si128((__m128i*)work, zero);
+		_mm_storeu_si128((__m128i*)work + 1, zero);
+	}
+	MixToS16_Scalar(out, work, count, shift);
+}
+
+DBP_SIMD_TARGET("sse2") static inline __m128i RGB15ToXRGB_SSE2_4(__m128i v)
+{
+	return _mm_or_si128(_mm_or_si128(
+		_mm_or_si128(_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(31<<10)), 9), _mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(7<<12)), 4)),
+		_mm_or_si128(_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(31<<5)), 6), _mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(7<<7)), 1))),
+		_mm_or_si128(_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(31)), 3), _mm_srli_epi32(_mm_and_si128(v, _mm_set1_epi32(7<<2)), 2)));
+}
+
+DBP_SIMD_TARGET("sse2") static inline __m128i RGB16ToXRGB_SSE2_4(__m128i v)
+{
+	return _mm_or_si128(_mm_or_si128(
+		_mm_or_si128(_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(31<<11)), 8), _mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(63<<5)), 5)),
+		_mm_or_si128(_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0xE01F)), 3), _mm_srli_epi32(_mm_and_si128(v, _mm_set1_epi32(3<<9)), 1))),
+		_mm_srli_epi32(_mm_and_si128(v, _mm_set1_epi32(7<<2)), 2));
+}
+
+DBP_SIMD_TARGET("sse2") static void RGB15ToXRGB_SSE2(Bit32u* out, const Bit16u* src, size_t count)
+{
+	const __m128i zero = _mm_setzero_si128();
+	for (; count >= 8; count -= 8, src += 8, out += 8)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)src);
+		_mm_storeu_si128((__m128i*)out, RGB15ToXRGB_SSE2_4(_mm_unpacklo_epi16(v, zero)));
+		_mm_storeu_si128((__m128i*)out + 1, RGB15ToXRGB_SSE2_4(_mm_unpackhi_epi16(v, zero)));
+	}
+	RGB15ToXRGB_Scalar(out, src, count);
+}
+
+DBP_SIMD_TARGET("sse2") static void RGB16ToXRGB_SSE2(Bit32u* out, const Bit16u* src, size_t count)
+{
+	const __m128i zero = _mm_setzero_si128();
+	for (; count >= 8; count -= 8, src += 8, out += 8)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)src);
+		_mm_storeu_si128((__m128i*)out, RGB16ToXRGB_SSE2_4(_mm_unpacklo_epi16(v, zero)));
+		_mm_storeu_si128((__m128i*)out + 1, RGB16ToXRGB_SSE2_4(_mm_unpackhi_epi16(v, zero)));
+	}
+	RGB16ToXRGB_Scalar(out, src, count);
+}
+
+#ifdef DBP_SIMD_HAVE_AVX2
+DBP_SIMD_TARGET("avx2") static bool MemEqual_AVX2(const void* a, const void* b, size_t len)
+{
+	const Bit8u *pa = (const Bit8u*)a, *pb = (const Bit8u*)b;
+	for (; len >= 128; len -= 128, pa += 128, pb += 128)
+	{
+		__m256i x0 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)pa     ), _mm256_loadu_si256((const __m256i*)pb     ));
+		__m256i x1 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)pa +  1), _mm256_loadu_si256((const __m256i*)pb +  1));
+		__m256i x2 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)pa +  2), _mm256_loadu_si256((const __m256i*)pb +  2));
+		__m256i x3 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)pa +  3), _mm256_loadu_si256((const __m256i*)pb +  3));
+		__m256i x = _mm256_or_si256(_mm256_or_si256(x0, x1), _mm256_or_si256(x2, x3));
+		if (!_mm256_testz_si256(x, x)) return false;
+	}
+	for (; len >= 32; len -= 32, pa += 32, pb += 32)
+	{
+		__m256i x = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)pa), _mm256_loadu_si256((const __m256i*)pb));
+		if (!_mm256_testz_si256(x, x)) return false;
+	}
+	return !memcmp(pa, pb, len);
+}
+
+DBP_SIMD_TARGET("avx2") static void MixToS16_AVX2(Bit16s* out, Bit32s* work, size_t count, unsigned shift)
+{
+	const __m128i sh = _mm_cvtsi32_si128((int)shift);
+	const __m256i zero = _mm256_setzero_si256();
+	for (; count >= 16; count -= 16, work += 16, out += 16)
+	{
+		__m256i a = _mm256_sra_epi32(_mm256_loadu_si256((const __m256i*)work), sh), b = _mm256_sra_epi32(_mm256_loadu_si256((const __m256i*)work + 1), sh);
+		_mm256_storeu_si256((__m256i*)out, _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8)); // pack works per 128-bit lane, restore order
+		_mm256_storeu_si256((__m256i*)work, zero);
+		_mm256_storeu_si256((__m256i*)work + 1, zero);
+	}
+	MixToS16_SSE2(out, work, count, shift);
+}
+
+DBP_SIMD_TARGET("avx2") static void PaletteToXRGB_AVX2(Bit32u* out, const Bit8u* src, size_t count, const Bit32u* pal)
+{
+	for (; count >= 16; count -= 16, src += 16, out += 16)
+	{
+		__m128i idx = _mm_loadu_si128((const __m128i*)src);
+		_mm256_storeu_si256((__m256i*)out, _mm256_i32gather_epi32((const int*)pal, _mm256_cvtepu8_epi32(idx), 4));
+		_mm256_storeu_si256((__m256i*)out + 1, _mm256_i32gather_epi32((const int*)pal, _mm256_cvtepu8_epi32(_mm_srli_si128(idx, 8)), 4));
+	}
+	PaletteToXRGB_Scalar(out, src, count, pal);
+}
+
+DBP_SIMD_TARGET("avx2") static inline __m256i RGB15ToXRGB_AVX2_8(__m256i v)
+{
+	return _mm256_or_si256(_mm256_or_si256(
+		_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(31<<10)), 9), _mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(7<<12)), 4)),
+		_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(31<<5)), 6), _mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(7<<7)), 1))),
+		_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(31)), 3), _mm256_srli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(7<<2)), 2)));
+}
+
+DBP_SIMD_TARGET("avx2") static inline __m256i RGB16ToXRGB_AVX2_8(__m256i v)
+{
+	return _mm256_or_si256(_mm256_or_si256(
+		_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(31<<11)), 8), _mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(63<<5)), 5)),
+		_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(0xE01F)), 3), _mm256_srli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(3<<9)), 1))),
+		_mm256_srli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(7<<2)), 2));
+}
+
+DBP_SIMD_TARGET("avx2") static void RGB15ToXRGB_AVX2(Bit32u* out, const Bit16u* src, size_t count)
+{
+	for (; count >= 16; count -= 16, src += 16, out += 16)
+	{
+		_mm256_storeu_si256((__m256i*)out, RGB15ToXRGB_AVX2_8(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)src))));
+		_mm256_storeu_si256((__m256i*)out + 1, RGB15ToXRGB_AVX2_8(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)src + 1))));
+	}
+	RGB15ToXRGB_SSE2(out, src, count);
+}
+
+DBP_SIMD_TARGET("avx2") static void RGB16ToXRGB_AVX2(Bit32u* out, const Bit16u* src, size_t count)
+{
+	for (; count >= 16; count -= 16, src += 16, out += 16)
+	{
+		_mm256_storeu_si256((__m256i*)out, RGB16ToXRGB_AVX2_8(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)src))));
+		_mm256_storeu_si256((__m256i*)out + 1, RGB16ToXRGB_AVX2_8(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)src + 1))));
+	}
+	RGB16ToXRGB_SSE2(out, src, count);
+}
+#endif
+
+static Bit32u DetectFeatures()
+{
+	Bit32u res = 0, regs[4] = { 0 }; // eax, ebx, ecx, edx
+	#ifdef _MSC_VER
+	int r[4];
+	__cpuid(r, 0); Bit32u maxleaf = (Bit32u)r[0];
+	__cpuid(r, 1); memcpy(regs, r, sizeof(regs));
+	#else
+	Bit32u maxleaf = __get_cpuid_max(0, NULL);
+	if (maxleaf >= 1) __cpuid(1, regs[0], regs[1], regs[2], regs[3]);
+	#endif
+	if (regs[3] & (1 << 26)) res |= DBP_SIMD_SSE2;
+	#ifdef DBP_SIMD_HAVE_AVX2
+	// AVX2 needs the OS to save the YMM registers (OSXSAVE set and XCR0 bits 1 and 2 enabled)
+	if (maxleaf >= 7 && (regs[2] & (1 << 27)) && (regs[2] & (1 << 28)))
+	{
+		#ifdef _MSC_VER
+		Bit32u xcr0 = (Bit32u)_xgetbv(0);
+		__cpuidex(r, 7, 0); Bit32u ebx7 = (Bit32u)r[1];
+		#else
+		Bit32u xcr0, edx_xcr, eax7, ebx7, ecx7, edx7;
+		__asm__ (".byte 0x0f, 0x01, 0xd0" : "=a"(xcr0), "=d"(edx_xcr) : "c"(0)); // xgetbv
+		__cpuid_count(7, 0, eax7, ebx7, ecx7, edx7);
+		#endif
+		if ((xcr0 & 6) == 6 && (ebx7 & (1 << 5))) res |= DBP_SIMD_AVX2;
+	}
+	#endif
+	return res;
+}
+#endif
+
+#ifdef DBP_SIMD_HAVE_NEON
+static bool MemEqual_NEON(const void* a, const void* b, size_t len)
+{
+	const Bit8u *pa = (const Bit8u*)a, *pb = (const Bit8u*)b;
+	for (; len >= 64; len -= 64, pa += 64, pb += 64)
+	{
+		uint8x16_t x = vorrq_u8(vorrq_u8(veorq_u8(vld1q_u8(pa     ), vld1q_u8(pb     )), veorq_u8(vld1q_u8(pa + 16), vld1q_u8(pb + 16))),
+		                        vorrq_u8(veorq_u8(vld1q_u8(pa + 32), vld1q_u8(pb + 32)), veorq_u8(vld1q_u8(pa + 48), vld1q_u8(pb + 48))));
+		uint64x2_t x64 = vreinterpretq_u64_u8(x);
+		if (vgetq_lane_u64(x64, 0) | vgetq_lane_u64(x64, 1)) return false;
+	}
+	return !memcmp(pa, pb, len);
+}
+
+static void MixToS16_NEON(Bit16s* out, Bit32s* work, size_t count, unsigned shift)
+{
+	const int32x4_t sh = vdupq_n_s32(-(int)shift), zero = vdupq_n_s32(0);
+	for (; count >= 8; count -= 8, work += 8, out += 8)
+	{
+		int32x4_t a = vshlq_s32(vld1q_s32(work), sh), b = vshlq_s32(vld1q_s32(work + 4), sh);
+		vst1q_s16(out, vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+		vst1q_s32(work, zero);
+		vst1q_s32(work + 4, zero);
+	}
+	MixToS16_Scalar(out, work, count, shift);
+}
+
+static inline uint32x4_t RGB15ToXRGB_NEON_4(uint32x4_t v)
+{
+	return vorrq_u32(vorrq_u32(
+		vorrq_u32(vshlq_n_u32(vandq_u32(v, vdupq_n_u32(31<<10)), 9), vshlq_n_u32(vandq_u32(v, vdupq_n_u32(7<<12)), 4)),
+		vorrq_u32(vshlq_n_u32(vandq_u32(v, vdupq_n_u32(31<<5)), 6), vshlq_n_u32(vandq_u32(v, vdupq_n_u32(7<<7)), 1))),
+		vorrq_u32(vshlq_n_u32(vandq_u32(v, vdupq_n_u32(31)), 3), vshrq_n_u32(vandq_u32(v, vdupq_n_u32(7<<2)), 2)));
+}
+
+static inline uint32x4_t RGB16ToXRGB_NEON_4(uint32x4_t v)
+{
+	return vorrq_u32(vorrq_u32(
+		vorrq_u32(vshlq_n_u32(vandq_u32(v, vdupq_n_u32(31<<11)), 8), vshlq_n_u32(vandq_u32(v, vdupq_n_u32(63<<5)), 5)),
+		vorrq_u32(vshlq_n_u32(vandq_u32(v, vdupq_n_u32(0xE01F)), 3), vshrq_n_u32(vandq_u32(v, vdupq_n_u32(3<<9)), 1))),
+		vshrq_n_u32(vandq_u32(v, vdupq_n_u32(7<<2)), 2));
+}
+
+static void RGB15ToXRGB_NEON(Bit32u* out, const Bit16u* src, size_t count)
+{
+	for (; count >= 8; count -= 8, src += 8, out += 8)
+	{
+		uint16x8_t v = vld1q_u16(src);
+		vst1q_u32(out, RGB15ToXRGB_NEON_4(vmovl_u16(vget_low_u16(v))));
+		vst1q_u32(out + 4, RGB15ToXRGB_NEON_4(vmovl_u16(vget_high_u16(v))));
+	}
+	RGB15ToXRGB_Scalar(out, src, count);
+}
+
+static void RGB16ToXRGB_NEON(Bit32u* out, const Bit16u* src, size_t count)
+{
+	for (; count >= 8; count -= 8, src += 8, out += 8)
+	{
+		uint16x8_t v = vld1q_u16(src);
+		vst1q_u32(out, RGB16ToXRGB_NEON_4(vmovl_u16(vget_low_u16(v))));
+		vst1q_u32(out + 4, RGB16ToXRGB_NEON_4(vmovl_u16(vget_high_u16(v))));
+	}
+	RGB16ToXRGB_Scalar(out, src, count);
+}
+#endif
+
+DBP_SIMD_Kernels DBP_SIMD = { MemEqual_Scalar, MixToS16_Scalar, CRC32_Scalar, PaletteToXRGB_Scalar, RGB15ToXRGB_Scalar, RGB16ToXRGB_Scalar };
+static Bit32u dbp_simd_features;
+
+static bool DBP_SIMD_SelfTest(const DBP_SIMD_Kernels& k)
+{
+	// Check a variant against the scalar reference with random data at various lengths and alignments
+	enum { MAXLEN = 300 };
+	Bit8u a[MAXLEN + 16], b[MAXLEN + 16];
+	Bit32s work1[MAXLEN + 4], work2[MAXLEN + 4];
+	Bit16s out1[MAXLEN + 4], out2[MAXLEN + 4];
+	Bit32u pal[256], px1[MAXLEN + 4], px2[MAXLEN + 4];
+	Bit16u px16[MAXLEN + 8];
+	Bit32u seed = 0x1234567;
+	#define DBP_SIMD_RAND() (seed = seed * 1103515245 + 12345, (seed >> 8))
+	for (Bit32u i = 0; i != sizeof(a); i++) a[i] = b[i] = (Bit8u)DBP_SIMD_RAND();
+	for (Bit32u i = 0; i != 256; i++) pal[i] = (DBP_SIMD_RAND() << 8) ^ DBP_SIMD_RAND();
+	for (Bit32u i = 0; i != MAXLEN + 8; i++) px16[i] = (Bit16u)(i < 65536 / 256 ? (i * 257) : DBP_SIMD_RAND()); // start with a ramp to cover all channel values
+	for (size_t len = 0; len <= MAXLEN; len++)
+	{
+		size_t ofs = (len & 7);
+		if (!k.MemEqual(a + ofs, b + ofs, len)) return false;
+		if (len)
+		{
+			size_t diff = ofs + (DBP_SIMD_RAND() % len);
+			b[diff] ^= 0x10;
+			bool eq = k.MemEqual(a + ofs, b + ofs, len);
+			b[diff] ^= 0x10;
+			if (eq) return false;
+		}
+		if (k.CRC32(a + ofs, len, len) != CRC32_Scalar(a + ofs, len, len)) return false;
+
+		for (size_t i = 0; i != len; i++)
+		{
+			Bit32u r = DBP_SIMD_RAND();
+			work1[ofs / 2 + i] = work2[ofs / 2 + i] = (Bit32s)((r & 3) == 0 ? (r << 9) : ((Bit32s)(r << 8) >> (8 + (r & 7)))); // mix of saturating and regular values
+		}
+		unsigned shift = (unsigned)(len % 14);
+		k.MixToS16(out1, work1 + ofs / 2, len, shift);
+		MixToS16_Scalar(out2, work2 + ofs / 2, len, shift);
+		if (memcmp(out1, out2, len * sizeof(Bit16s)) || memcmp(work1 + ofs / 2, work2 + ofs / 2, len * sizeof(Bit32s))) return false;
+
+		px1[len] = px2[len] = 0xDEADBEEF; // check for writes past the end
+		k.PaletteToXRGB(px1, a + ofs, len, pal);
+		PaletteToXRGB_Scalar(px2, a + ofs, len, pal);
+		if (memcmp(px1, px2, (len + 1) * sizeof(Bit32u))) return false;
+		k.RGB15ToXRGB(px1, px16 + ofs, len);
+		RGB15ToXRGB_Scalar(px2, px16 + ofs, len);
+		if (memcmp(px1, px2, (len + 1) * sizeof(Bit32u))) return false;
+		k.RGB16ToXRGB(px1, px16 + ofs, len);
+		RGB16ToXRGB_Scalar(px2, px16 + ofs, len);
+		if (memcmp(px1, px2, (len + 1) * sizeof(Bit32u))) return false;
+	}
+	#undef DBP_SIMD_RAND
+	return true;
+}
+
+static bool DBP_SIMD_Select(const DBP_SIMD_Kernels& k, const char* name)
+{
+	if (!DBP_SIMD_SelfTest(k)) { LOG_MSG("[DOSBOX] SIMD self test of %s kernels failed, not using them", name); return false; }
+	DBP_SIMD = k;
+	return true;
+}
+
+void DBP_SIMD_Init(bool allow_simd)
+{
+	static bool initialized;
+	if (initialized) return;
+	initialized = true;
+
+	for (Bit32u i = 0; i != 256; i++)
+	{
+		Bit32u c = i;
+		for (int j = 0; j != 8; j++) c = (c >> 1) ^ (0xEDB88320 & (0u - (c & 1)));
+		crc32_slice8[0][i] = c;
+	}
+	for (Bit32u i = 0; i != 256; i++)
+		for (int t = 1; t != 8; t++)
+			crc32_slice8[t][i] = (crc32_slice8[t - 1][i] >> 8) ^ crc32_slice8[0][crc32_slice8[t - 1][i] & 0xFF];
+
+	const char* name = "scalar";
+	DBP_SIMD_Kernels k = { MemEqual_Scalar, MixToS16_Scalar, CRC32_Slice8, PaletteToXRGB_Scalar, RGB15ToXRGB_Scalar, RGB16ToXRGB_Scalar };
+	if (DBP_SIMD_Select(k, "table")) name = "table";
+
+	#ifdef DBP_SIMD_HAVE_X86
+	dbp_simd_features = (allow_simd ? DetectFeatures() : 0);
+	if (dbp_simd_features & DBP_SIMD_SSE2)
+	{
+		k.MemEqual = MemEqual_SSE2; k.MixToS16 = MixToS16_SSE2; k.RGB15ToXRGB = RGB15ToXRGB_SSE2; k.RGB16ToXRGB = RGB16ToXRGB_SSE2;
+		if (DBP_SIMD_Select(k, "SSE2")) name = "SSE2";
+	}
+	#ifdef DBP_SIMD_HAVE_AVX2
+	if (dbp_simd_features & DBP_SIMD_AVX2)
+	{
+		k.MemEqual = MemEqual_AVX2; k.MixToS16 = MixToS16_AVX2; k.RGB15ToXRGB = RGB15ToXRGB_AVX2; k.RGB16ToXRGB = RGB16ToXRGB_AVX2;
+		k.PaletteToXRGB = PaletteToXRGB_AVX2;
+		if (DBP_SIMD_Select(k, "AVX2")) name = "AVX2";
+	}
+	#endif
+	#elif defined(DBP_SIMD_HAVE_NEON)
+	dbp_simd_features = (allow_simd ? DBP_SIMD_NEON : 0);
+	if (dbp_simd_features & DBP_SIMD_NEON)
+	{
+		k.MemEqual = MemEqual_NEON; k.MixToS16 = MixToS16_NEON; k.RGB15ToXRGB = RGB15ToXRGB_NEON; k.RGB16ToXRGB = RGB16ToXRGB_NEON;
+		if (DBP_SIMD_Select(k, "NEON")) name = "NEON";
+	}
+	#endif
+
+	LOG_MSG("[DOSBOX] Host CPU features:%s%s%s - Using %s kernels", ((dbp_simd_features & DBP_SIMD_SSE2) ? " SSE2" : ""), ((dbp_simd_features & DBP_SIMD_AVX2) ? " AVX2" : ""), ((dbp_simd_features & DBP_SIMD_NEON) ? " NEON" : ""), name);
+}
+
+Bit32u DBP_SIMD_GetFeatures()
+{
+	return dbp_simd_features;
+}
@@ -36,6 +36,7 @@ public:
 private:
 	void ClearAnsi(void);
 	void Output(Bit8u chr);
+	Bit16u OutputString(const Bit8u * str,Bit16u len);
 	Bit8u readcache;
 	struct ansi { /* should create a constructor, which would fill them with the appropriate values */
 		bool esc;
@@ -138,6 +139,16 @@ bool device_CON::Write(Bit8u * data,Bit16u * size) {
 				count++;
 				continue;
 			} else { 
+				/* Pass runs of plain characters to the batched text mode output */
+				Bit16u end=count+1;
+				while (end<*size && data[end]!='\033' && (data[end]!='\t' || dos.direct_output)) end++;
+				if (end-count>1) {
+					Bit16u done=OutputString(data+count,end-count);
+					if (done) {
+						count+=done;
+						continue;
+					}
+				}
 				Output(data[count]);
 				count++;
 				continue;
@@ -438,3 +449,8 @@ void device_CON::Output(Bit8u chr) {
 		INT10_TeletypeOutputAttr(chr,ansi.attr,true);
 	} else INT10_TeletypeOutput(chr,7);
  }
+
+Bit16u device_CON::OutputString(const Bit8u * str,Bit16u len) {
+	if (dos.internal_output || ansi.enabled) return INT10_TeletypeOutputString(str,len,ansi.attr,true);
+	return INT10_TeletypeOutputString(str,len,7,false);
+}
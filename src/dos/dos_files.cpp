@@ -446,8 +446,10 @@ bool DOS_CloseFile(Bit16u entry, bool fcb, Bit8u * refcnt) {
 		DOS_SetError(DOSERR_INVALID_HANDLE);
 		return false;
 	};
+	bool failed = false;
 	if (Files[handle]->IsOpen()) {
-		Files[handle]->Close();
+		//DBP: Only local files report errors on close (of queued writes), other file types don't return a meaningful result
+		if (!Files[handle]->Close() && dynamic_cast<localFile*>(Files[handle])) failed = true;
 	}
 
 	DOS_PSP psp(dos.psp());
@@ -460,7 +462,7 @@ bool DOS_CloseFile(Bit16u entry, bool fcb, Bit8u * refcnt) {
 		refs=0;
 	}
 	if (refcnt!=NULL) *refcnt=static_cast<Bit8u>(refs+1);
-	return true;
+	return !failed;
 }
 
 bool DOS_FlushFile(Bit16u entry) {
@@ -474,6 +476,9 @@ bool DOS_FlushFile(Bit16u entry) {
 		return false;
 	};
 	LOG(LOG_DOSMISC,LOG_NORMAL)("FFlush used.");
+	//DBP: Commit queued writes of local files and report their errors
+	localFile* lfp = dynamic_cast<localFile*>(Files[handle]);
+	if (lfp) return lfp->Flush();
 	return true;
 }
 
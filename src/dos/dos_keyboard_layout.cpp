@@ -214,7 +214,7 @@ static Bit32u read_kcl_file(const char* kcl_file_name, const char* layout_id, bo
 }
 #endif
 
-static Bit32u read_kcl_data(Bit8u * kcl_data, Bit32u kcl_data_size, const char* layout_id, bool first_id_only) {
+static Bit32u read_kcl_data(const Bit8u * kcl_data, Bit32u kcl_data_size, const char* layout_id, bool first_id_only) {
 	// check ID-bytes
 	if ((kcl_data[0]!=0x4b) || (kcl_data[1]!=0x43) || (kcl_data[2]!=0x46)) {
 		return 0;
@@ -225,14 +225,14 @@ static Bit32u read_kcl_data(Bit8u * kcl_data, Bit32u kcl_data_size, const char*
 	for (;;) {
 		if (dpos+5>kcl_data_size) break;
 		Bit32u cur_pos=dpos;
-		Bit16u len=host_readw(&kcl_data[dpos]);
+		Bit16u len=host_readw((HostPt)&kcl_data[dpos]);
 		Bit8u data_len=kcl_data[dpos+2];
 		dpos+=5;
 
 		char lng_codes[258];
 		// get all language codes for this layout
 		for (Bitu i=0; i<data_len;) {
-			Bit16u lcnum=host_readw(&kcl_data[dpos-2]);
+			Bit16u lcnum=host_readw((HostPt)&kcl_data[dpos-2]);
 			i+=2;
 			Bitu lcpos=0;
 			for (;i<data_len;) {
@@ -263,6 +263,37 @@ static Bit32u read_kcl_data(Bit8u * kcl_data, Bit32u kcl_data_size, const char*
 	return 0;
 }
 
+// Look up a layout in the builtin libraries and copy its data (starting at the language code length) to buf
+static Bit32u read_kcl_builtin(const char* layout_id, Bit8u* buf) {
+	// Only the selected layout is kept, it gets read at least twice in a row (extract_codepage and read_keyboard_file)
+	static std::vector<Bit8u> layout_data;
+	static const kcl_builtin_layout* layout_data_src;
+
+	for (int first_id_only=1; first_id_only>=0; first_id_only--) {
+		for (Bitu l=0; l<sizeof(layout_libraries)/sizeof(layout_libraries[0]); l++) {
+			const kcl_builtin_library& lib=layout_libraries[l];
+			Bit32u index_pos=read_kcl_data(lib.index,lib.index_size,layout_id,!!first_id_only);
+			if (!index_pos) continue;
+			const kcl_builtin_layout* layout=lib.layouts, *layout_end=layout+lib.layout_count;
+			while (layout!=layout_end && layout->index_pos!=index_pos) layout++;
+			if (layout==layout_end) continue;
+			if (layout_data_src!=layout) {
+				// The library is inflated into a temporary buffer which gets freed again after copying out the layout
+				std::vector<Bit8u> library(lib.size);
+				if (!zipDrive::Uncompress(lib.compressed,lib.compressed_size,&library[0],lib.size)) {
+					LOG(LOG_BIOS,LOG_ERROR)("Failed to decompress builtin keyboard layout library %d",(int)l);
+					continue;
+				}
+				layout_data.assign(library.begin()+layout->offset,library.begin()+layout->offset+layout->size);
+				layout_data_src=layout;
+			}
+			memcpy(buf,&layout_data[0],layout->size);
+			return layout->size;
+		}
+	}
+	return 0;
+}
+
 Bitu keyboard_layout::read_keyboard_file(const char* keyboard_file_name, Bit32s specific_layout, Bit32s requested_codepage) {
 	this->reset();
 
@@ -294,25 +325,7 @@ Bitu keyboard_layout::read_keyboard_file(const char* keyboard_file_name, Bit32s
 			tempfile = OpenDosboxFile("keybrd3.sys");
 		} else
 #endif
-		if ((start_pos=read_kcl_data(layout_keyboardsys,33196,keyboard_file_name,true))) {
-			read_buf_size=0;
-			for (Bitu ct=start_pos+2; ct<33196; ct++) read_buf[read_buf_size++]=layout_keyboardsys[ct];
-		} else if ((start_pos=read_kcl_data(layout_keybrd2sys,25431,keyboard_file_name,true))) {
-			read_buf_size=0;
-			for (Bitu ct=start_pos+2; ct<25431; ct++) read_buf[read_buf_size++]=layout_keybrd2sys[ct];
-		} else if ((start_pos=read_kcl_data(layout_keybrd3sys,27122,keyboard_file_name,true))) {
-			read_buf_size=0;
-			for (Bitu ct=start_pos+2; ct<27122; ct++) read_buf[read_buf_size++]=layout_keybrd3sys[ct];
-		} else if ((start_pos=read_kcl_data(layout_keyboardsys,33196,keyboard_file_name,false))) {
-			read_buf_size=0;
-			for (Bitu ct=start_pos+2; ct<33196; ct++) read_buf[read_buf_size++]=layout_keyboardsys[ct];
-		} else if ((start_pos=read_kcl_data(layout_keybrd2sys,25431,keyboard_file_name,false))) {
-			read_buf_size=0;
-			for (Bitu ct=start_pos+2; ct<25431; ct++) read_buf[read_buf_size++]=layout_keybrd2sys[ct];
-		} else if ((start_pos=read_kcl_data(layout_keybrd3sys,27122,keyboard_file_name,false))) {
-			read_buf_size=0;
-			for (Bitu ct=start_pos+2; ct<27122; ct++) read_buf[read_buf_size++]=layout_keybrd3sys[ct];
-		} else {
+		if (!(read_buf_size=read_kcl_builtin(keyboard_file_name,read_buf))) {
 			LOG(LOG_BIOS,LOG_ERROR)("Keyboard layout file %s not found",keyboard_file_name);
 			return KEYB_FILENOTFOUND;
 		}
@@ -653,26 +666,7 @@ Bit16u keyboard_layout::extract_codepage(const char* keyboard_file_name) {
 			tempfile = OpenDosboxFile("keybrd3.sys");
 		} else
 #endif
-		if ((start_pos=read_kcl_data(layout_keyboardsys,33196,keyboard_file_name,true))) {
-			read_buf_size=0;
-			for (Bitu ct=start_pos+2; ct<33196; ct++) read_buf[read_buf_size++]=layout_keyboardsys[ct];
-		} else if ((start_pos=read_kcl_data(layout_keybrd2sys,25431,keyboard_file_name,true))) {
-			read_buf_size=0;
-			for (Bitu ct=start_pos+2; ct<25431; ct++) read_buf[read_buf_size++]=layout_keybrd2sys[ct];
-		} else if ((start_pos=read_kcl_data(layout_keybrd3sys,27122,keyboard_file_name,true))) {
-			read_buf_size=0;
-			for (Bitu ct=start_pos+2; ct<27122; ct++) read_buf[read_buf_size++]=layout_keybrd3sys[ct];
-		} else if ((start_pos=read_kcl_data(layout_keyboardsys,33196,keyboard_file_name,false))) {
-			read_buf_size=0;
-			for (Bitu ct=start_pos+2; ct<33196; ct++) read_buf[read_buf_size++]=layout_keyboardsys[ct];
-		} else if ((start_pos=read_kcl_data(layout_keybrd2sys,25431,keyboard_file_name,false))) {
-			read_buf_size=0;
-			for (Bitu ct=start_pos+2; ct<25431; ct++) read_buf[read_buf_size++]=layout_keybrd2sys[ct];
-		} else if ((start_pos=read_kcl_data(layout_keybrd3sys,27122,keyboard_file_name,false))) {
-			read_buf_size=0;
-			for (Bitu ct=start_pos+2; ct<27122; ct++) read_buf[read_buf_size++]=layout_keybrd3sys[ct];
-		} else {
-			start_pos=0;
+		if (!(read_buf_size=read_kcl_builtin(keyboard_file_name,read_buf))) {
 			LOG(LOG_BIOS,LOG_ERROR)("Keyboard layout file %s not found",keyboard_file_name);
 			return 437;
 		}
@@ -799,15 +793,15 @@ Bitu keyboard_layout::read_codepage_file(const char* codepage_file_name, Bit32s
 		// check if build-in codepage is available
 		switch (codepage_id) {
 			case 437:	case 850:	case 852:	case 853:	case 857:	case 858:	
-						for (Bitu bct=0; bct<6322; bct++) cpi_buf[bct]=font_ega_cpx[bct];
+						memcpy(cpi_buf,font_ega_cpx,6322);
 						cpi_buf_size=6322;
 						break;
 			case 771:	case 772:	case 808:	case 855:	case 866:	case 872:
-						for (Bitu bct=0; bct<5455; bct++) cpi_buf[bct]=font_ega3_cpx[bct];
+						memcpy(cpi_buf,font_ega3_cpx,5455);
 						cpi_buf_size=5455;
 						break;
 			case 737:	case 851:	case 869:
-						for (Bitu bct=0; bct<5720; bct++) cpi_buf[bct]=font_ega5_cpx[bct];
+						memcpy(cpi_buf,font_ega5_cpx,5720);
 						cpi_buf_size=5720;
 						break;
 			default: 
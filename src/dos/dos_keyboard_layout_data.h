@@ -24,5370 +24,1920 @@
    wrapped in a KL file (for use of FD-KEYB 2.X)
    Copyright (C) 2004 by Aitor SANTAMARIA_MERINO */
 
+/* The libraries are stored deflate compressed and only inflated when a layout in them is selected.
+   The index keeps the library header and the language codes of each layout so it can be
+   searched with read_kcl_data without decompressing anything.
+   Generated by scripts/keyboard_layout_data.py, see there for how to rebuild it. */
 
-Bit8u layout_keyboardsys[33196] = {
+struct kcl_builtin_layout { Bit16u index_pos, offset, size; };
+struct kcl_builtin_library { const Bit8u* index; Bit32u index_size; const kcl_builtin_layout* layouts; Bit32u layout_count; const Bit8u* compressed; Bit32u compressed_size, size; };
+
+static const Bit8u layout_keyboardsys_index[582] = {
 0x4b, 0x43, 0x46, 0x00, 0x01, 0x01, 0x2e, 0x48, 0x65, 0x6e, 0x72, 0x69, 0x71, 0x75, 0x65, 0x20, 
 0x50, 0x65, 0x72, 0x6f, 0x6e, 0xff, 0x44, 0x4f, 0x53, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x70, 0x61, 
 0x67, 0x65, 0x73, 0x20, 0x2d, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x23, 0x31, 
-0x20, 0x6f, 0x66, 0x20, 0x33, 0xa0, 0x03, 0x0e, 0x00, 0x00, 0x42, 0x45, 0x2c, 0x78, 0x00, 0x42, 
-0x45, 0x2c, 0x78, 0x00, 0x46, 0x52, 0x06, 0x04, 0x2c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x5a, 0x03, 0x0f, 0x03, 0x16, 0x03, 0x00, 0x00, 0x5b, 0x03, 0x5e, 0x01, 0x96, 0x01, 
-0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0xb5, 0x01, 0x13, 0x02, 0x1e, 0x02, 
-0x00, 0x00, 0x37, 0x75, 0x6d, 0x02, 0xba, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x42, 0x00, 0x26, 0x31, 0x7c, 
-0x03, 0x42, 0x00, 0x82, 0x32, 0x40, 0x04, 0x42, 0x00, 0x22, 0x33, 0x23, 0x05, 0x41, 0x00, 0x27, 
-0x34, 0x06, 0x41, 0x00, 0x28, 0x35, 0x07, 0x42, 0x00, 0xf5, 0x36, 0x5e, 0x08, 0x41, 0x00, 0x8a, 
-0x37, 0x09, 0x41, 0x00, 0x21, 0x38, 0x0a, 0x42, 0x00, 0x87, 0x39, 0x7b, 0x0b, 0x42, 0x00, 0x85, 
-0x30, 0x7d, 0x0c, 0x41, 0x00, 0x29, 0xf8, 0x0d, 0x44, 0x0c, 0x2d, 0x5f, 0x00, 0x00, 0x1f, 0x10, 
-0xc5, 0x00, 0x61, 0x1e, 0x41, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x01, 0x1e, 0x00, 0x1e, 0x11, 0xc5, 
-0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x12, 0x41, 0x00, 
-0x65, 0x45, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 
-0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x42, 0x03, 0xca, 0xcc, 0x5b, 0x1b, 0x42, 0x00, 0x24, 
-0x2a, 0x5d, 0x1e, 0xc5, 0x00, 0x71, 0x10, 0x51, 0x10, 0x00, 0x10, 0x00, 0x10, 0x11, 0x10, 0x00, 
-0x10, 0x27, 0xc5, 0x00, 0x6d, 0x32, 0x4d, 0x32, 0x00, 0x32, 0x00, 0x32, 0x0d, 0x32, 0x00, 0x32, 
-0x28, 0x43, 0x0c, 0x97, 0x25, 0xcb, 0xcb, 0x29, 0x41, 0x00, 0xfd, 0xfc, 0x2b, 0x43, 0x0c, 0xe6, 
-0x9c, 0xc8, 0xc8, 0x2c, 0xc5, 0x00, 0x77, 0x11, 0x57, 0x11, 0x00, 0x11, 0x00, 0x11, 0x17, 0x11, 
-0x00, 0x11, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x32, 0x44, 0x08, 0x2c, 
-0x3f, 0x5c, 0x00, 0x1c, 0x33, 0x42, 0x00, 0x3b, 0x2e, 0x3c, 0x34, 0x42, 0x00, 0x3a, 0x2f, 0x3e, 
-0x35, 0x43, 0x0c, 0x3d, 0x2b, 0xc9, 0xc9, 0x39, 0x00, 0x00, 0x20, 0x56, 0x44, 0x08, 0x3c, 0x3e, 
-0x5c, 0x00, 0x1c, 0x00, 0x10, 0xc5, 0x00, 0x61, 0x1e, 0x41, 0x1e, 0x91, 0x1e, 0x92, 0x1e, 0x01, 
-0x1e, 0x00, 0x1e, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x18, 0x43, 0x03, 0x00, 0x00, 0xab, 0xac, 
-0x1f, 0x42, 0x03, 0x00, 0x00, 0xe1, 0x2c, 0xc5, 0x00, 0x77, 0x11, 0x57, 0x11, 0xae, 0x11, 0x00, 
-0x11, 0x17, 0x11, 0x00, 0x11, 0x2d, 0x42, 0x03, 0x00, 0x00, 0xaf, 0x00, 0x60, 0x0b, 0x61, 0x85, 
-0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 
-0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 
-0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 
-0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0x27, 0x0f, 0x61, 0xa0, 
-0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x43, 0x80, 
-0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0x27, 0x22, 0x0d, 0x61, 0x84, 
-0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 
-0x4f, 0x99, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x00, 0x07, 0x41, 0x02, 0x15, 0x00, 0x29, 0x41, 
-0x03, 0x00, 0xa0, 0x00, 0x60, 0x06, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 
-0x20, 0x60, 0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x06, 0x61, 0x83, 0x65, 0x88, 
-0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 0x27, 0x09, 0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 
-0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x43, 0x80, 0x45, 0x90, 0x20, 0x27, 0x22, 0x0a, 0x61, 0x84, 
-0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 
-0x20, 0x22, 0x00, 0x05, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x10, 0xc5, 0x00, 0x61, 0x1e, 0x41, 0x1e, 
-0x86, 0x1e, 0x8f, 0x1e, 0x01, 0x1e, 0x00, 0x1e, 0x11, 0xc5, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x91, 
-0x2c, 0x92, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x12, 0x43, 0x03, 0x00, 0x00, 0xe4, 0xe5, 0x18, 0x43, 
-0x03, 0x00, 0x00, 0xab, 0xac, 0x2b, 0x41, 0x03, 0x00, 0xa0, 0x2c, 0xc5, 0x00, 0x77, 0x11, 0x57, 
-0x11, 0xae, 0x11, 0x00, 0x11, 0x17, 0x11, 0x00, 0x11, 0x2d, 0x42, 0x03, 0x00, 0x00, 0xaf, 0x00, 
-0x60, 0x07, 0x61, 0x85, 0x65, 0x8a, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x55, 0xeb, 0x20, 0x60, 
-0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 
-0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 
-0x27, 0x05, 0x63, 0x87, 0x65, 0x82, 0x43, 0x80, 0x45, 0x90, 0x20, 0x27, 0x22, 0x0b, 0x61, 0x84, 
-0x65, 0x89, 0x69, 0x8b, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x55, 0x9a, 
-0x59, 0xf3, 0x20, 0x22, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x60, 0x0b, 0x61, 0x85, 
-0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 
-0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 
-0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 
-0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 0x0f, 0x61, 0xa0, 
-0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x43, 0x80, 
-0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 
-0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 
-0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0x00, 0xf7, 0xe7, 0x01, 0x09, 0x00, 0x00, 0x42, 0x52, 0x2c, 
-0x13, 0x01, 0x42, 0x52, 0x04, 0x03, 0x2c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x5a, 0x03, 0x5d, 0x01, 0x66, 0x01, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x66, 0x01, 0x00, 0x00, 
-0xb5, 0x01, 0xf9, 0x00, 0x12, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
-0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0x02, 0x03, 0x00, 0x00, 0xfb, 0x03, 0x02, 0x03, 0x00, 0x00, 0xfd, 0x04, 0x02, 0x03, 0x00, 
-0x00, 0xfc, 0x05, 0x02, 0x03, 0x00, 0x00, 0x9c, 0x06, 0x02, 0x03, 0x00, 0x00, 0xbd, 0x07, 0x02, 
-0x03, 0x00, 0xcc, 0xaa, 0x08, 0x02, 0x03, 0x00, 0x00, 0x2f, 0x09, 0x02, 0x03, 0x00, 0x00, 0x7c, 
-0x0a, 0x02, 0x03, 0x00, 0x00, 0x3f, 0x0b, 0x02, 0x03, 0x00, 0x00, 0xf8, 0x0d, 0x02, 0x03, 0x00, 
-0x00, 0xf5, 0x10, 0x42, 0x03, 0x00, 0x00, 0x2f, 0x11, 0x42, 0x03, 0x00, 0x00, 0x3f, 0x12, 0x42, 
-0x00, 0x65, 0x45, 0xf8, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 
-0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x01, 0x03, 0xcb, 0xc8, 0x1b, 0x03, 0x00, 
-0x5b, 0x7b, 0xa6, 0x1b, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x27, 0x41, 0x00, 0x87, 0x80, 0x28, 0x03, 
-0x07, 0xc9, 0xca, 0x00, 0x1e, 0x29, 0x01, 0x00, 0x27, 0x22, 0x2b, 0x03, 0x00, 0x5d, 0x7d, 0xa7, 
-0x1d, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x35, 0x03, 0x00, 0x3b, 0x3a, 0x5c, 0x1c, 0x39, 0x00, 0x00, 
-0x20, 0x73, 0x02, 0x00, 0x2f, 0x3f, 0xf8, 0x7e, 0x01, 0x00, 0x2e, 0x2e, 0x00, 0x02, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x03, 0x00, 0x00, 0x9b, 0x0d, 
-0x02, 0x03, 0x00, 0x00, 0x15, 0x00, 0x60, 0x06, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 
-0x75, 0x97, 0x20, 0x60, 0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x06, 0x61, 0x83, 
-0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 0x27, 0x07, 0x61, 0xa0, 0x65, 0x82, 
-0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x45, 0x90, 0x20, 0x27, 0x22, 0x0a, 0x61, 0x84, 0x65, 0x89, 
-0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 
-0x00, 0x12, 0x44, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 
-0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 
-0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 
-0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 
-0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 
-0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 
-0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 
-0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 
-0x00, 0xfa, 0x56, 0x01, 0x04, 0x12, 0x01, 0x42, 0x52, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xcf, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 
-0x00, 0xd6, 0x00, 0x00, 0x00, 0xb5, 0x01, 0x79, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x03, 0x00, 0xca, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 
-0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 
-0x00, 0x6f, 0x4f, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x28, 0x02, 0x03, 0xcb, 0xcc, 0xf9, 0x29, 0x01, 
-0x03, 0xc8, 0xc9, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x39, 0x00, 0x00, 
-0x20, 0x00, 0x28, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x00, 0x60, 0x06, 0x61, 0x85, 0x65, 0x8a, 0x69, 
-0x8d, 0x6f, 0x95, 0x75, 0x97, 0x20, 0x60, 0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 
-0x06, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 0x27, 0x09, 0x61, 
-0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x43, 0x80, 0x45, 0x90, 0x20, 
-0x27, 0x22, 0x0a, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 
-0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x60, 
-0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 
-0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 
-0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 
-0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0x27, 
-0x0f, 0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 
-0xb5, 0x43, 0x80, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0x27, 0x22, 
-0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 
-0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x00, 0xc6, 0x08, 0x04, 0x13, 0x00, 0x00, 
-0x43, 0x46, 0x2c, 0x00, 0x00, 0x43, 0x41, 0x2c, 0x3a, 0x00, 0x43, 0x46, 0x2c, 0x3a, 0x00, 0x43, 
-0x41, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0x2a, 
-0x01, 0x31, 0x01, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00, 0x5f, 0x03, 0x70, 
-0x03, 0xa7, 0x03, 0x00, 0x00, 0x5b, 0x03, 0xa0, 0x01, 0xd4, 0x01, 0x00, 0x00, 0x46, 0x75, 0x45, 
-0x02, 0xaf, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 
-0x00, 0x00, 0xf1, 0x03, 0x02, 0x01, 0x00, 0x22, 0x40, 0x04, 0x02, 0x01, 0x00, 0x2f, 0x9c, 0x05, 
-0x02, 0x03, 0x00, 0x00, 0xbd, 0x06, 0x02, 0x03, 0x00, 0x00, 0xcf, 0x07, 0x02, 0x01, 0x00, 0x3f, 
-0xaa, 0x08, 0x02, 0x03, 0x00, 0x00, 0xdd, 0x09, 0x02, 0x03, 0x00, 0x00, 0xfd, 0x0a, 0x02, 0x03, 
-0x00, 0x00, 0xfc, 0x0b, 0x02, 0x03, 0x00, 0x00, 0xac, 0x0c, 0x02, 0x03, 0x00, 0x00, 0xab, 0x0d, 
-0x02, 0x03, 0x00, 0x00, 0xf3, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 
-0x41, 0x00, 0x75, 0x55, 0x17, 0x42, 0x00, 0x69, 0x49, 0xfb, 0x18, 0x42, 0x00, 0x6f, 0x4f, 0xf5, 
-0x19, 0x42, 0x03, 0x00, 0x00, 0xf4, 0x1a, 0x02, 0x03, 0xc9, 0xc9, 0x5b, 0x1b, 0x02, 0x03, 0xcc, 
-0xcb, 0x5d, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x27, 0x02, 0x03, 0x00, 0x00, 0x7e, 0x28, 0x02, 0x03, 
-0xc8, 0xc8, 0x7b, 0x29, 0x04, 0x08, 0x23, 0x7c, 0x5c, 0x00, 0x1c, 0x2b, 0x02, 0x00, 0x3c, 0x3e, 
-0x7d, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x2f, 0x42, 0x03, 0x00, 0x00, 0xae, 0x30, 0x42, 0x03, 0x00, 
-0x00, 0xaf, 0x31, 0x42, 0x03, 0x00, 0x00, 0xf8, 0x32, 0x42, 0x03, 0x00, 0x00, 0xe6, 0x33, 0x02, 
-0x01, 0x00, 0x27, 0xee, 0x34, 0x02, 0x01, 0x00, 0x2e, 0x2d, 0x35, 0x42, 0x04, 0x82, 0x90, 0xca, 
-0x39, 0x00, 0x00, 0x20, 0x56, 0x02, 0x00, 0xae, 0xaf, 0xf8, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 
-0xd5, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 
-0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 
-0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 
-0x20, 0x5e, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 
-0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 
-0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 
-0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0xf7, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0xf7, 
-0x00, 0x08, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0c, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x1e, 
-0x03, 0x03, 0x00, 0x00, 0x91, 0x92, 0x24, 0x03, 0x03, 0x00, 0x00, 0xa4, 0xa5, 0x26, 0x03, 0x03, 
-0x00, 0x00, 0xab, 0xac, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 
-0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x5e, 0x0b, 0x61, 
-0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 
-0xe2, 0x55, 0xea, 0x20, 0x5e, 0x27, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 
-0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 
-0x27, 0x22, 0x0d, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 
-0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x2c, 0x03, 0x63, 
-0x87, 0x43, 0x80, 0x20, 0x2c, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x08, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x0b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x0d, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x15, 0x03, 0x03, 0x00, 
-0x00, 0xe7, 0xe8, 0x17, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x19, 0x03, 0x03, 0x00, 0x00, 0xab, 0xac, 
-0x1e, 0x03, 0x03, 0x00, 0x00, 0x91, 0x92, 0x26, 0x03, 0x03, 0x00, 0x00, 0xd0, 0xd1, 0x2b, 0x01, 
-0x03, 0xce, 0xcf, 0x33, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x34, 0x02, 0x07, 0x00, 0x00, 0xcd, 0x00, 
-0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 
-0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 
-0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 
-0x27, 0x0b, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x41, 0xb5, 0x45, 0x90, 
-0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x20, 0x27, 0x22, 0x09, 0x65, 0x89, 0x69, 0x8b, 0x75, 0x81, 
-0x79, 0x98, 0x45, 0xd3, 0x49, 0xd8, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x2c, 0x0d, 0x61, 0x84, 
-0x65, 0x9e, 0x69, 0xa6, 0x6f, 0x94, 0x75, 0xa8, 0x41, 0x8e, 0x45, 0x9f, 0x49, 0xa7, 0x4f, 0x99, 
-0x55, 0xa9, 0x63, 0x87, 0x43, 0x80, 0x20, 0x2c, 0x2d, 0x0b, 0x61, 0xc6, 0x65, 0xec, 0x69, 0xf4, 
-0x6f, 0xe4, 0x6e, 0xa4, 0x41, 0xc7, 0x45, 0xed, 0x49, 0xf6, 0x4f, 0xe5, 0x4e, 0xa5, 0x20, 0x2d, 
-0x3c, 0x0b, 0x61, 0xfa, 0x65, 0xf1, 0x69, 0xe1, 0x6f, 0xfc, 0x75, 0xf7, 0x41, 0xfb, 0x45, 0xf2, 
-0x49, 0xee, 0x4f, 0xfd, 0x55, 0xef, 0x20, 0x3c, 0x3e, 0x0b, 0x61, 0x86, 0x65, 0xbd, 0x69, 0xf9, 
-0x6f, 0x9b, 0x75, 0xb8, 0x41, 0x8f, 0x45, 0xbe, 0x49, 0xdd, 0x4f, 0x9d, 0x55, 0xad, 0x20, 0x3e, 
-0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 0x9b, 0x06, 0x02, 0x03, 0x00, 0x00, 0x98, 0x08, 0x02, 0x03, 
-0x00, 0x00, 0xa0, 0x0a, 0x02, 0x03, 0x00, 0x00, 0xa6, 0x0d, 0x02, 0x03, 0x00, 0x00, 0xad, 0x17, 
-0x42, 0x07, 0x00, 0x00, 0xa0, 0x18, 0x42, 0x03, 0x00, 0x00, 0x8f, 0x19, 0x42, 0x03, 0x00, 0x00, 
-0x86, 0x33, 0x02, 0x03, 0x00, 0x00, 0xa7, 0x00, 0x60, 0x07, 0x61, 0x85, 0x65, 0x8a, 0x75, 0x97, 
-0x41, 0x8e, 0x45, 0x91, 0x55, 0x9d, 0x20, 0x60, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 
-0x6f, 0x93, 0x75, 0x96, 0x41, 0x84, 0x45, 0x92, 0x49, 0xa8, 0x4f, 0x99, 0x55, 0x9e, 0x20, 0x5e, 
-0xa1, 0x05, 0x65, 0x82, 0x6f, 0xa2, 0x75, 0xa3, 0x45, 0x90, 0x20, 0xa1, 0xa4, 0x07, 0x65, 0x89, 
-0x69, 0x8b, 0x75, 0x81, 0x45, 0x94, 0x49, 0x95, 0x55, 0x9a, 0x20, 0xa4, 0xa5, 0x03, 0x63, 0x87, 
-0x43, 0x80, 0x20, 0xa5, 0x00, 0x9a, 0x44, 0x07, 0x09, 0xbd, 0x01, 0x43, 0x46, 0x2c, 0xbd, 0x01, 
-0x43, 0x41, 0x0a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 
-0x1b, 0x01, 0xfc, 0x02, 0x00, 0x00, 0x5a, 0x03, 0x2a, 0x01, 0xfc, 0x02, 0x00, 0x00, 0x52, 0x03, 
-0x0e, 0x02, 0xfc, 0x02, 0x00, 0x00, 0x52, 0x03, 0x17, 0x02, 0xfc, 0x02, 0x00, 0x00, 0x5f, 0x03, 
-0x83, 0x03, 0x7b, 0x04, 0x00, 0x00, 0x5f, 0x03, 0xa0, 0x03, 0x7b, 0x04, 0x00, 0x00, 0x5b, 0x03, 
-0xba, 0x05, 0xb1, 0x06, 0x00, 0x00, 0x5b, 0x03, 0xd0, 0x05, 0xb1, 0x06, 0x00, 0x00, 0x46, 0x75, 
-0xc8, 0x04, 0xfd, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 
-0x01, 0x00, 0x3f, 0x08, 0x02, 0x03, 0x00, 0x00, 0x7b, 0x09, 0x02, 0x03, 0x00, 0x00, 0x7d, 0x0a, 
-0x04, 0x0b, 0x00, 0x00, 0x5b, 0x00, 0x1b, 0x0b, 0x04, 0x0b, 0x00, 0x00, 0x5d, 0x00, 0x1d, 0x0d, 
-0x02, 0x03, 0x00, 0x00, 0xaa, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 
-0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x04, 
-0x0f, 0xca, 0xcc, 0xc8, 0x00, 0x1e, 0x1b, 0x42, 0x00, 0x87, 0x80, 0x7e, 0x1e, 0x41, 0x00, 0x61, 
-0x41, 0x27, 0x02, 0x03, 0x00, 0x00, 0xf8, 0x28, 0x41, 0x00, 0x8a, 0xd4, 0x29, 0x04, 0x08, 0x2f, 
-0x5c, 0x7c, 0x00, 0x1c, 0x2b, 0x41, 0x00, 0x85, 0xb7, 0x2c, 0x42, 0x03, 0x00, 0x00, 0xae, 0x2d, 
-0x42, 0x03, 0x00, 0x00, 0xaf, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x33, 
-0x02, 0x01, 0x00, 0x27, 0x3c, 0x34, 0x02, 0x01, 0x00, 0x22, 0x3e, 0x35, 0x41, 0x00, 0x82, 0x90, 
-0x39, 0x00, 0x00, 0x20, 0x56, 0x44, 0x0c, 0x97, 0xeb, 0x00, 0x00, 0x1c, 0x00, 0x12, 0x42, 0x03, 
-0x00, 0x00, 0xd5, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x02, 0x01, 0x00, 0xfb, 
-0xad, 0x03, 0x01, 0x02, 0xfd, 0xa0, 0x04, 0x01, 0x00, 0xfc, 0x9c, 0x05, 0x01, 0x00, 0xac, 0xcf, 
-0x06, 0x01, 0x02, 0xab, 0xa0, 0x07, 0x01, 0x02, 0xf3, 0xa0, 0x08, 0x10, 0x00, 0x00, 0x09, 0x10, 
-0x00, 0x00, 0x0a, 0x01, 0x00, 0xf1, 0xf1, 0x0b, 0x10, 0x00, 0x00, 0x0c, 0x01, 0x00, 0xa8, 0xa8, 
-0x0d, 0x01, 0x03, 0xce, 0xa0, 0x10, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x12, 0x10, 0x00, 
-0x00, 0x13, 0x01, 0x00, 0xf4, 0xa9, 0x14, 0x10, 0x00, 0x00, 0x15, 0x01, 0x00, 0xbe, 0xbe, 0x16, 
-0x10, 0x00, 0x00, 0x17, 0x10, 0x00, 0x00, 0x18, 0x41, 0x00, 0x9b, 0x9d, 0x19, 0x41, 0x00, 0xe7, 
-0xe8, 0x1a, 0x01, 0x03, 0xa0, 0xcd, 0x1b, 0x01, 0x01, 0xc9, 0xee, 0x1e, 0x41, 0x00, 0x91, 0x92, 
-0x1f, 0x01, 0x00, 0xe1, 0xf5, 0x20, 0x41, 0x00, 0xd0, 0xd1, 0x21, 0x01, 0x00, 0xa6, 0xa6, 0x22, 
-0x10, 0x00, 0x00, 0x23, 0x10, 0x00, 0x00, 0x24, 0x10, 0x00, 0x00, 0x25, 0x10, 0x00, 0x00, 0x26, 
-0x10, 0x00, 0x00, 0x27, 0x01, 0x03, 0xcb, 0xa0, 0x28, 0x10, 0x00, 0x00, 0x29, 0x01, 0x00, 0x2d, 
-0xc4, 0x2b, 0x10, 0x00, 0x00, 0x2c, 0x10, 0x00, 0x00, 0x2d, 0x10, 0x00, 0x00, 0x2e, 0x01, 0x00, 
-0xbd, 0xb8, 0x2f, 0x10, 0x00, 0x00, 0x30, 0x10, 0x00, 0x00, 0x31, 0x10, 0x00, 0x00, 0x32, 0x01, 
-0x00, 0xe6, 0xa7, 0x33, 0x01, 0x00, 0x9e, 0x9e, 0x34, 0x01, 0x00, 0xfa, 0xf6, 0x35, 0x01, 0x02, 
-0x2f, 0xa0, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x01, 0x02, 0xdd, 0xa0, 0x00, 
-0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x02, 0x01, 0x00, 0xfb, 0xad, 0x03, 0x01, 
-0x02, 0xfd, 0xa0, 0x04, 0x01, 0x00, 0xfc, 0x9c, 0x05, 0x01, 0x00, 0xac, 0xcf, 0x06, 0x01, 0x02, 
-0xab, 0xa0, 0x07, 0x01, 0x02, 0xf3, 0xa0, 0x08, 0x10, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x0a, 
-0x01, 0x00, 0xf1, 0xf1, 0x0b, 0x10, 0x00, 0x00, 0x0c, 0x01, 0x00, 0xa8, 0xa8, 0x0d, 0x01, 0x03, 
-0xce, 0xa0, 0x10, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x13, 0x01, 
-0x00, 0xf4, 0xa9, 0x14, 0x10, 0x00, 0x00, 0x15, 0x01, 0x00, 0xbe, 0xbe, 0x16, 0x10, 0x00, 0x00, 
-0x17, 0x01, 0x01, 0xa0, 0xd5, 0x18, 0x41, 0x00, 0x9b, 0x9d, 0x19, 0x41, 0x00, 0xe7, 0xe8, 0x1a, 
-0x01, 0x03, 0xa0, 0xcd, 0x1b, 0x01, 0x01, 0xc9, 0xee, 0x1e, 0x41, 0x00, 0x91, 0x92, 0x1f, 0x01, 
-0x00, 0xe1, 0xf5, 0x20, 0x41, 0x00, 0xd0, 0xd1, 0x21, 0x01, 0x00, 0xa6, 0xa6, 0x22, 0x10, 0x00, 
-0x00, 0x23, 0x10, 0x00, 0x00, 0x24, 0x10, 0x00, 0x00, 0x25, 0x10, 0x00, 0x00, 0x26, 0x10, 0x00, 
-0x00, 0x27, 0x01, 0x03, 0xcb, 0xa0, 0x28, 0x10, 0x00, 0x00, 0x29, 0x01, 0x00, 0x2d, 0xc4, 0x2b, 
-0x10, 0x00, 0x00, 0x2c, 0x10, 0x00, 0x00, 0x2d, 0x10, 0x00, 0x00, 0x2e, 0x01, 0x00, 0xbd, 0xb8, 
-0x2f, 0x10, 0x00, 0x00, 0x30, 0x10, 0x00, 0x00, 0x31, 0x10, 0x00, 0x00, 0x32, 0x01, 0x00, 0xe6, 
-0xa7, 0x33, 0x01, 0x00, 0x9e, 0x9e, 0x34, 0x01, 0x00, 0xfa, 0xf6, 0x35, 0x01, 0x02, 0x2f, 0xa0, 
-0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x56, 0x01, 0x02, 0xdd, 0xa0, 0x00, 0x60, 0x0b, 
-0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 
-0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 
-0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 
-0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 0x0d, 
-0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 
-0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 
-0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 
-0x55, 0x9a, 0x20, 0xf9, 0xf8, 0x03, 0x61, 0x86, 0x41, 0x8f, 0x20, 0xf8, 0xf7, 0x03, 0x63, 0x87, 
-0x43, 0x80, 0x20, 0xf7, 0x00, 0x1a, 0x01, 0x03, 0x00, 0xc9, 0x28, 0x41, 0x00, 0x8a, 0x91, 0x2a, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x2b, 0x41, 0x00, 0x85, 0x8e, 0x56, 0x41, 0x00, 0x97, 
-0x9d, 0x00, 0x02, 0x10, 0x00, 0x00, 0x03, 0x01, 0x02, 0xfd, 0xa0, 0x04, 0x01, 0x00, 0xa6, 0x9c, 
-0x05, 0x01, 0x00, 0xac, 0x98, 0x06, 0x01, 0x02, 0xab, 0xa0, 0x07, 0x01, 0x02, 0xad, 0xa0, 0x08, 
-0x10, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x0a, 0x01, 0x00, 0xf1, 0xf1, 0x0b, 0x10, 0x00, 0x00, 
-0x0c, 0x10, 0x00, 0x00, 0x0d, 0x01, 0x03, 0xcc, 0xa0, 0x10, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 
-0x00, 0x12, 0x10, 0x00, 0x00, 0x13, 0x01, 0x02, 0x86, 0xa0, 0x14, 0x10, 0x00, 0x00, 0x15, 0x10, 
-0x00, 0x00, 0x16, 0x10, 0x00, 0x00, 0x17, 0x10, 0x00, 0x00, 0x18, 0x10, 0x00, 0x00, 0x19, 0x10, 
-0x00, 0x00, 0x1a, 0x01, 0x01, 0xa0, 0xf8, 0x1b, 0x01, 0x00, 0x7e, 0xa7, 0x1e, 0x10, 0x00, 0x00, 
-0x1f, 0x01, 0x00, 0xe1, 0x8f, 0x20, 0x10, 0x00, 0x00, 0x21, 0x10, 0x00, 0x00, 0x22, 0x10, 0x00, 
-0x00, 0x23, 0x10, 0x00, 0x00, 0x24, 0x10, 0x00, 0x00, 0x25, 0x10, 0x00, 0x00, 0x26, 0x10, 0x00, 
-0x00, 0x27, 0x01, 0x03, 0xcb, 0xa0, 0x28, 0x10, 0x00, 0x00, 0x29, 0x01, 0x00, 0x2d, 0xc4, 0x2b, 
-0x10, 0x00, 0x00, 0x2c, 0x10, 0x00, 0x00, 0x2d, 0x10, 0x00, 0x00, 0x2e, 0x01, 0x02, 0x9b, 0xa0, 
-0x2f, 0x10, 0x00, 0x00, 0x30, 0x10, 0x00, 0x00, 0x31, 0x10, 0x00, 0x00, 0x32, 0x01, 0x02, 0xe6, 
-0xa0, 0x33, 0x10, 0x00, 0x00, 0x34, 0x01, 0x00, 0xfa, 0xf6, 0x35, 0x01, 0x02, 0x2f, 0xa0, 0x36, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x56, 0x01, 0x02, 0xa0, 0xa0, 0x00, 0x60, 0x07, 0x61, 
-0x85, 0x65, 0x8a, 0x75, 0x97, 0x41, 0x8e, 0x45, 0x91, 0x55, 0x9d, 0x20, 0x60, 0xa4, 0x07, 0x65, 
-0x89, 0x69, 0x8b, 0x75, 0x81, 0x45, 0x94, 0x49, 0x95, 0x55, 0x9a, 0x20, 0xa4, 0x5e, 0x0b, 0x61, 
-0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0x84, 0x45, 0x92, 0x49, 0xa8, 0x4f, 
-0x99, 0x55, 0x9e, 0x20, 0x5e, 0xa1, 0x05, 0x65, 0x82, 0x6f, 0xa2, 0x75, 0xa3, 0x45, 0x90, 0x20, 
-0xa1, 0xa5, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0xa5, 0x00, 0x07, 0x03, 0x03, 0x00, 0x00, 0xe7, 
-0xe8, 0x12, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x18, 0x03, 0x03, 0x00, 0x00, 0xab, 0xac, 0x1b, 0x02, 
-0x07, 0x00, 0x00, 0xc9, 0x1e, 0x03, 0x03, 0x00, 0x00, 0x91, 0x92, 0x26, 0x03, 0x03, 0x00, 0x00, 
-0xd0, 0xd1, 0x33, 0x02, 0x07, 0x00, 0xcb, 0xcd, 0x34, 0x02, 0x07, 0x00, 0xce, 0xcf, 0x00, 0x60, 
-0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 
-0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x0b, 0x61, 0xc6, 0x65, 0xec, 0x69, 0xf4, 0x6f, 
-0xe4, 0x6e, 0xa4, 0x41, 0xc7, 0x45, 0xed, 0x49, 0xf6, 0x4f, 0xe5, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 
-0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 
-0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0x27, 0x0b, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 
-0xa2, 0x75, 0xa3, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x20, 0x27, 0x22, 
-0x09, 0x65, 0x89, 0x69, 0x8b, 0x75, 0x81, 0x79, 0x98, 0x45, 0xd3, 0x49, 0xd8, 0x55, 0x9a, 0x59, 
-0xf3, 0x20, 0x22, 0x3c, 0x0b, 0x61, 0xfa, 0x65, 0xf1, 0x69, 0xe1, 0x6f, 0xfc, 0x75, 0xf7, 0x41, 
-0xfb, 0x45, 0xf2, 0x49, 0xee, 0x4f, 0xfd, 0x55, 0xef, 0x20, 0x3c, 0x22, 0x0b, 0x61, 0x84, 0x65, 
-0x9e, 0x69, 0xa6, 0x6f, 0x94, 0x75, 0xa8, 0x41, 0x8e, 0x45, 0x9f, 0x49, 0xa7, 0x4f, 0x99, 0x55, 
-0xa9, 0x20, 0x22, 0x3e, 0x0b, 0x61, 0x86, 0x65, 0xbd, 0x69, 0xf9, 0x6f, 0x9b, 0x75, 0xb8, 0x41, 
-0x8f, 0x45, 0xbe, 0x49, 0xdd, 0x4f, 0x9d, 0x55, 0xad, 0x20, 0x3e, 0x00, 0x12, 0x42, 0x03, 0x00, 
-0x00, 0xd5, 0x18, 0x43, 0x03, 0x00, 0x00, 0xab, 0xac, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 
-0x7f, 0x00, 0x02, 0x01, 0x00, 0xfb, 0xad, 0x03, 0x01, 0x02, 0xfd, 0xa0, 0x04, 0x01, 0x00, 0xfc, 
-0x9c, 0x05, 0x01, 0x01, 0xa0, 0xcf, 0x06, 0x10, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x08, 0x10, 
-0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x0a, 0x01, 0x00, 0xf1, 0xf1, 0x0b, 0x10, 0x00, 0x00, 0x0c, 
-0x01, 0x00, 0xa8, 0xa8, 0x0d, 0x01, 0x03, 0xce, 0xa0, 0x10, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 
-0x00, 0x12, 0x10, 0x00, 0x00, 0x13, 0x01, 0x00, 0xf4, 0xa9, 0x14, 0x10, 0x00, 0x00, 0x15, 0x01, 
-0x00, 0xbe, 0xbe, 0x16, 0x10, 0x00, 0x00, 0x17, 0x10, 0x00, 0x00, 0x18, 0x41, 0x00, 0x9b, 0x9d, 
-0x19, 0x41, 0x00, 0xe7, 0xe8, 0x1a, 0x01, 0x03, 0xa0, 0xcd, 0x1b, 0x01, 0x01, 0xc9, 0xee, 0x1e, 
-0x41, 0x00, 0x91, 0x92, 0x1f, 0x01, 0x00, 0xe1, 0xf5, 0x20, 0x41, 0x00, 0xd0, 0xd1, 0x21, 0x01, 
-0x00, 0xa6, 0xa6, 0x22, 0x10, 0x00, 0x00, 0x23, 0x10, 0x00, 0x00, 0x24, 0x10, 0x00, 0x00, 0x25, 
-0x10, 0x00, 0x00, 0x26, 0x10, 0x00, 0x00, 0x27, 0x01, 0x03, 0xcb, 0xa0, 0x28, 0x10, 0x00, 0x00, 
-0x29, 0x01, 0x00, 0x2d, 0xc4, 0x2b, 0x10, 0x00, 0x00, 0x2c, 0x10, 0x00, 0x00, 0x2d, 0x10, 0x00, 
-0x00, 0x2e, 0x01, 0x00, 0xbd, 0xb8, 0x2f, 0x10, 0x00, 0x00, 0x30, 0x10, 0x00, 0x00, 0x31, 0x10, 
-0x00, 0x00, 0x32, 0x01, 0x00, 0xe6, 0xa7, 0x33, 0x01, 0x00, 0x9e, 0x9e, 0x34, 0x01, 0x00, 0xfa, 
-0xf6, 0x35, 0x01, 0x02, 0x2f, 0xa0, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x56, 0x10, 
-0x00, 0x00, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 
-0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 
-0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 
-0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 
-0xea, 0x20, 0x5e, 0x27, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 
-0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0x27, 0x22, 
-0x0d, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 
-0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0xf8, 0x03, 0x61, 0x86, 0x41, 
-0x8f, 0x20, 0xf8, 0x2c, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0x2c, 0x00, 0x50, 0xaa, 0x04, 0x04, 
-0xf5, 0x01, 0x43, 0x46, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x5a, 0x03, 0x58, 0x01, 0x5f, 0x01, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x5f, 0x01, 0x00, 0x00, 
-0x5f, 0x03, 0xd8, 0x03, 0x58, 0x04, 0x00, 0x00, 0x5b, 0x03, 0xde, 0x01, 0xfe, 0x01, 0x00, 0x00, 
-0x46, 0x75, 0x7f, 0x02, 0x17, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0x03, 0x03, 0x00, 0x00, 0xfb, 0xad, 0x03, 0x03, 0x01, 0x00, 0x22, 0x40, 0xfd, 0x04, 0x03, 
-0x03, 0x00, 0x00, 0xfc, 0x9c, 0x05, 0x03, 0x03, 0x00, 0x00, 0xac, 0xcf, 0x06, 0x02, 0x03, 0x00, 
-0x00, 0xab, 0x07, 0x02, 0x01, 0x00, 0x3f, 0xf3, 0x08, 0x02, 0x03, 0x00, 0x00, 0x7b, 0x09, 0x04, 
-0x03, 0x00, 0x00, 0x5b, 0xf1, 0x1b, 0x0a, 0x04, 0x0b, 0x00, 0x00, 0x5d, 0x00, 0x1d, 0x0b, 0x02, 
-0x03, 0x00, 0x00, 0x7d, 0x0c, 0x03, 0x03, 0x00, 0x00, 0x7c, 0xa8, 0x0d, 0x02, 0x07, 0x00, 0x00, 
-0xcc, 0x12, 0x41, 0x00, 0x65, 0x45, 0x13, 0x43, 0x03, 0x00, 0x00, 0xf4, 0xa9, 0x15, 0x42, 0x00, 
-0x79, 0x59, 0xbe, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x43, 0x00, 
-0x6f, 0x4f, 0x9b, 0x9d, 0x19, 0x43, 0x03, 0x00, 0x00, 0xe7, 0xe8, 0x1a, 0x04, 0x0b, 0xca, 0xca, 
-0xf8, 0x00, 0x1e, 0x1b, 0x43, 0x0c, 0x87, 0x80, 0xc9, 0xcd, 0x1e, 0x43, 0x00, 0x61, 0x41, 0x91, 
-0x92, 0x1f, 0x43, 0x03, 0x00, 0x00, 0xe1, 0xf5, 0x20, 0x43, 0x03, 0x00, 0x00, 0xd0, 0xd1, 0x21, 
-0x42, 0x03, 0x00, 0x00, 0xa6, 0x27, 0x03, 0x0f, 0x00, 0x00, 0xcb, 0xcb, 0x28, 0x41, 0x00, 0x8a, 
-0xd4, 0x29, 0x02, 0x00, 0xf8, 0xf8, 0xaa, 0x2b, 0x43, 0x0c, 0x85, 0xb7, 0xc8, 0xc8, 0x2c, 0x42, 
-0x03, 0x00, 0x00, 0xae, 0x2d, 0x42, 0x03, 0x00, 0x00, 0xaf, 0x2e, 0x43, 0x00, 0x63, 0x43, 0xbd, 
-0xb8, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x32, 0x43, 0x03, 0x00, 0x00, 0xe6, 0xa7, 0x33, 0x02, 0x01, 
-0x00, 0x27, 0x3c, 0x34, 0x02, 0x01, 0x00, 0x2e, 0x3e, 0x35, 0x42, 0x00, 0x82, 0x90, 0x2f, 0x39, 
-0x00, 0x00, 0x20, 0x56, 0x44, 0x00, 0x97, 0xeb, 0x5c, 0x7c, 0x1c, 0x00, 0x12, 0x42, 0x03, 0x00, 
-0x00, 0xd5, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 
-0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 
-0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 
-0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 
-0xea, 0x20, 0x5e, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 
-0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf7, 
-0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0xf7, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 
-0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 
-0xf9, 0x00, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x07, 0x02, 
-0x05, 0x00, 0x3f, 0xa0, 0x12, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x17, 0x03, 0x03, 0x00, 0x00, 0xab, 
-0xac, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 
-0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 
-0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 
-0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 
-0x20, 0x5e, 0x27, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 
-0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0x27, 0x2c, 0x03, 
-0x63, 0x87, 0x43, 0x80, 0x20, 0x2c, 0x22, 0x0d, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 
-0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x59, 0xf3, 
-0x20, 0x22, 0x00, 0x02, 0x03, 0x0f, 0x00, 0x00, 0xa0, 0xa0, 0x03, 0x03, 0x0f, 0x00, 0x00, 0x00, 
-0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x07, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x03, 0x0f, 0x00, 0x00, 0x00, 0xa0, 
-0x0c, 0x03, 0x0f, 0x00, 0x00, 0x00, 0xa0, 0x12, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x13, 0x03, 0x0f, 
-0x00, 0x00, 0xa0, 0xa0, 0x14, 0x03, 0x03, 0x00, 0x00, 0xe7, 0xe8, 0x15, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x17, 0x03, 0x03, 0x00, 0x00, 0xab, 0xac, 0x18, 0x03, 0x0f, 0x00, 0x00, 0xa0, 0xa0, 0x19, 
-0x03, 0x0f, 0x00, 0x00, 0xa0, 0xa0, 0x1f, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x20, 0x03, 0x0f, 0x00, 
-0x00, 0xa0, 0xa0, 0x21, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x26, 0x03, 0x03, 0x00, 0x00, 0xd0, 0xd1, 
-0x2e, 0x03, 0x0f, 0x00, 0x00, 0xa0, 0xa0, 0x32, 0x03, 0x0f, 0x00, 0x00, 0x00, 0xa0, 0x33, 0x02, 
-0x07, 0x00, 0x00, 0xce, 0x34, 0x02, 0x07, 0x00, 0x00, 0xcf, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 
-0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 
-0xeb, 0x20, 0x60, 0x7e, 0x0b, 0x61, 0xc6, 0x65, 0xec, 0x69, 0xf4, 0x6f, 0xe4, 0x6e, 0xa4, 0x41, 
-0xc7, 0x45, 0xed, 0x49, 0xf6, 0x4f, 0xe5, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 
-0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 
-0xea, 0x20, 0x5e, 0x27, 0x0b, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x41, 
-0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x20, 0x27, 0x2c, 0x0d, 0x61, 0x84, 0x65, 
-0x9e, 0x69, 0xa6, 0x6f, 0x94, 0x75, 0xa8, 0x41, 0x8e, 0x45, 0x9f, 0x49, 0xa7, 0x4f, 0x99, 0x55, 
-0xa9, 0x63, 0x87, 0x43, 0x80, 0x20, 0x2c, 0x22, 0x09, 0x65, 0x89, 0x69, 0x8b, 0x75, 0x81, 0x79, 
-0x98, 0x45, 0xd3, 0x49, 0xd8, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x3c, 0x0b, 0x61, 0xfa, 0x65, 
-0xf1, 0x69, 0xe1, 0x6f, 0xfc, 0x75, 0xf7, 0x41, 0xfb, 0x45, 0xf2, 0x49, 0xee, 0x4f, 0xfd, 0x55, 
-0xef, 0x20, 0x3c, 0x3e, 0x0b, 0x61, 0x86, 0x65, 0xbd, 0x69, 0xf9, 0x6f, 0x9b, 0x75, 0xb8, 0x41, 
-0x8f, 0x45, 0xbe, 0x49, 0xdd, 0x4f, 0x9d, 0x55, 0xad, 0x20, 0x3e, 0x00, 0x02, 0x03, 0x0f, 0x00, 
-0x00, 0xa0, 0xa0, 0x04, 0x02, 0x03, 0x00, 0x00, 0xa6, 0x05, 0x03, 0x07, 0x00, 0x00, 0x00, 0x98, 
-0x07, 0x02, 0x03, 0x00, 0x00, 0xad, 0x0c, 0x03, 0x0f, 0x00, 0x00, 0x00, 0xa0, 0x13, 0x43, 0x0b, 
-0x00, 0x00, 0x86, 0xa0, 0x15, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x18, 0x43, 0x0f, 0x00, 0x00, 0xa0, 
-0xa0, 0x19, 0x43, 0x0f, 0x00, 0x00, 0xa0, 0xa0, 0x1b, 0x43, 0x0b, 0x00, 0x00, 0x7e, 0xc9, 0x1e, 
-0x43, 0x0f, 0x00, 0x00, 0xa0, 0xa0, 0x1f, 0x43, 0x07, 0x00, 0x00, 0x00, 0x8f, 0x20, 0x43, 0x0f, 
-0x00, 0x00, 0xa0, 0xa0, 0x21, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x28, 0x41, 0x00, 0x8a, 0x91, 0x2b, 
-0x41, 0x00, 0x85, 0x8e, 0x2e, 0x43, 0x0b, 0x00, 0x00, 0x9b, 0xa0, 0x32, 0x43, 0x0f, 0x00, 0x00, 
-0x00, 0xa0, 0x39, 0x00, 0x00, 0x20, 0x56, 0x41, 0x00, 0x97, 0x9d, 0x00, 0x60, 0x07, 0x61, 0x85, 
-0x65, 0x8a, 0x75, 0x97, 0x41, 0x8e, 0x45, 0x91, 0x55, 0x9d, 0x20, 0x60, 0xa4, 0x07, 0x65, 0x89, 
-0x69, 0x8b, 0x75, 0x81, 0x45, 0x94, 0x49, 0x95, 0x55, 0x9a, 0x20, 0xa4, 0x5e, 0x0b, 0x61, 0x83, 
-0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0x84, 0x45, 0x92, 0x49, 0xa8, 0x4f, 0x99, 
-0x55, 0x9e, 0x20, 0x5e, 0xa1, 0x05, 0x65, 0x82, 0x6f, 0xa2, 0x75, 0xa3, 0x45, 0x90, 0x20, 0xa1, 
-0xa5, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0xa5, 0x00, 0x8c, 0x0b, 0x03, 0x04, 0x00, 0x00, 0x43, 
-0x5a, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x03, 0x66, 
-0x01, 0xb6, 0x01, 0x00, 0x00, 0x5a, 0x03, 0x08, 0x01, 0x0f, 0x01, 0x00, 0x00, 0x52, 0x03, 0x00, 
-0x00, 0x0f, 0x01, 0x00, 0x00, 0x63, 0x03, 0x4b, 0x02, 0x99, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 
-0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 
-0x2b, 0x31, 0x21, 0x03, 0x02, 0x01, 0xa0, 0x32, 0x40, 0x04, 0x02, 0x01, 0xa0, 0x33, 0x23, 0x05, 
-0x02, 0x01, 0xa0, 0x34, 0x24, 0x06, 0x02, 0x01, 0xa0, 0x35, 0x25, 0x07, 0x02, 0x01, 0xa0, 0x36, 
-0x5e, 0x08, 0x02, 0x00, 0xec, 0x37, 0x26, 0x09, 0x02, 0x00, 0xa0, 0x38, 0x2a, 0x0a, 0x02, 0x00, 
-0xa1, 0x39, 0x28, 0x0b, 0x02, 0x00, 0x82, 0x30, 0x29, 0x0c, 0x03, 0x00, 0x3d, 0x25, 0x2d, 0x5f, 
-0x0d, 0x03, 0x03, 0xc8, 0xa0, 0x3d, 0x2b, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0x41, 0x00, 0x79, 
-0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 
-0x1a, 0x03, 0x00, 0xa3, 0x2f, 0x5b, 0x7b, 0x1b, 0x03, 0x00, 0x29, 0x28, 0x5d, 0x7d, 0x1e, 0x41, 
-0x00, 0x61, 0x41, 0x27, 0x03, 0x01, 0xa0, 0x22, 0x3b, 0x3a, 0x28, 0x03, 0x08, 0xf5, 0x21, 0xcf, 
-0xcb, 0x29, 0x03, 0x02, 0x3b, 0xca, 0x60, 0x7e, 0x2b, 0x03, 0x01, 0xc9, 0x27, 0x5c, 0x7c, 0x2e, 
-0x41, 0x00, 0x63, 0x43, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x33, 0x03, 0x01, 0x00, 0x3f, 0x3c, 0x9e, 
-0x34, 0x03, 0x01, 0x00, 0x3a, 0x3e, 0xf6, 0x35, 0x03, 0x00, 0x2d, 0x5f, 0x2f, 0x3f, 0x39, 0x00, 
-0x00, 0x20, 0x56, 0x02, 0x00, 0x26, 0x2a, 0xe1, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 
-0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 
-0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 
-0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 
-0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0xf8, 0x03, 0x61, 0x86, 0x41, 0x8f, 0x20, 0xf8, 0x5e, 0x0b, 
-0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 
-0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0x00, 0x03, 0x00, 0x00, 0xd8, 0x04, 0x00, 0x00, 0xe7, 0x05, 
-0x00, 0x00, 0x9f, 0x06, 0x00, 0x00, 0xfd, 0x07, 0x00, 0x00, 0xa7, 0x0d, 0x01, 0x03, 0x00, 0xcb, 
-0x12, 0x42, 0x03, 0x00, 0x00, 0xaa, 0x13, 0x41, 0x00, 0x72, 0x52, 0x14, 0x41, 0x00, 0x74, 0x54, 
-0x1f, 0x41, 0x00, 0x73, 0x53, 0x20, 0x41, 0x00, 0x64, 0x44, 0x26, 0x41, 0x00, 0x6c, 0x4c, 0x27, 
-0x00, 0x00, 0x85, 0x28, 0x03, 0x0f, 0x00, 0x00, 0x00, 0xcc, 0x2c, 0x41, 0x00, 0x7a, 0x5a, 0x56, 
-0x03, 0x0f, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x27, 0x19, 0x61, 0xa0, 0x63, 0x86, 0x65, 0x82, 0x69, 
-0xa1, 0x6c, 0x92, 0x6e, 0xe4, 0x6f, 0xa2, 0x72, 0xea, 0x73, 0x98, 0x75, 0xa3, 0x79, 0xec, 0x7a, 
-0xab, 0x41, 0xb5, 0x43, 0x8f, 0x45, 0x90, 0x49, 0xd6, 0x4c, 0x91, 0x4e, 0xe3, 0x4f, 0xe0, 0x52, 
-0xe8, 0x53, 0x97, 0x55, 0xe9, 0x59, 0xed, 0x5a, 0x8d, 0x20, 0xef, 0xf9, 0x09, 0x61, 0x84, 0x65, 
-0x89, 0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 0x45, 0xd3, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0xf8, 
-0x03, 0x75, 0x85, 0x55, 0xde, 0x20, 0xf8, 0xf3, 0x13, 0x63, 0x9f, 0x64, 0xd4, 0x65, 0xd8, 0x6c, 
-0x96, 0x6e, 0xe5, 0x72, 0xfd, 0x73, 0xe7, 0x74, 0x9c, 0x7a, 0xa7, 0x43, 0xac, 0x44, 0xd2, 0x45, 
-0xb7, 0x4c, 0x95, 0x4e, 0xd5, 0x52, 0xfc, 0x53, 0xe6, 0x54, 0x9b, 0x5a, 0xa6, 0x20, 0xf3, 0x5e, 
-0x07, 0x61, 0x83, 0x69, 0x8c, 0x6f, 0x93, 0x41, 0xb6, 0x49, 0xd7, 0x4f, 0xe2, 0x20, 0x5e, 0xf1, 
-0x05, 0x6f, 0x8b, 0x75, 0xfb, 0x4f, 0x8a, 0x55, 0xeb, 0x20, 0xf1, 0x00, 0x03, 0x00, 0x00, 0x88, 
-0x04, 0x00, 0x00, 0xa8, 0x05, 0x00, 0x00, 0x87, 0x06, 0x00, 0x00, 0xa9, 0x07, 0x00, 0x00, 0x91, 
-0x08, 0x00, 0x00, 0x98, 0x0d, 0x01, 0x03, 0x00, 0xcb, 0x13, 0x41, 0x00, 0x72, 0x52, 0x14, 0x41, 
-0x00, 0x74, 0x54, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x20, 0x41, 0x00, 0x64, 0x44, 0x26, 0x41, 0x00, 
-0x6c, 0x4c, 0x27, 0x00, 0x00, 0x96, 0x28, 0x03, 0x0e, 0xad, 0x00, 0xa0, 0xcc, 0x2c, 0x41, 0x00, 
-0x7a, 0x5a, 0x33, 0x03, 0x0f, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x27, 0x11, 0x61, 0xa0, 0x65, 0x82, 
-0x69, 0xa1, 0x6c, 0x8d, 0x6f, 0xa2, 0x72, 0xaa, 0x75, 0xa3, 0x79, 0x98, 0x41, 0x8f, 0x45, 0x90, 
-0x49, 0x8b, 0x4c, 0x8a, 0x4f, 0x95, 0x52, 0xab, 0x55, 0x97, 0x59, 0x9d, 0x20, 0x27, 0x22, 0x07, 
-0x61, 0x84, 0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0xf8, 0x03, 
-0x75, 0x96, 0x55, 0xa6, 0x20, 0xf8, 0x76, 0x13, 0x63, 0x87, 0x64, 0x83, 0x65, 0x88, 0x6c, 0x8c, 
-0x6e, 0xa4, 0x72, 0xa9, 0x73, 0xa8, 0x74, 0x9f, 0x7a, 0x91, 0x43, 0x80, 0x44, 0x85, 0x45, 0x89, 
-0x4c, 0x9c, 0x4e, 0xa5, 0x52, 0x9e, 0x53, 0x9b, 0x54, 0x86, 0x5a, 0x92, 0x20, 0x76, 0x5e, 0x03, 
-0x6f, 0x93, 0x4f, 0xa7, 0x20, 0x5e, 0x00, 0x19, 0xfa, 0x03, 0x04, 0xf3, 0x00, 0x43, 0x5a, 0x05, 
-0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x03, 0x4a, 0x01, 0xcc, 
-0x01, 0x00, 0x00, 0x5a, 0x03, 0x8d, 0x02, 0x94, 0x02, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x94, 
-0x02, 0x00, 0x00, 0x63, 0x03, 0x1b, 0x03, 0x88, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x2b, 0x31, 0xc8, 0x03, 0x01, 0x01, 0xa0, 0x32, 0x04, 0x03, 
-0x05, 0xa0, 0x33, 0xc9, 0x1e, 0x05, 0x01, 0x01, 0xa0, 0x34, 0x06, 0x02, 0x05, 0xa0, 0x35, 0xca, 
-0x07, 0x01, 0x01, 0xa0, 0x36, 0x08, 0x02, 0x04, 0xec, 0x37, 0xcb, 0x09, 0x02, 0x00, 0xa0, 0x38, 
-0xfa, 0x0a, 0x02, 0x04, 0xa1, 0x39, 0xcc, 0x0b, 0x01, 0x00, 0x82, 0x30, 0x0c, 0x02, 0x04, 0x3d, 
-0x25, 0xcd, 0x0d, 0x02, 0x07, 0xcc, 0xa0, 0xce, 0x10, 0x42, 0x03, 0x00, 0x00, 0x5c, 0x11, 0x42, 
-0x03, 0x00, 0x00, 0x7c, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0xc4, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 
-0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 
-0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x02, 0x00, 0xa3, 0x2f, 0xf6, 0x1b, 0x02, 0x00, 0x29, 0x28, 
-0x9e, 0x1e, 0x42, 0x00, 0x61, 0x41, 0x3c, 0x21, 0x42, 0x03, 0x00, 0x00, 0x5b, 0x22, 0x42, 0x03, 
-0x00, 0x00, 0x5d, 0x27, 0x02, 0x01, 0xa0, 0x22, 0x24, 0x28, 0x02, 0x00, 0xf5, 0x21, 0xe1, 0x29, 
-0x01, 0x02, 0x3b, 0xca, 0x2b, 0x02, 0x01, 0xcd, 0x27, 0xcf, 0x2c, 0xc4, 0x00, 0x79, 0x15, 0x59, 
-0x15, 0x3e, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 0x42, 0x03, 0x00, 0x00, 0x23, 0x2e, 0x42, 0x00, 
-0x63, 0x43, 0x26, 0x2f, 0x42, 0x03, 0x00, 0x00, 0x40, 0x30, 0x42, 0x03, 0x00, 0x00, 0x7b, 0x31, 
-0x42, 0x00, 0x6e, 0x4e, 0x7d, 0x32, 0x42, 0x03, 0x00, 0x00, 0xe6, 0x33, 0x01, 0x01, 0x00, 0x3f, 
-0x34, 0x02, 0x01, 0x00, 0x3a, 0x2a, 0x35, 0x03, 0x04, 0x2d, 0x5f, 0x00, 0x1f, 0x39, 0x00, 0x00, 
-0x20, 0x56, 0x03, 0x00, 0x26, 0x2a, 0x3c, 0x1c, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x7e, 0x03, 
-0x02, 0x06, 0xd8, 0x00, 0xc8, 0x04, 0x00, 0x00, 0xe7, 0x05, 0x02, 0x06, 0x9f, 0x00, 0xca, 0x06, 
-0x02, 0x06, 0xfd, 0x00, 0xcb, 0x07, 0x02, 0x06, 0xa7, 0x00, 0xcc, 0x08, 0x02, 0x03, 0x00, 0x00, 
-0x60, 0x09, 0x02, 0x07, 0x00, 0x00, 0xcd, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xce, 0x0b, 0x02, 0x07, 
-0x00, 0x00, 0xcf, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xd0, 0x0d, 0x02, 0x07, 0xce, 0xc8, 0xd1, 0x12, 
-0x42, 0x03, 0x00, 0x00, 0xaa, 0x13, 0x41, 0x00, 0x72, 0x52, 0x14, 0x41, 0x00, 0x74, 0x54, 0x1f, 
-0x42, 0x00, 0x73, 0x53, 0xd0, 0x20, 0x42, 0x00, 0x64, 0x44, 0xd1, 0x25, 0x42, 0x03, 0x00, 0x00, 
-0x88, 0x26, 0x42, 0x00, 0x6c, 0x4c, 0x9d, 0x27, 0x00, 0x00, 0x85, 0x29, 0x01, 0x03, 0x00, 0xcb, 
-0x2b, 0x00, 0x01, 0xd0, 0x32, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x00, 0xf3, 0x13, 0x63, 0x9f, 0x64, 
-0xd4, 0x65, 0xd8, 0x6c, 0x96, 0x6e, 0xe5, 0x72, 0xfd, 0x73, 0xe7, 0x74, 0x9c, 0x7a, 0xa7, 0x43, 
-0xac, 0x44, 0xd2, 0x45, 0xb7, 0x4c, 0x95, 0x4e, 0xd5, 0x52, 0xfc, 0x53, 0xe6, 0x54, 0x9b, 0x5a, 
-0xa6, 0x20, 0xf3, 0x5e, 0x07, 0x61, 0x83, 0x69, 0x8c, 0x6f, 0x93, 0x41, 0xb6, 0x49, 0xd7, 0x4f, 
-0xe2, 0x20, 0x5e, 0xf4, 0x03, 0x61, 0xc7, 0x41, 0xc6, 0x20, 0xf4, 0xf8, 0x03, 0x75, 0x85, 0x55, 
-0xde, 0x20, 0xf8, 0xf2, 0x05, 0x61, 0xa5, 0x65, 0xa9, 0x41, 0xa4, 0x45, 0xa8, 0x20, 0xf2, 0xfa, 
-0x03, 0x7a, 0xbe, 0x5a, 0xbd, 0x20, 0xfa, 0x27, 0x19, 0x61, 0xa0, 0x63, 0x86, 0x65, 0x82, 0x69, 
-0xa1, 0x6c, 0x92, 0x6e, 0xe4, 0x6f, 0xa2, 0x72, 0xea, 0x73, 0x98, 0x75, 0xa3, 0x79, 0xec, 0x7a, 
-0xab, 0x41, 0xb5, 0x43, 0x8f, 0x45, 0x90, 0x49, 0xd6, 0x4c, 0x91, 0x4e, 0xe3, 0x4f, 0xe0, 0x52, 
-0xe8, 0x53, 0x97, 0x55, 0xe9, 0x59, 0xed, 0x5a, 0x8d, 0x20, 0xef, 0xf1, 0x05, 0x6f, 0x8b, 0x75, 
-0xfb, 0x4f, 0x8a, 0x55, 0xeb, 0x20, 0xf1, 0xf9, 0x09, 0x61, 0x84, 0x65, 0x89, 0x6f, 0x94, 0x75, 
-0x81, 0x41, 0x8e, 0x45, 0xd3, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0xf7, 0x07, 0x63, 0x87, 0x73, 
-0xad, 0x74, 0xee, 0x43, 0x80, 0x53, 0xb8, 0x54, 0xdd, 0x20, 0xf7, 0x00, 0x12, 0x42, 0x03, 0x00, 
-0x00, 0xd5, 0x00, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 
-0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 
-0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xf8, 0x03, 0x61, 0x86, 0x41, 
-0x8f, 0x20, 0xf8, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 
-0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0xef, 0x0d, 0x61, 0xa0, 0x65, 
-0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 
-0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 
-0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 
-0xf9, 0xf7, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0xf7, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x7e, 
-0x03, 0x02, 0x06, 0x88, 0x00, 0xc8, 0x04, 0x00, 0x00, 0xa8, 0x05, 0x00, 0x00, 0x87, 0x06, 0x00, 
-0x00, 0xa9, 0x07, 0x00, 0x00, 0x91, 0x08, 0x02, 0x02, 0x98, 0x00, 0x60, 0x09, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xcb, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xcc, 0x0d, 0x02, 
-0x07, 0xcb, 0xc8, 0xa0, 0x13, 0x41, 0x00, 0x72, 0x52, 0x14, 0x41, 0x00, 0x74, 0x54, 0x1b, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x20, 0x41, 0x00, 0x64, 0x44, 0x26, 0x41, 
-0x00, 0x6c, 0x4c, 0x27, 0x00, 0x00, 0x96, 0x28, 0x00, 0x00, 0xad, 0x29, 0x01, 0x03, 0x00, 0xca, 
-0x2b, 0x02, 0x07, 0xcc, 0x00, 0xa0, 0x00, 0x76, 0x13, 0x63, 0x87, 0x64, 0x83, 0x65, 0x88, 0x6c, 
-0x8c, 0x6e, 0xa4, 0x72, 0xa9, 0x73, 0xa8, 0x74, 0x9f, 0x7a, 0x91, 0x43, 0x80, 0x44, 0x85, 0x45, 
-0x89, 0x4c, 0x9c, 0x4e, 0xa5, 0x52, 0x9e, 0x53, 0x9b, 0x54, 0x86, 0x5a, 0x92, 0x20, 0x76, 0x5e, 
-0x03, 0x6f, 0x93, 0x4f, 0xa7, 0x20, 0x5e, 0xf8, 0x03, 0x75, 0x96, 0x55, 0xa6, 0x20, 0xf8, 0x27, 
-0x11, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6c, 0x8d, 0x6f, 0xa2, 0x72, 0xaa, 0x75, 0xa3, 0x79, 
-0x98, 0x41, 0x8f, 0x45, 0x90, 0x49, 0x8b, 0x4c, 0x8a, 0x4f, 0x95, 0x52, 0xab, 0x55, 0x97, 0x59, 
-0x9d, 0x20, 0x27, 0x22, 0x07, 0x61, 0x84, 0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 0x4f, 0x99, 0x55, 
-0x9a, 0x20, 0x22, 0x00, 0xe5, 0x77, 0x02, 0x09, 0x00, 0x00, 0x44, 0x4b, 0x2c, 0x9f, 0x00, 0x44, 
-0x4b, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xfd, 
-0x00, 0x0a, 0x01, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x61, 0x03, 0x85, 
-0x01, 0x90, 0x01, 0x00, 0x00, 0x34, 0x75, 0xdf, 0x01, 0x18, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 
-0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0x22, 0x40, 0x04, 0x02, 0x03, 0x00, 0x00, 
-0x9c, 0x05, 0x02, 0x01, 0x00, 0xcf, 0x24, 0x07, 0x01, 0x01, 0x00, 0x26, 0x08, 0x02, 0x01, 0x00, 
-0x2f, 0x7b, 0x09, 0x03, 0x01, 0x00, 0x28, 0x5b, 0x1b, 0x0a, 0x03, 0x01, 0x00, 0x29, 0x5d, 0x1d, 
-0x0b, 0x02, 0x01, 0x00, 0x3d, 0x7d, 0x0c, 0x01, 0x00, 0x2b, 0x3f, 0x0d, 0x02, 0x03, 0xcb, 0xc8, 
-0x7c, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 
-0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x41, 0x00, 0x86, 0x8f, 0x1b, 
-0x03, 0x07, 0xcc, 0xca, 0xc9, 0x1e, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x27, 0x41, 0x00, 0x91, 0x92, 
-0x28, 0x41, 0x00, 0x9b, 0x9d, 0x29, 0x01, 0x00, 0xab, 0xf5, 0x2b, 0x01, 0x00, 0x27, 0x2a, 0x2e, 
-0x41, 0x00, 0x63, 0x43, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x32, 0x42, 0x03, 0x00, 0x00, 0xe6, 0x33, 
-0x02, 0x01, 0x00, 0x3b, 0x3c, 0x34, 0x02, 0x01, 0x00, 0x3a, 0x3e, 0x35, 0x03, 0x00, 0x2d, 0x5f, 
-0x5c, 0x1f, 0x39, 0x00, 0x00, 0x20, 0x56, 0x03, 0x00, 0x3c, 0x3e, 0x5c, 0x1c, 0x00, 0x06, 0x02, 
-0x03, 0x00, 0x00, 0xd5, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 
-0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 
-0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 
-0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 
-0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 0x0f, 0x61, 0xa0, 0x63, 
-0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x43, 0x80, 0x45, 
-0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 
-0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 
-0x99, 0x55, 0x9a, 0x20, 0xf9, 0x00, 0x05, 0x01, 0x01, 0x00, 0xaf, 0x29, 0x01, 0x01, 0x00, 0x15, 
-0x00, 0x60, 0x06, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x20, 0x60, 0x7e, 
-0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x06, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 
-0x93, 0x75, 0x96, 0x20, 0x5e, 0x27, 0x09, 0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 
-0xa2, 0x75, 0xa3, 0x43, 0x80, 0x45, 0x90, 0x20, 0x27, 0x22, 0x0a, 0x61, 0x84, 0x65, 0x89, 0x69, 
-0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x00, 
-0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x0d, 0x01, 0x03, 0xca, 0xa0, 0x12, 0x02, 0x03, 0x00, 0x00, 
-0xd5, 0x1b, 0x03, 0x07, 0xcb, 0xc9, 0xc8, 0x1e, 0x1f, 0x02, 0x03, 0x00, 0x00, 0xe1, 0x20, 0x04, 
-0x0b, 0x00, 0x00, 0xd0, 0x00, 0xd1, 0x25, 0x02, 0x03, 0x00, 0x00, 0xf2, 0x2c, 0x02, 0x03, 0x00, 
-0x00, 0xae, 0x2d, 0x02, 0x03, 0x00, 0x00, 0xaf, 0x00, 0x7e, 0x07, 0x61, 0xc6, 0x69, 0x8d, 0x75, 
-0x97, 0x41, 0xc7, 0x49, 0xde, 0x55, 0xeb, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 
-0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 
-0x5e, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 
-0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x07, 0x61, 
-0x84, 0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0x00, 0x8d, 0x20, 
-0x02, 0x17, 0x00, 0x00, 0x44, 0x56, 0x2c, 0x00, 0x00, 0x55, 0x53, 0x44, 0x56, 0x2c, 0x67, 0x00, 
-0x44, 0x56, 0x2c, 0x67, 0x00, 0x55, 0x53, 0x44, 0x56, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xfa, 0x01, 0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x84, 0x00, 0x5b, 0x1a, 0x7b, 0x1a, 0x1b, 0x1a, 0x00, 0x1a, 
-0x00, 0x1a, 0x0d, 0x84, 0x00, 0x5d, 0x1b, 0x7d, 0x1b, 0x1d, 0x1b, 0x00, 0x1b, 0x00, 0x1b, 0x10, 
-0x84, 0x00, 0x27, 0x28, 0x22, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x11, 0x84, 0x00, 0x2c, 
-0x33, 0x3c, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x12, 0x84, 0x00, 0x2e, 0x34, 0x3e, 0x34, 
-0x00, 0x34, 0x00, 0x34, 0x00, 0x34, 0x13, 0xc4, 0x00, 0x70, 0x19, 0x50, 0x19, 0x10, 0x19, 0x00, 
-0x19, 0x00, 0x19, 0x14, 0xc4, 0x00, 0x79, 0x15, 0x59, 0x15, 0x19, 0x15, 0x00, 0x15, 0x00, 0x15, 
-0x15, 0xc4, 0x00, 0x66, 0x21, 0x46, 0x21, 0x06, 0x21, 0x00, 0x21, 0x00, 0x21, 0x16, 0xc4, 0x00, 
-0x67, 0x22, 0x47, 0x22, 0x07, 0x22, 0x00, 0x22, 0x00, 0x22, 0x17, 0xc4, 0x00, 0x63, 0x2e, 0x43, 
-0x2e, 0x03, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x18, 0xc4, 0x00, 0x72, 0x13, 0x52, 0x13, 0x12, 0x13, 
-0x00, 0x13, 0x00, 0x13, 0x19, 0xc4, 0x00, 0x6c, 0x26, 0x4c, 0x26, 0x0c, 0x26, 0x00, 0x26, 0x00, 
-0x26, 0x1a, 0x84, 0x00, 0x2f, 0x35, 0x3f, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x1b, 0x84, 
-0x00, 0x3d, 0x0d, 0x2b, 0x0d, 0x00, 0x0d, 0x00, 0x83, 0x00, 0x83, 0x1f, 0xc4, 0x00, 0x6f, 0x18, 
-0x4f, 0x18, 0x0f, 0x18, 0x00, 0x18, 0x00, 0x18, 0x20, 0xc4, 0x00, 0x65, 0x12, 0x45, 0x12, 0x05, 
-0x12, 0x00, 0x12, 0x00, 0x12, 0x21, 0xc4, 0x00, 0x75, 0x16, 0x55, 0x16, 0x15, 0x16, 0x00, 0x16, 
-0x00, 0x16, 0x22, 0xc4, 0x00, 0x69, 0x17, 0x49, 0x17, 0x09, 0x17, 0x00, 0x17, 0x00, 0x17, 0x23, 
-0xc4, 0x00, 0x64, 0x20, 0x44, 0x20, 0x04, 0x20, 0x00, 0x20, 0x00, 0x20, 0x24, 0xc4, 0x00, 0x68, 
-0x23, 0x48, 0x23, 0x08, 0x23, 0x00, 0x23, 0x00, 0x23, 0x25, 0xc4, 0x00, 0x74, 0x14, 0x54, 0x14, 
-0x14, 0x14, 0x00, 0x14, 0x00, 0x14, 0x26, 0xc4, 0x00, 0x6e, 0x31, 0x4e, 0x31, 0x0e, 0x31, 0x00, 
-0x31, 0x00, 0x31, 0x27, 0xc4, 0x00, 0x73, 0x1f, 0x53, 0x1f, 0x13, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 
-0x28, 0x84, 0x00, 0x2d, 0x0c, 0x5f, 0x0c, 0x1f, 0x0c, 0x00, 0x82, 0x00, 0x82, 0x2c, 0x84, 0x00, 
-0x3b, 0x27, 0x3a, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x2d, 0xc4, 0x00, 0x71, 0x10, 0x51, 
-0x10, 0x11, 0x10, 0x00, 0x10, 0x00, 0x10, 0x2e, 0xc4, 0x00, 0x6a, 0x24, 0x4a, 0x24, 0x0a, 0x24, 
-0x00, 0x24, 0x00, 0x24, 0x2f, 0xc4, 0x00, 0x6b, 0x25, 0x4b, 0x25, 0x0b, 0x25, 0x00, 0x25, 0x00, 
-0x25, 0x30, 0xc4, 0x00, 0x78, 0x2d, 0x58, 0x2d, 0x18, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x31, 0xc4, 
-0x00, 0x62, 0x30, 0x42, 0x30, 0x02, 0x30, 0x00, 0x30, 0x00, 0x30, 0x33, 0xc4, 0x00, 0x77, 0x11, 
-0x57, 0x11, 0x17, 0x11, 0x00, 0x11, 0x00, 0x11, 0x34, 0xc4, 0x00, 0x76, 0x2f, 0x56, 0x2f, 0x16, 
-0x2f, 0x00, 0x2f, 0x00, 0x2f, 0x35, 0xc4, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 
-0x00, 0x2c, 0x00, 0x20, 0xc4, 0x00, 0x65, 0x12, 0x45, 0x12, 0x05, 0x12, 0xd5, 0x12, 0x00, 0x12, 
-0x00, 0x9d, 0xdb, 0x02, 0x09, 0x00, 0x00, 0x46, 0x52, 0x2c, 0xbd, 0x00, 0x46, 0x52, 0x06, 0x04, 
-0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xa0, 0x01, 0xa7, 0x01, 
-0x00, 0x00, 0x5b, 0x03, 0x02, 0x02, 0x3f, 0x02, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0xa7, 0x01, 
-0x00, 0x00, 0xb5, 0x01, 0x54, 0x01, 0x65, 0x01, 0x00, 0x00, 0x45, 0x75, 0x9c, 0x02, 0xb8, 0x02, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0x41, 0x00, 0x26, 0x31, 0x03, 0x42, 0x04, 0x82, 0x32, 0xc9, 0x04, 0x42, 0x00, 
-0x22, 0x33, 0x23, 0x05, 0x42, 0x00, 0x27, 0x34, 0x7b, 0x06, 0x43, 0x00, 0x28, 0x35, 0x5b, 0x1b, 
-0x07, 0x43, 0x00, 0x2d, 0x36, 0x7c, 0x1f, 0x08, 0x42, 0x04, 0x8a, 0x37, 0xc8, 0x09, 0x43, 0x00, 
-0x5f, 0x38, 0x5c, 0x1c, 0x0a, 0x42, 0x00, 0x87, 0x39, 0x5e, 0x0b, 0x42, 0x00, 0x85, 0x30, 0x40, 
-0x0c, 0x43, 0x00, 0x29, 0xf8, 0x5d, 0x1d, 0x0d, 0x42, 0x03, 0x00, 0x00, 0x7d, 0x10, 0xc5, 0x00, 
-0x61, 0x1e, 0x41, 0x1e, 0x00, 0x1e, 0x01, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x11, 0xc5, 0x00, 0x7a, 
-0x2c, 0x5a, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x12, 0x41, 0x00, 0x65, 0x45, 
-0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 
-0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x43, 0x07, 0xca, 0xcb, 0x00, 0x1e, 0x1b, 0x42, 0x00, 0x24, 0x9c, 
-0xcf, 0x1e, 0xc5, 0x00, 0x71, 0x10, 0x51, 0x10, 0x00, 0x10, 0x11, 0x10, 0x00, 0x10, 0x00, 0x10, 
-0x27, 0xc5, 0x00, 0x6d, 0x32, 0x4d, 0x32, 0x00, 0x32, 0x0d, 0x32, 0x00, 0x32, 0x00, 0x32, 0x28, 
-0x41, 0x00, 0x97, 0x25, 0x29, 0x41, 0x00, 0xfd, 0xfc, 0x2b, 0x41, 0x00, 0x2a, 0xe6, 0x2c, 0xc5, 
-0x00, 0x77, 0x11, 0x57, 0x11, 0x00, 0x11, 0x17, 0x11, 0x00, 0x11, 0x00, 0x11, 0x31, 0x41, 0x00, 
-0x6e, 0x4e, 0x32, 0x41, 0x00, 0x2c, 0x3f, 0x33, 0x42, 0x00, 0x3b, 0x2e, 0x3c, 0x34, 0x42, 0x00, 
-0x3a, 0x2f, 0x3e, 0x35, 0x41, 0x00, 0x21, 0xf5, 0x39, 0x00, 0x00, 0x20, 0x56, 0x41, 0x00, 0x3c, 
-0x3e, 0x00, 0x1b, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x29, 0x41, 0x03, 0x00, 0xa0, 0x35, 0x41, 0x01, 
-0x00, 0x15, 0x00, 0x60, 0x06, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x20, 
-0x60, 0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x06, 0x61, 0x83, 0x65, 0x88, 0x69, 
-0x8c, 0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 0x22, 0x0a, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 
-0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x00, 0x12, 0x42, 
-0x03, 0x00, 0x00, 0xd5, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 
-0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 
-0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 
-0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 
-0xe2, 0x55, 0xea, 0x20, 0x5e, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 
-0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0x00, 
-0x10, 0xc5, 0x00, 0x61, 0x1e, 0x41, 0x1e, 0x91, 0x1e, 0x01, 0x1e, 0x92, 0x1e, 0x00, 0x1e, 0x12, 
-0x44, 0x0b, 0x00, 0x00, 0xd5, 0x00, 0x90, 0x18, 0x44, 0x0b, 0x00, 0x00, 0xab, 0x00, 0xac, 0x2c, 
-0xc5, 0x00, 0x77, 0x11, 0x57, 0x11, 0xae, 0x11, 0x17, 0x11, 0x00, 0x11, 0x00, 0x11, 0x2d, 0x42, 
-0x03, 0x00, 0x00, 0xaf, 0x2e, 0x44, 0x0b, 0x00, 0x00, 0x87, 0x00, 0x80, 0x00, 0x60, 0x0b, 0x61, 
-0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 
-0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 
-0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 
-0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0x22, 0x0d, 0x61, 
-0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 
-0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x00, 0x03, 0x42, 0x07, 0x00, 0x00, 0xa0, 
-0x08, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x1a, 0x41, 0x03, 0xc8, 
-0xa0, 0x29, 0x10, 0x00, 0x00, 0x00, 0x5e, 0x0b, 0x61, 0xee, 0x65, 0xd0, 0x69, 0xf6, 0x6f, 0xfa, 
-0x75, 0xfc, 0x41, 0xef, 0x45, 0xd1, 0x49, 0xf7, 0x4f, 0xfb, 0x55, 0xfd, 0x20, 0x5e, 0x00, 0xff, 
-0x3c, 0x05, 0x13, 0x00, 0x00, 0x47, 0x52, 0x2c, 0x00, 0x00, 0x44, 0x45, 0x2c, 0x81, 0x00, 0x47, 
-0x52, 0x2c, 0x81, 0x00, 0x44, 0x45, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x5a, 0x03, 0x4f, 0x01, 0x56, 0x01, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x56, 0x01, 
-0x00, 0x00, 0x5b, 0x03, 0xa7, 0x01, 0xeb, 0x01, 0x00, 0x00, 0xb5, 0x01, 0x40, 0x02, 0x47, 0x02, 
-0x00, 0x00, 0x54, 0x03, 0x78, 0x02, 0xfc, 0x02, 0x00, 0x00, 0x55, 0x03, 0x5d, 0x03, 0x7a, 0x03, 
-0x00, 0x00, 0x39, 0x75, 0x97, 0x03, 0x03, 0x04, 0x00, 0x00, 0x44, 0x75, 0x58, 0x04, 0x93, 0x04, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x7c, 0x03, 0x02, 0x01, 0x00, 0x22, 0xfd, 0x04, 0x02, 
-0x01, 0x00, 0xf5, 0xfc, 0x07, 0x01, 0x01, 0x00, 0x26, 0x08, 0x02, 0x01, 0x00, 0x2f, 0x7b, 0x09, 
-0x04, 0x09, 0x00, 0x28, 0x5b, 0x00, 0x1b, 0x0a, 0x04, 0x09, 0x00, 0x29, 0x5d, 0x00, 0x1d, 0x0b, 
-0x02, 0x01, 0x00, 0x3d, 0x7d, 0x0c, 0x04, 0x08, 0xe1, 0x3f, 0x5c, 0x00, 0x1c, 0x0d, 0x01, 0x03, 
-0xca, 0xc8, 0x10, 0x42, 0x03, 0x00, 0x00, 0x40, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0xc5, 0x00, 
-0x7a, 0x2c, 0x5a, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0x75, 
-0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x41, 0x00, 0x81, 0x9a, 
-0x1b, 0x02, 0x00, 0x2b, 0x2a, 0x7e, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x27, 0x41, 0x00, 0x94, 0x99, 
-0x28, 0x41, 0x00, 0x84, 0x8e, 0x29, 0x04, 0x0d, 0xc9, 0xf8, 0x00, 0x00, 0x1e, 0x2b, 0x01, 0x00, 
-0x23, 0x27, 0x2c, 0xc5, 0x00, 0x79, 0x15, 0x59, 0x15, 0x3c, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 
-0x15, 0x2d, 0x42, 0x03, 0x00, 0x00, 0x3e, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x31, 0x42, 0x03, 0x00, 
-0x00, 0x23, 0x32, 0x42, 0x03, 0x00, 0x00, 0xe6, 0x33, 0x01, 0x01, 0x00, 0x3b, 0x34, 0x01, 0x01, 
-0x00, 0x3a, 0x35, 0x04, 0x0c, 0x2d, 0x5f, 0x00, 0x00, 0x1f, 0x39, 0x00, 0x00, 0x20, 0x56, 0x02, 
-0x00, 0x3c, 0x3e, 0x7c, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x60, 0x0b, 0x61, 0x85, 
-0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 
-0x55, 0xeb, 0x20, 0x60, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 
-0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 0x0f, 0x61, 0xa0, 
-0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x43, 0x80, 
-0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0x00, 0x03, 0x01, 0x03, 
-0x00, 0xcb, 0x09, 0x03, 0x07, 0x00, 0x00, 0x00, 0xae, 0x0a, 0x03, 0x07, 0x00, 0x00, 0x00, 0xaf, 
-0x12, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x18, 0x03, 0x03, 0x00, 0x00, 0xab, 0xac, 0x1e, 0x03, 0x03, 
-0x00, 0x00, 0x86, 0x8f, 0x27, 0x03, 0x03, 0x00, 0x00, 0x9b, 0x9d, 0x28, 0x03, 0x03, 0x00, 0x00, 
-0x91, 0x92, 0x2e, 0x03, 0x03, 0x00, 0x00, 0x87, 0x80, 0x31, 0x03, 0x03, 0x00, 0x00, 0xa4, 0xa5, 
-0x00, 0x60, 0x07, 0x61, 0x85, 0x65, 0x8a, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x55, 0xeb, 0x20, 
-0x60, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 
-0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0x27, 0x07, 0x61, 0xa0, 0x65, 0x82, 0x6f, 
-0xa2, 0x41, 0xb5, 0x45, 0x90, 0x4f, 0xe0, 0x20, 0x27, 0x22, 0x0d, 0x61, 0x84, 0x65, 0x89, 0x69, 
-0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 
-0x9a, 0x59, 0xf3, 0x20, 0x22, 0x00, 0x04, 0x02, 0x05, 0x00, 0x15, 0xa0, 0x00, 0x60, 0x06, 0x61, 
-0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x20, 0x60, 0x5e, 0x06, 0x61, 0x83, 0x65, 
-0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 0x27, 0x09, 0x61, 0xa0, 0x63, 0x87, 0x65, 
-0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x43, 0x80, 0x45, 0x90, 0x20, 0x27, 0x00, 0x03, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x02, 0x03, 0x00, 0x00, 0xaa, 
-0x09, 0x03, 0x07, 0x00, 0x00, 0x00, 0xae, 0x0a, 0x03, 0x07, 0x00, 0x00, 0x00, 0xaf, 0x0d, 0x01, 
-0x03, 0xc8, 0xa0, 0x12, 0x03, 0x03, 0x00, 0x00, 0xa9, 0xa8, 0x13, 0x41, 0x00, 0x72, 0x52, 0x14, 
-0x41, 0x00, 0x74, 0x54, 0x15, 0xc5, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0xbe, 0x2c, 0xbd, 0x2c, 0x1a, 
-0x2c, 0x00, 0x2c, 0x16, 0x03, 0x03, 0x00, 0x00, 0xfb, 0xeb, 0x17, 0x03, 0x03, 0x00, 0x00, 0x85, 
-0xde, 0x18, 0x03, 0x03, 0x00, 0x00, 0x8b, 0x8a, 0x1e, 0x03, 0x03, 0x00, 0x00, 0xa5, 0xa4, 0x1f, 
-0x41, 0x00, 0x73, 0x53, 0x20, 0x43, 0x00, 0x64, 0x44, 0xd0, 0xd1, 0x26, 0x43, 0x00, 0x6c, 0x4c, 
-0x88, 0x9d, 0x29, 0x00, 0x01, 0xc9, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x32, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x00, 0xef, 0x19, 0x61, 0xa0, 0x63, 0x86, 0x65, 0x82, 0x69, 0xa1, 0x6c, 0x92, 0x6e, 0xe4, 
-0x6f, 0xa2, 0x72, 0xea, 0x73, 0x98, 0x75, 0xa3, 0x79, 0xec, 0x7a, 0xab, 0x41, 0xb5, 0x43, 0x8f, 
-0x45, 0x90, 0x49, 0xd6, 0x4c, 0x91, 0x4e, 0xe3, 0x4f, 0xe0, 0x52, 0xe8, 0x53, 0x97, 0x55, 0xe9, 
-0x59, 0xed, 0x5a, 0x8d, 0x20, 0xef, 0x5e, 0x15, 0x63, 0x9f, 0x64, 0xd4, 0x65, 0xd8, 0x6c, 0x96, 
-0x6e, 0xe5, 0x6f, 0x93, 0x72, 0xfd, 0x73, 0xe7, 0x74, 0x9c, 0x7a, 0xa7, 0x43, 0xac, 0x44, 0xd2, 
-0x45, 0xb7, 0x4c, 0x95, 0x4e, 0xd5, 0x4f, 0xe2, 0x52, 0xfc, 0x53, 0xe6, 0x54, 0x9b, 0x5a, 0xa6, 
-0x20, 0x5e, 0x00, 0x0d, 0x10, 0x00, 0x00, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x22, 0x41, 0x00, 0x67, 
-0x47, 0x23, 0x41, 0x00, 0x68, 0x48, 0x24, 0x41, 0x00, 0x6a, 0x4a, 0x29, 0x00, 0x01, 0xc8, 0x00, 
-0x5e, 0x0d, 0x63, 0x86, 0x67, 0x9b, 0x68, 0xa9, 0x6a, 0x9f, 0x73, 0xc7, 0x75, 0xed, 0x43, 0x8f, 
-0x47, 0x9d, 0x48, 0xa8, 0x4a, 0xac, 0x53, 0xc6, 0x55, 0xec, 0x20, 0x5e, 0x00, 0x03, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0c, 0x00, 0x01, 0xa0, 0x0d, 0x00, 0x01, 
-0xc8, 0x12, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x13, 0x41, 0x00, 0x72, 0x52, 0x14, 0x41, 0x00, 0x74, 
-0x54, 0x17, 0x03, 0x03, 0x00, 0x00, 0x8b, 0xd8, 0x19, 0x41, 0x00, 0x70, 0x50, 0x1e, 0x03, 0x03, 
-0x00, 0x00, 0xc6, 0xc7, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x20, 0x41, 0x00, 0x64, 0x44, 0x22, 0x41, 
-0x00, 0x67, 0x47, 0x23, 0x41, 0x00, 0x68, 0x48, 0x25, 0x41, 0x00, 0x6b, 0x4b, 0x26, 0x41, 0x00, 
-0x6c, 0x4c, 0x28, 0x03, 0x03, 0x00, 0x00, 0x91, 0x92, 0x29, 0x00, 0x01, 0xc9, 0x31, 0x41, 0x00, 
-0x6e, 0x4e, 0x32, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x00, 0xef, 0x0b, 0x63, 0x86, 0x67, 0xd0, 0x72, 
-0xe8, 0x73, 0xfa, 0x7a, 0xaa, 0x43, 0x8f, 0x47, 0xd1, 0x52, 0xf6, 0x53, 0xfb, 0x5a, 0xab, 0x20, 
-0xef, 0x5e, 0x1d, 0x63, 0xac, 0x64, 0x8a, 0x65, 0x88, 0x67, 0xdd, 0x68, 0xbd, 0x69, 0x8c, 0x6b, 
-0x85, 0x6c, 0xf2, 0x6e, 0xe4, 0x70, 0x9d, 0x72, 0xfd, 0x73, 0xe7, 0x74, 0x9c, 0x7a, 0xa8, 0x43, 
-0xad, 0x44, 0xd4, 0x45, 0xd2, 0x47, 0xde, 0x48, 0xbe, 0x49, 0xd7, 0x4b, 0xb7, 0x4c, 0xf1, 0x4e, 
-0xe5, 0x50, 0xe1, 0x52, 0xfc, 0x53, 0xe6, 0x54, 0x9b, 0x5a, 0xa9, 0x20, 0x5e, 0x00, 0x02, 0x02, 
-0x07, 0x00, 0x00, 0xcc, 0x03, 0x01, 0x03, 0x00, 0xcb, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x17, 
-0x43, 0x03, 0x00, 0x00, 0x9e, 0x9f, 0x18, 0x43, 0x03, 0x00, 0x00, 0xab, 0xac, 0x1b, 0x02, 0x07, 
-0x00, 0x00, 0xcd, 0x1e, 0x43, 0x03, 0x00, 0x00, 0x86, 0x8f, 0x27, 0x43, 0x03, 0x00, 0x00, 0x9b, 
-0x9d, 0x28, 0x43, 0x03, 0x00, 0x00, 0x91, 0x92, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 
-0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 
-0x60, 0x5e, 0x0d, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x79, 0xbd, 0x41, 
-0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x59, 0xbe, 0x20, 0x5e, 0x27, 0x0d, 0x61, 
-0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 
-0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0x27, 0x22, 0x0d, 0x61, 0x84, 0x65, 0x89, 0x69, 
-0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 
-0x9a, 0x59, 0xf3, 0x20, 0x22, 0x7c, 0x0b, 0x61, 0x87, 0x65, 0xd0, 0x69, 0xe7, 0x6f, 0xf9, 0x75, 
-0xf7, 0x41, 0x80, 0x45, 0xd1, 0x49, 0xe8, 0x4f, 0xdd, 0x55, 0xef, 0x20, 0x7c, 0x7e, 0x07, 0x65, 
-0xc6, 0x6f, 0xa4, 0x94, 0xe4, 0x45, 0xc7, 0x4f, 0xa5, 0x99, 0xe5, 0x20, 0x7e, 0x00, 0xc8, 0xc6, 
-0x08, 0x09, 0xc5, 0x01, 0x47, 0x52, 0x2c, 0xc5, 0x01, 0x44, 0x45, 0x0c, 0x04, 0x00, 0x00, 0x00, 
-0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0x5d, 0x01, 0x75, 0x03, 0x00, 0x00, 0x5a, 
-0x03, 0x6c, 0x01, 0x75, 0x03, 0x00, 0x00, 0x52, 0x03, 0x6c, 0x02, 0x75, 0x03, 0x00, 0x00, 0x52, 
-0x03, 0x75, 0x02, 0x75, 0x03, 0x00, 0x00, 0xb5, 0x01, 0xfc, 0x03, 0x05, 0x05, 0x00, 0x00, 0xb5, 
-0x01, 0x0a, 0x04, 0x05, 0x05, 0x00, 0x00, 0x54, 0x03, 0x01, 0x06, 0x7b, 0x06, 0x00, 0x00, 0x55, 
-0x03, 0xdc, 0x06, 0x03, 0x07, 0x00, 0x00, 0x5b, 0x03, 0x60, 0x05, 0x9c, 0x05, 0x00, 0x00, 0x39, 
-0x75, 0x20, 0x07, 0x91, 0x07, 0x00, 0x00, 0x44, 0x75, 0xe6, 0x07, 0x27, 0x08, 0x00, 0x00, 0x00, 
-0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-0x02, 0x03, 0x00, 0x00, 0x7c, 0x03, 0x02, 0x01, 0x00, 0x22, 0xfd, 0x04, 0x02, 0x01, 0x00, 0xf5, 
-0xfc, 0x07, 0x01, 0x01, 0x00, 0x26, 0x08, 0x02, 0x01, 0x00, 0x2f, 0x7b, 0x09, 0x04, 0x09, 0x00, 
-0x28, 0x5b, 0x00, 0x1b, 0x0a, 0x04, 0x09, 0x00, 0x29, 0x5d, 0x00, 0x1d, 0x0b, 0x02, 0x01, 0x00, 
-0x3d, 0x7d, 0x0c, 0x04, 0x08, 0xe1, 0x3f, 0x5c, 0x00, 0x1c, 0x0d, 0x02, 0x07, 0xcb, 0xc8, 0xce, 
-0x10, 0x42, 0x03, 0x00, 0x00, 0x40, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0xc5, 0x00, 0x7a, 0x2c, 
-0x5a, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 
-0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x41, 0x00, 0x81, 0x9a, 0x1b, 0x02, 
-0x04, 0x2b, 0x2a, 0xc9, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x27, 0x41, 0x00, 0x94, 0x99, 0x28, 0x41, 
-0x00, 0x84, 0x8e, 0x29, 0x04, 0x0c, 0x27, 0xf8, 0xca, 0x00, 0x1e, 0x2c, 0xc5, 0x00, 0x79, 0x15, 
-0x59, 0x15, 0x3c, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 0x42, 0x03, 0x00, 0x00, 0x3e, 
-0x2e, 0x41, 0x00, 0x63, 0x43, 0x31, 0x42, 0x00, 0x6e, 0x4e, 0x23, 0x32, 0x42, 0x03, 0x00, 0x00, 
-0xe6, 0x33, 0x01, 0x01, 0x00, 0x3b, 0x34, 0x01, 0x01, 0x00, 0x3a, 0x35, 0x04, 0x0c, 0x2d, 0x5f, 
-0x00, 0x00, 0x1f, 0x39, 0x00, 0x00, 0x20, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x2a, 0x04, 
-0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x02, 0x01, 0x00, 0xfb, 0xad, 0x03, 0x01, 0x02, 0xfd, 
-0xa0, 0x04, 0x01, 0x00, 0xfc, 0x9c, 0x05, 0x01, 0x00, 0xac, 0xcf, 0x06, 0x01, 0x02, 0xab, 0xa0, 
-0x07, 0x01, 0x02, 0xf3, 0xa0, 0x08, 0x01, 0x02, 0x7b, 0xa0, 0x09, 0x01, 0x02, 0x5b, 0xa0, 0x0a, 
-0x01, 0x00, 0x5d, 0xf1, 0x0b, 0x01, 0x00, 0x7d, 0xf8, 0x0c, 0x01, 0x00, 0x5c, 0xa8, 0x0d, 0x01, 
-0x03, 0xce, 0xa0, 0x10, 0x01, 0x02, 0x40, 0xa0, 0x11, 0x10, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 
-0x13, 0x01, 0x00, 0xf4, 0xa9, 0x14, 0x41, 0x00, 0xe7, 0xe8, 0x15, 0x85, 0x02, 0xbe, 0x2c, 0xa0, 
-0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x10, 0x00, 0x00, 0x17, 0x10, 0x00, 
-0x00, 0x18, 0x41, 0x00, 0x9b, 0x9d, 0x19, 0x10, 0x00, 0x00, 0x1a, 0x01, 0x03, 0xcc, 0xcd, 0x1b, 
-0x01, 0x01, 0xc9, 0xee, 0x1e, 0x41, 0x00, 0x91, 0x92, 0x1f, 0x01, 0x00, 0xe1, 0xf5, 0x20, 0x41, 
-0x00, 0xd0, 0xd1, 0x21, 0x01, 0x02, 0xa6, 0xa0, 0x22, 0x10, 0x00, 0x00, 0x23, 0x10, 0x00, 0x00, 
-0x24, 0x10, 0x00, 0x00, 0x25, 0x01, 0x02, 0x26, 0xa0, 0x26, 0x01, 0x03, 0xc8, 0xa0, 0x27, 0x01, 
-0x03, 0xcb, 0xa0, 0x28, 0x01, 0x03, 0xca, 0xa0, 0x29, 0x01, 0x00, 0xaa, 0xdd, 0x2b, 0x10, 0x00, 
-0x00, 0x2c, 0x85, 0x00, 0xae, 0x15, 0x3c, 0x15, 0x3c, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 
-0x2d, 0x01, 0x00, 0xaf, 0x3e, 0x2e, 0x01, 0x00, 0xbd, 0xb8, 0x2f, 0x10, 0x00, 0x00, 0x30, 0x10, 
-0x00, 0x00, 0x31, 0x01, 0x02, 0x23, 0xa0, 0x32, 0x01, 0x00, 0xe6, 0xa7, 0x33, 0x01, 0x02, 0x9e, 
-0xa0, 0x34, 0x01, 0x00, 0xfa, 0xf6, 0x35, 0x10, 0x00, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x78, 0x56, 0x10, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 
-0x02, 0x01, 0x00, 0xfb, 0xad, 0x03, 0x01, 0x02, 0xfd, 0xa0, 0x04, 0x01, 0x00, 0xfc, 0x9c, 0x05, 
-0x01, 0x00, 0xac, 0xcf, 0x06, 0x01, 0x02, 0xab, 0xa0, 0x07, 0x01, 0x02, 0xf3, 0xa0, 0x08, 0x01, 
-0x02, 0x7b, 0xa0, 0x09, 0x01, 0x02, 0x5b, 0xa0, 0x0a, 0x01, 0x00, 0x5d, 0xf1, 0x0b, 0x01, 0x00, 
-0x7d, 0xf8, 0x0c, 0x01, 0x00, 0x5c, 0xa8, 0x0d, 0x01, 0x03, 0xce, 0xa0, 0x10, 0x01, 0x02, 0x40, 
-0xa0, 0x11, 0x10, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x13, 0x01, 0x00, 0xf4, 0xa9, 0x14, 0x41, 
-0x00, 0xe7, 0xe8, 0x15, 0x85, 0x02, 0xbe, 0x2c, 0xa0, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 
-0x00, 0x2c, 0x16, 0x10, 0x00, 0x00, 0x17, 0x10, 0x00, 0x00, 0x18, 0x41, 0x00, 0x9b, 0x9d, 0x19, 
-0x10, 0x00, 0x00, 0x1a, 0x01, 0x03, 0xcc, 0xcd, 0x1b, 0x01, 0x01, 0xc9, 0xee, 0x1e, 0x41, 0x00, 
-0x91, 0x92, 0x1f, 0x01, 0x00, 0xe1, 0xf5, 0x20, 0x41, 0x00, 0xd0, 0xd1, 0x21, 0x01, 0x02, 0xa6, 
-0xa0, 0x22, 0x10, 0x00, 0x00, 0x23, 0x10, 0x00, 0x00, 0x24, 0x10, 0x00, 0x00, 0x25, 0x01, 0x02, 
-0x26, 0xa0, 0x26, 0x01, 0x03, 0xc8, 0xa0, 0x27, 0x01, 0x03, 0xcb, 0xa0, 0x28, 0x01, 0x03, 0xca, 
-0xa0, 0x29, 0x01, 0x00, 0xaa, 0xdd, 0x2b, 0x10, 0x00, 0x00, 0x2c, 0x85, 0x00, 0xae, 0x15, 0x3c, 
-0x15, 0x3c, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 0x01, 0x00, 0xaf, 0x3e, 0x2e, 0x01, 
-0x00, 0xbd, 0xb8, 0x2f, 0x10, 0x00, 0x00, 0x30, 0x10, 0x00, 0x00, 0x31, 0x01, 0x02, 0x23, 0xa0, 
-0x32, 0x01, 0x00, 0xe6, 0xa7, 0x33, 0x01, 0x02, 0x9e, 0xa0, 0x34, 0x01, 0x00, 0xfa, 0xf6, 0x35, 
-0x10, 0x00, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x56, 0x10, 0x00, 0x00, 0x00, 
-0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 
-0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 
-0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 
-0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 
-0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 
-0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 
-0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 
-0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0xf8, 0x03, 0x61, 0x86, 0x41, 0x8f, 0x20, 0xf8, 0xf7, 0x03, 
-0x63, 0x87, 0x43, 0x80, 0x20, 0xf7, 0x00, 0x04, 0x01, 0x01, 0x00, 0x15, 0x2a, 0x04, 0x1f, 0x00, 
-0x00, 0x00, 0x00, 0x7d, 0x00, 0x02, 0x01, 0x01, 0xa0, 0xad, 0x03, 0x01, 0x02, 0xfd, 0xa0, 0x04, 
-0x01, 0x01, 0xa0, 0x9c, 0x05, 0x01, 0x02, 0xac, 0xa0, 0x06, 0x01, 0x02, 0xab, 0xa0, 0x07, 0x10, 
-0x00, 0x00, 0x08, 0x01, 0x02, 0x7b, 0xa0, 0x09, 0x01, 0x02, 0x5b, 0xa0, 0x0a, 0x01, 0x00, 0x5d, 
-0xf1, 0x0b, 0x01, 0x00, 0x7d, 0xf8, 0x0c, 0x01, 0x00, 0x5c, 0xa8, 0x0d, 0x01, 0x03, 0xce, 0xa0, 
-0x10, 0x01, 0x02, 0x40, 0xa0, 0x11, 0x10, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x13, 0x01, 0x02, 
-0x14, 0xa0, 0x14, 0x10, 0x00, 0x00, 0x15, 0x85, 0x02, 0x9d, 0x2c, 0xa0, 0x2c, 0x00, 0x2c, 0x00, 
-0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x10, 0x00, 0x00, 0x17, 0x10, 0x00, 0x00, 0x18, 0x10, 0x00, 
-0x00, 0x19, 0x10, 0x00, 0x00, 0x1a, 0x01, 0x03, 0xcc, 0xcd, 0x1b, 0x01, 0x03, 0xc9, 0xa0, 0x1e, 
-0x41, 0x00, 0x91, 0x92, 0x1f, 0x01, 0x00, 0xe1, 0x15, 0x20, 0x10, 0x00, 0x00, 0x21, 0x01, 0x02, 
-0xa6, 0xa0, 0x22, 0x10, 0x00, 0x00, 0x23, 0x10, 0x00, 0x00, 0x24, 0x10, 0x00, 0x00, 0x25, 0x01, 
-0x02, 0x26, 0xa0, 0x26, 0x01, 0x03, 0xc8, 0xa0, 0x27, 0x01, 0x03, 0xcb, 0xa0, 0x28, 0x01, 0x03, 
-0xca, 0xa0, 0x29, 0x01, 0x02, 0xaa, 0xa0, 0x2b, 0x10, 0x00, 0x00, 0x2c, 0x85, 0x00, 0xae, 0x15, 
-0x3c, 0x15, 0x3c, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 0x01, 0x00, 0xaf, 0x3e, 0x2e, 
-0x01, 0x02, 0x9b, 0xa0, 0x2f, 0x10, 0x00, 0x00, 0x30, 0x10, 0x00, 0x00, 0x31, 0x01, 0x02, 0x23, 
-0xa0, 0x32, 0x01, 0x00, 0xe6, 0xa7, 0x33, 0x10, 0x00, 0x00, 0x34, 0x01, 0x00, 0xfa, 0xf6, 0x35, 
-0x10, 0x00, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x56, 0x10, 0x00, 0x00, 0x00, 
-0x60, 0x06, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x20, 0x60, 0x7e, 0x03, 
-0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x06, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 
-0x75, 0x96, 0x20, 0x5e, 0x27, 0x07, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 
-0x45, 0x90, 0x20, 0x27, 0x22, 0x0a, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 
-0x79, 0x98, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0xf8, 0x03, 0x61, 0x86, 0x41, 0x8f, 
-0x20, 0xf8, 0x2c, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0x2c, 0x00, 0x03, 0x01, 0x03, 0x00, 0xcc, 
-0x09, 0x03, 0x07, 0x00, 0x00, 0x00, 0xae, 0x0a, 0x03, 0x07, 0x00, 0x00, 0x00, 0xaf, 0x0d, 0x02, 
-0x07, 0x00, 0x00, 0xcd, 0x12, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x18, 0x03, 0x03, 0x00, 0x00, 0xab, 
-0xac, 0x1e, 0x03, 0x03, 0x00, 0x00, 0x86, 0x8f, 0x27, 0x03, 0x03, 0x00, 0x00, 0x9b, 0x9d, 0x28, 
-0x03, 0x03, 0x00, 0x00, 0x91, 0x92, 0x00, 0x60, 0x07, 0x61, 0x85, 0x65, 0x8a, 0x75, 0x97, 0x41, 
-0xb7, 0x45, 0xd4, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 
-0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 
-0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0x27, 0x07, 0x61, 0xa0, 0x65, 0x82, 0x6f, 0xa2, 0x41, 
-0xb5, 0x45, 0x90, 0x4f, 0xe0, 0x20, 0x27, 0x22, 0x0d, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 
-0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x59, 
-0xf3, 0x20, 0x22, 0x2c, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0x2c, 0x00, 0x03, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x02, 0x03, 0x00, 0x00, 0xaa, 0x0d, 0x02, 
-0x07, 0xc8, 0xc9, 0xa0, 0x12, 0x03, 0x03, 0x00, 0x00, 0xa9, 0xa8, 0x13, 0x41, 0x00, 0x72, 0x52, 
-0x14, 0x41, 0x00, 0x74, 0x54, 0x15, 0xc5, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0xbe, 0x2c, 0xbd, 0x2c, 
-0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x03, 0x03, 0x00, 0x00, 0xfb, 0xeb, 0x17, 0x03, 0x03, 0x00, 0x00, 
-0x85, 0xde, 0x18, 0x03, 0x03, 0x00, 0x00, 0x8b, 0x8a, 0x1b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x1e, 
-0x03, 0x03, 0x00, 0x00, 0xa5, 0xa4, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x20, 0x43, 0x00, 0x64, 0x44, 
-0xd0, 0xd1, 0x26, 0x43, 0x00, 0x6c, 0x4c, 0x88, 0x9d, 0x29, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x32, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x00, 0xef, 0x19, 0x61, 0xa0, 0x63, 0x86, 0x65, 0x82, 0x69, 0xa1, 
-0x6c, 0x92, 0x6e, 0xe4, 0x6f, 0xa2, 0x72, 0xea, 0x73, 0x98, 0x75, 0xa3, 0x79, 0xec, 0x7a, 0xab, 
-0x41, 0xb5, 0x43, 0x8f, 0x45, 0x90, 0x49, 0xd6, 0x4c, 0x91, 0x4e, 0xe3, 0x4f, 0xe0, 0x52, 0xe8, 
-0x53, 0x97, 0x55, 0xe9, 0x59, 0xed, 0x5a, 0x8d, 0x20, 0xef, 0x60, 0x15, 0x63, 0x9f, 0x64, 0xd4, 
-0x65, 0xd8, 0x6c, 0x96, 0x6e, 0xe5, 0x6f, 0x93, 0x72, 0xfd, 0x73, 0xe7, 0x74, 0x9c, 0x7a, 0xa7, 
-0x43, 0xac, 0x44, 0xd2, 0x45, 0xb7, 0x4c, 0x95, 0x4e, 0xd5, 0x4f, 0xe2, 0x52, 0xfc, 0x53, 0xe6, 
-0x54, 0x9b, 0x5a, 0xa6, 0x20, 0x60, 0x00, 0x0d, 0x02, 0x07, 0xc8, 0xa0, 0xa0, 0x1b, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x22, 0x41, 0x00, 0x67, 0x47, 0x23, 0x41, 0x00, 
-0x68, 0x48, 0x24, 0x41, 0x00, 0x6a, 0x4a, 0x29, 0x02, 0x07, 0x00, 0x00, 0xc8, 0x00, 0x5e, 0x0d, 
-0x63, 0x86, 0x67, 0x9b, 0x68, 0xa9, 0x6a, 0x9f, 0x73, 0xc7, 0x75, 0xed, 0x43, 0x8f, 0x47, 0x9d, 
-0x48, 0xa8, 0x4a, 0xac, 0x53, 0xc6, 0x55, 0xec, 0x20, 0x5e, 0x00, 0x03, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0c, 0x00, 0x01, 0xa0, 0x0d, 0x02, 0x07, 0xc8, 0xc9, 
-0xa0, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x13, 0x41, 0x00, 0x72, 0x52, 0x14, 0x41, 0x00, 0x74, 
-0x54, 0x17, 0x43, 0x03, 0x00, 0x00, 0x8b, 0xd8, 0x19, 0x41, 0x00, 0x70, 0x50, 0x1b, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x1e, 0x43, 0x03, 0x00, 0x00, 0xc6, 0xc7, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x20, 
-0x41, 0x00, 0x64, 0x44, 0x22, 0x41, 0x00, 0x67, 0x47, 0x23, 0x41, 0x00, 0x68, 0x48, 0x25, 0x41, 
-0x00, 0x6b, 0x4b, 0x26, 0x41, 0x00, 0x6c, 0x4c, 0x28, 0x03, 0x03, 0x00, 0x00, 0x91, 0x92, 0x29, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x32, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x00, 0xef, 0x0b, 0x63, 0x86, 
-0x67, 0xd0, 0x72, 0xe8, 0x73, 0xfa, 0x7a, 0xaa, 0x43, 0x8f, 0x47, 0xd1, 0x52, 0xf6, 0x53, 0xfb, 
-0x5a, 0xab, 0x20, 0xef, 0x60, 0x1d, 0x63, 0xac, 0x64, 0x8a, 0x65, 0x88, 0x67, 0xdd, 0x68, 0xbd, 
-0x69, 0x8c, 0x6b, 0x85, 0x6c, 0xf2, 0x6e, 0xe4, 0x70, 0x9d, 0x72, 0xfd, 0x73, 0xe7, 0x74, 0x9c, 
-0x7a, 0xa8, 0x43, 0xad, 0x44, 0xd4, 0x45, 0xd2, 0x47, 0xde, 0x48, 0xbe, 0x49, 0xd7, 0x4b, 0xb7, 
-0x4c, 0xf1, 0x4e, 0xe5, 0x50, 0xe1, 0x52, 0xfc, 0x53, 0xe6, 0x54, 0x9b, 0x5a, 0xa9, 0x20, 0x60, 
-0x00, 0x03, 0x01, 0x03, 0x00, 0xcb, 0x0d, 0x02, 0x07, 0xca, 0x00, 0xcd, 0x12, 0x02, 0x03, 0x00, 
-0x00, 0xd5, 0x17, 0x43, 0x03, 0x00, 0x00, 0x9e, 0x9f, 0x18, 0x43, 0x03, 0x00, 0x00, 0xab, 0xac, 
-0x1b, 0x02, 0x07, 0x00, 0x00, 0xcc, 0x1e, 0x43, 0x03, 0x00, 0x00, 0x86, 0x8f, 0x27, 0x43, 0x03, 
-0x00, 0x00, 0x9b, 0x9d, 0x28, 0x43, 0x03, 0x00, 0x00, 0x91, 0x92, 0x29, 0x02, 0x07, 0x00, 0x00, 
-0xc9, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 
-0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x5e, 0x0d, 0x61, 0x83, 0x65, 0x88, 
-0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x79, 0xbd, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 
-0x55, 0xea, 0x59, 0xbe, 0x20, 0x5e, 0x27, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 
-0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 
-0x20, 0x27, 0x22, 0x0d, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 
-0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x7e, 0x0b, 
-0x61, 0x87, 0x65, 0xd0, 0x69, 0xe7, 0x6f, 0xf9, 0x75, 0xf7, 0x41, 0x80, 0x45, 0xd1, 0x49, 0xe8, 
-0x4f, 0xdd, 0x55, 0xef, 0x20, 0x7e, 0x2c, 0x07, 0x65, 0xc6, 0x6f, 0xa4, 0x94, 0xe4, 0x45, 0xc7, 
-0x4f, 0xa5, 0x99, 0xe5, 0x20, 0x2c, 0x00, 0xf4, 0xc5, 0x03, 0x04, 0x00, 0x00, 0x48, 0x55, 0x05, 
-0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x03, 0xd3, 0x01, 0x44, 
-0x02, 0x00, 0x00, 0x5a, 0x03, 0x45, 0x01, 0x4c, 0x01, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x4c, 
-0x01, 0x00, 0x00, 0xb5, 0xe1, 0x05, 0x03, 0x5f, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x00, 0xcc, 
-0xc8, 0x03, 0x01, 0x03, 0x00, 0xcd, 0x04, 0x03, 0x05, 0x00, 0x2b, 0xc9, 0x1e, 0x05, 0x01, 0x01, 
-0x00, 0x21, 0x06, 0x02, 0x07, 0x00, 0x00, 0xca, 0x07, 0x01, 0x01, 0x00, 0x2f, 0x08, 0x02, 0x05, 
-0x00, 0x3d, 0xcb, 0x09, 0x02, 0x01, 0x00, 0x28, 0xfa, 0x0a, 0x02, 0x01, 0x00, 0x29, 0xef, 0x0b, 
-0x41, 0x00, 0x94, 0x99, 0x0c, 0x42, 0x00, 0x81, 0x9a, 0xf9, 0x0d, 0xc2, 0x04, 0xa2, 0x0d, 0xe0, 
-0x00, 0xce, 0x83, 0x10, 0x42, 0x03, 0x00, 0x00, 0x5c, 0x11, 0x42, 0x03, 0x00, 0x00, 0x7c, 0x12, 
-0x42, 0x00, 0x65, 0x45, 0x8e, 0x13, 0x42, 0x03, 0x00, 0x00, 0xf5, 0x14, 0x42, 0x03, 0x00, 0x00, 
-0xcf, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x42, 0x00, 0x69, 0x49, 
-0xd6, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x42, 0x03, 0xa0, 0xa0, 0xf6, 0x1b, 0x42, 0x00, 0xa3, 
-0xe9, 0x9e, 0x1e, 0x42, 0x00, 0x61, 0x41, 0x84, 0x21, 0x42, 0x03, 0x00, 0x00, 0x5b, 0x22, 0x42, 
-0x03, 0x00, 0x00, 0x5d, 0x24, 0x42, 0x03, 0x00, 0x00, 0xa1, 0x27, 0x42, 0x00, 0x82, 0x90, 0x24, 
-0x28, 0x42, 0x00, 0xa0, 0xb5, 0xe1, 0x29, 0x42, 0x00, 0xa1, 0xd6, 0x30, 0x2b, 0x42, 0x03, 0xa0, 
-0xa0, 0x5c, 0x2c, 0x42, 0x00, 0x7a, 0x5a, 0x3e, 0x2d, 0x42, 0x03, 0x00, 0x00, 0x23, 0x2e, 0x42, 
-0x00, 0x63, 0x43, 0x26, 0x2f, 0x42, 0x03, 0x00, 0x00, 0x40, 0x30, 0x42, 0x03, 0x00, 0x00, 0x7b, 
-0x31, 0x42, 0x00, 0x6e, 0x4e, 0x7d, 0x32, 0x42, 0x03, 0x00, 0x00, 0x3c, 0x33, 0x02, 0x00, 0x2c, 
-0x3f, 0x3b, 0x34, 0x02, 0x00, 0x2e, 0x3a, 0x3e, 0x35, 0x03, 0x00, 0x2d, 0x5f, 0x2a, 0x1f, 0x39, 
-0x00, 0x00, 0x20, 0x00, 0x16, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 
-0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 
-0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 
-0xea, 0x20, 0x5e, 0xf8, 0x03, 0x61, 0x86, 0x41, 0x8f, 0x20, 0xf8, 0x60, 0x0b, 0x61, 0x85, 0x65, 
-0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 
-0xeb, 0x20, 0x60, 0x27, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 
-0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0x27, 0x22, 
-0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 
-0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0xf7, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 
-0xf7, 0x00, 0x02, 0x02, 0x03, 0x00, 0xce, 0x7e, 0x03, 0x02, 0x07, 0x00, 0xd0, 0xc8, 0x04, 0x01, 
-0x03, 0x00, 0xcf, 0x05, 0x02, 0x07, 0x00, 0x00, 0xca, 0x06, 0x02, 0x07, 0x00, 0x00, 0xcb, 0x07, 
-0x02, 0x07, 0x00, 0x00, 0xcc, 0x08, 0x02, 0x03, 0x00, 0x00, 0x60, 0x09, 0x02, 0x07, 0x00, 0x00, 
-0xcd, 0x0b, 0x42, 0x03, 0x00, 0x00, 0xf1, 0x0d, 0xc2, 0x05, 0x00, 0x0d, 0xe0, 0x00, 0xd1, 0x83, 
-0x13, 0x41, 0x00, 0x72, 0x52, 0x14, 0x41, 0x00, 0x74, 0x54, 0x16, 0x42, 0x03, 0x00, 0x00, 0xaa, 
-0x1a, 0x41, 0x00, 0x8b, 0x8a, 0x1f, 0x42, 0x00, 0x73, 0x53, 0xd0, 0x20, 0x42, 0x00, 0x64, 0x44, 
-0xd1, 0x25, 0x42, 0x03, 0x00, 0x00, 0x88, 0x26, 0x42, 0x00, 0x6c, 0x4c, 0x9d, 0x2b, 0x41, 0x00, 
-0xfb, 0xeb, 0x00, 0xf3, 0x13, 0x63, 0x9f, 0x64, 0xd4, 0x65, 0xd8, 0x6c, 0x96, 0x6e, 0xe5, 0x72, 
-0xfd, 0x73, 0xe7, 0x74, 0x9c, 0x7a, 0xa7, 0x43, 0xac, 0x44, 0xd2, 0x45, 0xb7, 0x4c, 0x95, 0x4e, 
-0xd5, 0x52, 0xfc, 0x53, 0xe6, 0x54, 0x9b, 0x5a, 0xa6, 0x20, 0xf3, 0x5e, 0x07, 0x61, 0x83, 0x69, 
-0x8c, 0x6f, 0x93, 0x41, 0xb6, 0x49, 0xd7, 0x4f, 0xe2, 0x20, 0x5e, 0xf4, 0x03, 0x61, 0xc7, 0x41, 
-0xc6, 0x20, 0xf4, 0xf8, 0x03, 0x75, 0x85, 0x55, 0xde, 0x20, 0xf8, 0xf2, 0x05, 0x61, 0xa5, 0x65, 
-0xa9, 0x41, 0xa4, 0x45, 0xa8, 0x20, 0xf2, 0xfa, 0x03, 0x7a, 0xbe, 0x5a, 0xbd, 0x20, 0xfa, 0x27, 
-0x19, 0x61, 0xa0, 0x63, 0x86, 0x65, 0x82, 0x69, 0xa1, 0x6c, 0x92, 0x6e, 0xe4, 0x6f, 0xa2, 0x72, 
-0xea, 0x73, 0x98, 0x75, 0xa3, 0x79, 0xec, 0x7a, 0xab, 0x41, 0xb5, 0x43, 0x8f, 0x45, 0x90, 0x49, 
-0xd6, 0x4c, 0x91, 0x4e, 0xe3, 0x4f, 0xe0, 0x52, 0xe8, 0x53, 0x97, 0x55, 0xe9, 0x59, 0xed, 0x5a, 
-0x8d, 0x20, 0x27, 0x2b, 0x05, 0x6f, 0x8b, 0x75, 0xfb, 0x4f, 0x8a, 0x55, 0xeb, 0x20, 0x2b, 0x22, 
-0x09, 0x61, 0x84, 0x65, 0x89, 0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 0x45, 0xd3, 0x4f, 0x99, 0x55, 
-0x9a, 0x20, 0x22, 0xf7, 0x07, 0x63, 0x87, 0x73, 0xad, 0x74, 0xee, 0x43, 0x80, 0x53, 0xb8, 0x54, 
-0xdd, 0x20, 0xf7, 0x00, 0x02, 0x01, 0x03, 0x00, 0xcc, 0x03, 0x01, 0x03, 0x00, 0xce, 0x04, 0x01, 
-0x03, 0x00, 0xcd, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xcc, 0x0b, 0x42, 0x07, 0x00, 0x00, 0xcd, 0x0c, 
-0x42, 0x07, 0x00, 0x00, 0xce, 0x0d, 0x42, 0x05, 0x00, 0x95, 0xcf, 0x13, 0x42, 0x03, 0x00, 0x00, 
-0x15, 0x14, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x17, 0x42, 0x03, 0x00, 0x00, 0x8d, 0x19, 0x42, 0x03, 
-0x00, 0x00, 0x9f, 0x1a, 0x41, 0x00, 0x93, 0xa7, 0x1b, 0x42, 0x05, 0x00, 0x97, 0xa0, 0x28, 0x41, 
-0x01, 0x00, 0x8f, 0x29, 0x41, 0x01, 0x00, 0x8d, 0x2b, 0x41, 0x00, 0x96, 0x98, 0x00, 0x7e, 0x03, 
-0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x04, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x20, 0x5e, 
-0xf8, 0x02, 0x61, 0x86, 0x20, 0xf8, 0x60, 0x03, 0x61, 0x85, 0x65, 0x8a, 0x20, 0x60, 0x27, 0x0b, 
-0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x41, 0x8f, 0x45, 0x90, 0x49, 0x8d, 
-0x4f, 0x95, 0x55, 0x97, 0x20, 0x27, 0x2b, 0x05, 0x6f, 0x93, 0x75, 0x96, 0x4f, 0xa7, 0x55, 0x98, 
-0x20, 0x2b, 0x22, 0x09, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 
-0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x2c, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0x2c, 0x00, 0x37, 
-0xcf, 0x03, 0x04, 0xd0, 0x00, 0x48, 0x55, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x54, 0x03, 0xe3, 0x01, 0x54, 0x02, 0x00, 0x00, 0x5a, 0x03, 0x55, 0x01, 0x5c, 
-0x01, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00, 0xb5, 0xe1, 0x15, 0x03, 0x69, 
-0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x00, 0xcc, 
-0xc8, 0x03, 0x01, 0x03, 0x00, 0xcd, 0x04, 0x03, 0x05, 0x00, 0x2b, 0xc9, 0x1e, 0x05, 0x01, 0x01, 
-0x00, 0x21, 0x06, 0x02, 0x07, 0x00, 0x00, 0xca, 0x07, 0x01, 0x01, 0x00, 0x2f, 0x08, 0x02, 0x05, 
-0x00, 0x3d, 0xcb, 0x09, 0x02, 0x01, 0x00, 0x28, 0xfa, 0x0a, 0x02, 0x01, 0x00, 0x29, 0xef, 0x0b, 
-0x41, 0x00, 0x94, 0x99, 0x0c, 0x42, 0x00, 0x81, 0x9a, 0xf9, 0x0d, 0xc2, 0x04, 0xa2, 0x0d, 0xe0, 
-0x00, 0xce, 0x83, 0x10, 0x42, 0x03, 0x00, 0x00, 0x5c, 0x11, 0x42, 0x03, 0x00, 0x00, 0x7c, 0x12, 
-0x42, 0x00, 0x65, 0x45, 0x8e, 0x15, 0xc4, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 
-0x00, 0x2c, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x42, 0x00, 0x69, 0x49, 0xd6, 0x18, 0x41, 0x00, 
-0x6f, 0x4f, 0x1a, 0x42, 0x03, 0xa0, 0xa0, 0xf6, 0x1b, 0x42, 0x00, 0xa3, 0xe9, 0x9e, 0x1e, 0x42, 
-0x00, 0x61, 0x41, 0x84, 0x21, 0x42, 0x03, 0x00, 0x00, 0x5b, 0x22, 0x42, 0x03, 0x00, 0x00, 0x5d, 
-0x24, 0x42, 0x03, 0x00, 0x00, 0xa1, 0x27, 0x42, 0x00, 0x82, 0x90, 0x24, 0x28, 0x42, 0x00, 0xa0, 
-0xb5, 0xe1, 0x29, 0x01, 0x00, 0x30, 0xf5, 0x2b, 0x42, 0x03, 0xa0, 0xa0, 0xcf, 0x2c, 0xc4, 0x00, 
-0x79, 0x15, 0x59, 0x15, 0x3e, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 0x42, 0x03, 0x00, 0x00, 0x23, 
-0x2e, 0x42, 0x00, 0x63, 0x43, 0x26, 0x2f, 0x42, 0x03, 0x00, 0x00, 0x40, 0x30, 0x42, 0x03, 0x00, 
-0x00, 0x7b, 0x31, 0x42, 0x00, 0x6e, 0x4e, 0x7d, 0x32, 0x42, 0x03, 0x00, 0x00, 0x3c, 0x33, 0x02, 
-0x00, 0x2c, 0x3f, 0x3b, 0x34, 0x02, 0x00, 0x2e, 0x3a, 0x3e, 0x35, 0x03, 0x00, 0x2d, 0x5f, 0x2a, 
-0x1f, 0x39, 0x00, 0x00, 0x20, 0x56, 0x42, 0x00, 0xa1, 0xd6, 0x3c, 0x00, 0x16, 0x42, 0x03, 0x00, 
-0x00, 0xd5, 0x00, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 
-0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 
-0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xf8, 0x03, 0x61, 0x86, 0x41, 
-0x8f, 0x20, 0xf8, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 
-0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x27, 0x0d, 0x61, 0xa0, 0x65, 
-0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 
-0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0x27, 0x22, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 
-0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 
-0x22, 0xf7, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0xf7, 0x00, 0x02, 0x02, 0x03, 0x00, 0xce, 0x7e, 
-0x03, 0x02, 0x07, 0x00, 0xd0, 0xc8, 0x04, 0x01, 0x03, 0x00, 0xcf, 0x05, 0x02, 0x07, 0x00, 0x00, 
-0xca, 0x06, 0x02, 0x07, 0x00, 0x00, 0xcb, 0x07, 0x02, 0x07, 0x00, 0x00, 0xcc, 0x08, 0x02, 0x03, 
-0x00, 0x00, 0x60, 0x09, 0x02, 0x07, 0x00, 0x00, 0xcd, 0x0b, 0x42, 0x03, 0x00, 0x00, 0xf1, 0x0d, 
-0xc2, 0x05, 0x00, 0x0d, 0xe0, 0x00, 0xd1, 0x83, 0x13, 0x41, 0x00, 0x72, 0x52, 0x14, 0x41, 0x00, 
-0x74, 0x54, 0x16, 0x42, 0x03, 0x00, 0x00, 0xaa, 0x1a, 0x41, 0x00, 0x8b, 0x8a, 0x1f, 0x42, 0x00, 
-0x73, 0x53, 0xd0, 0x20, 0x42, 0x00, 0x64, 0x44, 0xd1, 0x25, 0x42, 0x03, 0x00, 0x00, 0x88, 0x26, 
-0x42, 0x00, 0x6c, 0x4c, 0x9d, 0x2b, 0x41, 0x00, 0xfb, 0xeb, 0x00, 0xf3, 0x13, 0x63, 0x9f, 0x64, 
-0xd4, 0x65, 0xd8, 0x6c, 0x96, 0x6e, 0xe5, 0x72, 0xfd, 0x73, 0xe7, 0x74, 0x9c, 0x7a, 0xa7, 0x43, 
-0xac, 0x44, 0xd2, 0x45, 0xb7, 0x4c, 0x95, 0x4e, 0xd5, 0x52, 0xfc, 0x53, 0xe6, 0x54, 0x9b, 0x5a, 
-0xa6, 0x20, 0xf3, 0x5e, 0x07, 0x61, 0x83, 0x69, 0x8c, 0x6f, 0x93, 0x41, 0xb6, 0x49, 0xd7, 0x4f, 
-0xe2, 0x20, 0x5e, 0xf4, 0x03, 0x61, 0xc7, 0x41, 0xc6, 0x20, 0xf4, 0xf8, 0x03, 0x75, 0x85, 0x55, 
-0xde, 0x20, 0xf8, 0xf2, 0x05, 0x61, 0xa5, 0x65, 0xa9, 0x41, 0xa4, 0x45, 0xa8, 0x20, 0xf2, 0xfa, 
-0x03, 0x7a, 0xbe, 0x5a, 0xbd, 0x20, 0xfa, 0x27, 0x19, 0x61, 0xa0, 0x63, 0x86, 0x65, 0x82, 0x69, 
-0xa1, 0x6c, 0x92, 0x6e, 0xe4, 0x6f, 0xa2, 0x72, 0xea, 0x73, 0x98, 0x75, 0xa3, 0x79, 0xec, 0x7a, 
-0xab, 0x41, 0xb5, 0x43, 0x8f, 0x45, 0x90, 0x49, 0xd6, 0x4c, 0x91, 0x4e, 0xe3, 0x4f, 0xe0, 0x52, 
-0xe8, 0x53, 0x97, 0x55, 0xe9, 0x59, 0xed, 0x5a, 0x8d, 0x20, 0x27, 0x2b, 0x05, 0x6f, 0x8b, 0x75, 
-0xfb, 0x4f, 0x8a, 0x55, 0xeb, 0x20, 0x2b, 0x22, 0x09, 0x61, 0x84, 0x65, 0x89, 0x6f, 0x94, 0x75, 
-0x81, 0x41, 0x8e, 0x45, 0xd3, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0xf7, 0x07, 0x63, 0x87, 0x73, 
-0xad, 0x74, 0xee, 0x43, 0x80, 0x53, 0xb8, 0x54, 0xdd, 0x20, 0xf7, 0x00, 0x02, 0x01, 0x03, 0x00, 
-0xcc, 0x03, 0x01, 0x03, 0x00, 0xce, 0x04, 0x01, 0x03, 0x00, 0xcd, 0x0a, 0x02, 0x07, 0x00, 0x00, 
-0xcc, 0x0b, 0x42, 0x07, 0x00, 0x00, 0xcd, 0x0c, 0x42, 0x07, 0x00, 0x00, 0xce, 0x0d, 0x42, 0x05, 
-0x00, 0x95, 0xcf, 0x17, 0x42, 0x03, 0x00, 0x00, 0x8d, 0x19, 0x42, 0x03, 0x00, 0x00, 0x9f, 0x1a, 
-0x41, 0x00, 0x93, 0xa7, 0x1b, 0x42, 0x05, 0x00, 0x97, 0xa0, 0x28, 0x41, 0x01, 0x00, 0x8f, 0x29, 
-0x01, 0x01, 0x00, 0x15, 0x2b, 0x42, 0x04, 0x96, 0x98, 0xa0, 0x56, 0x41, 0x01, 0x00, 0x8d, 0x00, 
-0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x04, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 
-0x20, 0x5e, 0xf8, 0x02, 0x61, 0x86, 0x20, 0xf8, 0x60, 0x03, 0x61, 0x85, 0x65, 0x8a, 0x20, 0x60, 
-0x27, 0x0b, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x41, 0x8f, 0x45, 0x90, 
-0x49, 0x8d, 0x4f, 0x95, 0x55, 0x97, 0x20, 0x27, 0x2b, 0x05, 0x6f, 0x93, 0x75, 0x96, 0x4f, 0xa7, 
-0x55, 0x98, 0x20, 0x2b, 0x22, 0x09, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 
-0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x2c, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0x2c, 
-0x00, 0x2d, 0x83, 0x03, 0x09, 0x00, 0x00, 0x49, 0x54, 0x2c, 0x8d, 0x00, 0x49, 0x54, 0x08, 0x04, 
-0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xfb, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x01, 0xf5, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x54, 0x03, 0x16, 0x02, 0x59, 0x02, 0x00, 0x00, 0x65, 0x03, 0x6a, 0x02, 0x00, 0x00, 
-0x00, 0x00, 0x65, 0x03, 0x93, 0x02, 0x44, 0x03, 0x00, 0x00, 0x37, 0x75, 0x08, 0x01, 0x81, 0x01, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x02, 0x01, 0x00, 0x9c, 0x23, 0x07, 0x01, 0x01, 
-0x00, 0x26, 0x08, 0x02, 0x01, 0x00, 0x2f, 0x7b, 0x09, 0x04, 0x09, 0x00, 0x28, 0x5b, 0x00, 0x1b, 
-0x0a, 0x04, 0x09, 0x00, 0x29, 0x5d, 0x00, 0x1d, 0x0b, 0x02, 0x01, 0x00, 0x3d, 0x7d, 0x0c, 0x01, 
-0x00, 0x27, 0x3f, 0x0d, 0x04, 0x08, 0x8d, 0x5e, 0x7e, 0x00, 0x1e, 0x10, 0x42, 0x03, 0x00, 0x00, 
-0x40, 0x1a, 0x03, 0x00, 0x8a, 0x82, 0x5b, 0x7b, 0x1b, 0x03, 0x00, 0x2b, 0x2a, 0x5d, 0x7d, 0x27, 
-0x02, 0x00, 0x95, 0x87, 0x40, 0x28, 0x02, 0x00, 0x85, 0xf8, 0x23, 0x29, 0x04, 0x0c, 0x5c, 0x7c, 
-0x00, 0x00, 0x1c, 0x2b, 0x02, 0x00, 0x97, 0xf5, 0x60, 0x33, 0x02, 0x01, 0x00, 0x3b, 0x3c, 0x34, 
-0x02, 0x01, 0x00, 0x3a, 0x3e, 0x35, 0x04, 0x0c, 0x2d, 0x5f, 0x00, 0x00, 0x1f, 0x56, 0x01, 0x00, 
-0x3c, 0x3e, 0x00, 0x2b, 0x01, 0x01, 0x00, 0x15, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x12, 
-0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x03, 0x01, 0x03, 0x00, 0xc8, 0x04, 0x01, 0x03, 0x00, 0xa0, 
-0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x0c, 0x00, 0x01, 0xc9, 0x0d, 0x01, 0x03, 0x00, 0xca, 0x12, 
-0x42, 0x00, 0x65, 0x45, 0xd5, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 
-0x41, 0x00, 0x69, 0x49, 0x18, 0x43, 0x00, 0x6f, 0x4f, 0xab, 0xac, 0x1e, 0x43, 0x00, 0x61, 0x41, 
-0x91, 0x92, 0x1f, 0x42, 0x03, 0x00, 0x00, 0xe1, 0x26, 0x43, 0x03, 0x00, 0x00, 0xf2, 0xf6, 0x28, 
-0x01, 0x03, 0x00, 0xcc, 0x29, 0x02, 0x03, 0x00, 0x00, 0xfa, 0x2b, 0x02, 0x07, 0x00, 0xcd, 0xcb, 
-0x2c, 0x42, 0x03, 0x00, 0x00, 0xae, 0x2d, 0x42, 0x03, 0x00, 0x00, 0xaf, 0x2e, 0x43, 0x03, 0x00, 
-0x00, 0x87, 0x80, 0x31, 0x43, 0x03, 0x00, 0x00, 0xa4, 0xa5, 0x39, 0x00, 0x00, 0x20, 0x00, 0x22, 
-0x0d, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 
-0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x27, 0x0b, 0x61, 0xa0, 0x65, 
-0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 
-0xe9, 0x20, 0x27, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 
-0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0x60, 0x0b, 0x61, 0x85, 0x65, 
-0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 
-0xeb, 0x20, 0x60, 0xf8, 0x0b, 0x61, 0xc6, 0x65, 0xbd, 0x69, 0x9b, 0x6f, 0x9e, 0x75, 0xa9, 0x41, 
-0xc7, 0x45, 0xbe, 0x49, 0x9d, 0x4f, 0x9f, 0x55, 0xb8, 0x20, 0xf8, 0xf5, 0x0b, 0x61, 0xd0, 0x65, 
-0xdd, 0x69, 0x9c, 0x6f, 0xe7, 0x75, 0xef, 0x41, 0xd1, 0x45, 0xf9, 0x49, 0xcf, 0x4f, 0xe8, 0x55, 
-0xf7, 0x20, 0xf5, 0x00, 0x04, 0x01, 0x03, 0x00, 0xa0, 0x06, 0x02, 0x03, 0x00, 0x00, 0xaa, 0x0d, 
-0x01, 0x03, 0xa0, 0xc8, 0x12, 0x42, 0x03, 0x00, 0x00, 0xaa, 0x1a, 0x00, 0x01, 0xa0, 0x1f, 0x41, 
-0x00, 0x73, 0x53, 0x20, 0x43, 0x00, 0x64, 0x44, 0xd0, 0xd1, 0x27, 0x00, 0x01, 0xa0, 0x28, 0x00, 
-0x01, 0xa0, 0x2b, 0x00, 0x01, 0xa0, 0x2c, 0x41, 0x00, 0x7a, 0x5a, 0x2e, 0x43, 0x00, 0x63, 0x43, 
-0x86, 0x8f, 0x39, 0x00, 0x00, 0x20, 0x00, 0x5e, 0x07, 0x63, 0x9f, 0x73, 0xe7, 0x7a, 0xa7, 0x43, 
-0xac, 0x53, 0xe6, 0x5a, 0xa6, 0x20, 0x5e, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0x87, 0x0d, 0x00, 
-0x01, 0xa0, 0x12, 0x02, 0x03, 0x00, 0x00, 0x87, 0x27, 0x01, 0x03, 0xa0, 0xa0, 0x28, 0x01, 0x03, 
-0xa0, 0xa0, 0x2b, 0x01, 0x03, 0xa0, 0xa0, 0x36, 0x05, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 
-0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0x87, 0x0d, 0x00, 0x01, 0xa0, 0x10, 0x01, 0x00, 0x8b, 0x8c, 
-0x11, 0x01, 0x02, 0xed, 0xa0, 0x12, 0x42, 0x00, 0xde, 0xa8, 0x87, 0x13, 0x41, 0x00, 0xeb, 0xc7, 
-0x14, 0x41, 0x00, 0xee, 0xd0, 0x15, 0x41, 0x00, 0xf2, 0xd1, 0x16, 0x41, 0x00, 0xe2, 0xac, 0x17, 
-0x41, 0x00, 0xe3, 0xad, 0x18, 0x41, 0x00, 0xe9, 0xbe, 0x19, 0x41, 0x00, 0xea, 0xc6, 0x1a, 0x01, 
-0x03, 0xa0, 0xa0, 0x1e, 0x41, 0x00, 0xd6, 0xa4, 0x1f, 0x41, 0x00, 0xec, 0xcf, 0x20, 0x41, 0x00, 
-0xdd, 0xa7, 0x21, 0x41, 0x00, 0xf3, 0xd2, 0x22, 0x41, 0x00, 0xd8, 0xa6, 0x23, 0x41, 0x00, 0xe1, 
-0xaa, 0x24, 0x41, 0x00, 0xe8, 0xbd, 0x25, 0x41, 0x00, 0xe4, 0xb5, 0x26, 0x41, 0x00, 0xe5, 0xb6, 
-0x27, 0x01, 0x03, 0xc8, 0xa0, 0x28, 0x01, 0x03, 0xc9, 0xa0, 0x2a, 0x05, 0x3f, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x7c, 0x2b, 0x01, 0x03, 0xca, 0xa0, 0x2c, 0xc1, 0x00, 0xe0, 0x00, 0xa9, 0x2c, 0x2d, 
-0x41, 0x00, 0xf4, 0xd3, 0x2e, 0x41, 0x00, 0xf6, 0xd4, 0x2f, 0x41, 0x00, 0xfa, 0xd5, 0x30, 0x41, 
-0x00, 0xd7, 0xa5, 0x31, 0x41, 0x00, 0xe7, 0xb8, 0x32, 0x41, 0x00, 0xe6, 0xb7, 0x39, 0x00, 0x00, 
-0x20, 0x00, 0xef, 0x0f, 0xd6, 0x9b, 0xde, 0x9d, 0xe1, 0x9e, 0xe3, 0x9f, 0xe9, 0xa2, 0xf2, 0xa3, 
-0xfa, 0xfd, 0xa4, 0x86, 0xa8, 0x8d, 0xaa, 0x8f, 0xad, 0x90, 0xbe, 0x92, 0xd1, 0x95, 0xd5, 0x98, 
-0x20, 0xef, 0xf9, 0x05, 0xe3, 0xa0, 0xf2, 0xfb, 0xad, 0x91, 0xd1, 0x96, 0x20, 0xf9, 0xf7, 0x03, 
-0xe3, 0xa1, 0xf2, 0xfc, 0x20, 0xf7, 0x00, 0x6e, 0x79, 0x03, 0x04, 0x8e, 0x00, 0x49, 0x54, 0x08, 
-0x04, 0x2c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xf6, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x01, 0xf0, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x54, 0x03, 0x11, 0x02, 0x54, 0x02, 0x00, 0x00, 0x65, 0x03, 0x65, 0x02, 0x00, 
-0x00, 0x00, 0x00, 0x65, 0x03, 0x8e, 0x02, 0x3f, 0x03, 0x00, 0x00, 0x37, 0x75, 0x03, 0x01, 0x7c, 
-0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x02, 0x01, 0x00, 0x9c, 0x23, 0x07, 0x01, 
-0x01, 0x00, 0x26, 0x08, 0x02, 0x01, 0x00, 0x2f, 0x7b, 0x09, 0x04, 0x09, 0x00, 0x28, 0x5b, 0x00, 
-0x1b, 0x0a, 0x04, 0x09, 0x00, 0x29, 0x5d, 0x00, 0x1d, 0x0b, 0x02, 0x01, 0x00, 0x3d, 0x7d, 0x0c, 
-0x01, 0x00, 0x27, 0x3f, 0x0d, 0x04, 0x0c, 0x8d, 0x5e, 0x00, 0x00, 0x1e, 0x10, 0x42, 0x03, 0x00, 
-0x00, 0x40, 0x1a, 0x01, 0x00, 0x8a, 0x82, 0x1b, 0x02, 0x00, 0x2b, 0x2a, 0x7e, 0x27, 0x01, 0x00, 
-0x95, 0x87, 0x28, 0x01, 0x00, 0x85, 0xf8, 0x29, 0x04, 0x0c, 0x5c, 0x7c, 0x00, 0x00, 0x1c, 0x2b, 
-0x02, 0x00, 0x97, 0xf5, 0x60, 0x33, 0x02, 0x01, 0x00, 0x3b, 0x3c, 0x34, 0x02, 0x01, 0x00, 0x3a, 
-0x3e, 0x35, 0x04, 0x0c, 0x2d, 0x5f, 0x00, 0x00, 0x1f, 0x56, 0x01, 0x00, 0x3c, 0x3e, 0x00, 0x2b, 
-0x01, 0x01, 0x00, 0x15, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x12, 0x42, 0x03, 0x00, 0x00, 
-0xd5, 0x00, 0x03, 0x01, 0x03, 0x00, 0xc8, 0x04, 0x01, 0x03, 0x00, 0xa0, 0x06, 0x02, 0x03, 0x00, 
-0x00, 0xd5, 0x0c, 0x00, 0x01, 0xc9, 0x0d, 0x01, 0x03, 0x00, 0xca, 0x12, 0x42, 0x00, 0x65, 0x45, 
-0xd5, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 
-0x18, 0x43, 0x00, 0x6f, 0x4f, 0xab, 0xac, 0x1e, 0x43, 0x00, 0x61, 0x41, 0x91, 0x92, 0x1f, 0x42, 
-0x03, 0x00, 0x00, 0xe1, 0x26, 0x43, 0x03, 0x00, 0x00, 0xf2, 0xf6, 0x28, 0x01, 0x03, 0x00, 0xcc, 
-0x29, 0x02, 0x03, 0x00, 0x00, 0xfa, 0x2b, 0x02, 0x07, 0x00, 0xcd, 0xcb, 0x2c, 0x42, 0x03, 0x00, 
-0x00, 0xae, 0x2d, 0x42, 0x03, 0x00, 0x00, 0xaf, 0x2e, 0x43, 0x03, 0x00, 0x00, 0x87, 0x80, 0x31, 
-0x43, 0x03, 0x00, 0x00, 0xa4, 0xa5, 0x39, 0x00, 0x00, 0x20, 0x00, 0x22, 0x0d, 0x61, 0x84, 0x65, 
-0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 
-0x99, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x27, 0x0b, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 
-0xa2, 0x75, 0xa3, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x20, 0x27, 0x5e, 
-0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 
-0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 
-0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0xf8, 
-0x0b, 0x61, 0xc6, 0x65, 0xbd, 0x69, 0x9b, 0x6f, 0x9e, 0x75, 0xa9, 0x41, 0xc7, 0x45, 0xbe, 0x49, 
-0x9d, 0x4f, 0x9f, 0x55, 0xb8, 0x20, 0xf8, 0xf5, 0x0b, 0x61, 0xd0, 0x65, 0xdd, 0x69, 0x9c, 0x6f, 
-0xe7, 0x75, 0xef, 0x41, 0xd1, 0x45, 0xf9, 0x49, 0xcf, 0x4f, 0xe8, 0x55, 0xf7, 0x20, 0xf5, 0x00, 
-0x04, 0x01, 0x03, 0x00, 0xa0, 0x06, 0x02, 0x03, 0x00, 0x00, 0xaa, 0x0d, 0x01, 0x03, 0xa0, 0xc8, 
-0x12, 0x42, 0x03, 0x00, 0x00, 0xaa, 0x1a, 0x00, 0x01, 0xa0, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x20, 
-0x43, 0x00, 0x64, 0x44, 0xd0, 0xd1, 0x27, 0x00, 0x01, 0xa0, 0x28, 0x00, 0x01, 0xa0, 0x2b, 0x00, 
-0x01, 0xa0, 0x2c, 0x41, 0x00, 0x7a, 0x5a, 0x2e, 0x43, 0x00, 0x63, 0x43, 0x86, 0x8f, 0x39, 0x00, 
-0x00, 0x20, 0x00, 0x5e, 0x07, 0x63, 0x9f, 0x73, 0xe7, 0x7a, 0xa7, 0x43, 0xac, 0x53, 0xe6, 0x5a, 
-0xa6, 0x20, 0x5e, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0x87, 0x0d, 0x00, 0x01, 0xa0, 0x12, 0x02, 
-0x03, 0x00, 0x00, 0x87, 0x27, 0x01, 0x03, 0xa0, 0xa0, 0x28, 0x01, 0x03, 0xa0, 0xa0, 0x2b, 0x01, 
-0x03, 0xa0, 0xa0, 0x36, 0x05, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x06, 0x02, 0x03, 
-0x00, 0x00, 0x87, 0x0d, 0x00, 0x01, 0xa0, 0x10, 0x01, 0x00, 0x8b, 0x8c, 0x11, 0x01, 0x02, 0xed, 
-0xa0, 0x12, 0x42, 0x00, 0xde, 0xa8, 0x87, 0x13, 0x41, 0x00, 0xeb, 0xc7, 0x14, 0x41, 0x00, 0xee, 
-0xd0, 0x15, 0x41, 0x00, 0xf2, 0xd1, 0x16, 0x41, 0x00, 0xe2, 0xac, 0x17, 0x41, 0x00, 0xe3, 0xad, 
-0x18, 0x41, 0x00, 0xe9, 0xbe, 0x19, 0x41, 0x00, 0xea, 0xc6, 0x1a, 0x01, 0x03, 0xa0, 0xa0, 0x1e, 
-0x41, 0x00, 0xd6, 0xa4, 0x1f, 0x41, 0x00, 0xec, 0xcf, 0x20, 0x41, 0x00, 0xdd, 0xa7, 0x21, 0x41, 
-0x00, 0xf3, 0xd2, 0x22, 0x41, 0x00, 0xd8, 0xa6, 0x23, 0x41, 0x00, 0xe1, 0xaa, 0x24, 0x41, 0x00, 
-0xe8, 0xbd, 0x25, 0x41, 0x00, 0xe4, 0xb5, 0x26, 0x41, 0x00, 0xe5, 0xb6, 0x27, 0x01, 0x03, 0xc8, 
-0xa0, 0x28, 0x01, 0x03, 0xc9, 0xa0, 0x2a, 0x05, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x2b, 
-0x01, 0x03, 0xca, 0xa0, 0x2c, 0xc1, 0x00, 0xe0, 0x00, 0xa9, 0x2c, 0x2d, 0x41, 0x00, 0xf4, 0xd3, 
-0x2e, 0x41, 0x00, 0xf6, 0xd4, 0x2f, 0x41, 0x00, 0xfa, 0xd5, 0x30, 0x41, 0x00, 0xd7, 0xa5, 0x31, 
-0x41, 0x00, 0xe7, 0xb8, 0x32, 0x41, 0x00, 0xe6, 0xb7, 0x39, 0x00, 0x00, 0x20, 0x00, 0xef, 0x0f, 
-0xd6, 0x9b, 0xde, 0x9d, 0xe1, 0x9e, 0xe3, 0x9f, 0xe9, 0xa2, 0xf2, 0xa3, 0xfa, 0xfd, 0xa4, 0x86, 
-0xa8, 0x8d, 0xaa, 0x8f, 0xad, 0x90, 0xbe, 0x92, 0xd1, 0x95, 0xd5, 0x98, 0x20, 0xef, 0xf9, 0x05, 
-0xe3, 0xa0, 0xf2, 0xfb, 0xad, 0x91, 0xd1, 0x96, 0x20, 0xf9, 0xf7, 0x03, 0xe3, 0xa1, 0xf2, 0xfc, 
-0x20, 0xf7, 0x00, 0x8c, 0x23, 0x02, 0x0c, 0x00, 0x00, 0x4a, 0x50, 0x2c, 0x00, 0x00, 0x4a, 0x50, 
-0x31, 0x30, 0x36, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 
-0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0c, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0c, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x03, 0x0b, 0x00, 0x00, 0xc7, 0xa0, 0x03, 0x03, 
-0x09, 0x00, 0x22, 0xcc, 0xa0, 0x04, 0x03, 0x03, 0x00, 0x00, 0xb1, 0xa7, 0x05, 0x03, 0x03, 0x00, 
-0x00, 0xb3, 0xa9, 0x06, 0x03, 0x03, 0x00, 0x00, 0xb4, 0xaa, 0x07, 0x03, 0x01, 0x00, 0x26, 0xb5, 
-0xab, 0x08, 0x03, 0x01, 0x00, 0x27, 0xd4, 0xac, 0x09, 0x03, 0x01, 0x00, 0x28, 0xd5, 0xad, 0x0a, 
-0x03, 0x01, 0x00, 0x29, 0xd6, 0xae, 0x0b, 0x03, 0x01, 0x00, 0x7e, 0xdc, 0xa6, 0x0c, 0x03, 0x09, 
-0x00, 0x3d, 0xce, 0xa0, 0x0d, 0x04, 0x08, 0x5e, 0x7e, 0xcd, 0xa0, 0x1e, 0x10, 0x43, 0x0b, 0x00, 
-0x00, 0xc0, 0xa0, 0x11, 0x43, 0x0b, 0x00, 0x00, 0xc3, 0xa0, 0x12, 0x43, 0x03, 0x00, 0x00, 0xb2, 
-0xa8, 0x13, 0x43, 0x0b, 0x00, 0x00, 0xbd, 0xa0, 0x14, 0x43, 0x0b, 0x00, 0x00, 0xb6, 0xa0, 0x15, 
-0x43, 0x0b, 0x00, 0x00, 0xdd, 0xa0, 0x16, 0x43, 0x0b, 0x00, 0x00, 0xc5, 0xa0, 0x17, 0x43, 0x0b, 
-0x00, 0x00, 0xc6, 0xa0, 0x18, 0x43, 0x0b, 0x00, 0x00, 0xd7, 0xa0, 0x19, 0x43, 0x0b, 0x00, 0x00, 
-0xbe, 0xa0, 0x1a, 0x84, 0x08, 0x40, 0x1a, 0x60, 0x1a, 0xde, 0x1a, 0xa0, 0x1a, 0x00, 0x03, 0x1b, 
-0x04, 0x00, 0x5b, 0x7b, 0xdf, 0xa2, 0x1b, 0x1e, 0x43, 0x0b, 0x00, 0x00, 0xc1, 0xa0, 0x1f, 0x43, 
-0x0b, 0x00, 0x00, 0xc4, 0xa0, 0x20, 0x43, 0x0b, 0x00, 0x00, 0xbc, 0xa0, 0x21, 0x43, 0x0b, 0x00, 
-0x00, 0xca, 0xa0, 0x22, 0x43, 0x0b, 0x00, 0x00, 0xb7, 0xa0, 0x23, 0x43, 0x0b, 0x00, 0x00, 0xb8, 
-0xa0, 0x24, 0x43, 0x0b, 0x00, 0x00, 0xcf, 0xa0, 0x25, 0x43, 0x0b, 0x00, 0x00, 0xc9, 0xa0, 0x26, 
-0x43, 0x0b, 0x00, 0x00, 0xd8, 0xa0, 0x27, 0x03, 0x09, 0x00, 0x2b, 0xda, 0xa0, 0x28, 0x03, 0x08, 
-0x3a, 0x2a, 0xb9, 0xa0, 0x29, 0x86, 0x00, 0x00, 0xaf, 0x00, 0xb0, 0x00, 0xaf, 0x00, 0xb0, 0x00, 
-0xb1, 0x00, 0xb2, 0x00, 0xb2, 0x2b, 0x04, 0x00, 0x5d, 0x7d, 0xd1, 0xa3, 0x1d, 0x2c, 0x43, 0x03, 
-0x00, 0x00, 0xc2, 0xaf, 0x2d, 0x43, 0x0b, 0x00, 0x00, 0xbb, 0xa0, 0x2e, 0x43, 0x0b, 0x00, 0x00, 
-0xbf, 0xa0, 0x2f, 0x43, 0x0b, 0x00, 0x00, 0xcb, 0xa0, 0x30, 0x43, 0x0b, 0x00, 0x00, 0xba, 0xa0, 
-0x31, 0x43, 0x0b, 0x00, 0x00, 0xd0, 0xa0, 0x32, 0x43, 0x0b, 0x00, 0x00, 0xd3, 0xa0, 0x33, 0x03, 
-0x03, 0x00, 0x00, 0xc8, 0xa4, 0x34, 0x03, 0x03, 0x00, 0x00, 0xd9, 0xa1, 0x35, 0x03, 0x03, 0x00, 
-0x00, 0xd2, 0xa5, 0x3a, 0x86, 0x0a, 0x00, 0xb3, 0x00, 0x3a, 0x00, 0xb3, 0x00, 0x3a, 0x00, 0xb4, 
-0x00, 0xb5, 0x00, 0xb5, 0x70, 0x86, 0x60, 0x00, 0xb6, 0x00, 0xb7, 0x00, 0xb6, 0x00, 0xb7, 0x00, 
-0xb8, 0xc3, 0x00, 0xbb, 0x00, 0x73, 0x04, 0x00, 0x5c, 0x5f, 0xdb, 0x7c, 0x1c, 0x79, 0x86, 0x00, 
-0x00, 0xa7, 0x00, 0xa8, 0x00, 0xa7, 0x00, 0xa8, 0x00, 0xa9, 0x00, 0xaa, 0x00, 0xaa, 0x7b, 0x86, 
-0x00, 0x00, 0xab, 0x00, 0xac, 0x00, 0xab, 0x00, 0xac, 0x00, 0xad, 0x00, 0xae, 0x00, 0xae, 0x7d, 
-0x04, 0x08, 0x5c, 0x7c, 0xb0, 0xa0, 0x1c, 0xba, 0x86, 0x7f, 0x00, 0xb3, 0x00, 0x3a, 0xbb, 0x00, 
-0x00, 0x3a, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xb5, 0x00, 0xd5, 0xb3, 0x04, 0x09, 0x00, 0x00, 0x4c, 
-0x41, 0x2c, 0xab, 0x00, 0x4c, 0x41, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x5a, 0x03, 0x43, 0x01, 0x4a, 0x01, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x4a, 0x01, 
-0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x33, 0x75, 0xb5, 0x01, 0x09, 0x02, 
-0x00, 0x00, 0x4d, 0x75, 0xaa, 0x02, 0x15, 0x03, 0x00, 0x00, 0x4e, 0x75, 0xaa, 0x03, 0x02, 0x04, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x07, 
-0x01, 0x01, 0x00, 0x26, 0x08, 0x01, 0x01, 0x00, 0x2f, 0x09, 0x01, 0x01, 0x00, 0x28, 0x0a, 0x01, 
-0x01, 0x00, 0x29, 0x0b, 0x01, 0x01, 0x00, 0x3d, 0x0c, 0x04, 0x08, 0x27, 0x3f, 0x5c, 0x00, 0x1c, 
-0x0d, 0x01, 0x00, 0xa8, 0xad, 0x10, 0x02, 0x03, 0x00, 0x00, 0x40, 0x12, 0x41, 0x00, 0x65, 0x45, 
-0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 
-0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x01, 0x03, 0xca, 0xcb, 0x1b, 0x02, 0x00, 0x2b, 0x2a, 0x7e, 0x1e, 
-0x41, 0x00, 0x61, 0x41, 0x27, 0x41, 0x00, 0xa4, 0xa5, 0x28, 0x04, 0x0c, 0x7b, 0x5b, 0xc9, 0x00, 
-0x1b, 0x29, 0x02, 0x00, 0x7c, 0xf8, 0xaa, 0x2b, 0x04, 0x0c, 0x7d, 0x5d, 0xc8, 0x00, 0x1d, 0x2e, 
-0x41, 0x00, 0x63, 0x43, 0x33, 0x02, 0x01, 0x00, 0x3b, 0x3c, 0x34, 0x02, 0x01, 0x00, 0x3a, 0x3e, 
-0x35, 0x04, 0x0c, 0x2d, 0x5f, 0x00, 0x00, 0x1f, 0x39, 0x00, 0x00, 0x20, 0x56, 0x01, 0x00, 0x3c, 
-0x3e, 0x00, 0x60, 0x06, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x20, 0x60, 
-0x5e, 0x06, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 0x27, 0x09, 
-0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x43, 0x80, 0x45, 0x90, 
-0x20, 0x27, 0x22, 0x0a, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 
-0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 
-0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 
-0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 
-0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 
-0xef, 0x0f, 0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 
-0x41, 0xb5, 0x43, 0x80, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 
-0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 
-0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 
-0xcf, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x0d, 0x02, 0x03, 0x00, 0x00, 0x9c, 0x12, 0x03, 0x03, 
-0x00, 0x00, 0xbd, 0xbe, 0x17, 0x03, 0x03, 0x00, 0x00, 0x9e, 0x9f, 0x1b, 0x02, 0x07, 0x00, 0x00, 
-0xcc, 0x1e, 0x03, 0x03, 0x00, 0x00, 0xf4, 0xf6, 0x1f, 0x43, 0x00, 0x73, 0x53, 0xfb, 0xe6, 0x22, 
-0x41, 0x00, 0x67, 0x47, 0x26, 0x03, 0x03, 0x00, 0x00, 0xfc, 0xfd, 0x2c, 0x42, 0x00, 0x7a, 0x5a, 
-0xae, 0x2d, 0x42, 0x00, 0x78, 0x58, 0xaf, 0x31, 0x43, 0x00, 0x6e, 0x4e, 0xe1, 0xee, 0x00, 0x60, 
-0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 
-0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x5e, 0x13, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 
-0x93, 0x75, 0x96, 0x63, 0xab, 0x73, 0xf9, 0x7a, 0xf7, 0x78, 0xb8, 0x41, 0xb6, 0x45, 0xd2, 0x49, 
-0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x43, 0xac, 0x53, 0xdd, 0x5a, 0xef, 0x58, 0xa9, 0x20, 0x5e, 0x27, 
-0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 
-0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0x27, 0x22, 0x0f, 0x61, 0x84, 0x65, 
-0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x6e, 0xa6, 0x78, 0xf1, 0x41, 0x8e, 0x45, 0xd3, 0x49, 
-0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x4e, 0xa7, 0x58, 0xf2, 0x20, 0x22, 0x7e, 0x11, 0x61, 0xc6, 0x65, 
-0x86, 0x69, 0x91, 0x6f, 0xe4, 0x75, 0x9b, 0x67, 0xd0, 0x6e, 0xa4, 0x79, 0xe7, 0x41, 0xc7, 0x45, 
-0x8f, 0x49, 0x92, 0x4f, 0xe5, 0x55, 0x9d, 0x47, 0xd1, 0x4e, 0xa5, 0x59, 0xe8, 0x20, 0x7e, 0x00, 
-0x04, 0x02, 0x03, 0x00, 0x00, 0xfa, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x11, 0x03, 0x03, 0x00, 
-0x00, 0xf7, 0xef, 0x12, 0x03, 0x03, 0x00, 0x00, 0x87, 0x80, 0x13, 0x03, 0x03, 0x00, 0x00, 0xe6, 
-0xfb, 0x15, 0x03, 0x03, 0x00, 0x00, 0xf4, 0xf6, 0x16, 0x03, 0x03, 0x00, 0x00, 0xe7, 0xe8, 0x17, 
-0x03, 0x03, 0x00, 0x00, 0xf1, 0xf2, 0x18, 0x03, 0x03, 0x00, 0x00, 0x9b, 0x9d, 0x1f, 0x43, 0x00, 
-0x73, 0x53, 0xe4, 0xe5, 0x20, 0x03, 0x03, 0x00, 0x00, 0xfc, 0xfd, 0x21, 0x03, 0x03, 0x00, 0x00, 
-0xc6, 0xc7, 0x29, 0x01, 0x03, 0xcc, 0xcd, 0x2c, 0x02, 0x03, 0x00, 0x00, 0xae, 0x2d, 0x02, 0x03, 
-0x00, 0x00, 0xaf, 0x31, 0x03, 0x03, 0x00, 0x00, 0x9c, 0xcf, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 
-0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 
-0xeb, 0x20, 0x60, 0x5e, 0x0b, 0x61, 0x86, 0x65, 0x91, 0x69, 0x98, 0x6f, 0xe1, 0x75, 0x9e, 0x41, 
-0x8f, 0x45, 0x92, 0x49, 0xf3, 0x4f, 0xee, 0x55, 0x9f, 0x20, 0x5e, 0x27, 0x0b, 0x61, 0xa0, 0x65, 
-0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 
-0xe9, 0x20, 0x27, 0x22, 0x0d, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x73, 
-0xf9, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x53, 0xdd, 0x20, 0x22, 0x7c, 
-0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 
-0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x7c, 0xf8, 0x0b, 0x61, 0xa6, 0x65, 0xab, 0x69, 0xa9, 0x6f, 
-0xbd, 0x75, 0xd0, 0x41, 0xa7, 0x45, 0xac, 0x49, 0xb8, 0x4f, 0xbe, 0x55, 0xd1, 0x20, 0xf8, 0x00, 
-0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x0c, 0x00, 0x01, 0xcc, 0x0d, 0x02, 0x03, 0x00, 0x00, 0x9c, 
-0x12, 0x02, 0x03, 0x00, 0x00, 0x9f, 0x14, 0x02, 0x03, 0x00, 0x00, 0xcf, 0x16, 0x02, 0x03, 0x00, 
-0x00, 0xfd, 0x17, 0x02, 0x03, 0x00, 0x00, 0xfb, 0x18, 0x02, 0x03, 0x00, 0x00, 0xfc, 0x19, 0x02, 
-0x03, 0x00, 0x00, 0xbe, 0x1e, 0x02, 0x03, 0x00, 0x00, 0x9e, 0x1f, 0x42, 0x00, 0x73, 0x53, 0xe1, 
-0x29, 0x01, 0x03, 0xcd, 0xce, 0x2c, 0x42, 0x00, 0x7a, 0x5a, 0xae, 0x2d, 0x02, 0x03, 0x00, 0x00, 
-0xaf, 0x2e, 0x02, 0x03, 0x00, 0x00, 0xbd, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 
-0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 
-0x5e, 0x0c, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x63, 0x87, 0x73, 0xf9, 
-0x7a, 0xf7, 0x43, 0x80, 0x53, 0xdd, 0x5a, 0xef, 0x20, 0x5e, 0xef, 0x0b, 0x61, 0xa0, 0x65, 0x82, 
-0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 
-0x20, 0x27, 0x22, 0x09, 0x61, 0x84, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 0x49, 0xd8, 
-0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x27, 0x0b, 0x61, 0xb6, 0x65, 0xd2, 0x69, 0xd7, 0x6f, 0xe2, 
-0x75, 0xea, 0x41, 0xc6, 0x45, 0xc7, 0x49, 0xe4, 0x4f, 0xe5, 0x55, 0xe6, 0x20, 0x27, 0x7c, 0x0b, 
-0x61, 0xd0, 0x65, 0x89, 0x69, 0xec, 0x6f, 0xe7, 0x75, 0x98, 0x41, 0xd1, 0x45, 0xd3, 0x49, 0xed, 
-0x4f, 0xe8, 0x55, 0xf3, 0x20, 0x7c, 0xf8, 0x0b, 0x61, 0x86, 0x65, 0x91, 0x69, 0x9b, 0x6f, 0xab, 
-0x75, 0xa6, 0x41, 0x8f, 0x45, 0x92, 0x49, 0x9d, 0x4f, 0xac, 0x55, 0xa7, 0x20, 0xf8, 0x00, 0xc3, 
-0x7d, 0x02, 0x19, 0x00, 0x00, 0x4c, 0x48, 0x2c, 0x00, 0x00, 0x55, 0x53, 0x44, 0x56, 0x4c, 0x2c, 
-0x67, 0x00, 0x4c, 0x48, 0x2c, 0x67, 0x00, 0x55, 0x53, 0x44, 0x56, 0x4c, 0x04, 0x03, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x52, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x84, 0x00, 0x5b, 0x1a, 0x7b, 0x1a, 0x1b, 
-0x1a, 0x00, 0x1a, 0x00, 0x1a, 0x03, 0x84, 0x00, 0x5d, 0x1b, 0x7d, 0x1b, 0x1d, 0x1b, 0x00, 0x1b, 
-0x00, 0x1b, 0x04, 0x84, 0x00, 0x2f, 0x35, 0x3f, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x05, 
-0xc4, 0x00, 0x70, 0x19, 0x50, 0x19, 0x10, 0x19, 0x00, 0x19, 0x00, 0x19, 0x06, 0xc4, 0x00, 0x66, 
-0x21, 0x46, 0x21, 0x06, 0x21, 0x00, 0x21, 0x00, 0x21, 0x07, 0xc4, 0x00, 0x6d, 0x32, 0x4d, 0x32, 
-0x0d, 0x32, 0x00, 0x32, 0x00, 0x32, 0x08, 0xc4, 0x00, 0x6c, 0x26, 0x4c, 0x26, 0x0c, 0x26, 0x00, 
-0x26, 0x00, 0x26, 0x09, 0xc4, 0x00, 0x6a, 0x24, 0x4a, 0x24, 0x0a, 0x24, 0x00, 0x24, 0x00, 0x24, 
-0x0a, 0x84, 0x00, 0x34, 0x05, 0x24, 0x05, 0x00, 0x05, 0x00, 0x7b, 0x00, 0x7b, 0x0b, 0x84, 0x00, 
-0x33, 0x04, 0x23, 0x04, 0x00, 0x04, 0x00, 0x7a, 0x00, 0x7a, 0x0c, 0x84, 0x00, 0x32, 0x03, 0x40, 
-0x03, 0x00, 0x03, 0x00, 0x79, 0x00, 0x79, 0x0d, 0x84, 0x00, 0x31, 0x02, 0x21, 0x02, 0x00, 0x02, 
-0x00, 0x78, 0x00, 0x78, 0x10, 0x84, 0x00, 0x3b, 0x27, 0x3a, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 
-0x27, 0x11, 0xc4, 0x00, 0x71, 0x10, 0x51, 0x10, 0x11, 0x10, 0x00, 0x10, 0x00, 0x10, 0x12, 0xc4, 
-0x00, 0x62, 0x30, 0x42, 0x30, 0x02, 0x30, 0x00, 0x30, 0x00, 0x30, 0x13, 0xc4, 0x00, 0x79, 0x15, 
-0x59, 0x15, 0x19, 0x15, 0x00, 0x15, 0x00, 0x15, 0x14, 0xc4, 0x00, 0x75, 0x16, 0x55, 0x16, 0x15, 
-0x16, 0x00, 0x16, 0x00, 0x16, 0x15, 0xc4, 0x00, 0x72, 0x13, 0x52, 0x13, 0x12, 0x13, 0x00, 0x13, 
-0x00, 0x13, 0x16, 0xc4, 0x00, 0x73, 0x1f, 0x53, 0x1f, 0x13, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x17, 
-0xc4, 0x00, 0x6f, 0x18, 0x4f, 0x18, 0x0f, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x84, 0x00, 0x2e, 
-0x34, 0x3e, 0x34, 0x00, 0x34, 0x00, 0x34, 0x00, 0x34, 0x19, 0x84, 0x00, 0x36, 0x07, 0x5e, 0x07, 
-0x1e, 0x07, 0x00, 0x7d, 0x00, 0x7d, 0x1a, 0x84, 0x00, 0x35, 0x06, 0x25, 0x06, 0x00, 0x06, 0x00, 
-0x7c, 0x00, 0x7c, 0x1b, 0x84, 0x00, 0x3d, 0x0d, 0x2b, 0x0d, 0x00, 0x0d, 0x00, 0x83, 0x00, 0x83, 
-0x1e, 0x84, 0x00, 0x2d, 0x0c, 0x5f, 0x0c, 0x1f, 0x0c, 0x00, 0x82, 0x00, 0x82, 0x1f, 0xc4, 0x00, 
-0x6b, 0x25, 0x4b, 0x25, 0x0b, 0x25, 0x00, 0x25, 0x00, 0x25, 0x20, 0xc4, 0x00, 0x63, 0x2e, 0x43, 
-0x2e, 0x03, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x21, 0xc4, 0x00, 0x64, 0x20, 0x44, 0x20, 0x04, 0x20, 
-0x00, 0x20, 0x00, 0x20, 0x22, 0xc4, 0x00, 0x74, 0x14, 0x54, 0x14, 0x14, 0x14, 0x00, 0x14, 0x00, 
-0x14, 0x24, 0xc4, 0x00, 0x65, 0x12, 0x45, 0x12, 0x05, 0x12, 0x00, 0x12, 0x00, 0x12, 0x25, 0xc4, 
-0x00, 0x61, 0x1e, 0x41, 0x1e, 0x01, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x26, 0xc4, 0x00, 0x7a, 0x2c, 
-0x5a, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x27, 0x84, 0x00, 0x38, 0x09, 0x2a, 0x09, 0x00, 
-0x09, 0x00, 0x7f, 0x00, 0x7f, 0x28, 0x84, 0x00, 0x37, 0x08, 0x26, 0x08, 0x00, 0x08, 0x00, 0x7e, 
-0x00, 0x7e, 0x2c, 0x84, 0x00, 0x27, 0x28, 0x22, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x2e, 
-0xc4, 0x00, 0x67, 0x22, 0x47, 0x22, 0x07, 0x22, 0x00, 0x22, 0x00, 0x22, 0x30, 0xc4, 0x00, 0x77, 
-0x11, 0x57, 0x11, 0x17, 0x11, 0x00, 0x11, 0x00, 0x11, 0x32, 0xc4, 0x00, 0x69, 0x17, 0x49, 0x17, 
-0x09, 0x17, 0x00, 0x17, 0x00, 0x17, 0x34, 0x84, 0x00, 0x30, 0x0b, 0x29, 0x0b, 0x00, 0x0b, 0x00, 
-0x81, 0x00, 0x81, 0x35, 0x84, 0x00, 0x39, 0x0a, 0x28, 0x0a, 0x00, 0x0a, 0x00, 0x80, 0x00, 0x80, 
-0x00, 0x24, 0xc4, 0x00, 0x65, 0x12, 0x45, 0x12, 0x05, 0x12, 0xd5, 0x12, 0x00, 0x12, 0x00, 0xa0, 
-0x19, 0x03, 0x09, 0x00, 0x00, 0x4e, 0x4c, 0x2c, 0x8f, 0x00, 0x4e, 0x4c, 0x05, 0x03, 0x00, 0x00, 
-0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xa9, 0x01, 0xb0, 0x01, 0x00, 0x00, 
-0x52, 0x03, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0xb5, 0x01, 0x2c, 0x01, 0x56, 0x01, 0x00, 0x00, 
-0x44, 0x75, 0x2f, 0x02, 0x7e, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0x02, 0x03, 0x00, 0x00, 0xfb, 0x03, 0x02, 0x01, 0x00, 0x22, 0xfd, 0x04, 0x02, 0x03, 0x00, 
-0x00, 0xfc, 0x05, 0x02, 0x03, 0x00, 0x00, 0xac, 0x06, 0x02, 0x03, 0x00, 0x00, 0xab, 0x07, 0x02, 
-0x01, 0x00, 0x26, 0xf3, 0x08, 0x04, 0x09, 0x00, 0x5f, 0x9c, 0x00, 0x1f, 0x09, 0x02, 0x01, 0x00, 
-0x28, 0x7b, 0x0a, 0x02, 0x01, 0x00, 0x29, 0x7d, 0x0b, 0x01, 0x01, 0x00, 0x27, 0x0c, 0x04, 0x08, 
-0x2f, 0x3f, 0x5c, 0x00, 0x1c, 0x0d, 0x02, 0x06, 0xf8, 0xc9, 0xcd, 0x12, 0x41, 0x00, 0x65, 0x45, 
-0x13, 0x42, 0x03, 0x00, 0x00, 0xf4, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 
-0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x04, 0x0f, 0xcc, 0xca, 0x00, 
-0x00, 0x1e, 0x1b, 0x02, 0x00, 0x2a, 0x7c, 0xdd, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x1f, 0x42, 0x03, 
-0x00, 0x00, 0xe1, 0x27, 0x01, 0x00, 0x2b, 0xf1, 0x28, 0x01, 0x03, 0xcb, 0xc8, 0x29, 0x02, 0x00, 
-0x40, 0xf5, 0xaa, 0x2b, 0x01, 0x00, 0x3c, 0x3e, 0x2c, 0x42, 0x03, 0x00, 0x00, 0xae, 0x2d, 0x42, 
-0x03, 0x00, 0x00, 0xaf, 0x2e, 0x42, 0x00, 0x63, 0x43, 0xbd, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x32, 
-0x42, 0x03, 0x00, 0x00, 0xe6, 0x33, 0x04, 0x09, 0x00, 0x3b, 0x5b, 0x00, 0x1b, 0x34, 0x02, 0x01, 
-0x00, 0x3a, 0xfa, 0x35, 0x04, 0x08, 0x2d, 0x3d, 0x5d, 0x00, 0x1d, 0x39, 0x00, 0x00, 0x20, 0x56, 
-0x04, 0x08, 0x5d, 0x5b, 0x7c, 0x00, 0x1d, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x07, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x13, 0x42, 0x03, 0x00, 0x00, 0x14, 
-0x1b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x29, 0x01, 0x01, 0x00, 0x15, 0x2e, 0x42, 0x03, 0x00, 0x00, 
-0x9b, 0x00, 0x60, 0x06, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x20, 0x60, 
-0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x06, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 
-0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 0x27, 0x07, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 
-0x75, 0xa3, 0x45, 0x90, 0x20, 0x27, 0x22, 0x0a, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 
-0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x2c, 0x03, 0x63, 0x87, 
-0x43, 0x80, 0x20, 0x2c, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x60, 0x0b, 0x61, 0x85, 
-0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 
-0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 
-0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 
-0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 0x0d, 0x61, 0xa0, 
-0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 
-0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 
-0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 
-0x20, 0xf9, 0xf7, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0xf7, 0x00, 0x05, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x07, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x10, 0x43, 0x03, 
-0x00, 0x00, 0x91, 0x92, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x17, 0x43, 0x03, 0x00, 0x00, 0x9e, 
-0x9f, 0x18, 0x43, 0x03, 0x00, 0x00, 0xab, 0xac, 0x19, 0x43, 0x03, 0x00, 0x00, 0x9b, 0x9d, 0x1b, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x1e, 0x43, 0x03, 0x00, 0x00, 0x86, 0x8f, 0x26, 0x43, 0x03, 0x00, 
-0x00, 0xe4, 0xe5, 0x2e, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 
-0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 
-0x20, 0x60, 0x7e, 0x0b, 0x61, 0x87, 0x65, 0xd0, 0x69, 0xe7, 0x6f, 0xf9, 0x75, 0xf7, 0x41, 0x80, 
-0x45, 0xd1, 0x49, 0xe8, 0x4f, 0xdd, 0x55, 0xef, 0x20, 0x7e, 0x5e, 0x0d, 0x61, 0x83, 0x65, 0x88, 
-0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x79, 0xbd, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 
-0x55, 0xea, 0x59, 0xbe, 0x20, 0x5e, 0x27, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 
-0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 
-0x20, 0x27, 0x22, 0x0d, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 
-0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x2c, 0x05, 
-0x65, 0xc6, 0x6f, 0xa4, 0x45, 0xc7, 0x4f, 0xa5, 0x20, 0x2c, 0x00, 0x78, 0x50, 0x03, 0x09, 0x00, 
-0x00, 0x4e, 0x4f, 0x2c, 0x9b, 0x00, 0x4e, 0x4f, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0x11, 0x01, 0x1e, 0x01, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 
-0x1e, 0x01, 0x00, 0x00, 0x61, 0x03, 0x99, 0x01, 0xa4, 0x01, 0x00, 0x00, 0x30, 0x75, 0xf3, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x30, 0x75, 0xa7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 
-0x22, 0x40, 0x04, 0x02, 0x03, 0x00, 0x00, 0x9c, 0x05, 0x02, 0x01, 0x00, 0xcf, 0x24, 0x07, 0x01, 
-0x01, 0x00, 0x26, 0x08, 0x02, 0x01, 0x00, 0x2f, 0x7b, 0x09, 0x04, 0x09, 0x00, 0x28, 0x5b, 0x00, 
-0x1b, 0x0a, 0x04, 0x09, 0x00, 0x29, 0x5d, 0x00, 0x1d, 0x0b, 0x02, 0x01, 0x00, 0x3d, 0x7d, 0x0c, 
-0x01, 0x00, 0x2b, 0x3f, 0x0d, 0x04, 0x0e, 0x5c, 0xc8, 0xcb, 0x00, 0x1c, 0x12, 0x41, 0x00, 0x65, 
-0x45, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 
-0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x41, 0x00, 0x86, 0x8f, 0x1b, 0x04, 0x0f, 0xcc, 0xca, 0xc9, 
-0x00, 0x1e, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x27, 0x41, 0x00, 0x9b, 0x9d, 0x28, 0x41, 0x00, 0x91, 
-0x92, 0x29, 0x01, 0x00, 0x7c, 0xf5, 0x2b, 0x01, 0x00, 0x27, 0x2a, 0x2e, 0x41, 0x00, 0x63, 0x43, 
-0x31, 0x41, 0x00, 0x6e, 0x4e, 0x32, 0x42, 0x03, 0x00, 0x00, 0xe6, 0x33, 0x02, 0x01, 0x00, 0x3b, 
-0x3c, 0x34, 0x02, 0x01, 0x00, 0x3a, 0x3e, 0x35, 0x04, 0x0c, 0x2d, 0x5f, 0x00, 0x00, 0x1f, 0x39, 
-0x00, 0x00, 0x20, 0x56, 0x01, 0x00, 0x3c, 0x3e, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x12, 
-0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 
-0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 
-0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 
-0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 
-0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 0x0f, 0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 
-0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x43, 0x80, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 
-0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 
-0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 
-0x00, 0x05, 0x01, 0x01, 0x00, 0xaf, 0x29, 0x01, 0x01, 0x00, 0x15, 0x00, 0x60, 0x06, 0x61, 0x85, 
-0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x20, 0x60, 0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 
-0x20, 0x7e, 0x5e, 0x06, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 
-0x27, 0x09, 0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x43, 0x80, 
-0x45, 0x90, 0x20, 0x27, 0x22, 0x0a, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 
-0x79, 0x98, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x00, 0x04, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x09, 0x03, 0x07, 0x00, 0x00, 0x00, 0xae, 0x0a, 0x03, 
-0x07, 0x00, 0x00, 0x00, 0xaf, 0x0d, 0x02, 0x07, 0x00, 0xa0, 0xa0, 0x10, 0x43, 0x03, 0x00, 0x00, 
-0x83, 0xb6, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x14, 0x43, 0x03, 0x00, 0x00, 0xab, 0x97, 0x17, 
-0x43, 0x03, 0x00, 0x00, 0x8b, 0xd8, 0x18, 0x43, 0x03, 0x00, 0x00, 0xe4, 0xe5, 0x1b, 0x02, 0x07, 
-0xa0, 0xa0, 0xa0, 0x1e, 0x43, 0x03, 0x00, 0x00, 0xa0, 0xb5, 0x1f, 0x43, 0x03, 0x00, 0x00, 0xaa, 
-0x96, 0x20, 0x43, 0x03, 0x00, 0x00, 0x9f, 0x8d, 0x21, 0x43, 0x03, 0x00, 0x00, 0x90, 0x80, 0x22, 
-0x43, 0x03, 0x00, 0x00, 0xa1, 0xa2, 0x23, 0x43, 0x03, 0x00, 0x00, 0x85, 0x82, 0x25, 0x43, 0x03, 
-0x00, 0x00, 0xa6, 0xa7, 0x27, 0x43, 0x03, 0x00, 0x00, 0x94, 0x99, 0x28, 0x43, 0x03, 0x00, 0x00, 
-0x84, 0x8e, 0x2c, 0x43, 0x03, 0x00, 0x00, 0xac, 0x98, 0x2e, 0x43, 0x03, 0x00, 0x00, 0x9e, 0x8c, 
-0x2f, 0x43, 0x03, 0x00, 0x00, 0x89, 0x8a, 0x30, 0x43, 0x03, 0x00, 0x00, 0x87, 0x88, 0x31, 0x43, 
-0x03, 0x00, 0x00, 0xa9, 0x95, 0x36, 0x05, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x09, 0x03, 0x07, 0x00, 0x00, 
-0x00, 0xae, 0x0a, 0x03, 0x07, 0x00, 0x00, 0x00, 0xaf, 0x0d, 0x02, 0x07, 0x00, 0xa0, 0xa0, 0x10, 
-0x43, 0x00, 0xa0, 0xb5, 0x71, 0x51, 0x11, 0x43, 0x00, 0xaa, 0x96, 0x77, 0x57, 0x12, 0x42, 0x03, 
-0x00, 0x00, 0xd5, 0x15, 0x43, 0x00, 0xab, 0x97, 0x79, 0x59, 0x17, 0x43, 0x03, 0x00, 0x00, 0x8b, 
-0xd8, 0x18, 0x43, 0x03, 0x00, 0x00, 0xe4, 0xe5, 0x1b, 0x42, 0x04, 0xa9, 0x95, 0xa0, 0x1e, 0x43, 
-0x03, 0x00, 0x00, 0x83, 0xb6, 0x22, 0x43, 0x03, 0x00, 0x00, 0xa1, 0xa2, 0x23, 0x43, 0x03, 0x00, 
-0x00, 0x90, 0x80, 0x25, 0x43, 0x03, 0x00, 0x00, 0xa6, 0xa7, 0x27, 0x43, 0x03, 0x00, 0x00, 0x94, 
-0x99, 0x28, 0x43, 0x03, 0x00, 0x00, 0x84, 0x8e, 0x2a, 0x05, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x7b, 0x2b, 0x43, 0x00, 0x9f, 0x8d, 0x27, 0x2a, 0x2c, 0x43, 0x03, 0x00, 0x00, 0x87, 0x88, 0x2d, 
-0x43, 0x00, 0x9e, 0x8c, 0x78, 0x58, 0x56, 0x43, 0x00, 0xac, 0x98, 0x89, 0x8a, 0x00, 0x69, 0x5b, 
-0x03, 0x09, 0x00, 0x00, 0x50, 0x4c, 0x2c, 0xc9, 0x01, 0x50, 0x4c, 0x0d, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x03, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x9c, 
-0x02, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x03, 0x4f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x16, 
-0x03, 0x4f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x02, 0x4f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x50, 
-0x03, 0x69, 0x02, 0x00, 0x00, 0x00, 0x00, 0x50, 0x03, 0x9c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x51, 
-0x03, 0x42, 0x03, 0x00, 0x00, 0x00, 0x00, 0x51, 0x03, 0x78, 0x02, 0x00, 0x00, 0x00, 0x00, 0x5a, 
-0x03, 0x95, 0x01, 0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 
-0xe3, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 
-0xc3, 0x00, 0x6f, 0x18, 0x4f, 0x18, 0xa2, 0x18, 0xe0, 0x00, 0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 
-0x9b, 0x10, 0x43, 0x03, 0x00, 0x00, 0x84, 0x8e, 0x11, 0x43, 0x03, 0x00, 0x00, 0x82, 0x8a, 0x12, 
-0x43, 0x03, 0x00, 0x00, 0x91, 0x90, 0x13, 0x43, 0x03, 0x00, 0x00, 0x89, 0x83, 0x16, 0x43, 0x03, 
-0x00, 0x00, 0x81, 0x9a, 0x17, 0x43, 0x03, 0x00, 0x00, 0x94, 0x99, 0x18, 0x43, 0x07, 0x00, 0x00, 
-0x00, 0xa3, 0x19, 0x43, 0x03, 0x00, 0x00, 0x93, 0x96, 0x1e, 0x43, 0x03, 0x00, 0x00, 0x86, 0x8f, 
-0x1f, 0x43, 0x03, 0x00, 0x00, 0x9e, 0x98, 0x26, 0x43, 0x03, 0x00, 0x00, 0x92, 0x9c, 0x2c, 0x43, 
-0x03, 0x00, 0x00, 0xa7, 0xa1, 0x2d, 0x43, 0x03, 0x00, 0x00, 0xa6, 0xa0, 0x2e, 0x43, 0x03, 0x00, 
-0x00, 0x8d, 0x95, 0x31, 0x43, 0x03, 0x00, 0x00, 0xa4, 0xa5, 0x00, 0x12, 0x43, 0x03, 0x00, 0x00, 
-0xa9, 0xa8, 0x16, 0x42, 0x03, 0x00, 0x00, 0xaa, 0x1e, 0x43, 0x03, 0x00, 0x00, 0xa5, 0xa4, 0x1f, 
-0x43, 0x03, 0x00, 0x00, 0x98, 0x97, 0x26, 0x43, 0x03, 0x00, 0x00, 0x88, 0x9d, 0x2c, 0x43, 0x03, 
-0x00, 0x00, 0xbe, 0xbd, 0x2d, 0x43, 0x03, 0x00, 0x00, 0xab, 0x8d, 0x2e, 0x43, 0x03, 0x00, 0x00, 
-0x86, 0x8f, 0x31, 0x43, 0x03, 0x00, 0x00, 0xe4, 0xe3, 0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 0x9b, 
-0x12, 0x43, 0x03, 0x00, 0x00, 0x91, 0x90, 0x18, 0x43, 0x07, 0x00, 0x00, 0x00, 0xa3, 0x1e, 0x43, 
-0x03, 0x00, 0x00, 0x86, 0x8f, 0x1f, 0x43, 0x03, 0x00, 0x00, 0x9e, 0x98, 0x26, 0x43, 0x03, 0x00, 
-0x00, 0x92, 0x9c, 0x2c, 0x43, 0x03, 0x00, 0x00, 0xa7, 0xa1, 0x2d, 0x43, 0x03, 0x00, 0x00, 0xa6, 
-0xa0, 0x2e, 0x43, 0x03, 0x00, 0x00, 0x8d, 0x95, 0x31, 0x43, 0x03, 0x00, 0x00, 0xa4, 0xa5, 0x00, 
-0x16, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x0d, 0x43, 0x00, 0xec, 0x9c, 0x3d, 0x2b, 0x10, 0x41, 
-0x00, 0xef, 0x9f, 0x11, 0x41, 0x00, 0xe8, 0x98, 0x12, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x13, 0xc1, 
-0x00, 0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0x41, 0x00, 0xa7, 0x87, 0x16, 
-0x41, 0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xf7, 0xf6, 0x18, 0x43, 0x0c, 0xae, 0x8e, 0xa0, 0xa0, 
-0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x43, 0x00, 0xa6, 0x86, 0x5b, 0x7b, 0x1b, 0x43, 0x00, 0xe7, 
-0x97, 0x5d, 0x7d, 0x1e, 0x41, 0x00, 0xa0, 0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 
-0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 0x41, 0x00, 0xf3, 0xf2, 0x23, 0x41, 0x00, 0xa3, 
-0x83, 0x24, 0x41, 0x00, 0xa9, 0x89, 0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 
-0x27, 0x43, 0x00, 0xf9, 0xf8, 0x3b, 0x3a, 0x28, 0x43, 0x00, 0xe9, 0x99, 0x27, 0x22, 0x29, 0x43, 
-0x00, 0xf5, 0xf4, 0x60, 0x7e, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x2b, 0x43, 0x00, 
-0xee, 0x9e, 0x5c, 0x7c, 0x2c, 0x41, 0x00, 0xa8, 0x88, 0x2d, 0x41, 0x00, 0xe5, 0x95, 0x2e, 0x41, 
-0x00, 0xe6, 0x96, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 
-0xad, 0x8d, 0x32, 0x41, 0x00, 0xac, 0x8c, 0x33, 0x02, 0x03, 0x00, 0x00, 0x3b, 0x34, 0x02, 0x03, 
-0x00, 0x00, 0x3a, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x7e, 0x00, 0x10, 0x41, 0x00, 0xef, 0x9f, 0x11, 0x41, 0x00, 0xe8, 0x98, 0x12, 0x42, 0x00, 
-0xa5, 0x85, 0xfb, 0x13, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 
-0x41, 0x00, 0xa7, 0x87, 0x16, 0x41, 0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xf9, 0xf8, 0x18, 0x43, 
-0x0c, 0xae, 0x8e, 0xa0, 0xa0, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x43, 0x00, 0xa6, 0x86, 0x5b, 
-0x7b, 0x1b, 0x43, 0x00, 0xe7, 0x97, 0x5d, 0x7d, 0x1e, 0x41, 0x00, 0xa0, 0x80, 0x1f, 0x41, 0x00, 
-0xe1, 0x91, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 0x41, 0x00, 0xec, 
-0x9c, 0x23, 0x41, 0x00, 0xa3, 0x83, 0x24, 0x41, 0x00, 0xa9, 0x89, 0x25, 0x41, 0x00, 0xaa, 0x8a, 
-0x26, 0x41, 0x00, 0xab, 0x8b, 0x27, 0x43, 0x00, 0xf7, 0xf6, 0x3b, 0x3a, 0x28, 0x43, 0x00, 0xed, 
-0x9d, 0x27, 0x22, 0x29, 0xc3, 0x00, 0xf1, 0x29, 0xf0, 0x00, 0x60, 0x29, 0x7e, 0x29, 0x2a, 0x04, 
-0x1f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x2b, 0x43, 0x00, 0xee, 0x9e, 0x5c, 0x7c, 0x2c, 0x41, 0x00, 
-0xeb, 0x9b, 0x2d, 0x41, 0x00, 0xe5, 0x95, 0x2e, 0x41, 0x00, 0xe6, 0x96, 0x2f, 0x41, 0x00, 0xa2, 
-0x82, 0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x41, 0x00, 0xac, 0x8c, 
-0x33, 0x02, 0x03, 0x00, 0x00, 0x3b, 0x34, 0x02, 0x03, 0x00, 0x00, 0x3a, 0x00, 0x12, 0x42, 0x03, 
-0x00, 0x00, 0xfb, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0xa4, 0xf5, 0x08, 0x04, 
-0xd6, 0x00, 0x50, 0x4c, 0x0d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x54, 0x03, 0x95, 0x03, 0x17, 0x04, 0x00, 0x00, 0x9c, 0x02, 0xd8, 0x04, 0x3e, 0x05, 0x00, 0x00, 
-0x5a, 0x03, 0xa7, 0x05, 0xae, 0x05, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0xae, 0x05, 0x00, 0x00, 
-0x9b, 0x02, 0x81, 0x01, 0x5a, 0x02, 0x00, 0x00, 0x16, 0x03, 0x81, 0x01, 0x5a, 0x02, 0x00, 0x00, 
-0xdf, 0x03, 0xe7, 0x01, 0x5a, 0x02, 0x00, 0x00, 0x50, 0x03, 0x2f, 0x07, 0x00, 0x00, 0x00, 0x00, 
-0x50, 0x03, 0x35, 0x06, 0x00, 0x00, 0x00, 0x00, 0x51, 0x03, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 
-0x51, 0x03, 0x94, 0x07, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xe3, 0xbd, 0x02, 0x30, 0x03, 0x00, 0x00, 
-0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xc8, 0x03, 0x01, 
-0x01, 0x00, 0x22, 0x04, 0x03, 0x07, 0x00, 0x00, 0xc9, 0x1e, 0x05, 0x01, 0x01, 0x00, 0xcf, 0x06, 
-0x02, 0x07, 0x00, 0x00, 0xca, 0x07, 0x01, 0x01, 0x00, 0x26, 0x08, 0x02, 0x05, 0x00, 0x2f, 0xcb, 
-0x09, 0x02, 0x01, 0x00, 0x28, 0xfa, 0x0a, 0x02, 0x05, 0x00, 0x29, 0xcc, 0x0b, 0x01, 0x01, 0x00, 
-0x3d, 0x0c, 0x02, 0x04, 0x2b, 0x3f, 0xcd, 0x0d, 0x02, 0x04, 0x27, 0x2a, 0xce, 0x10, 0x42, 0x03, 
-0x00, 0x00, 0x5c, 0x11, 0x42, 0x03, 0x00, 0x00, 0x7c, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0xc4, 
-0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0x75, 0x55, 
-0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x42, 0x03, 0xa0, 0xa0, 0xf6, 
-0x1b, 0x43, 0x03, 0xa0, 0xa0, 0x9e, 0x1b, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x21, 0x42, 0x03, 0x00, 
-0x00, 0x5b, 0x22, 0x42, 0x03, 0x00, 0x00, 0x5d, 0x27, 0x43, 0x03, 0xa0, 0xa0, 0x24, 0x1d, 0x28, 
-0x42, 0x03, 0xa0, 0xa0, 0xe1, 0x29, 0x10, 0x00, 0x00, 0x2b, 0x41, 0x02, 0xa2, 0xa0, 0x2c, 0xc4, 
-0x00, 0x79, 0x15, 0x59, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2e, 0x41, 0x00, 0x63, 0x43, 
-0x2f, 0x42, 0x03, 0x00, 0x00, 0x40, 0x30, 0x42, 0x03, 0x00, 0x00, 0x7b, 0x31, 0x42, 0x00, 0x6e, 
-0x4e, 0x7d, 0x32, 0x42, 0x03, 0x00, 0x00, 0xf5, 0x33, 0x02, 0x01, 0x00, 0x3b, 0x3c, 0x34, 0x02, 
-0x01, 0x00, 0x3a, 0x3e, 0x35, 0x03, 0x04, 0x2d, 0x5f, 0x00, 0x1f, 0x39, 0x00, 0x00, 0x20, 0x56, 
-0x01, 0x00, 0x3c, 0x3e, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x7e, 0x04, 0x02, 0x07, 0x00, 0x00, 
-0xc8, 0x05, 0x01, 0x03, 0x00, 0xa0, 0x06, 0x02, 0x03, 0x00, 0x00, 0xf8, 0x07, 0x02, 0x07, 0x00, 
-0x00, 0xc9, 0x08, 0x02, 0x07, 0x00, 0x00, 0xca, 0x09, 0x02, 0x07, 0x00, 0x00, 0xcb, 0x0a, 0x02, 
-0x07, 0x00, 0x00, 0xcc, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xcd, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xce, 
-0x1a, 0x41, 0x00, 0xa7, 0xa4, 0x1b, 0x42, 0x04, 0x9e, 0x8d, 0xa0, 0x1f, 0x41, 0x00, 0x73, 0x53, 
-0x27, 0x41, 0x00, 0x92, 0x9c, 0x28, 0x41, 0x00, 0x86, 0x91, 0x29, 0x01, 0x03, 0xc9, 0xcb, 0x2b, 
-0x41, 0x01, 0x00, 0xa6, 0x32, 0x42, 0x03, 0x00, 0x00, 0x15, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 
-0x7e, 0x04, 0x02, 0x07, 0x00, 0x00, 0xc8, 0x05, 0x01, 0x03, 0x00, 0xa0, 0x06, 0x02, 0x03, 0x00, 
-0x00, 0xf8, 0x07, 0x02, 0x07, 0x00, 0x00, 0xc9, 0x08, 0x02, 0x07, 0x00, 0x00, 0xca, 0x09, 0x02, 
-0x07, 0x00, 0x00, 0xcb, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xcc, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xcd, 
-0x0d, 0x02, 0x07, 0x00, 0x00, 0xce, 0x15, 0xc4, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x9b, 0x2c, 0x1a, 
-0x2c, 0x00, 0x2c, 0x1a, 0x41, 0x00, 0xa7, 0xa4, 0x1b, 0x42, 0x04, 0x9e, 0x8d, 0xa0, 0x1f, 0x41, 
-0x00, 0x73, 0x53, 0x27, 0x41, 0x00, 0x92, 0x9c, 0x28, 0x41, 0x00, 0x86, 0x91, 0x29, 0x01, 0x03, 
-0xc9, 0xcb, 0x2b, 0x41, 0x01, 0x00, 0xa6, 0x32, 0x42, 0x03, 0x00, 0x00, 0xa8, 0x00, 0x5e, 0x06, 
-0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 0x7e, 0x05, 0x61, 0x86, 
-0x65, 0x91, 0x41, 0x8f, 0x45, 0x90, 0x20, 0x7e, 0x60, 0x04, 0x61, 0x85, 0x65, 0x8a, 0x75, 0x97, 
-0x20, 0x60, 0xfa, 0x03, 0x7a, 0xa7, 0x5a, 0xa1, 0x20, 0xfa, 0x27, 0x0c, 0x63, 0x8d, 0x65, 0x82, 
-0x6e, 0xa4, 0x6f, 0xa2, 0x73, 0x9e, 0x7a, 0xa6, 0x43, 0x95, 0x4e, 0xa5, 0x4f, 0xa3, 0x53, 0x98, 
-0x5a, 0xa0, 0x20, 0x27, 0x22, 0x09, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 
-0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x2c, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0x2c, 
-0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xc8, 0x04, 0x02, 0x07, 0x00, 0x00, 0xc9, 0x05, 0x01, 0x03, 
-0x00, 0xa0, 0x06, 0x02, 0x03, 0x00, 0x00, 0xf8, 0x07, 0x02, 0x07, 0x00, 0x00, 0xca, 0x08, 0x02, 
-0x07, 0x00, 0x00, 0xcb, 0x09, 0x02, 0x07, 0x00, 0x00, 0xcc, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xcd, 
-0x0c, 0x02, 0x07, 0x00, 0x00, 0xce, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xcf, 0x15, 0xc4, 0x00, 0x7a, 
-0x2c, 0x5a, 0x2c, 0x9b, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x1a, 0x41, 0x00, 0xa7, 0xa4, 0x1b, 0x42, 
-0x04, 0x9e, 0x8d, 0xa0, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x27, 0x41, 0x00, 0x92, 0x9c, 0x28, 0x41, 
-0x00, 0x86, 0x91, 0x29, 0x01, 0x03, 0xca, 0xcc, 0x2b, 0x41, 0x01, 0x00, 0xa6, 0x32, 0x42, 0x03, 
-0x00, 0x00, 0xa8, 0x00, 0x7e, 0x03, 0x61, 0x84, 0x41, 0x8e, 0x20, 0x7e, 0x5e, 0x05, 0x65, 0x88, 
-0x69, 0x8c, 0x6f, 0x93, 0x4f, 0x96, 0x20, 0x5e, 0x2c, 0x05, 0x61, 0x86, 0x65, 0x91, 0x41, 0x8f, 
-0x45, 0x90, 0x20, 0x2c, 0x60, 0x06, 0x61, 0x85, 0x6f, 0x94, 0x75, 0x97, 0x4f, 0x99, 0x55, 0x9a, 
-0x20, 0x60, 0xfa, 0x03, 0x7a, 0xa7, 0x5a, 0xa1, 0x20, 0xfa, 0x27, 0x0d, 0x63, 0x8d, 0x65, 0x82, 
-0x6e, 0xa4, 0x6f, 0xa2, 0x73, 0x9e, 0x7a, 0xa6, 0x43, 0x95, 0x45, 0x8a, 0x4e, 0xa5, 0x4f, 0xa3, 
-0x53, 0x98, 0x5a, 0xa0, 0x20, 0x27, 0x22, 0x04, 0x65, 0x89, 0x69, 0x8b, 0x45, 0x83, 0x20, 0x22, 
-0x2d, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0x2c, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x7e, 0x03, 
-0x02, 0x07, 0x00, 0x00, 0xc8, 0x05, 0x02, 0x07, 0x00, 0x00, 0xca, 0x06, 0x02, 0x07, 0x00, 0x00, 
-0xcb, 0x07, 0x02, 0x07, 0x00, 0x00, 0xcc, 0x08, 0x02, 0x03, 0x00, 0x00, 0x60, 0x09, 0x02, 0x07, 
-0x00, 0x00, 0xcd, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xce, 0x0b, 0x02, 0x07, 0x00, 0x00, 0xcf, 0x0c, 
-0x02, 0x07, 0x00, 0x00, 0xd0, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xd1, 0x13, 0x41, 0x00, 0x72, 0x52, 
-0x14, 0x41, 0x00, 0x74, 0x54, 0x16, 0x42, 0x03, 0x00, 0x00, 0xaa, 0x1a, 0x41, 0x00, 0xbe, 0xe4, 
-0x1b, 0x41, 0x00, 0x98, 0x86, 0x1f, 0x42, 0x00, 0x73, 0x53, 0xd0, 0x20, 0x42, 0x00, 0x64, 0x44, 
-0xd1, 0x26, 0x41, 0x00, 0x6c, 0x4c, 0x27, 0x41, 0x00, 0x88, 0x9d, 0x28, 0x41, 0x00, 0xa5, 0xa9, 
-0x29, 0x01, 0x03, 0xcc, 0xcd, 0x2b, 0x41, 0x01, 0x00, 0xab, 0x00, 0xf3, 0x13, 0x63, 0x9f, 0x64, 
-0xd4, 0x65, 0xd8, 0x6c, 0x96, 0x6e, 0xe5, 0x72, 0xfd, 0x73, 0xe7, 0x74, 0x9c, 0x7a, 0xa7, 0x43, 
-0xac, 0x44, 0xd2, 0x45, 0xb7, 0x4c, 0x95, 0x4e, 0xd5, 0x52, 0xfc, 0x53, 0xe6, 0x54, 0x9b, 0x5a, 
-0xa6, 0x20, 0xf3, 0x5e, 0x07, 0x61, 0x83, 0x69, 0x8c, 0x6f, 0x93, 0x41, 0xb6, 0x49, 0xd7, 0x4f, 
-0xe2, 0x20, 0x5e, 0xf4, 0x03, 0x61, 0xc7, 0x41, 0xc6, 0x20, 0xf4, 0xf8, 0x03, 0x75, 0x85, 0x55, 
-0xde, 0x20, 0xf8, 0xf2, 0x05, 0x61, 0xa5, 0x65, 0xa9, 0x41, 0xa4, 0x45, 0xa8, 0x20, 0xf2, 0xfa, 
-0x03, 0x7a, 0xbe, 0x5a, 0xbd, 0x20, 0xfa, 0xef, 0x19, 0x61, 0xa0, 0x63, 0x86, 0x65, 0x82, 0x69, 
-0xa1, 0x6c, 0x92, 0x6e, 0xe4, 0x6f, 0xa2, 0x72, 0xea, 0x73, 0x98, 0x75, 0xa3, 0x79, 0xec, 0x7a, 
-0xab, 0x41, 0xb5, 0x43, 0x8f, 0x45, 0x90, 0x49, 0xd6, 0x4c, 0x91, 0x4e, 0xe3, 0x4f, 0xe0, 0x52, 
-0xe8, 0x53, 0x97, 0x55, 0xe9, 0x59, 0xed, 0x5a, 0x8d, 0x20, 0xef, 0xf1, 0x05, 0x6f, 0x8b, 0x75, 
-0xfb, 0x4f, 0x8a, 0x55, 0xeb, 0x20, 0xf1, 0xf9, 0x09, 0x61, 0x84, 0x65, 0x89, 0x6f, 0x94, 0x75, 
-0x81, 0x41, 0x8e, 0x45, 0xd3, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0xf7, 0x07, 0x63, 0x87, 0x73, 
-0xad, 0x74, 0xee, 0x43, 0x80, 0x53, 0xb8, 0x54, 0xdd, 0x20, 0xf7, 0x00, 0x02, 0x02, 0x03, 0x00, 
-0x00, 0x7e, 0x04, 0x02, 0x07, 0x00, 0x00, 0xc8, 0x05, 0x01, 0x03, 0x00, 0xa0, 0x06, 0x02, 0x03, 
-0x00, 0x00, 0xf8, 0x07, 0x02, 0x07, 0x00, 0x00, 0xc9, 0x08, 0x02, 0x07, 0x00, 0x00, 0xca, 0x09, 
-0x02, 0x07, 0x00, 0x00, 0xcb, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xcc, 0x0c, 0x02, 0x07, 0x00, 0x00, 
-0xcd, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xce, 0x1a, 0x41, 0x00, 0xbe, 0xe4, 0x1b, 0x42, 0x04, 0x98, 
-0x86, 0xa0, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x27, 0x41, 0x00, 0x88, 0x9d, 0x28, 0x41, 0x00, 0xa5, 
-0xa9, 0x29, 0x01, 0x03, 0xc9, 0xcb, 0x2b, 0x41, 0x01, 0x00, 0xab, 0x32, 0x42, 0x03, 0x00, 0x00, 
-0x15, 0x00, 0x5e, 0x05, 0x61, 0x83, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 0x7e, 0x05, 
-0x61, 0xa5, 0x65, 0xa9, 0x41, 0xa4, 0x45, 0xa8, 0x20, 0x7e, 0x60, 0x04, 0x61, 0x85, 0x65, 0x8a, 
-0x6f, 0x95, 0x20, 0x60, 0xfa, 0x03, 0x7a, 0xbe, 0x5a, 0xbd, 0x20, 0xfa, 0x27, 0x10, 0x61, 0xa0, 
-0x63, 0x86, 0x65, 0x82, 0x69, 0xa1, 0x6e, 0xe4, 0x6f, 0xa2, 0x73, 0x98, 0x75, 0xa3, 0x7a, 0xab, 
-0x43, 0x8f, 0x45, 0x90, 0x4e, 0xe3, 0x4f, 0xe0, 0x53, 0x97, 0x5a, 0x8d, 0x20, 0x27, 0x22, 0x09, 
-0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 
-0x20, 0x22, 0x2c, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0x2c, 0x00, 0x16, 0x42, 0x03, 0x00, 0x00, 
-0xd5, 0x00, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 
-0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 
-0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xf8, 0x03, 0x61, 0x86, 0x41, 0x8f, 
-0x20, 0xf8, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 
-0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 
-0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 
-0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 
-0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 
-0xf7, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0xf7, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x01, 0x03, 0x00, 0xa0, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x08, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x10, 0x41, 
-0x00, 0xef, 0x9f, 0x11, 0x41, 0x00, 0xe8, 0x98, 0x12, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x13, 0xc1, 
-0x00, 0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0xc4, 0x00, 0xa7, 0x2c, 0x87, 
-0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xf7, 
-0xf6, 0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x42, 0x04, 0xa6, 0x86, 
-0xa0, 0x1b, 0x42, 0x04, 0xe7, 0x97, 0xa0, 0x1e, 0x41, 0x00, 0xa0, 0x80, 0x1f, 0x41, 0x00, 0xe1, 
-0x91, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 0x41, 0x00, 0xf3, 0xf2, 
-0x23, 0x41, 0x00, 0xa3, 0x83, 0x24, 0x41, 0x00, 0xa9, 0x89, 0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 
-0x41, 0x00, 0xab, 0x8b, 0x27, 0x41, 0x00, 0xf9, 0xf8, 0x28, 0x42, 0x04, 0xe9, 0x99, 0xa0, 0x29, 
-0x41, 0x00, 0xf5, 0xf4, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x2b, 0x41, 0x00, 0xee, 
-0x9e, 0x2c, 0xc4, 0x00, 0xa8, 0x15, 0x88, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 0x41, 
-0x00, 0xe5, 0x95, 0x2e, 0x41, 0x00, 0xe6, 0x96, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 0x00, 
-0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x42, 0x04, 0xac, 0x8c, 0xa0, 0x56, 0x41, 0x00, 
-0xec, 0x9c, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 
-0x01, 0x03, 0x00, 0xa0, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x08, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0c, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x1a, 0x10, 
-0x00, 0x00, 0x1b, 0x02, 0x07, 0xa0, 0xa0, 0xa0, 0x27, 0x01, 0x03, 0xa0, 0xa0, 0x28, 0x10, 0x00, 
-0x00, 0x29, 0x10, 0x00, 0x00, 0x2b, 0x10, 0x00, 0x00, 0x32, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x36, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x05, 0x01, 0x03, 0x00, 0xa0, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x08, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x10, 0x41, 0x00, 
-0xef, 0x9f, 0x11, 0x41, 0x00, 0xe8, 0x98, 0x12, 0x42, 0x00, 0xa5, 0x85, 0xfb, 0x13, 0xc1, 0x00, 
-0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0xc4, 0x00, 0xa7, 0x2c, 0x87, 0x2c, 
-0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xf9, 0xf8, 
-0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x42, 0x04, 0xa6, 0x86, 0xa0, 
-0x1b, 0x42, 0x04, 0xe7, 0x97, 0xa0, 0x1e, 0x41, 0x00, 0xa0, 0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 
-0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 0x41, 0x00, 0xec, 0x9c, 0x23, 
-0x41, 0x00, 0xa3, 0x83, 0x24, 0x41, 0x00, 0xa9, 0x89, 0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 
-0x00, 0xab, 0x8b, 0x27, 0x41, 0x00, 0xf7, 0xf6, 0x28, 0x42, 0x04, 0xed, 0x9d, 0xa0, 0x29, 0xc1, 
-0x00, 0xf1, 0x29, 0xf0, 0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x81, 0x2b, 0x41, 0x00, 
-0xee, 0x9e, 0x2c, 0xc4, 0x00, 0xeb, 0x15, 0x9b, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 
-0x41, 0x00, 0xe5, 0x95, 0x2e, 0x41, 0x00, 0xe6, 0x96, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 
-0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x42, 0x04, 0xac, 0x8c, 0xa0, 0x00, 0x02, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x01, 0x03, 0x00, 0xa0, 
-0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x08, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfb, 0x1a, 0x10, 0x00, 0x00, 0x1b, 0x02, 
-0x07, 0xa0, 0xa0, 0xa0, 0x27, 0x01, 0x03, 0xa0, 0xa0, 0x28, 0x10, 0x00, 0x00, 0x29, 0x10, 0x00, 
-0x00, 0x2b, 0x10, 0x00, 0x00, 0x32, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x36, 0x04, 0x1f, 0x00, 0x00, 
-0x00, 0x00, 0x82, 0x00, 0xb4, 0xd1, 0x01, 0x09, 0x00, 0x00, 0x50, 0x4f, 0x2c, 0xa3, 0x00, 0x50, 
-0x4f, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xe3, 
-0x00, 0xf0, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x5c, 0x03, 0x67, 
-0x01, 0x6e, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0x22, 0x40, 0x04, 0x02, 0x03, 0x00, 0x00, 
-0x9c, 0x05, 0x02, 0x03, 0x00, 0x00, 0xf5, 0x07, 0x01, 0x01, 0x00, 0x26, 0x08, 0x02, 0x01, 0x00, 
-0x2f, 0x7b, 0x09, 0x03, 0x01, 0x00, 0x28, 0x5b, 0x1b, 0x0a, 0x03, 0x01, 0x00, 0x29, 0x5d, 0x1d, 
-0x0b, 0x02, 0x01, 0x00, 0x3d, 0x7d, 0x0c, 0x01, 0x00, 0x27, 0x3f, 0x0d, 0x01, 0x00, 0xae, 0xaf, 
-0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 
-0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x02, 0x04, 0x2b, 0x2a, 0xcc, 0x1b, 
-0x01, 0x03, 0xcb, 0xc8, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x27, 0x41, 0x00, 0x87, 0x80, 0x28, 0x01, 
-0x00, 0xa7, 0xa6, 0x29, 0x03, 0x04, 0x5c, 0x7c, 0x00, 0x1c, 0x2b, 0x03, 0x07, 0xc9, 0xca, 0x00, 
-0x1e, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x33, 0x02, 0x01, 0x00, 0x3b, 0x3c, 0x34, 0x02, 0x01, 0x00, 
-0x3a, 0x3e, 0x35, 0x03, 0x04, 0x2d, 0x5f, 0x00, 0x1f, 0x39, 0x00, 0x00, 0x20, 0x56, 0x02, 0x04, 
-0x3c, 0x3e, 0xcc, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 
-0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 
-0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 
-0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 
-0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 
-0x5e, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 
-0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 
-0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 
-0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 0x15, 0x00, 0x60, 
-0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0x91, 0x45, 0x92, 0x49, 
-0x98, 0x4f, 0xa9, 0x55, 0x9d, 0x20, 0x60, 0x7e, 0x07, 0x61, 0x84, 0x6e, 0xa4, 0x6f, 0x94, 0x41, 
-0x8e, 0x4e, 0xa5, 0x4f, 0x99, 0x20, 0x7e, 0x5e, 0x07, 0x61, 0x83, 0x65, 0x88, 0x6f, 0x93, 0x41, 
-0x8f, 0x45, 0x89, 0x4f, 0x8c, 0x20, 0x5e, 0x27, 0x0b, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 
-0xa2, 0x75, 0xa3, 0x41, 0x86, 0x45, 0x90, 0x49, 0x8b, 0x4f, 0x9f, 0x55, 0x96, 0x20, 0x27, 0x22, 
-0x03, 0x75, 0x81, 0x55, 0x9a, 0x20, 0x22, 0x00, 0xe0, 0x70, 0x02, 0x19, 0x00, 0x00, 0x52, 0x48, 
-0x2c, 0x00, 0x00, 0x55, 0x53, 0x44, 0x56, 0x52, 0x2c, 0x67, 0x00, 0x52, 0x48, 0x2c, 0x67, 0x00, 
-0x55, 0x53, 0x44, 0x56, 0x52, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x5a, 0x03, 0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xb5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x06, 0xc4, 0x00, 0x6a, 0x24, 0x4a, 0x24, 0x0a, 0x24, 0x00, 0x24, 0x00, 0x24, 0x07, 0xc4, 
-0x00, 0x6c, 0x26, 0x4c, 0x26, 0x0c, 0x26, 0x00, 0x26, 0x00, 0x26, 0x08, 0xc4, 0x00, 0x6d, 0x32, 
-0x4d, 0x32, 0x0d, 0x32, 0x00, 0x32, 0x00, 0x32, 0x09, 0xc4, 0x00, 0x66, 0x21, 0x46, 0x21, 0x06, 
-0x21, 0x00, 0x21, 0x00, 0x21, 0x0a, 0xc4, 0x00, 0x70, 0x19, 0x50, 0x19, 0x10, 0x19, 0x00, 0x19, 
-0x00, 0x19, 0x0b, 0x84, 0x00, 0x2f, 0x35, 0x3f, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x0c, 
-0x84, 0x00, 0x5b, 0x1a, 0x7b, 0x1a, 0x1b, 0x1a, 0x00, 0x1a, 0x00, 0x1a, 0x0d, 0x84, 0x00, 0x5d, 
-0x1b, 0x7d, 0x1b, 0x1d, 0x1b, 0x00, 0x1b, 0x00, 0x1b, 0x10, 0x84, 0x00, 0x35, 0x06, 0x25, 0x06, 
-0x00, 0x06, 0x00, 0x7d, 0x00, 0x7d, 0x11, 0x84, 0x00, 0x36, 0x07, 0x5e, 0x07, 0x1e, 0x07, 0x00, 
-0x7e, 0x00, 0x7e, 0x12, 0xc4, 0x00, 0x71, 0x10, 0x51, 0x10, 0x11, 0x10, 0x00, 0x10, 0x00, 0x10, 
-0x13, 0x84, 0x00, 0x2e, 0x34, 0x3e, 0x34, 0x00, 0x34, 0x00, 0x34, 0x00, 0x34, 0x14, 0xc4, 0x00, 
-0x6f, 0x18, 0x4f, 0x18, 0x0f, 0x18, 0x00, 0x18, 0x00, 0x18, 0x15, 0xc4, 0x00, 0x72, 0x13, 0x52, 
-0x13, 0x12, 0x13, 0x00, 0x13, 0x00, 0x13, 0x16, 0xc4, 0x00, 0x73, 0x1f, 0x53, 0x1f, 0x13, 0x1f, 
-0x00, 0x1f, 0x00, 0x1f, 0x17, 0xc4, 0x00, 0x75, 0x16, 0x55, 0x16, 0x15, 0x16, 0x00, 0x16, 0x00, 
-0x16, 0x18, 0xc4, 0x00, 0x79, 0x15, 0x59, 0x15, 0x19, 0x15, 0x00, 0x15, 0x00, 0x15, 0x19, 0xc4, 
-0x00, 0x62, 0x30, 0x42, 0x30, 0x02, 0x30, 0x00, 0x30, 0x00, 0x30, 0x1a, 0x84, 0x00, 0x3b, 0x27, 
-0x3a, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x1b, 0x84, 0x00, 0x3d, 0x0d, 0x2b, 0x0d, 0x00, 
-0x0d, 0x00, 0x83, 0x00, 0x83, 0x1e, 0x84, 0x00, 0x37, 0x08, 0x26, 0x08, 0x00, 0x08, 0x00, 0x7f, 
-0x00, 0x7f, 0x1f, 0x84, 0x00, 0x38, 0x09, 0x2a, 0x09, 0x00, 0x09, 0x00, 0x80, 0x00, 0x80, 0x20, 
-0xc4, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x21, 0xc4, 0x00, 0x61, 
-0x1e, 0x41, 0x1e, 0x01, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x22, 0xc4, 0x00, 0x65, 0x12, 0x45, 0x12, 
-0x05, 0x12, 0x00, 0x12, 0x00, 0x12, 0x24, 0xc4, 0x00, 0x74, 0x14, 0x54, 0x14, 0x14, 0x14, 0x00, 
-0x14, 0x00, 0x14, 0x25, 0xc4, 0x00, 0x64, 0x20, 0x44, 0x20, 0x04, 0x20, 0x00, 0x20, 0x00, 0x20, 
-0x26, 0xc4, 0x00, 0x63, 0x2e, 0x43, 0x2e, 0x03, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x27, 0xc4, 0x00, 
-0x6b, 0x25, 0x4b, 0x25, 0x0b, 0x25, 0x00, 0x25, 0x00, 0x25, 0x28, 0x84, 0x00, 0x2d, 0x0c, 0x5f, 
-0x0c, 0x1f, 0x0c, 0x00, 0x82, 0x00, 0x82, 0x2c, 0x84, 0x00, 0x39, 0x0a, 0x28, 0x0a, 0x00, 0x0a, 
-0x00, 0x80, 0x00, 0x80, 0x2d, 0x84, 0x00, 0x30, 0x0b, 0x29, 0x0b, 0x00, 0x0b, 0x00, 0x81, 0x00, 
-0x81, 0x2e, 0xc4, 0x00, 0x78, 0x2d, 0x58, 0x2d, 0x18, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x2f, 0x84, 
-0x00, 0x2c, 0x33, 0x3c, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x30, 0xc4, 0x00, 0x69, 0x17, 
-0x49, 0x17, 0x09, 0x17, 0x00, 0x17, 0x00, 0x17, 0x32, 0xc4, 0x00, 0x77, 0x11, 0x57, 0x11, 0x17, 
-0x11, 0x00, 0x11, 0x00, 0x11, 0x33, 0xc4, 0x00, 0x76, 0x2f, 0x56, 0x2f, 0x16, 0x2f, 0x00, 0x2f, 
-0x00, 0x2f, 0x34, 0xc4, 0x00, 0x67, 0x22, 0x47, 0x22, 0x07, 0x22, 0x00, 0x22, 0x00, 0x22, 0x35, 
-0x84, 0x00, 0x27, 0x28, 0x22, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x22, 0xc4, 0x00, 
-0x65, 0x12, 0x45, 0x12, 0x05, 0x12, 0xd5, 0x12, 0x00, 0x12, 0x00, 0xc3, 0x40, 0x03, 0x09, 0x00, 
-0x00, 0x53, 0x46, 0x2c, 0x96, 0x00, 0x53, 0x46, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xeb, 0x01, 0xf4, 0x01, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 
-0xf4, 0x01, 0x00, 0x00, 0xb5, 0x01, 0x7c, 0x01, 0x9c, 0x01, 0x00, 0x00, 0x5b, 0x03, 0x6f, 0x02, 
-0xb9, 0x02, 0x00, 0x00, 0x40, 0x40, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0c, 0x40, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x09, 0x00, 
-0x2b, 0x2b, 0x00, 0x7c, 0x03, 0x04, 0x09, 0x00, 0x22, 0x22, 0x00, 0x40, 0x04, 0x04, 0x09, 0x00, 
-0x2a, 0x2a, 0x00, 0x23, 0x05, 0x04, 0x09, 0x00, 0x87, 0x87, 0x00, 0xf8, 0x06, 0x04, 0x0f, 0x00, 
-0x00, 0x00, 0x00, 0xf5, 0x07, 0x04, 0x09, 0x00, 0x26, 0x26, 0x00, 0xaa, 0x08, 0x04, 0x09, 0x00, 
-0x2f, 0x2f, 0x00, 0xdd, 0x09, 0x04, 0x09, 0x00, 0x28, 0x28, 0x00, 0xbd, 0x0a, 0x02, 0x01, 0x00, 
-0x29, 0x29, 0x0b, 0x02, 0x01, 0x00, 0x3d, 0x3d, 0x0c, 0x04, 0x10, 0x27, 0x3f, 0x3f, 0x27, 0xcb, 
-0x0d, 0x05, 0x1f, 0xca, 0xc8, 0xc8, 0xca, 0xc9, 0x1e, 0x12, 0x03, 0x00, 0x65, 0x45, 0x65, 0x45, 
-0x15, 0x86, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x7a, 0x2c, 0x5a, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 
-0x2c, 0x16, 0x03, 0x00, 0x75, 0x55, 0x75, 0x55, 0x17, 0x03, 0x00, 0x69, 0x49, 0x69, 0x49, 0x18, 
-0x03, 0x00, 0x6f, 0x4f, 0x6f, 0x4f, 0x1a, 0x04, 0x00, 0x8a, 0x81, 0x9a, 0xd4, 0x5b, 0x1b, 0x04, 
-0x09, 0xcc, 0x21, 0x21, 0xcc, 0x5d, 0x1e, 0x03, 0x00, 0x61, 0x41, 0x61, 0x41, 0x1f, 0x04, 0x0f, 
-0x00, 0x00, 0x00, 0x00, 0xe1, 0x27, 0x03, 0x00, 0x82, 0x94, 0x99, 0x90, 0x28, 0x04, 0x00, 0x85, 
-0x84, 0x8e, 0xb7, 0x7b, 0x29, 0x03, 0x00, 0xf5, 0xf8, 0xf8, 0xf5, 0x2b, 0x04, 0x00, 0x24, 0x9c, 
-0x9c, 0x24, 0x7d, 0x2c, 0x86, 0x00, 0x79, 0x15, 0x59, 0x15, 0x79, 0x15, 0x59, 0x15, 0x00, 0x15, 
-0x19, 0x15, 0x00, 0x15, 0x2e, 0x03, 0x00, 0x63, 0x43, 0x63, 0x43, 0x31, 0x03, 0x00, 0x6e, 0x4e, 
-0x6e, 0x4e, 0x32, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x33, 0x04, 0x09, 0x00, 0x3b, 0x3b, 
-0x00, 0x3c, 0x34, 0x04, 0x09, 0x00, 0x3a, 0x3a, 0x00, 0x3e, 0x35, 0x05, 0x00, 0x2d, 0x5f, 0x5f, 
-0x2d, 0x5c, 0x1f, 0x39, 0x03, 0x06, 0x20, 0x00, 0x00, 0x20, 0x56, 0x05, 0x00, 0x3c, 0x3e, 0x3e, 
-0x3c, 0x5c, 0x1c, 0x00, 0x06, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x15, 0x08, 0x04, 0x1f, 0x00, 
-0x00, 0x00, 0x00, 0xa0, 0x09, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x29, 0x03, 0x06, 0x15, 
-0x00, 0x00, 0x15, 0x00, 0x60, 0x06, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 
-0x20, 0x60, 0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x06, 0x61, 0x83, 0x65, 0x88, 
-0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 0x27, 0x09, 0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 
-0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x43, 0x80, 0x45, 0x90, 0x20, 0x27, 0x22, 0x0a, 0x61, 0x84, 
-0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 
-0x20, 0x22, 0x00, 0x12, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x60, 0x0b, 0x61, 0x85, 
-0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 
-0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 
-0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 
-0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 0x0f, 0x61, 0xa0, 
-0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x43, 0x80, 
-0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 
-0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 
-0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0x00, 0x08, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x10, 
-0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x92, 0x12, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x17, 
-0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xac, 0x18, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xab, 0x1e, 
-0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x91, 0x2c, 0x86, 0x00, 0x79, 0x15, 0x59, 0x15, 0x79, 0x15, 
-0x59, 0x15, 0xae, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xaf, 
-0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 
-0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 
-0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 
-0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 
-0x5e, 0x27, 0x0f, 0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 
-0xec, 0x41, 0xb5, 0x43, 0x80, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 
-0x27, 0x22, 0x0d, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 
-0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x00, 0x63, 0x7b, 
-0x02, 0x13, 0x00, 0x00, 0x53, 0x47, 0x2c, 0x00, 0x00, 0x53, 0x44, 0x2c, 0x96, 0x00, 0x53, 0x47, 
-0x2c, 0x96, 0x00, 0x53, 0x44, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x5a, 0x03, 0xe3, 0x01, 0xec, 0x01, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0xec, 0x01, 0x00, 
-0x00, 0xb5, 0x01, 0x74, 0x01, 0x94, 0x01, 0x00, 0x00, 0x40, 0x40, 0x0c, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x40, 0x00, 0x0c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x02, 0x04, 0x09, 0x00, 0x2b, 0x2b, 0x00, 0x7c, 0x03, 0x04, 0x09, 0x00, 0x22, 0x22, 0x00, 
-0x40, 0x04, 0x04, 0x09, 0x00, 0x2a, 0x2a, 0x00, 0x23, 0x05, 0x04, 0x09, 0x00, 0x87, 0x87, 0x00, 
-0xf8, 0x06, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x07, 0x04, 0x09, 0x00, 0x26, 0x26, 0x00, 
-0xaa, 0x08, 0x04, 0x09, 0x00, 0x2f, 0x2f, 0x00, 0xdd, 0x09, 0x04, 0x09, 0x00, 0x28, 0x28, 0x00, 
-0xbd, 0x0a, 0x02, 0x01, 0x00, 0x29, 0x29, 0x0b, 0x02, 0x01, 0x00, 0x3d, 0x3d, 0x0c, 0x04, 0x10, 
-0x27, 0x3f, 0x3f, 0x27, 0xcb, 0x0d, 0x05, 0x1f, 0xca, 0xc8, 0xc8, 0xca, 0xc9, 0x1e, 0x12, 0x03, 
-0x00, 0x65, 0x45, 0x65, 0x45, 0x15, 0x86, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x7a, 0x2c, 0x5a, 0x2c, 
-0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x03, 0x00, 0x75, 0x55, 0x75, 0x55, 0x17, 0x03, 0x00, 
-0x69, 0x49, 0x69, 0x49, 0x18, 0x03, 0x00, 0x6f, 0x4f, 0x6f, 0x4f, 0x1a, 0x04, 0x00, 0x81, 0x8a, 
-0xd4, 0x9a, 0x5b, 0x1b, 0x04, 0x09, 0xcc, 0x21, 0x21, 0xcc, 0x5d, 0x1e, 0x03, 0x00, 0x61, 0x41, 
-0x61, 0x41, 0x1f, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x27, 0x03, 0x00, 0x94, 0x82, 0x90, 
-0x99, 0x28, 0x04, 0x00, 0x84, 0x85, 0xb7, 0x8e, 0x7b, 0x29, 0x03, 0x00, 0xf5, 0xf8, 0xf8, 0xf5, 
-0x2b, 0x04, 0x00, 0x24, 0x9c, 0x9c, 0x24, 0x7d, 0x2c, 0x86, 0x00, 0x79, 0x15, 0x59, 0x15, 0x79, 
-0x15, 0x59, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2e, 0x03, 0x00, 0x63, 0x43, 0x63, 0x43, 
-0x31, 0x03, 0x00, 0x6e, 0x4e, 0x6e, 0x4e, 0x32, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x33, 
-0x04, 0x09, 0x00, 0x3b, 0x3b, 0x00, 0x3c, 0x34, 0x04, 0x09, 0x00, 0x3a, 0x3a, 0x00, 0x3e, 0x35, 
-0x05, 0x00, 0x2d, 0x5f, 0x5f, 0x2d, 0x5c, 0x1f, 0x39, 0x03, 0x06, 0x20, 0x00, 0x00, 0x20, 0x56, 
-0x05, 0x00, 0x3c, 0x3e, 0x3e, 0x3c, 0x5c, 0x1c, 0x00, 0x06, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 
-0x15, 0x08, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x09, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 
-0x9b, 0x29, 0x03, 0x06, 0x15, 0x00, 0x00, 0x15, 0x00, 0x60, 0x06, 0x61, 0x85, 0x65, 0x8a, 0x69, 
-0x8d, 0x6f, 0x95, 0x75, 0x97, 0x20, 0x60, 0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 
-0x06, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 0x27, 0x09, 0x61, 
-0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x43, 0x80, 0x45, 0x90, 0x20, 
-0x27, 0x22, 0x0a, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 
-0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x00, 0x12, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xd5, 
-0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 
-0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 
-0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 
-0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 
-0x5e, 0xef, 0x0f, 0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 
-0xec, 0x41, 0xb5, 0x43, 0x80, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 
-0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 
-0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0x00, 0xef, 0xf0, 0x03, 0x09, 
-0x00, 0x00, 0x53, 0x4b, 0x2c, 0xf5, 0x00, 0x53, 0x4b, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x03, 0x49, 0x01, 0xc1, 0x01, 0x00, 0x00, 0x5a, 0x03, 0x82, 
-0x02, 0x89, 0x02, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x89, 0x02, 0x00, 0x00, 0x63, 0x03, 0x10, 
-0x03, 0x79, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 
-0x2b, 0x31, 0xc8, 0x03, 0x01, 0x01, 0xa0, 0x32, 0x04, 0x03, 0x05, 0xa0, 0x33, 0xc9, 0x1e, 0x05, 
-0x01, 0x01, 0xa0, 0x34, 0x06, 0x02, 0x05, 0xa0, 0x35, 0xca, 0x07, 0x01, 0x01, 0xa0, 0x36, 0x08, 
-0x02, 0x04, 0xec, 0x37, 0xcb, 0x09, 0x02, 0x00, 0xa0, 0x38, 0xfa, 0x0a, 0x02, 0x04, 0xa1, 0x39, 
-0xcc, 0x0b, 0x01, 0x00, 0x82, 0x30, 0x0c, 0x02, 0x04, 0x3d, 0x25, 0xcd, 0x0d, 0x02, 0x07, 0xcc, 
-0xa0, 0xce, 0x10, 0x42, 0x03, 0x00, 0x00, 0x5c, 0x11, 0x42, 0x03, 0x00, 0x00, 0x7c, 0x12, 0x41, 
-0x00, 0x65, 0x45, 0x15, 0xc4, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 
-0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x19, 
-0x42, 0x03, 0x00, 0x00, 0x27, 0x1a, 0x02, 0x00, 0xa3, 0x2f, 0xf6, 0x1b, 0x02, 0x00, 0x84, 0x28, 
-0x9e, 0x1e, 0x42, 0x00, 0x61, 0x41, 0x3c, 0x21, 0x42, 0x03, 0x00, 0x00, 0x5b, 0x22, 0x42, 0x03, 
-0x00, 0x00, 0x5d, 0x27, 0x02, 0x00, 0x93, 0x22, 0x24, 0x28, 0x02, 0x00, 0xf5, 0x21, 0xe1, 0x29, 
-0x01, 0x02, 0x3b, 0xca, 0x2b, 0x02, 0x01, 0xa0, 0x29, 0xcf, 0x2c, 0xc4, 0x00, 0x79, 0x15, 0x59, 
-0x15, 0x3e, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 0x42, 0x03, 0x00, 0x00, 0x23, 0x2e, 0x42, 0x00, 
-0x63, 0x43, 0x26, 0x2f, 0x42, 0x03, 0x00, 0x00, 0x40, 0x30, 0x42, 0x03, 0x00, 0x00, 0x7b, 0x31, 
-0x42, 0x00, 0x6e, 0x4e, 0x7d, 0x33, 0x01, 0x01, 0x00, 0x3f, 0x34, 0x02, 0x01, 0x00, 0x3a, 0x2a, 
-0x35, 0x03, 0x04, 0x2d, 0x5f, 0x00, 0x1f, 0x39, 0x00, 0x00, 0x20, 0x56, 0x02, 0x00, 0x26, 0x2a, 
-0x3c, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x7e, 0x03, 0x02, 0x06, 0x96, 0x00, 0xc8, 0x04, 0x00, 
-0x00, 0xe7, 0x05, 0x02, 0x06, 0x9f, 0x00, 0xca, 0x06, 0x02, 0x06, 0x9c, 0x00, 0xcb, 0x07, 0x02, 
-0x06, 0xa7, 0x00, 0xcc, 0x08, 0x02, 0x03, 0x00, 0x00, 0x60, 0x09, 0x02, 0x07, 0x00, 0x00, 0xcd, 
-0x0a, 0x02, 0x07, 0x00, 0x00, 0xce, 0x0b, 0x02, 0x07, 0x00, 0x00, 0xcf, 0x0c, 0x02, 0x07, 0x00, 
-0x00, 0xd0, 0x0d, 0x02, 0x07, 0xce, 0xc8, 0xd1, 0x12, 0x42, 0x03, 0x00, 0x00, 0xaa, 0x13, 0x41, 
-0x00, 0x72, 0x52, 0x14, 0x41, 0x00, 0x74, 0x54, 0x1f, 0x42, 0x00, 0x73, 0x53, 0xd0, 0x20, 0x42, 
-0x00, 0x64, 0x44, 0xd1, 0x25, 0x42, 0x03, 0x00, 0x00, 0x88, 0x26, 0x42, 0x00, 0x6c, 0x4c, 0x9d, 
-0x29, 0x01, 0x03, 0x00, 0xcb, 0x2b, 0x00, 0x00, 0xe5, 0x00, 0xf3, 0x13, 0x63, 0x9f, 0x64, 0xd4, 
-0x65, 0xd8, 0x6c, 0x96, 0x6e, 0xe5, 0x72, 0xfd, 0x73, 0xe7, 0x74, 0x9c, 0x7a, 0xa7, 0x43, 0xac, 
-0x44, 0xd2, 0x45, 0xb7, 0x4c, 0x95, 0x4e, 0xd5, 0x52, 0xfc, 0x53, 0xe6, 0x54, 0x9b, 0x5a, 0xa6, 
-0x20, 0xf3, 0x5e, 0x07, 0x61, 0x83, 0x69, 0x8c, 0x6f, 0x93, 0x41, 0xb6, 0x49, 0xd7, 0x4f, 0xe2, 
-0x20, 0x5e, 0xf4, 0x03, 0x61, 0xc7, 0x41, 0xc6, 0x20, 0xf4, 0xf8, 0x03, 0x75, 0x85, 0x55, 0xde, 
-0x20, 0xf8, 0xf2, 0x05, 0x61, 0xa5, 0x65, 0xa9, 0x41, 0xa4, 0x45, 0xa8, 0x20, 0xf2, 0xfa, 0x03, 
-0x7a, 0xbe, 0x5a, 0xbd, 0x20, 0xfa, 0xef, 0x19, 0x61, 0xa0, 0x63, 0x86, 0x65, 0x82, 0x69, 0xa1, 
-0x6c, 0x92, 0x6e, 0xe4, 0x6f, 0xa2, 0x72, 0xea, 0x73, 0x98, 0x75, 0xa3, 0x79, 0xec, 0x7a, 0xab, 
-0x41, 0xb5, 0x43, 0x8f, 0x45, 0x90, 0x49, 0xd6, 0x4c, 0x91, 0x4e, 0xe3, 0x4f, 0xe0, 0x52, 0xe8, 
-0x53, 0x97, 0x55, 0xe9, 0x59, 0xed, 0x5a, 0x8d, 0x20, 0xef, 0xf1, 0x05, 0x6f, 0x8b, 0x75, 0xfb, 
-0x4f, 0x8a, 0x55, 0xeb, 0x20, 0xf1, 0xf9, 0x09, 0x61, 0x84, 0x65, 0x89, 0x6f, 0x94, 0x75, 0x81, 
-0x41, 0x8e, 0x45, 0xd3, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0xf7, 0x07, 0x63, 0x87, 0x73, 0xad, 
-0x74, 0xee, 0x43, 0x80, 0x53, 0xb8, 0x54, 0xdd, 0x20, 0xf7, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 
-0xd5, 0x00, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 
-0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 
-0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xf8, 0x03, 0x61, 0x86, 0x41, 0x8f, 
-0x20, 0xf8, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 
-0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x27, 0x0d, 0x61, 0xa0, 0x65, 0x82, 
-0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 
-0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 
-0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 
-0xf7, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0xf7, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x7e, 0x03, 
-0x02, 0x06, 0x8c, 0x00, 0xc8, 0x04, 0x00, 0x00, 0xa8, 0x05, 0x00, 0x00, 0x87, 0x06, 0x00, 0x00, 
-0x9f, 0x07, 0x00, 0x00, 0x91, 0x08, 0x02, 0x02, 0x98, 0x00, 0x60, 0x09, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xcb, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xcc, 0x0d, 0x02, 0x07, 
-0xcb, 0xc8, 0xa0, 0x13, 0x41, 0x00, 0x72, 0x52, 0x14, 0x41, 0x00, 0x74, 0x54, 0x1b, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x20, 0x41, 0x00, 0x64, 0x44, 0x26, 0x41, 0x00, 
-0x6c, 0x4c, 0x28, 0x00, 0x00, 0xad, 0x29, 0x01, 0x03, 0x00, 0xca, 0x2b, 0x02, 0x06, 0xa4, 0x00, 
-0xa0, 0x00, 0x76, 0x13, 0x63, 0x87, 0x64, 0x83, 0x65, 0x88, 0x6c, 0x8c, 0x6e, 0xa4, 0x72, 0xa9, 
-0x73, 0xa8, 0x74, 0x9f, 0x7a, 0x91, 0x43, 0x80, 0x44, 0x85, 0x45, 0x89, 0x4c, 0x9c, 0x4e, 0xa5, 
-0x52, 0x9e, 0x53, 0x9b, 0x54, 0x86, 0x5a, 0x92, 0x20, 0x76, 0x5e, 0x03, 0x6f, 0x93, 0x4f, 0xa7, 
-0x20, 0x5e, 0xf8, 0x03, 0x75, 0x96, 0x55, 0xa6, 0x20, 0xf8, 0x27, 0x11, 0x61, 0xa0, 0x65, 0x82, 
-0x69, 0xa1, 0x6c, 0x8d, 0x6f, 0xa2, 0x72, 0xaa, 0x75, 0xa3, 0x79, 0x98, 0x41, 0x8f, 0x45, 0x90, 
-0x49, 0x8b, 0x4c, 0x8a, 0x4f, 0x95, 0x52, 0xab, 0x55, 0x97, 0x59, 0x9d, 0x20, 0x27, 0x22, 0x07, 
-0x61, 0x84, 0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x00, 0x9b, 
-0x44, 0x02, 0x1d, 0x00, 0x00, 0x53, 0x50, 0x2c, 0x00, 0x00, 0x45, 0x53, 0x2c, 0xac, 0x00, 0x53, 
-0x50, 0x2c, 0xac, 0x00, 0x45, 0x53, 0x2c, 0xad, 0x00, 0x53, 0x50, 0x2c, 0xad, 0x00, 0x45, 0x53, 
-0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0x40, 0x01, 
-0x4d, 0x01, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x4d, 0x01, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 
-0xf5, 0x00, 0x00, 0x00, 0x37, 0x75, 0xc4, 0x01, 0xf5, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 
-0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x7c, 0x03, 0x02, 0x01, 0x00, 0x22, 0x40, 
-0x04, 0x02, 0x01, 0x00, 0xfa, 0x23, 0x05, 0x02, 0x07, 0x00, 0x00, 0xc9, 0x07, 0x02, 0x01, 0x00, 
-0x26, 0xaa, 0x08, 0x01, 0x01, 0x00, 0x2f, 0x09, 0x01, 0x01, 0x00, 0x28, 0x0a, 0x01, 0x01, 0x00, 
-0x29, 0x0b, 0x01, 0x01, 0x00, 0x3d, 0x0c, 0x01, 0x00, 0x27, 0x3f, 0x0d, 0x01, 0x00, 0xad, 0xa8, 
-0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 
-0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x02, 0x03, 0xc8, 0xca, 0x5b, 0x1b, 
-0x02, 0x00, 0x2b, 0x2a, 0x5d, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x27, 0x42, 0x00, 0xa4, 0xa5, 0x7e, 
-0x28, 0x02, 0x03, 0xcb, 0xcc, 0x7b, 0x29, 0x03, 0x00, 0xa7, 0xa6, 0x5c, 0x1c, 0x2b, 0x42, 0x00, 
-0x87, 0x80, 0x7d, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x33, 0x02, 0x01, 0x00, 0x3b, 0x3c, 0x34, 0x02, 
-0x01, 0x00, 0x3a, 0x3e, 0x35, 0x03, 0x00, 0x2d, 0x5f, 0x5c, 0x1f, 0x39, 0x00, 0x00, 0x20, 0x56, 
-0x01, 0x00, 0x3c, 0x3e, 0x00, 0x60, 0x06, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 
-0x97, 0x20, 0x60, 0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x06, 0x61, 0x83, 0x65, 
-0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 0x27, 0x07, 0x61, 0xa0, 0x65, 0x82, 0x69, 
-0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x45, 0x90, 0x20, 0x27, 0x22, 0x0a, 0x61, 0x84, 0x65, 0x89, 0x69, 
-0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x00, 
-0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x60, 0x0b, 0x61, 
-0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 
-0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 
-0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 
-0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 0x0d, 0x61, 
-0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 
-0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 
-0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 
-0x9a, 0x20, 0xf9, 0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 0x7e, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 
-0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x1a, 0x01, 0x03, 0x00, 0xa0, 0x26, 0x04, 0x0b, 0x00, 0x00, 
-0xf2, 0x00, 0xf6, 0x28, 0x01, 0x03, 0xc9, 0xca, 0x2c, 0x02, 0x03, 0x00, 0x00, 0xae, 0x2d, 0x02, 
-0x03, 0x00, 0x00, 0xaf, 0x00, 0x60, 0x07, 0x61, 0x85, 0x65, 0x8a, 0x6f, 0x95, 0x41, 0xb7, 0x45, 
-0xd4, 0x4f, 0xe3, 0x20, 0x60, 0x27, 0x09, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x45, 
-0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x20, 0x27, 0x22, 0x05, 0x69, 0x8b, 0x75, 0x81, 0x49, 
-0xd8, 0x55, 0x9a, 0x20, 0x22, 0x00, 0xcc, 0x27, 0x04, 0x1d, 0x00, 0x00, 0x53, 0x55, 0x2c, 0x00, 
-0x00, 0x53, 0x56, 0x2c, 0x00, 0x00, 0x46, 0x49, 0x2c, 0x99, 0x00, 0x53, 0x55, 0x2c, 0x99, 0x00, 
-0x53, 0x56, 0x2c, 0x99, 0x00, 0x46, 0x49, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x5a, 0x03, 0x7a, 0x01, 0x87, 0x01, 0x00, 0x00, 0x5b, 0x03, 0x02, 0x02, 0x25, 
-0x02, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x87, 0x01, 0x00, 0x00, 0xb5, 0x01, 0x21, 0x01, 0x2b, 
-0x01, 0x00, 0x00, 0x30, 0x75, 0xae, 0x02, 0x00, 0x00, 0x00, 0x00, 0x30, 0x75, 0x66, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0x22, 0x40, 0x04, 0x02, 0x03, 0x00, 0x00, 0x9c, 0x05, 
-0x02, 0x01, 0x00, 0xcf, 0x24, 0x07, 0x01, 0x01, 0x00, 0x26, 0x08, 0x02, 0x01, 0x00, 0x2f, 0x7b, 
-0x09, 0x04, 0x09, 0x00, 0x28, 0x5b, 0x00, 0x1b, 0x0a, 0x04, 0x09, 0x00, 0x29, 0x5d, 0x00, 0x1d, 
-0x0b, 0x02, 0x01, 0x00, 0x3d, 0x7d, 0x0c, 0x04, 0x08, 0x2b, 0x3f, 0x5c, 0x00, 0x1c, 0x0d, 0x02, 
-0x03, 0xcb, 0xc8, 0x7c, 0x10, 0x42, 0x03, 0x00, 0x00, 0x40, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 
-0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 
-0x00, 0x6f, 0x4f, 0x1a, 0x41, 0x00, 0x86, 0x8f, 0x1b, 0x04, 0x0f, 0xcc, 0xca, 0xc9, 0x00, 0x1e, 
-0x1e, 0x41, 0x00, 0x61, 0x41, 0x27, 0x41, 0x00, 0x94, 0x99, 0x28, 0x41, 0x00, 0x84, 0x8e, 0x29, 
-0x01, 0x00, 0xf5, 0xab, 0x2b, 0x01, 0x00, 0x27, 0x2a, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x31, 0x41, 
-0x00, 0x6e, 0x4e, 0x32, 0x42, 0x03, 0x00, 0x00, 0xe6, 0x33, 0x02, 0x01, 0x00, 0x3b, 0x3c, 0x34, 
-0x02, 0x01, 0x00, 0x3a, 0x3e, 0x35, 0x04, 0x0c, 0x2d, 0x5f, 0x00, 0x00, 0x1f, 0x39, 0x00, 0x00, 
-0x20, 0x56, 0x02, 0x00, 0x3c, 0x3e, 0x7c, 0x00, 0x05, 0x01, 0x03, 0x00, 0xa0, 0x29, 0x00, 0x00, 
-0x15, 0x00, 0x60, 0x06, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x20, 0x60, 
-0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x06, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 
-0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 0x27, 0x09, 0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 
-0x6f, 0xa2, 0x75, 0xa3, 0x43, 0x80, 0x45, 0x90, 0x20, 0x27, 0x22, 0x0a, 0x61, 0x84, 0x65, 0x89, 
-0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 
-0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x60, 0x0b, 
-0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 
-0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 
-0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 
-0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 0x0f, 
-0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 
-0x43, 0x80, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 
-0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 
-0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x12, 
-0x42, 0x03, 0x00, 0x00, 0xd5, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x28, 0x42, 0x07, 0x00, 0x00, 0xcd, 
-0x29, 0x01, 0x03, 0x00, 0xa0, 0x2c, 0x42, 0x00, 0x7a, 0x5a, 0xaf, 0x00, 0x60, 0x0b, 0x61, 0x85, 
-0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 
-0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 
-0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 
-0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0x27, 0x0f, 0x61, 0xa0, 
-0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x43, 0x80, 
-0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0x27, 0x22, 0x0d, 0x61, 0x84, 
-0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 
-0x4f, 0x99, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x76, 0x05, 0x73, 0xf9, 0x7a, 0xf7, 0x53, 0xdd, 
-0x5a, 0xef, 0x20, 0x76, 0x00, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x03, 0x00, 0x00, 
-0xd5, 0x09, 0x03, 0x07, 0x00, 0x00, 0x00, 0xae, 0x0a, 0x03, 0x07, 0x00, 0x00, 0x00, 0xaf, 0x0d, 
-0x01, 0x03, 0xa0, 0xa0, 0x10, 0x43, 0x03, 0x00, 0x00, 0x83, 0xb6, 0x12, 0x42, 0x03, 0x00, 0x00, 
-0xd5, 0x14, 0x43, 0x03, 0x00, 0x00, 0xab, 0x97, 0x17, 0x43, 0x03, 0x00, 0x00, 0x8b, 0xd8, 0x18, 
-0x43, 0x03, 0x00, 0x00, 0xe4, 0xe5, 0x1b, 0x02, 0x07, 0xa0, 0xa0, 0xa0, 0x1e, 0x43, 0x03, 0x00, 
-0x00, 0xa0, 0xb5, 0x1f, 0x43, 0x03, 0x00, 0x00, 0xaa, 0x96, 0x20, 0x43, 0x03, 0x00, 0x00, 0x9f, 
-0x8d, 0x21, 0x43, 0x03, 0x00, 0x00, 0x90, 0x80, 0x22, 0x43, 0x03, 0x00, 0x00, 0xa1, 0xa2, 0x23, 
-0x43, 0x03, 0x00, 0x00, 0x85, 0x82, 0x25, 0x43, 0x03, 0x00, 0x00, 0xa6, 0xa7, 0x27, 0x43, 0x03, 
-0x00, 0x00, 0x9b, 0x9d, 0x28, 0x43, 0x03, 0x00, 0x00, 0x91, 0x92, 0x29, 0x01, 0x03, 0x00, 0xa0, 
-0x2c, 0x43, 0x03, 0x00, 0x00, 0xac, 0x98, 0x2e, 0x43, 0x03, 0x00, 0x00, 0x9e, 0x8c, 0x2f, 0x43, 
-0x03, 0x00, 0x00, 0x89, 0x8a, 0x30, 0x43, 0x03, 0x00, 0x00, 0x87, 0x88, 0x31, 0x43, 0x03, 0x00, 
-0x00, 0xa9, 0x95, 0x36, 0x05, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x04, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x09, 0x03, 0x07, 0x00, 0x00, 0x00, 0xae, 
-0x0a, 0x03, 0x07, 0x00, 0x00, 0x00, 0xaf, 0x0d, 0x01, 0x03, 0xa0, 0xa0, 0x10, 0x43, 0x00, 0xa0, 
-0xb5, 0x71, 0x51, 0x11, 0x43, 0x00, 0xaa, 0x96, 0x77, 0x57, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 
-0x15, 0x43, 0x00, 0xab, 0x97, 0x79, 0x59, 0x17, 0x43, 0x03, 0x00, 0x00, 0x8b, 0xd8, 0x18, 0x43, 
-0x03, 0x00, 0x00, 0xe4, 0xe5, 0x1b, 0x42, 0x04, 0xa9, 0x95, 0xa0, 0x1e, 0x43, 0x03, 0x00, 0x00, 
-0x83, 0xb6, 0x22, 0x43, 0x03, 0x00, 0x00, 0xa1, 0xa2, 0x23, 0x43, 0x03, 0x00, 0x00, 0x90, 0x80, 
-0x25, 0x43, 0x03, 0x00, 0x00, 0xa6, 0xa7, 0x27, 0x43, 0x03, 0x00, 0x00, 0x9b, 0x9d, 0x28, 0x43, 
-0x03, 0x00, 0x00, 0x91, 0x92, 0x29, 0x01, 0x03, 0x00, 0xa0, 0x2a, 0x05, 0x3f, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x7c, 0x2b, 0x43, 0x00, 0x9f, 0x8d, 0x27, 0x2a, 0x2c, 0x43, 0x03, 0x00, 0x00, 0x87, 
-0x88, 0x2d, 0x43, 0x00, 0x9e, 0x8c, 0x78, 0x58, 0x56, 0x43, 0x00, 0xac, 0x98, 0x89, 0x8a, 0x00, 
-0xd6, 0xb8, 0x03, 0x09, 0x00, 0x00, 0x55, 0x4b, 0x2c, 0xa6, 0x00, 0x55, 0x4b, 0x08, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xe7, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x52, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x01, 0xc4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x31, 0x75, 0x84, 0x01, 0xfe, 0x01, 0x00, 0x00, 0x5b, 0x03, 0xee, 0x00, 0x43, 0x01, 0x00, 
-0x00, 0x55, 0x03, 0x04, 0x03, 0x61, 0x03, 0x00, 0x00, 0x54, 0x03, 0xa7, 0x02, 0xdb, 0x02, 0x00, 
-0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x7c, 0x03, 
-0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0x9c, 0x12, 0x43, 0x00, 0x65, 0x45, 0x82, 0x90, 
-0x16, 0x43, 0x00, 0x75, 0x55, 0xa3, 0xe9, 0x17, 0x43, 0x00, 0x69, 0x49, 0xa1, 0xd6, 0x18, 0xc3, 
-0x00, 0x6f, 0x18, 0x4f, 0x18, 0xa2, 0x18, 0xe0, 0x00, 0x1e, 0x43, 0x00, 0x61, 0x41, 0xa0, 0xb5, 
-0x28, 0x01, 0x01, 0x00, 0x40, 0x29, 0x02, 0x01, 0x00, 0xaa, 0xdd, 0x2b, 0x01, 0x00, 0x23, 0x7e, 
-0x35, 0x04, 0x0b, 0x00, 0x00, 0x5c, 0x00, 0x1c, 0x56, 0x04, 0x0c, 0x5c, 0x7c, 0x00, 0x00, 0x1c, 
-0x00, 0x16, 0x43, 0x0f, 0x00, 0x00, 0x00, 0xa0, 0x17, 0x43, 0x0f, 0x00, 0x00, 0x00, 0xa0, 0x18, 
-0x43, 0x0f, 0x00, 0x00, 0x00, 0xa0, 0x1e, 0x43, 0x0f, 0x00, 0x00, 0x00, 0xa0, 0x29, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 
-0xad, 0x03, 0x01, 0x03, 0x00, 0xca, 0x05, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x07, 0x01, 0x03, 0x00, 
-0xc8, 0x10, 0x43, 0x03, 0x00, 0x00, 0x91, 0x92, 0x15, 0x41, 0x00, 0x79, 0x59, 0x19, 0x43, 0x03, 
-0x00, 0x00, 0xab, 0xac, 0x29, 0x02, 0x03, 0xc9, 0x00, 0x7c, 0x2e, 0x43, 0x03, 0x00, 0x00, 0x87, 
-0x80, 0x31, 0x43, 0x03, 0x00, 0x00, 0xa4, 0xa5, 0x33, 0x02, 0x03, 0x00, 0x00, 0xae, 0x34, 0x02, 
-0x03, 0x00, 0x00, 0xaf, 0x35, 0x03, 0x07, 0x00, 0x00, 0x00, 0xa8, 0x39, 0x00, 0x00, 0x20, 0x00, 
-0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 
-0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0x60, 0x07, 0x61, 0x85, 0x65, 0x8a, 0x75, 0x97, 
-0x41, 0xb7, 0x45, 0xd4, 0x55, 0xeb, 0x20, 0x60, 0x22, 0x0b, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 
-0x75, 0x81, 0x79, 0x98, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 
-0x00, 0x03, 0x01, 0x03, 0x00, 0xc9, 0x05, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x07, 0x02, 0x03, 0x00, 
-0xca, 0x5e, 0x11, 0x43, 0x00, 0x77, 0x57, 0x86, 0x8f, 0x14, 0x41, 0x00, 0x74, 0x54, 0x15, 0x43, 
-0x00, 0x79, 0x59, 0xec, 0xed, 0x19, 0x41, 0x00, 0x70, 0x50, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x20, 
-0x41, 0x00, 0x64, 0x44, 0x21, 0x41, 0x00, 0x66, 0x46, 0x22, 0x41, 0x00, 0x67, 0x47, 0x28, 0x00, 
-0x01, 0xcb, 0x29, 0x00, 0x01, 0xc8, 0x2b, 0x01, 0x03, 0x00, 0xcc, 0x2c, 0x43, 0x03, 0x00, 0x00, 
-0xf9, 0xfa, 0x2e, 0x43, 0x00, 0x63, 0x43, 0x87, 0x80, 0x30, 0x41, 0x00, 0x62, 0x42, 0x31, 0x43, 
-0x03, 0x00, 0x00, 0xa4, 0xa5, 0x32, 0x41, 0x00, 0x6d, 0x4d, 0x33, 0x02, 0x03, 0x00, 0x00, 0xae, 
-0x34, 0x02, 0x03, 0x00, 0x00, 0xaf, 0x39, 0x00, 0x00, 0x20, 0x00, 0x60, 0x0f, 0x61, 0x85, 0x65, 
-0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x77, 0x91, 0x79, 0xc6, 0x41, 0xb7, 0x45, 0xd4, 0x49, 
-0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x57, 0x92, 0x59, 0xc7, 0x20, 0x60, 0x22, 0x0f, 0x61, 0x84, 0x65, 
-0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x77, 0xa6, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 
-0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x57, 0xa7, 0x59, 0xf3, 0x20, 0x22, 0x5e, 0x0f, 0x61, 0x83, 0x65, 
-0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x77, 0x9b, 0x79, 0xe4, 0x41, 0xb6, 0x45, 0xd2, 0x49, 
-0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x57, 0x9d, 0x59, 0xe5, 0x20, 0x5e, 0x27, 0x0f, 0x61, 0xa0, 0x65, 
-0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x77, 0x86, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 
-0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x57, 0x8f, 0x59, 0xed, 0x20, 0x27, 0x7e, 0x13, 0x62, 0xf2, 0x63, 
-0xbd, 0x64, 0xd0, 0x66, 0x9f, 0x67, 0x9e, 0x6d, 0xac, 0x70, 0xa8, 0x73, 0xf4, 0x74, 0xe7, 0x42, 
-0xa9, 0x43, 0xb8, 0x44, 0xd1, 0x46, 0xbe, 0x47, 0xf6, 0x4d, 0xfb, 0x50, 0xad, 0x53, 0xe1, 0x54, 
-0xe8, 0x20, 0x7e, 0x00, 0x04, 0x01, 0x03, 0x00, 0xa0, 0x05, 0x02, 0x03, 0x00, 0x00, 0xaa, 0x1f, 
-0x41, 0x00, 0x73, 0x53, 0x26, 0x41, 0x00, 0x6c, 0x4c, 0x29, 0x02, 0x07, 0xc8, 0xa0, 0xa0, 0x2c, 
-0x41, 0x00, 0x7a, 0x5a, 0x2d, 0x41, 0x00, 0x78, 0x58, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x31, 0x41, 
-0x00, 0x6e, 0x4e, 0x39, 0x00, 0x00, 0x20, 0x00, 0x2d, 0x13, 0x61, 0xa5, 0x63, 0x86, 0x65, 0xa9, 
-0x6c, 0x88, 0x6e, 0xe4, 0x6f, 0xa2, 0x73, 0x98, 0x78, 0xab, 0x7a, 0xbe, 0x41, 0xa4, 0x43, 0x8f, 
-0x45, 0xa8, 0x4c, 0x9d, 0x4e, 0xe3, 0x4f, 0xe0, 0x53, 0x97, 0x58, 0x8d, 0x5a, 0xbd, 0x20, 0x2d, 
-0x00, 0x03, 0x01, 0x03, 0x00, 0xca, 0x07, 0x01, 0x03, 0x00, 0xc9, 0x16, 0x43, 0x03, 0x00, 0x00, 
-0xed, 0xec, 0x17, 0x43, 0x0f, 0x00, 0x00, 0xa0, 0xa0, 0x18, 0x43, 0x0c, 0x6f, 0x4f, 0xa0, 0xa0, 
-0x1e, 0x43, 0x0f, 0x00, 0x00, 0xa0, 0xa0, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x22, 0x43, 0x00, 0x67, 
-0x47, 0xe5, 0xe4, 0x23, 0x43, 0x00, 0x68, 0x48, 0xe8, 0xe7, 0x24, 0x41, 0x00, 0x6a, 0x4a, 0x29, 
-0x02, 0x03, 0xc8, 0xa0, 0x7c, 0x2c, 0x43, 0x03, 0x00, 0x00, 0xbe, 0xbd, 0x2e, 0x43, 0x00, 0x63, 
-0x43, 0x91, 0x92, 0x31, 0x42, 0x03, 0x00, 0x00, 0xf3, 0x39, 0x00, 0x00, 0x20, 0x00, 0x60, 0x0b, 
-0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 
-0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x5e, 0x13, 0x63, 0x86, 0x65, 0x88, 0x67, 0x9b, 0x68, 0xa9, 
-0x69, 0x8c, 0x6a, 0x9f, 0x6f, 0x93, 0x73, 0xc7, 0x75, 0x96, 0x43, 0x8f, 0x45, 0xd2, 0x47, 0x9d, 
-0x48, 0xa8, 0x49, 0xd7, 0x4a, 0xac, 0x4f, 0xe2, 0x53, 0xc6, 0x55, 0xea, 0x20, 0x5e, 0x22, 0x05, 
-0x65, 0x89, 0x69, 0x8b, 0x45, 0xd3, 0x49, 0xd8, 0x20, 0x22, 0x00, 0xfc, 0x7f, 0x04, 0x04, 0xa8, 
-0x00, 0x55, 0x4b, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 
-0x03, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 
-0x01, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x75, 0xe2, 0x01, 0x77, 0x02, 0x00, 0x00, 0x5b, 
-0x03, 0x12, 0x01, 0x89, 0x01, 0x00, 0x00, 0x55, 0x03, 0x20, 0x03, 0x9b, 0x03, 0x00, 0x00, 0x54, 
-0x03, 0xe8, 0x03, 0x51, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-0x02, 0x03, 0x00, 0x00, 0xfb, 0x03, 0x02, 0x01, 0x00, 0x22, 0xfd, 0x04, 0x02, 0x01, 0x00, 0x9c, 
-0xfc, 0x05, 0x02, 0x03, 0x00, 0x00, 0xac, 0x06, 0x02, 0x03, 0x00, 0x00, 0xab, 0x07, 0x02, 0x01, 
-0x00, 0x26, 0xf3, 0x08, 0x01, 0x01, 0x00, 0x27, 0x09, 0x01, 0x01, 0x00, 0x28, 0x0a, 0x02, 0x01, 
-0x00, 0x29, 0xf1, 0x0b, 0x02, 0x01, 0x00, 0x23, 0xf8, 0x0c, 0x02, 0x03, 0x00, 0x00, 0x5f, 0x0d, 
-0x01, 0x00, 0xaa, 0xee, 0x1a, 0x01, 0x00, 0x40, 0x60, 0x1b, 0x04, 0x08, 0x5b, 0x7b, 0x7e, 0x00, 
-0x1b, 0x27, 0x01, 0x01, 0x00, 0x2b, 0x28, 0x04, 0x08, 0x3a, 0x2a, 0x5e, 0x00, 0x1e, 0x29, 0x04, 
-0x08, 0x5c, 0xdd, 0x7c, 0x00, 0x1c, 0x2b, 0x04, 0x0c, 0x5d, 0x7d, 0x00, 0x00, 0x1d, 0x32, 0x42, 
-0x03, 0x00, 0x00, 0xe6, 0x39, 0x00, 0x00, 0x20, 0x56, 0x04, 0x0c, 0x7c, 0x5f, 0x00, 0x00, 0x1f, 
-0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x07, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x0d, 0x01, 0x03, 0x00, 0xa0, 0x29, 0x01, 0x03, 0x00, 0xa0, 0x00, 0x12, 0x42, 
-0x03, 0x00, 0x00, 0xd5, 0x00, 0x02, 0x03, 0x07, 0x00, 0x00, 0x00, 0xad, 0x03, 0x01, 0x03, 0x00, 
-0xca, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x07, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x08, 0x01, 0x03, 0x00, 0xcb, 0x12, 0x42, 0x00, 0x65, 0x45, 0xd5, 0x15, 0x41, 
-0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x43, 0x00, 
-0x6f, 0x4f, 0xab, 0xac, 0x1a, 0x01, 0x03, 0x00, 0xc9, 0x1e, 0x43, 0x00, 0x61, 0x41, 0x91, 0x92, 
-0x28, 0x02, 0x07, 0x00, 0x00, 0xc8, 0x29, 0x01, 0x03, 0x00, 0xa0, 0x2e, 0x43, 0x03, 0x00, 0x00, 
-0x87, 0x80, 0x31, 0x43, 0x03, 0x00, 0x00, 0xa4, 0xa5, 0x33, 0x02, 0x03, 0x00, 0x00, 0xae, 0x34, 
-0x02, 0x03, 0x00, 0x00, 0xaf, 0x35, 0x02, 0x03, 0x00, 0x00, 0xa8, 0x00, 0x5e, 0x0b, 0x61, 0x83, 
-0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 
-0x55, 0xea, 0x20, 0x5e, 0x60, 0x07, 0x61, 0x85, 0x65, 0x8a, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 
-0x55, 0xeb, 0x20, 0x60, 0x22, 0x0b, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 
-0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x27, 0x0b, 0x61, 0xa0, 
-0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 
-0x55, 0xe9, 0x20, 0x27, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x03, 0x02, 0x03, 0x00, 0xc9, 
-0xfd, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x07, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x08, 0x01, 0x03, 
-0x00, 0xcb, 0x0b, 0x01, 0x03, 0x00, 0xca, 0x0d, 0x01, 0x03, 0x00, 0xcc, 0x11, 0x41, 0x00, 0x77, 
-0x57, 0x12, 0x42, 0x00, 0x65, 0x45, 0xd5, 0x14, 0x41, 0x00, 0x74, 0x54, 0x15, 0x43, 0x00, 0x79, 
-0x59, 0xf9, 0xfa, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 
-0x6f, 0x4f, 0x19, 0x41, 0x00, 0x70, 0x50, 0x1a, 0x01, 0x03, 0x00, 0xc8, 0x1e, 0x41, 0x00, 0x61, 
-0x41, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x20, 0x41, 0x00, 0x64, 0x44, 0x21, 0x41, 0x00, 0x66, 0x46, 
-0x22, 0x41, 0x00, 0x67, 0x47, 0x2e, 0x43, 0x00, 0x63, 0x43, 0x87, 0x80, 0x30, 0x41, 0x00, 0x62, 
-0x42, 0x31, 0x43, 0x03, 0x00, 0x00, 0xa4, 0xa5, 0x32, 0x41, 0x00, 0x6d, 0x4d, 0x33, 0x02, 0x03, 
-0x00, 0x00, 0xae, 0x34, 0x02, 0x03, 0x00, 0x00, 0xaf, 0x00, 0x60, 0x0f, 0x61, 0x85, 0x65, 0x8a, 
-0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x77, 0x91, 0x79, 0xc6, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 
-0x4f, 0xe3, 0x55, 0xeb, 0x57, 0x92, 0x59, 0xc7, 0x20, 0x60, 0x22, 0x0f, 0x61, 0x84, 0x65, 0x89, 
-0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x77, 0xa6, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 
-0x4f, 0x99, 0x55, 0x9a, 0x57, 0xa7, 0x59, 0xf3, 0x20, 0x22, 0x23, 0x0f, 0x61, 0x83, 0x65, 0x88, 
-0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x77, 0x9b, 0x79, 0xe4, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 
-0x4f, 0xe2, 0x55, 0xea, 0x57, 0x9d, 0x59, 0xe5, 0x20, 0x23, 0x27, 0x0f, 0x61, 0xa0, 0x65, 0x82, 
-0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x77, 0x86, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 
-0x4f, 0xe0, 0x55, 0xe9, 0x57, 0x8f, 0x59, 0xed, 0x20, 0x27, 0xee, 0x13, 0x62, 0xf2, 0x63, 0xbd, 
-0x64, 0xd0, 0x66, 0x9f, 0x67, 0x9e, 0x6d, 0xac, 0x70, 0xa8, 0x73, 0xf4, 0x74, 0xe7, 0x42, 0xa9, 
-0x43, 0xb8, 0x44, 0xd1, 0x46, 0xbe, 0x47, 0xf6, 0x4d, 0xfb, 0x50, 0xad, 0x53, 0xe1, 0x54, 0xe8, 
-0x20, 0xee, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x03, 0x01, 0x03, 0x00, 0xc8, 0x05, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x07, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x0d, 0x10, 0x00, 0x00, 0x12, 0x43, 0x00, 0x65, 0x45, 0x82, 0x90, 0x16, 0x43, 0x00, 0x75, 0x55, 
-0xed, 0xec, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x01, 0x03, 0x00, 
-0xc9, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x22, 0x43, 0x00, 0x67, 0x47, 
-0xe5, 0xe4, 0x23, 0x43, 0x00, 0x68, 0x48, 0xe8, 0xe7, 0x24, 0x41, 0x00, 0x6a, 0x4a, 0x28, 0x02, 
-0x07, 0x00, 0x00, 0xca, 0x29, 0x01, 0x01, 0x00, 0x7c, 0x2c, 0x43, 0x03, 0x00, 0x00, 0xbe, 0xbd, 
-0x2e, 0x43, 0x00, 0x63, 0x43, 0x91, 0x92, 0x31, 0x42, 0x03, 0x00, 0x00, 0xf3, 0x00, 0x22, 0x05, 
-0x65, 0x89, 0x69, 0x8b, 0x45, 0xd3, 0x49, 0xd8, 0x20, 0x22, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 
-0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 
-0x20, 0x60, 0x5e, 0x13, 0x63, 0x86, 0x65, 0x88, 0x67, 0x9b, 0x68, 0xa9, 0x69, 0x8c, 0x6a, 0x9f, 
-0x6f, 0x93, 0x73, 0xc7, 0x75, 0x96, 0x43, 0x8f, 0x45, 0xd2, 0x47, 0x9d, 0x48, 0xa8, 0x49, 0xd7, 
-0x4a, 0xac, 0x4f, 0xe2, 0x53, 0xc6, 0x55, 0xea, 0x20, 0x5e, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x03, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0xa0, 0xa0, 0x05, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x07, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x01, 0x03, 0xc8, 0xa0, 0x12, 0x42, 0x00, 0x65, 0x45, 0xaa, 
-0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x26, 
-0x41, 0x00, 0x6c, 0x4c, 0x29, 0x01, 0x03, 0x00, 0xa0, 0x2c, 0x41, 0x00, 0x7a, 0x5a, 0x2d, 0x41, 
-0x00, 0x78, 0x58, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x32, 0x42, 0x07, 
-0x00, 0x00, 0xa0, 0x00, 0x60, 0x13, 0x61, 0xa5, 0x63, 0x86, 0x65, 0xa9, 0x6c, 0x88, 0x6e, 0xe4, 
-0x6f, 0xa2, 0x73, 0x98, 0x78, 0xab, 0x7a, 0xbe, 0x41, 0xa4, 0x43, 0x8f, 0x45, 0xa8, 0x4c, 0x9d, 
-0x4e, 0xe3, 0x4f, 0xe0, 0x53, 0x97, 0x58, 0x8d, 0x5a, 0xbd, 0x20, 0x60, 0x00, 0x88, 0xa6, 0x02, 
-0x09, 0x00, 0x00, 0x55, 0x53, 0x2c, 0x67, 0x00, 0x55, 0x53, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x03, 
-0xdb, 0x01, 0x37, 0x02, 0x00, 0x00, 0x55, 0x03, 0x8f, 0x00, 0xce, 0x00, 0x00, 0x00, 0x52, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x75, 
-0x03, 0x01, 0x08, 0x01, 0x00, 0x00, 0x47, 0x75, 0x21, 0x01, 0x66, 0x01, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x41, 
-0x00, 0x65, 0x45, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 
-0x6f, 0x4f, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x39, 0x00, 0x00, 0x20, 0x00, 0x06, 0x02, 0x03, 0x00, 
-0x00, 0xd5, 0x12, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x07, 0x01, 0x03, 0x00, 0xc8, 0x12, 0x03, 
-0x03, 0x00, 0x00, 0x82, 0x90, 0x16, 0x03, 0x03, 0x00, 0x00, 0xed, 0xec, 0x1f, 0x41, 0x00, 0x73, 
-0x53, 0x22, 0x41, 0x00, 0x67, 0x47, 0x23, 0x41, 0x00, 0x68, 0x48, 0x24, 0x41, 0x00, 0x6a, 0x4a, 
-0x28, 0x01, 0x03, 0x00, 0xc9, 0x29, 0x03, 0x03, 0x00, 0x00, 0x8a, 0xd4, 0x2e, 0x41, 0x00, 0x63, 
-0x43, 0x31, 0x02, 0x03, 0x00, 0x00, 0xf3, 0x00, 0x5e, 0x13, 0x63, 0x86, 0x67, 0x9b, 0x68, 0xa9, 
-0x6a, 0x9f, 0x73, 0xc7, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x43, 0x8f, 0x47, 0x9d, 
-0x48, 0xa8, 0x4a, 0xac, 0x53, 0xc6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 
-0x22, 0x05, 0x65, 0x89, 0x69, 0x8b, 0x45, 0xd3, 0x49, 0xd8, 0x20, 0x22, 0x00, 0x29, 0x00, 0x01, 
-0xc8, 0x00, 0x60, 0x0b, 0x61, 0xee, 0x65, 0xd0, 0x69, 0xf6, 0x6f, 0xfa, 0x75, 0xfc, 0x41, 0xef, 
-0x45, 0xd1, 0x49, 0xf7, 0x4f, 0xfb, 0x55, 0xfd, 0x20, 0x60, 0x00, 0x07, 0x01, 0x03, 0x00, 0xca, 
-0x12, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x14, 0x41, 0x00, 0x74, 0x54, 0x18, 0x03, 0x03, 0x00, 0x00, 
-0xab, 0xac, 0x1e, 0x03, 0x03, 0x00, 0x00, 0x91, 0x92, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x20, 0x41, 
-0x00, 0x64, 0x44, 0x26, 0x41, 0x00, 0x6c, 0x4c, 0x28, 0x01, 0x03, 0xcb, 0xcc, 0x29, 0x01, 0x03, 
-0xc8, 0xc9, 0x2e, 0x03, 0x03, 0x00, 0x00, 0x87, 0x80, 0x31, 0x42, 0x00, 0x6e, 0x4e, 0xf2, 0x00, 
-0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 
-0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x03, 0x6e, 0xbd, 0x4e, 0xbe, 0x20, 0x7e, 
-0x5e, 0x15, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x73, 0xf9, 0x64, 0xd0, 
-0x6c, 0x9b, 0x6e, 0x9e, 0x74, 0xe7, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 
-0x53, 0xdd, 0x44, 0xd1, 0x4c, 0x9d, 0x4e, 0x9f, 0x54, 0xe8, 0x20, 0x5e, 0x27, 0x0b, 0x61, 0xa0, 
-0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 
-0x55, 0xe9, 0x20, 0x27, 0x22, 0x07, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x45, 0xd3, 0x49, 0xd8, 
-0x4f, 0x99, 0x20, 0x22, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0xad, 0x06, 0x02, 0x03, 0x00, 0x00, 
-0xd5, 0x07, 0x01, 0x03, 0x00, 0xc8, 0x12, 0x03, 0x03, 0x00, 0x00, 0x91, 0x92, 0x15, 0x41, 0x00, 
-0x79, 0x59, 0x18, 0x03, 0x03, 0x00, 0x00, 0xab, 0xac, 0x1e, 0x03, 0x03, 0x00, 0x00, 0x86, 0x8f, 
-0x1f, 0x02, 0x03, 0x00, 0x00, 0xe1, 0x28, 0x01, 0x03, 0xc9, 0xca, 0x29, 0x01, 0x03, 0xcb, 0xcc, 
-0x2e, 0x03, 0x03, 0x00, 0x00, 0x87, 0x80, 0x31, 0x43, 0x00, 0x6e, 0x4e, 0xa4, 0xa5, 0x33, 0x02, 
-0x03, 0x00, 0x00, 0xae, 0x34, 0x02, 0x03, 0x00, 0x00, 0xaf, 0x35, 0x02, 0x03, 0x00, 0x00, 0xa8, 
-0x00, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 
-0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0x27, 0x0b, 0x61, 0xa0, 0x65, 0x82, 0x69, 
-0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x20, 
-0x27, 0x22, 0x0d, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 
-0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x60, 0x07, 0x61, 
-0x85, 0x65, 0x8a, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x03, 0x6e, 
-0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x00, 0x3c, 0xf0, 0x03, 0x27, 0x00, 0x00, 0x59, 0x55, 0x2c, 0x00, 
-0x00, 0x42, 0x41, 0x2c, 0x00, 0x00, 0x48, 0x52, 0x2c, 0x00, 0x00, 0x53, 0x49, 0x2c, 0xea, 0x00, 
-0x59, 0x55, 0x2c, 0xea, 0x00, 0x42, 0x41, 0x2c, 0xea, 0x00, 0x48, 0x52, 0x2c, 0xea, 0x00, 0x53, 
-0x49, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x03, 0xf2, 
-0x01, 0x79, 0x02, 0x00, 0x00, 0x71, 0x00, 0x3d, 0x01, 0x93, 0x01, 0x00, 0x00, 0x5a, 0x03, 0x3a, 
-0x03, 0x41, 0x03, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x41, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xc8, 0x03, 0x01, 0x01, 0x00, 0x22, 
-0x04, 0x03, 0x07, 0x00, 0x00, 0xc9, 0x1e, 0x06, 0x02, 0x07, 0x00, 0x00, 0xca, 0x07, 0x01, 0x01, 
-0x00, 0x26, 0x08, 0x02, 0x05, 0x00, 0x2f, 0xcb, 0x09, 0x02, 0x01, 0x00, 0x28, 0xfa, 0x0a, 0x02, 
-0x05, 0x00, 0x29, 0xcc, 0x0b, 0x01, 0x01, 0x00, 0x3d, 0x0c, 0x02, 0x04, 0x27, 0x3f, 0xcd, 0x0d, 
-0x02, 0x04, 0x2b, 0x2a, 0xce, 0x10, 0x42, 0x03, 0x00, 0x00, 0x5c, 0x11, 0x42, 0x03, 0x00, 0x00, 
-0x7c, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0xc4, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x00, 0x2c, 0x1a, 
-0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 
-0x6f, 0x4f, 0x1a, 0x42, 0x03, 0xa0, 0xa0, 0xf6, 0x1b, 0x42, 0x03, 0xa0, 0xa0, 0x9e, 0x1e, 0x41, 
-0x00, 0x61, 0x41, 0x21, 0x42, 0x03, 0x00, 0x00, 0x5b, 0x22, 0x42, 0x03, 0x00, 0x00, 0x5d, 0x27, 
-0x43, 0x07, 0xa0, 0xa0, 0x00, 0x1d, 0x28, 0x42, 0x03, 0xa0, 0xa0, 0xe1, 0x29, 0x01, 0x03, 0xce, 
-0xcd, 0x2b, 0x42, 0x03, 0xa0, 0xa0, 0xcf, 0x2c, 0xc4, 0x00, 0x79, 0x15, 0x59, 0x15, 0x00, 0x15, 
-0x19, 0x15, 0x00, 0x15, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x2f, 0x42, 0x03, 0x00, 0x00, 0x40, 0x30, 
-0x42, 0x03, 0x00, 0x00, 0x7b, 0x31, 0x42, 0x00, 0x6e, 0x4e, 0x7d, 0x32, 0x42, 0x03, 0x00, 0x00, 
-0xf5, 0x33, 0x02, 0x01, 0x00, 0x3b, 0x3c, 0x34, 0x02, 0x01, 0x00, 0x3a, 0x3e, 0x35, 0x03, 0x04, 
-0x2d, 0x5f, 0x00, 0x1f, 0x39, 0x00, 0x00, 0x20, 0x56, 0x01, 0x00, 0x3c, 0x3e, 0x00, 0x02, 0x02, 
-0x03, 0x00, 0x00, 0x7e, 0x03, 0x02, 0x07, 0x00, 0x00, 0xc8, 0x06, 0x02, 0x03, 0x00, 0x00, 0xf8, 
-0x08, 0x02, 0x07, 0x00, 0x00, 0xca, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xcb, 0x0c, 0x02, 0x07, 0x00, 
-0x00, 0xcc, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xcd, 0x1a, 0x41, 0x00, 0xa4, 0xa5, 0x1b, 0x42, 0x04, 
-0x9b, 0x9d, 0xa0, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x27, 0x41, 0x00, 0x91, 0x92, 0x28, 0x41, 0x00, 
-0x86, 0x8f, 0x29, 0x01, 0x03, 0xcd, 0xcc, 0x2b, 0x42, 0x04, 0xa6, 0xa7, 0xa0, 0x32, 0x42, 0x03, 
-0x00, 0x00, 0x15, 0x00, 0x76, 0x07, 0x63, 0x91, 0x73, 0xa4, 0x7a, 0xa6, 0x43, 0x92, 0x53, 0xa5, 
-0x5a, 0xa7, 0x20, 0x76, 0x5e, 0x06, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 
-0x20, 0x5e, 0x60, 0x06, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x20, 0x60, 
-0x27, 0x09, 0x61, 0xa0, 0x63, 0x86, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x43, 0x8f, 
-0x45, 0x90, 0x20, 0x27, 0x22, 0x0a, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 
-0x79, 0x98, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x2c, 0x03, 0x63, 0x87, 0x43, 0x80, 
-0x20, 0x2c, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x7e, 0x03, 0x02, 0x07, 0x00, 0x00, 0xc8, 0x05, 
-0x02, 0x07, 0x00, 0x00, 0xca, 0x06, 0x02, 0x07, 0x00, 0x00, 0xcb, 0x07, 0x02, 0x07, 0x00, 0x00, 
-0xcc, 0x08, 0x02, 0x03, 0x00, 0x00, 0x60, 0x09, 0x02, 0x07, 0x00, 0x00, 0xcd, 0x0a, 0x02, 0x07, 
-0x00, 0x00, 0xce, 0x0b, 0x02, 0x07, 0x00, 0x00, 0xcf, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xd0, 0x0d, 
-0x02, 0x07, 0x00, 0x00, 0xd1, 0x12, 0x42, 0x03, 0x00, 0x00, 0xaa, 0x13, 0x41, 0x00, 0x72, 0x52, 
-0x14, 0x41, 0x00, 0x74, 0x54, 0x1a, 0x41, 0x00, 0xe7, 0xe6, 0x1b, 0x41, 0x00, 0xd0, 0xd1, 0x1f, 
-0x41, 0x00, 0x73, 0x53, 0x20, 0x41, 0x00, 0x64, 0x44, 0x25, 0x42, 0x03, 0x00, 0x00, 0x88, 0x26, 
-0x42, 0x00, 0x6c, 0x4c, 0x9d, 0x27, 0x41, 0x00, 0x9f, 0xac, 0x28, 0x41, 0x00, 0x86, 0x8f, 0x29, 
-0x01, 0x03, 0xd1, 0xd0, 0x2b, 0x41, 0x00, 0xa7, 0xa6, 0x00, 0xf3, 0x13, 0x63, 0x9f, 0x64, 0xd4, 
-0x65, 0xd8, 0x6c, 0x96, 0x6e, 0xe5, 0x72, 0xfd, 0x73, 0xe7, 0x74, 0x9c, 0x7a, 0xa7, 0x43, 0xac, 
-0x44, 0xd2, 0x45, 0xb7, 0x4c, 0x95, 0x4e, 0xd5, 0x52, 0xfc, 0x53, 0xe6, 0x54, 0x9b, 0x5a, 0xa6, 
-0x20, 0xf3, 0x5e, 0x07, 0x61, 0x83, 0x69, 0x8c, 0x6f, 0x93, 0x41, 0xb6, 0x49, 0xd7, 0x4f, 0xe2, 
-0x20, 0x5e, 0xf4, 0x03, 0x61, 0xc7, 0x41, 0xc6, 0x20, 0xf4, 0xf8, 0x03, 0x75, 0x85, 0x55, 0xde, 
-0x20, 0xf8, 0xf2, 0x05, 0x61, 0xa5, 0x65, 0xa9, 0x41, 0xa4, 0x45, 0xa8, 0x20, 0xf2, 0xfa, 0x03, 
-0x7a, 0xbe, 0x5a, 0xbd, 0x20, 0xfa, 0xef, 0x19, 0x61, 0xa0, 0x63, 0x86, 0x65, 0x82, 0x69, 0xa1, 
-0x6c, 0x92, 0x6e, 0xe4, 0x6f, 0xa2, 0x72, 0xea, 0x73, 0x98, 0x75, 0xa3, 0x79, 0xec, 0x7a, 0xab, 
-0x41, 0xb5, 0x43, 0x8f, 0x45, 0x90, 0x49, 0xd6, 0x4c, 0x91, 0x4e, 0xe3, 0x4f, 0xe0, 0x52, 0xe8, 
-0x53, 0x97, 0x55, 0xe9, 0x59, 0xed, 0x5a, 0x8d, 0x20, 0xef, 0xf1, 0x05, 0x6f, 0x8b, 0x75, 0xfb, 
-0x4f, 0x8a, 0x55, 0xeb, 0x20, 0xf1, 0xf9, 0x09, 0x61, 0x84, 0x65, 0x89, 0x6f, 0x94, 0x75, 0x81, 
-0x41, 0x8e, 0x45, 0xd3, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0xf7, 0x07, 0x63, 0x87, 0x73, 0xad, 
-0x74, 0xee, 0x43, 0x80, 0x53, 0xb8, 0x54, 0xdd, 0x20, 0xf7, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 
-0xd5, 0x00, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 
-0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 
-0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xf8, 0x03, 0x61, 0x86, 0x41, 0x8f, 
-0x20, 0xf8, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 
-0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 
-0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 
-0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 
-0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 
-0xf7, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0xf7, 0x00, 0xad, 0x00, 0x00 };
+0x20, 0x6f, 0x66, 0x20, 0x33, 0x0e, 0x00, 0x0e, 0x00, 0x00, 0x42, 0x45, 0x2c, 0x78, 0x00, 0x42, 
+0x45, 0x2c, 0x78, 0x00, 0x46, 0x52, 0x09, 0x00, 0x09, 0x00, 0x00, 0x42, 0x52, 0x2c, 0x13, 0x01, 
+0x42, 0x52, 0x04, 0x00, 0x04, 0x12, 0x01, 0x42, 0x52, 0x13, 0x00, 0x13, 0x00, 0x00, 0x43, 0x46, 
+0x2c, 0x00, 0x00, 0x43, 0x41, 0x2c, 0x3a, 0x00, 0x43, 0x46, 0x2c, 0x3a, 0x00, 0x43, 0x41, 0x09, 
+0x00, 0x09, 0xbd, 0x01, 0x43, 0x46, 0x2c, 0xbd, 0x01, 0x43, 0x41, 0x04, 0x00, 0x04, 0xf5, 0x01, 
+0x43, 0x46, 0x04, 0x00, 0x04, 0x00, 0x00, 0x43, 0x5a, 0x04, 0x00, 0x04, 0xf3, 0x00, 0x43, 0x5a, 
+0x09, 0x00, 0x09, 0x00, 0x00, 0x44, 0x4b, 0x2c, 0x9f, 0x00, 0x44, 0x4b, 0x17, 0x00, 0x17, 0x00, 
+0x00, 0x44, 0x56, 0x2c, 0x00, 0x00, 0x55, 0x53, 0x44, 0x56, 0x2c, 0x67, 0x00, 0x44, 0x56, 0x2c, 
+0x67, 0x00, 0x55, 0x53, 0x44, 0x56, 0x09, 0x00, 0x09, 0x00, 0x00, 0x46, 0x52, 0x2c, 0xbd, 0x00, 
+0x46, 0x52, 0x13, 0x00, 0x13, 0x00, 0x00, 0x47, 0x52, 0x2c, 0x00, 0x00, 0x44, 0x45, 0x2c, 0x81, 
+0x00, 0x47, 0x52, 0x2c, 0x81, 0x00, 0x44, 0x45, 0x09, 0x00, 0x09, 0xc5, 0x01, 0x47, 0x52, 0x2c, 
+0xc5, 0x01, 0x44, 0x45, 0x04, 0x00, 0x04, 0x00, 0x00, 0x48, 0x55, 0x04, 0x00, 0x04, 0xd0, 0x00, 
+0x48, 0x55, 0x09, 0x00, 0x09, 0x00, 0x00, 0x49, 0x54, 0x2c, 0x8d, 0x00, 0x49, 0x54, 0x04, 0x00, 
+0x04, 0x8e, 0x00, 0x49, 0x54, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x4a, 0x50, 0x2c, 0x00, 0x00, 0x4a, 
+0x50, 0x31, 0x30, 0x36, 0x09, 0x00, 0x09, 0x00, 0x00, 0x4c, 0x41, 0x2c, 0xab, 0x00, 0x4c, 0x41, 
+0x19, 0x00, 0x19, 0x00, 0x00, 0x4c, 0x48, 0x2c, 0x00, 0x00, 0x55, 0x53, 0x44, 0x56, 0x4c, 0x2c, 
+0x67, 0x00, 0x4c, 0x48, 0x2c, 0x67, 0x00, 0x55, 0x53, 0x44, 0x56, 0x4c, 0x09, 0x00, 0x09, 0x00, 
+0x00, 0x4e, 0x4c, 0x2c, 0x8f, 0x00, 0x4e, 0x4c, 0x09, 0x00, 0x09, 0x00, 0x00, 0x4e, 0x4f, 0x2c, 
+0x9b, 0x00, 0x4e, 0x4f, 0x09, 0x00, 0x09, 0x00, 0x00, 0x50, 0x4c, 0x2c, 0xc9, 0x01, 0x50, 0x4c, 
+0x04, 0x00, 0x04, 0xd6, 0x00, 0x50, 0x4c, 0x09, 0x00, 0x09, 0x00, 0x00, 0x50, 0x4f, 0x2c, 0xa3, 
+0x00, 0x50, 0x4f, 0x19, 0x00, 0x19, 0x00, 0x00, 0x52, 0x48, 0x2c, 0x00, 0x00, 0x55, 0x53, 0x44, 
+0x56, 0x52, 0x2c, 0x67, 0x00, 0x52, 0x48, 0x2c, 0x67, 0x00, 0x55, 0x53, 0x44, 0x56, 0x52, 0x09, 
+0x00, 0x09, 0x00, 0x00, 0x53, 0x46, 0x2c, 0x96, 0x00, 0x53, 0x46, 0x13, 0x00, 0x13, 0x00, 0x00, 
+0x53, 0x47, 0x2c, 0x00, 0x00, 0x53, 0x44, 0x2c, 0x96, 0x00, 0x53, 0x47, 0x2c, 0x96, 0x00, 0x53, 
+0x44, 0x09, 0x00, 0x09, 0x00, 0x00, 0x53, 0x4b, 0x2c, 0xf5, 0x00, 0x53, 0x4b, 0x1d, 0x00, 0x1d, 
+0x00, 0x00, 0x53, 0x50, 0x2c, 0x00, 0x00, 0x45, 0x53, 0x2c, 0xac, 0x00, 0x53, 0x50, 0x2c, 0xac, 
+0x00, 0x45, 0x53, 0x2c, 0xad, 0x00, 0x53, 0x50, 0x2c, 0xad, 0x00, 0x45, 0x53, 0x1d, 0x00, 0x1d, 
+0x00, 0x00, 0x53, 0x55, 0x2c, 0x00, 0x00, 0x53, 0x56, 0x2c, 0x00, 0x00, 0x46, 0x49, 0x2c, 0x99, 
+0x00, 0x53, 0x55, 0x2c, 0x99, 0x00, 0x53, 0x56, 0x2c, 0x99, 0x00, 0x46, 0x49, 0x09, 0x00, 0x09, 
+0x00, 0x00, 0x55, 0x4b, 0x2c, 0xa6, 0x00, 0x55, 0x4b, 0x04, 0x00, 0x04, 0xa8, 0x00, 0x55, 0x4b, 
+0x09, 0x00, 0x09, 0x00, 0x00, 0x55, 0x53, 0x2c, 0x67, 0x00, 0x55, 0x53, 0x27, 0x00, 0x27, 0x00, 
+0x00, 0x59, 0x55, 0x2c, 0x00, 0x00, 0x42, 0x41, 0x2c, 0x00, 0x00, 0x48, 0x52, 0x2c, 0x00, 0x00, 
+0x53, 0x49, 0x2c, 0xea, 0x00, 0x59, 0x55, 0x2c, 0xea, 0x00, 0x42, 0x41, 0x2c, 0xea, 0x00, 0x48, 
+0x52, 0x2c, 0xea, 0x00, 0x53, 0x49 };
+
+static const kcl_builtin_layout layout_keyboardsys_layouts[35] = {
+{ 53, 55, 929 }, { 70, 986, 488 }, { 82, 1476, 343 }, { 89, 1821, 1033 },
+{ 111, 2856, 1861 }, { 123, 4719, 1195 }, { 130, 5916, 780 }, { 137, 6698, 1019 },
+{ 144, 7719, 632 }, { 156, 8353, 545 }, { 182, 8900, 732 }, { 194, 9634, 1341 },
+{ 216, 10977, 2247 }, { 228, 13226, 966 }, { 235, 14194, 976 }, { 242, 15172, 900 },
+{ 254, 16074, 890 }, { 261, 16966, 548 }, { 276, 17516, 1204 }, { 288, 18722, 638 },
+{ 316, 19362, 794 }, { 328, 20158, 849 }, { 340, 21009, 860 }, { 352, 21871, 2294 },
+{ 359, 24167, 466 }, { 371, 24635, 625 }, { 399, 25262, 833 }, { 411, 26097, 636 },
+{ 433, 26735, 1009 }, { 445, 27746, 581 }, { 477, 28329, 1064 }, { 509, 29395, 953 },
+{ 521, 30350, 1152 }, { 528, 31504, 679 }, { 540, 32185, 1009 }
+};
 
-Bit8u layout_keybrd2sys[25431] = {
+static const Bit8u layout_keyboardsys_compressed[11142] = {
+0xed, 0x7d, 0x09, 0x58, 0x14, 0x57, 0xd6, 0xe8, 0xa9, 0xa5, 0xa1, 0xd9, 0x26, 0x2a, 0x22, 0x08, 
+0x09, 0x34, 0xa0, 0x34, 0xd8, 0x0d, 0xb8, 0x91, 0x4c, 0xdc, 0xab, 0x1b, 0x92, 0x90, 0x18, 0x71, 
+0x54, 0x4c, 0xdc, 0x65, 0x0c, 0xc9, 0x30, 0xe3, 0x48, 0x26, 0x86, 0x44, 0x65, 0x89, 0x0b, 0x82, 
+0x31, 0xee, 0x71, 0x0d, 0xa8, 0x65, 0xa2, 0x80, 0xb8, 0x64, 0x36, 0x13, 0xff, 0x99, 0xa7, 0xef, 
+0xcd, 0x84, 0x28, 0x9b, 0x5b, 0x26, 0x26, 0x79, 0x6f, 0x7e, 0x33, 0x31, 0x6e, 0x59, 0x8c, 0x8e, 
+0x0b, 0x06, 0xb7, 0xf7, 0xbf, 0x73, 0xcf, 0xad, 0xa6, 0xab, 0xb1, 0xbb, 0x05, 0x97, 0xc9, 0xcc, 
+0xff, 0x86, 0xfa, 0xea, 0xde, 0x2a, 0x7a, 0xbb, 0xe7, 0xdc, 0x7b, 0xf6, 0x73, 0x4f, 0x3d, 0x65, 
+0x7f, 0x0c, 0x04, 0x21, 0xe9, 0x89, 0xec, 0x69, 0x2f, 0xe5, 0xfc, 0x2a, 0x2f, 0xdb, 0x34, 0x3c, 
+0xfb, 0xa5, 0xdc, 0x69, 0xff, 0x95, 0x9a, 0x31, 0xd2, 0x34, 0x25, 0xf7, 0xb9, 0xec, 0x17, 0xb3, 
+0x5e, 0xc8, 0x9e, 0x6e, 0x4a, 0x34, 0x4d, 0xcd, 0xf9, 0xe9, 0x4b, 0x59, 0x2f, 0xcd, 0x34, 0xc5, 
+0xf6, 0x32, 0xe5, 0x3e, 0x6f, 0xea, 0xa3, 0x4a, 0x3f, 0x02, 0xb0, 0xa5, 0x59, 0x67, 0xf0, 0xe6, 
+0xb1, 0x11, 0x3e, 0xb2, 0x15, 0x00, 0x0c, 0xe0, 0xfa, 0xf7, 0x1c, 0xb5, 0x63, 0xa5, 0x07, 0xa4, 
+0x2e, 0x12, 0xc0, 0x38, 0x69, 0xa2, 0xb0, 0x5a, 0x00, 0x18, 0x81, 0xd7, 0xec, 0x7e, 0x97, 0x10, 
+0x2c, 0x46, 0x8a, 0x00, 0x8f, 0xe4, 0xfd, 0x52, 0xfc, 0x03, 0xf6, 0x60, 0x84, 0x21, 0xf4, 0x81, 
+0x27, 0xf8, 0xa7, 0x65, 0xed, 0x5b, 0x8c, 0x5a, 0x2f, 0xda, 0x20, 0xae, 0x57, 0x81, 0x64, 0x83, 
+0xb9, 0xbd, 0x87, 0xc8, 0x36, 0x88, 0xe9, 0x13, 0x6b, 0x50, 0xc0, 0xdc, 0xd7, 0x47, 0x81, 0xf8, 
+0x14, 0x5f, 0x1b, 0x34, 0x3d, 0x3c, 0xd1, 0xa8, 0xc0, 0xc2, 0x47, 0xfc, 0x14, 0x88, 0xfe, 0xb1, 
+0xbf, 0x0d, 0x4a, 0x1f, 0xcd, 0x0f, 0xb0, 0xc1, 0xfc, 0x9e, 0x85, 0x81, 0x0a, 0x24, 0x34, 0x07, 
+0xa5, 0x06, 0x26, 0x4e, 0x02, 0x88, 0xea, 0xf0, 0x21, 0x64, 0x45, 0x2a, 0x91, 0x80, 0x87, 0x80, 
+0x67, 0xc7, 0x0f, 0x61, 0x96, 0x75, 0xac, 0x15, 0xf0, 0x08, 0xc7, 0xb3, 0x93, 0x02, 0xd9, 0x69, 
+0x21, 0x0a, 0xcc, 0x1c, 0xd3, 0x45, 0x81, 0xbc, 0xcc, 0x50, 0x05, 0x72, 0xd2, 0xc3, 0x14, 0xc8, 
+0xcd, 0x08, 0xb7, 0x49, 0xf5, 0x8d, 0xe3, 0x22, 0x6c, 0xd0, 0xad, 0xc7, 0x84, 0xc8, 0x0f, 0xe1, 
+0x57, 0x1d, 0x7e, 0xd2, 0x01, 0xf0, 0xe8, 0x88, 0xa7, 0xf9, 0x43, 0xf8, 0x65, 0xef, 0xa7, 0x7b, 
+0x03, 0x1e, 0x41, 0x78, 0xc6, 0xdb, 0x03, 0xd7, 0x74, 0x6f, 0x68, 0x48, 0x50, 0xe0, 0xe6, 0x0d, 
+0x8b, 0x3d, 0xf0, 0x74, 0x79, 0x6d, 0xad, 0xf5, 0x43, 0x78, 0xb5, 0xe3, 0x33, 0x1d, 0x01, 0x8f, 
+0x50, 0x3c, 0x93, 0x14, 0x98, 0x62, 0xef, 0xa5, 0xc0, 0xb4, 0x61, 0xbd, 0x53, 0x8d, 0xd6, 0xc1, 
+0xe3, 0xe1, 0xc1, 0x3e, 0x36, 0xe8, 0x9f, 0x34, 0xa0, 0xaf, 0x0d, 0xfa, 0x25, 0x0f, 0x4a, 0xb1, 
+0x07, 0x0e, 0xb4, 0xd4, 0xd5, 0x3d, 0x0a, 0x60, 0x1a, 0x9d, 0x6a, 0x1c, 0x30, 0x08, 0x5f, 0x06, 
+0x6d, 0xd0, 0xcb, 0x23, 0x57, 0xd0, 0xa0, 0x3b, 0xd9, 0x10, 0x7b, 0x47, 0xc3, 0xec, 0xd8, 0x6e, 
+0xdb, 0x1e, 0xc5, 0x6e, 0x8e, 0x6b, 0x3f, 0xb1, 0x53, 0xfb, 0x89, 0x44, 0xf6, 0xcf, 0x77, 0x61, 
+0x72, 0x40, 0xd6, 0xfc, 0xec, 0x85, 0x39, 0x8b, 0x73, 0x57, 0xe5, 0xad, 0x51, 0xde, 0x4f, 0xfb, 
+0x38, 0xfd, 0xf3, 0x8c, 0x13, 0x99, 0xdf, 0x9a, 0x26, 0x17, 0xf9, 0x66, 0xed, 0x9b, 0xb6, 0x39, 
+0xf7, 0xa4, 0xb2, 0x7f, 0xd8, 0x96, 0x8c, 0x53, 0xa6, 0xa2, 0x89, 0x01, 0x59, 0xf3, 0xb2, 0x17, 
+0xe4, 0x2c, 0xca, 0x7d, 0x33, 0x6f, 0xb5, 0xf2, 0x5e, 0xda, 0x47, 0xe9, 0x9f, 0x66, 0x7c, 0x99, 
+0xf9, 0x8d, 0x69, 0xa2, 0xf9, 0x81, 0x2c, 0x75, 0x4a, 0x69, 0xf6, 0xdc, 0x9c, 0x4d, 0xb9, 0x6f, 
+0xe7, 0xbd, 0x33, 0xf3, 0xac, 0xb2, 0xcb, 0x3e, 0x3b, 0x6d, 0x59, 0xfa, 0x27, 0x19, 0x5f, 0x64, 
+0x7e, 0x3d, 0xe6, 0x3b, 0x93, 0x39, 0x26, 0x28, 0xab, 0x38, 0xfb, 0xf5, 0x9c, 0x37, 0x72, 0x57, 
+0xe6, 0xcd, 0x99, 0xb9, 0x56, 0x59, 0x92, 0xf6, 0x97, 0xf4, 0xcf, 0x32, 0xd6, 0x65, 0xbe, 0x35, 
+0xe6, 0x92, 0x29, 0x06, 0x7c, 0x15, 0x31, 0x04, 0x12, 0x14, 0x09, 0x54, 0x98, 0xec, 0xe3, 0x1c, 
+0x07, 0xfe, 0xba, 0x34, 0x6d, 0xf3, 0xb0, 0x2d, 0xf8, 0xab, 0x3e, 0xce, 0x5f, 0xc5, 0xdf, 0xf2, 
+0xd3, 0xff, 0x16, 0xfb, 0x1d, 0xfc, 0x7e, 0x7f, 0xd7, 0xef, 0x67, 0xdf, 0x8d, 0xdf, 0x6c, 0x20, 
+0xf8, 0x35, 0xa4, 0x94, 0x44, 0x2e, 0xd5, 0xcf, 0xe4, 0x72, 0xeb, 0x0a, 0x3e, 0x93, 0x0c, 0x3b, 
+0x27, 0x4f, 0x69, 0x48, 0xb2, 0xb0, 0x61, 0x78, 0xc0, 0x91, 0x2f, 0x1b, 0x1b, 0xc7, 0x0f, 0xe1, 
+0xc6, 0x31, 0x3a, 0x4f, 0x38, 0x31, 0xb0, 0x51, 0x6a, 0xe3, 0x0b, 0xe0, 0xe3, 0x73, 0x42, 0xaf, 
+0xc1, 0xce, 0x67, 0xe8, 0xae, 0xf1, 0x7f, 0xde, 0x3b, 0xfe, 0xcf, 0x5f, 0x0d, 0x74, 0x8f, 0x7f, 
+0xd3, 0x55, 0xf8, 0xfe, 0x8c, 0xe0, 0x87, 0x24, 0x3a, 0xc2, 0x1a, 0x2c, 0xd8, 0x46, 0xc8, 0x92, 
+0x3b, 0xea, 0x1c, 0xaa, 0x51, 0xe7, 0x04, 0xe1, 0x79, 0x8d, 0x2a, 0x59, 0xbf, 0x4b, 0xb8, 0x0a, 
+0x9d, 0x04, 0x27, 0x35, 0x3a, 0xa8, 0xd0, 0x41, 0x95, 0xa2, 0x88, 0x6f, 0xbc, 0x2e, 0xb1, 0xf6, 
+0xa6, 0xcc, 0xda, 0x1b, 0x06, 0xd6, 0x96, 0xfb, 0xb0, 0x76, 0x8f, 0x2f, 0xb6, 0x8d, 0xd5, 0x46, 
+0x76, 0x9d, 0xec, 0xc7, 0xda, 0x02, 0x7f, 0xd6, 0x0e, 0x0e, 0x60, 0x6d, 0x73, 0x10, 0x6b, 0x9b, 
+0x3a, 0x30, 0xe4, 0x24, 0x77, 0x64, 0xed, 0xe0, 0x4e, 0x36, 0x24, 0xb8, 0x66, 0xb7, 0x14, 0x27, 
+0x48, 0x0d, 0xb5, 0x11, 0x12, 0x8c, 0xcb, 0xaf, 0x88, 0x88, 0x54, 0x20, 0x4b, 0x31, 0x2b, 0x50, 
+0x3a, 0x3b, 0x5e, 0xf2, 0xad, 0xab, 0x87, 0xc8, 0x04, 0x01, 0xcc, 0x31, 0x16, 0x09, 0x26, 0x14, 
+0x56, 0x3e, 0x44, 0x94, 0x94, 0x22, 0x41, 0xff, 0x7e, 0xe3, 0x1f, 0x64, 0x54, 0x33, 0x5d, 0x84, 
+0xe4, 0xc1, 0xcd, 0x45, 0x02, 0x24, 0x25, 0xe1, 0x60, 0x7d, 0x01, 0x54, 0x99, 0x5a, 0x1a, 0x60, 
+0x19, 0x0d, 0x21, 0xa4, 0x6d, 0x2b, 0xd2, 0x37, 0x4b, 0x75, 0xe0, 0xde, 0xcb, 0x6a, 0xec, 0x94, 
+0xfa, 0x00, 0xc3, 0xcb, 0x3d, 0x98, 0xed, 0x20, 0xe7, 0xef, 0xb1, 0xb9, 0x6e, 0xe3, 0x4c, 0x5f, 
+0x1b, 0x2d, 0xc8, 0x9d, 0xd8, 0x24, 0xb3, 0x49, 0xbb, 0x65, 0x92, 0x07, 0x68, 0x93, 0x7c, 0x08, 
+0x3e, 0x01, 0x3e, 0xc9, 0xac, 0xdf, 0x25, 0xcc, 0x84, 0xd9, 0x3a, 0xde, 0xea, 0x2b, 0x48, 0x50, 
+0xef, 0x91, 0xf9, 0x11, 0xfa, 0xe3, 0x45, 0xa9, 0xa1, 0xf1, 0x6a, 0x82, 0x20, 0xd5, 0xd6, 0x39, 
+0x19, 0x18, 0xc3, 0x37, 0xc4, 0x13, 0x7a, 0xef, 0x35, 0x91, 0xdf, 0x23, 0x12, 0xba, 0x2d, 0x0b, 
+0xf3, 0x84, 0xd8, 0x18, 0xd8, 0x67, 0x94, 0x83, 0x01, 0xec, 0x8f, 0x21, 0xed, 0xd8, 0x15, 0x6b, 
+0x3f, 0x76, 0x85, 0x8d, 0xe2, 0x23, 0xb9, 0xc3, 0xf3, 0x78, 0x0d, 0xcf, 0x3d, 0x84, 0x5e, 0x1a, 
+0x31, 0xb1, 0x7e, 0x92, 0xf4, 0xa2, 0x54, 0x49, 0xa2, 0x4f, 0x15, 0x3e, 0xc6, 0xfb, 0xc7, 0xf2, 
+0xd2, 0xc4, 0x77, 0xbd, 0x88, 0x3a, 0x22, 0xae, 0x0b, 0x92, 0x28, 0x40, 0xcc, 0x10, 0x19, 0xdb, 
+0xe4, 0x72, 0x22, 0xae, 0x3d, 0xb4, 0x76, 0x0f, 0xf9, 0xe2, 0x7f, 0x06, 0x73, 0xe2, 0x3a, 0x46, 
+0xc4, 0x75, 0x93, 0x88, 0xeb, 0x06, 0x11, 0xd7, 0xf6, 0x40, 0xd6, 0x6e, 0xa3, 0xf5, 0x7d, 0xa9, 
+0xf5, 0x54, 0xda, 0x70, 0x2a, 0xaf, 0x87, 0xd9, 0x70, 0x2e, 0x9b, 0xba, 0x32, 0xbc, 0x5e, 0x0e, 
+0x17, 0xa5, 0xba, 0xba, 0x71, 0x11, 0xa2, 0xd4, 0xd8, 0x30, 0x81, 0x53, 0x17, 0xfb, 0x5c, 0x11, 
+0x4e, 0x72, 0x6d, 0x6d, 0x7e, 0x82, 0x6c, 0x8c, 0x2d, 0x40, 0xb9, 0x63, 0x11, 0x61, 0xc0, 0xa0, 
+0x42, 0x9a, 0xed, 0x64, 0xf6, 0xa9, 0x9d, 0x3d, 0x89, 0x65, 0xf6, 0x62, 0x6d, 0x73, 0x6f, 0xd6, 
+0x9e, 0xee, 0x83, 0x43, 0x32, 0x9f, 0xeb, 0x8b, 0x6d, 0x52, 0x62, 0x8a, 0x4d, 0x9e, 0xbb, 0xac, 
+0x9e, 0x04, 0x97, 0x08, 0x3b, 0xdf, 0x6d, 0xbe, 0xdd, 0x14, 0xde, 0x5b, 0x3a, 0xf8, 0x5e, 0x9a, 
+0x52, 0x6a, 0x9f, 0x6d, 0xfa, 0x1e, 0x8c, 0xb4, 0x1c, 0x03, 0xa8, 0x0d, 0xa4, 0x36, 0x88, 0xda, 
+0x4e, 0x0c, 0xc2, 0xa3, 0x91, 0x12, 0xb6, 0xcb, 0x57, 0x74, 0x63, 0xdd, 0xe6, 0x2d, 0x71, 0x12, 
+0x89, 0x87, 0x76, 0x0f, 0xd1, 0xec, 0x79, 0x88, 0x5e, 0x85, 0xa2, 0x95, 0x0f, 0xd2, 0xaa, 0x31, 
+0x26, 0x03, 0xb5, 0x7c, 0xc0, 0x7e, 0xd4, 0xfa, 0x7b, 0x1d, 0x7c, 0x08, 0x1b, 0xee, 0x99, 0xaf, 
+0x42, 0xe9, 0x5f, 0x5d, 0xf9, 0xd8, 0x35, 0x80, 0x08, 0x92, 0xc3, 0x47, 0x2c, 0x82, 0x74, 0xf0, 
+0x50, 0x1f, 0x7a, 0xbd, 0x2f, 0x6b, 0x0f, 0xb4, 0x1f, 0xb4, 0x00, 0x27, 0x68, 0x4e, 0xc0, 0x10, 
+0x2c, 0x3f, 0x87, 0xa4, 0x73, 0xca, 0x39, 0x2b, 0x03, 0x75, 0x43, 0x4e, 0x05, 0x82, 0x5a, 0x85, 
+0x80, 0x6e, 0x4c, 0xaf, 0x44, 0x40, 0xb7, 0x72, 0x10, 0x13, 0x03, 0xb2, 0xf6, 0x65, 0x9f, 0xcd, 
+0xb9, 0x9c, 0x7b, 0x72, 0xda, 0x66, 0x65, 0x7f, 0xda, 0x77, 0xe9, 0x57, 0x32, 0x4e, 0x21, 0x43, 
+0x48, 0x1c, 0x10, 0x90, 0x75, 0x2d, 0xfb, 0x42, 0xce, 0xf1, 0xdc, 0x1b, 0x79, 0xdf, 0x2b, 0xd7, 
+0xd3, 0x2e, 0xa6, 0x9f, 0xcb, 0xb8, 0x99, 0x79, 0xde, 0x34, 0x60, 0x50, 0x40, 0x56, 0x49, 0xf6, 
+0x9e, 0x9c, 0xab, 0xb9, 0x65, 0x79, 0xbb, 0x95, 0xa5, 0x69, 0x7b, 0xd3, 0x8f, 0x65, 0xac, 0xcf, 
+0xdc, 0x61, 0x1a, 0x04, 0x44, 0x01, 0x65, 0x44, 0x01, 0x6b, 0x69, 0xed, 0xab, 0xb4, 0xea, 0x2b, 
+0x68, 0xa5, 0xef, 0x08, 0xb5, 0x31, 0x58, 0xc3, 0xd8, 0x4a, 0x5b, 0x4a, 0x4b, 0xbb, 0xa4, 0x0f, 
+0xfb, 0x7f, 0xa5, 0x53, 0xae, 0x2f, 0x49, 0x5b, 0x9e, 0xb9, 0xbe, 0x15, 0xbc, 0xc5, 0x69, 0x2b, 
+0xd2, 0xab, 0x70, 0xac, 0x1b, 0x4c, 0x13, 0x37, 0x19, 0xb2, 0xe7, 0x6a, 0x1c, 0x7e, 0xd3, 0x66, 
+0x5f, 0x0e, 0x63, 0xda, 0xca, 0xf4, 0x55, 0xb8, 0xa6, 0x36, 0x6f, 0xe1, 0xd3, 0xb5, 0x05, 0xde, 
+0x4a, 0xf5, 0xf5, 0xdb, 0x23, 0x20, 0x03, 0xc0, 0x46, 0xf1, 0x27, 0x06, 0x10, 0xd4, 0x8a, 0x01, 
+0x14, 0x68, 0x0c, 0x20, 0x42, 0xb8, 0x21, 0x72, 0x46, 0xc0, 0xfa, 0x11, 0xd2, 0x8f, 0x44, 0xde, 
+0x87, 0x52, 0x3f, 0x49, 0x9a, 0x27, 0xe5, 0xcb, 0xac, 0x57, 0xa9, 0x1f, 0x27, 0xfd, 0xc1, 0xf0, 
+0x1b, 0x1f, 0xd6, 0x1f, 0xa6, 0xfe, 0xb1, 0xbc, 0x5a, 0xf9, 0xa6, 0xec, 0x99, 0x41, 0xf8, 0x0a, 
+0xc8, 0x02, 0x08, 0x0b, 0xf9, 0xc4, 0x01, 0x0a, 0xfd, 0xe5, 0x00, 0xfc, 0x34, 0x44, 0x04, 0xb0, 
+0x7e, 0x02, 0x3c, 0x44, 0x58, 0xa9, 0xf6, 0xac, 0xc7, 0xca, 0x0f, 0xd4, 0x37, 0xd6, 0x42, 0x24, 
+0x6a, 0xb2, 0xa5, 0xb3, 0x8b, 0x9c, 0x94, 0xdf, 0x1c, 0x8f, 0xaa, 0xf3, 0xc7, 0x48, 0xf8, 0xc9, 
+0xe3, 0x0b, 0x90, 0xf0, 0x15, 0x98, 0xff, 0xbe, 0x95, 0x48, 0x9e, 0x6b, 0x49, 0x4e, 0x8e, 0x4f, 
+0x04, 0x3f, 0x80, 0x11, 0x7c, 0xcc, 0xa0, 0x14, 0x05, 0xe6, 0x2e, 0xe3, 0x8a, 0x6a, 0xe0, 0x9a, 
+0x6f, 0x01, 0x15, 0x55, 0x4e, 0xf1, 0x3d, 0xe4, 0x28, 0x36, 0xd6, 0x99, 0x80, 0xef, 0xba, 0xbe, 
+0x43, 0x12, 0xc4, 0x9b, 0x2a, 0x0a, 0xa7, 0x1b, 0xe5, 0x06, 0x01, 0xb6, 0x1f, 0xf2, 0x11, 0xc4, 
+0x6d, 0xaa, 0xaf, 0x20, 0x5e, 0x52, 0x8d, 0x1d, 0x00, 0xfc, 0xf0, 0xf4, 0x17, 0xe0, 0xc2, 0x85, 
+0x00, 0xbc, 0x08, 0x14, 0xa0, 0xaa, 0x2a, 0x08, 0x57, 0xb0, 0xda, 0x01, 0xef, 0x50, 0xb7, 0x86, 
+0x4e, 0x78, 0x06, 0x0b, 0x70, 0x79, 0x6b, 0x67, 0xbc, 0x08, 0x11, 0x60, 0xef, 0xde, 0x2e, 0x78, 
+0x11, 0x8a, 0x27, 0x42, 0x53, 0xb6, 0xbe, 0xab, 0x82, 0xd4, 0x80, 0x8a, 0x82, 0x7a, 0x20, 0x42, 
+0x10, 0xea, 0xce, 0x21, 0x38, 0xcb, 0x57, 0x44, 0x09, 0x70, 0xbc, 0xc9, 0xa4, 0x20, 0x2d, 0x44, 
+0x0b, 0x50, 0x51, 0x11, 0x83, 0xef, 0x8d, 0xc5, 0xb3, 0x1b, 0x9e, 0xdd, 0xf1, 0x8c, 0xc3, 0xd3, 
+0x8c, 0xaa, 0x85, 0x1a, 0x8f, 0x17, 0xa8, 0x46, 0x24, 0xd6, 0x58, 0xf0, 0xc2, 0x8a, 0x67, 0x22, 
+0x9e, 0x49, 0x02, 0xec, 0xd9, 0x9d, 0x8c, 0x17, 0x3d, 0xf1, 0xec, 0x85, 0x67, 0x6f, 0x01, 0x4e, 
+0x57, 0xf6, 0x11, 0x60, 0xc3, 0x86, 0xbe, 0x02, 0x5c, 0xbb, 0x92, 0x22, 0x88, 0xc9, 0xea, 0xc3, 
+0x1c, 0xbc, 0x19, 0xa3, 0x05, 0xf1, 0x98, 0x0a, 0x1a, 0xb0, 0xf9, 0xf7, 0x0d, 0x58, 0x41, 0x50, 
+0x8f, 0xfe, 0xf0, 0xd0, 0xce, 0xe2, 0xd0, 0xfe, 0x30, 0x3a, 0x4e, 0xb3, 0x94, 0x55, 0xa2, 0x2c, 
+0x35, 0x35, 0xb7, 0xf0, 0x78, 0xc4, 0x02, 0xd4, 0xb1, 0x25, 0xbb, 0x5c, 0x43, 0x7f, 0x21, 0x5b, 
+0xb2, 0x4b, 0x46, 0x2b, 0xb0, 0x66, 0x3d, 0x88, 0x08, 0x89, 0x63, 0x1e, 0x2a, 0x68, 0x1e, 0xd6, 
+0x3a, 0xe6, 0x61, 0x87, 0x9b, 0x79, 0xc0, 0x13, 0xa7, 0xa1, 0xb1, 0xd5, 0x34, 0x88, 0x25, 0x2a, 
+0x4d, 0x03, 0x9e, 0x2d, 0x4b, 0x0e, 0xcf, 0xae, 0x78, 0x86, 0xe3, 0x8c, 0x34, 0x47, 0x08, 0x50, 
+0x54, 0x19, 0x89, 0x77, 0x6c, 0x06, 0x96, 0x9a, 0xf0, 0x22, 0x1a, 0xcf, 0xf6, 0xe2, 0x5f, 0x2c, 
+0x53, 0x5d, 0xf1, 0x2f, 0x9e, 0x56, 0xfb, 0xe0, 0xc5, 0x2d, 0xe8, 0x2f, 0x40, 0xf4, 0xab, 0xea, 
+0x2d, 0x4c, 0xad, 0x35, 0xc3, 0x6a, 0x0b, 0x93, 0x6b, 0x61, 0x6a, 0xbe, 0x5c, 0x9a, 0x70, 0xd1, 
+0x12, 0xc6, 0xa5, 0x49, 0x04, 0x13, 0x1a, 0x75, 0xae, 0x32, 0x85, 0x89, 0x93, 0x86, 0x03, 0x4c, 
+0x9c, 0x1c, 0x3c, 0xe4, 0x79, 0x01, 0xb8, 0x67, 0xf7, 0x45, 0xf7, 0x42, 0xcc, 0x78, 0x12, 0x19, 
+0x64, 0x7e, 0xdd, 0x22, 0x7e, 0x4c, 0x31, 0x1e, 0x45, 0x89, 0x8b, 0xe1, 0xac, 0xad, 0x9c, 0xd7, 
+0x6e, 0x25, 0x5c, 0x41, 0x3d, 0xe4, 0x83, 0x93, 0xe0, 0x8b, 0xe7, 0xbf, 0x38, 0x8f, 0x2a, 0x1a, 
+0x8d, 0xaf, 0xdf, 0xbd, 0x0e, 0x7d, 0x87, 0xda, 0x8e, 0x83, 0x6c, 0x5b, 0xb4, 0x9e, 0xe1, 0xd5, 
+0xb2, 0xdc, 0x84, 0x62, 0xd4, 0xbb, 0x0a, 0xfd, 0xac, 0x30, 0x49, 0x53, 0xa1, 0x27, 0x91, 0x0a, 
+0xfd, 0x99, 0xf4, 0x2c, 0x49, 0xca, 0xcf, 0x85, 0xff, 0x4b, 0x2a, 0xf4, 0x6b, 0x62, 0xa8, 0xe4, 
+0x45, 0x85, 0x66, 0x8b, 0x16, 0xe7, 0x53, 0x62, 0x3a, 0xf4, 0x4d, 0x99, 0xdd, 0xe1, 0x9c, 0xb2, 
+0x0e, 0xd9, 0x31, 0xa9, 0xc8, 0xa4, 0x46, 0x5f, 0xd2, 0x84, 0xa8, 0xcc, 0xb4, 0xf3, 0x0b, 0x11, 
+0xfe, 0x9a, 0xf8, 0x24, 0x55, 0xba, 0x30, 0x90, 0xbd, 0xbd, 0xa0, 0x8a, 0x54, 0xaf, 0x46, 0x92, 
+0xa5, 0xc1, 0x6c, 0xcd, 0x5c, 0xde, 0x1a, 0x62, 0x43, 0x91, 0xba, 0x57, 0x27, 0x53, 0xed, 0x28, 
+0x53, 0x71, 0x8e, 0xed, 0x44, 0x49, 0xe1, 0x72, 0x40, 0x7d, 0x7d, 0x33, 0x0a, 0x57, 0x7b, 0x60, 
+0xe9, 0xec, 0xba, 0x03, 0x91, 0x76, 0x94, 0xae, 0x38, 0xd9, 0xec, 0x45, 0x9c, 0x6e, 0x3b, 0x11, 
+0x53, 0x34, 0x5b, 0x82, 0x15, 0x66, 0x09, 0x6d, 0xc6, 0x86, 0x06, 0x2e, 0x74, 0x45, 0x68, 0x6e, 
+0xae, 0xb6, 0xd8, 0x03, 0xe7, 0xbf, 0x5f, 0x5b, 0xeb, 0x22, 0x74, 0xed, 0x28, 0x74, 0xf7, 0xec, 
+0xe6, 0x9e, 0x22, 0xf6, 0x69, 0x9c, 0xe5, 0x16, 0xe9, 0x9b, 0x34, 0x28, 0xc5, 0x86, 0xd2, 0x37, 
+0x99, 0x8b, 0x5f, 0x58, 0xf3, 0xed, 0xf8, 0x82, 0x07, 0xef, 0x99, 0xdb, 0xc1, 0x0b, 0x93, 0x76, 
+0xb0, 0x60, 0x2f, 0x06, 0xa9, 0x41, 0x33, 0xb7, 0x59, 0xeb, 0x2b, 0x1a, 0x60, 0xb0, 0xa6, 0xbd, 
+0x86, 0xde, 0x46, 0xd9, 0xbe, 0x17, 0xcb, 0xd1, 0xb1, 0xd4, 0xbc, 0x7a, 0xa6, 0x44, 0x86, 0x7d, 
+0x55, 0x95, 0x58, 0xe7, 0xf0, 0x0e, 0xb8, 0x0e, 0x9a, 0x14, 0x72, 0xfe, 0x72, 0x20, 0xef, 0x38, 
+0x08, 0xc1, 0xfc, 0x93, 0x9d, 0x39, 0xe7, 0x0c, 0xa1, 0xf7, 0x69, 0x60, 0x85, 0xf1, 0x97, 0xba, 
+0xf2, 0x2e, 0x8a, 0x5e, 0x32, 0xf1, 0x9b, 0x68, 0xba, 0xd1, 0xb8, 0x69, 0x12, 0xff, 0x5f, 0x6f, 
+0xfe, 0xb5, 0xa4, 0xaa, 0x1f, 0x24, 0x55, 0xfd, 0xfe, 0xf3, 0x56, 0x6f, 0xea, 0x7a, 0x7b, 0xf8, 
+0xae, 0x47, 0xfe, 0xaa, 0x21, 0x96, 0xdc, 0x42, 0x15, 0x06, 0x09, 0x81, 0x82, 0xb5, 0xbe, 0xa4, 
+0xa6, 0x6b, 0x58, 0x0c, 0xb6, 0x23, 0x99, 0x95, 0xa8, 0x21, 0x5c, 0x69, 0xb7, 0x73, 0x8c, 0xf1, 
+0x2e, 0x82, 0xbd, 0x54, 0x54, 0x17, 0xc9, 0xef, 0xa2, 0xec, 0xec, 0xc3, 0x4b, 0x4d, 0xfc, 0x2e, 
+0x9a, 0xde, 0x4f, 0xf2, 0x9e, 0xe4, 0x7c, 0x12, 0x7b, 0x6f, 0x99, 0xda, 0xdb, 0x4e, 0x5f, 0x4a, 
+0x24, 0x40, 0x92, 0xff, 0x9e, 0x8a, 0xc7, 0x45, 0x01, 0x12, 0xf2, 0x14, 0xfb, 0x58, 0x83, 0x08, 
+0x1e, 0x9d, 0x67, 0xa3, 0xa4, 0xe7, 0x85, 0xf7, 0x04, 0xc6, 0xb4, 0x8c, 0xc2, 0x03, 0x1a, 0xd3, 
+0x62, 0xfd, 0x14, 0xe9, 0x29, 0x71, 0x9d, 0x1b, 0x3b, 0x5f, 0x14, 0xc1, 0xd2, 0x2b, 0x1a, 0xed, 
+0x7b, 0xb5, 0x37, 0xb3, 0xef, 0xd5, 0x3e, 0xb1, 0x06, 0x6c, 0xfb, 0x76, 0xf3, 0xc1, 0x36, 0xa5, 
+0x3b, 0x32, 0x26, 0xf5, 0xe1, 0x89, 0x46, 0x11, 0xce, 0x3e, 0x12, 0xe7, 0x27, 0x82, 0xfa, 0xe3, 
+0x1e, 0xfe, 0x22, 0x6c, 0x7a, 0x34, 0x3e, 0x40, 0x84, 0xb9, 0x3d, 0x13, 0x02, 0x25, 0x18, 0xd8, 
+0x3d, 0x71, 0x52, 0x90, 0x24, 0xd5, 0xaa, 0x03, 0x2d, 0x9e, 0x35, 0x7c, 0x09, 0xde, 0x49, 0x1e, 
+0x97, 0x1f, 0x21, 0x41, 0x42, 0xfc, 0x84, 0x42, 0xae, 0xe1, 0x4b, 0x82, 0x1a, 0xd3, 0xbf, 0x5f, 
+0xbc, 0x64, 0x6c, 0x8a, 0x3e, 0xd4, 0x90, 0x20, 0x89, 0xfd, 0xeb, 0x27, 0x17, 0x59, 0x24, 0xa1, 
+0xce, 0x3c, 0xbe, 0x40, 0xa7, 0xd9, 0x23, 0xc7, 0x1c, 0x3c, 0x60, 0x43, 0x5f, 0xec, 0xfa, 0x0d, 
+0xba, 0x92, 0x22, 0x41, 0xe2, 0xa4, 0xe4, 0xc1, 0x9a, 0x35, 0x1f, 0xd7, 0xe3, 0xb8, 0x83, 0xb9, 
+0xdc, 0x9d, 0x06, 0xe7, 0x69, 0xc9, 0x02, 0x7e, 0xf7, 0x67, 0x88, 0xee, 0x33, 0x88, 0xe7, 0x8d, 
+0x68, 0x07, 0xdd, 0xc4, 0x09, 0xaf, 0x44, 0x31, 0x0b, 0x0d, 0xf4, 0xb3, 0xd5, 0xc1, 0x0a, 0xbc, 
+0x34, 0xa2, 0xb3, 0x02, 0x2f, 0x8f, 0x8a, 0x52, 0x60, 0xfa, 0x48, 0x94, 0x9d, 0xcf, 0xa5, 0xc6, 
+0x29, 0x30, 0x75, 0xa8, 0x19, 0x60, 0x7e, 0x3c, 0x2d, 0xae, 0x46, 0xab, 0x02, 0xb3, 0xc6, 0x8e, 
+0xa6, 0xeb, 0x03, 0x60, 0xee, 0x9a, 0xa5, 0x4e, 0x29, 0x61, 0x03, 0x9d, 0xba, 0x62, 0xda, 0xc9, 
+0xdc, 0xb7, 0x5f, 0xfa, 0x66, 0xfa, 0x5a, 0x36, 0xe0, 0x59, 0xdb, 0x94, 0x5d, 0xf6, 0xa5, 0x6c, 
+0xd0, 0x43, 0x97, 0x0f, 0x3b, 0x91, 0xf1, 0xc5, 0x88, 0xaf, 0x46, 0xae, 0x61, 0x83, 0x1f, 0xbb, 
+0x18, 0x87, 0xef, 0xc7, 0x86, 0xcf, 0x06, 0xcf, 0x86, 0xee, 0x18, 0x78, 0xde, 0xfc, 0xcc, 0xcf, 
+0x4d, 0xcd, 0x97, 0x82, 0xa7, 0x6c, 0x7c, 0xee, 0xe3, 0xec, 0xcf, 0xa6, 0xae, 0x9e, 0x76, 0xea, 
+0xa5, 0x9b, 0xd3, 0xcf, 0xbc, 0x5c, 0x3e, 0xab, 0xd2, 0xbe, 0x3d, 0xf5, 0xa3, 0xb4, 0xf7, 0x87, 
+0xae, 0x1a, 0x76, 0x74, 0xc4, 0x8d, 0x91, 0xa7, 0x47, 0x95, 0x8d, 0xad, 0x30, 0x5d, 0x9a, 0xe8, 
+0x9b, 0x35, 0x8f, 0x81, 0xa7, 0xbc, 0xc7, 0x40, 0x33, 0x4d, 0xbc, 0x60, 0xc8, 0x7d, 0x23, 0xef, 
+0x7a, 0xc6, 0x42, 0xa4, 0xe3, 0x0b, 0x0c, 0xc8, 0x05, 0x08, 0x64, 0x15, 0x02, 0x59, 0x8a, 0x40, 
+0x6e, 0x45, 0x20, 0x97, 0x1b, 0x91, 0x46, 0x08, 0x50, 0x6f, 0x20, 0xae, 0x8e, 0x97, 0x7e, 0xb4, 
+0x03, 0x54, 0x0e, 0x62, 0x1f, 0x4e, 0x4b, 0x60, 0xee, 0xc8, 0x67, 0x62, 0xea, 0x62, 0x04, 0xaf, 
+0x1a, 0x81, 0x5b, 0xab, 0x30, 0xc0, 0xde, 0x18, 0xba, 0x30, 0x63, 0xd5, 0x88, 0x6d, 0x99, 0x6b, 
+0xc6, 0xac, 0x47, 0xf1, 0xec, 0x9b, 0x55, 0xcc, 0x01, 0xe2, 0x4e, 0x2d, 0x04, 0x67, 0x75, 0x66, 
+0x85, 0xa9, 0xf9, 0x95, 0xe0, 0x29, 0xa5, 0xcf, 0xe1, 0x4c, 0x4c, 0x5d, 0x34, 0x6d, 0xf3, 0x4b, 
+0x5b, 0xa7, 0x57, 0xbd, 0xbc, 0x71, 0xd6, 0x72, 0xfb, 0xec, 0xd4, 0xf9, 0x69, 0xaf, 0x0f, 0x2d, 
+0x1f, 0xb6, 0x65, 0xc4, 0x86, 0x91, 0x65, 0xa3, 0x4a, 0xc6, 0xae, 0x30, 0xbd, 0x32, 0x51, 0xca, 
+0x7d, 0x33, 0xa3, 0x12, 0xe7, 0xa7, 0xeb, 0x35, 0x49, 0xbe, 0xc4, 0xa8, 0xc1, 0xad, 0xe8, 0x1e, 
+0xa5, 0x51, 0xc3, 0x93, 0x42, 0x23, 0x51, 0xc3, 0x62, 0x71, 0xa5, 0xc8, 0xa9, 0x81, 0xf5, 0x53, 
+0xa4, 0x08, 0x69, 0x81, 0xe4, 0xf4, 0x36, 0xde, 0x12, 0xd8, 0x11, 0x65, 0x4b, 0xaf, 0x5a, 0x09, 
+0xf5, 0xae, 0xde, 0xb2, 0x64, 0x50, 0xfb, 0xd4, 0x45, 0x32, 0x1d, 0xac, 0xaf, 0x8f, 0x68, 0x50, 
+0x53, 0xea, 0xd1, 0xe2, 0x55, 0x1f, 0x36, 0x8a, 0xf2, 0xd9, 0x47, 0x1a, 0x88, 0x26, 0xae, 0xf9, 
+0x8b, 0xf2, 0xa6, 0x47, 0x1b, 0x03, 0x04, 0xa4, 0x89, 0x40, 0x51, 0x1e, 0xd8, 0xfd, 0x00, 0x8a, 
+0xe9, 0x46, 0xf5, 0x20, 0x79, 0x95, 0xc7, 0x93, 0x57, 0xb9, 0x80, 0x13, 0x47, 0x8d, 0x16, 0xda, 
+0x61, 0xe1, 0x80, 0xd6, 0x44, 0x22, 0x22, 0x91, 0x5c, 0x89, 0x10, 0x91, 0x46, 0x36, 0x44, 0xda, 
+0x90, 0x44, 0x06, 0x90, 0x5c, 0x1e, 0x17, 0xc3, 0xda, 0x09, 0x66, 0xa4, 0xc3, 0x98, 0x6e, 0xf1, 
+0x22, 0x34, 0x45, 0x1f, 0x4f, 0x10, 0x90, 0x5a, 0x2c, 0xa2, 0x70, 0xc0, 0x7c, 0xc8, 0x5a, 0x03, 
+0x33, 0x43, 0xc6, 0x84, 0x0c, 0x0a, 0xe9, 0x1a, 0x02, 0x21, 0x24, 0xa2, 0x63, 0x93, 0x6c, 0x48, 
+0x3d, 0x71, 0xe4, 0x1c, 0x1b, 0x42, 0xce, 0xb1, 0xfc, 0x5e, 0x36, 0x24, 0xa5, 0x42, 0xcd, 0x39, 
+0xc6, 0x8c, 0x75, 0x26, 0xac, 0xfb, 0xf5, 0x48, 0x91, 0xe4, 0xc4, 0x49, 0x10, 0x45, 0xe4, 0x24, 
+0x21, 0x39, 0x0d, 0x78, 0x90, 0xfb, 0xfa, 0x8a, 0x24, 0xd1, 0xe7, 0x33, 0xa8, 0xa5, 0x95, 0x2f, 
+0xfa, 0x6c, 0x84, 0x7a, 0x1f, 0xd1, 0xe7, 0x26, 0x34, 0xf8, 0x8a, 0x3e, 0x95, 0xd0, 0x48, 0x2a, 
+0xca, 0x64, 0x72, 0x0c, 0x1d, 0x20, 0xc7, 0xd0, 0x41, 0x72, 0x0c, 0x1d, 0x22, 0xc7, 0xd0, 0x61, 
+0x04, 0xfb, 0x60, 0xed, 0x91, 0x5b, 0xc8, 0xc3, 0x86, 0x6b, 0xe7, 0xb0, 0xc9, 0x86, 0x8b, 0xe7, 
+0x48, 0x77, 0xf6, 0xda, 0x82, 0x38, 0x1b, 0xae, 0xa1, 0xf5, 0x8c, 0x4e, 0x12, 0xd8, 0x32, 0xb3, 
+0x80, 0x70, 0xb8, 0x37, 0xf7, 0xd8, 0xde, 0xe9, 0x9a, 0xbe, 0x2c, 0x65, 0xed, 0x57, 0xf6, 0x99, 
+0x2e, 0x3b, 0x68, 0xe3, 0xa2, 0x21, 0x6b, 0x4b, 0xf6, 0x56, 0x65, 0x73, 0x5a, 0x95, 0xe9, 0xe2, 
+0x35, 0x69, 0xd6, 0xde, 0xb1, 0x7b, 0x4c, 0xd7, 0xee, 0x84, 0xfe, 0xf4, 0xb4, 0xe2, 0x8e, 0x16, 
+0xbf, 0xf7, 0x9d, 0x52, 0x3a, 0x7d, 0xc7, 0xcb, 0xe7, 0xec, 0xb3, 0x47, 0xee, 0x1e, 0x75, 0x0c, 
+0xcd, 0x40, 0x8d, 0x25, 0xb5, 0x55, 0x71, 0x70, 0x30, 0x21, 0x4f, 0x72, 0xf6, 0x2e, 0x1d, 0x8f, 
+0x2d, 0x13, 0xba, 0x80, 0x26, 0xd4, 0x95, 0xca, 0x45, 0x71, 0xad, 0x36, 0x95, 0xdc, 0xc7, 0xd7, 
+0x40, 0x93, 0xd8, 0x88, 0x93, 0xd8, 0x50, 0xab, 0x3a, 0xa7, 0x8f, 0xec, 0x2f, 0xd5, 0x1d, 0x03, 
+0x40, 0x21, 0xca, 0xe6, 0x0f, 0xd7, 0xa2, 0x6f, 0x23, 0xce, 0x5d, 0x7b, 0x09, 0xd8, 0x41, 0xf8, 
+0x77, 0xc2, 0x34, 0xe0, 0xd4, 0xab, 0xa2, 0x1f, 0x40, 0xea, 0x53, 0xd6, 0x8d, 0xd8, 0x78, 0xe3, 
+0x00, 0x63, 0xa5, 0x9b, 0xcc, 0x54, 0x22, 0xca, 0x67, 0x7d, 0x96, 0x34, 0x5f, 0x58, 0x86, 0x7d, 
+0xdf, 0xbc, 0xbf, 0x09, 0x61, 0xa2, 0xe7, 0xa0, 0x92, 0xc3, 0xe3, 0xcd, 0x02, 0x49, 0x28, 0x11, 
+0xe1, 0x50, 0x37, 0xe6, 0xe8, 0x8a, 0x33, 0x32, 0x17, 0x78, 0xbe, 0x1f, 0x4a, 0xa4, 0xf8, 0x71, 
+0x11, 0xfe, 0xd8, 0x25, 0x4c, 0x40, 0x0d, 0x5d, 0x80, 0x81, 0x85, 0x68, 0x86, 0x59, 0x06, 0x07, 
+0x89, 0x52, 0x43, 0x6d, 0x81, 0x67, 0x49, 0xa8, 0x40, 0xc9, 0xd2, 0x08, 0xc9, 0xb7, 0xb1, 0xbe, 
+0x2e, 0xd2, 0x11, 0x41, 0x5a, 0xbe, 0x22, 0x9e, 0x19, 0x65, 0x68, 0x54, 0x6d, 0x6b, 0xb2, 0xa0, 
+0x2e, 0xdd, 0x43, 0x17, 0x8c, 0x6d, 0x71, 0x68, 0xf7, 0x27, 0x0d, 0xbb, 0xdf, 0x20, 0x92, 0x81, 
+0xe3, 0x1d, 0x44, 0x3b, 0x60, 0xd0, 0xf8, 0x07, 0x81, 0x2c, 0x88, 0xa3, 0x3f, 0x7c, 0x78, 0x0f, 
+0x19, 0x24, 0xbc, 0x9b, 0x80, 0x4d, 0xc8, 0xbd, 0x8e, 0xbb, 0x70, 0x08, 0x51, 0x22, 0xd5, 0x6b, 
+0x3a, 0x2f, 0x62, 0xb0, 0xa1, 0xae, 0x36, 0x32, 0x8a, 0xdd, 0x1c, 0x37, 0x31, 0x3b, 0xe9, 0x30, 
+0x1c, 0xe9, 0xce, 0xee, 0x2e, 0x5a, 0x45, 0xb2, 0x56, 0x44, 0x0a, 0xa4, 0x32, 0xa8, 0x73, 0x16, 
+0x23, 0x26, 0xf6, 0xa7, 0x7f, 0x8e, 0x58, 0xb8, 0x33, 0x17, 0x90, 0xeb, 0xca, 0xbb, 0x0a, 0x8b, 
+0x4d, 0x62, 0x28, 0xae, 0xbc, 0xd1, 0x56, 0x80, 0xcc, 0x91, 0xd8, 0xbd, 0x00, 0xd4, 0xb0, 0x6b, 
+0x59, 0x02, 0x37, 0x7f, 0x8e, 0xa0, 0xe6, 0x35, 0x8a, 0x86, 0x8d, 0xd0, 0xde, 0xb3, 0x4b, 0x70, 
+0x95, 0x3c, 0x0e, 0xd1, 0xe3, 0x90, 0x40, 0x81, 0xc5, 0x30, 0x2e, 0x3c, 0x3f, 0x3c, 0x22, 0x1c, 
+0xf0, 0x08, 0x2a, 0x86, 0x09, 0x11, 0x85, 0x11, 0x0f, 0x45, 0x00, 0x1e, 0x1d, 0x8a, 0xc1, 0x1c, 
+0x1f, 0x13, 0x0f, 0x74, 0x74, 0x2c, 0x06, 0x6b, 0x9f, 0x01, 0x7d, 0x80, 0x8e, 0x4e, 0xc5, 0x90, 
+0xd4, 0x77, 0x50, 0x5f, 0xa0, 0x23, 0xb8, 0x06, 0x5e, 0xec, 0x3a, 0xbc, 0x6b, 0x87, 0xae, 0x80, 
+0x47, 0x67, 0x2e, 0x28, 0x98, 0x98, 0x80, 0x10, 0x14, 0x43, 0xcf, 0x47, 0x3f, 0x16, 0xed, 0x13, 
+0x0d, 0x78, 0x74, 0xa9, 0x81, 0x17, 0x62, 0x1e, 0x8f, 0xf1, 0x8d, 0x01, 0x3c, 0x42, 0x6b, 0x60, 
+0x4a, 0x92, 0x3d, 0x49, 0x4a, 0x02, 0x3c, 0xc2, 0x6a, 0xe0, 0xa5, 0xe0, 0x11, 0xc1, 0x9d, 0x82, 
+0x01, 0x8f, 0xae, 0x35, 0x30, 0x35, 0x6e, 0x68, 0x5c, 0x60, 0x1c, 0xe0, 0x11, 0x5e, 0x0c, 0xc9, 
+0x29, 0x83, 0x53, 0x80, 0x8e, 0x88, 0x62, 0x18, 0x18, 0x64, 0x09, 0x82, 0x20, 0x98, 0x07, 0xf3, 
+0xa2, 0x6a, 0x20, 0x37, 0x2c, 0x23, 0xec, 0x81, 0x30, 0xc0, 0xc3, 0x54, 0x03, 0xd9, 0x9d, 0xd2, 
+0x3a, 0x19, 0x3a, 0x01, 0x1e, 0xd1, 0x35, 0x90, 0xd7, 0x25, 0xb3, 0x4b, 0x48, 0x17, 0xc0, 0x23, 
+0xa6, 0x06, 0x72, 0x42, 0xd3, 0x43, 0xfd, 0x42, 0x01, 0x8f, 0xd8, 0x1a, 0x78, 0xce, 0x94, 0x6a, 
+0x92, 0x4d, 0x80, 0x47, 0xb7, 0x1a, 0xf8, 0x59, 0xec, 0x13, 0xb1, 0xc6, 0x58, 0xc0, 0xa3, 0x7b, 
+0x0d, 0xbc, 0xdc, 0x79, 0x54, 0xe7, 0xce, 0x9d, 0x01, 0x8f, 0xb8, 0x1a, 0x98, 0xd6, 0x6b, 0x58, 
+0xaf, 0x1f, 0xf5, 0x02, 0x3c, 0xcc, 0x35, 0x30, 0x3d, 0x6a, 0x64, 0x54, 0x70, 0x14, 0xe0, 0x11, 
+0x5f, 0x0c, 0x89, 0x81, 0x93, 0x02, 0xa3, 0x02, 0x61, 0x2e, 0xcc, 0xb5, 0x16, 0x43, 0x7f, 0x73, 
+0x3f, 0x33, 0xd0, 0x91, 0x58, 0x43, 0x79, 0x11, 0x1d, 0x29, 0x33, 0x22, 0xa9, 0x06, 0x7e, 0xde, 
+0xed, 0xc9, 0x6e, 0xfe, 0xdd, 0x00, 0x8f, 0xe4, 0x1a, 0xf8, 0x45, 0xf7, 0xa7, 0xba, 0x07, 0x74, 
+0x07, 0x3c, 0x7a, 0xd6, 0xc0, 0x8c, 0xc4, 0x67, 0x13, 0xc3, 0x12, 0x01, 0x8f, 0x5e, 0x35, 0xf0, 
+0xd3, 0x9e, 0xb6, 0x9e, 0x62, 0x4f, 0xc0, 0xa3, 0x4f, 0x0d, 0x05, 0xe8, 0x43, 0x29, 0x53, 0xa2, 
+0x6f, 0x0d, 0xbc, 0x92, 0x3c, 0x3a, 0xb9, 0x4b, 0x32, 0xe0, 0x91, 0xc2, 0x65, 0x79, 0x38, 0x25, 
+0x6a, 0x40, 0x0b, 0xa8, 0x47, 0x19, 0xb0, 0xeb, 0xff, 0xca, 0x98, 0xd3, 0x63, 0x23, 0xac, 0x7b, 
+0x28, 0x0f, 0x05, 0xbc, 0xe4, 0xa1, 0xa8, 0x42, 0xa5, 0xc0, 0x3c, 0x09, 0xa2, 0x38, 0x58, 0x53, 
+0x4f, 0x2a, 0x29, 0xe2, 0x3d, 0x4a, 0xc8, 0xc6, 0x3e, 0x2d, 0xaf, 0x5c, 0xdc, 0xed, 0x85, 0x49, 
+0xb5, 0xa8, 0x2b, 0x0a, 0xc4, 0xf5, 0x92, 0x6c, 0xf2, 0xdc, 0xde, 0x75, 0x5a, 0x1a, 0x8a, 0x0d, 
+0xcc, 0x7d, 0xf3, 0x7d, 0xec, 0x10, 0x9f, 0x32, 0x2e, 0xc2, 0xd7, 0x0e, 0x89, 0x0f, 0x17, 0x44, 
+0x19, 0x6d, 0xf2, 0xc2, 0x47, 0x6a, 0xfd, 0xec, 0x30, 0xe9, 0xc7, 0xe3, 0x1f, 0xa4, 0x6c, 0x94, 
+0x89, 0x94, 0x8d, 0x32, 0x24, 0xd0, 0x0e, 0x09, 0xcd, 0x13, 0x1e, 0x0a, 0x62, 0x2c, 0xa4, 0xb0, 
+0x25, 0x1b, 0x45, 0xa0, 0x8c, 0x94, 0x96, 0x6c, 0x14, 0x0e, 0xa8, 0x67, 0xce, 0x66, 0xf7, 0xad, 
+0x6f, 0x20, 0x27, 0x7e, 0xb7, 0xf2, 0x43, 0x2d, 0xe9, 0x28, 0x1c, 0xf1, 0x2d, 0xe9, 0x28, 0x41, 
+0x94, 0x92, 0x82, 0xec, 0x6e, 0x4d, 0x77, 0x9e, 0x8c, 0xa2, 0x40, 0x8f, 0xd3, 0x2d, 0xa9, 0x28, 
+0x1c, 0xc9, 0x9c, 0xf1, 0x29, 0x60, 0x1d, 0xec, 0x92, 0x82, 0xa2, 0x40, 0x74, 0x93, 0x66, 0x55, 
+0x0d, 0x18, 0x04, 0x11, 0x64, 0x7d, 0x51, 0x26, 0x47, 0x8a, 0xd2, 0x56, 0x8e, 0x73, 0x7f, 0xa3, 
+0xba, 0x5e, 0x38, 0x63, 0x4b, 0xae, 0x8c, 0x10, 0xb9, 0x82, 0xe5, 0xca, 0xa4, 0x06, 0xb0, 0x1f, 
+0x5c, 0x16, 0xc6, 0xfa, 0x6d, 0xb0, 0xbd, 0x25, 0x09, 0x84, 0x23, 0x40, 0xf3, 0xb4, 0xb0, 0x17, 
+0x4b, 0x61, 0xf6, 0x5d, 0x8f, 0xcb, 0xab, 0xdb, 0x41, 0x22, 0x3c, 0x1a, 0xa9, 0xe5, 0x78, 0x08, 
+0x57, 0xd0, 0x96, 0x4b, 0x60, 0x2e, 0x3a, 0xfc, 0xc2, 0x73, 0xd9, 0x87, 0x73, 0xae, 0xe4, 0x5e, 
+0xcb, 0xbb, 0xa1, 0x9c, 0x4f, 0x3b, 0x92, 0xfe, 0x7d, 0xc6, 0xf5, 0xcc, 0x9b, 0xa8, 0x77, 0xff, 
+0xd7, 0x00, 0x43, 0x30, 0xc0, 0xe3, 0x23, 0x90, 0x01, 0xa6, 0xa6, 0x59, 0xe7, 0xb0, 0xab, 0x39, 
+0x78, 0xe5, 0xe7, 0x76, 0x9d, 0x3b, 0x62, 0x50, 0x19, 0xc2, 0x68, 0x4d, 0x08, 0x8f, 0xa6, 0xf5, 
+0x5e, 0x29, 0x7c, 0x4b, 0xeb, 0x7c, 0x88, 0xf8, 0xb8, 0xc8, 0xd4, 0xf4, 0x19, 0x14, 0x8b, 0xca, 
+0x94, 0x26, 0x48, 0xb3, 0xf0, 0x3d, 0x8f, 0xe6, 0xad, 0x91, 0x98, 0xa9, 0x9b, 0x9a, 0xf7, 0xac, 
+0xfc, 0xa6, 0xdc, 0x86, 0x3c, 0x2c, 0xca, 0xeb, 0x20, 0x91, 0x7d, 0x93, 0x05, 0xa9, 0x9b, 0x6e, 
+0xe8, 0x85, 0xb5, 0xec, 0x87, 0xc2, 0x1a, 0x22, 0xfc, 0xb1, 0x4f, 0x20, 0x87, 0x1a, 0x89, 0x6b, 
+0xd9, 0x78, 0x9c, 0x25, 0x3a, 0x31, 0xb1, 0x52, 0x4b, 0x9a, 0xfa, 0x10, 0xbe, 0xb8, 0x5d, 0xd3, 
+0xaf, 0x6e, 0x15, 0xe0, 0x73, 0xde, 0x42, 0x25, 0xdd, 0xd2, 0xa3, 0xc8, 0x21, 0xbf, 0x57, 0xae, 
+0xc3, 0x05, 0x5d, 0xbc, 0x24, 0x41, 0x0e, 0xaa, 0x6b, 0x06, 0x88, 0x44, 0x11, 0x1e, 0x6b, 0xc6, 
+0x29, 0x65, 0xec, 0x76, 0x00, 0x32, 0xdb, 0x16, 0xcd, 0x7c, 0x10, 0x97, 0xeb, 0xa4, 0xa4, 0x3b, 
+0x95, 0xf1, 0xfe, 0x7d, 0xb1, 0xe9, 0x97, 0x22, 0xf3, 0x54, 0x30, 0xcd, 0xb6, 0x1d, 0x30, 0xa8, 
+0xe0, 0x8e, 0x23, 0xd5, 0xb7, 0x11, 0xe0, 0x20, 0x31, 0x8d, 0xdb, 0x8f, 0x1c, 0x21, 0x3b, 0xfd, 
+0xa9, 0x7b, 0xd7, 0xc5, 0xdd, 0x4e, 0x8e, 0xf6, 0x92, 0xa5, 0x66, 0xd6, 0x95, 0xad, 0x8f, 0xe7, 
+0x6e, 0xf7, 0x24, 0xd6, 0x95, 0xce, 0xee, 0xc5, 0x43, 0xd4, 0xb7, 0x24, 0x28, 0x79, 0xf4, 0xfa, 
+0x50, 0xba, 0x4a, 0xee, 0xdb, 0x4c, 0xa2, 0x66, 0x7c, 0x71, 0x9b, 0xe4, 0x2c, 0x59, 0x34, 0x40, 
+0x48, 0xeb, 0x9c, 0x8d, 0xdb, 0xeb, 0x0c, 0xa8, 0xa8, 0xf9, 0xea, 0x5c, 0x66, 0xcc, 0xf4, 0x70, 
+0x85, 0x0e, 0x27, 0xb8, 0x56, 0xed, 0xc4, 0x46, 0xbe, 0xb5, 0xca, 0xa9, 0xd5, 0x6a, 0xd3, 0xbc, 
+0xd7, 0xba, 0x87, 0x4f, 0x33, 0xb9, 0x68, 0xbf, 0x25, 0xc7, 0xd9, 0xfc, 0xcf, 0x09, 0x15, 0x6f, 
+0x2c, 0x24, 0x54, 0x6c, 0xd9, 0xcc, 0x55, 0x5f, 0x3b, 0xaa, 0xbe, 0x87, 0x8f, 0xc4, 0xd9, 0x51, 
+0xf9, 0x5d, 0xb0, 0x3e, 0x01, 0x84, 0x3a, 0xce, 0xa8, 0xb8, 0xd9, 0x72, 0xfe, 0x0e, 0x4c, 0x8b, 
+0x89, 0x21, 0x4e, 0x53, 0x27, 0xf7, 0xcd, 0x5b, 0x8d, 0x9d, 0x8c, 0x2f, 0x5b, 0xcc, 0x9d, 0x89, 
+0x10, 0xc4, 0xc2, 0x3a, 0x6c, 0x1c, 0x31, 0x0a, 0xbc, 0xf0, 0x78, 0xac, 0x02, 0x3f, 0x7b, 0xa2, 
+0x9b, 0x02, 0x3f, 0x7f, 0x12, 0x07, 0x52, 0x0b, 0x13, 0x83, 0xa6, 0x94, 0xbc, 0x50, 0xf6, 0xb3, 
+0xad, 0x3f, 0xdf, 0x38, 0x7d, 0x7f, 0xde, 0x77, 0xf6, 0xa5, 0x8f, 0xaf, 0x7f, 0xa2, 0xea, 0xc9, 
+0xed, 0x23, 0xf7, 0x65, 0x9e, 0x65, 0x5e, 0x0c, 0x1d, 0x7a, 0x02, 0x41, 0x50, 0x83, 0xf0, 0x13, 
+0x9a, 0xe7, 0xb0, 0x05, 0x19, 0x04, 0xf6, 0x1b, 0x9f, 0x75, 0x55, 0xe0, 0xc5, 0xe1, 0x04, 0xf4, 
+0xbe, 0xfd, 0x4e, 0x7d, 0xdf, 0xf9, 0x8b, 0xdd, 0x15, 0xf8, 0xc5, 0x53, 0xa4, 0xfe, 0x6b, 0xcb, 
+0xe2, 0x16, 0x34, 0x04, 0xe0, 0x40, 0x0e, 0xbf, 0xf4, 0xd5, 0xf4, 0x6b, 0xb3, 0xaa, 0x71, 0x18, 
+0x47, 0x46, 0x5c, 0x19, 0x79, 0x7d, 0xec, 0x36, 0x04, 0xf5, 0xa1, 0x29, 0xdb, 0x9f, 0x5b, 0x98, 
+0xbd, 0xe0, 0x85, 0x63, 0x3f, 0xdb, 0x93, 0xb3, 0xe8, 0x17, 0xf3, 0xa7, 0x5e, 0x9c, 0x76, 0xf2, 
+0xc5, 0xf5, 0x1a, 0xc8, 0x55, 0xf6, 0x1d, 0xa9, 0x1f, 0xa7, 0x7d, 0xf4, 0xf8, 0xe7, 0x4f, 0xec, 
+0x4d, 0xff, 0xf4, 0xa9, 0xf7, 0x87, 0x5e, 0x18, 0x76, 0x6a, 0xf8, 0x71, 0x0d, 0xf4, 0xad, 0x08, 
+0x00, 0xe5, 0x25, 0x34, 0x4a, 0x2d, 0x8e, 0x97, 0xa3, 0xa1, 0xcc, 0xf1, 0xbc, 0x61, 0xa3, 0x16, 
+0x33, 0x21, 0xf3, 0xe4, 0x40, 0xa4, 0x9d, 0xaf, 0x5a, 0x3b, 0x5f, 0xb5, 0x76, 0x1a, 0x9e, 0x67, 
+0xe2, 0x09, 0x72, 0xae, 0xaa, 0x99, 0x7b, 0x9c, 0x2b, 0x76, 0xcc, 0xde, 0x3b, 0x8f, 0x2c, 0x14, 
+0x04, 0x64, 0x95, 0x22, 0xbb, 0x3c, 0x93, 0x7b, 0x35, 0xef, 0x7b, 0x65, 0x36, 0xb2, 0xcb, 0xaf, 
+0x32, 0x8e, 0x65, 0x9e, 0x37, 0x15, 0x14, 0xf9, 0x66, 0xef, 0xcb, 0xdd, 0xbc, 0xf2, 0x64, 0xda, 
+0xfe, 0x8c, 0x2d, 0xeb, 0x90, 0x4f, 0x43, 0xed, 0x3e, 0xa3, 0xdf, 0x87, 0x02, 0x32, 0xcd, 0x0f, 
+0x85, 0xd4, 0xb4, 0x40, 0xd9, 0x5d, 0xe0, 0x7e, 0x65, 0x4b, 0x1a, 0x5c, 0x9e, 0xc4, 0xfa, 0xa9, 
+0xd4, 0x8f, 0x90, 0xa6, 0x8a, 0xbc, 0xcf, 0xa3, 0x7e, 0x97, 0x70, 0x43, 0x32, 0x18, 0x58, 0xef, 
+0x2f, 0xb3, 0x7e, 0x94, 0x24, 0xf8, 0xe4, 0xfb, 0x30, 0x26, 0xfa, 0x9f, 0x3e, 0x6c, 0xe9, 0x8f, 
+0x93, 0x26, 0x1b, 0xca, 0x0d, 0x8c, 0x99, 0x9a, 0x7c, 0x97, 0xfb, 0x32, 0x66, 0x7a, 0xda, 0xd7, 
+0x6c, 0xbc, 0xbf, 0xcc, 0x94, 0xd9, 0x8e, 0x07, 0xdb, 0xcb, 0x4d, 0x65, 0x4b, 0x8f, 0xba, 0x5b, 
+0xb8, 0x69, 0xa0, 0xb9, 0xb9, 0x1e, 0x22, 0xbd, 0x31, 0x52, 0x5c, 0x77, 0x5e, 0x19, 0x69, 0x3b, 
+0x43, 0xff, 0x82, 0x98, 0xaf, 0xfa, 0x09, 0xe2, 0x38, 0x15, 0xad, 0xc4, 0x09, 0x17, 0x02, 0x04, 
+0x28, 0x6c, 0x46, 0x93, 0x6e, 0xbc, 0x16, 0x59, 0x13, 0xc4, 0x21, 0xaa, 0x6b, 0x68, 0x8d, 0x05, 
+0xd1, 0x42, 0xe6, 0x8b, 0x7b, 0xad, 0xaa, 0x13, 0x3c, 0x97, 0x28, 0x1b, 0xc5, 0x65, 0xa5, 0x46, 
+0x0f, 0x41, 0x36, 0xb1, 0x42, 0x75, 0x09, 0xb2, 0x09, 0x62, 0x9c, 0x1a, 0xc7, 0x58, 0x15, 0x0f, 
+0xb3, 0x31, 0x63, 0x07, 0x4d, 0xc2, 0xea, 0x63, 0x14, 0x67, 0x9b, 0x0f, 0x3b, 0x11, 0x07, 0x2d, 
+0x58, 0x40, 0x43, 0x6b, 0x90, 0x6b, 0xcc, 0x4d, 0x10, 0x63, 0x55, 0x2d, 0xe8, 0x26, 0x6e, 0x50, 
+0x79, 0xd0, 0x0d, 0xff, 0xdf, 0x92, 0x17, 0xc0, 0x04, 0x7a, 0x5b, 0xd3, 0x02, 0xfe, 0x1b, 0x23, 
+0x62, 0xd6, 0x3d, 0x09, 0x3e, 0xde, 0xa3, 0x8c, 0x01, 0x99, 0xd9, 0xca, 0x8e, 0x64, 0x01, 0x9c, 
+0x14, 0x41, 0x75, 0x4c, 0x8a, 0xa0, 0xe2, 0xa4, 0x88, 0xdb, 0x55, 0x3e, 0x29, 0x2c, 0xe6, 0xdb, 
+0x9e, 0x39, 0x11, 0x3b, 0xf3, 0x3c, 0x81, 0xf9, 0xe2, 0x7a, 0x77, 0x53, 0xd2, 0x92, 0x32, 0x40, 
+0x33, 0x22, 0xd5, 0xa9, 0x2d, 0x33, 0x12, 0x42, 0x39, 0x03, 0x6d, 0x9b, 0x10, 0xb1, 0x5a, 0xf5, 
+0x3c, 0x21, 0xfa, 0x1c, 0x02, 0xe7, 0x84, 0xb4, 0x24, 0x11, 0x38, 0xe7, 0xa3, 0x80, 0xcf, 0xc7, 
+0x3d, 0xcb, 0x7c, 0xbd, 0x25, 0xbc, 0xcb, 0xc4, 0x46, 0x63, 0x2b, 0x7d, 0x80, 0x04, 0xc6, 0xed, 
+0x75, 0x9e, 0xf6, 0xa7, 0x61, 0xb7, 0x43, 0xdb, 0x71, 0x0e, 0xf0, 0x16, 0xed, 0x05, 0xc7, 0x57, 
+0x5b, 0x77, 0x67, 0x0a, 0x0b, 0x77, 0xd5, 0x79, 0x51, 0x5b, 0xe8, 0xf5, 0xbb, 0xd0, 0x59, 0x26, 
+0xb7, 0x5d, 0x67, 0x99, 0x0c, 0x0c, 0x10, 0x55, 0xd5, 0xb9, 0x0f, 0x5b, 0xeb, 0x2e, 0xec, 0x95, 
+0xf6, 0x6a, 0x2f, 0x1c, 0x39, 0xb6, 0x56, 0xfa, 0x8b, 0xdd, 0xa9, 0xbf, 0x68, 0x38, 0xb0, 0xb7, 
+0x43, 0x8b, 0x71, 0xc1, 0x8a, 0x07, 0x15, 0x66, 0xf2, 0x9d, 0xab, 0x30, 0x93, 0xb9, 0xce, 0x8d, 
+0x43, 0xaf, 0x77, 0xac, 0x3b, 0x37, 0x2a, 0x4c, 0xa3, 0x5b, 0x15, 0x86, 0xc6, 0x56, 0xf7, 0x0f, 
+0x55, 0x64, 0x8a, 0xdc, 0x2b, 0x32, 0x45, 0x56, 0x57, 0x45, 0xc6, 0x0a, 0x97, 0x3f, 0x64, 0x26, 
+0xda, 0x13, 0x99, 0xde, 0xa3, 0x91, 0x7f, 0x11, 0x52, 0x29, 0xf9, 0x30, 0x4d, 0x18, 0xaa, 0x19, 
+0x80, 0xac, 0xdf, 0x75, 0xdc, 0x20, 0x4d, 0x72, 0x13, 0x7f, 0x61, 0xca, 0x5e, 0x63, 0x2d, 0xc3, 
+0xd7, 0x01, 0x59, 0x32, 0x80, 0x85, 0xe2, 0x2e, 0x10, 0x4d, 0x41, 0x70, 0x16, 0x77, 0x81, 0x64, 
+0x23, 0x9a, 0x09, 0x03, 0x1b, 0xfc, 0x50, 0x86, 0xc5, 0x5f, 0xf3, 0xc7, 0x36, 0xe1, 0x7c, 0x00, 
+0xd3, 0x1a, 0x02, 0x6d, 0xa8, 0x4a, 0x5c, 0x0d, 0xfa, 0xb3, 0xfc, 0x76, 0xd0, 0x17, 0x70, 0x70, 
+0x9e, 0x4b, 0xe8, 0x85, 0x25, 0xf4, 0x2f, 0x09, 0x66, 0xd7, 0x4d, 0x9d, 0x59, 0x7b, 0xa8, 0x55, 
+0x1a, 0xf2, 0x27, 0x8e, 0xfd, 0x34, 0xaa, 0x7a, 0x25, 0xc2, 0x06, 0xef, 0x7c, 0xcd, 0x03, 0x30, 
+0xc5, 0xfa, 0x00, 0x4c, 0x37, 0xd6, 0x6e, 0x32, 0xb3, 0x04, 0x87, 0x6e, 0xf1, 0x36, 0x50, 0x77, 
+0x1d, 0x4f, 0xb0, 0xc1, 0xa6, 0x4f, 0x7a, 0x5a, 0xd8, 0xa7, 0xc6, 0x5b, 0x6d, 0x30, 0x6b, 0xec, 
+0xa0, 0x36, 0x04, 0x60, 0x06, 0xf4, 0x11, 0xc1, 0x3a, 0xb8, 0x7f, 0x5f, 0x11, 0x92, 0x34, 0x67, 
+0x6e, 0x0f, 0xae, 0xab, 0x74, 0xb9, 0xb7, 0x71, 0x03, 0xaf, 0x93, 0xef, 0x31, 0xbf, 0xdc, 0x25, 
+0x6e, 0x70, 0xb0, 0x88, 0x11, 0xdf, 0xe1, 0x5a, 0x19, 0x27, 0xe3, 0x10, 0xe5, 0x22, 0xd4, 0xd3, 
+0x34, 0x34, 0x50, 0x2e, 0x82, 0x4b, 0x24, 0x28, 0x80, 0x0d, 0xfe, 0x42, 0xd0, 0x9f, 0x0d, 0x80, 
+0xc8, 0x3f, 0x32, 0xcf, 0x49, 0x98, 0x04, 0x55, 0x35, 0xaa, 0x79, 0x6f, 0x2c, 0xf4, 0x14, 0x05, 
+0xb2, 0x28, 0xc8, 0xc6, 0xfe, 0xd9, 0xe2, 0x3e, 0x66, 0x8b, 0x33, 0xee, 0x63, 0x89, 0xb9, 0x35, 
+0xee, 0x13, 0x73, 0x4b, 0xdc, 0x47, 0x64, 0x82, 0x86, 0xad, 0xdb, 0x83, 0x0c, 0x5f, 0x3c, 0x36, 
+0xd6, 0x18, 0xc0, 0x1c, 0x2b, 0x07, 0x02, 0x59, 0x7b, 0x30, 0xc8, 0x66, 0x80, 0x55, 0x87, 0x68, 
+0x15, 0x86, 0x74, 0x26, 0x87, 0x4b, 0x28, 0xbb, 0x5e, 0x4c, 0x19, 0xc2, 0x1b, 0x11, 0x45, 0x6f, 
+0x56, 0x46, 0xe0, 0x5b, 0xd6, 0xa8, 0xf1, 0x8a, 0x00, 0x4b, 0x13, 0xb0, 0x59, 0x8c, 0xa8, 0x59, 
+0xbd, 0x16, 0x5a, 0xc4, 0x8e, 0xcc, 0x97, 0x02, 0x4e, 0xbe, 0x98, 0x55, 0x82, 0x53, 0x2f, 0xb1, 
+0xa9, 0xc7, 0xa9, 0xd6, 0xa7, 0x56, 0x30, 0x70, 0x16, 0x67, 0xac, 0xca, 0x5c, 0x43, 0x20, 0xe0, 
+0xa2, 0xc9, 0xa8, 0xcc, 0x5c, 0xeb, 0x00, 0x81, 0x4f, 0xb9, 0x43, 0x56, 0xb6, 0x88, 0xa0, 0x47, 
+0x0e, 0x49, 0xf2, 0x61, 0x46, 0xc7, 0x5e, 0xe3, 0xa8, 0x27, 0x84, 0x51, 0x44, 0xc7, 0x99, 0xc2, 
+0x78, 0x8d, 0x8e, 0xc7, 0x13, 0x1d, 0x87, 0x48, 0x39, 0x5e, 0xe3, 0xa8, 0xf7, 0x8b, 0x9e, 0xdd, 
+0xc4, 0x52, 0xef, 0x82, 0x96, 0x05, 0xe8, 0xd9, 0x44, 0xa4, 0xdc, 0xee, 0x90, 0xaa, 0x27, 0x8a, 
+0x1e, 0xcd, 0xd8, 0xc3, 0x80, 0x7f, 0xd3, 0xf5, 0xff, 0x1f, 0x74, 0xed, 0x95, 0x96, 0x99, 0x9e, 
+0x6f, 0xb1, 0xc9, 0xab, 0xd7, 0xaa, 0xa3, 0x19, 0x59, 0xdf, 0x7f, 0x8a, 0x4e, 0x9c, 0x27, 0xf9, 
+0x01, 0xa4, 0x8f, 0xb2, 0x2e, 0xc6, 0xc6, 0xe8, 0xd6, 0xc5, 0xf0, 0xb2, 0xe6, 0x62, 0xb8, 0x0e, 
+0xae, 0x41, 0xa9, 0x26, 0x8d, 0xdc, 0xbb, 0x88, 0x63, 0x90, 0xdc, 0xb3, 0xa5, 0x9f, 0x93, 0x70, 
+0xcf, 0x96, 0xde, 0x14, 0x53, 0x25, 0xb6, 0x2f, 0xd6, 0x28, 0xcc, 0x11, 0x6e, 0xef, 0x42, 0x90, 
+0x10, 0xe4, 0x18, 0xe6, 0x3b, 0x28, 0x8f, 0xbd, 0xbd, 0xef, 0x40, 0x00, 0xf3, 0xe0, 0x20, 0xd9, 
+0xb8, 0x78, 0x62, 0x11, 0x44, 0x72, 0xd7, 0x41, 0xb8, 0x04, 0x0b, 0xe7, 0x52, 0xc2, 0x90, 0xa5, 
+0xc7, 0x84, 0x42, 0xb3, 0x08, 0xab, 0x4a, 0x87, 0xc4, 0x8b, 0x30, 0xbf, 0x39, 0x36, 0x41, 0x0e, 
+0x1c, 0x5f, 0x00, 0xb4, 0x0f, 0x68, 0x4d, 0xd3, 0x64, 0x97, 0xc8, 0xa8, 0x66, 0xf9, 0x8f, 0x16, 
+0x58, 0x80, 0xc0, 0x42, 0x71, 0x48, 0x97, 0xd0, 0x28, 0x9b, 0x44, 0x5a, 0xf4, 0x7c, 0xdb, 0xdd, 
+0x51, 0x54, 0x27, 0xeb, 0x82, 0x68, 0x93, 0x19, 0xe3, 0x27, 0x47, 0x5b, 0x07, 0x35, 0x58, 0x1a, 
+0x25, 0x5a, 0x06, 0x5a, 0xc2, 0x24, 0xed, 0x68, 0x8d, 0x63, 0x3a, 0xd9, 0xc5, 0x2b, 0xf1, 0x6c, 
+0x49, 0x24, 0xb0, 0xef, 0xb8, 0x66, 0xc1, 0xe5, 0x70, 0xa0, 0xc1, 0x35, 0x43, 0x92, 0x7b, 0x4a, 
+0xed, 0xe4, 0x29, 0x25, 0xd1, 0xee, 0x4d, 0xd9, 0xf2, 0x94, 0x17, 0xe7, 0x89, 0x3f, 0x78, 0xe2, 
+0x0b, 0xcd, 0x2c, 0x1f, 0x6f, 0x4f, 0x4e, 0x59, 0xee, 0x86, 0xbc, 0xad, 0xca, 0xfe, 0xb4, 0xbd, 
+0xe9, 0xeb, 0x33, 0x36, 0x66, 0xee, 0x36, 0x35, 0x37, 0x05, 0x64, 0x1d, 0xce, 0x3e, 0x96, 0x53, 
+0x9e, 0x7b, 0x26, 0xef, 0xbc, 0x72, 0x24, 0xed, 0x6a, 0xfa, 0xa1, 0x8c, 0xaf, 0x32, 0xbf, 0x37, 
+0x35, 0x81, 0x13, 0x11, 0xd5, 0x88, 0x04, 0xb5, 0x96, 0x27, 0x6d, 0x84, 0xa3, 0x8a, 0xad, 0xb7, 
+0x1b, 0xcc, 0x78, 0x1f, 0x8f, 0xa7, 0x05, 0x4f, 0x4a, 0xf4, 0xa1, 0x04, 0xd0, 0x92, 0xa5, 0x04, 
+0xd7, 0x44, 0xdf, 0x29, 0x1b, 0xa7, 0x9f, 0x61, 0xf4, 0x3c, 0xf2, 0x34, 0x39, 0x29, 0xe9, 0xeb, 
+0x4a, 0x83, 0xf0, 0xbd, 0xa4, 0xe5, 0x96, 0xa2, 0xbd, 0xa8, 0x32, 0x7b, 0x51, 0x55, 0x2d, 0xac, 
+0x79, 0xd8, 0x30, 0x18, 0xb8, 0xad, 0xeb, 0x7c, 0x63, 0x07, 0x01, 0xde, 0x58, 0xd4, 0x51, 0x10, 
+0xbf, 0x43, 0x9d, 0x1e, 0x3e, 0xaf, 0x2a, 0x45, 0x16, 0xf3, 0xed, 0x7e, 0x64, 0x31, 0xe7, 0x0e, 
+0xe3, 0x7c, 0x5c, 0x3c, 0x82, 0xf3, 0xf1, 0xe5, 0x76, 0x9c, 0x8f, 0x13, 0x3b, 0x90, 0xad, 0x7f, 
+0xbd, 0x17, 0x15, 0xfc, 0x6f, 0xf6, 0xb1, 0xc4, 0x65, 0x66, 0xb3, 0x7e, 0xc2, 0x2c, 0x9c, 0xb3, 
+0x87, 0x50, 0xbb, 0x3f, 0x56, 0x19, 0xad, 0xc0, 0xa5, 0x8f, 0x50, 0xc5, 0xff, 0xac, 0x02, 0x55, 
+0xfc, 0xe3, 0xd5, 0x68, 0x5e, 0x7c, 0xb5, 0x07, 0xf5, 0xfc, 0x93, 0xbb, 0x50, 0xcf, 0x3f, 0xf5, 
+0x9e, 0x99, 0x19, 0xaf, 0xf1, 0xcc, 0xd4, 0xed, 0xa1, 0x0d, 0xa1, 0xc0, 0xc2, 0xac, 0x58, 0xeb, 
+0x9f, 0xe0, 0x0b, 0xd8, 0x6a, 0x4d, 0x54, 0xe0, 0xf2, 0x5f, 0x92, 0x14, 0xb8, 0xf2, 0x71, 0xb2, 
+0x02, 0xd7, 0x8e, 0xf6, 0x54, 0xe0, 0xd3, 0x2d, 0xbd, 0x14, 0x38, 0xb3, 0xbb, 0xb7, 0x02, 0xa7, 
+0xdf, 0x27, 0x50, 0xcf, 0x3f, 0xf0, 0x49, 0xd9, 0xe7, 0xeb, 0x8f, 0x6f, 0x38, 0xb1, 0xf1, 0xeb, 
+0xb7, 0x2f, 0xbe, 0x73, 0xed, 0xe6, 0xe6, 0x92, 0xaa, 0xc5, 0xd5, 0x4b, 0x77, 0x2c, 0xdb, 0xbb, 
+0xe2, 0xc8, 0xaa, 0xa3, 0x6b, 0xd1, 0xea, 0x37, 0x9c, 0x50, 0x2f, 0x5e, 0xdf, 0xb1, 0xfc, 0xc8, 
+0x6a, 0x96, 0x7c, 0x71, 0x62, 0xd3, 0xc5, 0x1b, 0xc8, 0x3a, 0xa6, 0xcd, 0x94, 0xe4, 0x25, 0x44, 
+0x80, 0x56, 0x2f, 0x04, 0x78, 0xa5, 0x15, 0x01, 0xfe, 0x5d, 0x23, 0xc0, 0x8e, 0xe2, 0x28, 0x22, 
+0xc0, 0x6c, 0x8d, 0x00, 0x97, 0x88, 0x83, 0x89, 0x00, 0x25, 0xa1, 0xe0, 0xfe, 0x10, 0x60, 0xe0, 
+0xe2, 0x89, 0xd0, 0x42, 0x80, 0x02, 0x12, 0x20, 0x0f, 0x73, 0x98, 0x05, 0xa4, 0xbe, 0x78, 0x01, 
+0x89, 0xef, 0xdf, 0xb4, 0xf7, 0x6f, 0xda, 0xfb, 0x57, 0xa1, 0xbd, 0x45, 0xb1, 0x62, 0x20, 0xc0, 
+0x93, 0xc3, 0xad, 0xac, 0xe9, 0xd5, 0xf3, 0x61, 0x89, 0xd4, 0xda, 0x40, 0xb7, 0xba, 0xed, 0xe6, 
+0x5b, 0xb2, 0x36, 0x02, 0x87, 0xd0, 0x4e, 0xe4, 0x21, 0x81, 0xb4, 0x23, 0xd9, 0x95, 0xb6, 0x66, 
+0x53, 0x3f, 0x9b, 0xd2, 0xfa, 0x03, 0x00, 0xf6, 0xab, 0x12, 0xca, 0xda, 0x98, 0x46, 0x95, 0xd2, 
+0xfa, 0x7f, 0x53, 0x49, 0x69, 0xfd, 0xbf, 0xdb, 0xea, 0xc3, 0xba, 0xdf, 0x57, 0xfb, 0x4a, 0x48, 
+0x7b, 0xbb, 0xb6, 0x19, 0xb1, 0x33, 0x7f, 0xbc, 0x9d, 0xb2, 0x86, 0x8e, 0xee, 0xa0, 0xac, 0xa1, 
+0x4f, 0x76, 0x06, 0x60, 0x57, 0xf4, 0x9f, 0x15, 0x81, 0xf8, 0xf1, 0x81, 0x07, 0x55, 0x14, 0x80, 
+0x13, 0x8b, 0x0e, 0xa8, 0x91, 0x1d, 0x58, 0x1e, 0xf1, 0xff, 0x52, 0x3b, 0xb2, 0xee, 0x03, 0x95, 
+0x4a, 0x06, 0xfc, 0xb6, 0x8a, 0x72, 0x94, 0xf7, 0xa8, 0x9d, 0x59, 0xf7, 0x9e, 0x1a, 0xc2, 0xba, 
+0x63, 0x6a, 0x17, 0xd6, 0x7d, 0xa8, 0x86, 0xb2, 0x6e, 0x9f, 0x1a, 0xc6, 0xba, 0x4f, 0xd5, 0xae, 
+0xac, 0xdb, 0xab, 0x86, 0x17, 0x1b, 0x87, 0x84, 0x4f, 0x0e, 0xff, 0x3c, 0x5c, 0x0d, 0x07, 0x29, 
+0x42, 0x86, 0x71, 0xf9, 0x7f, 0x7b, 0x3b, 0x22, 0x92, 0xbd, 0xf6, 0x27, 0x35, 0x8a, 0x75, 0x35, 
+0xaa, 0x89, 0x75, 0xff, 0x43, 0x8d, 0x66, 0x5d, 0xbd, 0x1a, 0xc3, 0xba, 0xf7, 0xd5, 0x58, 0xd6, 
+0xed, 0x56, 0xbb, 0xb1, 0xee, 0x90, 0xda, 0x9d, 0x75, 0x75, 0x6a, 0x1c, 0xeb, 0x3e, 0x53, 0xcd, 
+0x38, 0x50, 0xcb, 0xff, 0x51, 0xe3, 0x25, 0x63, 0xbf, 0x1e, 0xff, 0xa1, 0x26, 0x94, 0xb0, 0x04, 
+0x9b, 0x5f, 0xd3, 0xf9, 0x1b, 0xf8, 0x2d, 0xfc, 0xd6, 0x22, 0xc3, 0x84, 0xc2, 0x23, 0xef, 0x3c, 
+0x64, 0x65, 0x43, 0xfe, 0xf3, 0xbb, 0x89, 0xec, 0x43, 0x7f, 0x54, 0x29, 0x2d, 0xfa, 0x7f, 0xaa, 
+0xc9, 0xac, 0x6b, 0x50, 0x7b, 0xb2, 0xee, 0x0f, 0x6a, 0x2f, 0xd6, 0x1d, 0x56, 0x7b, 0xb3, 0xee, 
+0x2f, 0x6a, 0x1f, 0x86, 0xaa, 0xda, 0xcd, 0x7d, 0x59, 0xf7, 0xbf, 0x37, 0xa5, 0xb0, 0xee, 0xa3, 
+0x2d, 0xfd, 0x4a, 0xfc, 0xe1, 0x77, 0xd0, 0x8f, 0xce, 0xdf, 0xc3, 0x2e, 0xd8, 0xf5, 0x62, 0xc9, 
+0x64, 0x78, 0x0f, 0xde, 0xa7, 0x73, 0xf7, 0x07, 0xf0, 0x47, 0x98, 0x2e, 0xc3, 0xf8, 0x49, 0x7f, 
+0x2d, 0x78, 0x70, 0x66, 0x09, 0xdb, 0x5a, 0x59, 0x45, 0xe7, 0x56, 0xa8, 0x86, 0xea, 0xfc, 0x12, 
+0x8a, 0xaa, 0xd3, 0xb9, 0x03, 0x76, 0xc2, 0xce, 0x42, 0xd9, 0x38, 0xbe, 0xe0, 0xd7, 0xea, 0x83, 
+0x7f, 0x28, 0x79, 0x8d, 0x7d, 0xdf, 0x1f, 0xc1, 0xf1, 0x9d, 0x70, 0xf4, 0x77, 0xc8, 0x08, 0x61, 
+0xa8, 0x62, 0xdd, 0x86, 0x8d, 0x2f, 0x2d, 0x03, 0xc1, 0x43, 0x9e, 0x86, 0x5d, 0x78, 0x52, 0x33, 
+0x7b, 0x9e, 0x14, 0x78, 0xf2, 0xce, 0x0d, 0xfc, 0x7f, 0x9f, 0xbc, 0x5d, 0x82, 0x1f, 0x32, 0xe8, 
+0xa7, 0xf3, 0xaa, 0xc5, 0x10, 0x7c, 0x6d, 0x58, 0x5e, 0xb5, 0x24, 0x7a, 0x89, 0x57, 0x13, 0x5b, 
+0xe6, 0x0c, 0x99, 0xd9, 0x3e, 0x7e, 0xd8, 0xc4, 0xfb, 0x63, 0x93, 0x10, 0x80, 0xcd, 0xc0, 0x40, 
+0xd9, 0x68, 0xe6, 0x21, 0x69, 0xa8, 0xda, 0xd1, 0x41, 0x74, 0x06, 0x51, 0xdc, 0xd7, 0x22, 0xa8, 
+0x6f, 0x70, 0x0d, 0x44, 0x6f, 0xde, 0x12, 0x2f, 0x07, 0xe6, 0x8f, 0xab, 0x83, 0x88, 0x04, 0x11, 
+0x0a, 0x9a, 0xab, 0x2d, 0x72, 0x60, 0xe1, 0x84, 0x5a, 0x78, 0x88, 0xc2, 0x25, 0xee, 0xd8, 0x35, 
+0x99, 0x29, 0xc4, 0xb2, 0xdb, 0x1b, 0x74, 0xbd, 0xb3, 0x54, 0x8a, 0xfb, 0x91, 0x74, 0x46, 0xbb, 
+0xd0, 0xb5, 0x04, 0x31, 0xca, 0xd5, 0x23, 0xc7, 0xe9, 0x9e, 0xbd, 0xe4, 0x18, 0xdd, 0xb0, 0x51, 
+0x73, 0xad, 0xb1, 0x9b, 0xcb, 0x57, 0xa2, 0xec, 0xc8, 0x5d, 0xaf, 0x9f, 0x26, 0x57, 0x20, 0x6d, 
+0x7d, 0xb8, 0x71, 0x93, 0x1c, 0x37, 0x28, 0x3e, 0x60, 0xc6, 0xb3, 0xef, 0xf6, 0xb2, 0xa3, 0x51, 
+0x77, 0xfc, 0x9c, 0xe7, 0xe1, 0x07, 0x3b, 0x87, 0x3f, 0x65, 0xdb, 0xf4, 0xab, 0xb3, 0xbe, 0x9f, 
+0xb1, 0xdb, 0x09, 0x06, 0x72, 0xe2, 0x63, 0x63, 0xcf, 0x3f, 0xbb, 0xf5, 0x36, 0x8e, 0xb7, 0x07, 
+0x9c, 0xa0, 0x4c, 0xab, 0x98, 0x71, 0xc1, 0x09, 0xcc, 0xb0, 0xca, 0x67, 0x2f, 0x9a, 0x62, 0x8a, 
+0x3a, 0xa2, 0x2c, 0x29, 0xc9, 0x59, 0x9e, 0x7b, 0x32, 0xaf, 0xec, 0x85, 0xc3, 0xd3, 0x36, 0xcf, 
+0x3c, 0x83, 0x12, 0x65, 0x69, 0xfa, 0x8a, 0x8c, 0x53, 0x99, 0xeb, 0x1f, 0x3f, 0x32, 0x6c, 0xcb, 
+0x98, 0xaf, 0x4c, 0x45, 0x40, 0x49, 0x89, 0xd7, 0x38, 0xd0, 0x1d, 0x19, 0x1c, 0xdf, 0x9f, 0xef, 
+0xc4, 0x03, 0xf4, 0xc1, 0xac, 0x3b, 0x7d, 0x3d, 0x84, 0xc3, 0xdb, 0x45, 0xdb, 0x9b, 0xcd, 0xba, 
+0x0b, 0x17, 0xc3, 0xb8, 0x77, 0x9b, 0x90, 0x70, 0xf2, 0x94, 0x89, 0xc3, 0x1f, 0xcd, 0xa3, 0xbd, 
+0x09, 0x2c, 0x18, 0xa0, 0x4f, 0x9d, 0xa3, 0x48, 0x7f, 0xf9, 0x21, 0x6f, 0x53, 0x59, 0x92, 0xbd, 
+0x3c, 0x67, 0x6d, 0xee, 0xf1, 0xbc, 0x0d, 0x68, 0xa2, 0xac, 0x48, 0xbf, 0x94, 0x71, 0x2e, 0x73, 
+0xa3, 0x97, 0x3d, 0x74, 0x3a, 0x39, 0x3c, 0xfd, 0xaa, 0x13, 0xea, 0x91, 0xc7, 0x28, 0x72, 0xea, 
+0x6e, 0x59, 0x14, 0xa0, 0x5c, 0xad, 0xc8, 0xde, 0x96, 0xb3, 0x35, 0x77, 0x4f, 0xde, 0x61, 0xa5, 
+0x32, 0x6d, 0x7b, 0xfa, 0xee, 0x8c, 0xbd, 0x99, 0x47, 0x4c, 0xcd, 0xd0, 0xa2, 0x43, 0x34, 0x6a, 
+0x53, 0xce, 0xda, 0x8d, 0x9d, 0x69, 0x29, 0x74, 0xa1, 0x22, 0x04, 0xa1, 0x54, 0x11, 0x24, 0x8c, 
+0x4a, 0x11, 0x74, 0x65, 0xed, 0xde, 0x48, 0xd6, 0x6e, 0x20, 0x63, 0x15, 0xad, 0x7d, 0xe9, 0xc0, 
+0x41, 0x6d, 0xe6, 0x09, 0xda, 0x24, 0xaa, 0x68, 0xe0, 0x19, 0xd8, 0x40, 0xdd, 0xc4, 0x97, 0xb2, 
+0x89, 0x47, 0xf3, 0x10, 0x27, 0x1b, 0x57, 0xae, 0xc7, 0x2d, 0x83, 0x59, 0xc5, 0x0e, 0xdb, 0xcc, 
+0x61, 0x84, 0x23, 0x6a, 0xde, 0xcb, 0xfe, 0x28, 0xe7, 0xd3, 0xdc, 0x2f, 0xf3, 0xbe, 0x51, 0xf6, 
+0xa5, 0xed, 0x4f, 0x3f, 0x89, 0x93, 0x7a, 0xda, 0x64, 0x2e, 0x60, 0x6a, 0xc2, 0xeb, 0x39, 0x67, 
+0x51, 0x4d, 0x58, 0x8b, 0x6a, 0xc2, 0x5f, 0xd2, 0xbf, 0x43, 0x35, 0xe1, 0x12, 0x81, 0xcf, 0x50, 
+0x5c, 0x96, 0xbb, 0x2d, 0xaf, 0x82, 0x50, 0xbc, 0x3e, 0x63, 0x7b, 0x66, 0x25, 0x82, 0xff, 0x41, 
+0xa1, 0xd8, 0x15, 0xb9, 0xd6, 0x13, 0x5a, 0x02, 0xe2, 0x50, 0xeb, 0x0b, 0xec, 0x86, 0x67, 0x20, 
+0x0e, 0xf5, 0x9e, 0x82, 0x98, 0x29, 0xb6, 0x27, 0x05, 0x51, 0xd4, 0xa7, 0x20, 0x4a, 0xfa, 0x14, 
+0x44, 0x59, 0x9f, 0x00, 0x68, 0xd0, 0x27, 0x1a, 0xfa, 0xe8, 0x73, 0x0b, 0x7d, 0x6b, 0x28, 0xf1, 
+0x8b, 0xa7, 0x7d, 0x19, 0xf5, 0x19, 0x84, 0x7e, 0xfa, 0x5c, 0x3c, 0xff, 0x62, 0xe8, 0x6b, 0xe8, 
+0x66, 0x00, 0x03, 0xe4, 0x43, 0x7e, 0x40, 0x31, 0xf4, 0x91, 0x63, 0x65, 0x1c, 0xd4, 0x2c, 0x98, 
+0x15, 0x58, 0x0c, 0xbd, 0xa5, 0x21, 0x12, 0x48, 0x30, 0x13, 0x66, 0x06, 0x15, 0x43, 0x2f, 0x31, 
+0x5a, 0x04, 0x11, 0x66, 0xc0, 0x8c, 0x0e, 0xfa, 0x34, 0xbf, 0x8e, 0xfa, 0x34, 0xbf, 0x4e, 0xfa, 
+0xfc, 0xbd, 0x60, 0x7d, 0xde, 0x63, 0x67, 0x7d, 0x0a, 0x62, 0x88, 0x3e, 0xbb, 0xb1, 0x8b, 0x3e, 
+0x9d, 0x30, 0x54, 0x9f, 0xc3, 0x18, 0xa6, 0x4f, 0xa9, 0xec, 0x5a, 0x0c, 0x0f, 0xfb, 0x4e, 0xf4, 
+0x8d, 0xf4, 0x45, 0x3d, 0xaa, 0x30, 0xbc, 0x18, 0x52, 0x7c, 0xba, 0xfb, 0x80, 0x0f, 0x14, 0x40, 
+0x81, 0x4b, 0x12, 0x64, 0xa4, 0x3e, 0x1f, 0x31, 0x4a, 0x9f, 0x68, 0x68, 0xd2, 0xe7, 0x57, 0x46, 
+0xeb, 0xf3, 0x1e, 0x63, 0xf4, 0xa9, 0x8e, 0xdd, 0xf4, 0x89, 0x93, 0xdd, 0x6b, 0x28, 0x7b, 0x8c, 
+0xa7, 0xe3, 0xc5, 0xe9, 0xb3, 0x0e, 0xcd, 0xc5, 0xf0, 0x63, 0xbf, 0x1e, 0x7e, 0xe0, 0x07, 0xaf, 
+0xc1, 0x6b, 0xf1, 0xc5, 0xf0, 0x88, 0x31, 0xce, 0x88, 0x93, 0x57, 0x04, 0x45, 0x56, 0x7d, 0x8a, 
+0x68, 0x92, 0x3e, 0xc3, 0xb3, 0xa7, 0x3e, 0xa1, 0xb1, 0xb7, 0x3e, 0x0d, 0xb3, 0x6f, 0x31, 0xf4, 
+0x0c, 0x48, 0x08, 0x80, 0x00, 0x98, 0x03, 0x73, 0x52, 0x8a, 0xe1, 0x51, 0xff, 0x78, 0x7f, 0xf0, 
+0x47, 0x4d, 0x67, 0x36, 0x74, 0x73, 0xc9, 0x6e, 0x54, 0xbb, 0x32, 0xef, 0xc2, 0xb0, 0xa1, 0xd6, 
+0xa5, 0xd8, 0x78, 0x4f, 0xbd, 0xde, 0x2a, 0xfc, 0x5a, 0x93, 0x9a, 0xbf, 0x26, 0xa9, 0x69, 0xa5, 
+0x2c, 0xb0, 0xd4, 0xbc, 0x64, 0xb1, 0xe8, 0x76, 0x25, 0x47, 0xae, 0x3b, 0x12, 0x10, 0x5a, 0xea, 
+0xf9, 0x6c, 0x77, 0xee, 0x95, 0x8c, 0xbb, 0x64, 0x44, 0xc9, 0x3d, 0xa9, 0x1c, 0xa2, 0xc8, 0x71, 
+0x98, 0x4f, 0x8e, 0xc3, 0x42, 0x26, 0x44, 0xcd, 0x28, 0x44, 0x93, 0x79, 0x2a, 0x82, 0x4f, 0x73, 
+0xdd, 0x01, 0xbe, 0x53, 0x92, 0xea, 0x8b, 0x78, 0xa8, 0x3d, 0xd0, 0x58, 0x8f, 0x56, 0x0f, 0x0a, 
+0xd2, 0x1e, 0x05, 0xc7, 0x48, 0x90, 0x72, 0x73, 0x03, 0xad, 0x1e, 0xcb, 0x85, 0x78, 0x56, 0xef, 
+0x07, 0x65, 0xe9, 0x90, 0xa6, 0x6a, 0x0b, 0x13, 0x93, 0x2e, 0xb6, 0x06, 0xf3, 0x09, 0xee, 0xd1, 
+0x67, 0x69, 0xe3, 0x80, 0xfa, 0xa3, 0x6d, 0x45, 0x22, 0xf6, 0x5a, 0x8a, 0x6c, 0x4c, 0x1c, 0x88, 
+0x16, 0x16, 0x89, 0x58, 0xd9, 0x38, 0x61, 0x5c, 0x01, 0x3c, 0xe4, 0x52, 0xfa, 0x87, 0x6f, 0xe8, 
+0xa3, 0x91, 0x75, 0xe6, 0x21, 0x2b, 0x72, 0x13, 0x25, 0xb1, 0x7f, 0x94, 0xdd, 0xc3, 0x88, 0x68, 
+0x8b, 0x4f, 0xe8, 0x1f, 0xb0, 0x11, 0xb3, 0x0d, 0x1b, 0x12, 0x6e, 0xdd, 0xd3, 0xd8, 0x81, 0x07, 
+0xba, 0xdc, 0xa5, 0xf6, 0x74, 0xe5, 0xa1, 0x30, 0x5d, 0x44, 0xaf, 0x64, 0x69, 0x1c, 0x2f, 0xa2, 
+0x95, 0xa4, 0x15, 0xf8, 0xf1, 0xbc, 0x3d, 0xd1, 0x6d, 0x0c, 0xeb, 0x7e, 0xc4, 0xcb, 0xac, 0x06, 
+0x16, 0x17, 0x63, 0x51, 0x31, 0xc4, 0xf2, 0x8c, 0xe1, 0x44, 0x1b, 0x19, 0xd6, 0x32, 0x6c, 0x7c, 
+0xdc, 0x7a, 0xde, 0x1c, 0x1a, 0x65, 0x47, 0x21, 0x52, 0xa3, 0x8d, 0x48, 0xda, 0x96, 0xb0, 0x4e, 
+0xd8, 0x8c, 0x7d, 0xcf, 0xbc, 0x4b, 0xc4, 0x95, 0x7b, 0xe6, 0x55, 0x8a, 0x1a, 0x33, 0xf6, 0x6e, 
+0xe8, 0x7b, 0xdd, 0xa6, 0xe0, 0xc9, 0xde, 0xb7, 0xa0, 0xbd, 0xff, 0xa3, 0xf1, 0xb5, 0x0d, 0xf0, 
+0xe0, 0x6d, 0xb6, 0x2a, 0x30, 0xfa, 0xa8, 0x83, 0x96, 0xbd, 0x0a, 0x65, 0xeb, 0xe3, 0x59, 0xb2, 
+0x40, 0x82, 0x00, 0x05, 0x6d, 0xd8, 0xab, 0x70, 0x8b, 0x9a, 0xf9, 0xdf, 0x7f, 0xab, 0x82, 0xae, 
+0xae, 0xd7, 0xd1, 0x5b, 0xd3, 0x0e, 0x54, 0xbe, 0xda, 0xe7, 0xbd, 0xc7, 0x51, 0xd0, 0x99, 0x96, 
+0xf9, 0x1a, 0x2d, 0x7a, 0x1d, 0xc6, 0x57, 0x36, 0xae, 0x76, 0x55, 0xe5, 0xab, 0x5d, 0xdd, 0x45, 
+0x1b, 0xb5, 0xab, 0x57, 0xd3, 0x46, 0xed, 0x8d, 0x8b, 0xa3, 0x59, 0xb7, 0x6c, 0x76, 0x0c, 0xeb, 
+0x36, 0xbd, 0x1d, 0xcb, 0xba, 0xf9, 0x73, 0xbb, 0xb3, 0xae, 0xa2, 0x92, 0xc2, 0xc6, 0x2b, 0xd7, 
+0x51, 0xd8, 0xb8, 0x78, 0x09, 0x19, 0x61, 0xdb, 0xd7, 0x92, 0x43, 0x64, 0xc3, 0xa2, 0x64, 0xd6, 
+0xbd, 0xbe, 0xb0, 0x27, 0xb9, 0x47, 0x16, 0x90, 0x7b, 0x64, 0xeb, 0x2a, 0x87, 0x47, 0xa0, 0xa0, 
+0x0d, 0x63, 0xc6, 0x91, 0xfc, 0xea, 0x27, 0x1d, 0xed, 0x38, 0x92, 0x57, 0x9f, 0xe1, 0x43, 0x0f, 
+0xb1, 0xe3, 0xc0, 0x67, 0x8e, 0x69, 0x35, 0x74, 0x9b, 0xbc, 0x75, 0x15, 0x1f, 0xfa, 0xbc, 0xf7, 
+0xf4, 0xa3, 0x5c, 0x36, 0xdb, 0xed, 0x28, 0x1d, 0x1e, 0x81, 0x7c, 0x8b, 0x1d, 0xa1, 0x33, 0xf7, 
+0xb0, 0xf2, 0x01, 0x26, 0xda, 0x71, 0xcc, 0x33, 0x9e, 0x1d, 0x6d, 0x47, 0x08, 0x5e, 0x5f, 0x08, 
+0x39, 0xe3, 0x18, 0x49, 0x0d, 0x1f, 0x6a, 0xad, 0x13, 0x86, 0x0f, 0x0d, 0x92, 0xdc, 0xd9, 0xf1, 
+0x2b, 0x35, 0x9f, 0x59, 0x07, 0x22, 0x9d, 0x72, 0x91, 0xf7, 0x7f, 0x93, 0x32, 0xa8, 0xef, 0xa2, 
+0xf5, 0x65, 0x22, 0xef, 0x87, 0x4b, 0x39, 0x22, 0xef, 0xcb, 0xe9, 0xfe, 0x27, 0x92, 0x4d, 0xe2, 
+0xfd, 0x0c, 0x91, 0x93, 0xe6, 0x2a, 0x97, 0x9d, 0x1a, 0x7f, 0x3b, 0xa1, 0x82, 0x3b, 0x52, 0x74, 
+0x90, 0x60, 0xd8, 0x07, 0xa4, 0x2f, 0xbc, 0x1d, 0xf6, 0x05, 0x68, 0x95, 0x81, 0x3a, 0x70, 0xf8, 
+0x3a, 0xb2, 0x6e, 0xee, 0x42, 0x32, 0xe2, 0x97, 0x2f, 0xa3, 0xfd, 0xfa, 0xaf, 0xcf, 0xeb, 0xc2, 
+0xba, 0x39, 0x6f, 0x85, 0x72, 0x4c, 0x84, 0xd1, 0xa6, 0xe2, 0x77, 0x88, 0xd3, 0xbd, 0xb9, 0x5a, 
+0xe3, 0x71, 0x34, 0xeb, 0x1b, 0xd6, 0x12, 0xab, 0x5b, 0x51, 0x4e, 0x58, 0xa9, 0xdc, 0x94, 0x48, 
+0x18, 0x54, 0x69, 0x4a, 0x17, 0xaf, 0xd2, 0x7c, 0x5c, 0x40, 0xdf, 0xbd, 0xb5, 0x8a, 0xc7, 0x63, 
+0xe8, 0xe3, 0x5b, 0x36, 0xd3, 0xc7, 0xd7, 0xae, 0xa1, 0x8f, 0x2f, 0x58, 0x4f, 0x1f, 0xdf, 0xbb, 
+0x87, 0x3e, 0xbe, 0x6d, 0x71, 0x12, 0xff, 0x05, 0xfa, 0xf8, 0xc9, 0x13, 0xda, 0x70, 0xb5, 0x01, 
+0x6a, 0x63, 0x69, 0xff, 0x20, 0xb4, 0x18, 0x57, 0x90, 0x1d, 0xce, 0x96, 0x0f, 0xb4, 0x74, 0x50, 
+0xe0, 0xfc, 0xc6, 0x8e, 0x0a, 0x7c, 0xb5, 0xb6, 0x93, 0x0d, 0xb6, 0xcc, 0xbf, 0x19, 0xcc, 0x3c, 
+0x3d, 0xcb, 0x82, 0x3b, 0x2b, 0xf0, 0xe5, 0x0a, 0x64, 0x34, 0x95, 0xa5, 0xc8, 0x68, 0x4e, 0xbc, 
+0x89, 0x8c, 0xe6, 0xfb, 0x2b, 0x61, 0xf6, 0xc0, 0x9d, 0x4b, 0x54, 0xb5, 0xab, 0x02, 0xef, 0x2e, 
+0x0d, 0xb7, 0x43, 0x45, 0xc9, 0xb8, 0xfc, 0x08, 0x3b, 0x9c, 0x59, 0x43, 0x9b, 0x84, 0xd5, 0xd9, 
+0x51, 0x0a, 0x1c, 0x5f, 0x6e, 0x42, 0xc3, 0xb6, 0x38, 0x5a, 0x81, 0x93, 0x2b, 0xd1, 0x6e, 0xbb, 
+0x74, 0x31, 0x56, 0x81, 0x77, 0xe6, 0x75, 0x53, 0x60, 0xeb, 0xeb, 0xdd, 0x15, 0xa8, 0x5e, 0x18, 
+0xa7, 0xc0, 0xb6, 0x37, 0xcc, 0x76, 0xb8, 0xda, 0xdc, 0xbf, 0x5f, 0xbc, 0x1d, 0xbe, 0x5e, 0x67, 
+0x8e, 0x49, 0xb0, 0x43, 0xd3, 0xe5, 0xc9, 0x45, 0x2d, 0x55, 0x58, 0xec, 0x70, 0x6e, 0xc3, 0xf8, 
+0x02, 0xab, 0x02, 0x55, 0x0b, 0x12, 0x15, 0x38, 0xb5, 0x0a, 0x59, 0xd6, 0xe9, 0xd5, 0xc9, 0x0a, 
+0xbc, 0x3d, 0xb7, 0xa7, 0x02, 0x9b, 0xe6, 0x20, 0xf3, 0xda, 0xb1, 0xb8, 0xb7, 0x02, 0xdb, 0x17, 
+0x51, 0x95, 0xa6, 0xfe, 0x7d, 0x59, 0xdb, 0x8f, 0x8b, 0xcb, 0x9b, 0x8e, 0x9a, 0x15, 0xd0, 0x0a, 
+0xa8, 0xeb, 0x1e, 0x81, 0xba, 0xda, 0xdc, 0x6e, 0xa0, 0xce, 0x96, 0x7b, 0x00, 0xea, 0xfb, 0x2b, 
+0x04, 0xd4, 0x77, 0xeb, 0x11, 0xa8, 0x0f, 0xe0, 0x42, 0xc2, 0xdf, 0x61, 0x72, 0x42, 0x51, 0x82, 
+0xa3, 0x48, 0x88, 0x13, 0xb0, 0x6f, 0xcb, 0xda, 0x0b, 0xd8, 0x75, 0x0d, 0xb0, 0xd9, 0xb0, 0xb9, 
+0xc9, 0x28, 0x7f, 0x02, 0x0e, 0xc2, 0x0a, 0xf2, 0x40, 0x58, 0xab, 0xa4, 0x50, 0x99, 0x11, 0xd6, 
+0x67, 0xf2, 0x20, 0x03, 0x23, 0x90, 0x4a, 0xc3, 0x4e, 0x03, 0x27, 0x10, 0xd6, 0x97, 0x89, 0x73, 
+0x84, 0xb1, 0x22, 0x23, 0x34, 0xde, 0xff, 0x4d, 0x3a, 0x43, 0xfd, 0x70, 0x29, 0xd9, 0x97, 0x13, 
+0x5a, 0x8a, 0x0f, 0x27, 0xb0, 0x37, 0x8c, 0xbc, 0x5f, 0xe9, 0xcb, 0x09, 0x6b, 0x8f, 0xd8, 0xf3, 
+0x36, 0xc1, 0x63, 0xa8, 0xe5, 0xae, 0x6c, 0x89, 0x8a, 0xc0, 0x30, 0xc6, 0x7d, 0xc8, 0x19, 0x3c, 
+0x8e, 0x63, 0xc1, 0xe3, 0xe4, 0x96, 0xe0, 0xb1, 0x01, 0x12, 0x1a, 0xb9, 0x23, 0x45, 0x94, 0x2d, 
+0x83, 0x0f, 0x04, 0x89, 0xb2, 0xb9, 0x47, 0x3b, 0x37, 0xe1, 0xf2, 0xb8, 0xb1, 0x1d, 0xdb, 0x0d, 
+0xbc, 0xc4, 0xa3, 0xcb, 0x26, 0x5c, 0xf6, 0xff, 0x6e, 0x0f, 0xc5, 0xb3, 0x37, 0x1d, 0x67, 0x7b, 
+0x24, 0x2c, 0x8a, 0xf8, 0xb6, 0xaa, 0x05, 0x8c, 0x79, 0x02, 0x9c, 0xb3, 0x32, 0xdd, 0xad, 0x91, 
+0xe2, 0x26, 0xd7, 0x8d, 0x7c, 0xce, 0xdd, 0xb7, 0x24, 0x1b, 0xf9, 0x56, 0x4d, 0xe2, 0xc5, 0xb5, 
+0x86, 0x16, 0x07, 0x71, 0x33, 0x29, 0x49, 0x75, 0x54, 0x8f, 0xad, 0x9e, 0x82, 0xb2, 0x0d, 0x3c, 
+0x04, 0x49, 0x7b, 0x35, 0x0f, 0x50, 0x2e, 0xdb, 0x41, 0x14, 0xd5, 0x95, 0x9b, 0x91, 0xf9, 0x6e, 
+0x58, 0xcc, 0x1d, 0xc8, 0x28, 0xa8, 0x57, 0x94, 0xa3, 0xa0, 0x2e, 0x59, 0x8e, 0x96, 0x6e, 0x5d, 
+0x83, 0x45, 0x11, 0xa0, 0x82, 0x46, 0x10, 0x72, 0x37, 0xbf, 0xa2, 0xe1, 0xad, 0x8c, 0xf0, 0xd6, 
+0xe6, 0x9f, 0xac, 0x02, 0x57, 0x59, 0x5a, 0x64, 0x60, 0x56, 0x2d, 0x8b, 0x6a, 0x9a, 0x8a, 0x26, 
+0xcb, 0x3c, 0xc1, 0xce, 0x34, 0xf9, 0x9a, 0x34, 0xab, 0x72, 0xec, 0x26, 0xd3, 0x35, 0x73, 0xe0, 
+0x94, 0xc5, 0xd9, 0x73, 0x51, 0xfa, 0xbf, 0x3d, 0x7d, 0xc3, 0xac, 0x0a, 0xfb, 0x2a, 0xd4, 0x00, 
+0xde, 0x19, 0xb9, 0x76, 0xac, 0xca, 0x2d, 0x6a, 0x8f, 0xf1, 0x4e, 0xbe, 0x50, 0x08, 0xaa, 0xba, 
+0xd6, 0x50, 0xd5, 0x13, 0x54, 0x0d, 0x04, 0x55, 0x23, 0x41, 0x75, 0x80, 0xa0, 0x3a, 0x48, 0x50, 
+0x1d, 0x6a, 0x3b, 0x54, 0xf5, 0x8d, 0x7a, 0xa8, 0x8a, 0xa4, 0xac, 0x62, 0x65, 0x09, 0x6a, 0x0a, 
+0x06, 0x0e, 0x5b, 0x06, 0xc2, 0x66, 0x75, 0xc2, 0x66, 0x65, 0x7a, 0x05, 0x8e, 0x75, 0x0d, 0x8d, 
+0xd4, 0x09, 0x5f, 0x90, 0x2b, 0x7c, 0x69, 0x0b, 0x75, 0x10, 0xca, 0x0c, 0xbe, 0xb4, 0x79, 0xa6, 
+0x98, 0x44, 0x27, 0x5c, 0x7c, 0xfb, 0x2e, 0xcd, 0x96, 0xd7, 0x48, 0xbd, 0xdb, 0xbd, 0xd8, 0x00, 
+0x47, 0xdc, 0x84, 0xec, 0xf7, 0x9e, 0x8c, 0x50, 0x60, 0x6d, 0x89, 0x3e, 0x6e, 0xcf, 0xb7, 0xf4, 
+0x2a, 0x28, 0x2d, 0x10, 0xd8, 0x2d, 0x5b, 0xc9, 0x1b, 0xc4, 0x80, 0xdd, 0x76, 0x5f, 0xe3, 0xf7, 
+0xe7, 0xff, 0x11, 0xfb, 0xb1, 0xef, 0x8e, 0xac, 0x10, 0x57, 0x36, 0x79, 0x6d, 0x49, 0xcb, 0x6a, 
+0x70, 0x22, 0x88, 0xaf, 0xf1, 0x6d, 0x1a, 0x59, 0x4d, 0x34, 0x70, 0xf0, 0xb5, 0x15, 0xee, 0x00, 
+0x55, 0x5b, 0xe1, 0xb9, 0xab, 0x68, 0x05, 0xf0, 0xa4, 0x85, 0x0e, 0x0e, 0xa0, 0x19, 0xc8, 0x0c, 
+0xe0, 0x59, 0xdb, 0x18, 0xb0, 0x0c, 0xd0, 0x91, 0x6b, 0x58, 0x8a, 0x82, 0xd7, 0x95, 0xde, 0xe5, 
+0x9f, 0x6c, 0x7b, 0xb9, 0x2e, 0x79, 0x95, 0x23, 0xd7, 0x7d, 0xf5, 0x48, 0x7d, 0xdd, 0x48, 0xaf, 
+0xfa, 0x41, 0x0d, 0x54, 0x5a, 0x4b, 0x9d, 0xbc, 0xd9, 0xa1, 0x27, 0x28, 0xb0, 0x73, 0x09, 0x17, 
+0xa8, 0x36, 0xb9, 0xa2, 0x44, 0xc5, 0x49, 0x39, 0xb3, 0x46, 0x6d, 0x9f, 0x8e, 0xc0, 0x44, 0x73, 
+0xbc, 0x4d, 0xfe, 0x7a, 0x9d, 0x9a, 0xa0, 0xa0, 0x82, 0xd0, 0x22, 0x45, 0x15, 0x94, 0xa2, 0xc8, 
+0xc2, 0xab, 0x42, 0x16, 0x38, 0x72, 0x98, 0x3d, 0xca, 0x52, 0x9b, 0xbc, 0x7d, 0x91, 0x3a, 0x9a, 
+0x09, 0xec, 0x3b, 0x83, 0x9c, 0xeb, 0x14, 0xe1, 0x28, 0x38, 0xb8, 0x92, 0xcf, 0x63, 0x74, 0xac, 
+0xa0, 0x16, 0x93, 0x25, 0xac, 0x6c, 0x16, 0xbd, 0xad, 0x45, 0x36, 0xdf, 0x0b, 0xf4, 0x5e, 0xbf, 
+0x2d, 0x7a, 0x51, 0x63, 0x69, 0x0f, 0x7a, 0x3d, 0x68, 0x2b, 0x6c, 0x9a, 0x10, 0xbd, 0xdf, 0xad, 
+0x57, 0x13, 0xfe, 0x44, 0xaa, 0x8a, 0x86, 0xe0, 0x39, 0x0e, 0x04, 0x7f, 0x1b, 0x52, 0xd6, 0x36, 
+0x04, 0xdf, 0x05, 0x6e, 0xaf, 0xb7, 0x15, 0xb7, 0x73, 0xe1, 0xf7, 0x47, 0x58, 0x31, 0xea, 0xe1, 
+0x19, 0xd6, 0x77, 0xb0, 0x91, 0x45, 0x77, 0xa1, 0x9f, 0x54, 0xcd, 0x50, 0x3f, 0x01, 0x7f, 0xd7, 
+0xac, 0x01, 0xd6, 0x8f, 0x97, 0x5e, 0x10, 0xa6, 0x09, 0xb7, 0x2a, 0x2d, 0xae, 0x86, 0x38, 0x13, 
+0xf7, 0xb7, 0xaf, 0x17, 0x60, 0x1e, 0x1c, 0x24, 0xc0, 0xce, 0x77, 0x3d, 0xdb, 0xe0, 0x6c, 0x6b, 
+0x4c, 0x63, 0x04, 0x73, 0x43, 0xe9, 0xea, 0x4d, 0x0b, 0x50, 0x59, 0x91, 0x20, 0xc9, 0x54, 0x15, 
+0x93, 0xd7, 0x9e, 0x6e, 0x29, 0x83, 0xe9, 0x4e, 0xbb, 0x10, 0xe5, 0x01, 0x83, 0x1a, 0xef, 0xb1, 
+0xe9, 0x7d, 0x67, 0x65, 0xa1, 0x0d, 0x5a, 0xa1, 0x6b, 0xfd, 0xaf, 0x2f, 0x4f, 0x5b, 0x91, 0xbe, 
+0x36, 0x63, 0x2b, 0x2b, 0x8d, 0x84, 0xbf, 0x5e, 0x8c, 0xbf, 0xbe, 0x52, 0x59, 0x82, 0xbf, 0xbe, 
+0x0e, 0x7f, 0xdd, 0x97, 0xfd, 0x3a, 0xca, 0x94, 0xa5, 0x69, 0xaf, 0x67, 0x2c, 0x6a, 0x15, 0x5b, 
+0x28, 0x61, 0x15, 0x22, 0x32, 0x36, 0x66, 0xae, 0x46, 0x86, 0x29, 0xe5, 0xcd, 0x21, 0xe3, 0xfb, 
+0x8b, 0x17, 0x99, 0x63, 0x7c, 0x84, 0xc3, 0x31, 0x3e, 0xc2, 0xfa, 0x02, 0xbb, 0xe1, 0x8e, 0xf1, 
+0x11, 0xde, 0x1d, 0xe3, 0x4f, 0xb4, 0xcb, 0x31, 0xee, 0xa3, 0xf7, 0x5e, 0xfb, 0xea, 0xfd, 0xda, 
+0x46, 0xbd, 0xc7, 0xdb, 0x4f, 0xef, 0x0b, 0xf7, 0xd7, 0x7b, 0xc9, 0x03, 0xf4, 0xfe, 0x73, 0xaf, 
+0x3b, 0xfd, 0x35, 0x17, 0x73, 0x21, 0x14, 0x76, 0x6c, 0x71, 0x3e, 0x17, 0x41, 0x51, 0x27, 0xbd, 
+0xc7, 0x3b, 0x58, 0xef, 0xa3, 0xee, 0xac, 0xf7, 0x5e, 0x7b, 0x75, 0x72, 0x3b, 0x7d, 0xe1, 0x61, 
+0x7a, 0x2f, 0x79, 0x57, 0xbd, 0xff, 0x3c, 0x5c, 0xef, 0x66, 0x6f, 0xed, 0xe4, 0xd6, 0xfc, 0xcd, 
+0xaf, 0xc1, 0x6b, 0x51, 0x2d, 0x9e, 0xe8, 0xd9, 0x30, 0xdb, 0xa4, 0xf7, 0x51, 0x47, 0xeb, 0xbd, 
+0xd7, 0x31, 0x7a, 0xbf, 0x76, 0x37, 0xbd, 0xc7, 0xbb, 0xbb, 0xde, 0x17, 0x1e, 0xa7, 0xf7, 0x92, 
+0x9b, 0xf5, 0xfe, 0xf3, 0xd6, 0x3b, 0xfd, 0x9d, 0x3e, 0xea, 0x44, 0xbd, 0xf7, 0x3a, 0x49, 0xbf, 
+0x9f, 0x3f, 0x59, 0x5f, 0x21, 0xa1, 0xa7, 0xde, 0xe3, 0xdd, 0x5b, 0xef, 0x0b, 0xef, 0xa3, 0xdf, 
+0xdc, 0xdf, 0x57, 0xef, 0x32, 0x4f, 0xd1, 0x3b, 0xd3, 0x21, 0xc6, 0xc5, 0x17, 0xfe, 0xc1, 0x10, 
+0xe6, 0x9c, 0x18, 0xf9, 0x98, 0x75, 0x35, 0x36, 0x06, 0x72, 0x83, 0x1b, 0x86, 0xb8, 0xf7, 0xf7, 
+0x7d, 0x2b, 0x5c, 0xd6, 0xfc, 0x7d, 0x97, 0xc9, 0x17, 0x5e, 0x20, 0x94, 0xd3, 0x4e, 0xe8, 0x5c, 
+0xf1, 0x3f, 0x70, 0xf1, 0x0d, 0x19, 0xc2, 0x9d, 0x1a, 0x43, 0x20, 0x70, 0x88, 0x7e, 0xad, 0xdd, 
+0x62, 0x13, 0xc9, 0x7e, 0x60, 0xb1, 0x40, 0x81, 0x84, 0x7d, 0x4c, 0x0c, 0x0c, 0x91, 0xb1, 0xef, 
+0xd1, 0x03, 0x62, 0x0d, 0xd8, 0x97, 0x96, 0x42, 0xb3, 0x8f, 0x4c, 0xa5, 0xdf, 0x9b, 0x7c, 0xf1, 
+0x3e, 0x2e, 0x0e, 0xaa, 0x99, 0x9f, 0x3c, 0x39, 0x19, 0x8e, 0x91, 0x2b, 0x30, 0x1e, 0xf6, 0x90, 
+0xa7, 0x3c, 0x81, 0x38, 0xd0, 0xc0, 0x40, 0xb9, 0x83, 0x79, 0xf0, 0x60, 0x73, 0x43, 0x90, 0x21, 
+0xaa, 0xbe, 0xb6, 0xb6, 0xbe, 0x2e, 0xb2, 0x93, 0x84, 0x8c, 0x08, 0x59, 0x51, 0x09, 0x4d, 0xa0, 
+0xce, 0x4a, 0x92, 0x90, 0x2d, 0x21, 0x63, 0x92, 0x90, 0x31, 0x21, 0x6b, 0x92, 0x90, 0x35, 0x31, 
+0xdf, 0x39, 0x2c, 0x9c, 0xf3, 0xd6, 0xc7, 0xe3, 0x22, 0x64, 0xbf, 0xc6, 0xe8, 0xe8, 0xc6, 0x09, 
+0x91, 0x12, 0x72, 0xa8, 0x2c, 0x25, 0x8a, 0x0f, 0xe0, 0xb8, 0x59, 0x82, 0xb9, 0x2b, 0xd7, 0x2d, 
+0x8b, 0x97, 0x61, 0x7e, 0xf1, 0x92, 0xf7, 0xf3, 0x13, 0x24, 0x68, 0x6a, 0x6e, 0x6e, 0xb2, 0xc8, 
+0xd0, 0xad, 0xbc, 0xbc, 0x5b, 0xa1, 0xb5, 0x84, 0x56, 0x9c, 0xce, 0x70, 0x92, 0xd0, 0x70, 0x9a, 
+0x62, 0xef, 0x25, 0x21, 0x27, 0x9b, 0x36, 0xac, 0x37, 0xff, 0x12, 0xee, 0x54, 0xef, 0x0f, 0x03, 
+0xfa, 0x62, 0xdf, 0xaf, 0x1f, 0x0c, 0x4a, 0x31, 0x40, 0xe2, 0xa4, 0x49, 0x89, 0xe3, 0xa3, 0x1e, 
+0x95, 0x7c, 0x4c, 0x8c, 0xb9, 0x19, 0xd0, 0x74, 0x1a, 0x34, 0x80, 0x55, 0x41, 0xe1, 0x9f, 0x08, 
+0x31, 0x72, 0x06, 0xaf, 0xfa, 0xf1, 0xfb, 0xb2, 0x04, 0xc9, 0x27, 0x04, 0xee, 0xbd, 0x9f, 0xaf, 
+0x93, 0x7c, 0xaf, 0x2a, 0xec, 0xdf, 0xb9, 0x17, 0xd3, 0x01, 0x6a, 0x07, 0x3e, 0x96, 0x15, 0x8e, 
+0x31, 0x85, 0xf2, 0x7e, 0x7b, 0x18, 0xef, 0xb7, 0x45, 0xf2, 0x7e, 0xb9, 0x0e, 0xe7, 0x3b, 0xb9, 
+0x20, 0xe6, 0x2f, 0xfc, 0xc0, 0x0f, 0xe5, 0x98, 0x92, 0x2f, 0x06, 0x23, 0x09, 0x3d, 0x8e, 0x5c, 
+0x7b, 0x64, 0x2a, 0xa3, 0xa3, 0xc7, 0x59, 0x93, 0x2a, 0xbb, 0x25, 0x26, 0x47, 0x41, 0xce, 0x13, 
+0xc2, 0x59, 0x8d, 0x98, 0xce, 0x12, 0x31, 0xbd, 0x2c, 0xac, 0x14, 0xfe, 0x45, 0x89, 0x68, 0xce, 
+0xc2, 0x8f, 0xdf, 0xf2, 0x42, 0x44, 0x2b, 0xe7, 0x2e, 0x5b, 0x87, 0x44, 0x54, 0x3c, 0xff, 0xfd, 
+0x25, 0xff, 0x26, 0xa2, 0x7b, 0x4f, 0x44, 0xe7, 0xff, 0x4e, 0x0c, 0xfc, 0x29, 0x6b, 0x13, 0x36, 
+0xde, 0x77, 0x40, 0xa4, 0x0b, 0x7f, 0xa2, 0x4a, 0x72, 0x73, 0xc5, 0xd7, 0xb5, 0x52, 0x2d, 0xaf, 
+0x53, 0x25, 0xb9, 0x0e, 0xd2, 0xcc, 0x7f, 0xaa, 0x4a, 0x72, 0x94, 0x85, 0x6e, 0x6e, 0xa9, 0x27, 
+0x57, 0xec, 0xbe, 0x9e, 0x1c, 0xbc, 0xd9, 0xba, 0x9e, 0x9c, 0x9a, 0xd0, 0x9e, 0xcd, 0x0f, 0x1e, 
+0x2a, 0xc9, 0xb1, 0xc2, 0x8c, 0x03, 0x9c, 0x75, 0xc7, 0x56, 0xb7, 0x2a, 0x24, 0x57, 0x7e, 0x3f, 
+0x0a, 0xc9, 0x69, 0x45, 0xe4, 0xe0, 0xd4, 0xbf, 0xbe, 0xbb, 0xa2, 0xd3, 0x3f, 0x6c, 0xbb, 0x48, 
+0xbb, 0xca, 0xc7, 0x2d, 0x72, 0x29, 0x1f, 0xb7, 0xf1, 0xae, 0xcb, 0xc7, 0xe9, 0x4a, 0xc7, 0xf9, 
+0x6c, 0xfe, 0x47, 0x97, 0x8e, 0x2b, 0x4b, 0x15, 0x1f, 0x42, 0x92, 0x67, 0xb9, 0xa1, 0x69, 0x23, 
+0xad, 0xdb, 0xd9, 0xd5, 0x76, 0x76, 0xb5, 0x83, 0x5d, 0xed, 0xc0, 0x2b, 0xef, 0x39, 0x0d, 0x43, 
+0x84, 0xa7, 0x35, 0xd1, 0xf3, 0xb4, 0x96, 0x09, 0xc8, 0xf6, 0x4c, 0x3c, 0x92, 0x57, 0x23, 0x34, 
+0xdd, 0xee, 0x19, 0x45, 0x05, 0xce, 0xc7, 0xa8, 0x5c, 0x8b, 0x25, 0x87, 0x5e, 0x1d, 0x65, 0x33, 
+0x54, 0xbb, 0xcd, 0x06, 0xd4, 0xec, 0xc3, 0x1d, 0x55, 0x5e, 0xec, 0x43, 0xa9, 0xb6, 0x7e, 0x1c, 
+0x65, 0x01, 0x6a, 0x8f, 0x4c, 0xb1, 0xc1, 0xe6, 0x2d, 0x45, 0xf4, 0x5c, 0x1c, 0x26, 0x2c, 0x2a, 
+0x2b, 0xc6, 0x3f, 0x68, 0x61, 0x8f, 0x55, 0x28, 0x74, 0x63, 0x21, 0x3a, 0x0b, 0xc9, 0xb9, 0x49, 
+0x01, 0xbc, 0xab, 0xc7, 0x0f, 0xfd, 0xd3, 0xd8, 0x9a, 0x45, 0xfa, 0x91, 0xb0, 0x02, 0xfd, 0x6a, 
+0x1c, 0x2b, 0x16, 0x77, 0x11, 0x58, 0x1e, 0x79, 0x5d, 0xbd, 0x4b, 0xad, 0x38, 0xbe, 0xdb, 0x3b, 
+0x77, 0x15, 0x1b, 0x63, 0xc6, 0x09, 0x24, 0x1d, 0x3f, 0x27, 0xa4, 0x2d, 0x69, 0x5d, 0x06, 0x56, 
+0xba, 0x97, 0xd5, 0x22, 0x46, 0x28, 0x1b, 0xcd, 0x32, 0x5b, 0x46, 0x99, 0x4c, 0x6f, 0x61, 0xc5, 
+0xe0, 0x1e, 0x4b, 0xb7, 0xae, 0x63, 0xb7, 0xeb, 0xd8, 0xed, 0x3a, 0xbc, 0xf5, 0x75, 0x1b, 0xfe, 
+0x9f, 0xaa, 0x2d, 0xa3, 0x59, 0x42, 0xa9, 0x56, 0xf8, 0xab, 0xbb, 0x26, 0x4d, 0x4a, 0x69, 0x39, 
+0x45, 0x0b, 0x16, 0x4a, 0x03, 0xd8, 0x29, 0xf2, 0x34, 0x80, 0xe7, 0xa5, 0xfb, 0x95, 0x06, 0x20, 
+0x1b, 0x2d, 0x3c, 0x51, 0x86, 0x95, 0x2c, 0xd4, 0xd7, 0xec, 0x68, 0x6b, 0x36, 0x80, 0xa3, 0x56, 
+0x87, 0x00, 0x4d, 0xdb, 0xda, 0x97, 0x0d, 0xc0, 0x4b, 0x1c, 0x91, 0x73, 0x27, 0x01, 0xee, 0x57, 
+0xc1, 0xc0, 0x1f, 0x3e, 0xcf, 0x40, 0x3f, 0x0e, 0xe2, 0x80, 0xf1, 0xb4, 0x71, 0x8c, 0x71, 0x3e, 
+0x95, 0xf2, 0x0f, 0x7f, 0x58, 0xd5, 0xfb, 0x15, 0x03, 0xcb, 0x65, 0xa4, 0x4c, 0xc6, 0x57, 0xbc, 
+0x65, 0x01, 0x30, 0x57, 0xda, 0xfd, 0x4d, 0x5c, 0x70, 0xee, 0x77, 0x27, 0xd4, 0xb4, 0x3d, 0x7b, 
+0xa1, 0xf0, 0xf6, 0xe3, 0xbe, 0xb7, 0xc9, 0x0b, 0xae, 0x23, 0x75, 0xee, 0x69, 0xf0, 0x96, 0xc1, 
+0xf0, 0xc9, 0x6e, 0xa6, 0x63, 0x66, 0x3e, 0x65, 0xad, 0xc0, 0xc6, 0xe8, 0x56, 0xb8, 0x38, 0xb8, 
+0xc2, 0x99, 0x56, 0xbb, 0x81, 0x6a, 0xa8, 0xef, 0x95, 0x57, 0x4c, 0x0f, 0x1a, 0x18, 0x27, 0x9d, 
+0x03, 0xbb, 0xc0, 0x2a, 0xfc, 0xc8, 0x52, 0x96, 0xc4, 0x74, 0xd2, 0x4a, 0xf1, 0xaf, 0xb7, 0x4b, 
+0xa4, 0x2b, 0xe0, 0x01, 0x54, 0x6c, 0xca, 0x3b, 0xd9, 0x91, 0xbc, 0xe7, 0x2e, 0xeb, 0x62, 0x47, 
+0xda, 0x7e, 0xe7, 0xeb, 0x50, 0x3b, 0x52, 0xf7, 0xa6, 0x4f, 0x74, 0xe9, 0x0b, 0xb4, 0xe3, 0x46, 
+0xdd, 0x15, 0x8f, 0xef, 0x1d, 0x92, 0x20, 0x52, 0xd1, 0x15, 0x01, 0x62, 0x8b, 0x52, 0x18, 0xd3, 
+0x44, 0x4e, 0x31, 0x5a, 0xdb, 0x00, 0x04, 0x5d, 0x78, 0x95, 0xf3, 0x50, 0xde, 0x85, 0xf1, 0x2e, 
+0x92, 0x77, 0xbc, 0x9a, 0x02, 0xe7, 0xbf, 0x47, 0xf9, 0x08, 0x76, 0xb0, 0xed, 0x3f, 0xf5, 0xfc, 
+0x3f, 0xec, 0xb1, 0x6e, 0xb5, 0x5a, 0xce, 0x17, 0x31, 0x9a, 0xae, 0x3c, 0xd7, 0x2b, 0x41, 0x94, 
+0xea, 0xa0, 0xc0, 0x75, 0x07, 0x0f, 0xc5, 0xad, 0x77, 0x52, 0xdc, 0xfa, 0xdd, 0x14, 0x9a, 0xd3, 
+0x2a, 0xbe, 0xf9, 0xc5, 0xd3, 0x06, 0x9d, 0x56, 0x05, 0x3b, 0x62, 0x02, 0x9c, 0x2b, 0xdf, 0xb5, 
+0xec, 0x1d, 0x7b, 0x56, 0x8b, 0x36, 0x1e, 0x6c, 0xeb, 0x27, 0xe2, 0xf2, 0x78, 0xf5, 0x99, 0x92, 
+0xa5, 0xbc, 0xd0, 0x86, 0x1d, 0x47, 0x75, 0xf6, 0x3b, 0x2a, 0x26, 0xe1, 0x54, 0x5b, 0xa2, 0x15, 
+0x78, 0xfe, 0x31, 0xca, 0x1c, 0x8f, 0x07, 0xa1, 0x81, 0x95, 0xdd, 0xb2, 0xb0, 0xad, 0x48, 0x34, 
+0xe1, 0x57, 0xaf, 0xd1, 0xd6, 0x9c, 0xd2, 0xd9, 0x3d, 0x15, 0xf8, 0xa9, 0x4d, 0x1b, 0x7c, 0x6f, 
+0x05, 0x7e, 0xf9, 0xb4, 0x1e, 0x02, 0x1a, 0xfa, 0xe4, 0x07, 0x9c, 0xe4, 0xfe, 0xea, 0xf2, 0x99, 
+0xfb, 0x9c, 0x24, 0xff, 0xcc, 0x8a, 0x31, 0xfb, 0x71, 0xc8, 0xba, 0xfc, 0xf0, 0x57, 0x2b, 0xf4, 
+0x04, 0xfb, 0x4c, 0x25, 0x1b, 0xfa, 0xc4, 0x07, 0x9c, 0xa0, 0xbf, 0x5a, 0x36, 0xf3, 0xa4, 0x13, 
+0xfc, 0x67, 0xd6, 0x8f, 0x39, 0xc5, 0xd9, 0x81, 0x83, 0x19, 0xbc, 0x5a, 0xa2, 0x97, 0x97, 0xcf, 
+0x2c, 0x65, 0xec, 0xa0, 0x28, 0xf8, 0xa7, 0x17, 0xa7, 0xec, 0x79, 0xee, 0xf0, 0xf3, 0x1b, 0x5f, 
+0xd8, 0xf0, 0xcb, 0xed, 0x2f, 0x56, 0x4d, 0xbf, 0xfc, 0xf2, 0x19, 0xdb, 0x56, 0xfb, 0xee, 0xd4, 
+0x23, 0x8f, 0xed, 0x7d, 0xfc, 0xca, 0xd3, 0xd7, 0x87, 0xef, 0x18, 0x79, 0x7c, 0x14, 0xe5, 0x98, 
+0xb3, 0xe5, 0xcd, 0x0b, 0x92, 0x10, 0x12, 0x48, 0x6d, 0x4b, 0xa0, 0x8a, 0x1e, 0xb4, 0x19, 0x29, 
+0x51, 0x81, 0x19, 0xcf, 0xb6, 0x7a, 0xea, 0x5e, 0x62, 0x70, 0xd6, 0x16, 0xd4, 0x90, 0xb7, 0x4e, 
+0x5d, 0xc0, 0x63, 0x5b, 0x33, 0xb6, 0xcd, 0xda, 0xab, 0x6c, 0x46, 0xdd, 0xb8, 0x6a, 0xe8, 0x7a, 
+0x1e, 0xdf, 0x7a, 0x76, 0x31, 0x6a, 0xd2, 0x89, 0x84, 0xff, 0x7a, 0xb6, 0x12, 0xea, 0x28, 0x1b, 
+0xe6, 0xbb, 0xb3, 0xa1, 0xbc, 0xa8, 0x7e, 0x98, 0x3d, 0x30, 0x37, 0x43, 0x55, 0x1d, 0x05, 0xf7, 
+0xa9, 0x66, 0x88, 0x1d, 0x51, 0x7e, 0xea, 0x64, 0xac, 0x1d, 0x7e, 0xf6, 0xc4, 0x57, 0x67, 0xb4, 
+0xba, 0x21, 0x52, 0xad, 0x5a, 0xa0, 0xe5, 0xb5, 0x10, 0xe6, 0x97, 0xaf, 0xa0, 0xb2, 0x7a, 0x97, 
+0x38, 0x8a, 0x3d, 0xa6, 0xef, 0xe3, 0xd8, 0x16, 0xb0, 0x4a, 0x23, 0x39, 0x8b, 0x7e, 0xbe, 0x31, 
+0xf7, 0xcd, 0xe9, 0xfb, 0xf3, 0x56, 0xe3, 0xd8, 0x3e, 0x62, 0xf5, 0x46, 0xd2, 0x3f, 0x7d, 0x72, 
+0x7b, 0xc6, 0x97, 0x23, 0xf7, 0x51, 0xc1, 0x44, 0x03, 0xc5, 0x61, 0x11, 0xed, 0xb8, 0x52, 0x6e, 
+0xbc, 0x26, 0xcb, 0x55, 0xb7, 0xa5, 0xda, 0x80, 0x56, 0x95, 0x5d, 0xcf, 0x69, 0x54, 0xfb, 0xa5, 
+0xf0, 0xaa, 0xc8, 0xa8, 0xb6, 0x93, 0xf0, 0x3a, 0x51, 0xad, 0x49, 0x2a, 0x23, 0xaa, 0xfd, 0x4a, 
+0xfa, 0x89, 0xdc, 0xd6, 0xf4, 0x57, 0x24, 0x5b, 0x77, 0xe9, 0xaf, 0x2c, 0xd5, 0x95, 0x2b, 0x8c, 
+0xcc, 0x17, 0x71, 0x81, 0x89, 0xf4, 0xd8, 0x66, 0x7a, 0xde, 0xde, 0x24, 0xd4, 0x19, 0xab, 0xcf, 
+0x85, 0x23, 0x09, 0x4f, 0x8e, 0x90, 0x8d, 0xe3, 0xf2, 0x8b, 0x20, 0xc2, 0x8c, 0x6f, 0xb4, 0xc4, 
+0xcb, 0xc6, 0x7e, 0x3d, 0x26, 0x42, 0x64, 0x82, 0x6c, 0x1c, 0x7f, 0x8c, 0xc5, 0x0e, 0xe4, 0xc0, 
+0x09, 0x85, 0x00, 0x0f, 0x71, 0x51, 0xcd, 0x13, 0x55, 0x03, 0x0b, 0x98, 0x88, 0x76, 0x93, 0xa8, 
+0x1a, 0x44, 0xa2, 0x9a, 0x35, 0x0e, 0x13, 0x45, 0x24, 0x82, 0x74, 0x90, 0x76, 0xeb, 0xac, 0x4e, 
+0x23, 0x2f, 0xd7, 0xe6, 0x79, 0x73, 0x1f, 0x3d, 0x2e, 0x49, 0xdb, 0xe1, 0x47, 0x4f, 0x6b, 0xac, 
+0xa5, 0x6f, 0xf7, 0xc2, 0x00, 0x44, 0x9e, 0x4d, 0x70, 0x97, 0xb4, 0xef, 0x69, 0x83, 0x82, 0x06, 
+0x33, 0x7b, 0x88, 0x68, 0xdd, 0x4d, 0x43, 0x6b, 0x48, 0x02, 0x18, 0x94, 0x0c, 0x07, 0x8d, 0x1d, 
+0x15, 0x60, 0x62, 0x84, 0x01, 0xe6, 0xe4, 0x16, 0x57, 0xaf, 0xb5, 0x36, 0xc1, 0x19, 0xf3, 0x60, 
+0x20, 0xf2, 0xb8, 0x8d, 0x3b, 0x36, 0xd2, 0x16, 0x96, 0x71, 0xd7, 0xec, 0x22, 0xd6, 0x3b, 0xbb, 
+0x88, 0xbd, 0x1d, 0xbb, 0x38, 0xd7, 0x36, 0x76, 0x71, 0xce, 0x81, 0x3d, 0x06, 0xb1, 0x1e, 0x79, 
+0x3c, 0x4e, 0xc7, 0x8a, 0x17, 0xea, 0x45, 0x0f, 0xd2, 0xbb, 0x7e, 0x1f, 0x13, 0xd4, 0x39, 0x91, 
+0xe4, 0x86, 0xdc, 0x69, 0x75, 0xd4, 0xb3, 0x6c, 0x4d, 0xb7, 0x34, 0x0f, 0x7a, 0x7a, 0xbd, 0x5b, 
+0xda, 0x6f, 0x59, 0x05, 0x8e, 0xf5, 0xaf, 0xba, 0x79, 0x0a, 0x8b, 0xbf, 0x83, 0x22, 0x6a, 0x55, 
+0x5a, 0x08, 0xd5, 0xce, 0x27, 0x92, 0xea, 0x58, 0x25, 0x29, 0x32, 0x6e, 0x38, 0x65, 0x6f, 0x1b, 
+0xcf, 0x5c, 0x6e, 0x1b, 0xaf, 0x9c, 0x0c, 0x0b, 0x2a, 0x58, 0x2d, 0xe1, 0xcc, 0x91, 0x14, 0xc7, 
+0x32, 0x8a, 0xde, 0xf6, 0xa8, 0xcd, 0xa5, 0x7e, 0x9c, 0xf4, 0x57, 0xe1, 0x11, 0xaa, 0xa5, 0xba, 
+0x14, 0x0e, 0xba, 0x09, 0x6a, 0xa5, 0xe5, 0x49, 0x82, 0x11, 0xaf, 0x1f, 0xcf, 0x8b, 0xa6, 0xa7, 
+0xec, 0xb6, 0x66, 0x43, 0x64, 0x03, 0xb8, 0x7b, 0xdc, 0x2a, 0x71, 0x57, 0x4d, 0xa5, 0xe5, 0xd2, 
+0x9d, 0x84, 0x39, 0x6d, 0x3d, 0xc2, 0x99, 0x95, 0x88, 0x93, 0xbb, 0x2b, 0xf4, 0xc4, 0x36, 0xed, 
+0xd6, 0x25, 0xb0, 0xd7, 0x17, 0x7e, 0xcc, 0x11, 0x41, 0x4f, 0x04, 0x05, 0x36, 0x2b, 0x8e, 0xca, 
+0x4f, 0x8e, 0x55, 0xea, 0xac, 0xff, 0xa4, 0x2b, 0x61, 0xab, 0xe7, 0xc8, 0x54, 0xf1, 0x72, 0xb2, 
+0xfb, 0xda, 0xb4, 0x93, 0xb5, 0xa7, 0xc6, 0xd2, 0xe8, 0x88, 0x3c, 0xc3, 0x5c, 0x9e, 0x48, 0xd9, 
+0xda, 0x0b, 0x21, 0xa0, 0x9d, 0xcc, 0x1f, 0x1f, 0xab, 0xd5, 0x37, 0x65, 0x9e, 0xad, 0x8b, 0x9e, 
+0x75, 0x72, 0x69, 0xda, 0x9e, 0x61, 0x7b, 0x51, 0x17, 0x0f, 0x71, 0x52, 0xd5, 0xf4, 0xab, 0xcf, 
+0x1d, 0x9e, 0x5a, 0x36, 0x6d, 0xc3, 0xcb, 0x67, 0x9c, 0xb4, 0x35, 0xf2, 0x58, 0xea, 0x11, 0x9c, 
+0xc5, 0x8d, 0x48, 0x19, 0x9e, 0x37, 0x44, 0xf9, 0x72, 0xba, 0xe5, 0xf4, 0xca, 0x9e, 0x00, 0x44, 
+0x9a, 0x92, 0x8f, 0x53, 0x49, 0xea, 0x24, 0x39, 0x95, 0x24, 0xd7, 0x3a, 0x65, 0xbc, 0xee, 0x39, 
+0x99, 0xb0, 0x09, 0x0c, 0x04, 0xc7, 0xe8, 0xd9, 0xfe, 0xb5, 0x76, 0x31, 0xcd, 0xb6, 0xec, 0xd6, 
+0x6a, 0x6d, 0x34, 0x78, 0xaa, 0x8a, 0x06, 0x03, 0xfe, 0x2e, 0x99, 0x01, 0xc6, 0x30, 0x7b, 0xd8, 
+0xa6, 0x60, 0xf3, 0x04, 0x2b, 0x10, 0x3c, 0x32, 0xdd, 0xfa, 0x0d, 0xfb, 0xdf, 0x37, 0xec, 0x7f, 
+0xdf, 0xb0, 0xff, 0x7d, 0x83, 0xff, 0xf3, 0xee, 0x67, 0xbd, 0x28, 0xcc, 0xc4, 0xe5, 0xfb, 0x2b, 
+0x18, 0x28, 0xbc, 0x49, 0xfe, 0xd6, 0x7e, 0x92, 0x22, 0xf1, 0x65, 0xac, 0xb4, 0x2b, 0x59, 0xb0, 
+0x4d, 0x79, 0x82, 0x66, 0xca, 0x13, 0xb4, 0xdc, 0x59, 0x9e, 0x20, 0x6b, 0x37, 0xb8, 0x49, 0x13, 
+0x44, 0x43, 0x08, 0x1c, 0x69, 0x82, 0x82, 0x74, 0xf0, 0x80, 0x4b, 0x65, 0x99, 0x7b, 0x93, 0x28, 
+0xc8, 0x93, 0xc2, 0x78, 0x32, 0x13, 0x4f, 0x63, 0x6a, 0xe5, 0x84, 0x43, 0x3b, 0x33, 0x9c, 0xed, 
+0x09, 0x45, 0xbb, 0xa6, 0x6c, 0x7d, 0x4b, 0x02, 0x13, 0x3d, 0x6c, 0xa0, 0x64, 0x29, 0xdb, 0x01, 
+0xd7, 0x68, 0xb1, 0xc9, 0x15, 0x95, 0xaa, 0x96, 0xc1, 0xf4, 0x8a, 0xef, 0x94, 0xe5, 0xd3, 0x37, 
+0xcf, 0xaa, 0xb0, 0xaf, 0x18, 0xb9, 0x65, 0x6c, 0xa5, 0xe9, 0x15, 0x57, 0xdb, 0xdb, 0xd5, 0x3e, 
+0x27, 0x4b, 0xbc, 0xa4, 0xc5, 0x12, 0x5f, 0xda, 0x86, 0xdd, 0x27, 0x77, 0x9f, 0xc9, 0xd6, 0xda, 
+0x19, 0x8c, 0xc0, 0x9d, 0x39, 0x1d, 0xc1, 0x4a, 0x48, 0x3a, 0xa9, 0xda, 0xe5, 0xe9, 0x22, 0x0a, 
+0x6c, 0xdc, 0xee, 0x00, 0xf6, 0xc8, 0x61, 0x8b, 0x02, 0x95, 0x15, 0xff, 0xf6, 0x0f, 0xdf, 0xdb, 
+0xfc, 0xaf, 0x1d, 0x00, 0xff, 0x0f };
+
+static const Bit8u layout_keybrd2sys_index[285] = {
 0x4b, 0x43, 0x46, 0x00, 0x01, 0x01, 0x2e, 0x48, 0x65, 0x6e, 0x72, 0x69, 0x71, 0x75, 0x65, 0x20, 
 0x50, 0x65, 0x72, 0x6f, 0x6e, 0xff, 0x44, 0x4f, 0x53, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x70, 0x61, 
 0x67, 0x65, 0x73, 0x20, 0x2d, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x23, 0x32, 
-0x20, 0x6f, 0x66, 0x20, 0x33, 0xaa, 0x02, 0x09, 0x00, 0x00, 0x42, 0x47, 0x2c, 0xba, 0x01, 0x42, 
-0x47, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x03, 0x99, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x68, 0x03, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x97, 
-0x02, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0xae, 0x01, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xa7, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x00, 0x40, 0x04, 0x02, 0x03, 0x00, 0x00, 
-0x23, 0x05, 0x02, 0x03, 0x00, 0x00, 0xcf, 0x07, 0x02, 0x03, 0x00, 0x00, 0x5e, 0x08, 0x02, 0x03, 
-0x00, 0x00, 0x26, 0x09, 0x02, 0x03, 0x00, 0x00, 0x24, 0x1a, 0x02, 0x03, 0x00, 0x00, 0x5b, 0x1b, 
-0x02, 0x03, 0x00, 0x00, 0x5d, 0x2b, 0x02, 0x03, 0x00, 0x00, 0x7c, 0x33, 0x02, 0x03, 0x00, 0x00, 
-0x3c, 0x34, 0x02, 0x03, 0x00, 0x00, 0x3e, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x03, 
-0x01, 0x01, 0x00, 0x3f, 0x04, 0x01, 0x01, 0x00, 0x2b, 0x05, 0x02, 0x05, 0x00, 0x22, 0xa0, 0x07, 
-0x01, 0x01, 0x00, 0x3d, 0x08, 0x01, 0x01, 0x00, 0x3a, 0x09, 0x01, 0x01, 0x00, 0x2f, 0x0a, 0x03, 
-0x05, 0x00, 0x5f, 0x00, 0x1f, 0x0b, 0x01, 0x01, 0x00, 0xef, 0x0c, 0x01, 0x01, 0x00, 0x49, 0x0d, 
-0x01, 0x00, 0x2e, 0x56, 0x10, 0x01, 0x00, 0x2c, 0xf2, 0x11, 0x41, 0x00, 0xe7, 0xe8, 0x12, 0x42, 
-0x00, 0xa8, 0xa9, 0xcf, 0x13, 0x41, 0x00, 0xb7, 0xb8, 0x14, 0x41, 0x00, 0xf5, 0xf6, 0x15, 0x41, 
-0x00, 0xf9, 0xfa, 0x16, 0x41, 0x00, 0xc6, 0xc7, 0x17, 0x41, 0x00, 0xe3, 0xe4, 0x18, 0x41, 0x00, 
-0xa6, 0xa7, 0x19, 0x41, 0x00, 0xf3, 0xf4, 0x1a, 0x41, 0x00, 0xa4, 0xa5, 0x1b, 0x01, 0x00, 0x3b, 
-0xfd, 0x1e, 0x41, 0x00, 0xed, 0xee, 0x1f, 0xc1, 0x00, 0xde, 0x1f, 0xe0, 0x00, 0x20, 0x41, 0x00, 
-0xa0, 0xa1, 0x21, 0x41, 0x00, 0xd6, 0xd7, 0x22, 0x41, 0x00, 0xe9, 0xea, 0x23, 0x41, 0x00, 0xac, 
-0xad, 0x24, 0x41, 0x00, 0xe5, 0xe6, 0x25, 0x41, 0x00, 0xd4, 0xd5, 0x26, 0x41, 0x00, 0xeb, 0xec, 
-0x27, 0x41, 0x00, 0xd2, 0xd3, 0x28, 0x41, 0x00, 0xfb, 0xfc, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x78, 0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 0x41, 0x00, 0x9c, 0x9d, 0x2d, 0x41, 0x00, 0xbd, 
-0xbe, 0x2e, 0x41, 0x00, 0x9e, 0x9f, 0x2f, 0x41, 0x00, 0xf7, 0xf8, 0x30, 0x41, 0x00, 0xaa, 0xab, 
-0x31, 0x41, 0x00, 0xb5, 0xb6, 0x32, 0x41, 0x00, 0xd8, 0xdd, 0x33, 0x41, 0x00, 0xe1, 0xe2, 0x34, 
-0x41, 0x00, 0xd0, 0xd1, 0x35, 0x41, 0x00, 0xa2, 0xa3, 0x00, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x12, 0x42, 0x03, 0x00, 0x00, 0xcf, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x03, 
-0x01, 0x01, 0x00, 0x3f, 0x04, 0x01, 0x01, 0x00, 0x2b, 0x05, 0x01, 0x01, 0x00, 0x22, 0x07, 0x01, 
-0x01, 0x00, 0x3d, 0x08, 0x01, 0x01, 0x00, 0x3a, 0x09, 0x01, 0x01, 0x00, 0x2f, 0x0a, 0x03, 0x05, 
-0x00, 0x5f, 0x00, 0x1f, 0x0b, 0x01, 0x01, 0x00, 0xef, 0x0c, 0x01, 0x01, 0x00, 0x49, 0x0d, 0x01, 
-0x00, 0x2e, 0x56, 0x10, 0x01, 0x00, 0x2c, 0xf2, 0x11, 0x41, 0x00, 0xe7, 0xe8, 0x12, 0x41, 0x00, 
-0xa8, 0xa9, 0x13, 0x41, 0x00, 0xb7, 0xb8, 0x14, 0x41, 0x00, 0xf5, 0xf6, 0x15, 0x41, 0x00, 0xf9, 
-0xfa, 0x16, 0x41, 0x00, 0xc6, 0xc7, 0x17, 0x41, 0x00, 0xe3, 0xe4, 0x18, 0x41, 0x00, 0xa6, 0xa7, 
-0x19, 0x41, 0x00, 0xf3, 0xf4, 0x1a, 0x41, 0x00, 0xa4, 0xa5, 0x1b, 0x01, 0x00, 0x3b, 0xfd, 0x1e, 
-0x41, 0x00, 0xed, 0xee, 0x1f, 0xc1, 0x00, 0xde, 0x1f, 0xe0, 0x00, 0x20, 0x41, 0x00, 0xa0, 0xa1, 
-0x21, 0x41, 0x00, 0xd6, 0xd7, 0x22, 0x41, 0x00, 0xe9, 0xea, 0x23, 0x41, 0x00, 0xac, 0xad, 0x24, 
-0x41, 0x00, 0xe5, 0xe6, 0x25, 0x41, 0x00, 0xd4, 0xd5, 0x26, 0x41, 0x00, 0xeb, 0xec, 0x27, 0x41, 
-0x00, 0xd2, 0xd3, 0x28, 0x41, 0x00, 0xfb, 0xfc, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 
-0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 0x41, 0x00, 0x9c, 0x9d, 0x2d, 0x41, 0x00, 0xbd, 0xbe, 0x2e, 
-0x41, 0x00, 0x9e, 0x9f, 0x2f, 0x41, 0x00, 0xf7, 0xf8, 0x30, 0x41, 0x00, 0xaa, 0xab, 0x31, 0x41, 
-0x00, 0xb5, 0xb6, 0x32, 0x41, 0x00, 0xd8, 0xdd, 0x33, 0x41, 0x00, 0xe1, 0xe2, 0x34, 0x41, 0x00, 
-0xd0, 0xd1, 0x35, 0x41, 0x00, 0xa2, 0xa3, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 
-0x00, 0x24, 0x72, 0x06, 0x04, 0xf1, 0x00, 0x42, 0x47, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0c, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x03, 0x61, 0x04, 0x00, 0x00, 0x00, 0x00, 0x68, 0x03, 0x78, 
-0x02, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x63, 0x06, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x7e, 
-0x04, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
-0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x21, 0x31, 0x03, 0x01, 0x00, 0x22, 0x32, 0x04, 
-0x01, 0x00, 0x23, 0x33, 0x05, 0x01, 0x00, 0xcf, 0x34, 0x06, 0x01, 0x00, 0x25, 0x35, 0x07, 0x01, 
-0x00, 0x26, 0x36, 0x08, 0x01, 0x00, 0x27, 0x37, 0x09, 0x01, 0x00, 0x28, 0x38, 0x0a, 0x01, 0x00, 
-0x29, 0x39, 0x0b, 0x01, 0x00, 0x24, 0x30, 0x0c, 0x01, 0x00, 0x3d, 0x2d, 0x0d, 0x02, 0x00, 0x5f, 
-0x5f, 0x1f, 0x10, 0xc5, 0x00, 0x6a, 0x24, 0x4a, 0x24, 0x0a, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 
-0x24, 0x11, 0xc5, 0x00, 0x63, 0x2e, 0x43, 0x2e, 0x03, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 
-0x12, 0xc5, 0x00, 0x75, 0x16, 0x55, 0x16, 0x15, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x13, 
-0xc5, 0x00, 0x6b, 0x25, 0x4b, 0x25, 0x0b, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x14, 0xc5, 
-0x00, 0x65, 0x12, 0x45, 0x12, 0x05, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x15, 0xc5, 0x00, 
-0x6e, 0x31, 0x4e, 0x31, 0x0e, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x16, 0xc5, 0x00, 0x67, 
-0x22, 0x47, 0x22, 0x07, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x17, 0x02, 0x00, 0x5b, 0x5b, 
-0x1b, 0x18, 0x02, 0x00, 0x5d, 0x5d, 0x1d, 0x19, 0xc5, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x1a, 0x2c, 
-0x00, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x1a, 0xc5, 0x00, 0x68, 0x23, 0x48, 0x23, 0x08, 0x23, 0x00, 
-0x23, 0x00, 0x23, 0x00, 0x23, 0x1b, 0x04, 0x04, 0x7d, 0x7b, 0x00, 0x2a, 0x3a, 0x1e, 0xc5, 0x00, 
-0x66, 0x21, 0x46, 0x21, 0x06, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x1f, 0xc5, 0x00, 0x79, 
-0x15, 0x59, 0x15, 0x19, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x20, 0xc5, 0x00, 0x77, 0x11, 
-0x57, 0x11, 0x17, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x21, 0xc5, 0x00, 0x61, 0x1e, 0x41, 
-0x1e, 0x01, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x22, 0xc5, 0x00, 0x70, 0x19, 0x50, 0x19, 
-0x10, 0x19, 0x00, 0x19, 0x00, 0x19, 0x00, 0x19, 0x23, 0xc5, 0x00, 0x72, 0x13, 0x52, 0x13, 0x12, 
-0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x24, 0xc5, 0x00, 0x6f, 0x18, 0x4f, 0x18, 0x0f, 0x18, 
-0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x25, 0xc5, 0x00, 0x6c, 0x26, 0x4c, 0x26, 0x0c, 0x26, 0x00, 
-0x26, 0x00, 0x26, 0x00, 0x26, 0x26, 0xc5, 0x00, 0x64, 0x20, 0x44, 0x20, 0x04, 0x20, 0x00, 0x20, 
-0x00, 0x20, 0x00, 0x20, 0x27, 0xc5, 0x00, 0x76, 0x2f, 0x56, 0x2f, 0x16, 0x2f, 0x00, 0x2f, 0x00, 
-0x2f, 0x00, 0x2f, 0x28, 0x02, 0x00, 0x5c, 0x7c, 0x1c, 0x29, 0x01, 0x00, 0x2b, 0x3b, 0x2b, 0x01, 
-0x00, 0x3e, 0x2e, 0x2c, 0x02, 0x00, 0x40, 0x5e, 0x1e, 0x2d, 0xc5, 0x00, 0x73, 0x1f, 0x53, 0x1f, 
-0x13, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x2e, 0xc5, 0x00, 0x6d, 0x32, 0x4d, 0x32, 0x0d, 
-0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x2f, 0xc5, 0x00, 0x69, 0x17, 0x49, 0x17, 0x09, 0x17, 
-0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x30, 0xc5, 0x00, 0x74, 0x14, 0x54, 0x14, 0x14, 0x14, 0x00, 
-0x14, 0x00, 0x14, 0x00, 0x14, 0x31, 0xc5, 0x00, 0x78, 0x2d, 0x58, 0x2d, 0x18, 0x2d, 0x00, 0x2d, 
-0x00, 0x2d, 0x00, 0x2d, 0x32, 0xc5, 0x00, 0x62, 0x30, 0x42, 0x30, 0x02, 0x30, 0x00, 0x30, 0x00, 
-0x30, 0x00, 0x30, 0x33, 0x10, 0x00, 0x00, 0x34, 0x01, 0x00, 0x3c, 0x2c, 0x35, 0x01, 0x00, 0x3f, 
-0x2f, 0x56, 0xc5, 0x00, 0x71, 0x10, 0x51, 0x10, 0x11, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 
-0x00, 0x14, 0xc5, 0x00, 0x65, 0x12, 0x45, 0x12, 0x05, 0x12, 0xd5, 0x12, 0x00, 0x12, 0x00, 0x12, 
-0x00, 0x05, 0x00, 0x01, 0xa0, 0x0d, 0x43, 0x04, 0x9e, 0x9f, 0x00, 0x5f, 0x10, 0xc5, 0x00, 0xbd, 
-0x24, 0xbe, 0x24, 0x0a, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x11, 0xc5, 0x00, 0xa4, 0x2e, 
-0xa5, 0x2e, 0x03, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x12, 0xc5, 0x00, 0xe7, 0x16, 0xe8, 
-0x16, 0x15, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x13, 0xc5, 0x00, 0xc6, 0x25, 0xc7, 0x25, 
-0x0b, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x14, 0xc5, 0x00, 0xa8, 0x12, 0xa9, 0x12, 0x05, 
-0x12, 0xcf, 0x12, 0x00, 0x12, 0x00, 0x12, 0x15, 0xc5, 0x00, 0xd4, 0x31, 0xd5, 0x31, 0x0e, 0x31, 
-0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x16, 0xc5, 0x00, 0xac, 0x22, 0xad, 0x22, 0x07, 0x22, 0x00, 
-0x22, 0x00, 0x22, 0x00, 0x22, 0x17, 0x43, 0x04, 0xf5, 0xf6, 0x00, 0x5b, 0x18, 0x43, 0x04, 0xf9, 
-0xfa, 0x00, 0x5d, 0x19, 0xc5, 0x00, 0xf3, 0x2c, 0xf4, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 
-0x00, 0x2c, 0x1a, 0xc5, 0x00, 0xb5, 0x23, 0xb6, 0x23, 0x08, 0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 
-0x23, 0x1b, 0x04, 0x04, 0x2a, 0x3a, 0x00, 0x7d, 0x7b, 0x1e, 0xc5, 0x00, 0xaa, 0x21, 0xab, 0x21, 
-0x06, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x1f, 0xc5, 0x00, 0xf1, 0x15, 0xf2, 0x15, 0x19, 
-0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x20, 0xc5, 0x00, 0xeb, 0x11, 0xec, 0x11, 0x17, 0x11, 
-0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x21, 0xc5, 0x00, 0xa0, 0x1e, 0xa1, 0x1e, 0x01, 0x1e, 0x00, 
-0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x22, 0xc5, 0x00, 0xd8, 0x19, 0xdd, 0x19, 0x10, 0x19, 0x00, 0x19, 
-0x00, 0x19, 0x00, 0x19, 0x23, 0xc5, 0x00, 0xe1, 0x13, 0xe2, 0x13, 0x12, 0x13, 0x00, 0x13, 0x00, 
-0x13, 0x00, 0x13, 0x24, 0xc5, 0x00, 0xd6, 0x18, 0xd7, 0x18, 0x0f, 0x18, 0x00, 0x18, 0x00, 0x18, 
-0x00, 0x18, 0x25, 0xc5, 0x00, 0xd0, 0x26, 0xd1, 0x26, 0x0c, 0x26, 0x00, 0x26, 0x00, 0x26, 0x00, 
-0x26, 0x26, 0xc5, 0x00, 0xa6, 0x20, 0xa7, 0x20, 0x04, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 
-0x27, 0xc5, 0x00, 0xe9, 0x2f, 0xea, 0x2f, 0x16, 0x2f, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x2f, 0x28, 
-0x44, 0x04, 0xf7, 0xf8, 0x00, 0x5c, 0x7c, 0x29, 0x04, 0x07, 0x00, 0x00, 0x00, 0x98, 0x99, 0x2a, 
-0x05, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 0x04, 0x07, 0x00, 0x00, 0x00, 0x84, 0x85, 
-0x2c, 0x44, 0x04, 0xfb, 0xfc, 0x00, 0x40, 0x5e, 0x2d, 0xc5, 0x00, 0xe3, 0x1f, 0xe4, 0x1f, 0x13, 
-0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x2e, 0xc5, 0x00, 0xd2, 0x32, 0xd3, 0x32, 0x0d, 0x32, 
-0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x2f, 0xc5, 0x00, 0xb7, 0x17, 0xb8, 0x17, 0x09, 0x17, 0x00, 
-0x17, 0x00, 0x17, 0x00, 0x17, 0x30, 0xc5, 0x00, 0xe5, 0x14, 0xe6, 0x14, 0x14, 0x14, 0x00, 0x14, 
-0x00, 0x14, 0x00, 0x14, 0x31, 0xc5, 0x00, 0xed, 0x2d, 0xee, 0x2d, 0x18, 0x2d, 0x00, 0x2d, 0x00, 
-0x2d, 0x00, 0x2d, 0x32, 0xc5, 0x00, 0xa2, 0x30, 0xa3, 0x30, 0x02, 0x30, 0x00, 0x30, 0x00, 0x30, 
-0x00, 0x30, 0x33, 0x44, 0x04, 0x9c, 0x9d, 0x00, 0x86, 0x87, 0x34, 0x04, 0x07, 0x00, 0x00, 0x00, 
-0x8a, 0x8b, 0x35, 0x04, 0x07, 0x00, 0x00, 0x00, 0x8c, 0x8d, 0x56, 0xc5, 0x00, 0xde, 0x10, 0xe0, 
-0x00, 0x11, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x05, 0x00, 0x01, 0xa0, 0x14, 0xc5, 
-0x00, 0x65, 0x12, 0x45, 0x12, 0x05, 0x12, 0xcf, 0x12, 0x00, 0x12, 0x00, 0x12, 0x36, 0x05, 0x3f, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x0d, 0x43, 0x04, 0x9e, 0x9f, 0x00, 0x5f, 0x10, 0xc5, 
-0x00, 0xbd, 0x24, 0xbe, 0x24, 0x0a, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x11, 0xc5, 0x00, 
-0xa4, 0x2e, 0xa5, 0x2e, 0x03, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x2e, 0x12, 0xc5, 0x00, 0xe7, 
-0x16, 0xe8, 0x16, 0x15, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x13, 0xc5, 0x00, 0xc6, 0x25, 
-0xc7, 0x25, 0x0b, 0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x14, 0xc5, 0x00, 0xa8, 0x12, 0xa9, 
-0x12, 0x05, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x15, 0xc5, 0x00, 0xd4, 0x31, 0xd5, 0x31, 
-0x0e, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x16, 0xc5, 0x00, 0xac, 0x22, 0xad, 0x22, 0x07, 
-0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x17, 0x43, 0x04, 0xf5, 0xf6, 0x00, 0x5b, 0x18, 0x43, 
-0x04, 0xf9, 0xfa, 0x00, 0x5d, 0x19, 0xc5, 0x00, 0xf3, 0x2c, 0xf4, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 
-0x00, 0x2c, 0x00, 0x2c, 0x1a, 0xc5, 0x00, 0xb5, 0x23, 0xb6, 0x23, 0x08, 0x23, 0x00, 0x23, 0x00, 
-0x23, 0x00, 0x23, 0x1b, 0x04, 0x04, 0x2a, 0x3a, 0x00, 0x7d, 0x7b, 0x1e, 0xc5, 0x00, 0xaa, 0x21, 
-0xab, 0x21, 0x06, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x1f, 0xc5, 0x00, 0xf1, 0x15, 0xf2, 
-0x15, 0x19, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x20, 0xc5, 0x00, 0xeb, 0x11, 0xec, 0x11, 
-0x17, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x21, 0xc5, 0x00, 0xa0, 0x1e, 0xa1, 0x1e, 0x01, 
-0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x22, 0xc5, 0x00, 0xd8, 0x19, 0xdd, 0x19, 0x10, 0x19, 
-0x00, 0x19, 0x00, 0x19, 0x00, 0x19, 0x23, 0xc5, 0x00, 0xe1, 0x13, 0xe2, 0x13, 0x12, 0x13, 0x00, 
-0x13, 0x00, 0x13, 0x00, 0x13, 0x24, 0xc5, 0x00, 0xd6, 0x18, 0xd7, 0x18, 0x0f, 0x18, 0x00, 0x18, 
-0x00, 0x18, 0x00, 0x18, 0x25, 0xc5, 0x00, 0xd0, 0x26, 0xd1, 0x26, 0x0c, 0x26, 0x00, 0x26, 0x00, 
-0x26, 0x00, 0x26, 0x26, 0xc5, 0x00, 0xa6, 0x20, 0xa7, 0x20, 0x04, 0x20, 0x00, 0x20, 0x00, 0x20, 
-0x00, 0x20, 0x27, 0xc5, 0x00, 0xe9, 0x2f, 0xea, 0x2f, 0x16, 0x2f, 0x00, 0x2f, 0x00, 0x2f, 0x00, 
-0x2f, 0x28, 0x44, 0x04, 0xf7, 0xf8, 0x00, 0x5c, 0x7c, 0x29, 0x04, 0x07, 0x00, 0x00, 0x00, 0x98, 
-0x99, 0x2a, 0x05, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x2b, 0x04, 0x07, 0x00, 0x00, 0x00, 
-0x84, 0x85, 0x2c, 0x44, 0x04, 0xfb, 0xfc, 0x00, 0x40, 0x5e, 0x2d, 0xc5, 0x00, 0xe3, 0x1f, 0xe4, 
-0x1f, 0x13, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x2e, 0xc5, 0x00, 0xd2, 0x32, 0xd3, 0x32, 
-0x0d, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x2f, 0xc5, 0x00, 0xb7, 0x17, 0xb8, 0x17, 0x09, 
-0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x30, 0xc5, 0x00, 0xe5, 0x14, 0xe6, 0x14, 0x14, 0x14, 
-0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x31, 0xc5, 0x00, 0xed, 0x2d, 0xee, 0x2d, 0x18, 0x2d, 0x00, 
-0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x32, 0xc5, 0x00, 0xa2, 0x30, 0xa3, 0x30, 0x02, 0x30, 0x00, 0x30, 
-0x00, 0x30, 0x00, 0x30, 0x33, 0x44, 0x04, 0x9c, 0x9d, 0x00, 0x86, 0x87, 0x34, 0x04, 0x07, 0x00, 
-0x00, 0x00, 0x8a, 0x8b, 0x35, 0x04, 0x07, 0x00, 0x00, 0x00, 0x8c, 0x8d, 0x56, 0xc5, 0x00, 0xde, 
-0x10, 0xe0, 0x00, 0x11, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x36, 0x05, 0x3f, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x12, 0xe7, 0x02, 0x09, 0x00, 0x00, 0x43, 0x45, 0x2c, 0xb9, 
-0x01, 0x43, 0x45, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 
-0x75, 0x72, 0x01, 0xe2, 0x01, 0x00, 0x00, 0x43, 0x75, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 
-0x75, 0xce, 0x02, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x75, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x00, 0x40, 0x04, 0x02, 0x03, 
-0x00, 0x00, 0x23, 0x07, 0x02, 0x03, 0x00, 0x00, 0x5e, 0x08, 0x02, 0x03, 0x00, 0x00, 0x26, 0x09, 
-0x02, 0x03, 0x00, 0x00, 0x24, 0x0d, 0x02, 0x03, 0x00, 0x00, 0x3d, 0x1a, 0x02, 0x03, 0x00, 0x00, 
-0x5b, 0x1b, 0x02, 0x03, 0x00, 0x00, 0x5d, 0x2b, 0x02, 0x03, 0x00, 0x00, 0x7c, 0x33, 0x02, 0x03, 
-0x00, 0x00, 0x3c, 0x34, 0x02, 0x03, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 
-0x01, 0x01, 0x00, 0xfc, 0x05, 0x01, 0x01, 0x00, 0x3b, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 
-0x01, 0x00, 0x3f, 0x0d, 0x01, 0x00, 0xfe, 0x2b, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 
-0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x42, 0x00, 0xa5, 
-0x85, 0xfd, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 
-0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 
-0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xeb, 0x9b, 0x20, 
-0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 
-0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 
-0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0xc1, 
-0x00, 0xf1, 0x29, 0xf0, 0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 0x01, 0x01, 
-0x00, 0x2f, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 
-0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 
-0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 
-0x01, 0x00, 0x2e, 0x2c, 0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 0xfd, 0x10, 0x43, 0x03, 0x00, 0x00, 
-0xd6, 0xd5, 0x12, 0x43, 0x03, 0x00, 0x00, 0xbe, 0xbd, 0x16, 0x41, 0x00, 0x75, 0x55, 0x18, 0x43, 
-0x00, 0x6f, 0x4f, 0xde, 0xdd, 0x1a, 0x43, 0x00, 0xf9, 0xf8, 0x5b, 0x7b, 0x1b, 0x43, 0x00, 0xd2, 
-0xd1, 0x5d, 0x7d, 0x1e, 0x43, 0x00, 0x61, 0x41, 0xc7, 0xc6, 0x1f, 0x43, 0x03, 0x00, 0x00, 0xfb, 
-0xfa, 0x22, 0x43, 0x03, 0x00, 0x00, 0xb6, 0xb5, 0x29, 0x00, 0x01, 0xc8, 0x2c, 0x43, 0x03, 0x00, 
-0x00, 0xd8, 0xd7, 0x2d, 0x43, 0x03, 0x00, 0x00, 0xd4, 0xd3, 0x2e, 0x43, 0x03, 0x00, 0x00, 0xd0, 
-0xcf, 0x31, 0x43, 0x03, 0x00, 0x00, 0xb8, 0xb7, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 
-0x39, 0x00, 0x00, 0x20, 0x00, 0x60, 0x07, 0x61, 0xf3, 0x6f, 0xf5, 0x75, 0xf7, 0x41, 0xf2, 0x4f, 
-0xf4, 0x55, 0xf6, 0x20, 0x60, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0xfc, 
-0x05, 0x01, 0x01, 0x00, 0x3b, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x0d, 
-0x01, 0x00, 0xfe, 0x2b, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 
-0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x15, 0x41, 
-0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 
-0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xea, 
-0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 
-0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 
-0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 
-0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 
-0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 0x41, 
-0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 
-0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 
-0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 0x00, 0x2e, 0x2c, 
-0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 
-0xc2, 0x19, 0x03, 0x04, 0xbb, 0x01, 0x43, 0x45, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x43, 0x75, 0x8a, 0x01, 0xfa, 0x01, 0x00, 0x00, 0x43, 0x75, 0x91, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x3b, 0x75, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x75, 0x0b, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 
-0x00, 0x40, 0x04, 0x02, 0x03, 0x00, 0x00, 0x23, 0x05, 0x02, 0x03, 0x00, 0x00, 0x24, 0x07, 0x02, 
-0x03, 0x00, 0x00, 0x5e, 0x08, 0x02, 0x03, 0x00, 0x00, 0x26, 0x09, 0x02, 0x03, 0x00, 0x00, 0x2a, 
-0x1a, 0x02, 0x03, 0x00, 0x00, 0x5b, 0x1b, 0x02, 0x03, 0x00, 0x00, 0x5d, 0x33, 0x02, 0x03, 0x00, 
-0x00, 0x3c, 0x34, 0x02, 0x03, 0x00, 0x00, 0x3e, 0x00, 0x02, 0x01, 0x00, 0xfc, 0x31, 0x03, 0x01, 
-0x00, 0x2d, 0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 0x01, 0x00, 0x22, 0x34, 0x06, 0x01, 0x00, 
-0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 
-0x38, 0x0a, 0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 0x00, 0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 
-0x0d, 0x01, 0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 
-0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x15, 
-0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 
-0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 
-0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 
-0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 
-0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 
-0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0x01, 0x00, 0x7c, 0x2b, 
-0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 0x41, 0x00, 
-0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 
-0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 
-0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0xc1, 0x00, 0xf1, 0x35, 0xf0, 
-0x00, 0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 0xfd, 0x10, 0x43, 0x03, 0x00, 0x00, 0xd6, 0xd5, 0x12, 
-0x43, 0x03, 0x00, 0x00, 0xbe, 0xbd, 0x16, 0x41, 0x00, 0x75, 0x55, 0x18, 0x43, 0x00, 0x6f, 0x4f, 
-0xde, 0xdd, 0x1a, 0x43, 0x00, 0xf9, 0xf8, 0x5b, 0x7b, 0x1b, 0x43, 0x00, 0xd2, 0xd1, 0x5d, 0x7d, 
-0x1e, 0x43, 0x00, 0x61, 0x41, 0xc7, 0xc6, 0x1f, 0x43, 0x03, 0x00, 0x00, 0xfb, 0xfa, 0x22, 0x43, 
-0x03, 0x00, 0x00, 0xb6, 0xb5, 0x29, 0x00, 0x01, 0xc8, 0x2c, 0x43, 0x03, 0x00, 0x00, 0xd8, 0xd7, 
-0x2d, 0x43, 0x03, 0x00, 0x00, 0xd4, 0xd3, 0x2e, 0x43, 0x03, 0x00, 0x00, 0xd0, 0xcf, 0x31, 0x43, 
-0x03, 0x00, 0x00, 0xb8, 0xb7, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x39, 0x00, 0x00, 
-0x20, 0x00, 0x60, 0x07, 0x61, 0xf3, 0x6f, 0xf5, 0x75, 0xf7, 0x41, 0xf2, 0x4f, 0xf4, 0x55, 0xf6, 
-0x20, 0x60, 0x00, 0x02, 0x01, 0x00, 0xfc, 0x31, 0x03, 0x01, 0x00, 0x2d, 0x32, 0x04, 0x01, 0x00, 
-0x2f, 0x33, 0x05, 0x01, 0x00, 0x22, 0x34, 0x06, 0x01, 0x00, 0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 
-0x36, 0x08, 0x01, 0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 0x38, 0x0a, 0x01, 0x00, 0x3f, 0x39, 
-0x0b, 0x01, 0x00, 0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 0x0d, 0x01, 0x00, 0x3b, 0x5c, 0x10, 
-0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 
-0x00, 0xaa, 0x8a, 0x14, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 
-0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 
-0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 
-0x94, 0x1f, 0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 
-0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 
-0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 
-0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0x02, 0x00, 0xfe, 0x2b, 0x7c, 0x2a, 0x04, 0x1f, 0x00, 0x00, 
-0x00, 0x00, 0x7a, 0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 
-0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 
-0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 
-0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0xc1, 0x00, 0xf1, 0x35, 0xf0, 0x00, 0x00, 0x12, 0x42, 0x03, 
-0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0xc8, 0x58, 0x04, 0x13, 
-0x00, 0x00, 0x47, 0x4b, 0x2c, 0x00, 0x00, 0x45, 0x4c, 0x2c, 0x3f, 0x01, 0x47, 0x4b, 0x2c, 0x3f, 
-0x01, 0x45, 0x4c, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 
-0x03, 0x3a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x65, 0x03, 0x79, 0x01, 0x49, 0x02, 0x00, 0x00, 0xe1, 
-0x02, 0x24, 0x03, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x02, 0x7e, 0x02, 0x2d, 0x03, 0x00, 0x00, 0x53, 
-0x03, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x53, 0x03, 0x5a, 0x03, 0x13, 0x04, 0x00, 0x00, 0x5a, 
-0x03, 0xf7, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 
-0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x07, 0x01, 0x01, 0x00, 
-0x26, 0x08, 0x01, 0x01, 0x00, 0x2f, 0x09, 0x01, 0x01, 0x00, 0x28, 0x0a, 0x01, 0x01, 0x00, 0x29, 
-0x0b, 0x01, 0x01, 0x00, 0x3d, 0x0c, 0x01, 0x00, 0x27, 0x3f, 0x0d, 0x01, 0x00, 0x2b, 0x2a, 0x12, 
-0x41, 0x00, 0x65, 0x45, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 
-0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x27, 0x01, 0x03, 
-0xcb, 0xcc, 0x28, 0x01, 0x03, 0xca, 0xc9, 0x29, 0x03, 0x04, 0x5c, 0x7c, 0x00, 0x1c, 0x2b, 0x01, 
-0x01, 0xc8, 0x40, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x33, 0x02, 0x00, 
-0x2c, 0x3b, 0x3c, 0x34, 0x02, 0x00, 0x2e, 0x3a, 0x3e, 0x35, 0x03, 0x04, 0x2d, 0x5f, 0x00, 0x1f, 
-0x39, 0x00, 0x00, 0x20, 0x56, 0x01, 0x00, 0x3c, 0x3e, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 
-0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 
-0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 
-0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 
-0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 
-0x5e, 0xef, 0x0f, 0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 
-0xec, 0x41, 0xb5, 0x43, 0x80, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 
-0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 
-0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0x00, 0x04, 0x01, 0x01, 0x00, 
-0x9c, 0x07, 0x01, 0x01, 0x00, 0x89, 0x0c, 0x01, 0x01, 0x00, 0xf8, 0x10, 0x01, 0x00, 0x88, 0x8e, 
-0x11, 0x01, 0x00, 0xed, 0x8a, 0x12, 0x42, 0x00, 0xde, 0xa8, 0x87, 0x13, 0x41, 0x00, 0xeb, 0xc7, 
-0x14, 0x41, 0x00, 0xee, 0xd0, 0x15, 0x41, 0x00, 0xf2, 0xd1, 0x16, 0x41, 0x00, 0xe2, 0xac, 0x17, 
-0x41, 0x00, 0xe3, 0xad, 0x18, 0x41, 0x00, 0xe9, 0xbe, 0x19, 0x41, 0x00, 0xea, 0xc6, 0x1a, 0x01, 
-0x01, 0x00, 0xae, 0x1b, 0x01, 0x01, 0x00, 0xaf, 0x1e, 0x41, 0x00, 0xd6, 0xa4, 0x1f, 0x41, 0x00, 
-0xec, 0xcf, 0x20, 0x41, 0x00, 0xdd, 0xa7, 0x21, 0x41, 0x00, 0xf3, 0xd2, 0x22, 0x41, 0x00, 0xd8, 
-0xa6, 0x23, 0x41, 0x00, 0xe1, 0xaa, 0x24, 0x41, 0x00, 0xe8, 0xbd, 0x25, 0x41, 0x00, 0xe4, 0xb5, 
-0x26, 0x41, 0x00, 0xe5, 0xb6, 0x27, 0x02, 0x07, 0xc8, 0xc9, 0xca, 0x28, 0x01, 0x00, 0x8c, 0x8b, 
-0x29, 0x01, 0x00, 0xab, 0xf1, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 0x01, 0x00, 
-0x99, 0x9a, 0x2c, 0xc1, 0x00, 0xe0, 0x00, 0xa9, 0x2c, 0x2d, 0x41, 0x00, 0xf4, 0xd3, 0x2e, 0x41, 
-0x00, 0xf6, 0xd4, 0x2f, 0x41, 0x00, 0xfa, 0xd5, 0x30, 0x41, 0x00, 0xd7, 0xa5, 0x31, 0x41, 0x00, 
-0xe7, 0xb8, 0x32, 0x41, 0x00, 0xe6, 0xb7, 0x56, 0x01, 0x00, 0xf5, 0x97, 0x00, 0x12, 0x42, 0x03, 
-0x00, 0x00, 0x87, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0xef, 0x0f, 0xd6, 0x9b, 
-0xde, 0x9d, 0xe1, 0x9e, 0xe3, 0x9f, 0xe9, 0xa2, 0xf2, 0xa3, 0xfa, 0xfd, 0xa4, 0x86, 0xa8, 0x8d, 
-0xaa, 0x8f, 0xad, 0x90, 0xbe, 0x92, 0xd1, 0x95, 0xd5, 0x98, 0x20, 0xef, 0xf9, 0x05, 0xe3, 0xa0, 
-0xf2, 0xfb, 0xad, 0x91, 0xd1, 0x96, 0x20, 0xf9, 0xf7, 0x03, 0xe3, 0xa1, 0xf2, 0xfc, 0x20, 0xf7, 
-0x00, 0x0c, 0x01, 0x01, 0x00, 0xf8, 0x10, 0x01, 0x00, 0xf9, 0x51, 0x11, 0x01, 0x00, 0xaa, 0x57, 
-0x12, 0x41, 0x00, 0x9c, 0x84, 0x13, 0x41, 0x00, 0xa8, 0x90, 0x14, 0x41, 0x00, 0xab, 0x92, 0x15, 
-0x41, 0x00, 0xac, 0x93, 0x16, 0x41, 0x00, 0x9f, 0x87, 0x17, 0x41, 0x00, 0xa0, 0x88, 0x18, 0x41, 
-0x00, 0xa6, 0x8e, 0x19, 0x41, 0x00, 0xa7, 0x8f, 0x1e, 0x41, 0x00, 0x98, 0x80, 0x1f, 0x41, 0x00, 
-0xa9, 0x91, 0x20, 0x41, 0x00, 0x9b, 0x83, 0x21, 0x41, 0x00, 0xad, 0x94, 0x22, 0x41, 0x00, 0x9a, 
-0x82, 0x23, 0x41, 0x00, 0x9e, 0x86, 0x24, 0x41, 0x00, 0xa5, 0x8d, 0x25, 0x41, 0x00, 0xa1, 0x89, 
-0x26, 0x41, 0x00, 0xa2, 0x8a, 0x27, 0x01, 0x03, 0xc8, 0xc9, 0x29, 0x01, 0x00, 0x60, 0xf1, 0x2a, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x2b, 0x01, 0x00, 0xfd, 0x7c, 0x2c, 0x41, 0x00, 0x9d, 
-0x85, 0x2d, 0x41, 0x00, 0xae, 0x95, 0x2e, 0x41, 0x00, 0xaf, 0x96, 0x2f, 0xc1, 0x00, 0xe0, 0x00, 
-0x97, 0x2f, 0x30, 0x41, 0x00, 0x99, 0x81, 0x31, 0x41, 0x00, 0xa4, 0x8c, 0x32, 0x41, 0x00, 0xa3, 
-0x8b, 0x56, 0x01, 0x00, 0x15, 0x7c, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 
-0x27, 0x0f, 0x98, 0xe1, 0x9c, 0xe2, 0x9e, 0xe3, 0xa0, 0xe5, 0xa6, 0xe6, 0xac, 0xe7, 0xe0, 0xe9, 
-0x80, 0xea, 0x84, 0xeb, 0x86, 0xec, 0x88, 0xed, 0x8e, 0xee, 0x93, 0xef, 0x97, 0xf0, 0x20, 0x27, 
-0x22, 0x05, 0xa0, 0xe4, 0xac, 0xe8, 0x88, 0xf4, 0x93, 0xf5, 0x20, 0x22, 0x00, 0x0c, 0x01, 0x01, 
-0x00, 0xf8, 0x10, 0x10, 0x00, 0x00, 0x11, 0x01, 0x00, 0xed, 0x7c, 0x12, 0x41, 0x00, 0xde, 0xa8, 
-0x13, 0x41, 0x00, 0xeb, 0xc7, 0x14, 0x41, 0x00, 0xee, 0xd0, 0x15, 0x41, 0x00, 0xf2, 0xd1, 0x16, 
-0x41, 0x00, 0xe2, 0xac, 0x17, 0x41, 0x00, 0xe3, 0xad, 0x18, 0x41, 0x00, 0xe9, 0xbe, 0x19, 0x41, 
-0x00, 0xea, 0xc6, 0x1a, 0x01, 0x01, 0x00, 0xae, 0x1b, 0x01, 0x01, 0x00, 0xaf, 0x1e, 0x41, 0x00, 
-0xd6, 0xa4, 0x1f, 0x41, 0x00, 0xec, 0xcf, 0x20, 0x41, 0x00, 0xdd, 0xa7, 0x21, 0x41, 0x00, 0xf3, 
-0xd2, 0x22, 0x41, 0x00, 0xd8, 0xa6, 0x23, 0x41, 0x00, 0xe1, 0xaa, 0x24, 0x41, 0x00, 0xe8, 0xbd, 
-0x25, 0x41, 0x00, 0xe4, 0xb5, 0x26, 0x41, 0x00, 0xe5, 0xb6, 0x27, 0x02, 0x07, 0xc8, 0xc9, 0xca, 
-0x29, 0x01, 0x00, 0xab, 0xf1, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x2b, 0x01, 0x00, 
-0x5c, 0x7c, 0x2c, 0xc1, 0x00, 0xe0, 0x00, 0xa9, 0x2c, 0x2d, 0x41, 0x00, 0xf4, 0xd3, 0x2e, 0x41, 
-0x00, 0xf6, 0xd4, 0x2f, 0x41, 0x00, 0xfa, 0xd5, 0x30, 0x41, 0x00, 0xd7, 0xa5, 0x31, 0x41, 0x00, 
-0xe7, 0xb8, 0x32, 0x41, 0x00, 0xe6, 0xb7, 0x56, 0x01, 0x00, 0xf5, 0x7c, 0x00, 0x36, 0x04, 0x1f, 
-0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0xef, 0x0f, 0xd6, 0x9b, 0xde, 0x9d, 0xe1, 0x9e, 0xe3, 0x9f, 
-0xe9, 0xa2, 0xf2, 0xa3, 0xfa, 0xfd, 0xa4, 0x86, 0xa8, 0x8d, 0xaa, 0x8f, 0xad, 0x90, 0xbe, 0x92, 
-0xd1, 0x95, 0xd5, 0x98, 0x20, 0xef, 0xf9, 0x03, 0xe3, 0xa0, 0xf2, 0xfb, 0x20, 0xf9, 0x27, 0x03, 
-0xe3, 0xa1, 0xf2, 0xfc, 0x20, 0x27, 0x00, 0x42, 0xbe, 0x04, 0x09, 0xdc, 0x00, 0x47, 0x4b, 0x2c, 
-0xdc, 0x00, 0x45, 0x4c, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x65, 0x03, 0xdd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x65, 0x03, 0xfb, 0x00, 0x34, 0x02, 0x00, 0x00, 
-0xe1, 0x02, 0x3a, 0x03, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x02, 0x69, 0x02, 0x79, 0x03, 0x00, 0x00, 
-0x53, 0x03, 0x5c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x53, 0x03, 0xa6, 0x03, 0x83, 0x04, 0x00, 0x00, 
-0x5a, 0x03, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0x22, 0xfd, 0x04, 0x02, 
-0x01, 0x00, 0x7e, 0xfc, 0x05, 0x02, 0x03, 0x00, 0x00, 0x9c, 0x06, 0x02, 0x03, 0x00, 0x00, 0xf5, 
-0x07, 0x02, 0x01, 0x00, 0x26, 0x14, 0x08, 0x01, 0x01, 0x00, 0x2f, 0x09, 0x02, 0x01, 0x00, 0x28, 
-0xcf, 0x0a, 0x02, 0x01, 0x00, 0x29, 0xdd, 0x0b, 0x02, 0x01, 0x00, 0x3d, 0xf8, 0x0c, 0x02, 0x00, 
-0x27, 0x3f, 0xf1, 0x0d, 0x02, 0x00, 0x5d, 0x5b, 0xab, 0x1a, 0x02, 0x00, 0x2b, 0x2a, 0xae, 0x1b, 
-0x02, 0x00, 0x7d, 0x7b, 0xaf, 0x27, 0x01, 0x00, 0x27, 0x60, 0x28, 0x10, 0x00, 0x00, 0x29, 0x03, 
-0x04, 0x5c, 0x7c, 0x00, 0x1c, 0x2b, 0x02, 0x00, 0x23, 0x40, 0xaa, 0x33, 0x02, 0x00, 0x2c, 0x3b, 
-0x3c, 0x34, 0x02, 0x00, 0x2e, 0x3a, 0x3e, 0x35, 0x03, 0x04, 0x2d, 0x5f, 0x00, 0x1f, 0x39, 0x00, 
-0x00, 0x20, 0x56, 0x01, 0x00, 0x3c, 0x3e, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x03, 
-0x02, 0x03, 0x00, 0x00, 0x99, 0x04, 0x02, 0x01, 0x00, 0x9c, 0x9a, 0x05, 0x02, 0x03, 0x00, 0x00, 
-0x9c, 0x06, 0x02, 0x03, 0x00, 0x00, 0xf5, 0x07, 0x02, 0x03, 0x00, 0x00, 0x14, 0x09, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x0a, 0x02, 0x03, 0x00, 0x00, 0x8a, 0x0b, 0x02, 0x03, 0x00, 0x00, 0xf8, 0x0c, 
-0x02, 0x03, 0x00, 0x00, 0xf1, 0x0d, 0x02, 0x03, 0x00, 0x00, 0xab, 0x10, 0x01, 0x00, 0x3b, 0x3a, 
-0x11, 0x01, 0x00, 0xed, 0x7e, 0x12, 0x42, 0x00, 0xde, 0xa8, 0x87, 0x13, 0x41, 0x00, 0xeb, 0xc7, 
-0x14, 0x41, 0x00, 0xee, 0xd0, 0x15, 0x41, 0x00, 0xf2, 0xd1, 0x16, 0x41, 0x00, 0xe2, 0xac, 0x17, 
-0x41, 0x00, 0xe3, 0xad, 0x18, 0x41, 0x00, 0xe9, 0xbe, 0x19, 0x41, 0x00, 0xea, 0xc6, 0x1e, 0x41, 
-0x00, 0xd6, 0xa4, 0x1f, 0x41, 0x00, 0xec, 0xcf, 0x20, 0x41, 0x00, 0xdd, 0xa7, 0x21, 0x41, 0x00, 
-0xf3, 0xd2, 0x22, 0x41, 0x00, 0xd8, 0xa6, 0x23, 0x41, 0x00, 0xe1, 0xaa, 0x24, 0x41, 0x00, 0xe8, 
-0xbd, 0x25, 0x41, 0x00, 0xe4, 0xb5, 0x26, 0x41, 0x00, 0xe5, 0xb6, 0x27, 0x02, 0x07, 0xc8, 0xc9, 
-0xca, 0x28, 0x02, 0x07, 0xc9, 0xca, 0xca, 0x29, 0x01, 0x00, 0xab, 0xf1, 0x2a, 0x04, 0x1f, 0x00, 
-0x00, 0x00, 0x00, 0x78, 0x2b, 0x02, 0x03, 0x00, 0x00, 0x89, 0x2c, 0xc1, 0x00, 0xe0, 0x00, 0xa9, 
-0x2c, 0x2d, 0x41, 0x00, 0xf4, 0xd3, 0x2e, 0x41, 0x00, 0xf6, 0xd4, 0x2f, 0x42, 0x00, 0xfa, 0xd5, 
-0x97, 0x30, 0x41, 0x00, 0xd7, 0xa5, 0x31, 0x41, 0x00, 0xe7, 0xb8, 0x32, 0x41, 0x00, 0xe6, 0xb7, 
-0x00, 0x03, 0x02, 0x03, 0x00, 0x00, 0x99, 0x04, 0x02, 0x03, 0x00, 0x00, 0x9a, 0x05, 0x02, 0x03, 
-0x00, 0x00, 0x9c, 0x06, 0x02, 0x03, 0x00, 0x00, 0xf5, 0x07, 0x02, 0x03, 0x00, 0x00, 0x14, 0x09, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x03, 0x00, 0x00, 0x8a, 0x0b, 0x02, 0x03, 0x00, 0x00, 
-0xf8, 0x0c, 0x02, 0x03, 0x00, 0x00, 0xf1, 0x0d, 0x02, 0x03, 0x00, 0x00, 0xab, 0x12, 0x42, 0x03, 
-0x00, 0x00, 0x87, 0x2b, 0x02, 0x03, 0x00, 0x00, 0x89, 0x2f, 0x42, 0x00, 0xfa, 0xd5, 0x97, 0x36, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0xef, 0x0f, 0xd6, 0x9b, 0xde, 0x9d, 0xe1, 0x9e, 
-0xe3, 0x9f, 0xe9, 0xa2, 0xf2, 0xa3, 0xfa, 0xfd, 0xa4, 0x86, 0xa8, 0x8d, 0xaa, 0x8f, 0xad, 0x90, 
-0xbe, 0x92, 0xd1, 0x95, 0xd5, 0x98, 0x20, 0xef, 0xf9, 0x05, 0xe3, 0xa0, 0xf2, 0xfb, 0xad, 0x91, 
-0xd1, 0x96, 0x20, 0xf9, 0xf7, 0x03, 0xe3, 0xa1, 0xf2, 0xfc, 0x20, 0xf7, 0x00, 0x04, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x03, 0x00, 0x00, 0x15, 0x09, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x10, 0x10, 0x00, 0x00, 0x11, 0x01, 0x00, 0xaa, 0x7e, 0x12, 0x41, 0x00, 0x9c, 0x84, 0x13, 
-0x41, 0x00, 0xa8, 0x90, 0x14, 0x41, 0x00, 0xab, 0x92, 0x15, 0x41, 0x00, 0xac, 0x93, 0x16, 0x41, 
-0x00, 0x9f, 0x87, 0x17, 0x41, 0x00, 0xa0, 0x88, 0x18, 0x41, 0x00, 0xa6, 0x8e, 0x19, 0x41, 0x00, 
-0xa7, 0x8f, 0x1a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x1b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x1e, 0x41, 
-0x00, 0x98, 0x80, 0x1f, 0x41, 0x00, 0xa9, 0x91, 0x20, 0x41, 0x00, 0x9b, 0x83, 0x21, 0x41, 0x00, 
-0xad, 0x94, 0x22, 0x41, 0x00, 0x9a, 0x82, 0x23, 0x41, 0x00, 0x9e, 0x86, 0x24, 0x41, 0x00, 0xa5, 
-0x8d, 0x25, 0x41, 0x00, 0xa1, 0x89, 0x26, 0x41, 0x00, 0xa2, 0x8a, 0x27, 0x01, 0x03, 0xc8, 0xc9, 
-0x28, 0x01, 0x03, 0xc9, 0xc9, 0x29, 0x01, 0x00, 0x5c, 0xf1, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x7a, 0x2b, 0x02, 0x05, 0x00, 0xf8, 0xa0, 0x2c, 0x41, 0x00, 0x9d, 0x85, 0x2d, 0x41, 0x00, 
-0xae, 0x95, 0x2e, 0x41, 0x00, 0xaf, 0x96, 0x2f, 0xc1, 0x00, 0xe0, 0x00, 0x97, 0x2f, 0x30, 0x41, 
-0x00, 0x99, 0x81, 0x31, 0x41, 0x00, 0xa4, 0x8c, 0x32, 0x41, 0x00, 0xa3, 0x8b, 0x00, 0x04, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x03, 0x00, 0x00, 0x15, 
-0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x1a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x1b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2b, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x27, 0x0f, 0x98, 
-0xe1, 0x9c, 0xe2, 0x9e, 0xe3, 0xa0, 0xe5, 0xa6, 0xe6, 0xac, 0xe7, 0xe0, 0xe9, 0x80, 0xea, 0x84, 
-0xeb, 0x86, 0xec, 0x88, 0xed, 0x8e, 0xee, 0x93, 0xef, 0x97, 0xf0, 0x20, 0x27, 0x22, 0x05, 0xa0, 
-0xe4, 0xac, 0xe8, 0x88, 0xf4, 0x93, 0xf5, 0x20, 0x22, 0x00, 0x03, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x10, 0x10, 0x00, 0x00, 0x11, 0x01, 0x02, 0xed, 0xa0, 0x12, 0x41, 0x00, 0xde, 0xa8, 
-0x13, 0x41, 0x00, 0xeb, 0xc7, 0x14, 0x41, 0x00, 0xee, 0xd0, 0x15, 0x41, 0x00, 0xf2, 0xd1, 0x16, 
-0x41, 0x00, 0xe2, 0xac, 0x17, 0x41, 0x00, 0xe3, 0xad, 0x18, 0x41, 0x00, 0xe9, 0xbe, 0x19, 0x41, 
-0x00, 0xea, 0xc6, 0x1e, 0x41, 0x00, 0xd6, 0xa4, 0x1f, 0x41, 0x00, 0xec, 0xcf, 0x20, 0x41, 0x00, 
-0xdd, 0xa7, 0x21, 0x41, 0x00, 0xf3, 0xd2, 0x22, 0x41, 0x00, 0xd8, 0xa6, 0x23, 0x41, 0x00, 0xe1, 
-0xaa, 0x24, 0x41, 0x00, 0xe8, 0xbd, 0x25, 0x41, 0x00, 0xe4, 0xb5, 0x26, 0x41, 0x00, 0xe5, 0xb6, 
-0x27, 0x02, 0x07, 0xc8, 0xc9, 0xca, 0x28, 0x02, 0x07, 0xc9, 0xca, 0xca, 0x2a, 0x04, 0x1f, 0x00, 
-0x00, 0x00, 0x00, 0x7c, 0x2b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2c, 0xc1, 0x00, 0xe0, 0x00, 0xa9, 
-0x2c, 0x2d, 0x41, 0x00, 0xf4, 0xd3, 0x2e, 0x41, 0x00, 0xf6, 0xd4, 0x2f, 0x41, 0x00, 0xfa, 0xd5, 
-0x30, 0x41, 0x00, 0xd7, 0xa5, 0x31, 0x41, 0x00, 0xe7, 0xb8, 0x32, 0x41, 0x00, 0xe6, 0xb7, 0x00, 
-0x03, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x36, 0x04, 
-0x1f, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0xef, 0x0f, 0xd6, 0x9b, 0xde, 0x9d, 0xe1, 0x9e, 0xe3, 
-0x9f, 0xe9, 0xa2, 0xf2, 0xa3, 0xfa, 0xfd, 0xa4, 0x86, 0xa8, 0x8d, 0xaa, 0x8f, 0xad, 0x90, 0xbe, 
-0x92, 0xd1, 0x95, 0xd5, 0x98, 0x20, 0xef, 0xf9, 0x03, 0xe3, 0xa0, 0xf2, 0xfb, 0x20, 0xf9, 0x27, 
-0x03, 0xe3, 0xa1, 0xf2, 0xfc, 0x20, 0x27, 0x00, 0x70, 0x24, 0x06, 0x09, 0xcb, 0x01, 0x47, 0x4b, 
-0x2c, 0xcb, 0x01, 0x45, 0x4c, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x65, 0x03, 0xcc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x65, 0x03, 0x12, 0x03, 0x0b, 0x04, 0x00, 
-0x00, 0xe1, 0x02, 0x07, 0x05, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x02, 0x40, 0x04, 0xda, 0x04, 0x00, 
-0x00, 0x53, 0x03, 0xf9, 0x05, 0x00, 0x00, 0x00, 0x00, 0x53, 0x03, 0x22, 0x05, 0xc8, 0x05, 0x00, 
-0x00, 0x5a, 0x03, 0xb0, 0x01, 0x97, 0x02, 0x00, 0x00, 0x52, 0x03, 0xcf, 0x00, 0x97, 0x02, 0x00, 
-0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x00, 0xfd, 0x07, 
-0x02, 0x03, 0x00, 0x00, 0x14, 0x0b, 0x02, 0x03, 0x00, 0x00, 0xf8, 0x0c, 0x02, 0x03, 0x00, 0x00, 
-0xf1, 0x10, 0x01, 0x00, 0x3b, 0x3a, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0x41, 0x00, 0x79, 0x59, 
-0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 
-0x02, 0x03, 0x00, 0x00, 0xae, 0x1b, 0x02, 0x03, 0x00, 0x00, 0xaf, 0x1e, 0x41, 0x00, 0x61, 0x41, 
-0x27, 0x01, 0x03, 0xc8, 0xc9, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x39, 
-0x00, 0x00, 0x20, 0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0xad, 0xfb, 0x04, 0x02, 0x03, 0x00, 0x00, 
-0xfc, 0x05, 0x03, 0x03, 0x00, 0x00, 0xcf, 0x9c, 0x07, 0x02, 0x03, 0x00, 0xca, 0xac, 0x08, 0x02, 
-0x03, 0x00, 0x00, 0xab, 0x09, 0x02, 0x03, 0x00, 0x00, 0xf3, 0x0b, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x0c, 0x02, 0x03, 0x00, 0x00, 0xbe, 0x0d, 0x03, 0x03, 0x00, 0x00, 0x9e, 0xf6, 0x10, 0x43, 0x00, 
-0x71, 0x51, 0x84, 0x8e, 0x11, 0x43, 0x03, 0x00, 0x00, 0x86, 0x8f, 0x12, 0x43, 0x00, 0x65, 0x45, 
-0x82, 0x90, 0x13, 0x42, 0x03, 0x00, 0x00, 0xa9, 0x14, 0x43, 0x03, 0x00, 0x00, 0xe7, 0xe8, 0x15, 
-0x43, 0x00, 0x79, 0x59, 0x81, 0x9a, 0x16, 0x43, 0x00, 0x75, 0x55, 0xa3, 0xe9, 0x17, 0x43, 0x00, 
-0x69, 0x49, 0xa1, 0xd6, 0x18, 0xc3, 0x00, 0x6f, 0x18, 0x4f, 0x18, 0xa2, 0x18, 0xe0, 0x00, 0x19, 
-0x43, 0x03, 0x00, 0x00, 0x94, 0x99, 0x1e, 0x43, 0x00, 0x61, 0x41, 0xa0, 0xb5, 0x1f, 0x43, 0x03, 
-0x00, 0x00, 0xe1, 0xf5, 0x20, 0x43, 0x03, 0x00, 0x00, 0xd0, 0xd1, 0x26, 0x43, 0x03, 0x00, 0x00, 
-0x9b, 0x9d, 0x27, 0x03, 0x00, 0x3b, 0x3a, 0xf4, 0xf8, 0x28, 0x03, 0x0f, 0x00, 0x00, 0xcb, 0xcc, 
-0x29, 0x01, 0x03, 0xc8, 0xc9, 0x2b, 0x03, 0x03, 0x00, 0x00, 0xaa, 0xdd, 0x2c, 0x43, 0x03, 0x00, 
-0x00, 0x91, 0x92, 0x2e, 0x43, 0x00, 0x63, 0x43, 0xb8, 0xbd, 0x31, 0x43, 0x00, 0x6e, 0x4e, 0xa4, 
-0xa5, 0x32, 0x42, 0x03, 0x00, 0x00, 0xe6, 0x33, 0x03, 0x03, 0x00, 0x00, 0x87, 0x80, 0x35, 0x02, 
-0x03, 0x00, 0x00, 0xa8, 0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0xad, 0xfb, 0x04, 0x02, 0x03, 0x00, 
-0x00, 0xfc, 0x05, 0x03, 0x03, 0x00, 0x00, 0xcf, 0x9c, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x07, 
-0x02, 0x03, 0x00, 0xca, 0xac, 0x08, 0x02, 0x03, 0x00, 0x00, 0xab, 0x09, 0x02, 0x03, 0x00, 0x00, 
-0xf3, 0x0b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0c, 0x02, 0x03, 0x00, 0x00, 0xbe, 0x0d, 0x03, 0x03, 
-0x00, 0x00, 0x9e, 0xf6, 0x10, 0x43, 0x00, 0x71, 0x51, 0x84, 0x8e, 0x11, 0x43, 0x03, 0x00, 0x00, 
-0x86, 0x8f, 0x12, 0x43, 0x00, 0x65, 0x45, 0x82, 0x90, 0x13, 0x42, 0x03, 0x00, 0x00, 0xa9, 0x14, 
-0x43, 0x03, 0x00, 0x00, 0xe7, 0xe8, 0x15, 0x43, 0x00, 0x79, 0x59, 0x81, 0x9a, 0x16, 0x43, 0x00, 
-0x75, 0x55, 0xa3, 0xe9, 0x17, 0x43, 0x00, 0x69, 0x49, 0xa1, 0xd6, 0x18, 0xc3, 0x00, 0x6f, 0x18, 
-0x4f, 0x18, 0xa2, 0x18, 0xe0, 0x00, 0x19, 0x43, 0x03, 0x00, 0x00, 0x94, 0x99, 0x1e, 0x43, 0x00, 
-0x61, 0x41, 0xa0, 0xb5, 0x1f, 0x43, 0x03, 0x00, 0x00, 0xe1, 0xf5, 0x20, 0x43, 0x03, 0x00, 0x00, 
-0xd0, 0xd1, 0x26, 0x43, 0x03, 0x00, 0x00, 0x9b, 0x9d, 0x27, 0x03, 0x00, 0x3b, 0x3a, 0xf4, 0xf8, 
-0x28, 0x03, 0x0f, 0x00, 0x00, 0xcb, 0xcc, 0x29, 0x01, 0x03, 0xc8, 0xc9, 0x2b, 0x03, 0x03, 0x00, 
-0x00, 0xaa, 0xdd, 0x2c, 0x43, 0x03, 0x00, 0x00, 0x91, 0x92, 0x2e, 0x43, 0x00, 0x63, 0x43, 0xb8, 
-0xbd, 0x31, 0x43, 0x00, 0x6e, 0x4e, 0xa4, 0xa5, 0x32, 0x42, 0x03, 0x00, 0x00, 0xe6, 0x33, 0x03, 
-0x03, 0x00, 0x00, 0x87, 0x80, 0x35, 0x02, 0x03, 0x00, 0x00, 0xa8, 0x00, 0x60, 0x0b, 0x61, 0x85, 
-0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 
-0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 
-0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 
-0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 0x0f, 0x61, 0xa0, 
-0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x43, 0x80, 
-0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 
-0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 
-0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0x00, 0x03, 0x02, 0x03, 0x00, 0x00, 0x99, 0x04, 0x02, 0x03, 
-0x00, 0x00, 0x9a, 0x05, 0x02, 0x03, 0x00, 0x00, 0x9c, 0x06, 0x02, 0x03, 0x00, 0x00, 0xf5, 0x0a, 
-0x02, 0x03, 0x00, 0x00, 0x8a, 0x0d, 0x02, 0x03, 0x00, 0x00, 0xab, 0x11, 0x01, 0x02, 0xed, 0xca, 
-0x12, 0x42, 0x00, 0xde, 0xa8, 0x87, 0x13, 0x41, 0x00, 0xeb, 0xc7, 0x14, 0x41, 0x00, 0xee, 0xd0, 
-0x15, 0x41, 0x00, 0xf2, 0xd1, 0x16, 0x41, 0x00, 0xe2, 0xac, 0x17, 0x41, 0x00, 0xe3, 0xad, 0x18, 
-0x41, 0x00, 0xe9, 0xbe, 0x19, 0x41, 0x00, 0xea, 0xc6, 0x1e, 0x41, 0x00, 0xd6, 0xa4, 0x1f, 0x41, 
-0x00, 0xec, 0xcf, 0x20, 0x41, 0x00, 0xdd, 0xa7, 0x21, 0x41, 0x00, 0xf3, 0xd2, 0x22, 0x41, 0x00, 
-0xd8, 0xa6, 0x23, 0x41, 0x00, 0xe1, 0xaa, 0x24, 0x41, 0x00, 0xe8, 0xbd, 0x25, 0x41, 0x00, 0xe4, 
-0xb5, 0x26, 0x41, 0x00, 0xe5, 0xb6, 0x27, 0x02, 0x07, 0x00, 0x00, 0xca, 0x2a, 0x04, 0x1f, 0x00, 
-0x00, 0x00, 0x00, 0x78, 0x2b, 0x02, 0x03, 0x00, 0x00, 0x89, 0x2c, 0xc1, 0x00, 0xe0, 0x00, 0xa9, 
-0x2c, 0x2d, 0x41, 0x00, 0xf4, 0xd3, 0x2e, 0x42, 0x00, 0xf6, 0xd4, 0x97, 0x2f, 0x41, 0x00, 0xfa, 
-0xd5, 0x30, 0x41, 0x00, 0xd7, 0xa5, 0x31, 0x41, 0x00, 0xe7, 0xb8, 0x32, 0x41, 0x00, 0xe6, 0xb7, 
-0x00, 0x03, 0x02, 0x03, 0x00, 0x00, 0x99, 0x04, 0x02, 0x03, 0x00, 0x00, 0x9a, 0x05, 0x02, 0x03, 
-0x00, 0x00, 0x9c, 0x06, 0x02, 0x03, 0x00, 0x00, 0xf5, 0x0a, 0x02, 0x03, 0x00, 0x00, 0x8a, 0x0d, 
-0x02, 0x03, 0x00, 0x00, 0xab, 0x12, 0x42, 0x03, 0x00, 0x00, 0x87, 0x2b, 0x02, 0x03, 0x00, 0x00, 
-0x89, 0x2e, 0x42, 0x03, 0x00, 0x00, 0x97, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 
-0xef, 0x0f, 0xd6, 0x9b, 0xde, 0x9d, 0xe1, 0x9e, 0xe3, 0x9f, 0xe9, 0xa2, 0xf2, 0xa3, 0xfa, 0xfd, 
-0xa4, 0x86, 0xa8, 0x8d, 0xaa, 0x8f, 0xad, 0x90, 0xbe, 0x92, 0xd1, 0x95, 0xd5, 0x98, 0x20, 0xef, 
-0xf9, 0x05, 0xe3, 0xa0, 0xf2, 0xfb, 0xad, 0x91, 0xd1, 0x96, 0x20, 0xf9, 0xf7, 0x03, 0xe3, 0xa1, 
-0xf2, 0xfc, 0x20, 0xf7, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0x15, 0x11, 0x01, 0x02, 0xaa, 0x00, 
-0x12, 0x41, 0x00, 0x9c, 0x84, 0x13, 0x41, 0x00, 0xa8, 0x90, 0x14, 0x41, 0x00, 0xab, 0x92, 0x15, 
-0x41, 0x00, 0xac, 0x93, 0x16, 0x41, 0x00, 0x9f, 0x87, 0x17, 0x41, 0x00, 0xa0, 0x88, 0x18, 0x41, 
-0x00, 0xa6, 0x8e, 0x19, 0x41, 0x00, 0xa7, 0x8f, 0x1a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x1b, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x1e, 0x41, 0x00, 0x98, 0x80, 0x1f, 0x41, 0x00, 0xa9, 0x91, 0x20, 0x41, 
-0x00, 0x9b, 0x83, 0x21, 0x41, 0x00, 0xad, 0x94, 0x22, 0x41, 0x00, 0x9a, 0x82, 0x23, 0x41, 0x00, 
-0x9e, 0x86, 0x24, 0x41, 0x00, 0xa5, 0x8d, 0x25, 0x41, 0x00, 0xa1, 0x89, 0x26, 0x41, 0x00, 0xa2, 
-0x8a, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x2c, 0x41, 0x00, 0x9d, 0x85, 0x2d, 0x41, 
-0x00, 0xae, 0x95, 0x2e, 0x41, 0x00, 0xaf, 0x96, 0x2f, 0xc1, 0x00, 0xe0, 0x00, 0x97, 0x2f, 0x30, 
-0x41, 0x00, 0x99, 0x81, 0x31, 0x41, 0x00, 0xa4, 0x8c, 0x32, 0x41, 0x00, 0xa3, 0x8b, 0x00, 0x27, 
-0x0f, 0x98, 0xe1, 0x9c, 0xe2, 0x9e, 0xe3, 0xa0, 0xe5, 0xa6, 0xe6, 0xac, 0xe7, 0xe0, 0xe9, 0x80, 
-0xea, 0x84, 0xeb, 0x86, 0xec, 0x88, 0xed, 0x8e, 0xee, 0x93, 0xef, 0x97, 0xf0, 0x20, 0x27, 0x22, 
-0x05, 0xa0, 0xe4, 0xac, 0xe8, 0x88, 0xf4, 0x93, 0xf5, 0x20, 0x22, 0x00, 0x06, 0x02, 0x03, 0x00, 
-0x00, 0x15, 0x1a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x1b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x36, 0x04, 
-0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x03, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x02, 0x03, 
-0x00, 0x00, 0x9c, 0x06, 0x02, 0x03, 0x00, 0x00, 0xf5, 0x0d, 0x02, 0x03, 0x00, 0x00, 0xab, 0x11, 
-0x01, 0x02, 0xed, 0xca, 0x12, 0x41, 0x00, 0xde, 0xa8, 0x13, 0x41, 0x00, 0xeb, 0xc7, 0x14, 0x41, 
-0x00, 0xee, 0xd0, 0x15, 0x41, 0x00, 0xf2, 0xd1, 0x16, 0x41, 0x00, 0xe2, 0xac, 0x17, 0x41, 0x00, 
-0xe3, 0xad, 0x18, 0x41, 0x00, 0xe9, 0xbe, 0x19, 0x41, 0x00, 0xea, 0xc6, 0x1e, 0x41, 0x00, 0xd6, 
-0xa4, 0x1f, 0x41, 0x00, 0xec, 0xcf, 0x20, 0x41, 0x00, 0xdd, 0xa7, 0x21, 0x41, 0x00, 0xf3, 0xd2, 
-0x22, 0x41, 0x00, 0xd8, 0xa6, 0x23, 0x41, 0x00, 0xe1, 0xaa, 0x24, 0x41, 0x00, 0xe8, 0xbd, 0x25, 
-0x41, 0x00, 0xe4, 0xb5, 0x26, 0x41, 0x00, 0xe5, 0xb6, 0x27, 0x02, 0x07, 0x00, 0x00, 0xca, 0x2a, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x2c, 0xc1, 0x00, 0xe0, 0x00, 0xa9, 0x2c, 0x2d, 0x41, 
-0x00, 0xf4, 0xd3, 0x2e, 0x41, 0x00, 0xf6, 0xd4, 0x2f, 0x41, 0x00, 0xfa, 0xd5, 0x30, 0x41, 0x00, 
-0xd7, 0xa5, 0x31, 0x41, 0x00, 0xe7, 0xb8, 0x32, 0x41, 0x00, 0xe6, 0xb7, 0x00, 0xef, 0x0f, 0xd6, 
-0x9b, 0xde, 0x9d, 0xe1, 0x9e, 0xe3, 0x9f, 0xe9, 0xa2, 0xf2, 0xa3, 0xfa, 0xfd, 0xa4, 0x86, 0xa8, 
-0x8d, 0xaa, 0x8f, 0xad, 0x90, 0xbe, 0x92, 0xd1, 0x95, 0xd5, 0x98, 0x20, 0xef, 0xf9, 0x03, 0xe3, 
-0xa0, 0xf2, 0xfb, 0x20, 0xf9, 0x27, 0x03, 0xe3, 0xa1, 0xf2, 0xfc, 0x20, 0x27, 0x00, 0x03, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x05, 0x02, 0x03, 0x00, 0x00, 0x9c, 0x06, 0x02, 0x03, 0x00, 0x00, 0xf5, 
-0x0d, 0x02, 0x03, 0x00, 0x00, 0xab, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x78, 
-0x34, 0x01, 0x09, 0x00, 0x00, 0x49, 0x53, 0x2c, 0xca, 0x01, 0x49, 0x53, 0x04, 0x02, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xd8, 0x00, 0xe5, 0x00, 0x00, 0x00, 
-0x52, 0x03, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x02, 0x01, 0x0d, 0x01, 0x00, 0x00, 
-0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x03, 0x02, 0x01, 0x00, 0x22, 0x40, 0x04, 0x02, 0x03, 0x00, 0x00, 0x9c, 0x07, 0x01, 0x01, 0x00, 
-0x26, 0x08, 0x02, 0x01, 0x00, 0x2f, 0x7b, 0x09, 0x03, 0x01, 0x00, 0x28, 0x5b, 0x1b, 0x0a, 0x03, 
-0x01, 0x00, 0x29, 0x5d, 0x1d, 0x0b, 0x02, 0x01, 0x00, 0x3d, 0x7d, 0x0c, 0x43, 0x00, 0x94, 0x99, 
-0x5c, 0x1c, 0x0d, 0x03, 0x04, 0x2d, 0x5f, 0x00, 0x1f, 0x10, 0x42, 0x03, 0x00, 0x00, 0x40, 0x12, 
-0x41, 0x00, 0x65, 0x45, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 
-0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x41, 0x00, 0xd0, 0xd1, 0x1b, 0x02, 0x00, 
-0x27, 0x3f, 0x7e, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x27, 0x41, 0x00, 0x91, 0x92, 0x28, 0x03, 0x03, 
-0xc8, 0xc8, 0x5e, 0x1e, 0x29, 0x02, 0x00, 0x3c, 0x3e, 0x7c, 0x2b, 0x02, 0x00, 0x2b, 0x2a, 0x60, 
-0x33, 0x01, 0x01, 0x00, 0x3b, 0x34, 0x01, 0x01, 0x00, 0x3a, 0x35, 0x41, 0x00, 0xe7, 0xe8, 0x39, 
-0x00, 0x00, 0x20, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 
-0x00, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 
-0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0x00, 0x1a, 0x41, 
-0x00, 0x8c, 0x8b, 0x35, 0x41, 0x00, 0x95, 0x8d, 0x00, 0x27, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 
-0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0x98, 0x41, 0xa4, 0x45, 0x90, 0x49, 0xa5, 0x4f, 0xa6, 0x55, 
-0xa7, 0x59, 0x97, 0x20, 0x27, 0x00, 0xca, 0xee, 0x01, 0x09, 0xa1, 0x00, 0x49, 0x53, 0x2c, 0xc5, 
-0x00, 0x49, 0x53, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 
-0x03, 0xf7, 0x00, 0x04, 0x01, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x5d, 
-0x03, 0x83, 0x01, 0x99, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0x22, 0x40, 0x04, 0x02, 0x03, 
-0x00, 0x00, 0x9c, 0x05, 0x02, 0x01, 0x00, 0xcf, 0x24, 0x07, 0x01, 0x01, 0x00, 0x26, 0x08, 0x02, 
-0x01, 0x00, 0x2f, 0x7b, 0x09, 0x03, 0x01, 0x00, 0x28, 0x5b, 0x1b, 0x0a, 0x03, 0x01, 0x00, 0x29, 
-0x5d, 0x1d, 0x0b, 0x02, 0x01, 0x00, 0x3d, 0x7d, 0x0c, 0x43, 0x00, 0x94, 0x99, 0x5c, 0x1c, 0x0d, 
-0x03, 0x04, 0x2d, 0x5f, 0x00, 0x1f, 0x10, 0x42, 0x03, 0x00, 0x00, 0x40, 0x12, 0x41, 0x00, 0x65, 
-0x45, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 
-0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x41, 0x00, 0xd0, 0xd1, 0x1b, 0x02, 0x04, 0x27, 0x3f, 0xcd, 
-0x1e, 0x41, 0x00, 0x61, 0x41, 0x27, 0x41, 0x00, 0x91, 0x92, 0x28, 0x03, 0x07, 0xca, 0xca, 0xc9, 
-0x1e, 0x29, 0x02, 0x03, 0xcc, 0xcb, 0xf8, 0x2b, 0x02, 0x04, 0x2b, 0x2a, 0xc8, 0x2e, 0x41, 0x00, 
-0x63, 0x43, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x32, 0x42, 0x03, 0x00, 0x00, 0xe6, 0x33, 0x02, 0x01, 
-0x00, 0x3b, 0x3c, 0x34, 0x02, 0x01, 0x00, 0x3a, 0x3e, 0x35, 0x42, 0x00, 0xe7, 0xe8, 0x7c, 0x39, 
-0x00, 0x00, 0x20, 0x56, 0x02, 0x00, 0x3c, 0x3e, 0x7c, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 
-0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 
-0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x5e, 
-0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 
-0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 
-0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 
-0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 
-0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0xf8, 0x03, 0x61, 
-0x86, 0x41, 0x8f, 0x20, 0xf8, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 
-0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x00, 0x05, 0x01, 0x03, 0x00, 0xa0, 0x1a, 0x41, 0x00, 0x8c, 0x8b, 
-0x1b, 0x02, 0x03, 0x00, 0x00, 0x7e, 0x35, 0x41, 0x00, 0x95, 0x8d, 0x00, 0x60, 0x03, 0x61, 0x85, 
-0x65, 0x8a, 0x20, 0x60, 0x5e, 0x05, 0x61, 0x83, 0x65, 0x88, 0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 
-0x27, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0x98, 0x41, 0xa4, 
-0x45, 0x90, 0x49, 0xa5, 0x4f, 0xa6, 0x55, 0xa7, 0x59, 0x97, 0x20, 0x27, 0x22, 0x08, 0x61, 0x84, 
-0x65, 0x89, 0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0xf8, 0x03, 
-0x61, 0x86, 0x41, 0x8f, 0x20, 0xf8, 0x00, 0x29, 0x62, 0x08, 0x09, 0x00, 0x00, 0x52, 0x4f, 0x2c, 
-0x4d, 0x01, 0x52, 0x4f, 0x0b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x54, 0x03, 0x0f, 0x02, 0x89, 0x02, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 
-0x5a, 0x03, 0x81, 0x01, 0x88, 0x01, 0x00, 0x00, 0x50, 0x03, 0x4a, 0x04, 0x00, 0x00, 0x00, 0x00, 
-0x50, 0x03, 0x4a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x65, 0x04, 0xc3, 0x05, 0x00, 0x00, 0x00, 0x00, 
-0x65, 0x04, 0xc4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x39, 0x75, 0x37, 0x06, 0x00, 0x00, 0x00, 0x00, 
-0x3a, 0x75, 0xde, 0x07, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x75, 0xc0, 0x06, 0xc9, 0x07, 0x00, 0x00, 
-0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0x02, 0x07, 0x00, 0x00, 0xc8, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x04, 0x0f, 0x00, 0x00, 
-0xc9, 0x00, 0x1e, 0x05, 0x01, 0x01, 0x00, 0xcf, 0x06, 0x02, 0x07, 0x00, 0x00, 0xca, 0x07, 0x01, 
-0x01, 0x00, 0x26, 0x08, 0x02, 0x05, 0x00, 0x2f, 0xcb, 0x09, 0x02, 0x01, 0x00, 0x28, 0xfa, 0x0a, 
-0x02, 0x05, 0x00, 0x29, 0xcc, 0x0b, 0x01, 0x01, 0x00, 0x3d, 0x0c, 0x02, 0x04, 0x2b, 0x3f, 0xcd, 
-0x0d, 0x02, 0x04, 0x27, 0x2a, 0xce, 0x10, 0x42, 0x03, 0x00, 0x00, 0x5c, 0x11, 0x42, 0x03, 0x00, 
-0x00, 0x7c, 0x12, 0x42, 0x00, 0x65, 0x45, 0xf6, 0x13, 0x42, 0x03, 0x00, 0x00, 0x9e, 0x14, 0x42, 
-0x03, 0x00, 0x00, 0x24, 0x15, 0xc5, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0xe1, 0x2c, 0x00, 0x2c, 0x1a, 
-0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x42, 0x00, 0x69, 0x49, 0x3c, 0x18, 0x42, 
-0x00, 0x6f, 0x4f, 0x3e, 0x1a, 0x02, 0x03, 0xa0, 0xa0, 0xf6, 0x1b, 0x42, 0x00, 0x8c, 0xd7, 0x9e, 
-0x1e, 0x41, 0x00, 0x61, 0x41, 0x27, 0x02, 0x03, 0xa0, 0xa0, 0x24, 0x28, 0x02, 0x03, 0xa0, 0xa0, 
-0xe1, 0x29, 0x01, 0x00, 0x5d, 0x5b, 0x2b, 0x41, 0x00, 0x83, 0xb6, 0x2c, 0xc5, 0x00, 0x79, 0x15, 
-0x59, 0x15, 0x00, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x2f, 
-0x42, 0x03, 0x00, 0x00, 0x40, 0x30, 0x42, 0x03, 0x00, 0x00, 0x7b, 0x31, 0x42, 0x00, 0x6e, 0x4e, 
-0x7d, 0x32, 0x42, 0x03, 0x00, 0x00, 0xf5, 0x33, 0x02, 0x01, 0x00, 0x3b, 0x3c, 0x34, 0x02, 0x01, 
-0x00, 0x3a, 0x3e, 0x35, 0x04, 0x0c, 0x2d, 0x5f, 0x00, 0x00, 0x1f, 0x39, 0x00, 0x00, 0x20, 0x56, 
-0x01, 0x00, 0x3c, 0x3e, 0x00, 0x16, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x7e, 0x07, 0x61, 0xc6, 
-0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 
-0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 
-0x55, 0xea, 0x20, 0x5e, 0xf8, 0x03, 0x61, 0x86, 0x41, 0x8f, 0x20, 0xf8, 0x60, 0x0b, 0x61, 0x85, 
-0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 
-0x55, 0xeb, 0x20, 0x60, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 
-0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 
-0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 
-0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0xf7, 0x03, 0x63, 0x87, 0x43, 0x80, 
-0x20, 0xf7, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x7e, 0x03, 0x02, 0x07, 0x00, 0x00, 0xc8, 0x05, 
-0x02, 0x07, 0x00, 0x00, 0xca, 0x06, 0x02, 0x07, 0x00, 0x00, 0xcb, 0x07, 0x02, 0x07, 0x00, 0x00, 
-0xcc, 0x08, 0x02, 0x03, 0x00, 0x00, 0x60, 0x09, 0x02, 0x07, 0x00, 0x00, 0xcd, 0x0a, 0x02, 0x07, 
-0x00, 0x00, 0xce, 0x0b, 0x02, 0x07, 0x00, 0x00, 0xcf, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xd0, 0x0d, 
-0x02, 0x07, 0x00, 0x00, 0xd1, 0x13, 0x41, 0x00, 0x72, 0x52, 0x14, 0x41, 0x00, 0x74, 0x54, 0x16, 
-0x42, 0x03, 0x00, 0x00, 0xaa, 0x1a, 0x41, 0x00, 0xc7, 0xc6, 0x1f, 0x42, 0x00, 0x73, 0x53, 0xd0, 
-0x20, 0x42, 0x00, 0x64, 0x44, 0xd1, 0x25, 0x42, 0x03, 0x00, 0x00, 0x88, 0x26, 0x42, 0x00, 0x6c, 
-0x4c, 0x9d, 0x27, 0x41, 0x00, 0xad, 0xb8, 0x28, 0x41, 0x00, 0xee, 0xdd, 0x00, 0xf3, 0x13, 0x63, 
-0x9f, 0x64, 0xd4, 0x65, 0xd8, 0x6c, 0x96, 0x6e, 0xe5, 0x72, 0xfd, 0x73, 0xe7, 0x74, 0x9c, 0x7a, 
-0xa7, 0x43, 0xac, 0x44, 0xd2, 0x45, 0xb7, 0x4c, 0x95, 0x4e, 0xd5, 0x52, 0xfc, 0x53, 0xe6, 0x54, 
-0x9b, 0x5a, 0xa6, 0x20, 0xf3, 0x5e, 0x07, 0x61, 0x83, 0x69, 0x8c, 0x6f, 0x93, 0x41, 0xb6, 0x49, 
-0xd7, 0x4f, 0xe2, 0x20, 0x5e, 0xf4, 0x03, 0x61, 0xc7, 0x41, 0xc6, 0x20, 0xf4, 0xf8, 0x03, 0x75, 
-0x85, 0x55, 0xde, 0x20, 0xf8, 0xf2, 0x05, 0x61, 0xa5, 0x65, 0xa9, 0x41, 0xa4, 0x45, 0xa8, 0x20, 
-0xf2, 0xfa, 0x03, 0x7a, 0xbe, 0x5a, 0xbd, 0x20, 0xfa, 0xef, 0x19, 0x61, 0xa0, 0x63, 0x86, 0x65, 
-0x82, 0x69, 0xa1, 0x6c, 0x92, 0x6e, 0xe4, 0x6f, 0xa2, 0x72, 0xea, 0x73, 0x98, 0x75, 0xa3, 0x79, 
-0xec, 0x7a, 0xab, 0x41, 0xb5, 0x43, 0x8f, 0x45, 0x90, 0x49, 0xd6, 0x4c, 0x91, 0x4e, 0xe3, 0x4f, 
-0xe0, 0x52, 0xe8, 0x53, 0x97, 0x55, 0xe9, 0x59, 0xed, 0x5a, 0x8d, 0x20, 0xef, 0xf1, 0x05, 0x6f, 
-0x8b, 0x75, 0xfb, 0x4f, 0x8a, 0x55, 0xeb, 0x20, 0xf1, 0xf9, 0x09, 0x61, 0x84, 0x65, 0x89, 0x6f, 
-0x94, 0x75, 0x81, 0x41, 0x8e, 0x45, 0xd3, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0xf7, 0x07, 0x63, 
-0x87, 0x73, 0xad, 0x74, 0xee, 0x43, 0x80, 0x53, 0xb8, 0x54, 0xdd, 0x20, 0xf7, 0x00, 0x02, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x01, 0x03, 0x00, 0xa0, 0x06, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x08, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x43, 0x00, 
-0xec, 0x9c, 0x27, 0x2a, 0x10, 0x41, 0x00, 0xee, 0x9e, 0x11, 0x41, 0x00, 0xe9, 0x99, 0x12, 0x42, 
-0x00, 0xa5, 0x85, 0xfa, 0x13, 0xc2, 0x04, 0xe0, 0x00, 0x90, 0x13, 0xa0, 0x13, 0x14, 0x41, 0x00, 
-0xe2, 0x92, 0x15, 0xc5, 0x04, 0xa7, 0x2c, 0x87, 0x2c, 0xa0, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 
-0x2c, 0x16, 0x42, 0x00, 0xe3, 0x93, 0xfd, 0x17, 0x41, 0x00, 0xf7, 0xf6, 0x18, 0x41, 0x00, 0xae, 
-0x8e, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x42, 0x00, 0xf9, 0xf8, 0xfa, 0x1b, 0x42, 0x04, 0xa8, 
-0x88, 0xa0, 0x1e, 0x41, 0x00, 0xa0, 0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 0xa4, 
-0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 0x41, 0x00, 0xf3, 0xf2, 0x23, 0x41, 0x00, 0xa3, 0x83, 
-0x24, 0x41, 0x00, 0xa6, 0x86, 0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x27, 
-0x41, 0x00, 0xe8, 0x98, 0x28, 0x42, 0x04, 0xe6, 0x96, 0xa0, 0x29, 0x43, 0x00, 0xf5, 0xf4, 0x5d, 
-0x5b, 0x2a, 0x05, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2b, 0x41, 0x00, 0xef, 0x9f, 0x2c, 
-0xc5, 0x00, 0xa9, 0x15, 0x89, 0x15, 0x00, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 0x41, 
-0x00, 0xe5, 0x95, 0x2e, 0x41, 0x00, 0xe7, 0x97, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 0x00, 
-0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x42, 0x04, 0xac, 0x8c, 0xa0, 0x00, 0x02, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x01, 0x03, 0x00, 0xa0, 0x06, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x08, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x12, 0x02, 0x03, 0x00, 0x00, 0xfa, 0x13, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x15, 
-0xc5, 0x04, 0x7a, 0x2c, 0x5a, 0x2c, 0xa0, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x02, 
-0x03, 0x00, 0x00, 0xfd, 0x1a, 0x02, 0x03, 0x00, 0x00, 0xfa, 0x1b, 0x10, 0x00, 0x00, 0x28, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x2b, 0x10, 0x00, 0x00, 0x32, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x36, 0x05, 
-0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x05, 0x01, 0x01, 0x00, 0xfd, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x08, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x43, 0x00, 0xec, 0x9c, 0x27, 0x2a, 0x10, 0x41, 
-0x00, 0xee, 0x9e, 0x11, 0x41, 0x00, 0xe9, 0x99, 0x12, 0x42, 0x00, 0xa5, 0x85, 0xfa, 0x13, 0xc2, 
-0x04, 0xe0, 0x00, 0x90, 0x13, 0xa0, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0xc5, 0x04, 0xa7, 
-0x2c, 0x87, 0x2c, 0xa0, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0xe3, 0x93, 
-0x17, 0x41, 0x00, 0xf7, 0xf6, 0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 
-0x42, 0x00, 0xf9, 0xf8, 0xfa, 0x1b, 0x42, 0x04, 0xa8, 0x88, 0xa0, 0x1e, 0x41, 0x00, 0xa0, 0x80, 
-0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 
-0x41, 0x00, 0xf3, 0xf2, 0x23, 0x41, 0x00, 0xa3, 0x83, 0x24, 0x41, 0x00, 0xa6, 0x86, 0x25, 0x41, 
-0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x27, 0x41, 0x00, 0xe8, 0x98, 0x28, 0x42, 0x04, 
-0xe6, 0x96, 0xa0, 0x29, 0x43, 0x00, 0xf5, 0xf4, 0x5d, 0x5b, 0x2a, 0x05, 0x3f, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x7d, 0x2b, 0x41, 0x00, 0xef, 0x9f, 0x2c, 0xc5, 0x00, 0xa9, 0x15, 0x89, 0x15, 0x00, 
-0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 0x41, 0x00, 0xe5, 0x95, 0x2e, 0x41, 0x00, 0xe7, 
-0x97, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 
-0x32, 0x42, 0x04, 0xac, 0x8c, 0xa0, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x05, 0x01, 0x01, 0x00, 0xfd, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x08, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x0c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x02, 0x03, 0x00, 
-0x00, 0xfa, 0x13, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x15, 0xc5, 0x04, 0x7a, 0x2c, 0x5a, 0x2c, 0xa0, 
-0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x1a, 0x02, 0x03, 0x00, 0x00, 0xfa, 0x1b, 0x10, 0x00, 
-0x00, 0x28, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2b, 0x10, 0x00, 0x00, 0x32, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x36, 0x05, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x06, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x08, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x12, 0x03, 0x03, 0x00, 0x00, 0x88, 0xd2, 0x13, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x15, 0xc5, 
-0x04, 0x7a, 0x2c, 0x5a, 0x2c, 0xa0, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x43, 0x03, 
-0x00, 0x00, 0x81, 0x9a, 0x17, 0x41, 0x01, 0x00, 0x98, 0x18, 0x43, 0x03, 0x00, 0x00, 0x94, 0x99, 
-0x1a, 0x42, 0x04, 0x84, 0x8e, 0xa0, 0x1b, 0x42, 0x04, 0x8d, 0x49, 0xa0, 0x22, 0x43, 0x03, 0x00, 
-0x00, 0xa7, 0xa6, 0x27, 0x41, 0x00, 0x9f, 0x9e, 0x28, 0x42, 0x04, 0xf3, 0xf4, 0xa0, 0x2b, 0x41, 
-0x00, 0x87, 0x80, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x03, 0x01, 0x03, 0x00, 0xc8, 0x04, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x01, 0x03, 0x00, 0xa0, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x08, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x43, 0x00, 0xec, 0x9c, 0x27, 0x2a, 0x10, 
-0x41, 0x00, 0xee, 0x9e, 0x11, 0x41, 0x00, 0xe9, 0x99, 0x12, 0x42, 0x04, 0xa5, 0x85, 0xa0, 0x13, 
-0xc2, 0x04, 0xe0, 0x00, 0x90, 0x13, 0xa0, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0xc5, 0x04, 
-0xa7, 0x2c, 0x87, 0x2c, 0xa0, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x42, 0x00, 0xe3, 
-0x93, 0xfd, 0x17, 0x41, 0x00, 0xa8, 0x88, 0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 0xaf, 
-0x8f, 0x1a, 0x42, 0x04, 0xed, 0x9d, 0xa0, 0x1b, 0x42, 0x04, 0xeb, 0x9b, 0xa0, 0x1e, 0x41, 0x00, 
-0xa0, 0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 
-0x94, 0x22, 0x41, 0x00, 0xa3, 0x83, 0x23, 0x41, 0x00, 0xe5, 0x95, 0x24, 0x41, 0x00, 0xa6, 0x86, 
-0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x27, 0x41, 0x00, 0xe8, 0x98, 0x28, 
-0x42, 0x04, 0xe6, 0x96, 0xa0, 0x29, 0x43, 0x00, 0xea, 0x9a, 0x5d, 0x5b, 0x2a, 0x05, 0x3f, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x80, 0x2b, 0x41, 0x00, 0xef, 0x9f, 0x2c, 0xc5, 0x00, 0xa9, 0x15, 0x89, 
-0x15, 0x00, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 0x41, 0x00, 0xfb, 0xfa, 0x2e, 0x41, 
-0x00, 0xe7, 0x97, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 
-0xad, 0x8d, 0x32, 0x42, 0x04, 0xac, 0x8c, 0xa0, 0x39, 0x00, 0x00, 0x20, 0x00, 0x22, 0x09, 0xa0, 
-0xf3, 0xa5, 0xf1, 0xae, 0xf5, 0xe3, 0xf7, 0x80, 0xf2, 0x85, 0xf0, 0x8e, 0xf4, 0x93, 0xf6, 0x20, 
-0x22, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x01, 
-0x03, 0x00, 0xa0, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x08, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x13, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x15, 0xc5, 0x04, 0x7a, 0x2c, 0x5a, 0x2c, 0xa0, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 
-0x00, 0x2c, 0x16, 0x02, 0x03, 0x00, 0x00, 0xfd, 0x1a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x1b, 0x10, 
-0x00, 0x00, 0x28, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2b, 0x10, 0x00, 0x00, 0x32, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x36, 0x05, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0xb7, 0xbf, 0x07, 0x04, 
-0xbe, 0x01, 0x52, 0x4f, 0x0b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x54, 0x03, 0xd7, 0x01, 0x4d, 0x02, 0x00, 0x00, 0x5a, 0x03, 0x49, 0x01, 0x50, 0x01, 0x00, 0x00, 
-0x52, 0x03, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x50, 0x03, 0xfb, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x50, 0x03, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x65, 0x04, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 
-0x65, 0x04, 0x69, 0x04, 0x00, 0x00, 0x00, 0x00, 0x39, 0x75, 0xbd, 0x05, 0x00, 0x00, 0x00, 0x00, 
-0x3a, 0x75, 0x4c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x75, 0x45, 0x06, 0x37, 0x07, 0x00, 0x00, 
-0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0x02, 0x07, 0x00, 0x00, 0xc8, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x04, 0x0f, 0x00, 0x00, 
-0xc9, 0x00, 0x1e, 0x06, 0x02, 0x07, 0x00, 0x00, 0xca, 0x07, 0x01, 0x01, 0x00, 0x26, 0x08, 0x02, 
-0x05, 0x00, 0x2f, 0xcb, 0x09, 0x02, 0x01, 0x00, 0x28, 0xfa, 0x0a, 0x02, 0x05, 0x00, 0x29, 0xcc, 
-0x0b, 0x01, 0x01, 0x00, 0x3d, 0x0c, 0x02, 0x04, 0x2b, 0x3f, 0xcd, 0x0d, 0x02, 0x04, 0x27, 0x2a, 
-0xce, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 
-0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x42, 0x03, 0xa0, 0xa0, 0x7b, 
-0x1b, 0x42, 0x00, 0x8c, 0xd7, 0x7d, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x27, 0x44, 0x0b, 0xa0, 0xa0, 
-0x5b, 0x00, 0x1b, 0x28, 0x44, 0x0b, 0xa0, 0xa0, 0x5d, 0x00, 0x1d, 0x29, 0x42, 0x00, 0x83, 0xb6, 
-0x2d, 0x2b, 0x02, 0x03, 0x00, 0x00, 0xe1, 0x2c, 0x42, 0x03, 0x00, 0x00, 0x9e, 0x2d, 0x42, 0x03, 
-0x00, 0x00, 0xf6, 0x2e, 0x42, 0x00, 0x63, 0x43, 0xf5, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x33, 0x02, 
-0x01, 0x00, 0x3b, 0x3c, 0x34, 0x02, 0x01, 0x00, 0x3a, 0x3e, 0x35, 0x04, 0x08, 0x2d, 0x5f, 0x40, 
-0x00, 0x1f, 0x39, 0x00, 0x00, 0x20, 0x56, 0x02, 0x00, 0x9e, 0xf6, 0xf5, 0x00, 0x12, 0x42, 0x03, 
-0x00, 0x00, 0xd5, 0x00, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 
-0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 
-0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xf8, 0x03, 0x61, 0x86, 
-0x41, 0x8f, 0x20, 0xf8, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 
-0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0xef, 0x0d, 0x61, 0xa0, 
-0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 
-0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 
-0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 
-0x20, 0xf9, 0xf7, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0xf7, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 
-0x7e, 0x03, 0x02, 0x07, 0x00, 0x00, 0xc8, 0x05, 0x02, 0x07, 0x00, 0x00, 0xca, 0x06, 0x02, 0x07, 
-0x00, 0x00, 0xcb, 0x07, 0x02, 0x07, 0x00, 0x00, 0xcc, 0x08, 0x02, 0x03, 0x00, 0x00, 0x60, 0x09, 
-0x02, 0x07, 0x00, 0x00, 0xcd, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xce, 0x0b, 0x02, 0x07, 0x00, 0x00, 
-0xcf, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xd0, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xd1, 0x12, 0x42, 0x03, 
-0x00, 0x00, 0xaa, 0x13, 0x41, 0x00, 0x72, 0x52, 0x14, 0x41, 0x00, 0x74, 0x54, 0x1a, 0x41, 0x00, 
-0xc7, 0xc6, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x20, 0x41, 0x00, 0x64, 0x44, 0x26, 0x41, 0x00, 0x6c, 
-0x4c, 0x27, 0x41, 0x00, 0xad, 0xb8, 0x28, 0x41, 0x00, 0xee, 0xdd, 0x2c, 0x41, 0x00, 0x7a, 0x5a, 
-0x00, 0xf3, 0x13, 0x63, 0x9f, 0x64, 0xd4, 0x65, 0xd8, 0x6c, 0x96, 0x6e, 0xe5, 0x72, 0xfd, 0x73, 
-0xe7, 0x74, 0x9c, 0x7a, 0xa7, 0x43, 0xac, 0x44, 0xd2, 0x45, 0xb7, 0x4c, 0x95, 0x4e, 0xd5, 0x52, 
-0xfc, 0x53, 0xe6, 0x54, 0x9b, 0x5a, 0xa6, 0x20, 0xf3, 0x5e, 0x07, 0x61, 0x83, 0x69, 0x8c, 0x6f, 
-0x93, 0x41, 0xb6, 0x49, 0xd7, 0x4f, 0xe2, 0x20, 0x5e, 0xf4, 0x03, 0x61, 0xc7, 0x41, 0xc6, 0x20, 
-0xf4, 0xf8, 0x03, 0x75, 0x85, 0x55, 0xde, 0x20, 0xf8, 0xf2, 0x05, 0x61, 0xa5, 0x65, 0xa9, 0x41, 
-0xa4, 0x45, 0xa8, 0x20, 0xf2, 0xfa, 0x03, 0x7a, 0xbe, 0x5a, 0xbd, 0x20, 0xfa, 0xef, 0x19, 0x61, 
-0xa0, 0x63, 0x86, 0x65, 0x82, 0x69, 0xa1, 0x6c, 0x92, 0x6e, 0xe4, 0x6f, 0xa2, 0x72, 0xea, 0x73, 
-0x98, 0x75, 0xa3, 0x79, 0xec, 0x7a, 0xab, 0x41, 0xb5, 0x43, 0x8f, 0x45, 0x90, 0x49, 0xd6, 0x4c, 
-0x91, 0x4e, 0xe3, 0x4f, 0xe0, 0x52, 0xe8, 0x53, 0x97, 0x55, 0xe9, 0x59, 0xed, 0x5a, 0x8d, 0x20, 
-0xef, 0xf1, 0x05, 0x6f, 0x8b, 0x75, 0xfb, 0x4f, 0x8a, 0x55, 0xeb, 0x20, 0xf1, 0xf9, 0x09, 0x61, 
-0x84, 0x65, 0x89, 0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 0x45, 0xd3, 0x4f, 0x99, 0x55, 0x9a, 0x20, 
-0xf9, 0xf7, 0x07, 0x63, 0x87, 0x73, 0xad, 0x74, 0xee, 0x43, 0x80, 0x53, 0xb8, 0x54, 0xdd, 0x20, 
-0xf7, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x08, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x0a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x43, 0x00, 0xec, 
-0x9c, 0x27, 0x2a, 0x10, 0x41, 0x00, 0xee, 0x9e, 0x11, 0x41, 0x00, 0xe9, 0x99, 0x12, 0x42, 0x00, 
-0xa5, 0x85, 0xfd, 0x13, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 
-0x41, 0x00, 0xa9, 0x89, 0x16, 0x41, 0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xf7, 0xf6, 0x18, 0x41, 
-0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x41, 0x00, 0xf9, 0xf8, 0x1b, 0x41, 0x00, 
-0xa8, 0x88, 0x1e, 0x41, 0x00, 0xa0, 0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 0xa4, 
-0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 0x41, 0x00, 0xf3, 0xf2, 0x23, 0x41, 0x00, 0xa3, 0x83, 
-0x24, 0x41, 0x00, 0xa6, 0x86, 0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x27, 
-0x41, 0x00, 0xe8, 0x98, 0x28, 0x41, 0x00, 0xe6, 0x96, 0x29, 0x41, 0x00, 0xef, 0x9f, 0x2a, 0x05, 
-0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2c, 0x42, 0x04, 
-0xa7, 0x87, 0xa0, 0x2d, 0x42, 0x04, 0xe5, 0x95, 0xa0, 0x2e, 0x42, 0x00, 0xe7, 0x97, 0x15, 0x2f, 
-0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x42, 
-0x04, 0xac, 0x8c, 0xa0, 0x39, 0x00, 0x00, 0x20, 0x56, 0x42, 0x00, 0xf5, 0xf4, 0x15, 0x00, 0x02, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x08, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x12, 
-0x02, 0x03, 0x00, 0x00, 0xfd, 0x1b, 0x01, 0x03, 0xa0, 0xa0, 0x29, 0x01, 0x03, 0xa0, 0xa0, 0x2b, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x2c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2d, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x2e, 0x02, 0x03, 0x00, 0x00, 0x15, 0x32, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x36, 0x05, 0x3f, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x56, 0x02, 0x03, 0xa0, 0xa0, 0x15, 0x00, 0x02, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x08, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x43, 0x00, 0xec, 0x9c, 0x27, 0x2a, 0x10, 0x41, 
-0x00, 0xee, 0x9e, 0x11, 0x41, 0x00, 0xe9, 0x99, 0x12, 0x41, 0x00, 0xa5, 0x85, 0x13, 0xc1, 0x00, 
-0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0x41, 0x00, 0xa9, 0x89, 0x16, 0x41, 
-0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xf7, 0xf6, 0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 
-0xaf, 0x8f, 0x1a, 0x41, 0x00, 0xf9, 0xf8, 0x1b, 0x41, 0x00, 0xa8, 0x88, 0x1e, 0x41, 0x00, 0xa0, 
-0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 
-0x22, 0x41, 0x00, 0xf3, 0xf2, 0x23, 0x41, 0x00, 0xa3, 0x83, 0x24, 0x41, 0x00, 0xa6, 0x86, 0x25, 
-0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x27, 0x41, 0x00, 0xe8, 0x98, 0x28, 0x41, 
-0x00, 0xe6, 0x96, 0x29, 0x41, 0x00, 0xef, 0x9f, 0x2a, 0x05, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x7d, 0x2b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2c, 0x42, 0x04, 0xa7, 0x87, 0xa0, 0x2d, 0x42, 0x04, 
-0xe5, 0x95, 0xa0, 0x2e, 0x42, 0x00, 0xe7, 0x97, 0x15, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 
-0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x42, 0x04, 0xac, 0x8c, 0xa0, 0x39, 0x00, 
-0x00, 0x20, 0x56, 0x42, 0x00, 0xf5, 0xf4, 0x15, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x08, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0c, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x1b, 0x01, 0x03, 0xa0, 0xa0, 0x29, 0x01, 
-0x03, 0xa0, 0xa0, 0x2b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2d, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x2e, 0x02, 0x03, 0x00, 0x00, 0x15, 0x32, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x36, 0x05, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x56, 0x02, 0x03, 0xa0, 0xa0, 0x15, 
-0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x02, 0x03, 
-0x00, 0x00, 0xd5, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x08, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x03, 0x03, 0x00, 0x00, 0x88, 0xd2, 0x16, 0x43, 
-0x03, 0x00, 0x00, 0x81, 0x9a, 0x17, 0x41, 0x01, 0x00, 0x98, 0x18, 0x43, 0x03, 0x00, 0x00, 0x94, 
-0x99, 0x1a, 0x41, 0x00, 0x84, 0x8e, 0x1b, 0x41, 0x00, 0x8d, 0x49, 0x22, 0x43, 0x03, 0x00, 0x00, 
-0xa7, 0xa6, 0x27, 0x41, 0x00, 0x9f, 0x9e, 0x28, 0x41, 0x00, 0xf3, 0xf4, 0x29, 0x01, 0x03, 0xa0, 
-0xa0, 0x2b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2d, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x56, 0x41, 0x00, 0x87, 0x80, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x03, 
-0x01, 0x03, 0x00, 0xc8, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x08, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x43, 0x00, 0xec, 0x9c, 0x27, 0x2a, 0x10, 
-0x41, 0x00, 0xee, 0x9e, 0x11, 0x41, 0x00, 0xe9, 0x99, 0x12, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x13, 
-0xc1, 0x00, 0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0x41, 0x00, 0xa9, 0x89, 
-0x16, 0x41, 0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xa8, 0x88, 0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 
-0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x41, 0x00, 0xed, 0x9d, 0x1b, 0x41, 0x00, 0xeb, 0x9b, 0x1e, 0x41, 
-0x00, 0xa0, 0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 
-0xe4, 0x94, 0x22, 0x41, 0x00, 0xa3, 0x83, 0x23, 0x41, 0x00, 0xe5, 0x95, 0x24, 0x41, 0x00, 0xa6, 
-0x86, 0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x27, 0x41, 0x00, 0xe8, 0x98, 
-0x28, 0x41, 0x00, 0xe6, 0x96, 0x29, 0x41, 0x00, 0xef, 0x9f, 0x2a, 0x05, 0x3f, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x80, 0x2b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2c, 0x42, 0x04, 0xa7, 0x87, 0xa0, 0x2d, 
-0x42, 0x04, 0xfb, 0xfa, 0xa0, 0x2e, 0x42, 0x00, 0xe7, 0x97, 0x15, 0x2f, 0x41, 0x00, 0xa2, 0x82, 
-0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x42, 0x04, 0xac, 0x8c, 0xa0, 
-0x39, 0x00, 0x00, 0x20, 0x56, 0x42, 0x00, 0xea, 0x9a, 0x15, 0x00, 0x22, 0x09, 0xa0, 0xf3, 0xa5, 
-0xf1, 0xae, 0xf5, 0xe3, 0xf7, 0x80, 0xf2, 0x85, 0xf0, 0x8e, 0xf4, 0x93, 0xf6, 0x20, 0x22, 0x00, 
-0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x08, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x12, 0x02, 0x03, 0x00, 0x00, 0xfd, 0x1b, 0x01, 0x03, 0xa0, 0xa0, 0x29, 0x01, 0x03, 0xa0, 0xa0, 
-0x2b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2c, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2d, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x2e, 0x02, 0x03, 0x00, 0x00, 0x15, 0x32, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x36, 0x05, 
-0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x56, 0x02, 0x03, 0xa0, 0xa0, 0x15, 0x00, 0xd5, 0x6e, 
-0x04, 0x09, 0x00, 0x00, 0x52, 0x55, 0x2c, 0xb9, 0x01, 0x52, 0x55, 0x0c, 0x02, 0x00, 0x00, 0x00, 
-0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x03, 0xab, 0x01, 0x00, 0x00, 0x00, 0x00, 0x28, 
-0x03, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x03, 0x94, 0x02, 0x00, 0x00, 0x00, 0x00, 0x62, 
-0x03, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x68, 0x03, 0x76, 0x03, 0x00, 0x00, 0x00, 0x00, 0x68, 
-0x03, 0xa2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x5c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x57, 
-0x03, 0x8a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 
-0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x01, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0x02, 0x03, 0x00, 0x00, 0x40, 0x04, 0x02, 0x03, 0x00, 0x00, 0x23, 0x05, 0x02, 0x03, 0x00, 0x00, 
-0xcf, 0x07, 0x02, 0x03, 0x00, 0x00, 0x5e, 0x08, 0x02, 0x03, 0x00, 0x00, 0x26, 0x09, 0x02, 0x03, 
-0x00, 0x00, 0x24, 0x1a, 0x02, 0x03, 0x00, 0x00, 0x5b, 0x1b, 0x02, 0x03, 0x00, 0x00, 0x5d, 0x2b, 
-0x02, 0x03, 0x00, 0x00, 0x7c, 0x33, 0x02, 0x03, 0x00, 0x00, 0x3c, 0x34, 0x02, 0x03, 0x00, 0x00, 
-0x3e, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x00, 
-0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0xfc, 0x05, 0x02, 0x05, 0x00, 0x3b, 0xa0, 
-0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 
-0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x42, 
-0x00, 0xa5, 0x85, 0xfd, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 
-0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 
-0xe5, 0x95, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xeb, 
-0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 
-0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 
-0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xed, 0x9d, 
-0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 0x00, 0x2a, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x78, 0x2b, 0x01, 
-0x01, 0x00, 0x2f, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 
-0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 
-0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 
-0x35, 0x01, 0x00, 0x2e, 0x2c, 0x00, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x03, 0x00, 
-0x00, 0xfd, 0x36, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x79, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 
-0x01, 0x01, 0x00, 0xfc, 0x05, 0x02, 0x01, 0x00, 0x3b, 0xfd, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 
-0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 
-0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x41, 0x00, 0xa5, 0x85, 0x15, 0x41, 0x00, 
-0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 
-0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xea, 0x9a, 
-0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 
-0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 
-0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 
-0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 0x00, 
-0x2a, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x7a, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 0x41, 0x00, 0xef, 
-0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 
-0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 
-0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 0x00, 0x2e, 0x2c, 0x00, 0x05, 
-0x02, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x03, 0x01, 0x01, 
-0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0xef, 0x05, 0x02, 0x05, 0x00, 0x3b, 0xa0, 0x07, 0x01, 0x01, 
-0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 0x00, 0xbd, 0xbe, 0x11, 0x41, 0x00, 0xa4, 
-0xa5, 0x12, 0x41, 0x00, 0xe7, 0xe8, 0x13, 0x41, 0x00, 0xc6, 0xc7, 0x14, 0x42, 0x00, 0xa8, 0xa9, 
-0xcf, 0x15, 0x41, 0x00, 0xd4, 0xd5, 0x16, 0x41, 0x00, 0xac, 0xad, 0x17, 0x41, 0x00, 0xf5, 0xf6, 
-0x18, 0x41, 0x00, 0xf9, 0xfa, 0x19, 0x41, 0x00, 0xf3, 0xf4, 0x1a, 0x41, 0x00, 0xb5, 0xb6, 0x1b, 
-0x41, 0x00, 0x9e, 0x9f, 0x1e, 0x41, 0x00, 0xaa, 0xab, 0x1f, 0x41, 0x00, 0xf1, 0xf2, 0x20, 0x41, 
-0x00, 0xeb, 0xec, 0x21, 0x41, 0x00, 0xa0, 0xa1, 0x22, 0x41, 0x00, 0xd8, 0xdd, 0x23, 0x41, 0x00, 
-0xe1, 0xe2, 0x24, 0x41, 0x00, 0xd6, 0xd7, 0x25, 0x41, 0x00, 0xd0, 0xd1, 0x26, 0x41, 0x00, 0xa6, 
-0xa7, 0x27, 0x41, 0x00, 0xe9, 0xea, 0x28, 0x41, 0x00, 0xf7, 0xf8, 0x29, 0x41, 0x00, 0x84, 0x85, 
-0x2a, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x7c, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 0xc1, 0x00, 0xde, 
-0x2c, 0xe0, 0x00, 0x2d, 0x41, 0x00, 0xfb, 0xfc, 0x2e, 0x41, 0x00, 0xe3, 0xe4, 0x2f, 0x41, 0x00, 
-0xd2, 0xd3, 0x30, 0x41, 0x00, 0xb7, 0xb8, 0x31, 0x41, 0x00, 0xe5, 0xe6, 0x32, 0x41, 0x00, 0xed, 
-0xee, 0x33, 0x41, 0x00, 0xa2, 0xa3, 0x34, 0x41, 0x00, 0x9c, 0x9d, 0x35, 0x01, 0x00, 0x2e, 0x2c, 
-0x00, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x03, 0x00, 0x00, 0xcf, 0x36, 0x03, 0x0f, 
-0x00, 0x00, 0x00, 0x7d, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0xef, 0x05, 
-0x01, 0x01, 0x00, 0x3b, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 
-0x00, 0xbd, 0xbe, 0x11, 0x41, 0x00, 0xa4, 0xa5, 0x12, 0x41, 0x00, 0xe7, 0xe8, 0x13, 0x41, 0x00, 
-0xc6, 0xc7, 0x14, 0x41, 0x00, 0xa8, 0xa9, 0x15, 0x41, 0x00, 0xd4, 0xd5, 0x16, 0x41, 0x00, 0xac, 
-0xad, 0x17, 0x41, 0x00, 0xf5, 0xf6, 0x18, 0x41, 0x00, 0xf9, 0xfa, 0x19, 0x41, 0x00, 0xf3, 0xf4, 
-0x1a, 0x41, 0x00, 0xb5, 0xb6, 0x1b, 0x41, 0x00, 0x9e, 0x9f, 0x1e, 0x41, 0x00, 0xaa, 0xab, 0x1f, 
-0x41, 0x00, 0xf1, 0xf2, 0x20, 0x41, 0x00, 0xeb, 0xec, 0x21, 0x41, 0x00, 0xa0, 0xa1, 0x22, 0x41, 
-0x00, 0xd8, 0xdd, 0x23, 0x41, 0x00, 0xe1, 0xe2, 0x24, 0x41, 0x00, 0xd6, 0xd7, 0x25, 0x41, 0x00, 
-0xd0, 0xd1, 0x26, 0x41, 0x00, 0xa6, 0xa7, 0x27, 0x41, 0x00, 0xe9, 0xea, 0x28, 0x41, 0x00, 0xf7, 
-0xf8, 0x29, 0x41, 0x00, 0x84, 0x85, 0x2a, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x7e, 0x2b, 0x01, 0x01, 
-0x00, 0x2f, 0x2c, 0xc1, 0x00, 0xde, 0x2c, 0xe0, 0x00, 0x2d, 0x41, 0x00, 0xfb, 0xfc, 0x2e, 0x41, 
-0x00, 0xe3, 0xe4, 0x2f, 0x41, 0x00, 0xd2, 0xd3, 0x30, 0x41, 0x00, 0xb7, 0xb8, 0x31, 0x41, 0x00, 
-0xe5, 0xe6, 0x32, 0x41, 0x00, 0xed, 0xee, 0x33, 0x41, 0x00, 0xa2, 0xa3, 0x34, 0x41, 0x00, 0x9c, 
-0x9d, 0x35, 0x01, 0x00, 0x2e, 0x2c, 0x00, 0x36, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x32, 
-0xeb, 0x04, 0x04, 0xbb, 0x01, 0x52, 0x55, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x28, 0x03, 0xd1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x28, 0x03, 0xd8, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x62, 0x03, 0xd8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x62, 0x03, 0xe0, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x68, 0x03, 0xd8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x68, 0x03, 0xe1, 0x02, 0x00, 
-0x00, 0x00, 0x00, 0x57, 0x03, 0xdd, 0x04, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0xe7, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x5a, 0x03, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x00, 0x40, 0x04, 0x02, 0x03, 0x00, 0x00, 0x23, 0x05, 
-0x02, 0x03, 0x00, 0x00, 0x24, 0x07, 0x02, 0x03, 0x00, 0x00, 0x5e, 0x08, 0x02, 0x03, 0x00, 0x00, 
-0x26, 0x09, 0x03, 0x03, 0x00, 0x00, 0x2a, 0x1f, 0x0d, 0x03, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x1a, 
-0x02, 0x03, 0x00, 0x00, 0x5b, 0x1b, 0x02, 0x03, 0x00, 0x00, 0x5d, 0x33, 0x02, 0x03, 0x00, 0x00, 
-0x3c, 0x34, 0x02, 0x03, 0x00, 0x00, 0x3e, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x02, 
-0x01, 0x00, 0xfc, 0x31, 0x03, 0x01, 0x00, 0x2d, 0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 0x01, 
-0x00, 0x22, 0x34, 0x06, 0x01, 0x00, 0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 0x00, 
-0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 0x38, 0x0a, 0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 0x00, 0x25, 
-0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 0x0d, 0x01, 0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 0xa9, 0x89, 
-0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 
-0x42, 0x00, 0xa5, 0x85, 0xfd, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 
-0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 
-0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 
-0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 
-0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 
-0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xed, 
-0x9d, 0x29, 0x01, 0x00, 0x7c, 0x2b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 0x01, 
-0x00, 0x29, 0x28, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 
-0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 
-0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 
-0x35, 0xc1, 0x00, 0xf1, 0x35, 0xf0, 0x00, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 
-0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x02, 0x01, 0x00, 0xfc, 0x31, 0x03, 0x01, 0x00, 0x2d, 
-0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 0x01, 0x00, 0x22, 0x34, 0x06, 0x01, 0x00, 0x3a, 0x35, 
-0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 0x38, 0x0a, 
-0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 0x00, 0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 0x0d, 0x01, 
-0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 
-0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x41, 0x00, 0xa5, 0x85, 0x15, 0x41, 0x00, 0xad, 
-0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 
-0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 
-0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 
-0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 
-0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 
-0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0x01, 0x00, 0x7c, 0x2b, 0x2a, 0x04, 0x1f, 
-0x00, 0x00, 0x00, 0x00, 0x7a, 0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 
-0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 
-0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 
-0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0xc1, 0x00, 0xf1, 0x35, 0xf0, 0x00, 0x00, 0x36, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x02, 0x01, 0x00, 0xef, 0x31, 0x03, 0x01, 0x00, 
-0x2d, 0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 0x01, 0x00, 0x22, 0x34, 0x06, 0x01, 0x00, 0x3a, 
-0x35, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 0x38, 
-0x0a, 0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 0x00, 0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 0x0d, 
-0x01, 0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 0xbd, 0xbe, 0x11, 0x41, 0x00, 0xa4, 0xa5, 0x12, 0x41, 
-0x00, 0xe7, 0xe8, 0x13, 0x41, 0x00, 0xc6, 0xc7, 0x14, 0x42, 0x00, 0xa8, 0xa9, 0xcf, 0x15, 0x41, 
-0x00, 0xd4, 0xd5, 0x16, 0x41, 0x00, 0xac, 0xad, 0x17, 0x41, 0x00, 0xf5, 0xf6, 0x18, 0x41, 0x00, 
-0xf9, 0xfa, 0x19, 0x41, 0x00, 0xf3, 0xf4, 0x1a, 0x41, 0x00, 0xb5, 0xb6, 0x1b, 0x41, 0x00, 0x9e, 
-0x9f, 0x1e, 0x41, 0x00, 0xaa, 0xab, 0x1f, 0x41, 0x00, 0xf1, 0xf2, 0x20, 0x41, 0x00, 0xeb, 0xec, 
-0x21, 0x41, 0x00, 0xa0, 0xa1, 0x22, 0x41, 0x00, 0xd8, 0xdd, 0x23, 0x41, 0x00, 0xe1, 0xe2, 0x24, 
-0x41, 0x00, 0xd6, 0xd7, 0x25, 0x41, 0x00, 0xd0, 0xd1, 0x26, 0x41, 0x00, 0xa6, 0xa7, 0x27, 0x41, 
-0x00, 0xe9, 0xea, 0x28, 0x41, 0x00, 0xf7, 0xf8, 0x29, 0x01, 0x00, 0x7c, 0x2b, 0x2a, 0x04, 0x1f, 
-0x00, 0x00, 0x00, 0x00, 0x7c, 0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 0xc1, 0x00, 0xde, 0x2c, 0xe0, 
-0x00, 0x2d, 0x41, 0x00, 0xfb, 0xfc, 0x2e, 0x41, 0x00, 0xe3, 0xe4, 0x2f, 0x41, 0x00, 0xd2, 0xd3, 
-0x30, 0x41, 0x00, 0xb7, 0xb8, 0x31, 0x41, 0x00, 0xe5, 0xe6, 0x32, 0x41, 0x00, 0xed, 0xee, 0x33, 
-0x41, 0x00, 0xa2, 0xa3, 0x34, 0x41, 0x00, 0x9c, 0x9d, 0x35, 0x41, 0x00, 0x84, 0x85, 0x00, 0x12, 
-0x42, 0x03, 0x00, 0x00, 0xcf, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x02, 0x01, 
-0x00, 0xef, 0x31, 0x03, 0x01, 0x00, 0x2d, 0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 0x01, 0x00, 
-0x22, 0x34, 0x06, 0x01, 0x00, 0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 0x00, 0x2e, 
-0x37, 0x09, 0x01, 0x00, 0x5f, 0x38, 0x0a, 0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 0x00, 0x25, 0x30, 
-0x0c, 0x01, 0x00, 0x21, 0x3d, 0x0d, 0x01, 0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 0xbd, 0xbe, 0x11, 
-0x41, 0x00, 0xa4, 0xa5, 0x12, 0x41, 0x00, 0xe7, 0xe8, 0x13, 0x41, 0x00, 0xc6, 0xc7, 0x14, 0x41, 
-0x00, 0xa8, 0xa9, 0x15, 0x41, 0x00, 0xd4, 0xd5, 0x16, 0x41, 0x00, 0xac, 0xad, 0x17, 0x41, 0x00, 
-0xf5, 0xf6, 0x18, 0x41, 0x00, 0xf9, 0xfa, 0x19, 0x41, 0x00, 0xf3, 0xf4, 0x1a, 0x41, 0x00, 0xb5, 
-0xb6, 0x1b, 0x41, 0x00, 0x9e, 0x9f, 0x1e, 0x41, 0x00, 0xaa, 0xab, 0x1f, 0x41, 0x00, 0xf1, 0xf2, 
-0x20, 0x41, 0x00, 0xeb, 0xec, 0x21, 0x41, 0x00, 0xa0, 0xa1, 0x22, 0x41, 0x00, 0xd8, 0xdd, 0x23, 
-0x41, 0x00, 0xe1, 0xe2, 0x24, 0x41, 0x00, 0xd6, 0xd7, 0x25, 0x41, 0x00, 0xd0, 0xd1, 0x26, 0x41, 
-0x00, 0xa6, 0xa7, 0x27, 0x41, 0x00, 0xe9, 0xea, 0x28, 0x41, 0x00, 0xf7, 0xf8, 0x29, 0x01, 0x00, 
-0x7c, 0x2b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 
-0xc1, 0x00, 0xde, 0x2c, 0xe0, 0x00, 0x2d, 0x41, 0x00, 0xfb, 0xfc, 0x2e, 0x41, 0x00, 0xe3, 0xe4, 
-0x2f, 0x41, 0x00, 0xd2, 0xd3, 0x30, 0x41, 0x00, 0xb7, 0xb8, 0x31, 0x41, 0x00, 0xe5, 0xe6, 0x32, 
-0x41, 0x00, 0xed, 0xee, 0x33, 0x41, 0x00, 0xa2, 0xa3, 0x34, 0x41, 0x00, 0x9c, 0x9d, 0x35, 0x41, 
-0x00, 0x84, 0x85, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0xbb, 0xfe, 0x07, 
-0x09, 0x00, 0x00, 0x52, 0x58, 0x2c, 0xb9, 0x01, 0x52, 0x58, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x75, 0xd8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x75, 
-0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x75, 0xdb, 0x02, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x75, 
-0xe7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x75, 0xda, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x75, 
-0xea, 0x02, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x75, 0xd1, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x75, 
-0xe9, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x75, 0xca, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x75, 
-0xe0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x75, 0xc7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x40, 0x75, 
-0xd9, 0x05, 0x00, 0x00, 0x00, 0x00, 0x41, 0x75, 0xb4, 0x07, 0x00, 0x00, 0x00, 0x00, 0x41, 0x75, 
-0xd6, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 
-0x03, 0x00, 0x00, 0x40, 0x04, 0x02, 0x03, 0x00, 0x00, 0x23, 0x07, 0x02, 0x03, 0x00, 0x00, 0x5e, 
-0x08, 0x02, 0x03, 0x00, 0x00, 0x26, 0x09, 0x02, 0x03, 0x00, 0x00, 0x24, 0x0c, 0x03, 0x03, 0x00, 
-0x00, 0x5b, 0x7b, 0x1a, 0x03, 0x03, 0x00, 0x00, 0x5b, 0x7b, 0x1b, 0x03, 0x03, 0x00, 0x00, 0x5d, 
-0x7d, 0x2b, 0x02, 0x03, 0x00, 0x00, 0x7c, 0x33, 0x02, 0x03, 0x00, 0x00, 0x3c, 0x34, 0x02, 0x03, 
-0x00, 0x00, 0x3e, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0xfc, 0x05, 0x01, 
-0x01, 0x00, 0x3b, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x0d, 0x02, 0x02, 
-0xfe, 0x00, 0x3d, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x43, 0x00, 0xe6, 0x96, 0xf7, 0xf6, 0x12, 
-0x43, 0x00, 0xe3, 0x93, 0xb8, 0xb5, 0x13, 0x43, 0x00, 0xaa, 0x8a, 0xd1, 0xcf, 0x14, 0x42, 0x00, 
-0xa5, 0x85, 0xfd, 0x15, 0x43, 0x00, 0xad, 0x8d, 0xfb, 0xfa, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 
-0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x43, 
-0x00, 0xe5, 0x95, 0xc6, 0xbe, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 
-0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x43, 0x00, 0xa0, 0x80, 0xd5, 0xd4, 
-0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x43, 0x00, 0xae, 
-0x8e, 0xf5, 0xf4, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x43, 0x00, 
-0xa6, 0x86, 0xf9, 0xf8, 0x28, 0x43, 0x00, 0xed, 0x9d, 0xf3, 0xf2, 0x29, 0xc1, 0x00, 0xf1, 0x29, 
-0xf0, 0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 
-0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 
-0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 
-0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 0x00, 0x2e, 
-0x2c, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 
-0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0xfc, 0x05, 0x02, 0x01, 0x00, 0x3b, 
-0xfd, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x43, 0x00, 0xa9, 0x89, 
-0xd2, 0xd1, 0x11, 0x43, 0x00, 0xe6, 0x96, 0xb6, 0xb5, 0x12, 0x43, 0x00, 0xe3, 0x93, 0xf7, 0xf6, 
-0x13, 0x43, 0x00, 0xaa, 0x8a, 0xd6, 0xd5, 0x14, 0x43, 0x00, 0xa5, 0x85, 0xfb, 0xfa, 0x15, 0x43, 
-0x00, 0xad, 0x8d, 0xd4, 0xd3, 0x16, 0x43, 0x00, 0xa3, 0x83, 0xd8, 0xd7, 0x17, 0x43, 0x00, 0xe8, 
-0x98, 0xb8, 0xb7, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x43, 0x00, 
-0xe5, 0x95, 0xbe, 0xbd, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 
-0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 
-0xaf, 0x8f, 0x23, 0xc3, 0x00, 0xe0, 0x00, 0x90, 0x23, 0xf9, 0x23, 0xf8, 0x23, 0x24, 0x43, 0x00, 
-0xae, 0x8e, 0xf3, 0xf2, 0x25, 0x43, 0x00, 0xab, 0x8b, 0xf5, 0xf4, 0x26, 0x41, 0x00, 0xa4, 0x84, 
-0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 
-0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 0x41, 
-0x00, 0xef, 0x9f, 0x2d, 0x43, 0x00, 0xe7, 0x97, 0xc7, 0xc6, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 
-0x41, 0x00, 0xac, 0x8c, 0x30, 0x43, 0x00, 0xa8, 0x88, 0xd0, 0xcf, 0x31, 0x41, 0x00, 0xe2, 0x92, 
-0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 
-0x01, 0x00, 0x2e, 0x2c, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 
-0x00, 0x00, 0x7b, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0xfc, 0x05, 0x02, 
-0x01, 0x00, 0x3b, 0xfd, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 
-0x00, 0xa9, 0x89, 0x11, 0x43, 0x00, 0xe6, 0x96, 0xd4, 0xd3, 0x12, 0x43, 0x00, 0xe3, 0x93, 0xb8, 
-0xb5, 0x13, 0x43, 0x00, 0xaa, 0x8a, 0xc7, 0xbd, 0x14, 0x43, 0x00, 0xa5, 0x85, 0xf7, 0xf6, 0x15, 
-0x43, 0x00, 0xad, 0x8d, 0xfb, 0xfa, 0x16, 0x43, 0x00, 0xa3, 0x83, 0xb7, 0xb6, 0x17, 0x41, 0x00, 
-0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x43, 0x00, 0xa7, 0x87, 0xd6, 0xd5, 0x1a, 0x43, 
-0x00, 0xe5, 0x95, 0xc6, 0xbe, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 
-0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x43, 0x00, 0xa0, 0x80, 0xf3, 0xf2, 
-0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x43, 0x00, 0xae, 
-0x8e, 0xf5, 0xf4, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x43, 0x00, 
-0xa6, 0x86, 0xd2, 0xd1, 0x28, 0x43, 0x00, 0xed, 0x9d, 0xd0, 0xcf, 0x29, 0xc1, 0x00, 0xf1, 0x29, 
-0xf0, 0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 
-0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x43, 0x00, 0xe1, 0x91, 0xd8, 0xd7, 
-0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 
-0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 
-0x00, 0x2e, 0x2c, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x7d, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0xfc, 0x05, 0x01, 0x01, 
-0x00, 0x3b, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 0x00, 0xa9, 
-0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x43, 0x00, 0xe3, 0x93, 0xf7, 0xf6, 0x13, 0x41, 0x00, 
-0xaa, 0x8a, 0x14, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x15, 0x43, 0x00, 0xad, 0x8d, 0xd5, 0xd4, 0x16, 
-0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x43, 
-0x00, 0xa7, 0x87, 0xc6, 0xbe, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 
-0x41, 0x00, 0xe4, 0x94, 0x1f, 0x43, 0x00, 0xeb, 0x9b, 0xfb, 0xfa, 0x20, 0x41, 0x00, 0xa2, 0x82, 
-0x21, 0x43, 0x00, 0xa0, 0x80, 0xf3, 0xf2, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 
-0x00, 0x90, 0x23, 0x24, 0x43, 0x00, 0xae, 0x8e, 0xf5, 0xf4, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 
-0x41, 0x00, 0xa4, 0x84, 0x27, 0x43, 0x00, 0xa6, 0x86, 0xb8, 0xb5, 0x28, 0x41, 0x00, 0xed, 0x9d, 
-0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x2b, 
-0x01, 0x01, 0x00, 0x2f, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x43, 0x00, 0xe7, 0x97, 0xd1, 0xcf, 
-0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x43, 0x00, 0xa8, 0x88, 0xf9, 
-0xf8, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 
-0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 0x00, 0x2e, 0x2c, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 
-0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 
-0x01, 0x01, 0x00, 0xfc, 0x05, 0x01, 0x01, 0x00, 0x3b, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 
-0x01, 0x00, 0x3f, 0x10, 0x43, 0x00, 0xa9, 0x89, 0xde, 0xdd, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 
-0x43, 0x00, 0xe3, 0x93, 0xf7, 0xf6, 0x13, 0x43, 0x00, 0xaa, 0x8a, 0xd5, 0xd4, 0x14, 0x42, 0x00, 
-0xa5, 0x85, 0xfd, 0x15, 0x43, 0x00, 0xad, 0x8d, 0xd1, 0xcf, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 
-0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 
-0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 
-0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x43, 0x00, 0xa0, 0x80, 0xf3, 0xf2, 0x22, 0x41, 
-0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x43, 0x00, 0xae, 0x8e, 0xf5, 
-0xf4, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x43, 0x00, 0xa6, 0x86, 
-0xfb, 0xfa, 0x28, 0x43, 0x00, 0xed, 0x9d, 0xc6, 0xbe, 0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 0x00, 
-0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 0x43, 0x00, 
-0xef, 0x9f, 0xb8, 0xb5, 0x2d, 0x43, 0x00, 0xe7, 0x97, 0xf9, 0xf8, 0x2e, 0x41, 0x00, 0xe1, 0x91, 
-0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 
-0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 
-0x00, 0x2e, 0x2c, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x81, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0xfc, 0x05, 0x02, 0x01, 
-0x00, 0x3b, 0xfd, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 0x00, 
-0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x43, 0x00, 0xe3, 0x93, 0xf7, 0xf6, 0x13, 0x41, 
-0x00, 0xaa, 0x8a, 0x14, 0x43, 0x00, 0xa5, 0x85, 0xdd, 0xdc, 0x15, 0x43, 0x00, 0xad, 0x8d, 0xdf, 
-0xde, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 
-0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 
-0x41, 0x00, 0xe4, 0x94, 0x1f, 0x43, 0x00, 0xeb, 0x9b, 0xfb, 0xfa, 0x20, 0x41, 0x00, 0xa2, 0x82, 
-0x21, 0x43, 0x00, 0xa0, 0x80, 0xf3, 0xf2, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 
-0x00, 0x90, 0x23, 0x24, 0x43, 0x00, 0xae, 0x8e, 0xf5, 0xf4, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 
-0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x43, 0x00, 0xed, 0x9d, 0xc6, 0xbe, 
-0x29, 0xc3, 0x00, 0xf1, 0x29, 0xf0, 0x00, 0xb8, 0x29, 0xb5, 0x29, 0x2a, 0x04, 0x1f, 0x00, 0x00, 
-0x00, 0x00, 0x82, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 0x43, 0x00, 0xef, 0x9f, 0xd5, 0xd4, 0x2d, 
-0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x43, 
-0x00, 0xa8, 0x88, 0xf9, 0xf8, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 
-0x41, 0x00, 0xa1, 0x81, 0x34, 0x43, 0x00, 0xee, 0x9e, 0xd1, 0xcf, 0x35, 0x01, 0x00, 0x2e, 0x2c, 
-0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 
-0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0xfc, 0x05, 0x01, 0x01, 0x00, 0x3b, 0x07, 
-0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 
-0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x42, 0x00, 
-0xa5, 0x85, 0xfd, 0x15, 0x43, 0x00, 0xad, 0x8d, 0xb8, 0xb5, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 
-0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 
-0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 
-0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 
-0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x43, 0x00, 0xae, 0x8e, 0xf5, 0xf4, 0x25, 
-0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x43, 
-0x00, 0xed, 0x9d, 0xc6, 0xbe, 0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 0x00, 0x2a, 0x04, 0x1f, 0x00, 
-0x00, 0x00, 0x00, 0x84, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 
-0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x43, 0x00, 
-0xa8, 0x88, 0xd1, 0xcf, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 
-0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 0x00, 0x2e, 0x2c, 0x00, 0x12, 0x42, 
-0x03, 0x00, 0x00, 0xfd, 0x16, 0x43, 0x03, 0x00, 0x00, 0xf7, 0xf6, 0x18, 0x43, 0x03, 0x00, 0x00, 
-0xf5, 0xf4, 0x1e, 0x43, 0x03, 0x00, 0x00, 0xf3, 0xf2, 0x1f, 0x43, 0x03, 0x00, 0x00, 0xfb, 0xfa, 
-0x2c, 0x43, 0x03, 0x00, 0x00, 0xd5, 0xd4, 0x2d, 0x43, 0x03, 0x00, 0x00, 0xde, 0xdd, 0x2e, 0x43, 
-0x03, 0x00, 0x00, 0xf9, 0xf8, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x92, 0xe0, 
-0x08, 0x04, 0xbb, 0x01, 0x52, 0x58, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x3b, 0x75, 0xed, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x75, 0xe1, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x3c, 0x75, 0x13, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x75, 0xfc, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x3d, 0x75, 0x35, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x75, 0x22, 0x03, 0x00, 0x00, 
-0x00, 0x00, 0x3e, 0x75, 0x4f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x75, 0x44, 0x04, 0x00, 0x00, 
-0x00, 0x00, 0x3f, 0x75, 0x6b, 0x06, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x75, 0x5e, 0x05, 0x00, 0x00, 
-0x00, 0x00, 0x40, 0x75, 0x8b, 0x07, 0x00, 0x00, 0x00, 0x00, 0x40, 0x75, 0x7a, 0x06, 0x00, 0x00, 
-0x00, 0x00, 0x41, 0x75, 0x9b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x41, 0x75, 0x9a, 0x07, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x00, 0x40, 
-0x04, 0x02, 0x03, 0x00, 0x00, 0x23, 0x05, 0x02, 0x03, 0x00, 0x00, 0x24, 0x07, 0x02, 0x03, 0x00, 
-0x00, 0x5e, 0x08, 0x02, 0x03, 0x00, 0x00, 0x26, 0x09, 0x02, 0x03, 0x00, 0x00, 0x2a, 0x1a, 0x02, 
-0x03, 0x00, 0x00, 0x5b, 0x1b, 0x02, 0x03, 0x00, 0x00, 0x5d, 0x33, 0x02, 0x03, 0x00, 0x00, 0x3c, 
-0x34, 0x02, 0x03, 0x00, 0x00, 0x3e, 0x00, 0x02, 0x01, 0x00, 0xfc, 0x31, 0x03, 0x01, 0x00, 0x2d, 
-0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 0x01, 0x00, 0x22, 0x34, 0x06, 0x01, 0x00, 0x3a, 0x35, 
-0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 0x38, 0x0a, 
-0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 0x00, 0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 0x0d, 0x01, 
-0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x43, 0x00, 0xe6, 0x96, 0xf7, 0xf6, 0x12, 
-0x43, 0x00, 0xe3, 0x93, 0xb8, 0xb5, 0x13, 0x43, 0x00, 0xaa, 0x8a, 0xd1, 0xcf, 0x14, 0x42, 0x00, 
-0xa5, 0x85, 0xfd, 0x15, 0x43, 0x00, 0xad, 0x8d, 0xfb, 0xfa, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 
-0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x43, 
-0x00, 0xe5, 0x95, 0xc6, 0xbe, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 
-0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x43, 0x00, 0xa0, 0x80, 0xd5, 0xd4, 
-0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x43, 0x00, 0xae, 
-0x8e, 0xf5, 0xf4, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x43, 0x00, 
-0xa6, 0x86, 0xf9, 0xf8, 0x28, 0x43, 0x00, 0xed, 0x9d, 0xf3, 0xf2, 0x29, 0x02, 0x00, 0xfe, 0x2b, 
-0x7c, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 0x41, 
-0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 
-0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 
-0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0xc1, 0x00, 0xf1, 0x35, 
-0xf0, 0x00, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 
-0x79, 0x00, 0x02, 0x01, 0x00, 0xfc, 0x31, 0x03, 0x01, 0x00, 0x2d, 0x32, 0x04, 0x01, 0x00, 0x2f, 
-0x33, 0x05, 0x02, 0x00, 0x22, 0x34, 0xfd, 0x06, 0x01, 0x00, 0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 
-0x36, 0x08, 0x01, 0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 0x38, 0x0a, 0x01, 0x00, 0x3f, 0x39, 
-0x0b, 0x01, 0x00, 0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 0x0d, 0x01, 0x00, 0x3b, 0x5c, 0x10, 
-0x43, 0x00, 0xa9, 0x89, 0xd2, 0xd1, 0x11, 0x43, 0x00, 0xe6, 0x96, 0xb6, 0xb5, 0x12, 0x43, 0x00, 
-0xe3, 0x93, 0xf7, 0xf6, 0x13, 0x43, 0x00, 0xaa, 0x8a, 0xd6, 0xd5, 0x14, 0x43, 0x00, 0xa5, 0x85, 
-0xfb, 0xfa, 0x15, 0x43, 0x00, 0xad, 0x8d, 0xd4, 0xd3, 0x16, 0x43, 0x00, 0xa3, 0x83, 0xd8, 0xd7, 
-0x17, 0x43, 0x00, 0xe8, 0x98, 0xb8, 0xb7, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 
-0x87, 0x1a, 0x43, 0x00, 0xe5, 0x95, 0xbe, 0xbd, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 
-0xe4, 0x94, 0x1f, 0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 
-0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc3, 0x00, 0xe0, 0x00, 0x90, 0x23, 0xf9, 0x23, 0xf8, 
-0x23, 0x24, 0x43, 0x00, 0xae, 0x8e, 0xf3, 0xf2, 0x25, 0x43, 0x00, 0xab, 0x8b, 0xf5, 0xf4, 0x26, 
-0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0x01, 
-0x00, 0x7c, 0x2b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x2b, 0x01, 0x00, 0x29, 0x28, 
-0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x43, 0x00, 0xe7, 0x97, 0xc7, 0xc6, 0x2e, 0x41, 0x00, 0xe1, 
-0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x43, 0x00, 0xa8, 0x88, 0xd0, 0xcf, 0x31, 0x41, 0x00, 
-0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 
-0x9e, 0x35, 0xc1, 0x00, 0xf1, 0x35, 0xf0, 0x00, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x02, 0x01, 0x00, 0xfc, 0x31, 0x03, 0x01, 0x00, 
-0x2d, 0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 0x02, 0x00, 0x22, 0x34, 0xfd, 0x06, 0x01, 0x00, 
-0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 
-0x38, 0x0a, 0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 0x00, 0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 
-0x0d, 0x01, 0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x43, 0x00, 0xe6, 0x96, 0xd4, 
-0xd3, 0x12, 0x43, 0x00, 0xe3, 0x93, 0xb8, 0xb5, 0x13, 0x43, 0x00, 0xaa, 0x8a, 0xc7, 0xbd, 0x14, 
-0x43, 0x00, 0xa5, 0x85, 0xf7, 0xf6, 0x15, 0x43, 0x00, 0xad, 0x8d, 0xfb, 0xfa, 0x16, 0x43, 0x00, 
-0xa3, 0x83, 0xb7, 0xb6, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x43, 
-0x00, 0xa7, 0x87, 0xd6, 0xd5, 0x1a, 0x43, 0x00, 0xe5, 0x95, 0xc6, 0xbe, 0x1b, 0x41, 0x00, 0xea, 
-0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 
-0x21, 0x43, 0x00, 0xa0, 0x80, 0xf3, 0xf2, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 
-0x00, 0x90, 0x23, 0x24, 0x43, 0x00, 0xae, 0x8e, 0xf5, 0xf4, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 
-0x41, 0x00, 0xa4, 0x84, 0x27, 0x43, 0x00, 0xa6, 0x86, 0xd2, 0xd1, 0x28, 0x43, 0x00, 0xed, 0x9d, 
-0xd0, 0xcf, 0x29, 0x01, 0x00, 0x7c, 0x2b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x2b, 
-0x01, 0x00, 0x29, 0x28, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x43, 
-0x00, 0xe1, 0x91, 0xd8, 0xd7, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 
-0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 
-0x00, 0xee, 0x9e, 0x35, 0xc1, 0x00, 0xf1, 0x35, 0xf0, 0x00, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 
-0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x02, 0x01, 0x00, 0xfc, 0x31, 0x03, 
-0x01, 0x00, 0x2d, 0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 0x01, 0x00, 0x22, 0x34, 0x06, 0x01, 
-0x00, 0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 
-0x5f, 0x38, 0x0a, 0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 0x00, 0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 
-0x3d, 0x0d, 0x01, 0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 
-0x12, 0x43, 0x00, 0xe3, 0x93, 0xf7, 0xf6, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x42, 0x00, 0xa5, 
-0x85, 0xfd, 0x15, 0x43, 0x00, 0xad, 0x8d, 0xd5, 0xd4, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 
-0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x43, 0x00, 0xa7, 0x87, 0xc6, 0xbe, 0x1a, 
-0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x43, 
-0x00, 0xeb, 0x9b, 0xfb, 0xfa, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x43, 0x00, 0xa0, 0x80, 0xf3, 
-0xf2, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x43, 0x00, 
-0xae, 0x8e, 0xf5, 0xf4, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x43, 
-0x00, 0xa6, 0x86, 0xb8, 0xb5, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0x01, 0x00, 0x7c, 0x2b, 0x2a, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 0x41, 0x00, 0xef, 
-0x9f, 0x2d, 0x43, 0x00, 0xe7, 0x97, 0xd1, 0xcf, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 
-0xac, 0x8c, 0x30, 0x43, 0x00, 0xa8, 0x88, 0xf9, 0xf8, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 
-0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0xc1, 0x00, 
-0xf1, 0x35, 0xf0, 0x00, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 
-0x00, 0x00, 0x7f, 0x00, 0x02, 0x01, 0x00, 0xfc, 0x31, 0x03, 0x01, 0x00, 0x2d, 0x32, 0x04, 0x01, 
-0x00, 0x2f, 0x33, 0x05, 0x01, 0x00, 0x22, 0x34, 0x06, 0x01, 0x00, 0x3a, 0x35, 0x07, 0x01, 0x00, 
-0x2c, 0x36, 0x08, 0x01, 0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 0x38, 0x0a, 0x01, 0x00, 0x3f, 
-0x39, 0x0b, 0x01, 0x00, 0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 0x0d, 0x01, 0x00, 0x3b, 0x5c, 
-0x10, 0x43, 0x00, 0xa9, 0x89, 0xde, 0xdd, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x43, 0x00, 0xe3, 
-0x93, 0xf7, 0xf6, 0x13, 0x43, 0x00, 0xaa, 0x8a, 0xd5, 0xd4, 0x14, 0x42, 0x00, 0xa5, 0x85, 0xfd, 
-0x15, 0x43, 0x00, 0xad, 0x8d, 0xd1, 0xcf, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 
-0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 
-0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xeb, 0x9b, 0x20, 
-0x41, 0x00, 0xa2, 0x82, 0x21, 0x43, 0x00, 0xa0, 0x80, 0xf3, 0xf2, 0x22, 0x41, 0x00, 0xaf, 0x8f, 
-0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x43, 0x00, 0xae, 0x8e, 0xf5, 0xf4, 0x25, 0x41, 
-0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x43, 0x00, 0xa6, 0x86, 0xfb, 0xfa, 0x28, 
-0x43, 0x00, 0xed, 0x9d, 0xc6, 0xbe, 0x29, 0x01, 0x00, 0x7c, 0x2b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 
-0x00, 0x00, 0x80, 0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 0x43, 0x00, 0xef, 0x9f, 0xb8, 0xb5, 0x2d, 
-0x43, 0x00, 0xe7, 0x97, 0xf9, 0xf8, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 
-0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 
-0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0xc1, 0x00, 0xf1, 0x35, 0xf0, 0x00, 
-0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 
-0x02, 0x01, 0x00, 0xfc, 0x31, 0x03, 0x01, 0x00, 0x2d, 0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 
-0x02, 0x00, 0x22, 0x34, 0xfd, 0x06, 0x01, 0x00, 0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 
-0x01, 0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 0x38, 0x0a, 0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 
-0x00, 0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 0x0d, 0x01, 0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 
-0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x43, 0x00, 0xe3, 0x93, 0xf7, 0xf6, 0x13, 0x41, 
-0x00, 0xaa, 0x8a, 0x14, 0x43, 0x00, 0xa5, 0x85, 0xdd, 0xdc, 0x15, 0x43, 0x00, 0xad, 0x8d, 0xdf, 
-0xde, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 
-0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 
-0x41, 0x00, 0xe4, 0x94, 0x1f, 0x43, 0x00, 0xeb, 0x9b, 0xfb, 0xfa, 0x20, 0x41, 0x00, 0xa2, 0x82, 
-0x21, 0x43, 0x00, 0xa0, 0x80, 0xf3, 0xf2, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 
-0x00, 0x90, 0x23, 0x24, 0x43, 0x00, 0xae, 0x8e, 0xf5, 0xf4, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 
-0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x43, 0x00, 0xed, 0x9d, 0xc6, 0xbe, 
-0x29, 0x01, 0x00, 0x7c, 0x2b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x82, 0x2b, 0x01, 0x00, 
-0x29, 0x28, 0x2c, 0x43, 0x00, 0xef, 0x9f, 0xd5, 0xd4, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 
-0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x43, 0x00, 0xa8, 0x88, 0xf9, 0xf8, 0x31, 
-0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x43, 
-0x00, 0xee, 0x9e, 0xd1, 0xcf, 0x35, 0xc3, 0x00, 0xf1, 0x35, 0xf0, 0x00, 0xb8, 0x35, 0xb5, 0x35, 
-0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 
-0x02, 0x01, 0x00, 0xfc, 0x31, 0x03, 0x01, 0x00, 0x2d, 0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 
-0x01, 0x00, 0x22, 0x34, 0x06, 0x01, 0x00, 0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 
-0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 0x38, 0x0a, 0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 0x00, 
-0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 0x0d, 0x01, 0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 0xa9, 
-0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 
-0x14, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x15, 0x43, 0x00, 0xad, 0x8d, 0xb8, 0xb5, 0x16, 0x41, 0x00, 
-0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 
-0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 
-0x1f, 0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 
-0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x43, 0x00, 0xae, 0x8e, 
-0xf5, 0xf4, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 
-0x86, 0x28, 0x43, 0x00, 0xed, 0x9d, 0xc6, 0xbe, 0x29, 0x01, 0x00, 0x7c, 0x2b, 0x2a, 0x04, 0x1f, 
-0x00, 0x00, 0x00, 0x00, 0x84, 0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 
-0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x43, 
-0x00, 0xa8, 0x88, 0xd1, 0xcf, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 
-0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0xc1, 0x00, 0xf1, 0x35, 0xf0, 0x00, 
-0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x16, 0x43, 0x03, 0x00, 0x00, 0xf7, 0xf6, 0x18, 0x43, 
-0x03, 0x00, 0x00, 0xf5, 0xf4, 0x1e, 0x43, 0x03, 0x00, 0x00, 0xf3, 0xf2, 0x1f, 0x43, 0x03, 0x00, 
-0x00, 0xfb, 0xfa, 0x2c, 0x43, 0x03, 0x00, 0x00, 0xd5, 0xd4, 0x2d, 0x43, 0x03, 0x00, 0x00, 0xde, 
-0xdd, 0x2e, 0x43, 0x03, 0x00, 0x00, 0xf9, 0xf8, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x85, 
-0x00, 0x4d, 0x4e, 0x03, 0x09, 0x00, 0x00, 0x54, 0x52, 0x2c, 0xb3, 0x00, 0x54, 0x52, 0x05, 0x04, 
-0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x03, 0xbb, 0x01, 0xdd, 0x01, 
-0x00, 0x00, 0x55, 0x03, 0x60, 0x02, 0xb7, 0x02, 0x00, 0x00, 0x5a, 0x03, 0x00, 0x00, 0x44, 0x01, 
-0x00, 0x00, 0x52, 0x03, 0x3d, 0x01, 0x44, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 
-0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x3e, 
-0x03, 0x02, 0x01, 0x00, 0x27, 0x9c, 0x04, 0x03, 0x03, 0x00, 0xc8, 0x23, 0x1e, 0x05, 0x02, 0x01, 
-0x00, 0x2b, 0x24, 0x06, 0x02, 0x03, 0x00, 0x00, 0xab, 0x07, 0x01, 0x01, 0x00, 0x26, 0x08, 0x02, 
-0x01, 0x00, 0x2f, 0x7b, 0x09, 0x03, 0x01, 0x00, 0x28, 0x5b, 0x1b, 0x0a, 0x03, 0x01, 0x00, 0x29, 
-0x5d, 0x1d, 0x0b, 0x02, 0x01, 0x00, 0x3d, 0x7d, 0x0c, 0x03, 0x00, 0x2a, 0x3f, 0x5c, 0x1c, 0x0d, 
-0x03, 0x00, 0x2d, 0x5f, 0x7c, 0x1f, 0x10, 0x42, 0x03, 0x00, 0x00, 0x40, 0x12, 0x42, 0x00, 0x65, 
-0x45, 0xd5, 0x13, 0x42, 0x03, 0x00, 0x00, 0xf4, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 
-0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x19, 0x42, 0x03, 0x00, 
-0x00, 0x9c, 0x1a, 0x02, 0x07, 0xa0, 0xa0, 0xc9, 0x1b, 0x42, 0x04, 0x81, 0x9a, 0xca, 0x1e, 0x44, 
-0x08, 0x61, 0x41, 0x91, 0x00, 0x92, 0x1f, 0x42, 0x03, 0x00, 0x00, 0xe1, 0x27, 0x02, 0x07, 0xa0, 
-0xa0, 0xcb, 0x28, 0xc5, 0x00, 0x69, 0x17, 0x49, 0x17, 0x00, 0x17, 0x09, 0x17, 0x00, 0x17, 0x00, 
-0x17, 0x29, 0x02, 0x00, 0x22, 0x82, 0x3c, 0x2b, 0x02, 0x04, 0x2c, 0x3b, 0xcc, 0x2c, 0x42, 0x03, 
-0x00, 0x00, 0xae, 0x2d, 0x42, 0x03, 0x00, 0x00, 0xaf, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x33, 0x42, 
-0x00, 0x94, 0x99, 0x3c, 0x34, 0x42, 0x00, 0x87, 0x80, 0x3e, 0x35, 0x02, 0x00, 0x2e, 0x3a, 0x7c, 
-0x39, 0x00, 0x00, 0x20, 0x56, 0x02, 0x00, 0x3c, 0x3e, 0x7c, 0x00, 0x12, 0x42, 0x07, 0x00, 0x00, 
-0xa0, 0x00, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 
-0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 
-0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 
-0x55, 0x9a, 0x20, 0xf9, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 
-0x4f, 0xe5, 0x20, 0x7e, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 
-0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 
-0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 
-0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x00, 0x17, 0x44, 0x0a, 0x8d, 0x00, 0x69, 0x00, 
-0x98, 0x1a, 0x41, 0x00, 0xa7, 0xa6, 0x27, 0x41, 0x00, 0x9f, 0x9e, 0x28, 0xc5, 0x00, 0x69, 0x17, 
-0x98, 0x17, 0x00, 0x17, 0x09, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x5e, 0x0d, 0x61, 0x83, 0x65, 
-0x88, 0x8d, 0x8c, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x98, 
-0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xf9, 0x0e, 0x61, 0x84, 0x65, 0x89, 0x8d, 0x8b, 0x69, 
-0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0xed, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x98, 0xd8, 0x4f, 
-0x99, 0x55, 0x9a, 0x20, 0xf9, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 
-0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x8d, 0xa1, 0x69, 0xa1, 0x6f, 
-0xa2, 0x75, 0xa3, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x98, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x20, 
-0xef, 0x60, 0x0d, 0x61, 0x85, 0x65, 0x8a, 0x8d, 0xec, 0x69, 0xec, 0x6f, 0x95, 0x75, 0x97, 0x41, 
-0xb7, 0x45, 0xd4, 0x49, 0xde, 0x98, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x00, 0x12, 0x42, 
-0x07, 0x00, 0x00, 0xa0, 0x13, 0x42, 0x03, 0x00, 0x00, 0x14, 0x16, 0x44, 0x0b, 0x00, 0x00, 0xed, 
-0x00, 0xec, 0x17, 0x44, 0x0a, 0xd5, 0x00, 0x69, 0x00, 0x98, 0x1a, 0x41, 0x00, 0xa7, 0xa6, 0x1e, 
-0x44, 0x1f, 0x00, 0x00, 0xa0, 0x00, 0xa0, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x22, 0x41, 0x00, 0x67, 
-0x47, 0x23, 0x41, 0x00, 0x68, 0x48, 0x24, 0x41, 0x00, 0x6a, 0x4a, 0x27, 0x41, 0x00, 0xad, 0xb8, 
-0x28, 0xc5, 0x00, 0x69, 0x17, 0x98, 0x17, 0x00, 0x17, 0x09, 0x17, 0x00, 0x17, 0x00, 0x17, 0x2e, 
-0x41, 0x00, 0x63, 0x43, 0x00, 0x5e, 0x17, 0x61, 0x83, 0x63, 0x86, 0x65, 0x88, 0x67, 0x9b, 0x68, 
-0xa9, 0xd5, 0x8c, 0x69, 0x8c, 0x6a, 0x9f, 0x6f, 0x93, 0x73, 0xc7, 0x75, 0x96, 0x41, 0xb6, 0x43, 
-0x8f, 0x45, 0xd2, 0x47, 0x9d, 0x48, 0xa8, 0x49, 0xd7, 0x98, 0xd7, 0x4a, 0xac, 0x4f, 0xe2, 0x53, 
-0xc6, 0x55, 0xea, 0x20, 0x5e, 0xf9, 0x0d, 0x61, 0x84, 0x65, 0x89, 0xd5, 0x8b, 0x69, 0x8b, 0x6f, 
-0x94, 0x75, 0x81, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x98, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 
-0xf9, 0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0xd5, 
-0xa1, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x98, 0xd6, 0x4f, 
-0xe0, 0x55, 0xe9, 0x20, 0xef, 0x60, 0x0d, 0x61, 0x85, 0x65, 0x8a, 0xd5, 0x8d, 0x69, 0x8d, 0x6f, 
-0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x98, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 
-0x60, 0x00, 0x50, 0x0b, 0x05, 0x04, 0xb8, 0x01, 0x54, 0x52, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 
-0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x03, 0xec, 0x02, 0x42, 0x03, 0x00, 0x00, 0x55, 0x03, 
-0xc5, 0x03, 0x79, 0x04, 0x00, 0x00, 0x52, 0x03, 0x65, 0x02, 0x75, 0x02, 0x00, 0x00, 0x5a, 0x03, 
-0x00, 0x00, 0x75, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x0b, 0x00, 0x00, 0xfb, 0x00, 0xad, 0x03, 0x02, 
-0x01, 0x00, 0x22, 0xfd, 0x04, 0x04, 0x03, 0x00, 0xc8, 0x23, 0x1e, 0xfc, 0x05, 0x04, 0x0b, 0x00, 
-0x00, 0xac, 0x00, 0xcf, 0x06, 0x02, 0x03, 0x00, 0x00, 0xab, 0x07, 0x02, 0x01, 0x00, 0x26, 0xf3, 
-0x08, 0x02, 0x01, 0x00, 0x27, 0x7b, 0x09, 0x03, 0x01, 0x00, 0x28, 0x5b, 0x1b, 0x0a, 0x03, 0x01, 
-0x00, 0x29, 0x5d, 0x1d, 0x0b, 0x02, 0x01, 0x00, 0x3d, 0x7d, 0x0c, 0x04, 0x00, 0x2f, 0x3f, 0x5c, 
-0x1c, 0xa8, 0x0d, 0x03, 0x00, 0x2d, 0x5f, 0x7c, 0x1f, 0x10, 0xc5, 0x00, 0x66, 0x21, 0x46, 0x21, 
-0x40, 0x21, 0x06, 0x21, 0x00, 0x21, 0x00, 0x21, 0x11, 0xc5, 0x00, 0x67, 0x22, 0x47, 0x22, 0x00, 
-0x22, 0x07, 0x22, 0x00, 0x22, 0x00, 0x22, 0x12, 0x10, 0x00, 0x00, 0x13, 0xc5, 0x00, 0x69, 0x17, 
-0x49, 0x17, 0xf4, 0x17, 0x09, 0x17, 0xa9, 0x17, 0x00, 0x17, 0x14, 0xc5, 0x00, 0x6f, 0x18, 0x4f, 
-0x18, 0x00, 0x18, 0x0f, 0x18, 0x00, 0x18, 0x00, 0x18, 0x15, 0xc5, 0x00, 0x64, 0x20, 0x44, 0x20, 
-0xbe, 0x20, 0x04, 0x20, 0x00, 0x20, 0x00, 0x20, 0x16, 0xc5, 0x00, 0x72, 0x13, 0x52, 0x13, 0x00, 
-0x13, 0x12, 0x13, 0x00, 0x13, 0x00, 0x13, 0x17, 0xc5, 0x00, 0x6e, 0x31, 0x4e, 0x31, 0x00, 0x31, 
-0x0e, 0x31, 0x00, 0x31, 0x00, 0x31, 0x18, 0xc5, 0x00, 0x68, 0x23, 0x48, 0x23, 0x9b, 0x23, 0x08, 
-0x23, 0x9d, 0x23, 0x00, 0x23, 0x19, 0x42, 0x03, 0x00, 0x00, 0x9c, 0x1a, 0xc5, 0x04, 0x71, 0x10, 
-0x51, 0x10, 0xc9, 0x10, 0x11, 0x10, 0x00, 0x10, 0x00, 0x10, 0x1b, 0xc5, 0x04, 0x77, 0x11, 0x57, 
-0x11, 0xca, 0x11, 0x17, 0x11, 0x00, 0x11, 0x00, 0x11, 0x1e, 0xc5, 0x00, 0x75, 0x16, 0x55, 0x16, 
-0x91, 0x16, 0x15, 0x16, 0x92, 0x16, 0x00, 0x16, 0x1f, 0xc5, 0x00, 0x69, 0x17, 0x49, 0x17, 0xe1, 
-0x17, 0x09, 0x17, 0xf5, 0x17, 0x00, 0x17, 0x20, 0xc5, 0x00, 0x65, 0x12, 0x45, 0x12, 0xd5, 0x12, 
-0x05, 0x12, 0x00, 0x12, 0x00, 0x12, 0x21, 0xc5, 0x00, 0x61, 0x1e, 0x41, 0x1e, 0x00, 0x1e, 0x01, 
-0x1e, 0xa6, 0x1e, 0x00, 0x1e, 0x22, 0x41, 0x00, 0x81, 0x9a, 0x23, 0xc5, 0x00, 0x74, 0x14, 0x54, 
-0x14, 0x00, 0x14, 0x14, 0x14, 0x00, 0x14, 0x00, 0x14, 0x24, 0xc5, 0x00, 0x6b, 0x25, 0x4b, 0x25, 
-0x00, 0x25, 0x0b, 0x25, 0x00, 0x25, 0x00, 0x25, 0x25, 0xc5, 0x00, 0x6d, 0x32, 0x4d, 0x32, 0x00, 
-0x32, 0x0d, 0x32, 0x00, 0x32, 0x00, 0x32, 0x27, 0xc5, 0x04, 0x79, 0x15, 0x59, 0x15, 0xcb, 0x15, 
-0x19, 0x15, 0x00, 0x15, 0x00, 0x15, 0x28, 0x10, 0x00, 0x00, 0x29, 0x02, 0x00, 0x2b, 0x2a, 0xaa, 
-0x2b, 0xc5, 0x04, 0x78, 0x2d, 0x58, 0x2d, 0xcc, 0x2d, 0x18, 0x2d, 0x00, 0x2d, 0x00, 0x2d, 0x2c, 
-0xc5, 0x00, 0x6a, 0x24, 0x4a, 0x24, 0xae, 0x24, 0x0a, 0x24, 0x3c, 0x24, 0x00, 0x24, 0x2d, 0x44, 
-0x08, 0x94, 0x99, 0xaf, 0x00, 0x3e, 0x2e, 0xc5, 0x00, 0x76, 0x2f, 0x56, 0x2f, 0xbd, 0x2f, 0x16, 
-0x2f, 0xb8, 0x2f, 0x00, 0x2f, 0x2f, 0xc5, 0x00, 0x63, 0x2e, 0x43, 0x2e, 0x3c, 0x2e, 0x03, 0x2e, 
-0x00, 0x2e, 0x00, 0x2e, 0x30, 0x42, 0x00, 0x87, 0x80, 0x3e, 0x31, 0xc5, 0x00, 0x7a, 0x2c, 0x5a, 
-0x2c, 0x7c, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x32, 0xc5, 0x00, 0x73, 0x1f, 0x53, 0x1f, 
-0xe6, 0x1f, 0x13, 0x1f, 0xa7, 0x1f, 0x00, 0x1f, 0x33, 0xc5, 0x00, 0x62, 0x30, 0x42, 0x30, 0x9e, 
-0x30, 0x02, 0x30, 0x00, 0x30, 0x00, 0x30, 0x34, 0x02, 0x01, 0x00, 0x3a, 0xf6, 0x35, 0x02, 0x00, 
-0x2c, 0x3b, 0x2d, 0x39, 0x00, 0x00, 0x20, 0x56, 0x03, 0x00, 0x3c, 0x3e, 0x7c, 0x1c, 0x00, 0x20, 
-0xc5, 0x04, 0x65, 0x12, 0x45, 0x12, 0xa0, 0x12, 0x05, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x5e, 
-0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 
-0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 
-0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 
-0xf9, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 
-0x7e, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 
-0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0x60, 0x0b, 0x61, 
-0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 
-0xe3, 0x55, 0xeb, 0x20, 0x60, 0x00, 0x12, 0x41, 0x00, 0xa7, 0xa6, 0x13, 0xc5, 0x00, 0x8d, 0x17, 
-0x49, 0x17, 0xf4, 0x17, 0x09, 0x17, 0xa9, 0x17, 0x00, 0x17, 0x1f, 0xc5, 0x00, 0x69, 0x17, 0x98, 
-0x17, 0xe1, 0x17, 0x09, 0x17, 0xf5, 0x17, 0x00, 0x17, 0x21, 0xc5, 0x10, 0x61, 0x1e, 0x41, 0x1e, 
-0x00, 0x1e, 0x01, 0x1e, 0xa0, 0x1e, 0x00, 0x1e, 0x28, 0x41, 0x00, 0x9f, 0x9e, 0x32, 0xc5, 0x10, 
-0x73, 0x1f, 0x53, 0x1f, 0xe6, 0x1f, 0x13, 0x1f, 0xa0, 0x1f, 0x00, 0x1f, 0x33, 0xc5, 0x00, 0x62, 
-0x30, 0x42, 0x30, 0xe8, 0x30, 0x02, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x5e, 0x0d, 0x61, 0x83, 
-0x65, 0x88, 0x8d, 0x8c, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 
-0x98, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xf9, 0x0e, 0x61, 0x84, 0x65, 0x89, 0x8d, 0x8b, 
-0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0xed, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x98, 0xd8, 
-0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 
-0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x8d, 0xa1, 0x69, 0xa1, 
-0x6f, 0xa2, 0x75, 0xa3, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x98, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 
-0x20, 0xef, 0x60, 0x0d, 0x61, 0x85, 0x65, 0x8a, 0x8d, 0xec, 0x69, 0xec, 0x6f, 0x95, 0x75, 0x97, 
-0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x98, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x00, 0x02, 
-0x04, 0x1f, 0x00, 0x00, 0xa0, 0x00, 0xa0, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x07, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x0c, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x12, 0x41, 0x00, 0xa7, 0xa6, 
-0x13, 0xc5, 0x14, 0xd5, 0x17, 0x49, 0x17, 0xa0, 0x17, 0x09, 0x17, 0xa0, 0x17, 0x00, 0x17, 0x15, 
-0xc5, 0x04, 0x64, 0x20, 0x44, 0x20, 0xa0, 0x20, 0x04, 0x20, 0x00, 0x20, 0x00, 0x20, 0x18, 0xc5, 
-0x14, 0x68, 0x23, 0x48, 0x23, 0xa0, 0x23, 0x08, 0x23, 0xa0, 0x23, 0x00, 0x23, 0x1e, 0xc5, 0x00, 
-0x75, 0x16, 0x55, 0x16, 0xed, 0x16, 0x15, 0x16, 0xec, 0x16, 0x00, 0x16, 0x1f, 0xc5, 0x00, 0x69, 
-0x17, 0x98, 0x17, 0xe1, 0x17, 0x09, 0x17, 0xf5, 0x17, 0x00, 0x17, 0x20, 0xc5, 0x04, 0x65, 0x12, 
-0x45, 0x12, 0xa0, 0x12, 0x05, 0x12, 0x00, 0x12, 0x00, 0x12, 0x21, 0xc5, 0x10, 0x61, 0x1e, 0x41, 
-0x1e, 0x00, 0x1e, 0x01, 0x1e, 0xa0, 0x1e, 0x00, 0x1e, 0x28, 0x41, 0x00, 0xad, 0xb8, 0x29, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x2e, 0xc5, 0x14, 0x76, 0x2f, 0x56, 0x2f, 0xa0, 0x2f, 0x16, 0x2f, 0xa0, 
-0x2f, 0x00, 0x2f, 0x32, 0xc5, 0x10, 0x73, 0x1f, 0x53, 0x1f, 0xe6, 0x1f, 0x13, 0x1f, 0xa0, 0x1f, 
-0x00, 0x1f, 0x00, 0x5e, 0x17, 0x61, 0x83, 0x63, 0x86, 0x65, 0x88, 0x67, 0x9b, 0x68, 0xa9, 0xd5, 
-0x8c, 0x69, 0x8c, 0x6a, 0x9f, 0x6f, 0x93, 0x73, 0xc7, 0x75, 0x96, 0x41, 0xb6, 0x43, 0x8f, 0x45, 
-0xd2, 0x47, 0x9d, 0x48, 0xa8, 0x49, 0xd7, 0x98, 0xd7, 0x4a, 0xac, 0x4f, 0xe2, 0x53, 0xc6, 0x55, 
-0xea, 0x20, 0x5e, 0xf9, 0x0d, 0x61, 0x84, 0x65, 0x89, 0xd5, 0x8b, 0x69, 0x8b, 0x6f, 0x94, 0x75, 
-0x81, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x98, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0x7e, 
-0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0xef, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0xd5, 0xa1, 0x69, 
-0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x98, 0xd6, 0x4f, 0xe0, 0x55, 
-0xe9, 0x20, 0xef, 0x60, 0x0d, 0x61, 0x85, 0x65, 0x8a, 0xd5, 0x8d, 0x69, 0x8d, 0x6f, 0x95, 0x75, 
-0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x98, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x00, 
-0x2f, 0xc4, 0x02, 0x04, 0x00, 0x00, 0x54, 0x54, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x3d, 0x75, 0x6b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x75, 0x8b, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x42, 0x75, 0x4c, 0x02, 0xa2, 0x02, 0x00, 0x00, 0x42, 0x75, 0x7a, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 
-0x00, 0x40, 0x05, 0x02, 0x03, 0x00, 0x00, 0x24, 0x07, 0x02, 0x03, 0x00, 0x00, 0x5e, 0x08, 0x02, 
-0x03, 0x00, 0x00, 0x5b, 0x09, 0x02, 0x03, 0x00, 0x00, 0x5d, 0x0a, 0x02, 0x03, 0x00, 0x00, 0x7b, 
-0x0b, 0x02, 0x03, 0x00, 0x00, 0x7d, 0x33, 0x02, 0x03, 0x00, 0x00, 0x3c, 0x34, 0x02, 0x03, 0x00, 
-0x00, 0x3e, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x05, 0x01, 0x01, 0x00, 0x3b, 0x07, 0x01, 0x01, 
-0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x43, 0x00, 0xf5, 
-0xf4, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x42, 0x00, 
-0xa5, 0x85, 0xfd, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 
-0xe8, 0x98, 0x18, 0x43, 0x00, 0xd0, 0xcf, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 
-0x00, 0xe5, 0x95, 0x1b, 0x43, 0x00, 0xb8, 0xb5, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 
-0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 
-0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 
-0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x43, 0x00, 0xfb, 0xfa, 0xa6, 0x86, 
-0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0xc3, 0x00, 0xc6, 0x29, 0xbe, 0x29, 0xf1, 0x29, 0xf0, 0x00, 
-0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 0x02, 0x01, 0x00, 0x2f, 0x7c, 0x2c, 0x41, 
-0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 
-0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x43, 0x00, 0xd2, 
-0xd1, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 0x00, 
-0x2e, 0x2c, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 
-0x79, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x05, 0x01, 0x01, 0x00, 0x3b, 0x07, 0x01, 0x01, 0x00, 
-0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 
-0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x42, 0x00, 0xa5, 0x85, 0xfd, 
-0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 
-0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 
-0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 
-0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 
-0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 
-0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0xc1, 0x00, 0xf1, 
-0x29, 0xf0, 0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x2b, 0x02, 0x01, 0x00, 0x2f, 
-0x7c, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 
-0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 
-0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 
-0x00, 0x2e, 0x2c, 0x00, 0x07, 0x03, 0x03, 0x00, 0x00, 0xc7, 0xc6, 0x12, 0x42, 0x00, 0x65, 0x45, 
-0xfd, 0x16, 0x43, 0x00, 0x75, 0x55, 0xf7, 0xf6, 0x17, 0x43, 0x00, 0x69, 0xbd, 0xbe, 0x49, 0x18, 
-0x43, 0x00, 0x6f, 0x4f, 0xf5, 0xf4, 0x1e, 0x43, 0x00, 0x61, 0x41, 0xf3, 0xf2, 0x1f, 0x43, 0x03, 
-0x00, 0x00, 0xfb, 0xfa, 0x22, 0x43, 0x03, 0x00, 0x00, 0xb6, 0xb5, 0x28, 0x00, 0x01, 0xc8, 0x2e, 
-0x43, 0x03, 0x00, 0x00, 0xf9, 0xf8, 0x31, 0x43, 0x03, 0x00, 0x00, 0xb8, 0xb7, 0x36, 0x04, 0x1f, 
-0x00, 0x00, 0x00, 0x00, 0x7b, 0x39, 0x00, 0x00, 0x20, 0x00, 0x27, 0x0d, 0x61, 0xd0, 0x65, 0xd2, 
-0xbe, 0xd4, 0x69, 0xd4, 0x6f, 0xd6, 0x75, 0xd8, 0x41, 0xcf, 0x45, 0xd1, 0x49, 0xd3, 0xbd, 0xd3, 
-0x4f, 0xd5, 0x55, 0xd7, 0x20, 0x27, 0x00, 0x17, 0x18, 0x03, 0x04, 0xbb, 0x01, 0x54, 0x54, 0x05, 
-0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x75, 0x8a, 0x01, 0xe0, 
-0x01, 0x00, 0x00, 0x42, 0x75, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x75, 0x04, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x3d, 0x75, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x00, 0x40, 0x04, 0x02, 0x03, 0x00, 0x00, 0x23, 0x05, 
-0x02, 0x03, 0x00, 0x00, 0x24, 0x07, 0x02, 0x03, 0x00, 0x00, 0x5e, 0x08, 0x02, 0x03, 0x00, 0x00, 
-0x26, 0x09, 0x02, 0x03, 0x00, 0x00, 0x2a, 0x1a, 0x02, 0x03, 0x00, 0x00, 0x5b, 0x1b, 0x02, 0x03, 
-0x00, 0x00, 0x5d, 0x33, 0x02, 0x03, 0x00, 0x00, 0x3c, 0x34, 0x02, 0x03, 0x00, 0x00, 0x3e, 0x00, 
-0x02, 0x01, 0x00, 0xfc, 0x31, 0x03, 0x01, 0x00, 0x2d, 0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 
-0x01, 0x00, 0x22, 0x34, 0x06, 0x01, 0x00, 0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 
-0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 0x38, 0x0a, 0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 0x00, 
-0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 0x0d, 0x01, 0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 0xa9, 
-0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 
-0x14, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 
-0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 
-0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 
-0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 
-0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 
-0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 
-0xed, 0x9d, 0x29, 0x01, 0x00, 0x7c, 0x2b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 
-0x01, 0x00, 0x29, 0x28, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 
-0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 
-0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 
-0x9e, 0x35, 0xc1, 0x00, 0xf1, 0x35, 0xf0, 0x00, 0x00, 0x07, 0x03, 0x03, 0x00, 0x00, 0xc7, 0xc6, 
-0x12, 0x42, 0x00, 0x65, 0x45, 0xfd, 0x16, 0x43, 0x00, 0x75, 0x55, 0xf7, 0xf6, 0x17, 0x43, 0x00, 
-0x69, 0xbd, 0xbe, 0x49, 0x18, 0x43, 0x00, 0x6f, 0x4f, 0xf5, 0xf4, 0x1e, 0x43, 0x00, 0x61, 0x41, 
-0xf3, 0xf2, 0x1f, 0x43, 0x03, 0x00, 0x00, 0xfb, 0xfa, 0x22, 0x43, 0x03, 0x00, 0x00, 0xb6, 0xb5, 
-0x28, 0x00, 0x01, 0xc8, 0x2e, 0x43, 0x03, 0x00, 0x00, 0xf9, 0xf8, 0x31, 0x43, 0x03, 0x00, 0x00, 
-0xb8, 0xb7, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x39, 0x00, 0x00, 0x20, 0x00, 0x27, 
-0x0d, 0x61, 0xd0, 0x65, 0xd2, 0xbe, 0xd4, 0x69, 0xd4, 0x6f, 0xd6, 0x75, 0xd8, 0x41, 0xcf, 0x45, 
-0xd1, 0x49, 0xd3, 0xbd, 0xd3, 0x4f, 0xd5, 0x55, 0xd7, 0x20, 0x27, 0x00, 0x02, 0x01, 0x00, 0xfc, 
-0x31, 0x03, 0x01, 0x00, 0x2d, 0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 0x01, 0x00, 0x22, 0x34, 
-0x06, 0x01, 0x00, 0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 0x00, 0x2e, 0x37, 0x09, 
-0x01, 0x00, 0x5f, 0x38, 0x0a, 0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 0x00, 0x25, 0x30, 0x0c, 0x01, 
-0x00, 0x21, 0x3d, 0x0d, 0x01, 0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x43, 0x00, 
-0xf5, 0xf4, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x42, 
-0x00, 0xa5, 0x85, 0xfd, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 
-0x00, 0xe8, 0x98, 0x18, 0x43, 0x00, 0xd0, 0xcf, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 
-0x41, 0x00, 0xe5, 0x95, 0x1b, 0x43, 0x00, 0xb8, 0xb5, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 
-0x1f, 0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 
-0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 
-0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x43, 0x00, 0xfb, 0xfa, 0xa6, 
-0x86, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0x01, 0x00, 0x7c, 0x2b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 
-0x00, 0x00, 0x7a, 0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 
-0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 
-0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x43, 0x00, 0xd2, 0xd1, 0xec, 0x9c, 0x33, 0x41, 0x00, 
-0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0xc3, 0x00, 0xc6, 0x35, 0xbe, 0x35, 0xf1, 0x35, 
-0xf0, 0x00, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 
-0x7b, 0x00, 0xaf, 0x72, 0x04, 0x13, 0x00, 0x00, 0x59, 0x43, 0x2c, 0x00, 0x00, 0x53, 0x52, 0x2c, 
-0x76, 0x00, 0x59, 0x43, 0x2c, 0x76, 0x00, 0x53, 0x52, 0x0b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x03, 0xda, 0x01, 0x00, 0x00, 0x00, 0x00, 0x68, 0x03, 0x1b, 
-0x01, 0xb0, 0x02, 0x00, 0x00, 0x57, 0x03, 0xa7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0xef, 
-0x01, 0xb0, 0x02, 0x00, 0x00, 0x50, 0x03, 0x79, 0x03, 0x00, 0x00, 0x00, 0x00, 0x50, 0x03, 0xbd, 
-0x02, 0x00, 0x00, 0x00, 0x00, 0x65, 0x04, 0x4f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x65, 0x04, 0x8e, 
-0x03, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 
-0x00, 0x22, 0x40, 0x05, 0x02, 0x03, 0x00, 0x00, 0xcf, 0x07, 0x02, 0x01, 0x00, 0x26, 0x5e, 0x08, 
-0x02, 0x01, 0x00, 0x2f, 0x26, 0x09, 0x02, 0x01, 0x00, 0x28, 0x24, 0x0a, 0x02, 0x01, 0x00, 0x29, 
-0x3c, 0x0b, 0x02, 0x01, 0x00, 0x3d, 0x3e, 0x0c, 0x01, 0x00, 0x27, 0x3f, 0x0d, 0x01, 0x00, 0x2b, 
-0x2a, 0x15, 0xc4, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x1a, 0x02, 
-0x03, 0x00, 0x00, 0x5b, 0x1b, 0x02, 0x00, 0x5c, 0x5c, 0x5d, 0x27, 0x03, 0x04, 0x5e, 0x5e, 0x00, 
-0x1e, 0x28, 0x03, 0x04, 0x5d, 0x7d, 0x00, 0x1d, 0x29, 0x01, 0x00, 0x49, 0x56, 0x2b, 0x02, 0x00, 
-0x40, 0x40, 0x7c, 0x2c, 0xc4, 0x00, 0x79, 0x15, 0x59, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 
-0x33, 0x02, 0x00, 0x2c, 0x3b, 0x3c, 0x34, 0x02, 0x00, 0x2e, 0x3a, 0x3e, 0x35, 0x03, 0x00, 0x2d, 
-0x5f, 0x2f, 0x1f, 0x39, 0x00, 0x00, 0x20, 0x56, 0x01, 0x00, 0x3c, 0x3e, 0x00, 0x12, 0x42, 0x03, 
-0x00, 0x00, 0xd5, 0x00, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0c, 0x00, 0x01, 0xc8, 0x10, 0x41, 
-0x00, 0x90, 0x91, 0x11, 0x41, 0x00, 0x92, 0x93, 0x12, 0x42, 0x00, 0xa8, 0xa9, 0xcf, 0x13, 0x41, 
-0x00, 0xe1, 0xe2, 0x14, 0x41, 0x00, 0xe5, 0xe6, 0x15, 0xc4, 0x00, 0xf3, 0x2c, 0xf4, 0x2c, 0x00, 
-0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0xe7, 0xe8, 0x17, 0x41, 0x00, 0xb7, 0xb8, 0x18, 
-0x41, 0x00, 0xd6, 0xd7, 0x19, 0x41, 0x00, 0xd8, 0xdd, 0x1a, 0x41, 0x00, 0xf5, 0xf6, 0x1b, 0x41, 
-0x00, 0x80, 0x81, 0x1e, 0x41, 0x00, 0xa0, 0xa1, 0x1f, 0x41, 0x00, 0xe3, 0xe4, 0x20, 0x41, 0x00, 
-0xa6, 0xa7, 0x21, 0x41, 0x00, 0xaa, 0xab, 0x22, 0x41, 0x00, 0xac, 0xad, 0x23, 0x41, 0x00, 0xb5, 
-0xb6, 0x24, 0x41, 0x00, 0x8e, 0x8f, 0x25, 0x41, 0x00, 0xc6, 0xc7, 0x26, 0x41, 0x00, 0xd0, 0xd1, 
-0x27, 0x41, 0x00, 0xfb, 0xfc, 0x28, 0x41, 0x00, 0x94, 0x95, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x78, 0x2b, 0x41, 0x00, 0xe9, 0xea, 0x2c, 0xc4, 0x00, 0x88, 0x15, 0x89, 0x15, 0x00, 0x15, 
-0x19, 0x15, 0x00, 0x15, 0x2d, 0x41, 0x00, 0x9a, 0x9b, 0x2e, 0x41, 0x00, 0xa4, 0xa5, 0x2f, 0x41, 
-0x00, 0xeb, 0xec, 0x30, 0x41, 0x00, 0xa2, 0xa3, 0x31, 0x41, 0x00, 0xd4, 0xd5, 0x32, 0x41, 0x00, 
-0xd2, 0xd3, 0x00, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x03, 0x00, 0x00, 0xcf, 0x36, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x0c, 0x00, 0x01, 0xc8, 0x10, 0x41, 0x00, 0x90, 
-0x91, 0x11, 0x41, 0x00, 0x92, 0x93, 0x12, 0x41, 0x00, 0xa8, 0xa9, 0x13, 0x41, 0x00, 0xe1, 0xe2, 
-0x14, 0x41, 0x00, 0xe5, 0xe6, 0x15, 0xc4, 0x00, 0xf3, 0x2c, 0xf4, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 
-0x00, 0x2c, 0x16, 0x41, 0x00, 0xe7, 0xe8, 0x17, 0x41, 0x00, 0xb7, 0xb8, 0x18, 0x41, 0x00, 0xd6, 
-0xd7, 0x19, 0x41, 0x00, 0xd8, 0xdd, 0x1a, 0x41, 0x00, 0xf5, 0xf6, 0x1b, 0x41, 0x00, 0x80, 0x81, 
-0x1e, 0x41, 0x00, 0xa0, 0xa1, 0x1f, 0x41, 0x00, 0xe3, 0xe4, 0x20, 0x41, 0x00, 0xa6, 0xa7, 0x21, 
-0x41, 0x00, 0xaa, 0xab, 0x22, 0x41, 0x00, 0xac, 0xad, 0x23, 0x41, 0x00, 0xb5, 0xb6, 0x24, 0x41, 
-0x00, 0x8e, 0x8f, 0x25, 0x41, 0x00, 0xc6, 0xc7, 0x26, 0x41, 0x00, 0xd0, 0xd1, 0x27, 0x41, 0x00, 
-0xfb, 0xfc, 0x28, 0x41, 0x00, 0x94, 0x95, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x2b, 
-0x41, 0x00, 0xe9, 0xea, 0x2c, 0xc4, 0x00, 0x88, 0x15, 0x89, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 
-0x15, 0x2d, 0x41, 0x00, 0x9a, 0x9b, 0x2e, 0x41, 0x00, 0xa4, 0xa5, 0x2f, 0x41, 0x00, 0xeb, 0xec, 
-0x30, 0x41, 0x00, 0xa2, 0xa3, 0x31, 0x41, 0x00, 0xd4, 0xd5, 0x32, 0x41, 0x00, 0xd2, 0xd3, 0x00, 
-0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x27, 0x05, 0xac, 0x82, 0xc6, 0x96, 0xad, 
-0x83, 0xc7, 0x97, 0x20, 0x27, 0x00, 0x10, 0x41, 0x00, 0xef, 0x9f, 0x11, 0x41, 0x00, 0xf9, 0xf8, 
-0x12, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x13, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 
-0xe2, 0x92, 0x15, 0xc4, 0x00, 0xa7, 0x2c, 0x87, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 
-0x41, 0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xf7, 0xf6, 0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 
-0x00, 0xaf, 0x8f, 0x1a, 0x41, 0x00, 0xe8, 0x98, 0x1b, 0x41, 0x00, 0xeb, 0x9b, 0x1e, 0x41, 0x00, 
-0xa0, 0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 
-0x94, 0x22, 0x41, 0x00, 0xf3, 0xf2, 0x23, 0x41, 0x00, 0xa3, 0x83, 0x24, 0x41, 0x00, 0xa9, 0x89, 
-0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x27, 0x41, 0x00, 0xe7, 0x97, 0x28, 
-0x41, 0x00, 0xee, 0x9e, 0x29, 0x41, 0x00, 0xec, 0x9c, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 
-0x7c, 0x2b, 0x41, 0x00, 0xa6, 0x86, 0x2c, 0xc4, 0x00, 0xa8, 0x15, 0x88, 0x15, 0x00, 0x15, 0x19, 
-0x15, 0x00, 0x15, 0x2d, 0x41, 0x00, 0xe5, 0x95, 0x2e, 0x41, 0x00, 0xe6, 0x96, 0x2f, 0x41, 0x00, 
-0xa2, 0x82, 0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x41, 0x00, 0xac, 
-0x8c, 0x00, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 
-0x1f, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 0xfd, 0x10, 0x41, 0x00, 
-0xef, 0x9f, 0x11, 0x41, 0x00, 0xf9, 0xf8, 0x12, 0x41, 0x00, 0xa5, 0x85, 0x13, 0xc1, 0x00, 0xe0, 
-0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0xc4, 0x00, 0xa7, 0x2c, 0x87, 0x2c, 0x00, 
-0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xf7, 0xf6, 0x18, 
-0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x41, 0x00, 0xe8, 0x98, 0x1b, 0x41, 
-0x00, 0xeb, 0x9b, 0x1e, 0x41, 0x00, 0xa0, 0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 
-0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 0x41, 0x00, 0xf3, 0xf2, 0x23, 0x41, 0x00, 0xa3, 
-0x83, 0x24, 0x41, 0x00, 0xa9, 0x89, 0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 
-0x27, 0x41, 0x00, 0xe7, 0x97, 0x28, 0x41, 0x00, 0xee, 0x9e, 0x29, 0x41, 0x00, 0xec, 0x9c, 0x2a, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x2b, 0x41, 0x00, 0xa6, 0x86, 0x2c, 0xc4, 0x00, 0xa8, 
-0x15, 0x88, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 0x41, 0x00, 0xe5, 0x95, 0x2e, 0x41, 
-0x00, 0xe6, 0x96, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 
-0xad, 0x8d, 0x32, 0x41, 0x00, 0xac, 0x8c, 0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 
-0x1f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0xae, 0x6a, 0x04, 0x09, 0xc2, 0x01, 0x59, 0x43, 0x2c, 
-0xc2, 0x01, 0x53, 0x52, 0x0b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x68, 0x03, 0xee, 0x01, 0x00, 0x00, 0x00, 0x00, 0x68, 0x03, 0x34, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x57, 0x03, 0xbb, 0x02, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x50, 0x03, 0x85, 0x03, 0x00, 0x00, 0x00, 0x00, 0x50, 0x03, 0xc9, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x65, 0x04, 0x53, 0x04, 0x00, 0x00, 0x00, 0x00, 0x65, 0x04, 0x98, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x5a, 0x03, 0x2d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x7e, 0x03, 0x01, 
-0x01, 0x00, 0x22, 0x04, 0x03, 0x01, 0x00, 0x23, 0x5e, 0x1e, 0x07, 0x01, 0x01, 0x00, 0x26, 0x08, 
-0x02, 0x01, 0x00, 0x2f, 0x60, 0x09, 0x01, 0x01, 0x00, 0x28, 0x0a, 0x01, 0x01, 0x00, 0x29, 0x0b, 
-0x01, 0x01, 0x00, 0x3d, 0x0c, 0x01, 0x00, 0x27, 0x3f, 0x0d, 0x01, 0x00, 0x2b, 0x2a, 0x10, 0x42, 
-0x03, 0x00, 0x00, 0x5c, 0x11, 0x42, 0x03, 0x00, 0x00, 0x7c, 0x15, 0xc4, 0x00, 0x7a, 0x2c, 0x5a, 
-0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x21, 0x42, 0x03, 0x00, 0x00, 0x5b, 0x22, 0x42, 0x03, 
-0x00, 0x00, 0x5d, 0x27, 0x03, 0x04, 0x5e, 0x5e, 0x00, 0x1e, 0x28, 0x01, 0x00, 0xf5, 0xf5, 0x29, 
-0x03, 0x04, 0x5c, 0x7c, 0x00, 0x1c, 0x2b, 0x01, 0x00, 0x40, 0x40, 0x2c, 0xc4, 0x00, 0x79, 0x15, 
-0x59, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2f, 0x42, 0x03, 0x00, 0x00, 0x40, 0x30, 0x42, 
-0x03, 0x00, 0x00, 0x7b, 0x31, 0x42, 0x03, 0x00, 0x00, 0x7d, 0x33, 0x01, 0x00, 0x2c, 0x3b, 0x34, 
-0x01, 0x00, 0x2e, 0x3a, 0x35, 0x03, 0x04, 0x2d, 0x5f, 0x00, 0x1f, 0x56, 0x01, 0x00, 0x3c, 0x3e, 
-0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x10, 0x41, 0x00, 0x90, 0x91, 0x11, 0x41, 0x00, 
-0x92, 0x93, 0x12, 0x42, 0x00, 0xa8, 0xa9, 0xcf, 0x13, 0x41, 0x00, 0xe1, 0xe2, 0x14, 0x41, 0x00, 
-0xe5, 0xe6, 0x15, 0xc4, 0x00, 0xf3, 0x2c, 0xf4, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 
-0x41, 0x00, 0xe7, 0xe8, 0x17, 0x41, 0x00, 0xb7, 0xb8, 0x18, 0x41, 0x00, 0xd6, 0xd7, 0x19, 0x41, 
-0x00, 0xd8, 0xdd, 0x1a, 0x42, 0x00, 0xf5, 0xf6, 0x83, 0x1b, 0x42, 0x00, 0x80, 0x81, 0x82, 0x1e, 
-0x41, 0x00, 0xa0, 0xa1, 0x1f, 0x41, 0x00, 0xe3, 0xe4, 0x20, 0x41, 0x00, 0xa6, 0xa7, 0x21, 0x41, 
-0x00, 0xaa, 0xab, 0x22, 0x41, 0x00, 0xac, 0xad, 0x23, 0x41, 0x00, 0xb5, 0xb6, 0x24, 0x41, 0x00, 
-0x8e, 0x8f, 0x25, 0x41, 0x00, 0xc6, 0xc7, 0x26, 0x41, 0x00, 0xd0, 0xd1, 0x27, 0x42, 0x00, 0xfb, 
-0xfc, 0x97, 0x28, 0x42, 0x00, 0x94, 0x95, 0x96, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x78, 
-0x2b, 0x41, 0x00, 0xe9, 0xea, 0x2c, 0xc4, 0x00, 0x88, 0x15, 0x89, 0x15, 0x00, 0x15, 0x19, 0x15, 
-0x00, 0x15, 0x2d, 0x41, 0x00, 0x9a, 0x9b, 0x2e, 0x41, 0x00, 0xa4, 0xa5, 0x2f, 0x41, 0x00, 0xeb, 
-0xec, 0x30, 0x41, 0x00, 0xa2, 0xa3, 0x31, 0x41, 0x00, 0xd4, 0xd5, 0x32, 0x42, 0x00, 0xd2, 0xd3, 
-0xfd, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xcf, 0x28, 0x01, 0x00, 0xfd, 0xfd, 0x36, 0x04, 0x1f, 
-0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x10, 0x41, 0x00, 0x90, 0x91, 0x11, 0x41, 0x00, 0x92, 0x93, 
-0x12, 0x41, 0x00, 0xa8, 0xa9, 0x13, 0x41, 0x00, 0xe1, 0xe2, 0x14, 0x41, 0x00, 0xe5, 0xe6, 0x15, 
-0xc4, 0x00, 0xf3, 0x2c, 0xf4, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0xe7, 
-0xe8, 0x17, 0x41, 0x00, 0xb7, 0xb8, 0x18, 0x41, 0x00, 0xd6, 0xd7, 0x19, 0x41, 0x00, 0xd8, 0xdd, 
-0x1a, 0x42, 0x00, 0xf5, 0xf6, 0x83, 0x1b, 0x42, 0x00, 0x80, 0x81, 0x82, 0x1e, 0x41, 0x00, 0xa0, 
-0xa1, 0x1f, 0x41, 0x00, 0xe3, 0xe4, 0x20, 0x41, 0x00, 0xa6, 0xa7, 0x21, 0x41, 0x00, 0xaa, 0xab, 
-0x22, 0x41, 0x00, 0xac, 0xad, 0x23, 0x41, 0x00, 0xb5, 0xb6, 0x24, 0x41, 0x00, 0x8e, 0x8f, 0x25, 
-0x41, 0x00, 0xc6, 0xc7, 0x26, 0x41, 0x00, 0xd0, 0xd1, 0x27, 0x42, 0x00, 0xfb, 0xfc, 0x97, 0x28, 
-0x42, 0x00, 0x94, 0x95, 0x96, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x2b, 0x41, 0x00, 
-0xe9, 0xea, 0x2c, 0xc4, 0x00, 0x88, 0x15, 0x89, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 
-0x41, 0x00, 0x9a, 0x9b, 0x2e, 0x41, 0x00, 0xa4, 0xa5, 0x2f, 0x41, 0x00, 0xeb, 0xec, 0x30, 0x41, 
-0x00, 0xa2, 0xa3, 0x31, 0x41, 0x00, 0xd4, 0xd5, 0x32, 0x42, 0x00, 0xd2, 0xd3, 0xfd, 0x00, 0x28, 
-0x01, 0x00, 0xfd, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x10, 0x41, 0x00, 
-0xef, 0x9f, 0x11, 0x41, 0x00, 0xf9, 0xf8, 0x12, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x13, 0xc1, 0x00, 
-0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0xc4, 0x00, 0xa7, 0x2c, 0x87, 0x2c, 
-0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xf7, 0xf6, 
-0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x41, 0x00, 0xe8, 0x98, 0x1b, 
-0x41, 0x00, 0xeb, 0x9b, 0x1e, 0x41, 0x00, 0xa0, 0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 0x41, 
-0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 0x41, 0x00, 0xf3, 0xf2, 0x23, 0x41, 0x00, 
-0xa3, 0x83, 0x24, 0x41, 0x00, 0xa9, 0x89, 0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 
-0x8b, 0x27, 0x41, 0x00, 0xe7, 0x97, 0x28, 0x41, 0x00, 0xee, 0x9e, 0x29, 0x41, 0x00, 0xec, 0x9c, 
-0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x2b, 0x41, 0x00, 0xa6, 0x86, 0x2c, 0xc4, 0x00, 
-0xa8, 0x15, 0x88, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 0x41, 0x00, 0xe5, 0x95, 0x2e, 
-0x41, 0x00, 0xe6, 0x96, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 
-0x00, 0xad, 0x8d, 0x32, 0x41, 0x00, 0xac, 0x8c, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x28, 
-0x10, 0x00, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x10, 0x41, 0x00, 0xef, 
-0x9f, 0x11, 0x41, 0x00, 0xf9, 0xf8, 0x12, 0x41, 0x00, 0xa5, 0x85, 0x13, 0xc1, 0x00, 0xe0, 0x00, 
-0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0xc4, 0x00, 0xa7, 0x2c, 0x87, 0x2c, 0x00, 0x2c, 
-0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xf7, 0xf6, 0x18, 0x41, 
-0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x41, 0x00, 0xe8, 0x98, 0x1b, 0x41, 0x00, 
-0xeb, 0x9b, 0x1e, 0x41, 0x00, 0xa0, 0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 0xa4, 
-0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 0x41, 0x00, 0xf3, 0xf2, 0x23, 0x41, 0x00, 0xa3, 0x83, 
-0x24, 0x41, 0x00, 0xa9, 0x89, 0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x27, 
-0x41, 0x00, 0xe7, 0x97, 0x28, 0x41, 0x00, 0xee, 0x9e, 0x29, 0x41, 0x00, 0xec, 0x9c, 0x2a, 0x04, 
-0x1f, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x2b, 0x41, 0x00, 0xa6, 0x86, 0x2c, 0xc4, 0x00, 0xa8, 0x15, 
-0x88, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 0x41, 0x00, 0xe5, 0x95, 0x2e, 0x41, 0x00, 
-0xe6, 0x96, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 
-0x8d, 0x32, 0x41, 0x00, 0xac, 0x8c, 0x00, 0x28, 0x10, 0x00, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 
-0x00, 0x00, 0x7f, 0x00, 0xaf, 0x00, 0x00 };
+0x20, 0x6f, 0x66, 0x20, 0x33, 0x09, 0x00, 0x09, 0x00, 0x00, 0x42, 0x47, 0x2c, 0xba, 0x01, 0x42, 
+0x47, 0x04, 0x00, 0x04, 0xf1, 0x00, 0x42, 0x47, 0x09, 0x00, 0x09, 0x00, 0x00, 0x43, 0x45, 0x2c, 
+0xb9, 0x01, 0x43, 0x45, 0x04, 0x00, 0x04, 0xbb, 0x01, 0x43, 0x45, 0x13, 0x00, 0x13, 0x00, 0x00, 
+0x47, 0x4b, 0x2c, 0x00, 0x00, 0x45, 0x4c, 0x2c, 0x3f, 0x01, 0x47, 0x4b, 0x2c, 0x3f, 0x01, 0x45, 
+0x4c, 0x09, 0x00, 0x09, 0xdc, 0x00, 0x47, 0x4b, 0x2c, 0xdc, 0x00, 0x45, 0x4c, 0x09, 0x00, 0x09, 
+0xcb, 0x01, 0x47, 0x4b, 0x2c, 0xcb, 0x01, 0x45, 0x4c, 0x09, 0x00, 0x09, 0x00, 0x00, 0x49, 0x53, 
+0x2c, 0xca, 0x01, 0x49, 0x53, 0x09, 0x00, 0x09, 0xa1, 0x00, 0x49, 0x53, 0x2c, 0xc5, 0x00, 0x49, 
+0x53, 0x09, 0x00, 0x09, 0x00, 0x00, 0x52, 0x4f, 0x2c, 0x4d, 0x01, 0x52, 0x4f, 0x04, 0x00, 0x04, 
+0xbe, 0x01, 0x52, 0x4f, 0x09, 0x00, 0x09, 0x00, 0x00, 0x52, 0x55, 0x2c, 0xb9, 0x01, 0x52, 0x55, 
+0x04, 0x00, 0x04, 0xbb, 0x01, 0x52, 0x55, 0x09, 0x00, 0x09, 0x00, 0x00, 0x52, 0x58, 0x2c, 0xb9, 
+0x01, 0x52, 0x58, 0x04, 0x00, 0x04, 0xbb, 0x01, 0x52, 0x58, 0x09, 0x00, 0x09, 0x00, 0x00, 0x54, 
+0x52, 0x2c, 0xb3, 0x00, 0x54, 0x52, 0x04, 0x00, 0x04, 0xb8, 0x01, 0x54, 0x52, 0x04, 0x00, 0x04, 
+0x00, 0x00, 0x54, 0x54, 0x04, 0x00, 0x04, 0xbb, 0x01, 0x54, 0x54, 0x13, 0x00, 0x13, 0x00, 0x00, 
+0x59, 0x43, 0x2c, 0x00, 0x00, 0x53, 0x52, 0x2c, 0x76, 0x00, 0x59, 0x43, 0x2c, 0x76, 0x00, 0x53, 
+0x52, 0x09, 0x00, 0x09, 0xc2, 0x01, 0x59, 0x43, 0x2c, 0xc2, 0x01, 0x53, 0x52 };
+
+static const kcl_builtin_layout layout_keybrd2sys_layouts[21] = {
+{ 53, 55, 683 }, { 65, 740, 1651 }, { 72, 2393, 744 }, { 84, 3139, 794 },
+{ 91, 3935, 1113 }, { 113, 5050, 1215 }, { 125, 6267, 1573 }, { 137, 7842, 309 },
+{ 149, 8153, 495 }, { 161, 8650, 2147 }, { 173, 10799, 1984 }, { 180, 12785, 1135 },
+{ 192, 13922, 1260 }, { 199, 15184, 2047 }, { 211, 17233, 2273 }, { 218, 19508, 847 },
+{ 230, 20357, 1292 }, { 237, 21651, 709 }, { 244, 22362, 793 }, { 251, 23157, 1139 },
+{ 273, 24298, 1131 }
+};
 
-Bit8u layout_keybrd3sys[27122] = {
+static const Bit8u layout_keybrd2sys_compressed[7222] = {
+0xed, 0x5c, 0x09, 0x58, 0x54, 0x57, 0x96, 0x3e, 0xaf, 0xde, 0x2b, 0x11, 0x91, 0x0e, 0xb2, 0x2b, 
+0x09, 0x94, 0x80, 0x2c, 0x52, 0x80, 0xa2, 0xa4, 0xa7, 0xdd, 0xab, 0x0a, 0x3a, 0x21, 0x6d, 0x42, 
+0x5a, 0xc5, 0x2c, 0x0a, 0x91, 0x18, 0x26, 0x31, 0x9d, 0x91, 0x6e, 0x13, 0x32, 0x51, 0x81, 0xe0, 
+0xbe, 0xa2, 0x71, 0xc7, 0xbd, 0xdc, 0x77, 0xed, 0xef, 0x9b, 0x41, 0xe9, 0xc9, 0x27, 0x3d, 0x59, 
+0x0a, 0x11, 0xed, 0x20, 0x2a, 0xea, 0xf4, 0xb4, 0x8e, 0x68, 0x5c, 0xe3, 0x12, 0xd9, 0x64, 0x91, 
+0xcc, 0x9c, 0x73, 0xef, 0x2b, 0xea, 0x15, 0x14, 0x50, 0xe0, 0x9a, 0x9e, 0xce, 0xfb, 0x72, 0x6f, 
+0xf1, 0x28, 0x7c, 0xf7, 0x3f, 0xeb, 0x7f, 0xef, 0x3b, 0xf7, 0xfe, 0xc6, 0xf0, 0x6b, 0x10, 0x84, 
+0x88, 0x97, 0x53, 0x26, 0x4e, 0x9a, 0xf0, 0x87, 0xb4, 0x14, 0xcd, 0xeb, 0x29, 0x93, 0x52, 0x27, 
+0xfe, 0x6f, 0x4c, 0xfc, 0x48, 0xcd, 0xf8, 0xd4, 0xf7, 0x52, 0x7e, 0x9f, 0xfc, 0x7e, 0xca, 0xc7, 
+0x9a, 0x70, 0xcd, 0x47, 0x13, 0xde, 0x9d, 0x94, 0x3c, 0x69, 0xb2, 0x26, 0x20, 0x4a, 0x93, 0xfa, 
+0xcf, 0x9a, 0x7e, 0xbb, 0x55, 0x8e, 0x00, 0xfa, 0x97, 0xb4, 0xff, 0x21, 0xe8, 0x5f, 0x72, 0x10, 
+0x01, 0xff, 0xeb, 0x0a, 0xd6, 0xff, 0xbd, 0xc7, 0xda, 0x0f, 0xc4, 0xd5, 0x02, 0xef, 0xf7, 0xb3, 
+0x9f, 0xdf, 0x10, 0x57, 0xa9, 0x78, 0xbf, 0x9f, 0xdd, 0x7f, 0x5b, 0xdc, 0xc1, 0xee, 0x8f, 0x10, 
+0xe5, 0x3f, 0xeb, 0xcc, 0x3b, 0xc9, 0xfa, 0x47, 0x10, 0x55, 0xf8, 0x85, 0x61, 0x12, 0xb5, 0x01, 
+0x6a, 0x6a, 0x8b, 0x1d, 0xa8, 0x4d, 0xea, 0x4c, 0x6d, 0x90, 0x23, 0xb5, 0x81, 0x3d, 0xa8, 0x1d, 
+0xe3, 0x43, 0x6d, 0x62, 0x18, 0xb5, 0xe9, 0xfd, 0xa8, 0x1d, 0xd4, 0x9f, 0xda, 0x21, 0xe0, 0xaa, 
+0xc7, 0xae, 0x14, 0x44, 0x41, 0x80, 0xa1, 0x12, 0x36, 0x61, 0x6a, 0x95, 0x1a, 0xfc, 0x8d, 0x0e, 
+0xf8, 0x71, 0x70, 0x67, 0x6c, 0x06, 0x38, 0x62, 0x13, 0xd9, 0x45, 0x54, 0xc3, 0x3b, 0xe0, 0xe7, 
+0x84, 0x9f, 0xef, 0x76, 0xc5, 0x26, 0xce, 0x59, 0x80, 0x88, 0xd1, 0x2e, 0x02, 0x68, 0xcb, 0xbb, 
+0xe9, 0xe0, 0xda, 0x75, 0x57, 0x3d, 0xec, 0xdc, 0x55, 0xec, 0xa6, 0x83, 0x43, 0x79, 0xee, 0x3a, 
+0xa8, 0xaa, 0xf6, 0xd0, 0x41, 0x6d, 0x9d, 0xa7, 0x0e, 0x0a, 0x8e, 0x78, 0xe9, 0xe0, 0xf2, 0xf7, 
+0xde, 0x3a, 0xd8, 0xbe, 0xa3, 0xbb, 0x0e, 0x2a, 0x2a, 0x7b, 0xe8, 0x60, 0xeb, 0x36, 0x1f, 0x01, 
+0x06, 0x36, 0xf8, 0xea, 0xe0, 0xf6, 0x1d, 0xbf, 0xaf, 0xe0, 0x82, 0xdf, 0x45, 0xd0, 0xe8, 0xc0, 
+0xb8, 0xa9, 0xa7, 0x0e, 0xce, 0x9c, 0xf5, 0xd7, 0xc1, 0x8d, 0x9b, 0x01, 0x3a, 0xd8, 0xbb, 0x2f, 
+0x50, 0x07, 0x57, 0xae, 0xf6, 0xd2, 0xc1, 0xe9, 0xd2, 0x20, 0x1d, 0xfc, 0x70, 0x2b, 0x58, 0x07, 
+0x27, 0x4f, 0x85, 0xe8, 0xa0, 0xfe, 0x41, 0x6f, 0xc9, 0x8f, 0xb0, 0x7f, 0x16, 0x26, 0x40, 0x68, 
+0x88, 0x56, 0x07, 0xeb, 0xd6, 0x87, 0xeb, 0xe0, 0x70, 0x7e, 0x84, 0x0e, 0x36, 0x6c, 0x8c, 0xd4, 
+0xc1, 0xfd, 0x9a, 0x3e, 0x3a, 0xd8, 0xbd, 0xa7, 0xaf, 0x0e, 0x72, 0x0f, 0x46, 0xe9, 0xe0, 0xdc, 
+0xf9, 0x7e, 0x3a, 0x28, 0xbb, 0xd4, 0x5f, 0x07, 0x27, 0x4a, 0xa2, 0x75, 0xb0, 0x79, 0x0b, 0xa8, 
+0x55, 0x0e, 0x00, 0x46, 0x86, 0xbb, 0xf8, 0x45, 0xfe, 0x6f, 0x4d, 0x56, 0xe2, 0xc7, 0xc6, 0xbf, 
+0xbd, 0xf0, 0x75, 0x08, 0xff, 0x89, 0xa2, 0x9f, 0xd2, 0x51, 0xf4, 0x32, 0xe2, 0xa9, 0x10, 0x38, 
+0xa9, 0x93, 0x74, 0x0f, 0x8d, 0xd5, 0x41, 0xb2, 0x65, 0xa7, 0x1f, 0xc9, 0x76, 0x9a, 0x2c, 0xf1, 
+0xfe, 0x33, 0xd9, 0x3e, 0xc7, 0x77, 0xe2, 0x7d, 0xa6, 0xc4, 0xed, 0xf4, 0x03, 0x95, 0xd2, 0x4e, 
+0xcd, 0xf6, 0x89, 0x06, 0x3a, 0x8c, 0xf5, 0x2f, 0x5b, 0xdb, 0xab, 0x4a, 0x80, 0x9e, 0x7d, 0x45, 
+0x94, 0x6f, 0x94, 0x24, 0x40, 0x40, 0x3f, 0xb5, 0x00, 0xc5, 0xfd, 0x3b, 0x09, 0xd0, 0x2b, 0xda, 
+0x41, 0x80, 0xa0, 0x17, 0x3b, 0x0b, 0x10, 0xfc, 0x4b, 0x47, 0x01, 0x42, 0xfe, 0xa9, 0x0b, 0x82, 
+0xfb, 0x95, 0x93, 0x00, 0x81, 0x7d, 0xba, 0xa2, 0x1e, 0xc2, 0x9d, 0x55, 0xf0, 0xce, 0x3b, 0x7e, 
+0x2e, 0x26, 0xf8, 0x30, 0xf0, 0x95, 0xc0, 0x2e, 0x81, 0xc0, 0xae, 0x6e, 0x26, 0x18, 0x1f, 0x61, 
+0x88, 0x10, 0x23, 0x80, 0x5d, 0xae, 0x26, 0x48, 0xf3, 0x4c, 0xf0, 0xf4, 0xf0, 0x04, 0x76, 0xb9, 
+0x99, 0xe0, 0x77, 0xbd, 0x7e, 0xd3, 0xcb, 0xa9, 0x17, 0xb0, 0xcb, 0xdd, 0x04, 0x29, 0xae, 0xb1, 
+0xae, 0x6a, 0x57, 0x60, 0x97, 0x87, 0x09, 0x26, 0xf6, 0x7d, 0xad, 0xef, 0x2f, 0xfa, 0x02, 0xbb, 
+0x3c, 0x4d, 0xf0, 0xbe, 0xff, 0x4b, 0xfe, 0x0e, 0xfe, 0xc0, 0x2e, 0x2f, 0x15, 0x8c, 0x19, 0xe3, 
+0xe3, 0xad, 0x82, 0xc4, 0xc4, 0x17, 0xba, 0x9b, 0x60, 0x8a, 0xf6, 0x6d, 0x6d, 0x0f, 0x2d, 0xb0, 
+0xab, 0x87, 0x09, 0x3e, 0x08, 0x78, 0x39, 0xa0, 0x73, 0x00, 0xb0, 0xcb, 0x47, 0x92, 0x32, 0xa6, 
+0x42, 0xef, 0x01, 0xbe, 0x26, 0xf8, 0xe7, 0x9e, 0xbf, 0xee, 0xd9, 0xa9, 0x27, 0xb0, 0xcb, 0xcf, 
+0x04, 0x93, 0x3d, 0xde, 0xf2, 0xe8, 0xee, 0x01, 0xec, 0xd2, 0x98, 0xe0, 0x5f, 0xbb, 0xbd, 0xd1, 
+0xcd, 0xab, 0x1b, 0xb0, 0xab, 0xa7, 0x09, 0x92, 0x7d, 0x75, 0xbe, 0x82, 0x2f, 0xb0, 0xcb, 0xdf, 
+0x04, 0xbf, 0xef, 0xfe, 0x7a, 0x77, 0x97, 0xee, 0xc0, 0xae, 0x00, 0x13, 0x4c, 0x72, 0x1b, 0xe1, 
+0xe6, 0xea, 0x06, 0xec, 0x0a, 0x34, 0x41, 0xaa, 0x77, 0xbc, 0xf7, 0x73, 0xde, 0xc0, 0xae, 0x5e, 
+0x26, 0xf8, 0x28, 0x68, 0x78, 0x50, 0xd7, 0x20, 0x60, 0x57, 0x90, 0x09, 0xde, 0xd3, 0xc4, 0x68, 
+0x24, 0x0d, 0xb0, 0x2b, 0xd8, 0x04, 0x9f, 0x46, 0x8e, 0x8e, 0xf4, 0x8c, 0x04, 0x76, 0x85, 0xa8, 
+0x60, 0x6c, 0xfa, 0xf3, 0xa1, 0x68, 0xd3, 0x03, 0xd1, 0x5a, 0x86, 0x44, 0x68, 0x55, 0x30, 0x2c, 
+0xc9, 0x37, 0xdc, 0x04, 0x1f, 0xfb, 0x8d, 0xf4, 0x73, 0xf3, 0x03, 0x76, 0x45, 0x98, 0xe0, 0x5f, 
+0xa2, 0x5e, 0x8d, 0x72, 0x8e, 0x02, 0x76, 0x45, 0x9a, 0x60, 0x82, 0x57, 0x9c, 0x97, 0xa3, 0x17, 
+0xb0, 0xab, 0x8f, 0x09, 0x3e, 0x71, 0x1f, 0xe5, 0xee, 0xee, 0x0e, 0xec, 0xea, 0x6b, 0x82, 0xcf, 
+0xc2, 0xdf, 0x0c, 0xf7, 0x0e, 0x07, 0x76, 0x45, 0x99, 0xe0, 0xdd, 0x3e, 0xfa, 0x3e, 0xaa, 0x3e, 
+0xc0, 0xae, 0x7e, 0x2e, 0x00, 0xfd, 0x05, 0x18, 0xa4, 0x8d, 0x46, 0x5f, 0x8a, 0x1c, 0x6d, 0x82, 
+0x3f, 0xb8, 0xfc, 0xd6, 0xa5, 0x9b, 0x0b, 0xf0, 0xab, 0x51, 0x05, 0xa5, 0x5c, 0x09, 0x6a, 0x10, 
+0x8c, 0xce, 0x06, 0x69, 0xc3, 0x46, 0x78, 0x07, 0x35, 0x7b, 0x38, 0x30, 0x5f, 0xa9, 0xd9, 0xad, 
+0x11, 0xdb, 0x94, 0x9a, 0xbd, 0xe6, 0x79, 0x5d, 0xa9, 0xd9, 0x82, 0x5e, 0x47, 0x94, 0x9a, 0xdd, 
+0xe9, 0xba, 0x0b, 0xff, 0xd9, 0x62, 0xb3, 0x66, 0x4f, 0xf7, 0x2d, 0x55, 0x6a, 0x76, 0xaf, 0xff, 
+0x3e, 0x8b, 0x66, 0x0d, 0x52, 0x55, 0x35, 0x8c, 0xf1, 0x36, 0x48, 0xb5, 0x75, 0x90, 0x88, 0xba, 
+0xad, 0xd0, 0x56, 0x2a, 0x75, 0x9b, 0x1b, 0x70, 0x50, 0xa9, 0xdb, 0xde, 0x03, 0x20, 0x63, 0x2a, 
+0xea, 0x76, 0x77, 0xcf, 0x3d, 0x4a, 0xdd, 0xde, 0xf3, 0x28, 0x57, 0xea, 0xf6, 0x87, 0x6e, 0xb7, 
+0x94, 0xba, 0x35, 0xfa, 0x6e, 0x52, 0xea, 0xf6, 0x5c, 0xf7, 0xf3, 0x4a, 0xdd, 0x96, 0xb9, 0x5d, 
+0x52, 0xea, 0xf6, 0x8c, 0xf7, 0x59, 0xa5, 0x6e, 0x4f, 0x04, 0x95, 0x28, 0x75, 0xbb, 0x5d, 0xb3, 
+0x43, 0xa9, 0xdb, 0x1b, 0x91, 0x37, 0x2d, 0xba, 0x8d, 0x91, 0xee, 0xd7, 0xa0, 0x7a, 0x43, 0x25, 
+0x0c, 0x66, 0x90, 0xb3, 0xba, 0xb7, 0x7a, 0x28, 0xf0, 0xa8, 0xc8, 0x6e, 0xcc, 0x9c, 0xa5, 0x8d, 
+0x91, 0xea, 0x1f, 0xa0, 0xbe, 0x51, 0xdd, 0x97, 0xfd, 0xbe, 0x57, 0xaa, 0xfb, 0x64, 0xd4, 0x29, 
+0xa5, 0xba, 0x0f, 0x79, 0xe5, 0x29, 0xd5, 0x7d, 0xc5, 0xfd, 0xaa, 0x52, 0xdd, 0xb7, 0xc3, 0xef, 
+0x28, 0xd5, 0xbd, 0xb9, 0xcf, 0x16, 0x8b, 0xba, 0x63, 0xa4, 0x75, 0xeb, 0x61, 0xf6, 0x9c, 0xfe, 
+0xec, 0x89, 0xf3, 0x17, 0x44, 0xb3, 0x7e, 0x61, 0x36, 0x2a, 0xfe, 0x82, 0xcb, 0x45, 0x68, 0x54, 
+0x3c, 0x29, 0xba, 0x51, 0xf9, 0x5c, 0x4b, 0x2f, 0xca, 0xa3, 0x9d, 0x0c, 0x8f, 0xd2, 0x02, 0xe0, 
+0x1f, 0x16, 0xc0, 0x32, 0xc3, 0x33, 0x67, 0x01, 0x66, 0x75, 0x4f, 0x05, 0xd7, 0x6b, 0xc4, 0x90, 
+0x0c, 0xb1, 0xda, 0x3f, 0x09, 0x86, 0x58, 0x35, 0xcb, 0x1a, 0xce, 0x4d, 0x32, 0xcf, 0x28, 0xd6, 
+0x1a, 0xd2, 0x26, 0x09, 0x97, 0x04, 0xea, 0x57, 0xb1, 0x9f, 0x07, 0xa6, 0x7d, 0xa7, 0xe2, 0x7d, 
+0x85, 0xd0, 0x5a, 0x86, 0x51, 0x32, 0xa2, 0xe6, 0x5c, 0xc8, 0x99, 0xda, 0xc1, 0x6d, 0x30, 0x22, 
+0xa2, 0x02, 0xfe, 0x44, 0x05, 0x1e, 0x10, 0x15, 0x18, 0x48, 0x54, 0x60, 0x00, 0x51, 0x81, 0xa1, 
+0x98, 0xf4, 0x7f, 0x0a, 0x73, 0xd1, 0xc1, 0xae, 0x79, 0x98, 0xf4, 0xaf, 0xae, 0xc4, 0xa4, 0x7f, 
+0x79, 0x19, 0x26, 0xfd, 0xdd, 0xf3, 0xdd, 0xf5, 0xb0, 0x6d, 0x56, 0x03, 0x66, 0xfd, 0x7d, 0xd9, 
+0x98, 0xf5, 0xb7, 0xcc, 0xc0, 0xac, 0x7f, 0x3d, 0x07, 0xb3, 0xfe, 0x8d, 0xd5, 0x98, 0xf5, 0x77, 
+0xcc, 0xc1, 0xac, 0x7f, 0x65, 0x85, 0x8f, 0x0e, 0x6e, 0xae, 0xc1, 0xac, 0xff, 0xfd, 0x72, 0x3f, 
+0x4c, 0xe8, 0x6b, 0x31, 0xe7, 0x6f, 0x9e, 0x8e, 0x39, 0xdf, 0x98, 0x85, 0x39, 0xff, 0xc0, 0xe2, 
+0x80, 0xaf, 0xe0, 0x22, 0x7c, 0x11, 0x80, 0x59, 0x7f, 0xff, 0x22, 0xcc, 0xfa, 0x7b, 0x16, 0x60, 
+0xd6, 0xdf, 0x3a, 0x13, 0xb3, 0xfe, 0xf6, 0xd9, 0x98, 0xf5, 0x6f, 0xaf, 0x0f, 0xfd, 0x0a, 0xee, 
+0x85, 0xfe, 0x08, 0x16, 0xea, 0x83, 0xa4, 0x04, 0x93, 0xff, 0xdd, 0x8d, 0x98, 0xfc, 0xaf, 0xad, 
+0xc2, 0xe4, 0x5f, 0xb6, 0x04, 0x93, 0xff, 0xde, 0x85, 0x98, 0xfc, 0x77, 0xce, 0xc5, 0xe4, 0x7f, 
+0x69, 0x29, 0x26, 0xff, 0x5b, 0xeb, 0x30, 0xf9, 0x6f, 0x9a, 0x86, 0xc9, 0xff, 0xce, 0x06, 0x0c, 
+0xc9, 0x11, 0x5a, 0x60, 0x1c, 0xb1, 0xc1, 0xc5, 0x80, 0xed, 0x99, 0x52, 0x57, 0xea, 0xf2, 0x0f, 
+0xe3, 0x88, 0xd3, 0x12, 0xbc, 0x0d, 0x90, 0x1a, 0x7f, 0xe1, 0x7c, 0x0f, 0x03, 0xd4, 0xd6, 0x8c, 
+0x99, 0xea, 0x63, 0x80, 0x93, 0x25, 0x89, 0x19, 0xbe, 0x06, 0x48, 0xd6, 0x1d, 0x29, 0xf0, 0xa3, 
+0xef, 0xd5, 0xd7, 0xf9, 0x53, 0x77, 0x30, 0x37, 0x14, 0x84, 0x42, 0x2d, 0x7d, 0x3c, 0x77, 0x36, 
+0x9c, 0xba, 0xd3, 0xa7, 0x22, 0xa8, 0x3b, 0x51, 0xdc, 0x97, 0xba, 0xbc, 0x43, 0x66, 0x46, 0xf5, 
+0x2b, 0x40, 0x9b, 0x1d, 0xe7, 0x90, 0x5c, 0x91, 0x5a, 0x95, 0x76, 0x5f, 0x57, 0x1e, 0x5f, 0x99, 
+0x50, 0xad, 0x19, 0xf7, 0x33, 0x90, 0xed, 0x94, 0x8e, 0xca, 0x96, 0x11, 0xca, 0x86, 0x46, 0x7a, 
+0xf5, 0x75, 0x77, 0x51, 0xfa, 0xb2, 0x4d, 0x23, 0x9f, 0x2f, 0xd4, 0x31, 0x23, 0x5f, 0x22, 0x1b, 
+0x39, 0xff, 0xf6, 0xc0, 0x34, 0x27, 0x95, 0xbd, 0x46, 0xce, 0x54, 0x1a, 0xd8, 0xcc, 0xd4, 0x7b, 
+0x2b, 0x8d, 0xdc, 0xca, 0xbc, 0x91, 0x83, 0x3d, 0x20, 0x0e, 0x16, 0x4e, 0x1c, 0x2c, 0x92, 0x38, 
+0x98, 0x3f, 0x71, 0xb0, 0x01, 0xc4, 0xc1, 0xb4, 0xc4, 0xc1, 0x22, 0x88, 0x83, 0xbd, 0x43, 0x1c, 
+0x6c, 0x28, 0x71, 0xb0, 0x5e, 0xc4, 0xc1, 0x7a, 0x0e, 0x46, 0x05, 0x0d, 0x1c, 0xfb, 0x94, 0x14, 
+0x24, 0x40, 0x7a, 0x58, 0x53, 0xd6, 0xdf, 0x0e, 0xf5, 0xa0, 0x7e, 0xa3, 0x7f, 0x84, 0xa7, 0x6f, 
+0xfc, 0x3f, 0x43, 0xc9, 0xab, 0xd0, 0x2b, 0xd3, 0x9b, 0x4e, 0x39, 0xda, 0x2f, 0xfa, 0x26, 0xbe, 
+0x51, 0xf8, 0xa6, 0xe4, 0x06, 0xf0, 0xd2, 0x6f, 0xb4, 0x00, 0xb1, 0xc3, 0xb5, 0x43, 0x05, 0xfc, 
+0x34, 0x54, 0x88, 0x1d, 0xee, 0x68, 0xd3, 0x55, 0x3e, 0x61, 0x6d, 0x8a, 0x38, 0x40, 0xc5, 0xfb, 
+0xc9, 0x42, 0x1c, 0x7e, 0x2a, 0x53, 0x05, 0xb2, 0x6f, 0x97, 0xa9, 0x32, 0x55, 0xe1, 0xf8, 0x69, 
+0xa4, 0xd8, 0x85, 0x4d, 0x3e, 0x46, 0x8a, 0x6f, 0x8b, 0x6e, 0x12, 0xcd, 0x4c, 0xee, 0xc3, 0x4f, 
+0xf2, 0xcc, 0xe4, 0xa7, 0xd6, 0x66, 0xd0, 0xe6, 0xd9, 0x5e, 0x10, 0x85, 0xa1, 0x48, 0x9a, 0xed, 
+0x85, 0x74, 0xc1, 0x26, 0x94, 0xe6, 0x7a, 0x83, 0x51, 0xfe, 0xc1, 0x14, 0x9a, 0xc2, 0x7a, 0xa3, 
+0xd4, 0x53, 0x62, 0x51, 0xd4, 0x93, 0xdf, 0x62, 0x26, 0x83, 0xa2, 0x9e, 0x10, 0x87, 0xa2, 0x4e, 
+0x8d, 0x47, 0xd9, 0x26, 0xeb, 0x82, 0x05, 0xf1, 0xd8, 0xf1, 0x10, 0x41, 0x2c, 0x3a, 0x1a, 0x2a, 
+0x4a, 0x63, 0xd3, 0xe1, 0x79, 0x0c, 0x22, 0x85, 0xc3, 0x50, 0x40, 0xe3, 0x0d, 0x28, 0x96, 0x89, 
+0xaf, 0xf5, 0x53, 0x81, 0x76, 0x20, 0x3a, 0x20, 0x44, 0x0c, 0x18, 0x12, 0x2d, 0x4a, 0xe1, 0x38, 
+0x97, 0x24, 0x13, 0x19, 0x8d, 0x64, 0xb9, 0x71, 0x06, 0x3e, 0xce, 0x29, 0x79, 0x56, 0xca, 0xfc, 
+0x09, 0xd9, 0xa9, 0x2b, 0xd2, 0x56, 0xe9, 0x0e, 0xc5, 0x9e, 0x8e, 0xbb, 0x10, 0x7f, 0x39, 0xe1, 
+0x07, 0xcd, 0xb8, 0x4c, 0x87, 0xe4, 0x82, 0x89, 0x5b, 0x53, 0xbf, 0xd7, 0x1d, 0x79, 0x6d, 0x5b, 
+0xfc, 0x15, 0x4d, 0x66, 0x92, 0x53, 0xf2, 0x8c, 0x94, 0xb9, 0x13, 0x16, 0xa6, 0x2e, 0x4b, 0x5b, 
+0xa9, 0x3b, 0x18, 0x7b, 0x32, 0xee, 0x6c, 0xfc, 0xa5, 0x84, 0x9b, 0x9a, 0xa4, 0xbb, 0xcf, 0x25, 
+0x1b, 0xc7, 0xcf, 0x49, 0x99, 0x3e, 0x61, 0x53, 0xea, 0xe6, 0xb4, 0x2d, 0x93, 0x6f, 0xe9, 0x72, 
+0x0d, 0x59, 0xb1, 0x5f, 0xc4, 0x9d, 0x89, 0xbf, 0x98, 0x70, 0xe3, 0xad, 0xdb, 0x9a, 0xbb, 0xb5, 
+0x5d, 0x93, 0x67, 0xa6, 0xcc, 0x9b, 0xb0, 0x20, 0x75, 0x79, 0xda, 0xb4, 0xc9, 0x39, 0xba, 0x45, 
+0xb1, 0xa7, 0xe2, 0xce, 0xc5, 0xaf, 0x4e, 0x58, 0xa3, 0xa9, 0x05, 0x0a, 0xc8, 0xeb, 0x48, 0x08, 
+0xf3, 0x68, 0x72, 0x5b, 0x83, 0xf3, 0xda, 0xb9, 0x8b, 0xba, 0x09, 0x70, 0x7b, 0x3e, 0x4e, 0xeb, 
+0x2f, 0xec, 0x9c, 0x83, 0xc6, 0xf6, 0xc3, 0x11, 0x9c, 0xd8, 0xde, 0x39, 0x81, 0x02, 0x28, 0x2f, 
+0x41, 0x01, 0x5c, 0xda, 0x4b, 0x13, 0xdb, 0x7d, 0x64, 0x6b, 0xf9, 0x68, 0x6b, 0x37, 0x0b, 0x7a, 
+0xe0, 0xdf, 0xed, 0xf7, 0xc1, 0xe6, 0x00, 0xca, 0xe3, 0xcc, 0x56, 0xb4, 0xb5, 0x5b, 0xc5, 0x68, 
+0x6b, 0xe7, 0x77, 0xa0, 0xad, 0x55, 0x9c, 0x44, 0x5b, 0x3b, 0xb7, 0x1d, 0xa7, 0xb5, 0x65, 0xbb, 
+0xd1, 0xd2, 0xae, 0x1f, 0x46, 0x4b, 0xfb, 0x3e, 0x17, 0x2d, 0xed, 0xca, 0xc1, 0x60, 0x95, 0x43, 
+0xe1, 0xd1, 0xa2, 0x10, 0x01, 0x16, 0x2e, 0x40, 0x27, 0xdf, 0x73, 0x4f, 0xe1, 0xe4, 0xab, 0xd7, 
+0x68, 0xc9, 0x38, 0x77, 0x69, 0xd1, 0xd6, 0x2a, 0x4f, 0xa1, 0x28, 0xab, 0x4f, 0xa3, 0xad, 0xd5, 
+0x95, 0xa2, 0xad, 0x9d, 0xdd, 0x86, 0x42, 0xbd, 0x96, 0x87, 0xb6, 0x76, 0xf5, 0x10, 0x8a, 0xb0, 
+0x6a, 0x15, 0x17, 0xe1, 0x9c, 0xc6, 0xc9, 0xfc, 0xdd, 0xe7, 0xce, 0xac, 0xbd, 0xb0, 0xbe, 0x6c, 
+0xc3, 0xe5, 0x8d, 0x37, 0x36, 0x97, 0x6f, 0xa9, 0x6b, 0xd8, 0x3a, 0x7b, 0x67, 0xf6, 0xee, 0xc5, 
+0xfb, 0xbe, 0xc8, 0x5f, 0x5a, 0xb2, 0xa2, 0x34, 0x07, 0x45, 0xa1, 0xbe, 0x6c, 0x2c, 0xaf, 0xdf, 
+0xb7, 0xa4, 0x64, 0xa5, 0xa6, 0xf6, 0xbe, 0x78, 0x79, 0x53, 0xf9, 0x03, 0xcd, 0x7d, 0x30, 0x43, 
+0xaf, 0xfd, 0x2d, 0x42, 0xdf, 0xfd, 0x06, 0x2a, 0x7c, 0xdd, 0x4c, 0x44, 0xbe, 0xf3, 0x0b, 0x44, 
+0xbe, 0x67, 0x29, 0x22, 0xdf, 0xbb, 0x0c, 0x91, 0x6f, 0x9c, 0x83, 0xc8, 0x8d, 0x73, 0x69, 0x4a, 
+0xbf, 0x88, 0xbc, 0x6c, 0x31, 0xe2, 0xcd, 0xc9, 0x42, 0xbc, 0xbb, 0x96, 0x20, 0xde, 0xb5, 0x33, 
+0x10, 0xef, 0xbe, 0xe5, 0x88, 0x77, 0xcd, 0x74, 0xc4, 0xbb, 0x61, 0x36, 0xe2, 0xdd, 0x96, 0x8d, 
+0x78, 0x37, 0xcd, 0x43, 0xbc, 0x9b, 0xe7, 0xa3, 0x9d, 0x14, 0x1e, 0x45, 0xa4, 0xe3, 0xee, 0x29, 
+0x7c, 0xaa, 0x21, 0x1d, 0x7d, 0x6a, 0xfd, 0x2c, 0xc4, 0xb9, 0x7f, 0x05, 0xe2, 0x3c, 0xb0, 0x32, 
+0x92, 0x80, 0xaf, 0x8a, 0x44, 0xa4, 0xab, 0xa7, 0x21, 0xd2, 0xad, 0x0b, 0x11, 0xe9, 0x96, 0x05, 
+0x88, 0xd4, 0x23, 0xdd, 0x32, 0x7d, 0x0f, 0x7e, 0x2e, 0xa7, 0x6c, 0xdd, 0xa5, 0x0d, 0x97, 0x8d, 
+0x57, 0xb6, 0x5f, 0xdd, 0x7b, 0xed, 0xe2, 0x8d, 0xac, 0x9b, 0x33, 0x7f, 0x98, 0x7d, 0x6b, 0xee, 
+0xed, 0x45, 0x77, 0x96, 0xdd, 0x5d, 0xf5, 0xa3, 0x26, 0xd8, 0x5f, 0x6d, 0xfc, 0x7e, 0xef, 0xf5, 
+0xb9, 0x95, 0xcb, 0xaa, 0x34, 0xfe, 0x32, 0x36, 0x9c, 0x9e, 0x91, 0x56, 0xd3, 0x11, 0xda, 0x85, 
+0x9d, 0x8f, 0x5b, 0xa9, 0x4a, 0x7d, 0xa6, 0x23, 0xca, 0xb1, 0xe9, 0x76, 0xeb, 0xb3, 0x11, 0x65, 
+0x46, 0xdb, 0x9a, 0x14, 0x49, 0x93, 0x9a, 0xda, 0x60, 0xae, 0xc5, 0x60, 0xd0, 0xe7, 0x4b, 0x8e, 
+0x7f, 0xa3, 0xd0, 0xf2, 0x37, 0x68, 0x2b, 0xa0, 0x9c, 0x17, 0x78, 0x5f, 0x0f, 0xfd, 0x59, 0x40, 
+0x19, 0x20, 0x07, 0x94, 0x09, 0xaa, 0xc9, 0x2c, 0xa0, 0x8c, 0x95, 0x03, 0xca, 0x76, 0x71, 0x06, 
+0x0b, 0x28, 0x95, 0x76, 0x2e, 0xc9, 0x61, 0x40, 0x69, 0x90, 0xb0, 0xcd, 0x7c, 0xc0, 0x32, 0xce, 
+0xba, 0x4e, 0xd4, 0x56, 0x39, 0xe0, 0x9d, 0x20, 0x77, 0x1e, 0x64, 0xf0, 0x63, 0x48, 0x71, 0x17, 
+0x6c, 0x43, 0xcf, 0x3b, 0x61, 0x3b, 0xb8, 0xa6, 0xab, 0x0a, 0xe3, 0xcc, 0x3d, 0x67, 0x15, 0x24, 
+0x8e, 0xd9, 0xd3, 0x43, 0x85, 0xe1, 0x66, 0xbf, 0x8f, 0x0a, 0x27, 0x1e, 0x07, 0x82, 0x31, 0xfe, 
+0x8c, 0x0b, 0x41, 0xbd, 0x99, 0xc3, 0x8a, 0x0a, 0x02, 0x86, 0xed, 0xb6, 0x27, 0x9a, 0x30, 0x8a, 
+0xb0, 0x9a, 0x86, 0xb1, 0x6e, 0x8d, 0xf5, 0x30, 0xb0, 0x75, 0x77, 0x64, 0x4b, 0x60, 0x5d, 0xe8, 
+0xf3, 0x7c, 0x27, 0x6a, 0x71, 0x04, 0xd8, 0xde, 0x63, 0xfc, 0x78, 0x0f, 0x3a, 0xc1, 0xc0, 0x01, 
+0x64, 0x29, 0x99, 0x76, 0xfb, 0x7f, 0x47, 0xbc, 0x5e, 0xe5, 0x70, 0xb4, 0xa8, 0xc8, 0xda, 0xed, 
+0xe9, 0xf1, 0xf3, 0x9a, 0xdb, 0x89, 0x1e, 0xed, 0x64, 0x55, 0x13, 0x43, 0x69, 0x44, 0x88, 0x6d, 
+0xbb, 0x11, 0xf2, 0x78, 0xc1, 0x1f, 0xc7, 0xff, 0xf5, 0x87, 0x8b, 0x1d, 0x12, 0x7b, 0x1a, 0x5f, 
+0x58, 0x64, 0xa3, 0xf0, 0x30, 0x3f, 0x9f, 0x5a, 0x67, 0xd6, 0xca, 0xee, 0xb7, 0x3b, 0xd3, 0xde, 
+0xc8, 0xd2, 0x83, 0xfd, 0x99, 0x0f, 0x6b, 0xdb, 0x1f, 0x65, 0x30, 0x1b, 0x1d, 0xa5, 0x50, 0x33, 
+0xd6, 0x12, 0x6a, 0x54, 0x6a, 0xa8, 0x31, 0xda, 0x15, 0x6b, 0xec, 0x02, 0xa4, 0x1c, 0x5f, 0x18, 
+0x6b, 0x3b, 0x16, 0x9c, 0x44, 0xf6, 0xb7, 0xfc, 0x89, 0xca, 0xa7, 0x70, 0x81, 0xa9, 0x6e, 0x1b, 
+0xed, 0x8d, 0x57, 0x1d, 0x36, 0xc2, 0xc6, 0x30, 0xc5, 0x9e, 0x6b, 0x57, 0x9c, 0x6a, 0x71, 0xd4, 
+0x56, 0x92, 0xe8, 0x40, 0x00, 0xfb, 0x7d, 0x60, 0x27, 0xc7, 0x63, 0xc4, 0x88, 0x8e, 0xb5, 0xc9, 
+0x88, 0x8e, 0x8b, 0xbc, 0x77, 0x15, 0x9d, 0x24, 0x0a, 0x5c, 0x0e, 0x6a, 0x1e, 0xc0, 0x86, 0x49, 
+0x7f, 0x95, 0x28, 0x70, 0xd5, 0xaa, 0x79, 0x00, 0xf3, 0x57, 0x17, 0xaa, 0x29, 0x80, 0xfd, 0x51, 
+0xa0, 0xb7, 0x0c, 0x23, 0xc4, 0x62, 0x60, 0x6f, 0x1b, 0x5a, 0x9b, 0x5c, 0x34, 0x70, 0x2f, 0x52, 
+0x7a, 0x0e, 0x8b, 0x0a, 0x2d, 0xd2, 0x20, 0x36, 0xdd, 0xd8, 0xcf, 0xa6, 0x1b, 0x07, 0xcc, 0x94, 
+0xa8, 0xf0, 0xa8, 0x85, 0x01, 0x31, 0x46, 0xac, 0x12, 0xf1, 0xd7, 0xfb, 0xea, 0x99, 0xcf, 0x3e, 
+0x50, 0xd3, 0x0f, 0xc5, 0xeb, 0xe8, 0x41, 0x45, 0x7b, 0xd9, 0xcc, 0x65, 0x0f, 0x9b, 0xb9, 0x54, 
+0x38, 0x31, 0x09, 0xb2, 0x87, 0xe6, 0x3b, 0xd3, 0x97, 0x36, 0x54, 0xbb, 0x18, 0xe0, 0x0f, 0xbf, 
+0x9d, 0xb9, 0xa8, 0x1b, 0xb1, 0xec, 0xd9, 0x8b, 0x5d, 0x0d, 0x38, 0x88, 0xe9, 0x5f, 0xb8, 0x91, 
+0x13, 0xef, 0x72, 0xa7, 0x7b, 0xd7, 0xae, 0x7b, 0x18, 0x70, 0x4c, 0xd3, 0xd6, 0x78, 0x1a, 0x70, 
+0x54, 0x5b, 0x6e, 0x78, 0x19, 0x70, 0x5c, 0x9b, 0xce, 0x78, 0x7f, 0xc3, 0x16, 0x4f, 0x37, 0x7b, 
+0x5f, 0x84, 0xee, 0xf4, 0xb5, 0xe5, 0xab, 0x19, 0xab, 0x37, 0xe6, 0x32, 0x56, 0x5f, 0x56, 0xa5, 
+0x61, 0xe4, 0xbd, 0x24, 0x88, 0xba, 0xb5, 0xeb, 0x83, 0x45, 0x04, 0x58, 0x59, 0x13, 0x22, 0x3e, 
+0x07, 0x70, 0xec, 0x78, 0x28, 0x8d, 0x3f, 0x8c, 0x1e, 0xbf, 0xfb, 0x3c, 0xa3, 0xfc, 0x4b, 0x96, 
+0x46, 0x18, 0x10, 0x4d, 0xde, 0xe1, 0xbe, 0x06, 0xc4, 0xb3, 0x75, 0x5b, 0x14, 0x3d, 0xfe, 0x6a, 
+0x3f, 0xfa, 0xc6, 0x9c, 0xac, 0x68, 0x1a, 0xed, 0x4e, 0x9b, 0x00, 0x99, 0xfb, 0x94, 0xfe, 0x5d, 
+0xc1, 0x7c, 0x8a, 0x54, 0xb5, 0xa5, 0xa8, 0xcf, 0x23, 0x3d, 0x8f, 0xee, 0x14, 0x34, 0x8a, 0x1e, 
+0x5b, 0xea, 0x02, 0x28, 0x6a, 0x25, 0x5f, 0xe9, 0x31, 0x5e, 0xac, 0x6a, 0x21, 0x60, 0xb4, 0x3d, 
+0x72, 0x65, 0x5e, 0x8a, 0xa0, 0xcf, 0x0f, 0x99, 0x97, 0x78, 0xe8, 0x46, 0x79, 0xec, 0x86, 0xc7, 
+0x9e, 0x75, 0xcc, 0x69, 0xc6, 0xbe, 0x04, 0xd3, 0xae, 0x0c, 0xc1, 0x61, 0x28, 0x47, 0xd6, 0x98, 
+0x69, 0x44, 0x39, 0x51, 0x59, 0xe4, 0xa9, 0xb4, 0x81, 0xc7, 0x94, 0x38, 0x2c, 0x26, 0x60, 0x1f, 
+0xa9, 0x6d, 0x7f, 0x16, 0x68, 0x09, 0x56, 0x63, 0x5e, 0xf9, 0xac, 0xbf, 0xe0, 0x08, 0x10, 0x37, 
+0x52, 0x5b, 0x24, 0xc4, 0x8d, 0x94, 0xd8, 0xd4, 0x58, 0x68, 0x92, 0x26, 0x62, 0x80, 0xbf, 0xa2, 
+0x3b, 0x07, 0x57, 0x64, 0xde, 0x4a, 0x7d, 0x22, 0x12, 0x54, 0x67, 0xa1, 0x39, 0x7f, 0x65, 0xbc, 
+0x95, 0xaf, 0x29, 0xad, 0xe3, 0xf3, 0x61, 0xbc, 0x11, 0x39, 0xd5, 0x51, 0x44, 0xae, 0x3a, 0xc6, 
+0xa7, 0x0b, 0x76, 0xa1, 0x89, 0x2f, 0x30, 0xb6, 0x9a, 0xd1, 0xd5, 0x80, 0x21, 0x66, 0xec, 0xf3, 
+0xce, 0x9c, 0x7a, 0xba, 0x90, 0x9d, 0x0e, 0x6b, 0x39, 0x31, 0xd0, 0xab, 0x47, 0x1f, 0xe2, 0xb7, 
+0x99, 0x3c, 0x2f, 0xe8, 0x30, 0xc4, 0x84, 0x88, 0x62, 0x61, 0x61, 0x92, 0x6f, 0xa8, 0x0a, 0x19, 
+0x2b, 0x66, 0x5d, 0x24, 0xbc, 0xe3, 0xfa, 0xd1, 0x7a, 0x60, 0x7f, 0x5a, 0x0f, 0x8c, 0xa6, 0x37, 
+0xaa, 0x2c, 0x5f, 0xf0, 0xd0, 0x29, 0x33, 0xda, 0xbb, 0xce, 0xc9, 0x46, 0x65, 0xc8, 0x50, 0x06, 
+0x0c, 0xc0, 0xa7, 0x2c, 0x5c, 0x80, 0x7f, 0xb8, 0x22, 0x1b, 0x82, 0x95, 0xdf, 0xcb, 0xd1, 0x6d, 
+0xc5, 0xef, 0x6d, 0x8b, 0xdf, 0x9e, 0xb0, 0xe3, 0xad, 0x55, 0x28, 0xd7, 0xa2, 0x3b, 0x82, 0xe3, 
+0x26, 0x12, 0x9b, 0x09, 0xcc, 0x62, 0x53, 0xb7, 0x20, 0x36, 0x64, 0x75, 0x02, 0x17, 0x1b, 0xf5, 
+0x89, 0xe2, 0x0c, 0x61, 0x75, 0x1b, 0x62, 0x53, 0xe3, 0xe7, 0xe2, 0xc0, 0xc7, 0x20, 0x3c, 0x29, 
+0x78, 0xe8, 0x5f, 0x94, 0xc2, 0x73, 0x28, 0x2a, 0x3a, 0x8a, 0xc2, 0x13, 0x8f, 0x1f, 0xab, 0x09, 
+0x53, 0x49, 0x61, 0xbd, 0x0b, 0x2d, 0x79, 0x56, 0x0e, 0xd7, 0xf8, 0x28, 0x9a, 0x21, 0xa0, 0x34, 
+0x87, 0x44, 0xeb, 0x51, 0x9c, 0xe9, 0x6c, 0x82, 0xc0, 0xc4, 0x6d, 0x2d, 0xd5, 0x96, 0x42, 0x79, 
+0x8b, 0xa1, 0xbb, 0x15, 0x2d, 0xb4, 0x1c, 0xb6, 0x6b, 0xc4, 0xe4, 0xd9, 0xba, 0xc5, 0x9a, 0x9a, 
+0xa6, 0x09, 0x02, 0xd4, 0x82, 0x88, 0x44, 0x92, 0x94, 0xc7, 0xa8, 0x43, 0x26, 0x57, 0xe1, 0x38, 
+0x91, 0x06, 0x85, 0x83, 0x50, 0xd3, 0x20, 0x68, 0x08, 0x9a, 0xa4, 0xd6, 0xd4, 0xea, 0xdf, 0x99, 
+0x1e, 0x4c, 0x8f, 0xd5, 0x2d, 0x62, 0x0f, 0xf4, 0x37, 0x3f, 0x10, 0x42, 0xdf, 0xed, 0x8c, 0x7e, 
+0x32, 0x22, 0x5e, 0xfb, 0xaa, 0x30, 0x22, 0xde, 0x49, 0xb2, 0x45, 0xa7, 0x16, 0xf2, 0x15, 0x59, 
+0xf1, 0x39, 0xd5, 0x3c, 0x15, 0x57, 0xf8, 0x5c, 0x81, 0x0c, 0x60, 0x9a, 0x40, 0xfd, 0xeb, 0xe2, 
+0x2b, 0xec, 0xaf, 0xb0, 0xe7, 0x74, 0x4b, 0xfa, 0x46, 0xcd, 0xfb, 0x6f, 0xd9, 0xfd, 0x5f, 0xa5, 
+0xfd, 0x92, 0xbd, 0x12, 0x1f, 0x90, 0x76, 0xc1, 0x81, 0xf7, 0xff, 0xd9, 0xe9, 0xa8, 0x43, 0x73, 
+0x7a, 0xd5, 0x74, 0x9e, 0xa8, 0x22, 0x0f, 0x2f, 0xe4, 0xeb, 0xe1, 0x12, 0xa6, 0xe2, 0xa3, 0xe0, 
+0x4b, 0x4b, 0xe2, 0xc5, 0x9d, 0x58, 0x78, 0x91, 0x8d, 0x48, 0x0d, 0x91, 0xc7, 0xd8, 0x6c, 0xb1, 
+0xae, 0x0b, 0x7e, 0x0e, 0x3d, 0xce, 0x17, 0xa5, 0x50, 0xe5, 0x43, 0xff, 0xe2, 0x8c, 0x56, 0xd1, 
+0xfb, 0x3b, 0x66, 0x3f, 0x63, 0xbb, 0x51, 0x9b, 0x8e, 0x19, 0x2f, 0x25, 0xb6, 0x9a, 0xd1, 0x85, 
+0x0d, 0xee, 0xd4, 0x06, 0x7a, 0xf0, 0x97, 0xd7, 0x65, 0xf4, 0x6a, 0x0b, 0xff, 0xe7, 0xc6, 0xa5, 
+0x47, 0xe3, 0x1a, 0xe4, 0xad, 0x47, 0xeb, 0x1a, 0x82, 0xa4, 0xcd, 0x68, 0xac, 0xf6, 0xd1, 0xc3, 
+0xc2, 0xb3, 0x1b, 0xb8, 0x7d, 0xd1, 0x8d, 0xc0, 0x10, 0x6a, 0xcb, 0x70, 0xee, 0x90, 0x38, 0x26, 
+0x4c, 0x07, 0x33, 0x0e, 0x6a, 0xf9, 0xeb, 0x6c, 0x7a, 0xd9, 0x45, 0x2f, 0xbd, 0x98, 0xb1, 0x45, 
+0x32, 0xc3, 0xed, 0x43, 0xed, 0xd4, 0xbe, 0x7a, 0x34, 0xbc, 0x0c, 0x66, 0x79, 0x55, 0x56, 0x96, 
+0x27, 0x75, 0x45, 0x1b, 0x57, 0x4e, 0x4e, 0x3d, 0xb9, 0xd1, 0xd9, 0xcb, 0x13, 0xcc, 0x5a, 0x6c, 
+0xc9, 0x48, 0x3b, 0x66, 0x8c, 0xf7, 0xc5, 0xf1, 0x73, 0x0c, 0x59, 0x98, 0x1d, 0x55, 0xcc, 0xe4, 
+0x58, 0xa8, 0x2d, 0x64, 0x53, 0x9d, 0x22, 0x26, 0xfc, 0x63, 0x0e, 0xd4, 0x1e, 0x67, 0x5c, 0x6d, 
+0x1c, 0xa3, 0xf6, 0x7f, 0x61, 0xd4, 0xfe, 0x3b, 0xc6, 0xd8, 0x8a, 0xbb, 0x52, 0x7b, 0x82, 0x4d, 
+0x81, 0x4a, 0x30, 0xb7, 0x4c, 0x1a, 0x81, 0xb9, 0xe5, 0x93, 0x51, 0x0c, 0xd9, 0x6e, 0xb4, 0xe4, 
+0x23, 0x05, 0x7e, 0x7a, 0xf8, 0x78, 0xe4, 0x09, 0x8d, 0x1e, 0xde, 0x8b, 0x29, 0xe9, 0x45, 0xb7, 
+0xe7, 0x06, 0xe9, 0xe1, 0xa3, 0xe1, 0xeb, 0xd1, 0x79, 0xf7, 0xe5, 0x85, 0x60, 0x22, 0x3a, 0x0f, 
+0x15, 0x6e, 0xe3, 0x37, 0xbe, 0x77, 0x3a, 0xe5, 0xdc, 0x47, 0x2b, 0x27, 0x5e, 0x99, 0xd4, 0xf0, 
+0xf1, 0xb5, 0x4f, 0xd6, 0x4d, 0xd9, 0x61, 0xd8, 0x1b, 0x73, 0x32, 0xf6, 0xd0, 0xf0, 0x15, 0xaf, 
+0x95, 0x8e, 0x78, 0x30, 0xf2, 0xea, 0xa8, 0xb5, 0x6f, 0x6f, 0xd7, 0x54, 0x24, 0x39, 0x24, 0xcf, 
+0x20, 0xb1, 0xe8, 0x0e, 0x92, 0x48, 0x34, 0x49, 0x95, 0x62, 0xf2, 0x11, 0x5d, 0x81, 0xa6, 0xb2, 
+0x46, 0x4c, 0x9b, 0x95, 0x70, 0x41, 0x53, 0x53, 0xae, 0x4e, 0xde, 0x96, 0xb2, 0x0b, 0x9d, 0x61, 
+0xa7, 0xa6, 0xbc, 0x4e, 0x9c, 0x92, 0xff, 0xf6, 0x61, 0x4d, 0xdd, 0xdd, 0xee, 0x48, 0xae, 0x66, 
+0x93, 0x58, 0x3e, 0x5a, 0x3a, 0xf1, 0xfb, 0xd4, 0xcd, 0x93, 0x6e, 0x7e, 0x9c, 0x43, 0xe2, 0x99, 
+0xb2, 0x07, 0x69, 0xd6, 0x62, 0x12, 0xd1, 0xf0, 0x25, 0xaf, 0x5d, 0x8e, 0xbf, 0x38, 0xe2, 0xfa, 
+0xc8, 0x55, 0x24, 0xaa, 0xb7, 0xb3, 0x35, 0x77, 0xef, 0xa9, 0x53, 0x17, 0xa4, 0xd5, 0xc7, 0xcf, 
+0x47, 0xa1, 0xde, 0xab, 0x75, 0xb4, 0x38, 0x53, 0xec, 0x29, 0x59, 0x64, 0x0e, 0xe3, 0xe7, 0x7c, 
+0xbc, 0xef, 0x93, 0x3b, 0x86, 0xac, 0x91, 0x79, 0xa3, 0xce, 0x33, 0xd1, 0x59, 0x66, 0x3f, 0xcc, 
+0x87, 0x99, 0xe4, 0x8c, 0x9d, 0x9b, 0x4d, 0x87, 0xba, 0xf2, 0x09, 0xa3, 0x01, 0x6e, 0xad, 0x0b, 
+0xee, 0xed, 0x42, 0x6b, 0xc2, 0xdd, 0x68, 0x81, 0xda, 0x95, 0x96, 0xae, 0xeb, 0xdc, 0xbe, 0x96, 
+0x2e, 0xc2, 0x17, 0x6e, 0x46, 0x37, 0x77, 0x5a, 0x3b, 0xf6, 0x30, 0x49, 0x3b, 0xb4, 0x73, 0xb4, 
+0x46, 0xb3, 0xb5, 0xea, 0xe1, 0xf2, 0xb2, 0x06, 0x8c, 0x85, 0xf7, 0xab, 0xbd, 0x69, 0x7d, 0xba, 
+0x3b, 0x2d, 0x58, 0xf7, 0xd0, 0x43, 0x6d, 0x4d, 0x9d, 0x8f, 0x5e, 0xda, 0x39, 0x97, 0xd8, 0x89, 
+0x91, 0xd8, 0x49, 0x19, 0xb1, 0x93, 0xad, 0x33, 0x7b, 0xd2, 0x22, 0x37, 0x66, 0xed, 0x8a, 0xf2, 
+0x00, 0x5a, 0x0c, 0x0f, 0xa4, 0x45, 0xec, 0x5e, 0xb4, 0x4c, 0x1e, 0x44, 0x0b, 0xdb, 0xc1, 0xb4, 
+0x36, 0x1e, 0xa2, 0x97, 0xae, 0xae, 0x34, 0x86, 0x1a, 0xa0, 0xaa, 0x32, 0x71, 0x8c, 0xf9, 0x7d, 
+0xe9, 0xd4, 0x30, 0x5a, 0xd1, 0x46, 0x1b, 0xdf, 0xe5, 0x31, 0xaf, 0xd1, 0xc6, 0xc3, 0x69, 0xed, 
+0x3c, 0x82, 0x56, 0xb9, 0x23, 0x69, 0xc5, 0xbc, 0x0f, 0xad, 0x68, 0xf7, 0xa5, 0x85, 0xf6, 0x28, 
+0xbd, 0xb4, 0x77, 0xa1, 0xb1, 0xdd, 0xf8, 0x79, 0xc9, 0x11, 0x59, 0x54, 0x9d, 0x1b, 0xfb, 0x8c, 
+0x60, 0xc9, 0x35, 0x1b, 0xc1, 0xb2, 0x49, 0x17, 0x9b, 0x44, 0xd5, 0xf9, 0xe0, 0xbc, 0x37, 0x84, 
+0xcf, 0x25, 0xf1, 0x53, 0x14, 0xe7, 0x3b, 0xf2, 0x60, 0xd3, 0x9b, 0x3c, 0x59, 0x80, 0x86, 0xc7, 
+0x20, 0x79, 0x7a, 0xc3, 0xf0, 0xf8, 0x05, 0x9f, 0xf1, 0xf0, 0x82, 0x6f, 0x1b, 0x7e, 0x5b, 0x82, 
+0x6f, 0x5b, 0xe4, 0x99, 0xd6, 0xcf, 0x64, 0xc9, 0xd3, 0xae, 0x87, 0xd2, 0x94, 0x69, 0xee, 0x49, 
+0xdb, 0xea, 0xa6, 0x99, 0xd6, 0xb4, 0x35, 0x5e, 0x3a, 0x01, 0x72, 0xbc, 0xf9, 0x94, 0xad, 0x87, 
+0x5e, 0x9a, 0xb9, 0xc8, 0x88, 0x02, 0xce, 0x8e, 0x33, 0xb2, 0xb7, 0x4d, 0x3b, 0xb6, 0xa3, 0xe8, 
+0x36, 0x6e, 0x40, 0xd1, 0x55, 0x54, 0x1a, 0x51, 0x54, 0x73, 0xb2, 0xe4, 0x81, 0x88, 0x68, 0x6f, 
+0x85, 0x0f, 0xe3, 0x7a, 0xd2, 0xb6, 0x59, 0x46, 0xfb, 0x5c, 0x6f, 0xe7, 0x5c, 0xa5, 0x05, 0x48, 
+0xb7, 0xd7, 0xd3, 0x00, 0x7f, 0x58, 0xdb, 0x92, 0x05, 0x6c, 0x99, 0x11, 0x40, 0xea, 0x6b, 0xd5, 
+0x02, 0x6e, 0xae, 0xb1, 0x58, 0x40, 0x56, 0x0b, 0x16, 0x50, 0x5f, 0xd7, 0xb2, 0x05, 0x30, 0x62, 
+0xe8, 0xef, 0x68, 0xac, 0xd8, 0x76, 0x6f, 0x7f, 0xd5, 0xe5, 0xfb, 0x59, 0xe5, 0xb3, 0x7e, 0x5c, 
+0x54, 0xb9, 0xac, 0x1a, 0x67, 0x09, 0x1d, 0xf4, 0x49, 0x6a, 0x5b, 0xf5, 0x49, 0x36, 0xeb, 0x68, 
+0xc5, 0x40, 0xa6, 0xc1, 0xa1, 0x3f, 0x3b, 0x48, 0xf9, 0x6d, 0xf2, 0x8b, 0xb3, 0xc2, 0xab, 0x2a, 
+0xe2, 0x15, 0x71, 0xc2, 0xeb, 0x32, 0xb1, 0x7c, 0x9d, 0xf1, 0x8b, 0x7a, 0x91, 0xf3, 0x8b, 0x5f, 
+0xc8, 0xfc, 0x22, 0x41, 0xe6, 0x17, 0x13, 0x64, 0x7e, 0x71, 0x58, 0xcd, 0x79, 0xc5, 0x70, 0x99, 
+0x5f, 0xc4, 0x76, 0xfa, 0x65, 0xc7, 0xf8, 0x45, 0xfb, 0xa8, 0x45, 0xcb, 0xa4, 0x54, 0x8f, 0xf4, 
+0x60, 0x2a, 0x63, 0x0d, 0x19, 0x9c, 0x35, 0xc4, 0x38, 0x19, 0x8d, 0x63, 0xc0, 0x27, 0x84, 0xfa, 
+0x44, 0x78, 0x21, 0x54, 0x8f, 0xa4, 0x21, 0x9c, 0xcd, 0x62, 0xcb, 0xb4, 0x8c, 0x8e, 0x84, 0x53, 
+0x5b, 0x8d, 0x93, 0xe3, 0xf1, 0x86, 0x2a, 0xf9, 0x85, 0x98, 0x92, 0x26, 0x74, 0x0e, 0x7f, 0x67, 
+0x98, 0x4c, 0x13, 0x54, 0xb0, 0xa1, 0xba, 0xca, 0xbc, 0x88, 0xfd, 0x77, 0xc3, 0x13, 0x18, 0x9e, 
+0xdd, 0x16, 0xb6, 0xc0, 0x79, 0x82, 0x0e, 0x79, 0x02, 0xfa, 0xcf, 0x7b, 0x31, 0xe8, 0x26, 0x1f, 
+0x0d, 0xb7, 0xd0, 0x03, 0x9c, 0x41, 0x4f, 0x79, 0xfb, 0xef, 0x8b, 0x23, 0x74, 0x24, 0x49, 0x35, 
+0xb8, 0xb1, 0xb7, 0xd3, 0x72, 0x84, 0xa2, 0xf7, 0xdf, 0x36, 0x13, 0x93, 0x0e, 0x13, 0x93, 0x0f, 
+0x85, 0xaa, 0x0e, 0xa4, 0x25, 0x7a, 0x9f, 0x1e, 0x4a, 0x31, 0xc8, 0x42, 0x06, 0xf8, 0x12, 0xb0, 
+0x5e, 0xda, 0x31, 0xc7, 0x18, 0xae, 0x97, 0xae, 0xac, 0x30, 0xa2, 0xd5, 0x5e, 0x5b, 0xe5, 0xd1, 
+0x62, 0x2c, 0x1a, 0xad, 0xc7, 0xa4, 0xe6, 0xd1, 0x1e, 0xb0, 0x96, 0x94, 0xd4, 0xe0, 0x23, 0xa0, 
+0x2b, 0x85, 0x52, 0x23, 0x3f, 0x97, 0xb5, 0xe1, 0xac, 0x8d, 0x60, 0x8b, 0x1e, 0x4d, 0xd2, 0xff, 
+0x68, 0xa2, 0xe6, 0x1e, 0x0f, 0x25, 0x5a, 0x1d, 0x8a, 0xf6, 0x29, 0x48, 0x36, 0xe3, 0x49, 0x49, 
+0xb6, 0xbd, 0x32, 0xcd, 0xb4, 0x21, 0xd3, 0x76, 0x67, 0x79, 0x5b, 0x09, 0x5d, 0x07, 0x33, 0x17, 
+0xa1, 0xf8, 0xb2, 0xe3, 0xac, 0xd2, 0x39, 0x95, 0x81, 0xb7, 0x30, 0xba, 0xd1, 0xb6, 0x93, 0xfc, 
+0xa3, 0xf5, 0x1d, 0xab, 0x94, 0x4e, 0x35, 0x1e, 0x3e, 0x54, 0x17, 0xd2, 0x81, 0x84, 0xde, 0x4c, 
+0xc3, 0x59, 0x4d, 0x34, 0x5c, 0x5f, 0x67, 0x87, 0x86, 0x6f, 0xae, 0xf1, 0x68, 0x3b, 0x9b, 0x3f, 
+0x3e, 0x87, 0x9a, 0x26, 0x2b, 0xbf, 0x74, 0xa2, 0x44, 0xcb, 0x04, 0x09, 0xda, 0x3f, 0x09, 0x23, 
+0x12, 0xba, 0xaa, 0x6c, 0x55, 0xc4, 0xcf, 0x64, 0x6d, 0x88, 0xb8, 0x47, 0xe0, 0x7d, 0x29, 0xfb, 
+0xf9, 0x5d, 0x71, 0xb9, 0x8a, 0xf7, 0x7f, 0x96, 0x77, 0x74, 0x7c, 0x2a, 0xf2, 0x7e, 0xb3, 0x5c, 
+0x31, 0xcf, 0x5f, 0x23, 0xbf, 0x21, 0xce, 0x17, 0xf9, 0xba, 0xd2, 0x11, 0xab, 0xd7, 0xc8, 0xb9, 
+0xc2, 0x77, 0x56, 0x79, 0xfb, 0xd1, 0xef, 0xec, 0xe0, 0x2f, 0xf1, 0x94, 0x95, 0x77, 0x98, 0xef, 
+0x07, 0x1a, 0x2d, 0xa5, 0x77, 0x4f, 0xb7, 0xea, 0x8e, 0x5e, 0x43, 0x3c, 0x4c, 0x41, 0x63, 0xe3, 
+0x5e, 0x8e, 0x86, 0x17, 0xd9, 0x3f, 0x35, 0xd9, 0x0a, 0x29, 0x6d, 0xb5, 0x68, 0x03, 0x29, 0xc5, 
+0xc3, 0x27, 0x06, 0x74, 0xca, 0xc3, 0x55, 0x6e, 0x72, 0x88, 0x53, 0x2d, 0x10, 0xef, 0xda, 0x50, 
+0xe6, 0xe1, 0xfc, 0x6e, 0xb4, 0xcd, 0xc4, 0x95, 0x96, 0x51, 0xdd, 0x68, 0x13, 0x8a, 0x3b, 0xdb, 
+0x9c, 0xe3, 0x41, 0x9b, 0x49, 0x3c, 0x69, 0x6f, 0x89, 0x17, 0xed, 0x51, 0xf1, 0xa6, 0x3d, 0x2a, 
+0xe6, 0x4d, 0x29, 0xb9, 0x07, 0x7d, 0x68, 0xff, 0x88, 0x2f, 0x6d, 0x1d, 0x41, 0x8c, 0xf7, 0xca, 
+0x35, 0xb4, 0xe9, 0x84, 0x30, 0x6e, 0xa2, 0x75, 0xf0, 0xf3, 0xb4, 0x0e, 0x7e, 0x29, 0x90, 0x76, 
+0xa8, 0xf4, 0xa2, 0x15, 0xc9, 0x20, 0xda, 0xd0, 0x12, 0x4c, 0x7b, 0x55, 0x42, 0x68, 0xc7, 0x09, 
+0x46, 0x81, 0x99, 0xb3, 0x38, 0xbe, 0x74, 0x8e, 0xef, 0x2b, 0xb8, 0xa0, 0xbd, 0x08, 0xc4, 0xe4, 
+0x1f, 0x44, 0xd0, 0x0e, 0x98, 0x48, 0xda, 0xbe, 0xd2, 0x87, 0xf6, 0xc7, 0xf4, 0xa5, 0x7d, 0x2d, 
+0x51, 0xb4, 0xf9, 0xa5, 0x1f, 0x6d, 0x47, 0xe9, 0x4f, 0x1b, 0x58, 0x9a, 0xa9, 0xb2, 0x98, 0xe3, 
+0xcc, 0x50, 0xe2, 0xb4, 0x2e, 0x17, 0xb5, 0x09, 0x93, 0x36, 0xe1, 0x3c, 0x11, 0x94, 0x99, 0x1d, 
+0x47, 0xc9, 0x91, 0x7d, 0x0e, 0x51, 0x3f, 0x48, 0xd2, 0x97, 0x14, 0x6b, 0x6c, 0xee, 0x12, 0x5b, 
+0x28, 0xc7, 0x9a, 0x12, 0x39, 0xd6, 0x9c, 0x93, 0x63, 0xcd, 0x39, 0x39, 0xd6, 0x5c, 0x94, 0x63, 
+0xcd, 0x39, 0x39, 0xd6, 0x94, 0xc9, 0xb1, 0xe6, 0xbc, 0x1c, 0x6b, 0xae, 0xc9, 0xb1, 0xa6, 0xa4, 
+0x49, 0xac, 0x69, 0xe7, 0x6e, 0x32, 0xeb, 0xb2, 0x52, 0xca, 0x74, 0xbd, 0xfd, 0x9c, 0x45, 0x9a, 
+0x7c, 0x3c, 0xdf, 0x62, 0x79, 0xa9, 0x1c, 0x75, 0xfe, 0xdf, 0x56, 0x99, 0x5a, 0x95, 0x3a, 0x4e, 
+0x7e, 0xf4, 0x72, 0x78, 0xec, 0xe1, 0x4a, 0x21, 0x86, 0x87, 0xa8, 0xf8, 0x6c, 0x7c, 0x41, 0x87, 
+0x02, 0xb8, 0xfb, 0x10, 0x02, 0x78, 0xf2, 0xc1, 0x4c, 0x81, 0x3f, 0x9d, 0xe3, 0x6f, 0xa7, 0x9f, 
+0x53, 0x9c, 0x00, 0xab, 0xed, 0x85, 0x19, 0x8f, 0x5e, 0x0a, 0x8f, 0x39, 0xd6, 0x29, 0x84, 0x90, 
+0xd9, 0x71, 0x21, 0xc8, 0xf0, 0x3f, 0x87, 0x2f, 0x7f, 0x72, 0x20, 0x7a, 0xf5, 0x26, 0xd1, 0xab, 
+0x37, 0x9f, 0xb3, 0x19, 0xf2, 0xb6, 0xca, 0x15, 0xf0, 0xe7, 0x04, 0xde, 0xdf, 0x64, 0x3f, 0x0f, 
+0x4a, 0xfb, 0x6f, 0x15, 0xef, 0xaf, 0xb1, 0xfb, 0x83, 0xd3, 0xfe, 0x2a, 0xf2, 0xfe, 0x26, 0xbb, 
+0x3f, 0x24, 0xad, 0x44, 0xe2, 0xfd, 0x0d, 0x76, 0x7f, 0x68, 0x5a, 0x91, 0x9a, 0xf7, 0x17, 0xd9, 
+0xfd, 0x61, 0x69, 0x47, 0x3a, 0xf1, 0xfe, 0xbf, 0xd8, 0x7d, 0x5d, 0xda, 0xbf, 0x3b, 0xf0, 0xfe, 
+0x4c, 0xa7, 0x8e, 0x6f, 0x23, 0xe9, 0x4a, 0xa1, 0x70, 0xcc, 0xd4, 0x1e, 0xbc, 0xf3, 0xa1, 0x2e, 
+0x31, 0xa3, 0x5d, 0x3b, 0x49, 0x54, 0xaa, 0x9f, 0x60, 0x30, 0xf7, 0x6f, 0x03, 0xfa, 0xf7, 0xfd, 
+0x6a, 0x57, 0x03, 0x7a, 0x78, 0x5e, 0xae, 0x9b, 0x01, 0x7d, 0xbc, 0xa4, 0x58, 0x8e, 0x76, 0x06, 
+0x74, 0xf3, 0xfa, 0x3a, 0x9b, 0x8e, 0x6e, 0x40, 0x47, 0x2f, 0xc8, 0xb7, 0xe9, 0xea, 0x06, 0x74, 
+0xf5, 0xd2, 0xd3, 0x56, 0xce, 0x6e, 0x40, 0x67, 0xaf, 0xaa, 0x54, 0xb8, 0xbb, 0x01, 0xdd, 0xbd, 
+0xb6, 0x26, 0xc4, 0x80, 0x0e, 0x5f, 0x51, 0xfe, 0x88, 0x36, 0x97, 0x34, 0x89, 0x7c, 0xad, 0xd0, 
+0x30, 0x03, 0xe2, 0x3e, 0x59, 0xc2, 0x90, 0x1f, 0xcc, 0x65, 0xc8, 0xef, 0x57, 0x33, 0xe4, 0x67, 
+0x4a, 0xdd, 0x0d, 0x88, 0xbc, 0xbe, 0x8e, 0x41, 0x3f, 0x7d, 0xca, 0xd3, 0x80, 0xd0, 0xcf, 0x9d, 
+0xf5, 0x32, 0x20, 0xf8, 0xbc, 0x43, 0x4d, 0xe0, 0xe7, 0x1f, 0x6e, 0x23, 0xd2, 0x7d, 0xc3, 0xc0, 
+0xd7, 0x06, 0xd4, 0x70, 0x01, 0x54, 0x94, 0xf7, 0x32, 0xa0, 0x00, 0xaa, 0x2a, 0xed, 0xde, 0xff, 
+0x61, 0x40, 0xf8, 0x47, 0x0a, 0x14, 0x02, 0x30, 0xa0, 0x00, 0x4e, 0x14, 0xdb, 0xbd, 0x07, 0xa4, 
+0x2d, 0x26, 0x4a, 0x02, 0x38, 0x7d, 0x4a, 0xa9, 0xfa, 0x23, 0x87, 0x99, 0x00, 0xee, 0x57, 0x9b, 
+0x75, 0x4f, 0x02, 0x38, 0x74, 0x50, 0xa1, 0x7d, 0x03, 0xc2, 0x3f, 0x53, 0xda, 0x96, 0xfe, 0x2b, 
+0xca, 0xdb, 0xd6, 0xff, 0xc9, 0x12, 0xa6, 0xff, 0x13, 0xc5, 0xd6, 0x02, 0x48, 0x6f, 0xaa, 0x7f, 
+0x03, 0xc2, 0x3f, 0x77, 0xb6, 0xdd, 0x16, 0x90, 0xd1, 0xb2, 0xf9, 0x2b, 0x12, 0x9b, 0xac, 0x7c, 
+0x45, 0x8a, 0x27, 0xe0, 0xa5, 0xa7, 0x9b, 0x1a, 0x3d, 0xc1, 0x2e, 0xc8, 0x6f, 0x9a, 0xdf, 0x0c, 
+0x08, 0xba, 0xbe, 0xae, 0x7d, 0xb0, 0xf3, 0x72, 0x6d, 0x68, 0x3d, 0xb3, 0x89, 0xd6, 0x4b, 0x8a, 
+0x9b, 0x68, 0xbd, 0xb6, 0xc6, 0x4e, 0xd8, 0x9f, 0xb7, 0x02, 0x9b, 0xec, 0xfe, 0xc2, 0x79, 0x2b, 
+0xe0, 0xa4, 0xf4, 0xd2, 0xd3, 0x0a, 0xe8, 0x25, 0xc5, 0xed, 0x4b, 0xec, 0xf6, 0xc2, 0xae, 0xaf, 
+0x63, 0xda, 0x2e, 0xc8, 0xb7, 0x06, 0x9e, 0xc5, 0x81, 0x1b, 0x10, 0x78, 0x5e, 0x2e, 0x83, 0x5e, 
+0x5b, 0xd3, 0x31, 0x8f, 0x9f, 0x66, 0xdf, 0xc4, 0x4b, 0xa9, 0x70, 0x32, 0xf5, 0xf3, 0x7f, 0x63, 
+0xb0, 0xff, 0xe7, 0x82, 0x3d, 0xb0, 0xdb, 0xab, 0x6f, 0xe6, 0xe3, 0x32, 0xec, 0x6f, 0x18, 0xec, 
+0xbc, 0xd0, 0xdc, 0x50, 0x19, 0xfa, 0x74, 0x0b, 0xf4, 0xd2, 0xd3, 0x4d, 0x43, 0x9d, 0x6d, 0x9d, 
+0x1b, 0x10, 0x7a, 0x49, 0xb1, 0x0d, 0xf0, 0x33, 0xec, 0x32, 0xf6, 0xa6, 0x6c, 0x96, 0x80, 0xe7, 
+0xe5, 0x3e, 0x24, 0x91, 0x6b, 0x15, 0xb4, 0x95, 0xae, 0x67, 0xb6, 0x1c, 0xd9, 0x09, 0x6e, 0x49, 
+0x9b, 0x81, 0x8d, 0xad, 0x72, 0xdd, 0xaf, 0x66, 0x0b, 0x5c, 0x55, 0x95, 0xbe, 0xd4, 0x55, 0x94, 
+0xcb, 0x3b, 0xa4, 0x58, 0xf1, 0x20, 0xca, 0x91, 0xba, 0x0b, 0xe7, 0xd9, 0xb6, 0xa8, 0xda, 0x1a, 
+0x59, 0x3a, 0xb3, 0x60, 0xe9, 0xc5, 0xce, 0x34, 0xdd, 0x69, 0x23, 0xf7, 0xdf, 0x96, 0x73, 0x7f, 
+0x99, 0x9c, 0xfb, 0xdd, 0x44, 0xde, 0x3f, 0x90, 0x73, 0x7f, 0xb4, 0xc4, 0x7b, 0x7f, 0x91, 0xe7, 
+0xfc, 0x78, 0x35, 0xef, 0x63, 0x24, 0x9e, 0xf3, 0x7f, 0xd7, 0x89, 0xf7, 0x49, 0x6a, 0x9e, 0xf3, 
+0x17, 0x38, 0xf0, 0x7e, 0x4a, 0x27, 0x9e, 0xf3, 0xd7, 0x76, 0xe6, 0xfd, 0x1a, 0x87, 0x67, 0x78, 
+0x77, 0xdd, 0x33, 0xc0, 0x07, 0x94, 0xbb, 0xbe, 0x1e, 0xdf, 0x54, 0x48, 0x85, 0xa2, 0x69, 0xb0, 
+0x5b, 0x36, 0xcf, 0x18, 0x67, 0x68, 0x61, 0x96, 0xd4, 0x1e, 0xc6, 0x60, 0x7b, 0x6f, 0xdc, 0xc3, 
+0x49, 0xe9, 0x99, 0xa2, 0x15, 0xcd, 0x67, 0x52, 0xed, 0x24, 0x15, 0xb6, 0x24, 0x94, 0xf1, 0xa8, 
+0xa6, 0xd4, 0x4f, 0x8f, 0x79, 0x34, 0x9f, 0x5c, 0xb5, 0x9b, 0x77, 0xd8, 0x92, 0xcc, 0xe7, 0x0f, 
+0x27, 0x99, 0x67, 0x83, 0x9c, 0x28, 0x64, 0x93, 0xc5, 0x65, 0xd3, 0x6e, 0x6a, 0x62, 0x4b, 0x36, 
+0xd3, 0x1e, 0x85, 0x5f, 0x3d, 0x5d, 0xfe, 0xa2, 0x90, 0xcc, 0x74, 0x8b, 0x64, 0xda, 0xc9, 0x5c, 
+0xbe, 0x61, 0xb2, 0xc9, 0x8b, 0xce, 0x8d, 0x6e, 0xca, 0x5f, 0x1e, 0xd3, 0x82, 0xdd, 0xe3, 0xa7, 
+0x38, 0x0a, 0xb9, 0xcc, 0x6c, 0x39, 0x57, 0xb5, 0x42, 0x70, 0xac, 0xec, 0xa5, 0xe3, 0x14, 0xe7, 
+0xd5, 0xd7, 0x44, 0x47, 0x80, 0x51, 0x23, 0xb4, 0xff, 0x86, 0x8d, 0x5a, 0xb2, 0x55, 0x5a, 0x3c, 
+0x96, 0xb5, 0x6f, 0x89, 0x5f, 0x0a, 0xb4, 0xf7, 0x30, 0x41, 0x1c, 0xa7, 0x3a, 0xc4, 0x2a, 0x42, 
+0x00, 0x62, 0x58, 0x45, 0xc8, 0x60, 0x21, 0x46, 0xb0, 0xf0, 0x92, 0xc6, 0xc3, 0x94, 0x9a, 0x1e, 
+0xa2, 0xc4, 0x98, 0x06, 0x15, 0x1e, 0x07, 0xaf, 0x93, 0x44, 0x11, 0x0a, 0x03, 0x7c, 0x89, 0x6f, 
+0x87, 0x05, 0xb2, 0xc2, 0xde, 0x3d, 0x6d, 0xd5, 0x1f, 0x8b, 0xd0, 0x7b, 0x28, 0xd5, 0x1f, 0x43, 
+0xf8, 0x3b, 0xe9, 0xe6, 0xfa, 0x63, 0xaa, 0x1c, 0x2d, 0x65, 0x95, 0xa3, 0x95, 0xb6, 0x2a, 0x3e, 
+0xba, 0xd3, 0x6f, 0xd6, 0xf5, 0x50, 0x39, 0x18, 0x8d, 0x47, 0x7d, 0xf4, 0xd2, 0xb4, 0x35, 0x45, 
+0xbe, 0x31, 0x9d, 0x93, 0x75, 0x4b, 0x60, 0xa9, 0x1f, 0xfd, 0xa6, 0x2c, 0x98, 0x7e, 0x73, 0x2c, 
+0x84, 0x1f, 0x1d, 0x04, 0xf2, 0x59, 0x22, 0xc8, 0x22, 0xfc, 0xa7, 0x0f, 0x0a, 0x53, 0x49, 0xda, 
+0x81, 0xc7, 0x59, 0x15, 0xc8, 0x7e, 0x56, 0x05, 0x72, 0x80, 0xd7, 0x7f, 0xe8, 0x61, 0xf9, 0xea, 
+0x41, 0xfd, 0xf5, 0x30, 0x27, 0x6b, 0x48, 0x34, 0x6d, 0x64, 0x54, 0x16, 0x28, 0xbb, 0xea, 0xd9, 
+0x1b, 0xab, 0x96, 0xaa, 0x3d, 0x5a, 0xae, 0xd8, 0x68, 0x5a, 0x2f, 0xd2, 0x5a, 0xdd, 0x47, 0x4b, 
+0xb5, 0x22, 0xe0, 0x15, 0xd3, 0x25, 0x1b, 0x26, 0x40, 0x0e, 0xda, 0xa7, 0xf9, 0x9d, 0x2d, 0x01, 
+0xcb, 0x69, 0x04, 0x06, 0x49, 0xce, 0x34, 0xb0, 0xec, 0x85, 0xca, 0xa1, 0xe5, 0x98, 0x07, 0xf7, 
+0x0b, 0x1a, 0x5c, 0xf6, 0x02, 0x79, 0x78, 0xb7, 0xf9, 0xf0, 0x72, 0x5a, 0x1d, 0x60, 0xf6, 0x26, 
+0x3e, 0x44, 0x3e, 0xc0, 0x1c, 0x36, 0x44, 0x1c, 0xa0, 0x33, 0x0d, 0x30, 0xfb, 0xd6, 0x84, 0x5b, 
+0x96, 0x21, 0xe6, 0x98, 0x07, 0xc9, 0x45, 0xc4, 0x34, 0xe6, 0xee, 0x19, 0xe3, 0x04, 0x70, 0x1b, 
+0x6e, 0xe1, 0xc0, 0x4b, 0x1b, 0x07, 0xee, 0x1b, 0xe3, 0x47, 0x32, 0x34, 0xb2, 0x22, 0x13, 0x74, 
+0xa6, 0xf7, 0x5f, 0x0a, 0xd0, 0xc1, 0x07, 0x2f, 0x07, 0xea, 0xe0, 0xc3, 0x57, 0x78, 0xa5, 0x89, 
+0x35, 0x28, 0x56, 0xd4, 0x0b, 0x49, 0x5e, 0xc9, 0x33, 0xc6, 0xcf, 0x4e, 0x99, 0xfb, 0xfe, 0xda, 
+0x0f, 0x76, 0x95, 0x22, 0xbe, 0x0f, 0x37, 0xa6, 0x2e, 0xfb, 0xf8, 0x08, 0x61, 0x34, 0x2c, 0x8e, 
+0x3d, 0xf9, 0xd2, 0xfa, 0x97, 0x77, 0x12, 0xd2, 0x57, 0xf6, 0xc6, 0x5f, 0x1a, 0x59, 0xc0, 0xd0, 
+0x3a, 0x13, 0xda, 0x52, 0x19, 0x6d, 0x13, 0xac, 0xe2, 0xc4, 0xad, 0xaf, 0x6d, 0x33, 0x63, 0x2c, 
+0x6d, 0x05, 0x63, 0x69, 0xb6, 0x52, 0x0d, 0x8d, 0x18, 0x5f, 0x77, 0x52, 0x4b, 0x79, 0x42, 0x5b, 
+0xbe, 0x74, 0x4b, 0x45, 0x42, 0x48, 0x10, 0x4d, 0xe2, 0x64, 0x89, 0x7c, 0x28, 0x45, 0x95, 0x26, 
+0xfb, 0x54, 0x9a, 0xca, 0x0e, 0x5f, 0x92, 0x50, 0x76, 0xf5, 0xb0, 0x4f, 0xde, 0xb5, 0x2b, 0x31, 
+0x6f, 0x7a, 0xa0, 0xa6, 0xbb, 0x7b, 0xa9, 0x16, 0x9b, 0x39, 0x14, 0xed, 0xdc, 0xad, 0x20, 0x8f, 
+0x0a, 0xb6, 0xed, 0x51, 0x12, 0x44, 0xa2, 0x47, 0xed, 0x34, 0xbb, 0x14, 0x3f, 0x0b, 0x6c, 0x98, 
+0x7c, 0x5e, 0x50, 0x37, 0x7e, 0xb6, 0x18, 0xc8, 0x27, 0x10, 0xb9, 0xba, 0x00, 0xb8, 0x71, 0x47, 
+0xa9, 0x44, 0xd1, 0xef, 0x42, 0xd1, 0xbb, 0xf3, 0x23, 0xbe, 0x40, 0x3e, 0x06, 0xc8, 0x83, 0x9f, 
+0xe9, 0x95, 0x2f, 0x9f, 0xfb, 0xe3, 0xc9, 0xcf, 0x03, 0x03, 0xf9, 0xcc, 0x20, 0x2f, 0x7e, 0x72, 
+0x19, 0xc8, 0xe7, 0x1b, 0x79, 0xf3, 0xf3, 0xc8, 0xd6, 0x06, 0x74, 0x0e, 0x58, 0x1f, 0x00, 0x01, 
+0xb2, 0xa3, 0x9a, 0x24, 0x3a, 0x79, 0xeb, 0xa8, 0x7c, 0xf6, 0x96, 0x8f, 0x49, 0xa2, 0xe3, 0xc7, 
+0x8a, 0xe4, 0x23, 0x8a, 0x7c, 0xf9, 0x41, 0x69, 0x4b, 0x3c, 0x3d, 0x3c, 0x97, 0x7a, 0x82, 0xa7, 
+0x1f, 0x1f, 0x4c, 0x19, 0x0e, 0xa6, 0x0a, 0x07, 0xa3, 0xe1, 0x07, 0x35, 0x95, 0xca, 0xc7, 0x29, 
+0xc9, 0x67, 0x95, 0x81, 0xaf, 0xe0, 0xbb, 0x9d, 0x4e, 0x33, 0xd2, 0xc1, 0xb4, 0x35, 0x01, 0xfc, 
+0x4c, 0x30, 0x90, 0x0f, 0x09, 0x0a, 0xe4, 0x27, 0xad, 0x81, 0x7c, 0x1e, 0x53, 0x2f, 0x7e, 0x9e, 
+0x18, 0xc8, 0x07, 0x0c, 0x05, 0x9b, 0x24, 0xaa, 0x1d, 0x3f, 0x26, 0x1f, 0x97, 0xc4, 0xf6, 0x32, 
+0xd3, 0x7e, 0x8f, 0xdd, 0x61, 0x26, 0x89, 0x8e, 0x12, 0x3b, 0x2e, 0x9f, 0x2d, 0xa4, 0xe5, 0x87, 
+0xbb, 0xed, 0x0f, 0xec, 0x12, 0x38, 0x28, 0x10, 0x02, 0xc3, 0x63, 0x3a, 0x2f, 0x5f, 0x7d, 0x00, 
+0x86, 0x44, 0xf0, 0x13, 0xcd, 0x0e, 0x47, 0x7a, 0x46, 0xe6, 0x45, 0x42, 0x64, 0x24, 0x3f, 0xf3, 
+0x6d, 0x90, 0x7c, 0x32, 0x54, 0x1f, 0x16, 0x3f, 0xfa, 0xf2, 0x2a, 0xf7, 0x74, 0xf9, 0x18, 0xa7, 
+0x28, 0x7e, 0xbe, 0xd9, 0x55, 0x3f, 0x37, 0xbf, 0x1d, 0x7e, 0xe0, 0xd7, 0x8f, 0x9f, 0x51, 0xb6, 
+0x41, 0x3e, 0xb4, 0x88, 0x95, 0x9c, 0x55, 0x47, 0xd3, 0x0e, 0xea, 0x70, 0x16, 0x72, 0x44, 0x0a, 
+0x39, 0xcf, 0x83, 0xc6, 0x24, 0x11, 0x6e, 0xa3, 0xf9, 0x18, 0xa9, 0xa7, 0x14, 0x7c, 0x5c, 0xc9, 
+0x77, 0xd1, 0x3e, 0xb2, 0x15, 0xf6, 0xe1, 0xc7, 0x3d, 0xd5, 0xac, 0xa1, 0x9e, 0x26, 0x17, 0xb3, 
+0x4a, 0x8c, 0xd8, 0x86, 0x50, 0x84, 0x8a, 0x32, 0xb9, 0x98, 0x31, 0x1b, 0x2d, 0x98, 0xaf, 0x9b, 
+0x0f, 0x6a, 0x7a, 0x06, 0x02, 0x96, 0x4a, 0xe2, 0xf1, 0x88, 0xbf, 0xe5, 0x75, 0xe0, 0xe5, 0x1b, 
+0x3c, 0x75, 0x1a, 0x65, 0xd0, 0xee, 0xa5, 0x08, 0xda, 0x88, 0x28, 0x8d, 0x88, 0xd2, 0xc3, 0x24, 
+0x91, 0x17, 0x18, 0x65, 0x2f, 0xf0, 0x36, 0xb9, 0x93, 0x9d, 0x1b, 0xd1, 0xce, 0x8d, 0x68, 0xe7, 
+0xb2, 0x0d, 0xdf, 0x46, 0x1b, 0xbe, 0x65, 0xb6, 0xe1, 0x1c, 0x85, 0x0d, 0x5b, 0xe9, 0xb2, 0xb9, 
+0xc0, 0xf6, 0xe5, 0x85, 0xf2, 0x8a, 0x10, 0x93, 0x3b, 0x59, 0x97, 0x11, 0xad, 0xcb, 0x88, 0xd6, 
+0xd5, 0x44, 0x8a, 0xcf, 0x56, 0x34, 0x8c, 0xfc, 0x56, 0x85, 0x41, 0x6c, 0xd4, 0xa8, 0xd6, 0xce, 
+0x13, 0x1a, 0x9c, 0xf6, 0x3b, 0x79, 0xa5, 0x64, 0x01, 0xfb, 0x59, 0x9f, 0x36, 0x5c, 0x45, 0x65, 
+0x28, 0xfa, 0xb4, 0x29, 0x76, 0x1c, 0x9a, 0xd5, 0x6c, 0xad, 0x63, 0x0c, 0x5b, 0xeb, 0x48, 0x64, 
+0x1b, 0x14, 0xa7, 0xb2, 0xad, 0xc0, 0x19, 0xcd, 0x5f, 0x6f, 0xd8, 0x5c, 0xed, 0xa2, 0x42, 0xef, 
+0xb6, 0xdf, 0xde, 0x1a, 0xe0, 0x44, 0xb1, 0x15, 0x19, 0x34, 0x40, 0x5e, 0x6e, 0xfb, 0x5f, 0x5d, 
+0x1a, 0x90, 0x9a, 0x99, 0xa7, 0xe5, 0xdf, 0x40, 0x41, 0x68, 0x7e, 0xa8, 0xd5, 0xdb, 0x0c, 0x62, 
+0x42, 0xe9, 0x6d, 0xac, 0x5f, 0xd0, 0x91, 0x3f, 0xf6, 0xbd, 0xd0, 0xb0, 0x7f, 0x71, 0xef, 0x09, 
+0x9e, 0x58, 0x65, 0x0f, 0x44, 0x5b, 0xab, 0x7a, 0x0e, 0xf4, 0xe6, 0xea, 0x48, 0x01, 0xa3, 0x7f, 
+0x0d, 0x6c, 0x4f, 0xf1, 0xfd, 0x6a, 0xda, 0x53, 0x7c, 0x38, 0x3f, 0x8e, 0x9d, 0x89, 0x44, 0x04, 
+0x18, 0x92, 0x75, 0x8d, 0x04, 0x58, 0x3e, 0x05, 0x29, 0x04, 0x84, 0x42, 0x99, 0xfd, 0x5a, 0x9f, 
+0x7b, 0x34, 0x95, 0x15, 0x67, 0x07, 0x3b, 0x27, 0x9f, 0x48, 0x39, 0x99, 0x7f, 0x7a, 0xc2, 0xe9, 
+0xd4, 0x33, 0x69, 0xe7, 0x74, 0xc5, 0xb1, 0x25, 0x71, 0xa7, 0x0e, 0x9f, 0x8a, 0x2f, 0x4d, 0x38, 
+0xab, 0x09, 0x06, 0x2f, 0x6f, 0x3a, 0x16, 0xab, 0x75, 0x33, 0xd6, 0xa7, 0xcd, 0x17, 0xa8, 0xc2, 
+0x41, 0x2f, 0x1f, 0x8b, 0x35, 0x38, 0x4d, 0x92, 0x5f, 0xfa, 0x35, 0x08, 0xff, 0x38, 0x16, 0xeb, 
+0x51, 0x17, 0x2c, 0x3c, 0x6a, 0x23, 0x98, 0xdc, 0xb6, 0x11, 0x3c, 0x8a, 0x45, 0xd2, 0xa7, 0x14, 
+0x60, 0xda, 0x5b, 0x1d, 0xd1, 0x2c, 0xb2, 0x60, 0x84, 0x8a, 0xce, 0x8f, 0xb6, 0xb5, 0xf2, 0x77, 
+0x60, 0x12, 0x9d, 0x8a, 0xf5, 0x96, 0x41, 0x0b, 0x30, 0x72, 0x84, 0xf6, 0x53, 0xfa, 0xf4, 0x29, 
+0x7e, 0x72, 0xb2, 0xe9, 0x29, 0x33, 0xe5, 0xf3, 0x79, 0xff, 0x2a, 0x57, 0x02, 0xf9, 0x08, 0x7f, 
+0x54, 0x51, 0xe5, 0xcf, 0x0e, 0xb9, 0x12, 0xe8, 0x2e, 0xfb, 0xf9, 0x75, 0x71, 0xb2, 0xbc, 0xb9, 
+0xe0, 0x30, 0x3f, 0x3d, 0x4b, 0x8a, 0x97, 0x78, 0xbf, 0x48, 0xae, 0x10, 0x72, 0x17, 0xec, 0x3e, 
+0xd4, 0x66, 0x98, 0xb9, 0x0e, 0x11, 0xe9, 0x70, 0x12, 0x9b, 0x60, 0x06, 0xb1, 0x0d, 0x04, 0x81, 
+0xec, 0x24, 0x9b, 0x41, 0x8c, 0x0c, 0x0f, 0xb1, 0x9c, 0x98, 0xe5, 0xf1, 0x2d, 0xa3, 0x65, 0x8a, 
+0x6d, 0x36, 0xe8, 0x76, 0x30, 0x76, 0x6c, 0x62, 0xb0, 0x28, 0x25, 0x25, 0x61, 0x1e, 0x16, 0xa5, 
+0xc4, 0x0c, 0x78, 0x01, 0x25, 0x1a, 0x37, 0x3a, 0x4c, 0x05, 0xc3, 0x86, 0xa5, 0x6b, 0xbf, 0x95, 
+0xf7, 0x19, 0x12, 0x57, 0xb4, 0x3e, 0xe4, 0x06, 0x99, 0x75, 0x64, 0xf3, 0x43, 0x6e, 0x38, 0x99, 
+0xe8, 0x8a, 0x96, 0x88, 0x56, 0xf1, 0xc5, 0x12, 0xf4, 0xc0, 0xa5, 0xcb, 0x1a, 0x4f, 0xa2, 0x2e, 
+0xbb, 0xe4, 0x4e, 0x85, 0x09, 0x38, 0x0c, 0x3a, 0xe2, 0xb3, 0x71, 0x67, 0xd3, 0xb5, 0xeb, 0x5e, 
+0x54, 0xb4, 0xe0, 0x4d, 0xa5, 0x0f, 0xdd, 0xa9, 0x12, 0xa2, 0x07, 0xd5, 0x4e, 0xa0, 0x27, 0x66, 
+0x4d, 0xa3, 0x22, 0xd8, 0x4d, 0x7e, 0x54, 0xdc, 0xa0, 0xa1, 0x72, 0x88, 0x9e, 0x54, 0x3b, 0xe1, 
+0x4f, 0xe5, 0x15, 0x01, 0x54, 0x4f, 0x81, 0x56, 0xb1, 0x68, 0x71, 0x2f, 0x2a, 0xbe, 0x08, 0xa2, 
+0x8a, 0x89, 0x60, 0xaa, 0x84, 0x40, 0x9b, 0x58, 0xbe, 0xa2, 0xd1, 0x05, 0xa9, 0x7c, 0x02, 0x31, 
+0xcc, 0x65, 0x9b, 0x59, 0xe4, 0xad, 0x2c, 0x6b, 0xd6, 0x46, 0x50, 0xe5, 0x46, 0x24, 0x55, 0x5f, 
+0xf4, 0xa1, 0xf2, 0x88, 0xbe, 0x54, 0xb4, 0x11, 0x45, 0xc5, 0x13, 0xb6, 0x0f, 0xa2, 0x6e, 0x82, 
+0x46, 0x3e, 0x58, 0xfa, 0x49, 0x83, 0x99, 0xd2, 0x6e, 0x30, 0x96, 0xb3, 0x5f, 0xd4, 0x7b, 0xa7, 
+0x17, 0xac, 0xdc, 0x37, 0xe3, 0x08, 0xed, 0xb7, 0x76, 0x21, 0xef, 0xe8, 0x46, 0x85, 0xe4, 0x36, 
+0xca, 0x92, 0xbf, 0x05, 0xda, 0x74, 0xd4, 0xca, 0x9e, 0x33, 0x72, 0xe2, 0xd6, 0xca, 0x93, 0x2d, 
+0x05, 0xe8, 0xbb, 0xe6, 0x59, 0x95, 0x27, 0x5f, 0x5b, 0x45, 0x1b, 0x29, 0x36, 0x84, 0x52, 0xc4, 
+0x6b, 0x5c, 0x81, 0xa6, 0xc0, 0x89, 0x88, 0x76, 0x7a, 0xcc, 0x6d, 0xb2, 0xd7, 0xec, 0xea, 0xca, 
+0xa6, 0x15, 0xca, 0xe4, 0xc4, 0xd6, 0xb5, 0xa5, 0xe6, 0xc5, 0x67, 0xf9, 0x10, 0x41, 0x0b, 0xac, 
+0x66, 0xe5, 0xf4, 0x4f, 0x14, 0x55, 0x66, 0x07, 0x50, 0x59, 0x2d, 0x19, 0xef, 0xff, 0x50, 0x72, 
+0xfc, 0x5a, 0xc0, 0x50, 0xf3, 0xb5, 0x60, 0x0e, 0x35, 0x5d, 0x5b, 0x08, 0x35, 0x77, 0xe4, 0x50, 
+0xd3, 0x5f, 0xe0, 0x21, 0xe6, 0x4b, 0x39, 0xd4, 0xa8, 0x54, 0x3c, 0xc4, 0xcc, 0x92, 0x43, 0xcd, 
+0x51, 0x39, 0xd4, 0x8c, 0x94, 0x43, 0x4d, 0x8e, 0x1c, 0x6a, 0xc2, 0xed, 0x0a, 0x35, 0xf2, 0x66, 
+0x1b, 0xf6, 0x36, 0x15, 0x53, 0x44, 0x40, 0x92, 0xaf, 0x65, 0x41, 0x6b, 0x5c, 0x8b, 0xc7, 0xf3, 
+0x29, 0xf7, 0x41, 0x5b, 0x05, 0x9e, 0x9e, 0x74, 0x6b, 0x8c, 0x3f, 0xb5, 0x8d, 0x81, 0x47, 0x80, 
+0xaa, 0xaa, 0xc6, 0x73, 0xfa, 0x30, 0xf0, 0x58, 0xc5, 0x1d, 0xeb, 0x8d, 0xcd, 0x8c, 0xf3, 0x62, 
+0x52, 0x1a, 0x88, 0xa0, 0x23, 0x06, 0xc8, 0x87, 0x6d, 0x59, 0xc5, 0xa0, 0x87, 0x89, 0x3c, 0x7a, 
+0x74, 0xd6, 0x19, 0x3e, 0x7a, 0xf4, 0xd6, 0xe9, 0xed, 0x73, 0x57, 0x3d, 0xba, 0xeb, 0xaa, 0x10, 
+0x3d, 0xfa, 0xeb, 0xca, 0x8e, 0x44, 0x1f, 0x3d, 0x3a, 0x6c, 0x83, 0x5c, 0xa2, 0x86, 0xd2, 0x68, 
+0xb0, 0x70, 0xdc, 0x87, 0x88, 0x3c, 0x8f, 0x10, 0xcc, 0x94, 0xf6, 0x83, 0x51, 0xc2, 0x98, 0xfa, 
+0xb3, 0x0e, 0x3b, 0x3c, 0xe0, 0xd0, 0x42, 0x49, 0x63, 0xd0, 0xf9, 0x19, 0x87, 0x1b, 0x05, 0x8e, 
+0xcf, 0xe1, 0x00, 0xc0, 0xff, 0x01 };
+
+static const Bit8u layout_keybrd3sys_index[357] = {
 0x4b, 0x43, 0x46, 0x00, 0x01, 0x01, 0x2e, 0x48, 0x65, 0x6e, 0x72, 0x69, 0x71, 0x75, 0x65, 0x20, 
 0x50, 0x65, 0x72, 0x6f, 0x6e, 0xff, 0x44, 0x4f, 0x53, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x70, 0x61, 
 0x67, 0x65, 0x73, 0x20, 0x2d, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x23, 0x33, 
-0x20, 0x6f, 0x66, 0x20, 0x33, 0x6c, 0x02, 0x04, 0x00, 0x00, 0x41, 0x5a, 0x05, 0x03, 0x00, 0x00, 
-0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xeb, 0x59, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x62, 0xeb, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xe3, 0x5e, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x62, 0xe3, 0x93, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x03, 0x02, 0x01, 0x00, 0x22, 0x40, 0x04, 0x02, 0x01, 0x00, 0x27, 0x23, 0x05, 0x03, 0x03, 0x00, 
-0xa0, 0x24, 0x4e, 0x06, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x02, 0x03, 0x00, 0x00, 0x26, 0x09, 0x02, 
-0x01, 0x00, 0x3b, 0x2a, 0x0a, 0x02, 0x01, 0x00, 0x3f, 0x7b, 0x0b, 0x02, 0x01, 0x00, 0x25, 0x7d, 
-0x29, 0x03, 0x00, 0x29, 0x28, 0x5d, 0x5b, 0x2b, 0x02, 0x00, 0x2c, 0x7c, 0x5c, 0x33, 0x02, 0x03, 
-0x00, 0x00, 0x3c, 0x34, 0x02, 0x03, 0x00, 0x00, 0x3e, 0x35, 0x02, 0x00, 0x2e, 0x3f, 0x2f, 0x00, 
-0x07, 0x01, 0x01, 0x00, 0x2c, 0x08, 0x01, 0x01, 0x00, 0x2e, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 
-0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x41, 
-0x00, 0xa5, 0x85, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 
-0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 
-0x95, 0x1b, 0x41, 0x00, 0xea, 0x9a, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xeb, 0x9b, 
-0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 
-0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 
-0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x2a, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 
-0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 
-0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 
-0x41, 0x00, 0xee, 0x9e, 0x00, 0x07, 0x01, 0x01, 0x00, 0xf3, 0x08, 0x01, 0x01, 0x00, 0xf1, 0x11, 
-0x43, 0x00, 0xf5, 0xf4, 0x77, 0x57, 0x1a, 0x41, 0x00, 0xfc, 0xfb, 0x1b, 0x41, 0x00, 0xf7, 0xf6, 
-0x27, 0x41, 0x00, 0xfe, 0xfd, 0x28, 0x41, 0x00, 0xf9, 0xf8, 0x33, 0x41, 0x00, 0xf3, 0xf2, 0x34, 
-0xc1, 0x00, 0xf1, 0x34, 0xf0, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x07, 
-0x01, 0x01, 0x00, 0x2c, 0x08, 0x01, 0x01, 0x00, 0x2e, 0x10, 0x43, 0x00, 0x6a, 0x4a, 0xa9, 0x89, 
-0x11, 0x43, 0x00, 0xfd, 0x59, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 
-0x8a, 0x14, 0x41, 0x00, 0xa5, 0x85, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 
-0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x43, 0x00, 0x68, 0xfc, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 
-0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x43, 0x00, 0xf3, 0xf2, 0xea, 0x9a, 0x1e, 0x41, 0x00, 
-0xe4, 0x94, 0x1f, 0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 
-0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 
-0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 
-0x86, 0x28, 0x43, 0x00, 0xf5, 0xf4, 0xed, 0x9d, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 
-0x2c, 0x43, 0x00, 0xf7, 0xf6, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 
-0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 
-0x32, 0x43, 0x00, 0xf9, 0xf8, 0xec, 0x9c, 0x33, 0x43, 0x04, 0xa1, 0x81, 0x00, 0x3e, 0x34, 0xc3, 
-0x00, 0xf1, 0x34, 0xf0, 0x00, 0xee, 0x34, 0x9e, 0x34, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x7b, 0x00, 0xec, 0xc1, 0x04, 0x13, 0x00, 0x00, 0x42, 0x4c, 0x2c, 0x00, 0x00, 0x42, 0x59, 
-0x2c, 0xcf, 0x01, 0x42, 0x4c, 0x2c, 0xcf, 0x01, 0x42, 0x59, 0x0b, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x03, 0xca, 0x01, 0x00, 0x00, 0x00, 0x00, 0x51, 0x03, 
-0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x04, 0xc8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x04, 
-0xdf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x68, 0x03, 0xb4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x68, 0x03, 
-0xd7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0xa4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 
-0xc9, 0x03, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 
-0x03, 0x00, 0x00, 0x40, 0x04, 0x02, 0x03, 0x00, 0x00, 0x23, 0x05, 0x02, 0x03, 0x00, 0x00, 0xcf, 
-0x07, 0x02, 0x03, 0x00, 0x00, 0x5e, 0x08, 0x02, 0x03, 0x00, 0x00, 0x26, 0x09, 0x02, 0x03, 0x00, 
-0x00, 0x24, 0x0a, 0x02, 0x03, 0x00, 0x00, 0xae, 0x0b, 0x02, 0x03, 0x00, 0x00, 0xaf, 0x1a, 0x02, 
-0x03, 0x00, 0x00, 0x5b, 0x1b, 0x02, 0x03, 0x00, 0x00, 0x5d, 0x2b, 0x02, 0x03, 0x00, 0x00, 0x7c, 
-0x33, 0x02, 0x03, 0x00, 0x00, 0x3c, 0x34, 0x02, 0x03, 0x00, 0x00, 0x3e, 0x35, 0x02, 0x03, 0x00, 
-0x00, 0x2f, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x05, 
-0x02, 0x05, 0x00, 0x3b, 0xa0, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x0a, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x0b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x10, 0x41, 0x00, 0xa9, 0x89, 
-0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x42, 0x00, 0xe3, 0x93, 0xfb, 0x13, 0x41, 0x00, 0xaa, 0x8a, 
-0x14, 0x43, 0x00, 0xa5, 0x85, 0xf3, 0xf2, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x43, 0x00, 0xa3, 
-0x83, 0xfd, 0xfc, 0x17, 0x43, 0x00, 0xe8, 0x98, 0xe9, 0x99, 0x18, 0x41, 0x00, 0xf7, 0xf6, 0x19, 
-0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x01, 0x00, 0x27, 0x27, 0x1e, 0x41, 
-0x00, 0xe4, 0x94, 0x1f, 0x43, 0x00, 0xeb, 0x9b, 0xea, 0x9a, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 
-0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 
-0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 
-0x41, 0x00, 0xa6, 0x86, 0x28, 0x43, 0x00, 0xed, 0x9d, 0xf5, 0xf4, 0x29, 0xc1, 0x00, 0xf1, 0x29, 
-0xf0, 0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 
-0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 
-0x00, 0xac, 0x8c, 0x30, 0x43, 0x00, 0xf9, 0xf8, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 
-0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 
-0x00, 0x2e, 0x2c, 0x00, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfb, 
-0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x05, 0x02, 
-0x01, 0x00, 0x3b, 0xfb, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x0a, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x0b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 
-0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x43, 
-0x00, 0xa5, 0x85, 0xf3, 0xf2, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x43, 0x00, 0xa3, 0x83, 0xfd, 
-0xfc, 0x17, 0x43, 0x00, 0xe8, 0x98, 0xe9, 0x99, 0x18, 0x41, 0x00, 0xf7, 0xf6, 0x19, 0x41, 0x00, 
-0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x01, 0x00, 0x27, 0x27, 0x1e, 0x41, 0x00, 0xe4, 
-0x94, 0x1f, 0x43, 0x00, 0xeb, 0x9b, 0xea, 0x9a, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 
-0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 
-0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 
-0xa6, 0x86, 0x28, 0x43, 0x00, 0xed, 0x9d, 0xf5, 0xf4, 0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 0x00, 
-0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 0x41, 0x00, 
-0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 
-0x8c, 0x30, 0x43, 0x00, 0xf9, 0xf8, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 
-0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 0x00, 0x2e, 
-0x2c, 0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 0xfb, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 
-0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0xef, 0x05, 0x02, 0x05, 0x00, 0x3b, 
-0xa0, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 0x00, 0xbd, 0xbe, 
-0x11, 0x41, 0x00, 0xa4, 0xa5, 0x12, 0x42, 0x00, 0xe7, 0xe8, 0xcf, 0x13, 0x41, 0x00, 0xc6, 0xc7, 
-0x14, 0x43, 0x00, 0xa8, 0xa9, 0x86, 0x87, 0x15, 0x41, 0x00, 0xd4, 0xd5, 0x16, 0x41, 0x00, 0xac, 
-0xad, 0x17, 0x43, 0x00, 0xf5, 0xf6, 0xf9, 0xfa, 0x18, 0x41, 0x00, 0x98, 0x99, 0x19, 0x41, 0x00, 
-0xf3, 0xf4, 0x1a, 0x41, 0x00, 0xb5, 0xb6, 0x1b, 0x01, 0x00, 0x27, 0x27, 0x1e, 0x41, 0x00, 0xaa, 
-0xab, 0x1f, 0x43, 0x00, 0xf1, 0xf2, 0x9e, 0x9f, 0x20, 0x41, 0x00, 0xeb, 0xec, 0x21, 0x41, 0x00, 
-0xa0, 0xa1, 0x22, 0x41, 0x00, 0xd8, 0xdd, 0x23, 0x41, 0x00, 0xe1, 0xe2, 0x24, 0x41, 0x00, 0xd6, 
-0xd7, 0x25, 0x41, 0x00, 0xd0, 0xd1, 0x26, 0x41, 0x00, 0xa6, 0xa7, 0x27, 0x41, 0x00, 0xe9, 0xea, 
-0x28, 0x41, 0x00, 0xf7, 0xf8, 0x29, 0x41, 0x00, 0x84, 0x85, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x7c, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 0xc1, 0x00, 0xde, 0x2c, 0xe0, 0x00, 0x2d, 0x41, 
-0x00, 0xfb, 0xfc, 0x2e, 0x41, 0x00, 0xe3, 0xe4, 0x2f, 0x41, 0x00, 0xd2, 0xd3, 0x30, 0x43, 0x00, 
-0x8a, 0x8b, 0xb7, 0xb8, 0x31, 0x41, 0x00, 0xe5, 0xe6, 0x32, 0x41, 0x00, 0xed, 0xee, 0x33, 0x41, 
-0x00, 0xa2, 0xa3, 0x34, 0x41, 0x00, 0x9c, 0x9d, 0x35, 0x01, 0x00, 0x2e, 0x2c, 0x00, 0x05, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x03, 0x00, 0x00, 0xcf, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x7d, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0xef, 0x05, 0x01, 0x01, 
-0x00, 0x3b, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 0x00, 0xbd, 
-0xbe, 0x11, 0x41, 0x00, 0xa4, 0xa5, 0x12, 0x41, 0x00, 0xe7, 0xe8, 0x13, 0x41, 0x00, 0xc6, 0xc7, 
-0x14, 0x43, 0x00, 0xa8, 0xa9, 0x86, 0x87, 0x15, 0x41, 0x00, 0xd4, 0xd5, 0x16, 0x41, 0x00, 0xac, 
-0xad, 0x17, 0x43, 0x00, 0xf5, 0xf6, 0xf9, 0xfa, 0x18, 0x41, 0x00, 0x98, 0x99, 0x19, 0x41, 0x00, 
-0xf3, 0xf4, 0x1a, 0x41, 0x00, 0xb5, 0xb6, 0x1b, 0x01, 0x00, 0x27, 0x27, 0x1e, 0x41, 0x00, 0xaa, 
-0xab, 0x1f, 0x43, 0x00, 0xf1, 0xf2, 0x9e, 0x9f, 0x20, 0x41, 0x00, 0xeb, 0xec, 0x21, 0x41, 0x00, 
-0xa0, 0xa1, 0x22, 0x41, 0x00, 0xd8, 0xdd, 0x23, 0x41, 0x00, 0xe1, 0xe2, 0x24, 0x41, 0x00, 0xd6, 
-0xd7, 0x25, 0x41, 0x00, 0xd0, 0xd1, 0x26, 0x41, 0x00, 0xa6, 0xa7, 0x27, 0x41, 0x00, 0xe9, 0xea, 
-0x28, 0x41, 0x00, 0xf7, 0xf8, 0x29, 0x41, 0x00, 0x84, 0x85, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x7e, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 0xc1, 0x00, 0xde, 0x2c, 0xe0, 0x00, 0x2d, 0x41, 
-0x00, 0xfb, 0xfc, 0x2e, 0x41, 0x00, 0xe3, 0xe4, 0x2f, 0x41, 0x00, 0xd2, 0xd3, 0x30, 0x43, 0x00, 
-0x8a, 0x8b, 0xb7, 0xb8, 0x31, 0x41, 0x00, 0xe5, 0xe6, 0x32, 0x41, 0x00, 0xed, 0xee, 0x33, 0x41, 
-0x00, 0xa2, 0xa3, 0x34, 0x41, 0x00, 0x9c, 0x9d, 0x35, 0x01, 0x00, 0x2e, 0x2c, 0x00, 0x36, 0x04, 
-0x1f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x43, 0x08, 0x02, 0x04, 0x00, 0x00, 0x42, 0x4e, 0x02, 
-0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x75, 0x44, 0x00, 0x6e, 
-0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x02, 0x41, 0x00, 0x26, 0x31, 0x03, 0x42, 0x00, 0x82, 0x32, 0x7e, 0x04, 0x42, 
-0x00, 0x22, 0x33, 0x23, 0x05, 0x42, 0x01, 0xcb, 0x34, 0x7b, 0x06, 0x44, 0x08, 0x28, 0x35, 0x5b, 
-0x00, 0x1b, 0x07, 0x44, 0x08, 0x2d, 0x36, 0x7c, 0x00, 0x1f, 0x08, 0x42, 0x04, 0x8a, 0x37, 0xc8, 
-0x09, 0x44, 0x08, 0x5f, 0x38, 0x5c, 0x00, 0x1c, 0x0a, 0x42, 0x00, 0x87, 0x39, 0x5e, 0x0b, 0x42, 
-0x00, 0x85, 0x30, 0x40, 0x0c, 0x44, 0x08, 0x29, 0xf8, 0x5d, 0x00, 0x1d, 0x0d, 0x42, 0x03, 0x00, 
-0x00, 0x7d, 0x10, 0xc5, 0x00, 0x61, 0x1e, 0x41, 0x1e, 0x91, 0x1e, 0x92, 0x1e, 0x01, 0x1e, 0x00, 
-0x1e, 0x11, 0xc5, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x84, 0x2c, 0x8e, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 
-0x12, 0x43, 0x00, 0x65, 0x45, 0xc6, 0xc7, 0x13, 0x03, 0x03, 0x00, 0x00, 0x94, 0x99, 0x15, 0x41, 
-0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x43, 0x00, 0x69, 0x49, 0xe1, 0xee, 0x18, 
-0x43, 0x00, 0x6f, 0x4f, 0xe4, 0xe5, 0x19, 0x03, 0x03, 0x00, 0x00, 0xf7, 0xef, 0x1a, 0x44, 0x0f, 
-0xc9, 0xca, 0x00, 0x00, 0x1e, 0x1b, 0x43, 0x06, 0x24, 0xa0, 0x00, 0xd5, 0x1e, 0xc5, 0x00, 0x71, 
-0x10, 0x51, 0x10, 0x00, 0x10, 0x00, 0x10, 0x11, 0x10, 0x00, 0x10, 0x1f, 0x03, 0x03, 0x00, 0x00, 
-0xf9, 0xdd, 0x20, 0x03, 0x03, 0x00, 0x00, 0xa8, 0xad, 0x26, 0x03, 0x03, 0x00, 0x00, 0xab, 0xac, 
-0x27, 0xc5, 0x00, 0x6d, 0x32, 0x4d, 0x32, 0x00, 0x32, 0x00, 0x32, 0x0d, 0x32, 0x00, 0x32, 0x28, 
-0x41, 0x02, 0x97, 0xcc, 0x29, 0x41, 0x00, 0x9e, 0x9f, 0x2b, 0x43, 0x00, 0x9b, 0x9d, 0x2a, 0xe6, 
-0x2c, 0xc5, 0x00, 0x77, 0x11, 0x57, 0x11, 0x00, 0x11, 0x00, 0x11, 0x17, 0x11, 0x00, 0x11, 0x2e, 
-0x41, 0x00, 0x63, 0x43, 0x31, 0x43, 0x00, 0x6e, 0x4e, 0xa4, 0xa5, 0x32, 0x41, 0x00, 0x2c, 0x3f, 
-0x33, 0x43, 0x00, 0x3b, 0x2e, 0x3c, 0xae, 0x34, 0x43, 0x00, 0x3a, 0x2f, 0x3e, 0xaf, 0x35, 0x41, 
-0x00, 0x21, 0xf5, 0x39, 0x00, 0x00, 0x20, 0x56, 0x41, 0x00, 0x3c, 0x3e, 0x00, 0x60, 0x0f, 0x61, 
-0x85, 0x65, 0x8a, 0x9e, 0xd0, 0x69, 0x8d, 0x6f, 0x95, 0x9b, 0xfa, 0x75, 0x97, 0x41, 0xb7, 0x45, 
-0xd4, 0x9f, 0xd1, 0x49, 0xde, 0x4f, 0xe3, 0x9d, 0xfb, 0x55, 0xeb, 0x20, 0x60, 0x5e, 0x0b, 0x61, 
-0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 
-0xe2, 0x55, 0xea, 0x20, 0x5e, 0x22, 0x09, 0x65, 0x89, 0x69, 0x8b, 0x75, 0x81, 0x79, 0x98, 0x45, 
-0xd3, 0x49, 0xd8, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x27, 0x13, 0x61, 0xa0, 0x65, 0x82, 0x9e, 
-0xf1, 0x69, 0xa1, 0x6f, 0xa2, 0x9b, 0xec, 0x75, 0xa3, 0x6e, 0x9c, 0x63, 0x87, 0x41, 0xb5, 0x45, 
-0x90, 0x9f, 0xf2, 0x49, 0xd6, 0x4f, 0xe0, 0x9d, 0xed, 0x55, 0xe9, 0x4e, 0xcf, 0x43, 0x80, 0x20, 
-0x27, 0x25, 0x0f, 0x61, 0x86, 0x65, 0xa6, 0x9e, 0xe7, 0x69, 0xa9, 0x6f, 0xbd, 0x9b, 0xfc, 0x75, 
-0xf4, 0x41, 0x8f, 0x45, 0xa7, 0x9f, 0xe8, 0x49, 0xb8, 0x4f, 0xbe, 0x9d, 0xfd, 0x55, 0xf6, 0x20, 
-0x25, 0x00, 0xcd, 0x4b, 0x03, 0x13, 0x00, 0x00, 0x45, 0x54, 0x2c, 0x00, 0x00, 0x45, 0x45, 0x2c, 
-0xc6, 0x01, 0x45, 0x54, 0x2c, 0xc6, 0x01, 0x45, 0x45, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x18, 0x01, 0x40, 0x01, 0x00, 0x00, 0x52, 0x03, 0xd1, 
-0x02, 0xd6, 0x02, 0x00, 0x00, 0x5a, 0x03, 0xc0, 0x02, 0xd6, 0x02, 0x00, 0x00, 0x5b, 0x03, 0x31, 
-0x02, 0x53, 0x02, 0x00, 0x00, 0x5c, 0x04, 0xb5, 0x01, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 
-0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x01, 0x00, 0x22, 0x40, 0x40, 0x04, 0x03, 0x03, 0x00, 
-0x00, 0x9c, 0x9c, 0x05, 0x03, 0x01, 0x00, 0xcf, 0x24, 0x24, 0x07, 0x01, 0x01, 0x00, 0x26, 0x08, 
-0x03, 0x01, 0x00, 0x2f, 0x7b, 0x7b, 0x09, 0x04, 0x01, 0x00, 0x28, 0x5b, 0x5b, 0x1b, 0x0a, 0x04, 
-0x01, 0x00, 0x29, 0x5d, 0x5d, 0x1d, 0x0b, 0x03, 0x01, 0x00, 0x3d, 0x7d, 0x7d, 0x0c, 0x04, 0x00, 
-0x2b, 0x3f, 0x5c, 0x5c, 0x1c, 0x0d, 0x01, 0x03, 0xcb, 0xc8, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 
-0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 
-0x00, 0x6f, 0x4f, 0x1a, 0x41, 0x00, 0x81, 0x9a, 0x1b, 0x43, 0x00, 0xe4, 0xe5, 0xf5, 0xf5, 0x1e, 
-0x41, 0x00, 0x61, 0x41, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x27, 0x41, 0x00, 0x94, 0x99, 0x28, 0x44, 
-0x04, 0x84, 0x8e, 0xca, 0x5e, 0x1e, 0x29, 0x01, 0x03, 0xcc, 0xc9, 0x2b, 0x03, 0x00, 0x27, 0x2a, 
-0xab, 0xab, 0x2c, 0x41, 0x00, 0x7a, 0x5a, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x31, 0x41, 0x00, 0x6e, 
-0x4e, 0x33, 0x02, 0x01, 0x00, 0x3b, 0x3c, 0x34, 0x02, 0x01, 0x00, 0x3a, 0x3e, 0x35, 0x04, 0x00, 
-0x2d, 0x5f, 0x7c, 0x7c, 0x1f, 0x39, 0x00, 0x00, 0x20, 0x56, 0x03, 0x00, 0x3c, 0x3e, 0x7c, 0x7c, 
-0x00, 0x05, 0x01, 0x01, 0x00, 0x9f, 0x13, 0x41, 0x00, 0x72, 0x52, 0x1f, 0x43, 0x03, 0x00, 0x00, 
-0xd5, 0xbe, 0x22, 0x41, 0x00, 0x67, 0x47, 0x25, 0x41, 0x00, 0x6b, 0x4b, 0x26, 0x41, 0x00, 0x6c, 
-0x4c, 0x2c, 0x43, 0x03, 0x00, 0x00, 0xd8, 0xcf, 0x00, 0x60, 0x0b, 0x61, 0x83, 0x65, 0x89, 0x69, 
-0x8c, 0x6f, 0x93, 0x75, 0xd7, 0x41, 0xa0, 0x45, 0xed, 0x49, 0xa1, 0x4f, 0xe2, 0x55, 0xc7, 0x20, 
-0x60, 0x7e, 0x03, 0x6f, 0xe4, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x13, 0x61, 0xd0, 0x65, 0xd2, 0x69, 
-0xd4, 0x75, 0xd6, 0x67, 0x85, 0x6b, 0xe9, 0x6c, 0xeb, 0x6e, 0xec, 0x72, 0x8b, 0x41, 0xb5, 0x45, 
-0xb7, 0x49, 0xbd, 0x55, 0xc6, 0x47, 0x95, 0x4b, 0xe8, 0x4c, 0xea, 0x4e, 0xee, 0x52, 0x8a, 0x20, 
-0x5e, 0xef, 0x0d, 0x63, 0x87, 0x65, 0x82, 0x6e, 0xe7, 0x6f, 0xa2, 0x73, 0x98, 0x7a, 0xa5, 0x43, 
-0x80, 0x45, 0x90, 0x4e, 0xe3, 0x4f, 0xe0, 0x53, 0x97, 0x5a, 0x8d, 0x20, 0xef, 0x27, 0x07, 0x63, 
-0xd1, 0x73, 0xd5, 0x7a, 0xd8, 0x43, 0xb6, 0x53, 0xbe, 0x5a, 0xcf, 0x20, 0x27, 0x00, 0x1f, 0x43, 
-0x03, 0x00, 0x00, 0xd0, 0xd1, 0x2c, 0x43, 0x03, 0x00, 0x00, 0xe7, 0xe8, 0x00, 0x60, 0x0b, 0x61, 
-0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 
-0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 
-0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 
-0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 0x0f, 0x61, 
-0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x43, 
-0x80, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0x76, 0x05, 0x73, 
-0xd0, 0x7a, 0xe7, 0x53, 0xd1, 0x5a, 0xe8, 0x20, 0x76, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 
-0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x1f, 0x43, 0x03, 0x00, 0x00, 0xf9, 0xdd, 0x2b, 0x03, 0x0f, 
-0x00, 0x00, 0xa0, 0xa0, 0x2c, 0x43, 0x03, 0x00, 0x00, 0xf7, 0xef, 0x00, 0x60, 0x0b, 0x61, 0x85, 
-0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 
-0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 
-0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 
-0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0x27, 0x0f, 0x61, 0xa0, 
-0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x43, 0x80, 
-0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0x27, 0x76, 0x05, 0x73, 0xf9, 
-0x7a, 0xf7, 0x53, 0xdd, 0x5a, 0xef, 0x20, 0x76, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x12, 
-0x42, 0x03, 0x00, 0x00, 0xd5, 0x29, 0x00, 0x01, 0xa0, 0x00, 0x29, 0x00, 0x01, 0xa0, 0x00, 0x60, 
-0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 
-0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 
-0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 
-0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 
-0x0f, 0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 
-0xb5, 0x43, 0x80, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0x00, 
-0x86, 0xe0, 0x01, 0x04, 0x00, 0x00, 0x46, 0x4f, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xef, 0x00, 
-0xfc, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x77, 0x01, 0x98, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 
-0x22, 0x40, 0x04, 0x02, 0x03, 0x00, 0x00, 0x9c, 0x05, 0x02, 0x01, 0x00, 0xcf, 0x24, 0x07, 0x01, 
-0x01, 0x00, 0x26, 0x08, 0x02, 0x01, 0x00, 0x2f, 0x7b, 0x09, 0x03, 0x01, 0x00, 0x28, 0x5b, 0x1b, 
-0x0a, 0x03, 0x01, 0x00, 0x29, 0x5d, 0x1d, 0x0b, 0x02, 0x01, 0x00, 0x3d, 0x7d, 0x0c, 0x01, 0x00, 
-0x2b, 0x3f, 0x0d, 0x02, 0x03, 0xcb, 0xc8, 0x7c, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0x41, 0x00, 
-0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 
-0x4f, 0x1a, 0x42, 0x04, 0x86, 0x8f, 0xcc, 0x1b, 0x42, 0x04, 0xd0, 0xd1, 0xc9, 0x1e, 0x41, 0x00, 
-0x61, 0x41, 0x27, 0x41, 0x00, 0x91, 0x92, 0x28, 0x43, 0x04, 0x9b, 0x9d, 0xca, 0x1e, 0x29, 0x01, 
-0x00, 0xab, 0xf5, 0x2b, 0x01, 0x00, 0x27, 0x2a, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x31, 0x41, 0x00, 
-0x6e, 0x4e, 0x32, 0x42, 0x03, 0x00, 0x00, 0xe6, 0x33, 0x02, 0x01, 0x00, 0x3b, 0x3c, 0x34, 0x02, 
-0x01, 0x00, 0x3a, 0x3e, 0x35, 0x03, 0x00, 0x2d, 0x5f, 0x5c, 0x1f, 0x39, 0x00, 0x00, 0x20, 0x56, 
-0x03, 0x00, 0x3c, 0x3e, 0x5c, 0x1c, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x12, 0x42, 0x03, 
-0x00, 0x00, 0xd5, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 
-0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 
-0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 
-0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 
-0x55, 0xea, 0x20, 0x5e, 0xef, 0x0f, 0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 
-0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x43, 0x80, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 
-0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 
-0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0x00, 0x05, 
-0x01, 0x03, 0x00, 0xa0, 0x0d, 0x00, 0x01, 0xca, 0x1a, 0x42, 0x07, 0x00, 0x00, 0xcb, 0x1b, 0x42, 
-0x00, 0x8c, 0x8b, 0x7e, 0x28, 0x42, 0x07, 0x00, 0x00, 0xc9, 0x29, 0x01, 0x00, 0xab, 0x15, 0x00, 
-0x60, 0x03, 0x61, 0x85, 0x65, 0x8a, 0x20, 0x60, 0x5e, 0x05, 0x61, 0x83, 0x65, 0x88, 0x6f, 0x93, 
-0x75, 0x96, 0x20, 0x5e, 0x27, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 
-0x79, 0x98, 0x41, 0xa4, 0x45, 0x90, 0x49, 0xa5, 0x4f, 0xa6, 0x55, 0xa7, 0x59, 0x97, 0x20, 0x27, 
-0x22, 0x08, 0x61, 0x84, 0x65, 0x89, 0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 
-0x20, 0x22, 0x00, 0xfb, 0x5e, 0x01, 0x04, 0x00, 0x00, 0x48, 0x59, 0x03, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x03, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x83, 
-0x03, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-0x43, 0x00, 0xa5, 0xa4, 0x31, 0x21, 0x03, 0x43, 0x00, 0xe7, 0xe6, 0x32, 0x40, 0x04, 0x43, 0x00, 
-0x93, 0x92, 0x33, 0x23, 0x05, 0x43, 0x00, 0xa1, 0xa0, 0x34, 0x24, 0x06, 0x43, 0x00, 0xa9, 0xa8, 
-0x35, 0x25, 0x07, 0x42, 0x00, 0xe9, 0xe8, 0x36, 0x08, 0xc3, 0x00, 0xf1, 0x08, 0xf0, 0x00, 0x37, 
-0x7e, 0x26, 0x7e, 0x09, 0x43, 0x00, 0xf3, 0xf2, 0x38, 0x2a, 0x0a, 0x42, 0x00, 0x8d, 0x8c, 0x39, 
-0x0b, 0x42, 0x00, 0xa3, 0xa2, 0x30, 0x0d, 0x03, 0x00, 0x28, 0x29, 0x3d, 0x2b, 0x10, 0x41, 0x00, 
-0xf7, 0xf6, 0x11, 0x41, 0x00, 0x83, 0x82, 0x12, 0x41, 0x00, 0xeb, 0xea, 0x13, 0x41, 0x00, 0xa7, 
-0xa6, 0x14, 0xc1, 0x00, 0xe1, 0x14, 0xe0, 0x00, 0x15, 0x41, 0x00, 0xf5, 0xf4, 0x16, 0x41, 0x00, 
-0x9d, 0x9c, 0x17, 0x41, 0x00, 0x8f, 0x8e, 0x18, 0x41, 0x00, 0x91, 0x90, 0x19, 0x41, 0x00, 0x9b, 
-0x9a, 0x1a, 0x43, 0x00, 0xfb, 0xfa, 0x5b, 0x7b, 0x1b, 0x43, 0x00, 0xfd, 0xfc, 0x5d, 0x7d, 0x1e, 
-0x41, 0x00, 0xed, 0xec, 0x1f, 0x41, 0x00, 0x85, 0x84, 0x20, 0x41, 0x00, 0x89, 0x88, 0x21, 0x41, 
-0x00, 0x81, 0x80, 0x22, 0x41, 0x00, 0xab, 0xaa, 0x23, 0x41, 0x00, 0x95, 0x94, 0x24, 0x41, 0x00, 
-0xef, 0xee, 0x25, 0x41, 0x00, 0x9f, 0x9e, 0x26, 0x41, 0x00, 0xe5, 0xe4, 0x27, 0x01, 0x00, 0x3a, 
-0xdd, 0x28, 0x02, 0x00, 0x27, 0xfe, 0x22, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 
-0x01, 0x00, 0xde, 0x15, 0x2c, 0x41, 0x00, 0x87, 0x86, 0x2d, 0x41, 0x00, 0xe3, 0xe2, 0x2e, 0x41, 
-0x00, 0x8b, 0x8a, 0x2f, 0x41, 0x00, 0x97, 0x96, 0x30, 0x41, 0x00, 0xf9, 0xf8, 0x31, 0x41, 0x00, 
-0x99, 0x98, 0x32, 0x41, 0x00, 0xad, 0xac, 0x33, 0x02, 0x01, 0x00, 0xae, 0x3c, 0x34, 0x02, 0x01, 
-0x00, 0xaf, 0x3e, 0x35, 0x03, 0x00, 0xdf, 0xdc, 0x2f, 0x3f, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 
-0x00, 0x00, 0x79, 0x00, 0x2d, 0x60, 0x03, 0x04, 0x00, 0x00, 0x4b, 0x41, 0x07, 0x03, 0x00, 0x00, 
-0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xe9, 0x78, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0xb5, 0xe9, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xed, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0xb5, 0xed, 0x81, 0x01, 0x00, 0x00, 0x00, 0x00, 0x38, 0x75, 0x4c, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x38, 0x75, 0x5e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x03, 0x02, 0x03, 0x00, 0x00, 0x40, 0x04, 0x02, 0x03, 0x00, 0x00, 0x23, 0x07, 0x02, 0x03, 0x00, 
-0x00, 0x5e, 0x08, 0x02, 0x03, 0x00, 0x00, 0x26, 0x09, 0x02, 0x03, 0x00, 0x00, 0x24, 0x1a, 0x02, 
-0x03, 0x00, 0x00, 0x5b, 0x1b, 0x02, 0x03, 0x00, 0x00, 0x5d, 0x2b, 0x02, 0x03, 0x00, 0x00, 0x7c, 
-0x33, 0x02, 0x03, 0x00, 0x00, 0x3c, 0x34, 0x02, 0x03, 0x00, 0x00, 0x3e, 0x35, 0x02, 0x03, 0x00, 
-0x00, 0x2f, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0x25, 0x05, 0x01, 0x01, 
-0x00, 0x3b, 0x06, 0x01, 0x01, 0x00, 0x3a, 0x07, 0x01, 0x01, 0x00, 0x2c, 0x08, 0x01, 0x01, 0x00, 
-0x2e, 0x10, 0x01, 0x00, 0x96, 0x96, 0x11, 0x01, 0x00, 0x9a, 0x9a, 0x12, 0x01, 0x00, 0x93, 0x93, 
-0x13, 0x01, 0x00, 0x89, 0x89, 0x14, 0x01, 0x00, 0x84, 0x84, 0x15, 0x01, 0x00, 0x8c, 0x8c, 0x16, 
-0x01, 0x00, 0x82, 0x82, 0x17, 0x01, 0x00, 0x98, 0x98, 0x18, 0x01, 0x00, 0x9c, 0x9c, 0x19, 0x01, 
-0x00, 0x86, 0x86, 0x1a, 0x01, 0x00, 0x9e, 0x9e, 0x1b, 0x01, 0x00, 0x9b, 0x9b, 0x1e, 0x01, 0x00, 
-0x94, 0x94, 0x1f, 0x01, 0x00, 0x87, 0x87, 0x20, 0x01, 0x00, 0x85, 0x85, 0x21, 0x01, 0x00, 0x80, 
-0x80, 0x22, 0x01, 0x00, 0x8e, 0x8e, 0x23, 0x01, 0x00, 0x90, 0x90, 0x24, 0x01, 0x00, 0x8d, 0x8d, 
-0x25, 0x01, 0x00, 0x8a, 0x8a, 0x26, 0x01, 0x00, 0x83, 0x83, 0x27, 0x01, 0x00, 0x8f, 0x8f, 0x28, 
-0x01, 0x00, 0x97, 0x97, 0x29, 0x01, 0x00, 0xa2, 0xa2, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 
-0x78, 0x2b, 0x01, 0x00, 0xa0, 0xa0, 0x2c, 0x01, 0x00, 0x9d, 0x9d, 0x2d, 0x01, 0x00, 0x99, 0x99, 
-0x2e, 0x01, 0x00, 0x91, 0x91, 0x2f, 0x01, 0x00, 0x8b, 0x8b, 0x30, 0x01, 0x00, 0x88, 0x88, 0x31, 
-0x01, 0x00, 0x92, 0x92, 0x32, 0x01, 0x00, 0x95, 0x95, 0x33, 0x01, 0x00, 0x81, 0x81, 0x34, 0x01, 
-0x00, 0x9f, 0x9f, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x03, 0x01, 0x01, 
-0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0x25, 0x05, 0x01, 0x01, 0x00, 0x3b, 0x06, 0x01, 0x01, 0x00, 
-0x3a, 0x07, 0x01, 0x01, 0x00, 0x2c, 0x08, 0x01, 0x01, 0x00, 0x2e, 0x10, 0x41, 0x00, 0xe6, 0x96, 
-0x11, 0x41, 0x00, 0xea, 0x9a, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xa9, 0x89, 0x14, 
-0x41, 0x00, 0xa4, 0x84, 0x15, 0x41, 0x00, 0xac, 0x8c, 0x16, 0x41, 0x00, 0xa2, 0x82, 0x17, 0x41, 
-0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xec, 0x9c, 0x19, 0x41, 0x00, 0xa6, 0x86, 0x1a, 0x41, 0x00, 
-0xee, 0x9e, 0x1b, 0x41, 0x00, 0xeb, 0x9b, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xa7, 
-0x87, 0x20, 0x41, 0x00, 0xa5, 0x85, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xae, 0x8e, 
-0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xad, 0x8d, 0x25, 0x41, 0x00, 0xaa, 
-0x8a, 0x26, 0x41, 0x00, 0xa3, 0x83, 0x27, 0x41, 0x00, 0xaf, 0x8f, 0x28, 0x41, 0x00, 0xe7, 0x97, 
-0x29, 0x10, 0x00, 0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x2b, 0xc1, 0x00, 0xf0, 
-0x2b, 0xf0, 0x00, 0x2c, 0x41, 0x00, 0xed, 0x9d, 0x2d, 0x41, 0x00, 0xe9, 0x99, 0x2e, 0x41, 0x00, 
-0xe1, 0x91, 0x2f, 0x41, 0x00, 0xab, 0x8b, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 
-0x92, 0x32, 0x41, 0x00, 0xe5, 0x95, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xef, 0x9f, 
-0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 
-0x01, 0x01, 0x00, 0x25, 0x05, 0x01, 0x01, 0x00, 0x3b, 0x06, 0x01, 0x01, 0x00, 0x3a, 0x07, 0x01, 
-0x01, 0x00, 0x2c, 0x08, 0x01, 0x01, 0x00, 0x2e, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x43, 0x00, 
-0xe6, 0x96, 0xf6, 0xf7, 0x12, 0x43, 0x00, 0xe3, 0x93, 0xd3, 0xd4, 0x13, 0x43, 0x00, 0xaa, 0x8a, 
-0xd1, 0xd2, 0x14, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x43, 0x00, 
-0xa3, 0x83, 0xb5, 0xb6, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x43, 
-0x00, 0xa7, 0x87, 0xcf, 0xd0, 0x1a, 0x43, 0x00, 0xe5, 0x95, 0xd5, 0xd6, 0x1b, 0x43, 0x00, 0xea, 
-0x9a, 0xf4, 0xf5, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 
-0xa2, 0x82, 0x21, 0x43, 0x00, 0xa0, 0x80, 0xfa, 0xfb, 0x22, 0x43, 0x00, 0xaf, 0x8f, 0xd7, 0xd8, 
-0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 
-0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x43, 0x00, 0xa6, 0x86, 0xb7, 0xb8, 0x28, 0x42, 0x00, 
-0xed, 0x9d, 0xfe, 0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x7c, 0x2c, 0x43, 0x00, 0xef, 0x9f, 0xc6, 0xc7, 0x2d, 0x43, 0x00, 0xe7, 0x97, 0xbd, 0xbe, 
-0x2e, 0x43, 0x00, 0xe1, 0x91, 0xf8, 0xf9, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 
-0x88, 0x31, 0x43, 0x00, 0xe2, 0x92, 0xf2, 0xf3, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 
-0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 
-0x1f, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0xbc, 0x6f, 0x01, 0x04, 0x00, 0x00, 0x4b, 0x4b, 0x03, 
-0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xe3, 0x32, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x28, 0xe3, 0x44, 0x00, 0x41, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0x22, 0x40, 0x04, 0x02, 0x01, 0x00, 0xfc, 0x23, 0x05, 
-0x02, 0x05, 0x00, 0x3b, 0xa0, 0x07, 0x02, 0x01, 0x00, 0x3a, 0x5e, 0x08, 0x02, 0x01, 0x00, 0x3f, 
-0x26, 0x09, 0x02, 0x03, 0x00, 0x00, 0x24, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 
-0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x42, 0x00, 0xa5, 0x85, 
-0xfd, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 
-0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x42, 0x00, 0xe5, 0x95, 0x5b, 
-0x1b, 0x42, 0x00, 0xea, 0x9a, 0x5d, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xeb, 0x9b, 
-0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 
-0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 
-0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 
-0x83, 0x03, 0xc8, 0x29, 0x00, 0x29, 0xf1, 0x29, 0xf0, 0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x78, 0x2b, 0x02, 0x01, 0x00, 0x2f, 0x7c, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 
-0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 
-0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x42, 0x00, 0xa1, 0x81, 
-0x3c, 0x34, 0x42, 0x00, 0xee, 0x9e, 0x3e, 0x35, 0x01, 0x00, 0x2e, 0x2c, 0x39, 0x00, 0x00, 0x20, 
-0x00, 0x12, 0x02, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 
-0x60, 0x13, 0xa0, 0xd1, 0xa3, 0xd3, 0xa8, 0xf5, 0xa9, 0xf7, 0xaa, 0xd5, 0xad, 0xd7, 0xae, 0xf3, 
-0xe3, 0xdd, 0xe5, 0xdf, 0x80, 0xd0, 0x83, 0xd2, 0x88, 0xf4, 0x89, 0xf6, 0x8a, 0xd4, 0x8d, 0xd6, 
-0x8e, 0xf2, 0x93, 0xdc, 0x95, 0xde, 0x20, 0x60, 0x00, 0x19, 0x44, 0x01, 0x04, 0x00, 0x00, 0x4b, 
-0x59, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xe3, 0x30, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x28, 0xe3, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
-0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0x22, 0x40, 0x04, 0x02, 0x01, 0x00, 0xfc, 
-0x23, 0x05, 0x02, 0x05, 0x00, 0x3b, 0xa0, 0x07, 0x02, 0x01, 0x00, 0x3a, 0x5e, 0x08, 0x02, 0x01, 
-0x00, 0x3f, 0x26, 0x09, 0x02, 0x03, 0x00, 0x00, 0x24, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 
-0x00, 0xe6, 0x96, 0x12, 0x43, 0x00, 0xe3, 0x93, 0xdd, 0xdc, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 
-0x42, 0x00, 0xa5, 0x85, 0xfd, 0x15, 0x43, 0x00, 0xad, 0x8d, 0xd7, 0xd6, 0x16, 0x41, 0x00, 0xa3, 
-0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 
-0x1a, 0x42, 0x00, 0xe5, 0x95, 0x5b, 0x1b, 0x42, 0x00, 0xea, 0x9a, 0x5d, 0x1e, 0x41, 0x00, 0xe4, 
-0x94, 0x1f, 0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 
-0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x43, 0x00, 0xae, 
-0x8e, 0xf3, 0xf2, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 
-0xa6, 0x86, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 0x00, 0x2a, 0x04, 
-0x1f, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 0x02, 0x01, 0x00, 0x2f, 0x7c, 0x2c, 0x41, 0x00, 0xef, 
-0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 
-0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 
-0x42, 0x00, 0xa1, 0x81, 0x3c, 0x34, 0x42, 0x00, 0xee, 0x9e, 0x3e, 0x35, 0x01, 0x00, 0x2e, 0x2c, 
-0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 
-0x39, 0x60, 0x05, 0x09, 0x00, 0x00, 0x4c, 0x54, 0x2c, 0xd4, 0x00, 0x4c, 0x54, 0x0b, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0xc4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x02, 0x03, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x20, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x06, 0x03, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x03, 0x50, 0x01, 0xc4, 0x01, 0x00, 
-0x00, 0x0a, 0x03, 0x55, 0x02, 0xc7, 0x02, 0x00, 0x00, 0x03, 0x03, 0x58, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0x03, 0x03, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x57, 0x04, 0x00, 0x00, 0x00, 
-0x00, 0x04, 0x03, 0x8d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0x31, 0x21, 0x03, 0x03, 0x03, 0x00, 0x00, 0x32, 0x40, 0x04, 
-0x03, 0x03, 0x00, 0x00, 0x33, 0x23, 0x05, 0x03, 0x03, 0x00, 0x00, 0x34, 0x24, 0x06, 0x03, 0x03, 
-0x00, 0x00, 0x35, 0x25, 0x07, 0x03, 0x03, 0x00, 0x00, 0x36, 0x5e, 0x08, 0x03, 0x03, 0x00, 0x00, 
-0x37, 0x26, 0x09, 0x03, 0x03, 0x00, 0x00, 0x38, 0x2a, 0x0d, 0x03, 0x03, 0x00, 0x00, 0x3d, 0x2b, 
-0x00, 0x02, 0x41, 0x00, 0xd0, 0xb5, 0x03, 0x41, 0x00, 0xd1, 0xb6, 0x04, 0x41, 0x00, 0xd2, 0xb7, 
-0x05, 0x41, 0x00, 0xd3, 0xb8, 0x06, 0x41, 0x00, 0xd4, 0xbd, 0x07, 0x41, 0x00, 0xd5, 0xbe, 0x08, 
-0x41, 0x00, 0xd6, 0xc6, 0x09, 0x41, 0x00, 0xd7, 0xc7, 0x0d, 0x41, 0x00, 0xd8, 0xcf, 0x00, 0x02, 
-0x41, 0x00, 0x85, 0x8f, 0x03, 0x41, 0x00, 0x87, 0x80, 0x04, 0x41, 0x00, 0x8a, 0x8b, 0x05, 0x41, 
-0x00, 0x82, 0x90, 0x06, 0x41, 0x00, 0x8d, 0xad, 0x07, 0x41, 0x00, 0x9e, 0x9f, 0x08, 0x41, 0x00, 
-0x97, 0xa7, 0x09, 0x41, 0x00, 0x96, 0xa6, 0x0d, 0x41, 0x00, 0x91, 0x92, 0x00, 0x02, 0x41, 0x00, 
-0xdd, 0xdc, 0x03, 0x41, 0x00, 0xdf, 0xde, 0x04, 0xc1, 0x00, 0xf1, 0x04, 0xf0, 0x00, 0x05, 0x41, 
-0x00, 0xf3, 0xf2, 0x06, 0x41, 0x00, 0xf5, 0xf4, 0x07, 0x41, 0x00, 0xf7, 0xf6, 0x08, 0x41, 0x00, 
-0xf9, 0xf8, 0x09, 0x41, 0x00, 0xfb, 0xfa, 0x0d, 0x41, 0x00, 0xfd, 0xfc, 0x00, 0x02, 0x41, 0x00, 
-0xdd, 0xdc, 0x03, 0x41, 0x00, 0xdf, 0xde, 0x04, 0xc1, 0x00, 0xf1, 0x04, 0xf0, 0x00, 0x05, 0x41, 
-0x00, 0xf3, 0xf2, 0x06, 0x41, 0x00, 0xf5, 0xf4, 0x07, 0x41, 0x00, 0xf7, 0xf6, 0x08, 0x41, 0x00, 
-0xf9, 0xf8, 0x09, 0x41, 0x00, 0xfb, 0xfa, 0x0d, 0x41, 0x00, 0xfd, 0xfc, 0x12, 0x41, 0x00, 0x65, 
-0x45, 0x13, 0x41, 0x00, 0x72, 0x52, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 
-0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x24, 
-0x41, 0x02, 0x6a, 0x00, 0x26, 0x41, 0x00, 0x6c, 0x4c, 0x28, 0x00, 0x01, 0xca, 0x29, 0x01, 0x03, 
-0xc8, 0xc9, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x32, 0x41, 0x00, 0x6d, 0x4d, 0x39, 0x00, 0x00, 0x20, 
-0x00, 0x60, 0x0b, 0x61, 0x83, 0x65, 0xa5, 0x69, 0xe9, 0x6f, 0xec, 0x75, 0x88, 0x41, 0xa0, 0x45, 
-0x8d, 0x49, 0xe8, 0x4f, 0xee, 0x55, 0xad, 0x20, 0x60, 0x7e, 0x21, 0x61, 0x86, 0xdd, 0xb5, 0x65, 
-0x85, 0xf1, 0xd6, 0xf3, 0x8b, 0x69, 0x9f, 0xf5, 0xe7, 0x6c, 0xe6, 0x6d, 0xbe, 0x6e, 0xd4, 0x6f, 
-0xe4, 0x72, 0xaf, 0x75, 0xc6, 0xf9, 0xef, 0xfb, 0xb8, 0x79, 0xa4, 0x41, 0x8f, 0xdc, 0xbd, 0x45, 
-0x95, 0xf0, 0x9c, 0xf2, 0x8a, 0x49, 0xd0, 0xf4, 0xe3, 0x4c, 0xa6, 0x4d, 0xa7, 0x4e, 0xa8, 0x4f, 
-0xe5, 0x52, 0xae, 0x55, 0x9e, 0xf8, 0xab, 0xfa, 0xa9, 0x59, 0xa3, 0x20, 0x7e, 0x27, 0x19, 0x61, 
-0x87, 0xdd, 0x89, 0x65, 0x82, 0xf1, 0xd8, 0xf3, 0x9b, 0x69, 0x8c, 0xf5, 0xeb, 0x6f, 0xa2, 0x75, 
-0x98, 0xf9, 0xac, 0xfb, 0x91, 0x79, 0x93, 0x41, 0x80, 0xdc, 0xed, 0x45, 0x90, 0xf0, 0x96, 0xf2, 
-0x9d, 0x49, 0xa1, 0xf4, 0xea, 0x4f, 0xe0, 0x55, 0x97, 0xf8, 0xaa, 0xfa, 0x92, 0x59, 0xe2, 0x20, 
-0x27, 0x00, 0x02, 0x41, 0x00, 0xd0, 0xb5, 0x03, 0x41, 0x00, 0xd1, 0xb6, 0x04, 0x41, 0x00, 0xd2, 
-0xb7, 0x05, 0x41, 0x00, 0xd3, 0xb8, 0x06, 0x41, 0x00, 0xd4, 0xbd, 0x07, 0x41, 0x00, 0xd5, 0xbe, 
-0x08, 0x41, 0x00, 0xd6, 0xc6, 0x09, 0x41, 0x00, 0xd7, 0xc7, 0x0d, 0x41, 0x00, 0xd8, 0xcf, 0x12, 
-0x41, 0x00, 0x65, 0x45, 0x13, 0x41, 0x00, 0x72, 0x52, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 
-0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1e, 0x41, 0x00, 
-0x61, 0x41, 0x24, 0x41, 0x02, 0x6a, 0x00, 0x26, 0x41, 0x00, 0x6c, 0x4c, 0x28, 0x00, 0x01, 0xca, 
-0x29, 0x01, 0x03, 0xc8, 0xc9, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x32, 0x41, 0x00, 0x6d, 0x4d, 0x39, 
-0x00, 0x00, 0x20, 0x00, 0x60, 0x0b, 0x61, 0x83, 0x65, 0xa5, 0x69, 0xe9, 0x6f, 0xec, 0x75, 0x88, 
-0x41, 0xa0, 0x45, 0x8d, 0x49, 0xe8, 0x4f, 0xee, 0x55, 0xad, 0x20, 0x60, 0x7e, 0x21, 0x61, 0x86, 
-0xd0, 0xf1, 0x65, 0x85, 0xd2, 0xfc, 0xd3, 0x8b, 0x69, 0x9f, 0xd4, 0xe7, 0x6c, 0xe6, 0x6d, 0xf5, 
-0x6e, 0xfb, 0x6f, 0xe4, 0x72, 0xaf, 0x75, 0xf6, 0xd6, 0xef, 0xd7, 0xf3, 0x79, 0xa4, 0x41, 0x8f, 
-0xb5, 0xf4, 0x45, 0x95, 0xb7, 0x9c, 0xb8, 0x8a, 0x49, 0xf8, 0xbd, 0xe3, 0x4c, 0xa6, 0x4d, 0xa7, 
-0x4e, 0xa8, 0x4f, 0xe5, 0x52, 0xae, 0x55, 0x9e, 0xc6, 0xab, 0xc7, 0xa9, 0x59, 0xa3, 0x20, 0x7e, 
-0x27, 0x19, 0x61, 0x87, 0xd0, 0x89, 0x65, 0x82, 0xd2, 0xfd, 0xd3, 0x9b, 0x69, 0x8c, 0xd4, 0xeb, 
-0x6f, 0xa2, 0x75, 0x98, 0xd6, 0xac, 0xd7, 0x91, 0x79, 0x93, 0x41, 0x80, 0xb5, 0xed, 0x45, 0x90, 
-0xb7, 0x96, 0xb8, 0x9d, 0x49, 0xa1, 0xbd, 0xea, 0x4f, 0xe0, 0x55, 0x97, 0xc6, 0xaa, 0xc7, 0x92, 
-0x59, 0xe2, 0x20, 0x27, 0x00, 0x02, 0x41, 0x00, 0xdd, 0xdc, 0x03, 0x41, 0x00, 0xdf, 0xde, 0x04, 
-0xc1, 0x00, 0xf1, 0x04, 0xf0, 0x00, 0x05, 0x41, 0x00, 0xf3, 0xf2, 0x06, 0x41, 0x00, 0xf5, 0xf4, 
-0x07, 0x41, 0x00, 0xf7, 0xf6, 0x08, 0x41, 0x00, 0xf9, 0xf8, 0x09, 0x41, 0x00, 0xfb, 0xfa, 0x0d, 
-0x41, 0x00, 0xfd, 0xfc, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x02, 0x01, 0x03, 
-0xa0, 0xa0, 0x03, 0x41, 0x00, 0xe7, 0x97, 0x04, 0x01, 0x03, 0xa0, 0xa0, 0x05, 0x41, 0x00, 0xed, 
-0x9d, 0x06, 0x01, 0x03, 0xa0, 0xa0, 0x07, 0x41, 0x00, 0xe8, 0x98, 0x08, 0x41, 0x00, 0xee, 0x9e, 
-0x09, 0x01, 0x03, 0xa0, 0xa0, 0x0d, 0x41, 0x00, 0xa6, 0x86, 0x10, 0x41, 0x00, 0xef, 0x9f, 0x11, 
-0x41, 0x00, 0xe9, 0x99, 0x12, 0x41, 0x00, 0xa5, 0x85, 0x13, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x13, 
-0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0x41, 0x00, 0xeb, 0x9b, 0x16, 0x41, 0x00, 0xe3, 0x93, 0x17, 
-0x41, 0x00, 0xa8, 0x88, 0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x43, 
-0x00, 0xea, 0x9a, 0x5b, 0x7b, 0x1b, 0x43, 0x00, 0xec, 0x9c, 0x5d, 0x7d, 0x1e, 0x41, 0x00, 0xa0, 
-0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 
-0x22, 0x41, 0x00, 0xa3, 0x83, 0x23, 0x41, 0x00, 0xe5, 0x95, 0x24, 0x41, 0x00, 0xa9, 0x89, 0x25, 
-0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 
-0x7e, 0x2c, 0x41, 0x00, 0xa7, 0x87, 0x2d, 0x10, 0x00, 0x00, 0x2e, 0x41, 0x00, 0xe6, 0x96, 0x2f, 
-0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x41, 
-0x00, 0xac, 0x8c, 0x00, 0x02, 0x41, 0x00, 0xd0, 0xb5, 0x03, 0x41, 0x00, 0xd1, 0xb6, 0x04, 0x41, 
-0x00, 0xd2, 0xb7, 0x05, 0x41, 0x00, 0xd3, 0xb8, 0x06, 0x41, 0x00, 0xd4, 0xbd, 0x07, 0x41, 0x00, 
-0xd5, 0xbe, 0x08, 0x41, 0x00, 0xd6, 0xc6, 0x09, 0x41, 0x00, 0xd7, 0xc7, 0x0d, 0x41, 0x00, 0xd8, 
-0xcf, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x02, 0x01, 0x03, 0xa0, 0xa0, 0x03, 
-0x41, 0x00, 0xe7, 0x97, 0x04, 0xc1, 0x00, 0xf1, 0x04, 0xf0, 0x00, 0x05, 0x41, 0x00, 0xed, 0x9d, 
-0x06, 0x01, 0x03, 0xa0, 0xa0, 0x07, 0x41, 0x00, 0xe8, 0x98, 0x08, 0x41, 0x00, 0xee, 0x9e, 0x09, 
-0x01, 0x03, 0xa0, 0xa0, 0x0d, 0x41, 0x00, 0xa6, 0x86, 0x10, 0x41, 0x00, 0xef, 0x9f, 0x11, 0x41, 
-0x00, 0xe9, 0x99, 0x12, 0x41, 0x00, 0xa5, 0x85, 0x13, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x13, 0x14, 
-0x41, 0x00, 0xe2, 0x92, 0x15, 0x41, 0x00, 0xeb, 0x9b, 0x16, 0x41, 0x00, 0xe3, 0x93, 0x17, 0x41, 
-0x00, 0xa8, 0x88, 0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x43, 0x00, 
-0xea, 0x9a, 0x5b, 0x7b, 0x1b, 0x43, 0x00, 0xec, 0x9c, 0x5d, 0x7d, 0x1e, 0x41, 0x00, 0xa0, 0x80, 
-0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 
-0x41, 0x00, 0xa3, 0x83, 0x23, 0x41, 0x00, 0xe5, 0x95, 0x24, 0x41, 0x00, 0xa9, 0x89, 0x25, 0x41, 
-0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0x2c, 0x41, 0x00, 0xa7, 0x87, 0x2d, 0x10, 0x00, 0x00, 0x2e, 0x41, 0x00, 0xe6, 0x96, 0x2f, 0x41, 
-0x00, 0xa2, 0x82, 0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x41, 0x00, 
-0xac, 0x8c, 0x00, 0xc1, 0x9a, 0x03, 0x04, 0xd2, 0x00, 0x4c, 0x54, 0x09, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-0x03, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 
-0x03, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x54, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0x03, 0xa7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x71, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 
-0x03, 0xc0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-0x43, 0x03, 0x00, 0x00, 0xd7, 0xc7, 0x11, 0x43, 0x03, 0x00, 0x00, 0xd3, 0xb8, 0x12, 0x43, 0x03, 
-0x00, 0x00, 0xd2, 0xb7, 0x16, 0x43, 0x03, 0x00, 0x00, 0xd6, 0xc6, 0x17, 0x43, 0x03, 0x00, 0x00, 
-0xd4, 0xbd, 0x1e, 0x43, 0x03, 0x00, 0x00, 0xd0, 0xb5, 0x1f, 0x43, 0x03, 0x00, 0x00, 0xd5, 0xbe, 
-0x28, 0x03, 0x03, 0x00, 0x00, 0xf2, 0xa6, 0x2c, 0x43, 0x03, 0x00, 0x00, 0xd8, 0xcf, 0x2e, 0x43, 
-0x03, 0x00, 0x00, 0xd1, 0xb6, 0x00, 0x10, 0x43, 0x03, 0x00, 0x00, 0x96, 0xa6, 0x11, 0x43, 0x03, 
-0x00, 0x00, 0x82, 0x90, 0x12, 0x43, 0x03, 0x00, 0x00, 0x8a, 0x8b, 0x16, 0x43, 0x03, 0x00, 0x00, 
-0x97, 0xa7, 0x17, 0x43, 0x03, 0x00, 0x00, 0x8d, 0xad, 0x1e, 0x43, 0x03, 0x00, 0x00, 0x85, 0x8f, 
-0x1f, 0x43, 0x03, 0x00, 0x00, 0x9e, 0x9f, 0x28, 0x03, 0x03, 0x00, 0x00, 0xa9, 0x9d, 0x2c, 0x43, 
-0x03, 0x00, 0x00, 0x91, 0x92, 0x2e, 0x43, 0x03, 0x00, 0x00, 0x87, 0x80, 0x00, 0x10, 0x43, 0x03, 
-0x00, 0x00, 0xfb, 0xfa, 0x11, 0x43, 0x03, 0x00, 0x00, 0xf3, 0xf2, 0x12, 0xc3, 0x00, 0x65, 0x12, 
-0x45, 0x12, 0xf1, 0x12, 0xf0, 0x00, 0x16, 0x43, 0x03, 0x00, 0x00, 0xf9, 0xf8, 0x17, 0x43, 0x03, 
-0x00, 0x00, 0xf5, 0xf4, 0x1e, 0x43, 0x03, 0x00, 0x00, 0xdd, 0xdc, 0x1f, 0x43, 0x03, 0x00, 0x00, 
-0xf7, 0xf6, 0x28, 0x02, 0x03, 0x00, 0x00, 0xb7, 0x2c, 0x43, 0x03, 0x00, 0x00, 0xfd, 0xfc, 0x2e, 
-0x43, 0x03, 0x00, 0x00, 0xdf, 0xde, 0x00, 0x28, 0x03, 0x0f, 0x00, 0x00, 0xa0, 0xa0, 0x00, 0x10, 
-0x43, 0x03, 0x00, 0x00, 0xfb, 0xfa, 0x11, 0x43, 0x03, 0x00, 0x00, 0xf3, 0xf2, 0x12, 0xc3, 0x00, 
-0x65, 0x12, 0x45, 0x12, 0xf1, 0x12, 0xf0, 0x00, 0x16, 0x43, 0x03, 0x00, 0x00, 0xf9, 0xf8, 0x17, 
-0x43, 0x03, 0x00, 0x00, 0xf5, 0xf4, 0x1e, 0x43, 0x03, 0x00, 0x00, 0xdd, 0xdc, 0x1f, 0x43, 0x03, 
-0x00, 0x00, 0xf7, 0xf6, 0x28, 0x03, 0x0f, 0x00, 0x00, 0xa0, 0xa0, 0x2c, 0x43, 0x03, 0x00, 0x00, 
-0xfd, 0xfc, 0x2e, 0x43, 0x03, 0x00, 0x00, 0xdf, 0xde, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 
-0x7d, 0x00, 0x0c, 0x43, 0x00, 0xea, 0x9a, 0x2d, 0x5f, 0x0d, 0x43, 0x00, 0xec, 0x9c, 0x3d, 0x2b, 
-0x10, 0x43, 0x0c, 0xee, 0x9e, 0xa0, 0xa0, 0x11, 0x43, 0x0c, 0xed, 0x9d, 0xa0, 0xa0, 0x12, 0x43, 
-0x0c, 0xa5, 0x85, 0xa0, 0xa0, 0x13, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 
-0x92, 0x15, 0x41, 0x00, 0xeb, 0x9b, 0x16, 0x43, 0x0c, 0xe3, 0x93, 0xa0, 0xa0, 0x17, 0x43, 0x0c, 
-0xa8, 0x88, 0xa0, 0xa0, 0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x43, 
-0x00, 0xe7, 0x97, 0x5b, 0x7b, 0x1b, 0x43, 0x00, 0xe8, 0x98, 0x5d, 0x7d, 0x1e, 0x43, 0x0c, 0xa0, 
-0x80, 0xa0, 0xa0, 0x1f, 0x43, 0x0c, 0xe1, 0x91, 0xa0, 0xa0, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 
-0x41, 0x00, 0xe4, 0x94, 0x22, 0x41, 0x00, 0xa3, 0x83, 0x23, 0x41, 0x00, 0xe5, 0x95, 0x24, 0x41, 
-0x00, 0xa9, 0x89, 0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x28, 0x43, 0x00, 
-0xef, 0x9f, 0x27, 0x22, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x2b, 0x43, 0x00, 0xa6, 
-0x86, 0x5c, 0x7c, 0x2c, 0x43, 0x0c, 0xa7, 0x87, 0xa0, 0xa0, 0x2d, 0x41, 0x00, 0xe9, 0x99, 0x2e, 
-0x44, 0x1c, 0xe6, 0x96, 0xa0, 0x00, 0x3c, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 0x00, 0xa1, 
-0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x41, 0x00, 0xac, 0x8c, 0x00, 0x10, 0x43, 0x03, 0x00, 
-0x00, 0xd7, 0xc7, 0x11, 0x43, 0x03, 0x00, 0x00, 0xd3, 0xb8, 0x12, 0x43, 0x03, 0x00, 0x00, 0xd2, 
-0xb7, 0x16, 0x43, 0x03, 0x00, 0x00, 0xd6, 0xc6, 0x17, 0x43, 0x03, 0x00, 0x00, 0xd4, 0xbd, 0x1e, 
-0x43, 0x03, 0x00, 0x00, 0xd0, 0xb5, 0x1f, 0x43, 0x03, 0x00, 0x00, 0xd5, 0xbe, 0x28, 0x03, 0x03, 
-0x00, 0x00, 0xf4, 0xf5, 0x2c, 0x43, 0x03, 0x00, 0x00, 0xd8, 0xcf, 0x2e, 0x43, 0x03, 0x00, 0x00, 
-0xd1, 0xb6, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x0c, 0x43, 0x00, 0xea, 0x9a, 
-0x2d, 0x5f, 0x0d, 0x43, 0x00, 0xec, 0x9c, 0x3d, 0x2b, 0x10, 0x43, 0x0c, 0xee, 0x9e, 0xa0, 0xa0, 
-0x11, 0x43, 0x0c, 0xed, 0x9d, 0xa0, 0xa0, 0x12, 0x43, 0x0c, 0xa5, 0x85, 0xa0, 0xa0, 0x13, 0xc1, 
-0x00, 0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0x41, 0x00, 0xeb, 0x9b, 0x16, 
-0x43, 0x0c, 0xe3, 0x93, 0xa0, 0xa0, 0x17, 0x43, 0x0c, 0xa8, 0x88, 0xa0, 0xa0, 0x18, 0x41, 0x00, 
-0xae, 0x8e, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x43, 0x00, 0xe7, 0x97, 0x5b, 0x7b, 0x1b, 0x43, 
-0x00, 0xe8, 0x98, 0x5d, 0x7d, 0x1e, 0x43, 0x0c, 0xa0, 0x80, 0xa0, 0xa0, 0x1f, 0x43, 0x0c, 0xe1, 
-0x91, 0xa0, 0xa0, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 0x41, 0x00, 
-0xa3, 0x83, 0x23, 0x41, 0x00, 0xe5, 0x95, 0x24, 0x41, 0x00, 0xa9, 0x89, 0x25, 0x41, 0x00, 0xaa, 
-0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x28, 0x43, 0x00, 0xef, 0x9f, 0x27, 0x22, 0x29, 0xc3, 0x00, 
-0xf1, 0x29, 0xf0, 0x00, 0x60, 0x29, 0x7e, 0x29, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7e, 
-0x2b, 0x43, 0x00, 0xa6, 0x86, 0x5c, 0x7c, 0x2c, 0x43, 0x0c, 0xa7, 0x87, 0xa0, 0xa0, 0x2d, 0x41, 
-0x00, 0xe9, 0x99, 0x2e, 0x44, 0x1c, 0xe6, 0x96, 0xa0, 0x00, 0x3c, 0x2f, 0x41, 0x00, 0xa2, 0x82, 
-0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x41, 0x00, 0xac, 0x8c, 0x00, 
-0x6f, 0x88, 0x05, 0x04, 0xd3, 0x00, 0x4c, 0x54, 0x0b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x13, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x46, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x7b, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x81, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xc2, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x7c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0xb7, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x09, 0x03, 0x73, 0x03, 0xed, 0x03, 0x00, 0x00, 0x0a, 0x03, 0x7e, 0x04, 
-0xf2, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x21, 
-0x31, 0x03, 0x02, 0x00, 0x22, 0x32, 0x40, 0x04, 0x02, 0x00, 0x2f, 0x33, 0x23, 0x05, 0x02, 0x00, 
-0x3b, 0x34, 0x24, 0x06, 0x02, 0x00, 0x3a, 0x35, 0x25, 0x07, 0x02, 0x00, 0x2c, 0x36, 0x5e, 0x08, 
-0x02, 0x00, 0x2e, 0x37, 0x26, 0x09, 0x02, 0x00, 0x3f, 0x38, 0x2a, 0x0a, 0x01, 0x00, 0x28, 0x39, 
-0x0b, 0x01, 0x00, 0x29, 0x30, 0x0c, 0x01, 0x00, 0x5f, 0x2d, 0x0d, 0x01, 0x00, 0x2b, 0x3d, 0x10, 
-0x43, 0x00, 0xd0, 0xb5, 0x71, 0x51, 0x11, 0x43, 0x00, 0xd8, 0xcf, 0x77, 0x57, 0x1a, 0x43, 0x00, 
-0xd4, 0xbd, 0x5b, 0x7b, 0x1b, 0x03, 0x00, 0xf2, 0xa6, 0x5d, 0x7d, 0x27, 0x43, 0x00, 0xd6, 0xc6, 
-0x3b, 0x3a, 0x28, 0x43, 0x00, 0xd3, 0xb8, 0x27, 0x22, 0x2b, 0x01, 0x00, 0x7c, 0x5c, 0x2d, 0x43, 
-0x00, 0xd7, 0xc7, 0x78, 0x58, 0x33, 0x43, 0x00, 0xd1, 0xb6, 0x2c, 0x3c, 0x34, 0x43, 0x00, 0xd5, 
-0xbe, 0x2e, 0x3e, 0x35, 0x43, 0x00, 0xd2, 0xb7, 0x2f, 0x3f, 0x00, 0x10, 0x41, 0x00, 0x85, 0x8f, 
-0x11, 0x41, 0x00, 0x91, 0x92, 0x1a, 0x41, 0x00, 0x8d, 0xad, 0x1b, 0x01, 0x00, 0xa9, 0x9d, 0x27, 
-0x41, 0x00, 0x97, 0xa7, 0x28, 0x41, 0x00, 0x82, 0x90, 0x2d, 0x41, 0x00, 0x96, 0xa6, 0x33, 0x41, 
-0x00, 0x87, 0x80, 0x34, 0x41, 0x00, 0x9e, 0x9f, 0x35, 0x41, 0x00, 0x8a, 0x8b, 0x00, 0x10, 0x41, 
-0x00, 0xdd, 0xdc, 0x11, 0x41, 0x00, 0xfd, 0xfc, 0x1a, 0x41, 0x00, 0xf5, 0xf4, 0x1b, 0x01, 0x00, 
-0xb7, 0xa6, 0x27, 0x41, 0x00, 0xf9, 0xf8, 0x28, 0x41, 0x00, 0xf3, 0xf2, 0x2d, 0x41, 0x00, 0xfb, 
-0xfa, 0x33, 0x41, 0x00, 0xdf, 0xde, 0x34, 0x41, 0x00, 0xf7, 0xf6, 0x35, 0xc1, 0x00, 0xf1, 0x35, 
-0xf0, 0x00, 0x00, 0x1b, 0x01, 0x03, 0xa0, 0xa0, 0x00, 0x10, 0x41, 0x00, 0xdd, 0xdc, 0x11, 0x41, 
-0x00, 0xfd, 0xfc, 0x1a, 0x41, 0x00, 0xf5, 0xf4, 0x1b, 0x01, 0x03, 0xa0, 0xa0, 0x27, 0x41, 0x00, 
-0xf9, 0xf8, 0x28, 0x41, 0x00, 0xf3, 0xf2, 0x2d, 0x41, 0x00, 0xfb, 0xfa, 0x33, 0x41, 0x00, 0xdf, 
-0xde, 0x34, 0x41, 0x00, 0xf7, 0xf6, 0x35, 0xc1, 0x00, 0xf1, 0x35, 0xf0, 0x00, 0x36, 0x04, 0x1f, 
-0x00, 0x00, 0x00, 0x00, 0x7d, 0x56, 0x10, 0x00, 0x00, 0x00, 0x10, 0x43, 0x0c, 0xef, 0x9f, 0xa0, 
-0xa0, 0x11, 0x43, 0x0c, 0xa6, 0x86, 0xa0, 0xa0, 0x12, 0x41, 0x00, 0xa5, 0x85, 0x13, 0xc1, 0x00, 
-0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0x41, 0x00, 0xeb, 0x9b, 0x16, 0x41, 
-0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xa8, 0x88, 0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 
-0xaf, 0x8f, 0x1a, 0x41, 0x00, 0xea, 0x9a, 0x1b, 0x41, 0x00, 0xec, 0x9c, 0x1e, 0x41, 0x00, 0xa0, 
-0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 
-0x22, 0x41, 0x00, 0xa3, 0x83, 0x23, 0x41, 0x00, 0xe5, 0x95, 0x24, 0x41, 0x00, 0xa9, 0x89, 0x25, 
-0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x27, 0x41, 0x00, 0xee, 0x9e, 0x28, 0x41, 
-0x00, 0xed, 0x9d, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x2c, 0x41, 0x00, 0xa7, 0x87, 
-0x2d, 0x43, 0x0c, 0xe9, 0x99, 0xa0, 0xa0, 0x2e, 0x41, 0x00, 0xe6, 0x96, 0x2f, 0x41, 0x00, 0xa2, 
-0x82, 0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x41, 0x00, 0xac, 0x8c, 
-0x33, 0x41, 0x00, 0xe7, 0x97, 0x34, 0x41, 0x00, 0xe8, 0x98, 0x35, 0x01, 0x03, 0xa0, 0xa0, 0x56, 
-0x10, 0x00, 0x00, 0x00, 0x10, 0x41, 0x00, 0xd0, 0xb5, 0x11, 0x41, 0x00, 0xd8, 0xcf, 0x1a, 0x41, 
-0x00, 0xd4, 0xbd, 0x1b, 0x01, 0x00, 0xf4, 0xf5, 0x27, 0x41, 0x00, 0xd6, 0xc6, 0x28, 0x41, 0x00, 
-0xd3, 0xb8, 0x2d, 0x41, 0x00, 0xd7, 0xc7, 0x33, 0x41, 0x00, 0xd1, 0xb6, 0x34, 0x41, 0x00, 0xd5, 
-0xbe, 0x35, 0x41, 0x00, 0xd2, 0xb7, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x10, 
-0x43, 0x0c, 0xef, 0x9f, 0xa0, 0xa0, 0x11, 0x43, 0x0c, 0xa6, 0x86, 0xa0, 0xa0, 0x12, 0x41, 0x00, 
-0xa5, 0x85, 0x13, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0x41, 
-0x00, 0xeb, 0x9b, 0x16, 0x41, 0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xa8, 0x88, 0x18, 0x41, 0x00, 
-0xae, 0x8e, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x41, 0x00, 0xea, 0x9a, 0x1b, 0x41, 0x00, 0xec, 
-0x9c, 0x1e, 0x41, 0x00, 0xa0, 0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 0xa4, 0x84, 
-0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 0x41, 0x00, 0xa3, 0x83, 0x23, 0x41, 0x00, 0xe5, 0x95, 0x24, 
-0x41, 0x00, 0xa9, 0x89, 0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x27, 0x41, 
-0x00, 0xee, 0x9e, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7e, 
-0x2c, 0x41, 0x00, 0xa7, 0x87, 0x2d, 0x43, 0x0c, 0xe9, 0x99, 0xa0, 0xa0, 0x2e, 0x41, 0x00, 0xe6, 
-0x96, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 
-0x32, 0x41, 0x00, 0xac, 0x8c, 0x33, 0x41, 0x00, 0xe7, 0x97, 0x34, 0x41, 0x00, 0xe8, 0x98, 0x35, 
-0xc1, 0x00, 0xf1, 0x35, 0xf0, 0x00, 0x56, 0x10, 0x00, 0x00, 0x00, 0x10, 0x41, 0x00, 0xdd, 0xdc, 
-0x11, 0x41, 0x00, 0xfd, 0xfc, 0x12, 0x41, 0x00, 0x65, 0x45, 0x13, 0x41, 0x00, 0x72, 0x52, 0x15, 
-0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 
-0x00, 0x6f, 0x4f, 0x1a, 0x41, 0x00, 0xf5, 0xf4, 0x1b, 0x01, 0x00, 0xd5, 0xb7, 0x1e, 0x41, 0x00, 
-0x61, 0x41, 0x24, 0x41, 0x02, 0x6a, 0x00, 0x26, 0x41, 0x00, 0x6c, 0x4c, 0x27, 0x41, 0x00, 0xf9, 
-0xf8, 0x28, 0x41, 0x00, 0xf3, 0xf2, 0x29, 0x02, 0x07, 0xc8, 0xc9, 0xca, 0x2d, 0x41, 0x00, 0xfb, 
-0xfa, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x32, 0x41, 0x00, 0x6d, 0x4d, 0x33, 0x41, 0x00, 0xdf, 0xde, 
-0x34, 0x41, 0x00, 0xf7, 0xf6, 0x35, 0xc1, 0x00, 0xf1, 0x35, 0xf0, 0x00, 0x39, 0x00, 0x00, 0x20, 
-0x56, 0x10, 0x00, 0x00, 0x00, 0x60, 0x0b, 0x61, 0x83, 0x65, 0xa5, 0x69, 0xe9, 0x6f, 0xec, 0x75, 
-0x88, 0x41, 0xa0, 0x45, 0x8d, 0x49, 0xe8, 0x4f, 0xee, 0x55, 0xad, 0x20, 0x60, 0x7e, 0x21, 0x61, 
-0x86, 0xdd, 0xb5, 0x65, 0x85, 0xf1, 0xd6, 0xf3, 0x8b, 0x69, 0x9f, 0xf5, 0xe7, 0x6c, 0xe6, 0x6d, 
-0xbe, 0x6e, 0xd4, 0x6f, 0xe4, 0x72, 0xaf, 0x75, 0xc6, 0xf9, 0xef, 0xfb, 0xb8, 0x79, 0xa4, 0x41, 
-0x8f, 0xdc, 0xbd, 0x45, 0x95, 0xf0, 0x9c, 0xf2, 0x8a, 0x49, 0xd0, 0xf4, 0xe3, 0x4c, 0xa6, 0x4d, 
-0xa7, 0x4e, 0xa8, 0x4f, 0xe5, 0x52, 0xae, 0x55, 0x9e, 0xf8, 0xab, 0xfa, 0xa9, 0x59, 0xa3, 0x20, 
-0x7e, 0x27, 0x19, 0x61, 0x87, 0xdd, 0x89, 0x65, 0x82, 0xf1, 0xd8, 0xf3, 0x9b, 0x69, 0x8c, 0xf5, 
-0xeb, 0x6f, 0xa2, 0x75, 0x98, 0xf9, 0xac, 0xfb, 0x91, 0x79, 0x93, 0x41, 0x80, 0xdc, 0xed, 0x45, 
-0x90, 0xf0, 0x96, 0xf2, 0x9d, 0x49, 0xa1, 0xf4, 0xea, 0x4f, 0xe0, 0x55, 0x97, 0xf8, 0xaa, 0xfa, 
-0x92, 0x59, 0xe2, 0x20, 0x27, 0x00, 0x10, 0x41, 0x00, 0xd0, 0xb5, 0x11, 0x41, 0x00, 0xd8, 0xcf, 
-0x12, 0x41, 0x00, 0x65, 0x45, 0x13, 0x41, 0x00, 0x72, 0x52, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 
-0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x41, 
-0x00, 0xd4, 0xbd, 0x1b, 0x01, 0x00, 0xf7, 0xf2, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x24, 0x41, 0x02, 
-0x6a, 0x00, 0x26, 0x41, 0x00, 0x6c, 0x4c, 0x27, 0x41, 0x00, 0xd6, 0xc6, 0x28, 0x41, 0x00, 0xd3, 
-0xb8, 0x29, 0x02, 0x07, 0xc8, 0xc9, 0xca, 0x2d, 0x41, 0x00, 0xd7, 0xc7, 0x31, 0x41, 0x00, 0x6e, 
-0x4e, 0x32, 0x41, 0x00, 0x6d, 0x4d, 0x33, 0x41, 0x00, 0xd1, 0xb6, 0x34, 0x41, 0x00, 0xd5, 0xbe, 
-0x35, 0x41, 0x00, 0xd2, 0xb7, 0x39, 0x00, 0x00, 0x20, 0x00, 0x60, 0x0b, 0x61, 0x83, 0x65, 0xa5, 
-0x69, 0xe9, 0x6f, 0xec, 0x75, 0x88, 0x41, 0xa0, 0x45, 0x8d, 0x49, 0xe8, 0x4f, 0xee, 0x55, 0xad, 
-0x20, 0x60, 0x7e, 0x21, 0x61, 0x86, 0xd0, 0xf1, 0x65, 0x85, 0xd2, 0xfc, 0xd3, 0x8b, 0x69, 0x9f, 
-0xd4, 0xe7, 0x6c, 0xe6, 0x6d, 0xf5, 0x6e, 0xfb, 0x6f, 0xe4, 0x72, 0xaf, 0x75, 0xf6, 0xd6, 0xef, 
-0xd7, 0xf3, 0x79, 0xa4, 0x41, 0x8f, 0xb5, 0xf4, 0x45, 0x95, 0xb7, 0x9c, 0xb8, 0x8a, 0x49, 0xf8, 
-0xbd, 0xe3, 0x4c, 0xa6, 0x4d, 0xa7, 0x4e, 0xa8, 0x4f, 0xe5, 0x52, 0xae, 0x55, 0x9e, 0xc6, 0xab, 
-0xc7, 0xa9, 0x59, 0xa3, 0x20, 0x7e, 0x27, 0x19, 0x61, 0x87, 0xd0, 0x89, 0x65, 0x82, 0xd2, 0xfd, 
-0xd3, 0x9b, 0x69, 0x8c, 0xd4, 0xeb, 0x6f, 0xa2, 0x75, 0x98, 0xd6, 0xac, 0xd7, 0x91, 0x79, 0x93, 
-0x41, 0x80, 0xb5, 0xed, 0x45, 0x90, 0xb7, 0x96, 0xb8, 0x9d, 0x49, 0xa1, 0xbd, 0xea, 0x4f, 0xe0, 
-0x55, 0x97, 0xc6, 0xaa, 0xc7, 0x92, 0x59, 0xe2, 0x20, 0x27, 0x00, 0x19, 0x22, 0x06, 0x04, 0xdd, 
-0x00, 0x4c, 0x54, 0x0b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0x03, 0x88, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xda, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 
-0x03, 0xc1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0xe9, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 
-0x03, 0xd2, 0x03, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x09, 
-0x03, 0x36, 0x04, 0xb7, 0x04, 0x00, 0x00, 0x0a, 0x03, 0x48, 0x05, 0x8c, 0x05, 0x00, 0x00, 0x00, 
-0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x21, 0x31, 0x40, 0x03, 0x03, 0x00, 
-0x2d, 0x32, 0x5f, 0x1f, 0x04, 0x02, 0x00, 0x2f, 0x33, 0x23, 0x05, 0x02, 0x00, 0x3b, 0x34, 0x24, 
-0x06, 0x02, 0x00, 0x3a, 0x35, 0xf5, 0x07, 0x02, 0x00, 0x2c, 0x36, 0x5e, 0x08, 0x02, 0x00, 0x2e, 
-0x37, 0x26, 0x09, 0x02, 0x00, 0x3d, 0x38, 0x2a, 0x0a, 0x03, 0x00, 0x28, 0x39, 0x5b, 0x1b, 0x0b, 
-0x03, 0x00, 0x29, 0x30, 0x5d, 0x1d, 0x0c, 0x02, 0x00, 0x3f, 0x2b, 0x27, 0x0d, 0xc4, 0x00, 0x78, 
-0x2d, 0x58, 0x2d, 0x25, 0x83, 0x18, 0x2d, 0x00, 0x83, 0x10, 0x41, 0x00, 0xd0, 0xb5, 0x11, 0x41, 
-0x00, 0xd8, 0xcf, 0x1a, 0x42, 0x00, 0xd4, 0xbd, 0x7b, 0x1b, 0xc4, 0x00, 0x77, 0x11, 0x57, 0x11, 
-0x7d, 0x11, 0x17, 0x11, 0x00, 0x11, 0x21, 0x41, 0x00, 0xd5, 0xbe, 0x27, 0x41, 0x00, 0xd6, 0xc6, 
-0x28, 0x42, 0x00, 0xd3, 0xb8, 0x22, 0x29, 0x02, 0x00, 0x60, 0x7e, 0xef, 0x2b, 0xc4, 0x00, 0x71, 
-0x10, 0x51, 0x10, 0x7c, 0x10, 0x11, 0x10, 0x00, 0x10, 0x2d, 0x41, 0x00, 0xd7, 0xc7, 0x33, 0x42, 
-0x00, 0xd1, 0xb6, 0xf7, 0x34, 0xc4, 0x00, 0x66, 0x21, 0x46, 0x21, 0xf2, 0x21, 0x06, 0x21, 0x00, 
-0x21, 0x35, 0x43, 0x00, 0xd2, 0xb7, 0x5c, 0x1c, 0x39, 0x00, 0x00, 0x20, 0x56, 0x02, 0x00, 0x3c, 
-0x3e, 0x2d, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0x15, 0x10, 0x41, 0x00, 0x85, 0x8f, 0x11, 0x41, 
-0x00, 0x91, 0x92, 0x1a, 0x41, 0x00, 0x8d, 0xad, 0x21, 0x41, 0x00, 0x9e, 0x9f, 0x27, 0x41, 0x00, 
-0x97, 0xa7, 0x28, 0x41, 0x00, 0x82, 0x90, 0x29, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x2d, 0x41, 0x00, 
-0x96, 0xa6, 0x33, 0x42, 0x00, 0x87, 0x80, 0x9d, 0x34, 0xc4, 0x00, 0x66, 0x21, 0x46, 0x21, 0xa9, 
-0x21, 0x06, 0x21, 0x00, 0x21, 0x35, 0x41, 0x00, 0x8a, 0x8b, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 
-0x15, 0x10, 0x41, 0x00, 0xdd, 0xdc, 0x11, 0x41, 0x00, 0xfd, 0xfc, 0x1a, 0x41, 0x00, 0xf5, 0xf4, 
-0x21, 0x41, 0x00, 0xf7, 0xf6, 0x27, 0x41, 0x00, 0xf9, 0xf8, 0x28, 0x41, 0x00, 0xf3, 0xf2, 0x29, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x2d, 0x41, 0x00, 0xfb, 0xfa, 0x33, 0x42, 0x04, 0xdf, 0xde, 0xa0, 
-0x34, 0xc4, 0x04, 0x66, 0x21, 0x46, 0x21, 0xa0, 0x21, 0x06, 0x21, 0x00, 0x21, 0x35, 0xc1, 0x00, 
-0xf1, 0x35, 0xf0, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x06, 0x02, 0x03, 
-0x00, 0x00, 0x15, 0x0d, 0x84, 0x03, 0xa0, 0x2d, 0xa0, 0x2d, 0x25, 0x83, 0x18, 0x2d, 0x00, 0x83, 
-0x10, 0x41, 0x00, 0xef, 0x9f, 0x11, 0x41, 0x00, 0xa6, 0x86, 0x12, 0x41, 0x00, 0xa5, 0x85, 0x13, 
-0xc1, 0x00, 0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0x41, 0x00, 0xeb, 0x9b, 
-0x16, 0x41, 0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xa8, 0x88, 0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 
-0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x41, 0x00, 0xea, 0x9a, 0x1b, 0xc4, 0x00, 0xec, 0x11, 0x9c, 0x11, 
-0x7d, 0x11, 0x17, 0x11, 0x00, 0x11, 0x1e, 0x41, 0x00, 0xa0, 0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 
-0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe8, 0x98, 0x22, 0x41, 0x00, 0xa3, 0x83, 0x23, 
-0x41, 0x00, 0xe5, 0x95, 0x24, 0x41, 0x00, 0xa9, 0x89, 0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 
-0x00, 0xab, 0x8b, 0x27, 0x41, 0x00, 0xee, 0x9e, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x2b, 0x84, 0x03, 0xa0, 0x10, 
-0xa0, 0x10, 0x00, 0x10, 0x11, 0x10, 0x00, 0x10, 0x2c, 0x41, 0x00, 0xa7, 0x87, 0x2d, 0x41, 0x00, 
-0xe9, 0x99, 0x2e, 0x41, 0x00, 0xe6, 0x96, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 0x00, 0xa1, 
-0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x41, 0x00, 0xac, 0x8c, 0x33, 0x42, 0x04, 0xe7, 0x97, 
-0xa0, 0x34, 0xc4, 0x04, 0xe4, 0x21, 0x94, 0x21, 0xa0, 0x21, 0x06, 0x21, 0x00, 0x21, 0x35, 0x01, 
-0x03, 0xa0, 0xa0, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0x15, 0x29, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x33, 0x42, 0x03, 0x00, 0x00, 0xf4, 0x34, 0xc4, 0x00, 0x66, 0x21, 0x46, 0x21, 0xf5, 0x21, 0x06, 
-0x21, 0x00, 0x21, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x06, 0x02, 0x03, 0x00, 
-0x00, 0x15, 0x0d, 0x84, 0x03, 0xa0, 0x2d, 0xa0, 0x2d, 0x25, 0x83, 0x18, 0x2d, 0x00, 0x83, 0x10, 
-0x41, 0x00, 0xef, 0x9f, 0x11, 0x41, 0x00, 0xa6, 0x86, 0x12, 0x41, 0x00, 0xa5, 0x85, 0x13, 0xc1, 
-0x00, 0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0x41, 0x00, 0xeb, 0x9b, 0x16, 
-0x41, 0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xa8, 0x88, 0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 
-0x00, 0xaf, 0x8f, 0x1a, 0x41, 0x00, 0xea, 0x9a, 0x1b, 0xc4, 0x00, 0xec, 0x11, 0x9c, 0x11, 0x7d, 
-0x11, 0x17, 0x11, 0x00, 0x11, 0x1e, 0x41, 0x00, 0xa0, 0x80, 0x1f, 0x41, 0x00, 0xe1, 0x91, 0x20, 
-0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe8, 0x98, 0x22, 0x41, 0x00, 0xa3, 0x83, 0x23, 0x41, 
-0x00, 0xe5, 0x95, 0x24, 0x41, 0x00, 0xa9, 0x89, 0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 
-0xab, 0x8b, 0x27, 0x41, 0x00, 0xee, 0x9e, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x2b, 0x84, 0x03, 0xa0, 0x10, 0xa0, 
-0x10, 0x00, 0x10, 0x11, 0x10, 0x00, 0x10, 0x2c, 0x41, 0x00, 0xa7, 0x87, 0x2d, 0x41, 0x00, 0xe9, 
-0x99, 0x2e, 0x41, 0x00, 0xe6, 0x96, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 0x00, 0xa1, 0x81, 
-0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x41, 0x00, 0xac, 0x8c, 0x33, 0x42, 0x00, 0xe7, 0x97, 0xf4, 
-0x34, 0xc4, 0x00, 0xe4, 0x21, 0x94, 0x21, 0xf5, 0x21, 0x06, 0x21, 0x00, 0x21, 0x35, 0xc1, 0x00, 
-0xf1, 0x35, 0xf0, 0x00, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0xbe, 0x10, 0x41, 0x00, 0xdd, 0xdc, 
-0x11, 0x41, 0x00, 0xfd, 0xfc, 0x1a, 0x41, 0x00, 0xf5, 0xf4, 0x21, 0x41, 0x00, 0xf7, 0xf6, 0x27, 
-0x41, 0x00, 0xf9, 0xf8, 0x28, 0x41, 0x00, 0xf3, 0xf2, 0x2d, 0x41, 0x00, 0xfb, 0xfa, 0x33, 0x42, 
-0x00, 0xdf, 0xde, 0xd5, 0x34, 0xc4, 0x00, 0x66, 0x21, 0x46, 0x21, 0xb7, 0x21, 0x06, 0x21, 0x00, 
-0x21, 0x35, 0xc1, 0x00, 0xf1, 0x35, 0xf0, 0x00, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0x15, 0x29, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x33, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x34, 0xc4, 0x04, 0x66, 0x21, 
-0x46, 0x21, 0xa0, 0x21, 0x06, 0x21, 0x00, 0x21, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 0x15, 0x10, 
-0x41, 0x00, 0xdd, 0xdc, 0x11, 0x41, 0x00, 0xfd, 0xfc, 0x12, 0x41, 0x00, 0x65, 0x45, 0x13, 0x41, 
-0x00, 0x72, 0x52, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 
-0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x41, 0x00, 0xf5, 0xf4, 0x1e, 0x41, 0x00, 0x61, 
-0x41, 0x21, 0x41, 0x00, 0xf7, 0xf6, 0x24, 0x41, 0x02, 0x6a, 0x00, 0x26, 0x41, 0x00, 0x6c, 0x4c, 
-0x27, 0x41, 0x00, 0xf9, 0xf8, 0x28, 0x41, 0x00, 0xf3, 0xf2, 0x29, 0x02, 0x07, 0xc8, 0xc9, 0xca, 
-0x2d, 0x41, 0x00, 0xfb, 0xfa, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x32, 0x41, 0x00, 0x6d, 0x4d, 0x33, 
-0x42, 0x00, 0xdf, 0xde, 0xd5, 0x34, 0xc4, 0x00, 0x66, 0x21, 0x46, 0x21, 0xb7, 0x21, 0x06, 0x21, 
-0x00, 0x21, 0x35, 0xc1, 0x00, 0xf1, 0x35, 0xf0, 0x00, 0x00, 0x60, 0x0b, 0x61, 0x83, 0x65, 0xa5, 
-0x69, 0xe9, 0x6f, 0xec, 0x75, 0x88, 0x41, 0xa0, 0x45, 0x8d, 0x49, 0xe8, 0x4f, 0xee, 0x55, 0xad, 
-0x20, 0x60, 0x7e, 0x21, 0x61, 0x86, 0xdd, 0xb5, 0x65, 0x85, 0xf1, 0xd6, 0xf3, 0x8b, 0x69, 0x9f, 
-0xf5, 0xe7, 0x6c, 0xe6, 0x6d, 0xbe, 0x6e, 0xd4, 0x6f, 0xe4, 0x72, 0xaf, 0x75, 0xc6, 0xf9, 0xef, 
-0xfb, 0xb8, 0x79, 0xa4, 0x41, 0x8f, 0xdc, 0xbd, 0x45, 0x95, 0xf0, 0x9c, 0xf2, 0x8a, 0x49, 0xd0, 
-0xf4, 0xe3, 0x4c, 0xa6, 0x4d, 0xa7, 0x4e, 0xa8, 0x4f, 0xe5, 0x52, 0xae, 0x55, 0x9e, 0xf8, 0xab, 
-0xfa, 0xa9, 0x59, 0xa3, 0x20, 0x7e, 0x27, 0x19, 0x61, 0x87, 0xdd, 0x89, 0x65, 0x82, 0xf1, 0xd8, 
-0xf3, 0x9b, 0x69, 0x8c, 0xf5, 0xeb, 0x6f, 0xa2, 0x75, 0x98, 0xf9, 0xac, 0xfb, 0x91, 0x79, 0x93, 
-0x41, 0x80, 0xdc, 0xed, 0x45, 0x90, 0xf0, 0x96, 0xf2, 0x9d, 0x49, 0xa1, 0xf4, 0xea, 0x4f, 0xe0, 
-0x55, 0x97, 0xf8, 0xaa, 0xfa, 0x92, 0x59, 0xe2, 0x20, 0x27, 0x00, 0x06, 0x02, 0x03, 0x00, 0x00, 
-0x15, 0x12, 0x41, 0x00, 0x65, 0x45, 0x13, 0x41, 0x00, 0x72, 0x52, 0x15, 0x41, 0x00, 0x79, 0x59, 
-0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1e, 
-0x41, 0x00, 0x61, 0x41, 0x24, 0x41, 0x02, 0x6a, 0x00, 0x26, 0x41, 0x00, 0x6c, 0x4c, 0x29, 0x02, 
-0x07, 0xc8, 0xc9, 0xca, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x32, 0x41, 0x00, 0x6d, 0x4d, 0x00, 0x60, 
-0x0b, 0x61, 0x83, 0x65, 0xa5, 0x69, 0xe9, 0x6f, 0xec, 0x75, 0x88, 0x41, 0xa0, 0x45, 0x8d, 0x49, 
-0xe8, 0x4f, 0xee, 0x55, 0xad, 0x20, 0x60, 0x7e, 0x21, 0x61, 0x86, 0xd0, 0xf1, 0x65, 0x85, 0xd2, 
-0xfc, 0xd3, 0x8b, 0x69, 0x9f, 0xd4, 0xe7, 0x6c, 0xe6, 0x6d, 0xf5, 0x6e, 0xfb, 0x6f, 0xe4, 0x72, 
-0xaf, 0x75, 0xf6, 0xd6, 0xef, 0xd7, 0xf3, 0x79, 0xa4, 0x41, 0x8f, 0xb5, 0xf4, 0x45, 0x95, 0xb7, 
-0x9c, 0xb8, 0x8a, 0x49, 0xf8, 0xbd, 0xe3, 0x4c, 0xa6, 0x4d, 0xa7, 0x4e, 0xa8, 0x4f, 0xe5, 0x52, 
-0xae, 0x55, 0x9e, 0xc6, 0xab, 0xc7, 0xa9, 0x59, 0xa3, 0x20, 0x7e, 0x27, 0x19, 0x61, 0x87, 0xd0, 
-0x89, 0x65, 0x82, 0xd2, 0xfd, 0xd3, 0x9b, 0x69, 0x8c, 0xd4, 0xeb, 0x6f, 0xa2, 0x75, 0x98, 0xd6, 
-0xac, 0xd7, 0x91, 0x79, 0x93, 0x41, 0x80, 0xb5, 0xed, 0x45, 0x90, 0xb7, 0x96, 0xb8, 0x9d, 0x49, 
-0xa1, 0xbd, 0xea, 0x4f, 0xe0, 0x55, 0x97, 0xc6, 0xaa, 0xc7, 0x92, 0x59, 0xe2, 0x20, 0x27, 0x00, 
-0x06, 0x5a, 0x08, 0x04, 0xc8, 0x01, 0x4c, 0x54, 0x0f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x1b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x23, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x94, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0xd8, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa4, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x71, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xf9, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x84, 0x04, 
-0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x2f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x33, 0x06, 
-0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0xa8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x4f, 0x07, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0xac, 0x03, 0x02, 0x03, 0x00, 0x00, 0xab, 
-0x04, 0x02, 0x03, 0x00, 0x00, 0xf3, 0x05, 0x02, 0x03, 0x00, 0x00, 0x9f, 0x06, 0x02, 0x03, 0x00, 
-0x00, 0x96, 0x07, 0x02, 0x03, 0x00, 0x00, 0xf8, 0x08, 0x02, 0x03, 0x00, 0x00, 0xf5, 0x09, 0x02, 
-0x03, 0x00, 0x00, 0x9e, 0x0a, 0x02, 0x03, 0x00, 0x00, 0xae, 0x0b, 0x02, 0x03, 0x00, 0x00, 0xaf, 
-0x0d, 0x02, 0x03, 0x00, 0x00, 0xf1, 0x10, 0x42, 0x03, 0x00, 0x00, 0xfb, 0x11, 0x42, 0x03, 0x00, 
-0x00, 0xfd, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfc, 0x13, 0x42, 0x03, 0x00, 0x00, 0xa9, 0x1f, 0x42, 
-0x03, 0x00, 0x00, 0xe1, 0x26, 0x42, 0x03, 0x00, 0x00, 0x9c, 0x31, 0x42, 0x03, 0x00, 0x00, 0xaa, 
-0x34, 0x02, 0x03, 0x00, 0x00, 0xfa, 0x35, 0x02, 0x03, 0x00, 0x00, 0xf6, 0x56, 0x02, 0x00, 0xfd, 
-0xfc, 0xfb, 0x00, 0x36, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x79, 0x00, 0x02, 0x01, 0x00, 0x21, 0x31, 
-0x03, 0x01, 0x00, 0x22, 0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 0x01, 0x00, 0x3b, 0x34, 0x06, 
-0x01, 0x00, 0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 0x00, 0x2e, 0x37, 0x09, 0x01, 
-0x00, 0x3f, 0x38, 0x0a, 0x01, 0x00, 0x28, 0x39, 0x0b, 0x01, 0x00, 0x29, 0x30, 0x0d, 0x01, 0x00, 
-0x2b, 0x3d, 0x10, 0x41, 0x00, 0xd0, 0xb5, 0x11, 0x41, 0x00, 0xd8, 0xcf, 0x1a, 0x41, 0x00, 0xd4, 
-0xbd, 0x1b, 0x01, 0x00, 0xf7, 0xf2, 0x27, 0x41, 0x00, 0xd6, 0xc6, 0x28, 0x41, 0x00, 0xd3, 0xb8, 
-0x2a, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x78, 0x2d, 0x41, 0x00, 0xd7, 0xc7, 0x33, 0x41, 0x00, 0xd1, 
-0xb6, 0x34, 0x41, 0x00, 0xd5, 0xbe, 0x35, 0x41, 0x00, 0xd2, 0xb7, 0x00, 0x04, 0x02, 0x03, 0x00, 
-0x00, 0xb8, 0x07, 0x02, 0x03, 0x00, 0x00, 0xd0, 0x08, 0x02, 0x03, 0x00, 0x00, 0xbe, 0x0d, 0x02, 
-0x03, 0x00, 0x00, 0xb5, 0x10, 0x42, 0x03, 0x00, 0x00, 0xd4, 0x11, 0x42, 0x03, 0x00, 0x00, 0xd8, 
-0x12, 0x42, 0x03, 0x00, 0x00, 0xd6, 0x34, 0x02, 0x03, 0x00, 0x00, 0xd3, 0x35, 0x02, 0x03, 0x00, 
-0x00, 0xc6, 0x36, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x7b, 0x56, 0x02, 0x00, 0xd8, 0xd6, 0xd4, 0x00, 
-0x02, 0x01, 0x00, 0x21, 0x31, 0x03, 0x01, 0x00, 0x22, 0x32, 0x04, 0x02, 0x00, 0x2f, 0x33, 0xb8, 
-0x05, 0x01, 0x00, 0x3b, 0x34, 0x06, 0x01, 0x00, 0x3a, 0x35, 0x07, 0x02, 0x00, 0x2c, 0x36, 0xd0, 
-0x08, 0x02, 0x00, 0x2e, 0x37, 0xbe, 0x09, 0x01, 0x00, 0x3f, 0x38, 0x0a, 0x01, 0x00, 0x28, 0x39, 
-0x0b, 0x01, 0x00, 0x29, 0x30, 0x0d, 0x02, 0x00, 0x2b, 0x3d, 0xb5, 0x10, 0x42, 0x00, 0xdd, 0xdc, 
-0xd4, 0x11, 0x42, 0x00, 0xfd, 0xfc, 0xd8, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd6, 0x1a, 0x41, 0x00, 
-0xf5, 0xf4, 0x1b, 0x01, 0x00, 0xd5, 0xb7, 0x27, 0x41, 0x00, 0xf9, 0xf8, 0x28, 0x41, 0x00, 0xf3, 
-0xf2, 0x2a, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x7a, 0x2d, 0x41, 0x00, 0xfb, 0xfa, 0x33, 0x41, 0x00, 
-0xdf, 0xde, 0x34, 0x42, 0x00, 0xf7, 0xf6, 0xd3, 0x35, 0xc2, 0x00, 0xf1, 0x35, 0xf0, 0x00, 0xc6, 
-0x35, 0x56, 0x02, 0x00, 0xd8, 0xd6, 0xd4, 0x00, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x02, 
-0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x03, 0x00, 0x00, 0x9b, 0x08, 0x02, 0x03, 0x00, 0x00, 0x15, 
-0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x10, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x07, 0x00, 
-0x00, 0xa0, 0x13, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x26, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x36, 0x03, 
-0x0f, 0x00, 0x00, 0x00, 0x7d, 0x56, 0x02, 0x07, 0x00, 0xa0, 0xa0, 0x00, 0x02, 0x01, 0x00, 0x21, 
-0x31, 0x03, 0x01, 0x00, 0x22, 0x32, 0x04, 0x02, 0x04, 0x2f, 0x33, 0xa0, 0x05, 0x02, 0x04, 0x3b, 
-0x34, 0xa0, 0x06, 0x02, 0x00, 0x3a, 0x35, 0x9b, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x02, 0x00, 
-0x2e, 0x37, 0x15, 0x09, 0x02, 0x04, 0x3f, 0x38, 0xa0, 0x0a, 0x01, 0x00, 0x28, 0x39, 0x0b, 0x01, 
-0x00, 0x29, 0x30, 0x0d, 0x01, 0x00, 0x2b, 0x3d, 0x10, 0x42, 0x04, 0x85, 0x8f, 0xa0, 0x11, 0x41, 
-0x00, 0x91, 0x92, 0x12, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x13, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x1a, 
-0x41, 0x00, 0x8d, 0xad, 0x1b, 0x01, 0x00, 0x9d, 0xa9, 0x26, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x27, 
-0x41, 0x00, 0x97, 0xa7, 0x28, 0x41, 0x00, 0x82, 0x90, 0x2a, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x7c, 
-0x2d, 0x41, 0x00, 0x96, 0xa6, 0x33, 0x41, 0x00, 0x87, 0x80, 0x34, 0x41, 0x00, 0x9e, 0x9f, 0x35, 
-0x41, 0x00, 0x8a, 0x8b, 0x56, 0x02, 0x07, 0x00, 0xa0, 0xa0, 0x00, 0x04, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x03, 0x00, 0x00, 0x9b, 0x08, 0x02, 0x03, 
-0x00, 0x00, 0x15, 0x09, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x10, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x12, 
-0x42, 0x07, 0x00, 0x00, 0xa0, 0x13, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x36, 0x03, 0x0f, 0x00, 0x00, 
-0x00, 0x7f, 0x56, 0x02, 0x06, 0xfd, 0xa0, 0xa0, 0x00, 0x02, 0x01, 0x00, 0x21, 0x31, 0x03, 0x01, 
-0x00, 0x22, 0x32, 0x04, 0x02, 0x04, 0x2f, 0x33, 0xa0, 0x05, 0x02, 0x04, 0x3b, 0x34, 0xa0, 0x06, 
-0x02, 0x00, 0x3a, 0x35, 0x9b, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x02, 0x00, 0x2e, 0x37, 0x15, 
-0x09, 0x02, 0x04, 0x3f, 0x38, 0xa0, 0x0a, 0x01, 0x00, 0x28, 0x39, 0x0b, 0x01, 0x00, 0x29, 0x30, 
-0x0d, 0x01, 0x00, 0x2b, 0x3d, 0x10, 0x42, 0x04, 0xd0, 0xb5, 0xa0, 0x11, 0x41, 0x00, 0xd8, 0xcf, 
-0x12, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x13, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x1a, 0x41, 0x00, 0xd4, 
-0xbd, 0x1b, 0x10, 0x00, 0x00, 0x27, 0x41, 0x00, 0xd6, 0xc6, 0x28, 0x41, 0x00, 0xd3, 0xb8, 0x2a, 
-0x03, 0x0f, 0x00, 0x00, 0x00, 0x7e, 0x2d, 0x41, 0x00, 0xd7, 0xc7, 0x33, 0x41, 0x00, 0xd1, 0xb6, 
-0x34, 0x41, 0x00, 0xd5, 0xbe, 0x35, 0x41, 0x00, 0xd2, 0xb7, 0x56, 0x02, 0x07, 0x00, 0xa0, 0xa0, 
-0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x03, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x07, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x08, 0x02, 0x03, 0x00, 0x00, 0x15, 0x09, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0d, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x10, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x11, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x12, 
-0x42, 0x07, 0x00, 0x00, 0xa0, 0x13, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x1d, 0x03, 0x0f, 0x00, 0x00, 
-0x00, 0x82, 0x1f, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x26, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x31, 0x42, 
-0x07, 0x00, 0x00, 0xa0, 0x34, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x35, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x36, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x81, 0x56, 0x10, 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x21, 
-0x31, 0xa0, 0x03, 0x02, 0x04, 0x22, 0x32, 0xa0, 0x04, 0x02, 0x04, 0x2f, 0x33, 0xa0, 0x05, 0x02, 
-0x04, 0x3b, 0x34, 0xa0, 0x06, 0x02, 0x04, 0x3a, 0x35, 0xa0, 0x07, 0x02, 0x04, 0x2c, 0x36, 0xa0, 
-0x08, 0x02, 0x00, 0x2e, 0x37, 0x15, 0x09, 0x02, 0x04, 0x3f, 0x38, 0xa0, 0x0a, 0x02, 0x04, 0x28, 
-0x39, 0xa0, 0x0b, 0x02, 0x04, 0x29, 0x30, 0xa0, 0x0d, 0x02, 0x04, 0x2b, 0x3d, 0xa0, 0x10, 0x42, 
-0x04, 0xdd, 0xdc, 0xa0, 0x11, 0x42, 0x04, 0xfd, 0xfc, 0xa0, 0x12, 0x42, 0x07, 0x00, 0x00, 0xa0, 
-0x13, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x1a, 0x41, 0x00, 0xf5, 0xf4, 0x1b, 0x10, 0x00, 0x00, 0x1d, 
-0x03, 0x0f, 0x00, 0x00, 0x00, 0x82, 0x1f, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x26, 0x42, 0x07, 0x00, 
-0x00, 0xa0, 0x27, 0x41, 0x00, 0xf9, 0xf8, 0x28, 0x41, 0x00, 0xf3, 0xf2, 0x2a, 0x03, 0x0f, 0x00, 
-0x00, 0x00, 0x80, 0x2d, 0x41, 0x00, 0xfb, 0xfa, 0x31, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x33, 0x41, 
-0x00, 0xdf, 0xde, 0x34, 0x42, 0x04, 0xf7, 0xf6, 0xa0, 0x35, 0xc2, 0x04, 0xf1, 0x35, 0xf0, 0x00, 
-0xa0, 0x35, 0x56, 0x10, 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x21, 0x31, 0xa0, 0x03, 0x02, 0x04, 
-0x22, 0x32, 0xa0, 0x04, 0x02, 0x04, 0x2f, 0x33, 0xa0, 0x05, 0x02, 0x04, 0x3b, 0x34, 0xa0, 0x06, 
-0x02, 0x04, 0x3a, 0x35, 0xa0, 0x07, 0x02, 0x04, 0x2c, 0x36, 0xa0, 0x08, 0x02, 0x00, 0x2e, 0x37, 
-0x15, 0x09, 0x02, 0x04, 0x3f, 0x38, 0xa0, 0x0a, 0x02, 0x04, 0x28, 0x39, 0xa0, 0x0b, 0x02, 0x04, 
-0x29, 0x30, 0xa0, 0x0d, 0x02, 0x04, 0x2b, 0x3d, 0xa0, 0x10, 0x42, 0x04, 0xef, 0x9f, 0xa0, 0x11, 
-0x42, 0x04, 0xa6, 0x86, 0xa0, 0x12, 0x42, 0x04, 0xa5, 0x85, 0xa0, 0x13, 0xc2, 0x04, 0xe0, 0x00, 
-0x90, 0x13, 0xa0, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0x41, 0x00, 0xeb, 0x9b, 0x16, 0x41, 
-0x00, 0xe3, 0x93, 0x17, 0x41, 0x00, 0xa8, 0x88, 0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 
-0xaf, 0x8f, 0x1a, 0x41, 0x00, 0xea, 0x9a, 0x1b, 0x41, 0x00, 0xec, 0x9c, 0x1e, 0x41, 0x00, 0xa0, 
-0x80, 0x1f, 0x42, 0x04, 0xe1, 0x91, 0xa0, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 
-0x94, 0x22, 0x41, 0x00, 0xa3, 0x83, 0x23, 0x41, 0x00, 0xe5, 0x95, 0x24, 0x41, 0x00, 0xa9, 0x89, 
-0x25, 0x41, 0x00, 0xaa, 0x8a, 0x26, 0x42, 0x04, 0xab, 0x8b, 0xa0, 0x27, 0x41, 0x00, 0xee, 0x9e, 
-0x28, 0x41, 0x00, 0xed, 0x9d, 0x2a, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x80, 0x2c, 0x41, 0x00, 0xa7, 
-0x87, 0x2d, 0x41, 0x00, 0xe9, 0x99, 0x2e, 0x41, 0x00, 0xe6, 0x96, 0x2f, 0x41, 0x00, 0xa2, 0x82, 
-0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x42, 0x04, 0xad, 0x8d, 0xa0, 0x32, 0x41, 0x00, 0xac, 0x8c, 
-0x33, 0x41, 0x00, 0xe7, 0x97, 0x34, 0x42, 0x04, 0xe8, 0x98, 0xa0, 0x35, 0x10, 0x00, 0x00, 0x36, 
-0x03, 0x0f, 0x00, 0x00, 0x00, 0x81, 0x56, 0x10, 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x03, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x02, 0x07, 
-0x00, 0x00, 0xa0, 0x06, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x08, 0x02, 0x03, 0x00, 0x00, 0x15, 0x09, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x0b, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x10, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x07, 
-0x00, 0x00, 0xa0, 0x13, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x1d, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x85, 
-0x1f, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x26, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x31, 0x42, 0x07, 0x00, 
-0x00, 0xa0, 0x36, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x84, 0x56, 0x02, 0x07, 0x00, 0xa0, 0xa0, 0x00, 
-0x02, 0x02, 0x04, 0x21, 0x31, 0xa0, 0x03, 0x02, 0x04, 0x22, 0x32, 0xa0, 0x04, 0x02, 0x04, 0x2f, 
-0x33, 0xa0, 0x05, 0x02, 0x04, 0x3b, 0x34, 0xa0, 0x06, 0x02, 0x04, 0x3a, 0x35, 0xa0, 0x07, 0x01, 
-0x00, 0x2c, 0x36, 0x08, 0x02, 0x00, 0x2e, 0x37, 0x15, 0x09, 0x02, 0x04, 0x3f, 0x38, 0xa0, 0x0a, 
-0x02, 0x04, 0x28, 0x39, 0xa0, 0x0b, 0x02, 0x04, 0x29, 0x30, 0xa0, 0x0d, 0x02, 0x04, 0x2b, 0x3d, 
-0xa0, 0x10, 0x42, 0x04, 0xd0, 0xb5, 0xa0, 0x11, 0x41, 0x00, 0xd8, 0xcf, 0x12, 0x42, 0x07, 0x00, 
-0x00, 0xa0, 0x13, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x1a, 0x41, 0x00, 0xd4, 0xbd, 0x1b, 0x01, 0x00, 
-0xf4, 0xf5, 0x1d, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x85, 0x1f, 0x42, 0x07, 0x00, 0x00, 0xa0, 0x26, 
-0x42, 0x07, 0x00, 0x00, 0xa0, 0x27, 0x41, 0x00, 0xd6, 0xc6, 0x28, 0x41, 0x00, 0xd3, 0xb8, 0x2a, 
-0x03, 0x0f, 0x00, 0x00, 0x00, 0x83, 0x2d, 0x41, 0x00, 0xd7, 0xc7, 0x31, 0x42, 0x07, 0x00, 0x00, 
-0xa0, 0x33, 0x41, 0x00, 0xd1, 0xb6, 0x34, 0x41, 0x00, 0xd5, 0xbe, 0x35, 0x41, 0x00, 0xd2, 0xb7, 
-0x56, 0x02, 0x07, 0x00, 0xa0, 0xa0, 0x00, 0x02, 0x02, 0x04, 0x21, 0x31, 0xa0, 0x03, 0x02, 0x04, 
-0x22, 0x32, 0xa0, 0x04, 0x02, 0x04, 0x2f, 0x33, 0xa0, 0x05, 0x02, 0x04, 0x3b, 0x34, 0xa0, 0x06, 
-0x02, 0x04, 0x3a, 0x35, 0xa0, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x02, 0x00, 0x2e, 0x37, 0x15, 
-0x09, 0x02, 0x04, 0x3f, 0x38, 0xa0, 0x0a, 0x02, 0x04, 0x28, 0x39, 0xa0, 0x0b, 0x02, 0x04, 0x29, 
-0x30, 0xa0, 0x0d, 0x02, 0x04, 0x2b, 0x3d, 0xa0, 0x10, 0x42, 0x04, 0xef, 0x9f, 0xa0, 0x11, 0x41, 
-0x00, 0xa6, 0x86, 0x12, 0x42, 0x04, 0xa5, 0x85, 0xa0, 0x13, 0xc2, 0x04, 0xe0, 0x00, 0x90, 0x13, 
-0xa0, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0x41, 0x00, 0xeb, 0x9b, 0x16, 0x41, 0x00, 0xe3, 
-0x93, 0x17, 0x41, 0x00, 0xa8, 0x88, 0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 0xaf, 0x8f, 
-0x1a, 0x41, 0x00, 0xea, 0x9a, 0x1b, 0x41, 0x00, 0xec, 0x9c, 0x1e, 0x41, 0x00, 0xa0, 0x80, 0x1f, 
-0x42, 0x04, 0xe1, 0x91, 0xa0, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 
-0x41, 0x00, 0xa3, 0x83, 0x23, 0x41, 0x00, 0xe5, 0x95, 0x24, 0x41, 0x00, 0xa9, 0x89, 0x25, 0x41, 
-0x00, 0xaa, 0x8a, 0x26, 0x42, 0x04, 0xab, 0x8b, 0xa0, 0x27, 0x41, 0x00, 0xee, 0x9e, 0x28, 0x41, 
-0x00, 0xed, 0x9d, 0x2a, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x83, 0x2c, 0x41, 0x00, 0xa7, 0x87, 0x2d, 
-0x41, 0x00, 0xe9, 0x99, 0x2e, 0x41, 0x00, 0xe6, 0x96, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 
-0x00, 0xa1, 0x81, 0x31, 0x42, 0x04, 0xad, 0x8d, 0xa0, 0x32, 0x41, 0x00, 0xac, 0x8c, 0x33, 0x41, 
-0x00, 0xe7, 0x97, 0x34, 0x41, 0x00, 0xe8, 0x98, 0x35, 0xc1, 0x00, 0xf1, 0x35, 0xf0, 0x00, 0x36, 
-0x03, 0x0f, 0x00, 0x00, 0x00, 0x84, 0x56, 0x02, 0x07, 0x00, 0xa0, 0xa0, 0x00, 0x80, 0x8a, 0x04, 
-0x04, 0x00, 0x00, 0x4c, 0x56, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x07, 0x03, 0xd1, 0x00, 0x1f, 0x01, 0x00, 0x00, 0x02, 0x03, 0x64, 0x01, 0xce, 0x01, 0x00, 
-0x00, 0x05, 0x03, 0xef, 0x01, 0x3d, 0x02, 0x00, 0x00, 0x5d, 0x04, 0x82, 0x02, 0xd0, 0x02, 0x00, 
-0x00, 0x62, 0xef, 0x15, 0x03, 0x00, 0x00, 0x00, 0x00, 0x62, 0xef, 0xa0, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0xff, 0x03, 
-0x02, 0x03, 0x00, 0x00, 0xae, 0x04, 0x02, 0x03, 0x00, 0x00, 0xaf, 0x09, 0x03, 0x07, 0x00, 0x00, 
-0x00, 0x9e, 0x12, 0x43, 0x00, 0x65, 0x45, 0x89, 0xed, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x43, 
-0x03, 0x00, 0x00, 0x8c, 0xa1, 0x18, 0x43, 0x00, 0x6f, 0x4f, 0xe4, 0xe5, 0x1e, 0x43, 0x00, 0x61, 
-0x41, 0x83, 0xa0, 0x1f, 0x41, 0x00, 0x73, 0x53, 0x22, 0x43, 0x03, 0x00, 0x00, 0x85, 0x95, 0x28, 
-0x03, 0x0f, 0x00, 0x00, 0xca, 0xcb, 0x29, 0x02, 0x03, 0x00, 0xc9, 0x2d, 0x2b, 0x02, 0x01, 0xc8, 
-0x7c, 0x5c, 0x2c, 0x41, 0x00, 0x7a, 0x5a, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x31, 0x41, 0x00, 0x6e, 
-0x4e, 0x39, 0x00, 0x00, 0x20, 0x00, 0x05, 0x03, 0x07, 0x00, 0x00, 0x00, 0xf5, 0x06, 0x03, 0x07, 
-0x00, 0x00, 0x00, 0xf8, 0x08, 0x03, 0x07, 0x00, 0x00, 0x00, 0xf1, 0x13, 0x43, 0x03, 0x00, 0x00, 
-0x8b, 0x8a, 0x16, 0x43, 0x03, 0x00, 0x00, 0xd7, 0xc7, 0x1f, 0x43, 0x03, 0x00, 0x00, 0xd5, 0xbe, 
-0x25, 0x43, 0x03, 0x00, 0x00, 0xe9, 0xe8, 0x26, 0x43, 0x03, 0x00, 0x00, 0xeb, 0xea, 0x2c, 0x43, 
-0x03, 0x00, 0x00, 0xd8, 0xcf, 0x2e, 0x43, 0x03, 0x00, 0x00, 0xd1, 0xb6, 0x31, 0x43, 0x03, 0x00, 
-0x00, 0xec, 0xee, 0x00, 0xf8, 0x07, 0x61, 0x86, 0x65, 0xd3, 0x7a, 0xa4, 0x41, 0x8f, 0x45, 0xb8, 
-0x5a, 0xa3, 0x20, 0xf8, 0x7e, 0x03, 0x6f, 0xe4, 0x4f, 0xe5, 0x20, 0x7e, 0xef, 0x0d, 0x63, 0x87, 
-0x65, 0x82, 0x6e, 0xe7, 0x6f, 0xa2, 0x73, 0x98, 0x7a, 0xa5, 0x43, 0x80, 0x45, 0x90, 0x4e, 0xe3, 
-0x4f, 0xe0, 0x53, 0x97, 0x5a, 0x8d, 0x20, 0xef, 0x22, 0x07, 0x61, 0x84, 0x6f, 0x94, 0x75, 0x81, 
-0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x00, 0x05, 0x03, 0x07, 0x00, 0x00, 0x00, 0x15, 
-0x06, 0x03, 0x07, 0x00, 0x00, 0x00, 0xf8, 0x08, 0x03, 0x07, 0x00, 0x00, 0x00, 0xf1, 0x09, 0x03, 
-0x0f, 0x00, 0x00, 0x00, 0xa0, 0x12, 0x43, 0x03, 0x00, 0x00, 0x88, 0x89, 0x16, 0x43, 0x03, 0x00, 
-0x00, 0x96, 0xa6, 0x18, 0x43, 0x03, 0x00, 0x00, 0x93, 0x95, 0x1f, 0x43, 0x03, 0x00, 0x00, 0x9e, 
-0x9f, 0x22, 0x43, 0x03, 0x00, 0x00, 0x98, 0xa8, 0x25, 0x43, 0x03, 0x00, 0x00, 0xa2, 0xa3, 0x26, 
-0x43, 0x03, 0x00, 0x00, 0x86, 0x9c, 0x28, 0x03, 0x0f, 0x00, 0x00, 0xa0, 0xca, 0x2c, 0x43, 0x03, 
-0x00, 0x00, 0x91, 0x92, 0x2e, 0x43, 0x03, 0x00, 0x00, 0x87, 0x80, 0x31, 0x43, 0x03, 0x00, 0x00, 
-0xa4, 0xa5, 0x00, 0xfa, 0x03, 0x65, 0x82, 0x45, 0x90, 0x20, 0xfa, 0x7e, 0x03, 0x6f, 0x93, 0x4f, 
-0x95, 0x20, 0x7e, 0x22, 0x07, 0x61, 0x84, 0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 0x4f, 0x99, 0x55, 
-0x9a, 0x20, 0x22, 0x00, 0x05, 0x03, 0x07, 0x00, 0x00, 0x00, 0xbe, 0x06, 0x03, 0x07, 0x00, 0x00, 
-0x00, 0xd0, 0x08, 0x03, 0x07, 0x00, 0x00, 0x00, 0xb5, 0x13, 0x43, 0x03, 0x00, 0x00, 0x8b, 0x8a, 
-0x16, 0x43, 0x03, 0x00, 0x00, 0xfb, 0xfa, 0x1f, 0x43, 0x03, 0x00, 0x00, 0xf7, 0xf6, 0x25, 0x43, 
-0x03, 0x00, 0x00, 0xe9, 0xe8, 0x26, 0x43, 0x03, 0x00, 0x00, 0xeb, 0xea, 0x2c, 0x43, 0x03, 0x00, 
-0x00, 0xfd, 0xfc, 0x2e, 0x43, 0x03, 0x00, 0x00, 0xdf, 0xde, 0x31, 0x43, 0x03, 0x00, 0x00, 0xec, 
-0xee, 0x00, 0xd3, 0x07, 0x61, 0x86, 0x65, 0xf3, 0x7a, 0xa4, 0x41, 0x8f, 0x45, 0xf2, 0x5a, 0xa3, 
-0x20, 0xd3, 0x7e, 0x03, 0x6f, 0xe4, 0x4f, 0xe5, 0x20, 0x7e, 0xef, 0x0d, 0x63, 0x87, 0x65, 0x82, 
-0x6e, 0xe7, 0x6f, 0xa2, 0x73, 0x98, 0x7a, 0xa5, 0x43, 0x80, 0x45, 0x90, 0x4e, 0xe3, 0x4f, 0xe0, 
-0x53, 0x97, 0x5a, 0x8d, 0x20, 0xef, 0x22, 0x07, 0x61, 0x84, 0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 
-0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x00, 0x05, 0x03, 0x07, 0x00, 0x00, 0x00, 0x15, 0x06, 0x03, 
-0x07, 0x00, 0x00, 0x00, 0xf8, 0x08, 0x03, 0x07, 0x00, 0x00, 0x00, 0xf1, 0x13, 0x43, 0x03, 0x00, 
-0x00, 0xfb, 0xfc, 0x16, 0x43, 0x03, 0x00, 0x00, 0x96, 0xea, 0x1f, 0x43, 0x03, 0x00, 0x00, 0xe7, 
-0xe6, 0x25, 0x43, 0x03, 0x00, 0x00, 0xe9, 0xe8, 0x26, 0x43, 0x03, 0x00, 0x00, 0xec, 0x9c, 0x2c, 
-0x43, 0x03, 0x00, 0x00, 0xa7, 0xa6, 0x2e, 0x43, 0x03, 0x00, 0x00, 0x9f, 0xac, 0x31, 0x43, 0x03, 
-0x00, 0x00, 0xef, 0xee, 0x00, 0xf8, 0x07, 0x61, 0x86, 0x65, 0x8a, 0x7a, 0x92, 0x41, 0x8f, 0x45, 
-0xaa, 0x5a, 0x91, 0x20, 0xf8, 0x7e, 0x03, 0x6f, 0xe4, 0x4f, 0xe5, 0x20, 0x7e, 0x27, 0x0d, 0x63, 
-0x87, 0x65, 0x82, 0x6e, 0x9b, 0x6f, 0xa2, 0x73, 0x98, 0x7a, 0xab, 0x43, 0x80, 0x45, 0x90, 0x4e, 
-0xe3, 0x4f, 0xe0, 0x53, 0x97, 0x5a, 0x8d, 0x20, 0x27, 0x22, 0x07, 0x61, 0x84, 0x6f, 0x94, 0x75, 
-0x81, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x00, 0x03, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x04, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x05, 0x03, 0x07, 0x00, 0x00, 0x00, 0x15, 0x09, 0x03, 0x0f, 
-0x00, 0x00, 0x00, 0xa0, 0x12, 0xc3, 0x00, 0x65, 0x12, 0x45, 0x12, 0xf1, 0x12, 0xf0, 0x00, 0x16, 
-0x43, 0x03, 0x00, 0x00, 0xdd, 0xde, 0x17, 0x43, 0x03, 0x00, 0x00, 0xd8, 0xd7, 0x18, 0x43, 0x0f, 
-0x00, 0x00, 0xa0, 0xa0, 0x1e, 0x43, 0x03, 0x00, 0x00, 0xc6, 0xb5, 0x1f, 0x43, 0x03, 0x00, 0x00, 
-0xfd, 0xd0, 0x22, 0x43, 0x03, 0x00, 0x00, 0xd6, 0xf2, 0x25, 0x43, 0x03, 0x00, 0x00, 0xf3, 0xf4, 
-0x26, 0x43, 0x03, 0x00, 0x00, 0xf5, 0xf6, 0x28, 0x03, 0x0f, 0x00, 0x00, 0xa0, 0xa0, 0x29, 0x01, 
-0x01, 0x00, 0x7e, 0x2b, 0x00, 0x01, 0xa0, 0x2c, 0x43, 0x03, 0x00, 0x00, 0xf7, 0xf8, 0x2e, 0x43, 
-0x03, 0x00, 0x00, 0xd2, 0xd3, 0x31, 0x43, 0x03, 0x00, 0x00, 0xb7, 0xfc, 0x36, 0x04, 0x1f, 0x00, 
-0x00, 0x00, 0x00, 0x7d, 0x00, 0x03, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x04, 0x02, 0x07, 0x00, 0x00, 
-0xa0, 0x05, 0x03, 0x07, 0x00, 0x00, 0x00, 0x15, 0x09, 0x03, 0x0f, 0x00, 0x00, 0x00, 0xa0, 0x10, 
-0x41, 0x00, 0xef, 0x9f, 0x11, 0x41, 0x00, 0xe8, 0x98, 0x12, 0x43, 0x0c, 0xa5, 0x85, 0xa0, 0xa0, 
-0x13, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0x41, 0x00, 0xeb, 
-0x9b, 0x16, 0x41, 0x00, 0xe3, 0x93, 0x17, 0x43, 0x0c, 0xa8, 0x88, 0xa0, 0xa0, 0x18, 0x43, 0x0c, 
-0xae, 0x8e, 0xa0, 0xa0, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 0x43, 0x00, 0xed, 0x9d, 0x5b, 0x7b, 
-0x1b, 0x43, 0x00, 0xee, 0x9e, 0x5d, 0x7d, 0x1e, 0x43, 0x0c, 0xa0, 0x80, 0xa0, 0xa0, 0x1f, 0x41, 
-0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 0x43, 0x0c, 
-0xa3, 0x83, 0xa0, 0xa0, 0x23, 0x41, 0x00, 0xe5, 0x95, 0x24, 0x41, 0x00, 0xa9, 0x89, 0x25, 0x41, 
-0x00, 0xaa, 0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x27, 0x41, 0x00, 0xe7, 0x97, 0x28, 0x43, 0x00, 
-0xec, 0x9c, 0x27, 0x22, 0x29, 0x43, 0x00, 0xea, 0x9a, 0x60, 0x7e, 0x2a, 0x04, 0x1f, 0x00, 0x00, 
-0x00, 0x00, 0x7c, 0x2b, 0x43, 0x00, 0xe9, 0x99, 0x5c, 0x7c, 0x2c, 0x41, 0x00, 0xa7, 0x87, 0x2d, 
-0x41, 0x00, 0xa6, 0x86, 0x2e, 0x41, 0x00, 0xe6, 0x96, 0x2f, 0x41, 0x00, 0xa2, 0x82, 0x30, 0x41, 
-0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x41, 0x00, 0xac, 0x8c, 0x33, 0x02, 0x03, 
-0x00, 0x00, 0x3b, 0x34, 0x02, 0x03, 0x00, 0x00, 0x3a, 0x00, 0x0c, 0xfd, 0x05, 0x04, 0xc7, 0x01, 
-0x4c, 0x56, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 
-0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 
-0x7a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x88, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 
-0x5e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x6b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x04, 
-0x4a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x04, 0x58, 0x03, 0x00, 0x00, 0x00, 0x00, 0x62, 0xef, 
-0x37, 0x04, 0x00, 0x00, 0x00, 0x00, 0x62, 0xef, 0x51, 0x04, 0x00, 0x00, 0x00, 0x00, 0x62, 0xef, 
-0x27, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x01, 
-0x00, 0xf8, 0xa7, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x03, 0x01, 0x01, 
-0x00, 0xae, 0x04, 0x01, 0x01, 0x00, 0xaf, 0x05, 0x01, 0x01, 0x00, 0xf5, 0x07, 0x01, 0x01, 0x00, 
-0x2f, 0x09, 0x01, 0x01, 0x00, 0x9e, 0x0d, 0x41, 0x00, 0x66, 0x46, 0x10, 0x41, 0x00, 0xd7, 0xc7, 
-0x11, 0x41, 0x00, 0x67, 0x47, 0x12, 0x41, 0x00, 0x6a, 0x4a, 0x13, 0x43, 0x03, 0x00, 0x00, 0x8b, 
-0x8a, 0x14, 0x41, 0x00, 0x6d, 0x4d, 0x15, 0x41, 0x00, 0x76, 0x56, 0x16, 0x41, 0x00, 0x6e, 0x4e, 
-0x17, 0x41, 0x00, 0x7a, 0x5a, 0x18, 0x41, 0x00, 0x89, 0xed, 0x19, 0x41, 0x00, 0xd1, 0xb6, 0x1a, 
-0x41, 0x00, 0xd8, 0xcf, 0x1b, 0x41, 0x00, 0x68, 0x48, 0x1e, 0x41, 0x00, 0xd5, 0xbe, 0x1f, 0x41, 
-0x00, 0x75, 0x55, 0x20, 0x41, 0x00, 0x73, 0x53, 0x21, 0x41, 0x00, 0x69, 0x49, 0x22, 0x41, 0x00, 
-0x6c, 0x4c, 0x23, 0x41, 0x00, 0x64, 0x44, 0x24, 0x41, 0x00, 0x61, 0x41, 0x25, 0x41, 0x00, 0x74, 
-0x54, 0x26, 0x41, 0x00, 0x65, 0x45, 0x27, 0x41, 0x00, 0x63, 0x43, 0x28, 0x01, 0x00, 0x27, 0xf8, 
-0x29, 0x01, 0x00, 0x2d, 0x3f, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 0x41, 0x00, 
-0xe9, 0xe8, 0x2c, 0x41, 0x00, 0xec, 0xee, 0x2d, 0x41, 0x00, 0x62, 0x42, 0x2e, 0x41, 0x00, 0x8c, 
-0xa1, 0x2f, 0x41, 0x00, 0x6b, 0x4b, 0x30, 0x41, 0x00, 0x70, 0x50, 0x31, 0x43, 0x00, 0x6f, 0x4f, 
-0x93, 0xe2, 0x32, 0x41, 0x00, 0x83, 0xa0, 0x33, 0x01, 0x01, 0x00, 0x3b, 0x34, 0x01, 0x01, 0x00, 
-0x3a, 0x35, 0x41, 0x00, 0xeb, 0xea, 0x56, 0x41, 0x00, 0x85, 0x95, 0x00, 0x2b, 0x01, 0x03, 0x00, 
-0xa0, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x03, 0x01, 0x01, 0x00, 0xae, 0x04, 
-0x01, 0x01, 0x00, 0xaf, 0x05, 0x01, 0x01, 0x00, 0x15, 0x07, 0x01, 0x01, 0x00, 0x2f, 0x09, 0x01, 
-0x03, 0x00, 0xa0, 0x0d, 0x41, 0x00, 0x66, 0x46, 0x10, 0x41, 0x00, 0x96, 0xa6, 0x11, 0x41, 0x00, 
-0x67, 0x47, 0x12, 0x41, 0x00, 0x6a, 0x4a, 0x14, 0x41, 0x00, 0x6d, 0x4d, 0x15, 0x41, 0x00, 0x76, 
-0x56, 0x16, 0x41, 0x00, 0x6e, 0x4e, 0x17, 0x41, 0x00, 0x7a, 0x5a, 0x18, 0x41, 0x00, 0x88, 0x89, 
-0x19, 0x41, 0x00, 0x87, 0x80, 0x1a, 0x41, 0x00, 0x91, 0x92, 0x1b, 0x41, 0x00, 0x68, 0x48, 0x1e, 
-0x41, 0x00, 0x9e, 0x9f, 0x1f, 0x41, 0x00, 0x75, 0x55, 0x20, 0x41, 0x00, 0x73, 0x53, 0x21, 0x41, 
-0x00, 0x69, 0x49, 0x22, 0x41, 0x00, 0x6c, 0x4c, 0x23, 0x41, 0x00, 0x64, 0x44, 0x24, 0x41, 0x00, 
-0x61, 0x41, 0x25, 0x41, 0x00, 0x74, 0x54, 0x26, 0x41, 0x00, 0x65, 0x45, 0x27, 0x41, 0x00, 0x63, 
-0x43, 0x28, 0x01, 0x00, 0x27, 0xf8, 0x29, 0x01, 0x00, 0x2d, 0x3f, 0x2a, 0x04, 0x1f, 0x00, 0x00, 
-0x00, 0x00, 0x7a, 0x2b, 0x41, 0x00, 0xa2, 0xa3, 0x2c, 0x41, 0x00, 0xa4, 0xa5, 0x2d, 0x41, 0x00, 
-0x62, 0x42, 0x2e, 0x41, 0x00, 0x8c, 0xa1, 0x2f, 0x41, 0x00, 0x6b, 0x4b, 0x30, 0x41, 0x00, 0x70, 
-0x50, 0x31, 0x41, 0x00, 0x6f, 0x4f, 0x32, 0x41, 0x00, 0x83, 0xa0, 0x33, 0x01, 0x01, 0x00, 0x3b, 
-0x34, 0x01, 0x01, 0x00, 0x3a, 0x35, 0x41, 0x00, 0x86, 0x9c, 0x56, 0x41, 0x00, 0x98, 0xa8, 0x00, 
-0x2b, 0x00, 0x00, 0xd0, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x03, 0x01, 0x01, 
-0x00, 0xae, 0x04, 0x01, 0x01, 0x00, 0xaf, 0x05, 0x01, 0x01, 0x00, 0xbe, 0x07, 0x01, 0x01, 0x00, 
-0x2f, 0x09, 0x01, 0x01, 0x00, 0x9e, 0x0d, 0x41, 0x00, 0x66, 0x46, 0x10, 0x41, 0x00, 0xfb, 0xfa, 
-0x11, 0x41, 0x00, 0x67, 0x47, 0x12, 0x41, 0x00, 0x6a, 0x4a, 0x13, 0x43, 0x03, 0x00, 0x00, 0x8b, 
-0x8a, 0x14, 0x41, 0x00, 0x6d, 0x4d, 0x15, 0x41, 0x00, 0x76, 0x56, 0x16, 0x41, 0x00, 0x6e, 0x4e, 
-0x17, 0x41, 0x00, 0x7a, 0x5a, 0x18, 0x41, 0x00, 0x89, 0xed, 0x19, 0x41, 0x00, 0xdf, 0xde, 0x1a, 
-0x41, 0x00, 0xfd, 0xfc, 0x1b, 0x41, 0x00, 0x68, 0x48, 0x1e, 0x41, 0x00, 0xf7, 0xf6, 0x1f, 0x41, 
-0x00, 0x75, 0x55, 0x20, 0x41, 0x00, 0x73, 0x53, 0x21, 0x41, 0x00, 0x69, 0x49, 0x22, 0x41, 0x00, 
-0x6c, 0x4c, 0x23, 0x41, 0x00, 0x64, 0x44, 0x24, 0x41, 0x00, 0x61, 0x41, 0x25, 0x41, 0x00, 0x74, 
-0x54, 0x26, 0x41, 0x00, 0x65, 0x45, 0x27, 0x41, 0x00, 0x63, 0x43, 0x28, 0x01, 0x00, 0x27, 0xd0, 
-0x29, 0x01, 0x00, 0x2d, 0x3f, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x2b, 0x41, 0x00, 
-0xe9, 0xe8, 0x2c, 0x41, 0x00, 0xec, 0xee, 0x2d, 0x41, 0x00, 0x62, 0x42, 0x2e, 0x41, 0x00, 0x8c, 
-0xa1, 0x2f, 0x41, 0x00, 0x6b, 0x4b, 0x30, 0x41, 0x00, 0x70, 0x50, 0x31, 0x43, 0x00, 0x6f, 0x4f, 
-0x93, 0xe2, 0x32, 0x41, 0x00, 0x83, 0xa0, 0x33, 0x01, 0x01, 0x00, 0x3b, 0x34, 0x01, 0x01, 0x00, 
-0x3a, 0x35, 0x41, 0x00, 0xeb, 0xea, 0x56, 0x41, 0x00, 0x85, 0x95, 0x00, 0x2b, 0x01, 0x03, 0x00, 
-0xa0, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x03, 0x01, 0x01, 0x00, 0xae, 0x04, 
-0x01, 0x01, 0x00, 0xaf, 0x05, 0x01, 0x01, 0x00, 0x15, 0x07, 0x01, 0x01, 0x00, 0x2f, 0x09, 0x01, 
-0x01, 0x00, 0x9e, 0x0d, 0x41, 0x00, 0x66, 0x46, 0x10, 0x41, 0x00, 0x96, 0xea, 0x11, 0x41, 0x00, 
-0x67, 0x47, 0x12, 0x41, 0x00, 0x6a, 0x4a, 0x13, 0x43, 0x00, 0x72, 0x52, 0xfb, 0xfc, 0x14, 0x41, 
-0x00, 0x6d, 0x4d, 0x15, 0x41, 0x00, 0x76, 0x56, 0x16, 0x41, 0x00, 0x6e, 0x4e, 0x17, 0x41, 0x00, 
-0x7a, 0x5a, 0x18, 0x41, 0x00, 0x89, 0xed, 0x19, 0x41, 0x00, 0x9f, 0xac, 0x1a, 0x41, 0x00, 0xa7, 
-0xa6, 0x1b, 0x41, 0x00, 0x68, 0x48, 0x1e, 0x41, 0x00, 0xe7, 0xe6, 0x1f, 0x41, 0x00, 0x75, 0x55, 
-0x20, 0x41, 0x00, 0x73, 0x53, 0x21, 0x41, 0x00, 0x69, 0x49, 0x22, 0x41, 0x00, 0x6c, 0x4c, 0x23, 
-0x41, 0x00, 0x64, 0x44, 0x24, 0x41, 0x00, 0x61, 0x41, 0x25, 0x41, 0x00, 0x74, 0x54, 0x26, 0x41, 
-0x00, 0x65, 0x45, 0x27, 0x41, 0x00, 0x63, 0x43, 0x28, 0x01, 0x00, 0x27, 0xf8, 0x29, 0x01, 0x00, 
-0x2d, 0x3f, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x2b, 0x41, 0x00, 0xe9, 0xe8, 0x2c, 
-0x41, 0x00, 0xef, 0xee, 0x2d, 0x41, 0x00, 0x62, 0x42, 0x2e, 0x41, 0x00, 0x8c, 0xa1, 0x2f, 0x41, 
-0x00, 0x6b, 0x4b, 0x30, 0x41, 0x00, 0x70, 0x50, 0x31, 0x43, 0x00, 0x6f, 0x4f, 0x93, 0xe2, 0x32, 
-0x41, 0x00, 0x83, 0xa0, 0x33, 0x01, 0x01, 0x00, 0x3b, 0x34, 0x01, 0x01, 0x00, 0x3a, 0x35, 0x41, 
-0x00, 0xec, 0x9c, 0x56, 0x41, 0x00, 0x85, 0x95, 0x00, 0x1d, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 
-0x82, 0x28, 0x01, 0x03, 0x00, 0xa0, 0x2b, 0x10, 0x00, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x81, 0x00, 0x05, 0x01, 0x01, 0x00, 0x15, 0x07, 0x01, 0x01, 0x00, 0x2f, 0x0d, 0x41, 0x00, 
-0x66, 0x46, 0x10, 0x41, 0x00, 0xdd, 0xde, 0x11, 0x41, 0x00, 0x67, 0x47, 0x12, 0x41, 0x00, 0x6a, 
-0x4a, 0x13, 0x41, 0x00, 0x72, 0x52, 0x14, 0x41, 0x00, 0x6d, 0x4d, 0x15, 0x41, 0x00, 0x76, 0x56, 
-0x16, 0x41, 0x00, 0x6e, 0x4e, 0x17, 0x41, 0x00, 0x7a, 0x5a, 0x18, 0xc1, 0x00, 0xf1, 0x18, 0xf0, 
-0x00, 0x19, 0x41, 0x00, 0xd2, 0xd3, 0x1a, 0x41, 0x00, 0xf7, 0xf8, 0x1b, 0x41, 0x00, 0x68, 0x48, 
-0x1d, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x82, 0x1e, 0x41, 0x00, 0xfd, 0xd0, 0x1f, 0x41, 0x00, 
-0x75, 0x55, 0x20, 0x41, 0x00, 0x73, 0x53, 0x21, 0x41, 0x00, 0x69, 0x49, 0x22, 0x41, 0x00, 0x6c, 
-0x4c, 0x23, 0x41, 0x00, 0x64, 0x44, 0x24, 0x41, 0x00, 0x61, 0x41, 0x25, 0x41, 0x00, 0x74, 0x54, 
-0x26, 0x41, 0x00, 0x65, 0x45, 0x27, 0x41, 0x00, 0x63, 0x43, 0x28, 0x01, 0x03, 0x00, 0xa0, 0x29, 
-0x01, 0x00, 0x2d, 0x3f, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2b, 0x41, 0x00, 0xf3, 
-0xf4, 0x2c, 0x41, 0x00, 0xb7, 0xfc, 0x2d, 0x41, 0x00, 0x62, 0x42, 0x2e, 0x41, 0x00, 0xd8, 0xd7, 
-0x2f, 0x41, 0x00, 0x6b, 0x4b, 0x30, 0x41, 0x00, 0x70, 0x50, 0x31, 0x41, 0x00, 0x6f, 0x4f, 0x32, 
-0x41, 0x00, 0xc6, 0xb5, 0x33, 0x01, 0x01, 0x00, 0x3b, 0x34, 0x01, 0x01, 0x00, 0x3a, 0x35, 0x41, 
-0x00, 0xf5, 0xf6, 0x56, 0x41, 0x00, 0xd6, 0xf2, 0x00, 0x05, 0x01, 0x01, 0x00, 0x15, 0x07, 0x01, 
-0x01, 0x00, 0x2f, 0x0d, 0x41, 0x00, 0xe4, 0x94, 0x10, 0x41, 0x00, 0xee, 0x9e, 0x11, 0x41, 0x00, 
-0xa3, 0x83, 0x12, 0x41, 0x00, 0xa9, 0x89, 0x13, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x13, 0x14, 0x41, 
-0x00, 0xac, 0x8c, 0x15, 0x41, 0x00, 0xa2, 0x82, 0x16, 0x41, 0x00, 0xad, 0x8d, 0x17, 0x41, 0x00, 
-0xa7, 0x87, 0x18, 0x41, 0x00, 0xed, 0x9d, 0x19, 0x41, 0x00, 0xe7, 0x97, 0x1a, 0x41, 0x00, 0xa6, 
-0x86, 0x1b, 0x41, 0x00, 0xe5, 0x95, 0x1e, 0x41, 0x00, 0xe8, 0x98, 0x1f, 0x41, 0x00, 0xe3, 0x93, 
-0x20, 0x41, 0x00, 0xe1, 0x91, 0x21, 0x41, 0x00, 0xa8, 0x88, 0x22, 0x41, 0x00, 0xab, 0x8b, 0x23, 
-0x41, 0x00, 0xa4, 0x84, 0x24, 0x41, 0x00, 0xa0, 0x80, 0x25, 0x41, 0x00, 0xe2, 0x92, 0x26, 0x41, 
-0x00, 0xa5, 0x85, 0x27, 0x41, 0x00, 0xe6, 0x96, 0x28, 0x01, 0x03, 0x00, 0xa0, 0x29, 0x01, 0x00, 
-0x2d, 0x3f, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2b, 0x41, 0x00, 0xea, 0x9a, 0x2c, 
-0x41, 0x00, 0xe9, 0x99, 0x2d, 0x41, 0x00, 0xa1, 0x81, 0x2e, 0x41, 0x00, 0xeb, 0x9b, 0x2f, 0x41, 
-0x00, 0xaa, 0x8a, 0x30, 0x41, 0x00, 0xaf, 0x8f, 0x31, 0x41, 0x00, 0xae, 0x8e, 0x32, 0x41, 0x00, 
-0xef, 0x9f, 0x33, 0x01, 0x01, 0x00, 0x3b, 0x34, 0x01, 0x01, 0x00, 0x3a, 0x35, 0x41, 0x00, 0xec, 
-0x9c, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0xec, 0x67, 0x03, 0x09, 0x00, 0x00, 
-0x4d, 0x4b, 0x2c, 0xc1, 0x01, 0x4d, 0x4b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x68, 0x03, 0xeb, 0x01, 0x00, 0x00, 0x00, 0x00, 0x68, 0x03, 0x2c, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x57, 0x03, 0x4e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x90, 0x02, 0x00, 
-0x00, 0x00, 0x00, 0x5a, 0x03, 0x25, 0x01, 0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x39, 0x75, 0x00, 0x02, 0x53, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 
-0x7e, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x04, 0x09, 0x00, 0x23, 0x5e, 0x00, 0x1e, 0x07, 0x01, 
-0x01, 0x00, 0x26, 0x08, 0x02, 0x01, 0x00, 0x2f, 0x60, 0x09, 0x01, 0x01, 0x00, 0x28, 0x0a, 0x01, 
-0x01, 0x00, 0x29, 0x0b, 0x01, 0x01, 0x00, 0x3d, 0x0c, 0x01, 0x00, 0x27, 0x3f, 0x0d, 0x01, 0x00, 
-0x2b, 0x2a, 0x10, 0x42, 0x03, 0x00, 0x00, 0x5c, 0x11, 0x42, 0x03, 0x00, 0x00, 0x7c, 0x15, 0xc5, 
-0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x21, 0x42, 0x03, 
-0x00, 0x00, 0x5b, 0x22, 0x42, 0x03, 0x00, 0x00, 0x5d, 0x27, 0x04, 0x0c, 0x5e, 0x5e, 0x00, 0x00, 
-0x1e, 0x28, 0x01, 0x00, 0xf5, 0xf5, 0x29, 0x04, 0x0c, 0x5c, 0x7c, 0x00, 0x00, 0x1c, 0x2b, 0x01, 
-0x00, 0x40, 0x40, 0x2c, 0xc5, 0x00, 0x79, 0x15, 0x59, 0x15, 0x00, 0x15, 0x00, 0x15, 0x19, 0x15, 
-0x00, 0x15, 0x2f, 0x42, 0x03, 0x00, 0x00, 0x40, 0x30, 0x42, 0x03, 0x00, 0x00, 0x7b, 0x31, 0x42, 
-0x03, 0x00, 0x00, 0x7d, 0x33, 0x01, 0x00, 0x2c, 0x3b, 0x34, 0x01, 0x00, 0x2e, 0x3a, 0x35, 0x04, 
-0x0c, 0x2d, 0x5f, 0x00, 0x00, 0x1f, 0x56, 0x01, 0x00, 0x3c, 0x3e, 0x00, 0x12, 0x42, 0x03, 0x00, 
-0x00, 0xd5, 0x00, 0x10, 0x41, 0x00, 0x90, 0x91, 0x11, 0x41, 0x00, 0x92, 0x93, 0x12, 0x42, 0x00, 
-0xa8, 0xa9, 0xcf, 0x13, 0x41, 0x00, 0xe1, 0xe2, 0x14, 0x41, 0x00, 0xe5, 0xe6, 0x15, 0xc5, 0x00, 
-0xf3, 0x2c, 0xf4, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0xe7, 
-0xe8, 0x17, 0x41, 0x00, 0xb7, 0xb8, 0x18, 0x41, 0x00, 0xd6, 0xd7, 0x19, 0x41, 0x00, 0xd8, 0xdd, 
-0x1a, 0x42, 0x00, 0xf5, 0xf6, 0x81, 0x1b, 0x42, 0x00, 0x82, 0x83, 0x80, 0x1e, 0x41, 0x00, 0xa0, 
-0xa1, 0x1f, 0x41, 0x00, 0xe3, 0xe4, 0x20, 0x41, 0x00, 0xa6, 0xa7, 0x21, 0x41, 0x00, 0xaa, 0xab, 
-0x22, 0x41, 0x00, 0xac, 0xad, 0x23, 0x41, 0x00, 0xb5, 0xb6, 0x24, 0x41, 0x00, 0x8e, 0x8f, 0x25, 
-0x41, 0x00, 0xc6, 0xc7, 0x26, 0x41, 0x00, 0xd0, 0xd1, 0x27, 0x42, 0x00, 0xfb, 0xfc, 0x95, 0x28, 
-0x42, 0x00, 0x96, 0x97, 0x94, 0x2a, 0x05, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 0x41, 
-0x00, 0xe9, 0xea, 0x2c, 0xc5, 0x00, 0x88, 0x15, 0x89, 0x15, 0x00, 0x15, 0x00, 0x15, 0x19, 0x15, 
-0x00, 0x15, 0x2d, 0x41, 0x00, 0x9a, 0x9b, 0x2e, 0x41, 0x00, 0xa4, 0xa5, 0x2f, 0x41, 0x00, 0xeb, 
-0xec, 0x30, 0x41, 0x00, 0xa2, 0xa3, 0x31, 0x41, 0x00, 0xd4, 0xd5, 0x32, 0x42, 0x00, 0xd2, 0xd3, 
-0xfd, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xcf, 0x28, 0x01, 0x00, 0xfd, 0xfd, 0x36, 0x05, 0x3f, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x03, 0x01, 0x03, 0x00, 0xc8, 0x0c, 0x00, 0x01, 0xc9, 
-0x12, 0x42, 0x00, 0x65, 0x45, 0xd5, 0x15, 0xc5, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x00, 0x2c, 0x00, 
-0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x43, 0x00, 0x69, 0x49, 0x8d, 
-0x98, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x1f, 0x43, 0x00, 0x73, 0x53, 
-0x9f, 0x9e, 0x22, 0x43, 0x00, 0x67, 0x47, 0xa7, 0xa6, 0x27, 0x01, 0x03, 0xca, 0xca, 0x2e, 0x43, 
-0x00, 0x63, 0x43, 0x87, 0x80, 0x39, 0x00, 0x00, 0x20, 0x00, 0x22, 0x09, 0x61, 0x84, 0x65, 0x89, 
-0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 0x45, 0xd3, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x27, 0x05, 
-0x63, 0x86, 0x67, 0xd0, 0x43, 0x8f, 0x47, 0xd1, 0x20, 0x27, 0x5e, 0x0d, 0x61, 0x83, 0x63, 0xac, 
-0x69, 0x8c, 0x73, 0xe7, 0x75, 0x96, 0x7a, 0xa8, 0x41, 0xb6, 0x43, 0xad, 0x49, 0xd7, 0x53, 0xe6, 
-0x55, 0xea, 0x5a, 0xa9, 0x20, 0x5e, 0x00, 0x10, 0x41, 0x00, 0x90, 0x91, 0x11, 0x41, 0x00, 0x92, 
-0x93, 0x12, 0x41, 0x00, 0xa8, 0xa9, 0x13, 0x41, 0x00, 0xe1, 0xe2, 0x14, 0x41, 0x00, 0xe5, 0xe6, 
-0x15, 0xc5, 0x00, 0xf3, 0x2c, 0xf4, 0x2c, 0x00, 0x2c, 0x00, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 
-0x41, 0x00, 0xe7, 0xe8, 0x17, 0x41, 0x00, 0xb7, 0xb8, 0x18, 0x41, 0x00, 0xd6, 0xd7, 0x19, 0x41, 
-0x00, 0xd8, 0xdd, 0x1a, 0x42, 0x00, 0xf5, 0xf6, 0x81, 0x1b, 0x42, 0x00, 0x82, 0x83, 0x80, 0x1e, 
-0x41, 0x00, 0xa0, 0xa1, 0x1f, 0x41, 0x00, 0xe3, 0xe4, 0x20, 0x41, 0x00, 0xa6, 0xa7, 0x21, 0x41, 
-0x00, 0xaa, 0xab, 0x22, 0x41, 0x00, 0xac, 0xad, 0x23, 0x41, 0x00, 0xb5, 0xb6, 0x24, 0x41, 0x00, 
-0x8e, 0x8f, 0x25, 0x41, 0x00, 0xc6, 0xc7, 0x26, 0x41, 0x00, 0xd0, 0xd1, 0x27, 0x42, 0x00, 0xfb, 
-0xfc, 0x95, 0x28, 0x42, 0x00, 0x96, 0x97, 0x94, 0x2a, 0x05, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x7a, 0x2b, 0x41, 0x00, 0xe9, 0xea, 0x2c, 0xc5, 0x00, 0x88, 0x15, 0x89, 0x15, 0x00, 0x15, 0x00, 
-0x15, 0x19, 0x15, 0x00, 0x15, 0x2d, 0x41, 0x00, 0x9a, 0x9b, 0x2e, 0x41, 0x00, 0xa4, 0xa5, 0x2f, 
-0x41, 0x00, 0xeb, 0xec, 0x30, 0x41, 0x00, 0xa2, 0xa3, 0x31, 0x41, 0x00, 0xd4, 0xd5, 0x32, 0x42, 
-0x00, 0xd2, 0xd3, 0xfd, 0x00, 0x28, 0x01, 0x00, 0xfd, 0xfd, 0x36, 0x05, 0x3f, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x7b, 0x00, 0x48, 0x61, 0x01, 0x09, 0x00, 0x00, 0x4d, 0x4e, 0x2c, 0x00, 0x00, 0x4d, 
-0x4f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xe3, 0x48, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x28, 0xe3, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xfc, 0x31, 0x21, 0x03, 0x02, 0x00, 0x2d, 0x32, 
-0x40, 0x04, 0x02, 0x00, 0x22, 0x33, 0x23, 0x05, 0x02, 0x00, 0x24, 0x34, 0x3b, 0x06, 0x01, 0x00, 
-0x3a, 0x35, 0x07, 0x02, 0x00, 0x2e, 0x36, 0x5e, 0x08, 0x03, 0x00, 0x5f, 0x37, 0x26, 0x1f, 0x09, 
-0x02, 0x00, 0x2c, 0x38, 0x2a, 0x0a, 0x02, 0x00, 0x25, 0x39, 0x28, 0x0b, 0x02, 0x00, 0x3f, 0x30, 
-0x29, 0x0c, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x0d, 0x41, 0x00, 0xe9, 0x99, 0x10, 0x41, 0x00, 0xe4, 
-0x94, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xa6, 0x86, 
-0x14, 0x41, 0x00, 0xed, 0x9d, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 
-0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xdd, 0xdc, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x42, 
-0x00, 0xaa, 0x8a, 0x5b, 0x1b, 0x42, 0x00, 0xea, 0x9a, 0x5d, 0x1e, 0x41, 0x00, 0xa9, 0x89, 0x1f, 
-0x41, 0x00, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa1, 0x81, 0x21, 0x41, 0x00, 0xf3, 0xf2, 0x22, 0x41, 
-0x00, 0xa0, 0x80, 0x23, 0x41, 0x00, 0xe5, 0x95, 0x24, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x25, 
-0x41, 0x00, 0xae, 0x8e, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x27, 0x41, 0x00, 0xa4, 0x84, 0x28, 0x42, 
-0x00, 0xaf, 0x8f, 0x27, 0x29, 0x01, 0x00, 0x3d, 0x2b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 
-0x78, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0xc1, 0x00, 0xf1, 0x2e, 
-0xf0, 0x00, 0x2f, 0x41, 0x00, 0xe1, 0x91, 0x30, 0x41, 0x00, 0xac, 0x8c, 0x31, 0x41, 0x00, 0xa8, 
-0x88, 0x32, 0x41, 0x00, 0xe2, 0x92, 0x33, 0x42, 0x00, 0xec, 0x9c, 0x3c, 0x34, 0x42, 0x00, 0xa2, 
-0x82, 0x3e, 0x35, 0x42, 0x00, 0xee, 0x9e, 0x2f, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x57, 0xa8, 0x00, 0x09, 0x00, 0x00, 0x4d, 0x54, 
-0x2c, 0x00, 0x00, 0x4d, 0x4c, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x55, 0x03, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x7c, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x02, 0x03, 0x00, 
-0xa0, 0x9c, 0x12, 0x43, 0x03, 0x00, 0x00, 0x8a, 0xd4, 0x16, 0x43, 0x03, 0x00, 0x00, 0x97, 0xeb, 
-0x17, 0x43, 0x03, 0x00, 0x00, 0x8d, 0xde, 0x18, 0x43, 0x03, 0x00, 0x00, 0x95, 0xe3, 0x1a, 0x43, 
-0x00, 0xe5, 0xe4, 0x5b, 0x7b, 0x1b, 0x43, 0x00, 0xe8, 0xe7, 0x5d, 0x7d, 0x1e, 0x43, 0x03, 0x00, 
-0x00, 0x85, 0xb7, 0x28, 0x01, 0x01, 0x00, 0x40, 0x29, 0x42, 0x00, 0x91, 0x92, 0x60, 0x2b, 0x01, 
-0x00, 0x23, 0x7e, 0x35, 0x04, 0x0b, 0x00, 0x00, 0x5c, 0x00, 0x1c, 0x56, 0x43, 0x00, 0xbe, 0xbd, 
-0x5c, 0x7c, 0x00, 0x31, 0x7e, 0x00, 0x09, 0x2f, 0x00, 0x4d, 0x54, 0x2c, 0x2f, 0x00, 0x4d, 0x4c, 
-0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x03, 0x34, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x12, 0x03, 0x03, 0x00, 0x00, 0x8a, 0xd4, 0x16, 0x03, 0x03, 0x00, 0x00, 
-0x97, 0xeb, 0x17, 0x03, 0x03, 0x00, 0x00, 0x8d, 0xde, 0x18, 0x03, 0x03, 0x00, 0x00, 0x95, 0xe3, 
-0x1a, 0x43, 0x00, 0xe5, 0xe4, 0x5b, 0x7b, 0x1b, 0x43, 0x00, 0xe8, 0xe7, 0x5d, 0x7d, 0x1e, 0x03, 
-0x03, 0x00, 0x00, 0x85, 0xb7, 0x29, 0x43, 0x00, 0x91, 0x92, 0x60, 0x7e, 0x2b, 0x43, 0x00, 0xbe, 
-0xbd, 0x5c, 0x7c, 0x00, 0xb0, 0xf4, 0x01, 0x04, 0x00, 0x00, 0x4e, 0x45, 0x02, 0x04, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x75, 0x44, 0x00, 0x8a, 0x01, 0x00, 0x00, 
-0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0x41, 0x00, 0x26, 0x31, 0x03, 0x42, 0x04, 0x82, 0x32, 0xc9, 0x04, 0x42, 0x00, 0x22, 0x33, 
-0x23, 0x05, 0x42, 0x00, 0x27, 0x34, 0x7b, 0x06, 0x44, 0x08, 0x28, 0x35, 0x5b, 0x00, 0x1b, 0x07, 
-0x44, 0x08, 0x2d, 0x36, 0x7c, 0x00, 0x1f, 0x08, 0x42, 0x04, 0x8a, 0x37, 0xc8, 0x09, 0x44, 0x08, 
-0x5f, 0x38, 0x5c, 0x00, 0x1c, 0x0a, 0x42, 0x00, 0x87, 0x39, 0x5e, 0x0b, 0x42, 0x00, 0x85, 0x30, 
-0x40, 0x0c, 0x44, 0x08, 0x29, 0xf8, 0x5d, 0x00, 0x1d, 0x0d, 0x42, 0x03, 0x00, 0x00, 0x7d, 0x10, 
-0xc5, 0x00, 0x61, 0x1e, 0x41, 0x1e, 0x91, 0x1e, 0x92, 0x1e, 0x01, 0x1e, 0x00, 0x1e, 0x11, 0xc5, 
-0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0xf7, 0x2c, 0xef, 0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x12, 0x43, 0x00, 
-0x65, 0x45, 0xe1, 0xee, 0x14, 0x03, 0x03, 0x00, 0x00, 0x9e, 0x9f, 0x15, 0x43, 0x00, 0x79, 0x59, 
-0xec, 0xed, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x43, 0x00, 0x6f, 
-0x4f, 0xab, 0xac, 0x1a, 0x44, 0x0f, 0xca, 0xcb, 0x00, 0x00, 0x1e, 0x1b, 0x43, 0x00, 0x24, 0x9c, 
-0xcf, 0xd5, 0x1e, 0xc5, 0x00, 0x71, 0x10, 0x51, 0x10, 0x84, 0x10, 0x8e, 0x10, 0x11, 0x10, 0x00, 
-0x10, 0x1f, 0x43, 0x00, 0x73, 0x53, 0x8d, 0xde, 0x20, 0x03, 0x03, 0x00, 0x00, 0x95, 0xe3, 0x21, 
-0x03, 0x03, 0x00, 0x00, 0xd0, 0xd1, 0x22, 0x43, 0x00, 0x67, 0x47, 0xa8, 0xad, 0x24, 0x41, 0x00, 
-0x6a, 0x4a, 0x25, 0x03, 0x03, 0x00, 0x00, 0xe7, 0xe8, 0x26, 0x03, 0x03, 0x00, 0x00, 0x9b, 0x9d, 
-0x27, 0xc5, 0x00, 0x6d, 0x32, 0x4d, 0x32, 0x00, 0x32, 0x00, 0x32, 0x0d, 0x32, 0x00, 0x32, 0x28, 
-0x41, 0x00, 0x97, 0x25, 0x29, 0x41, 0x00, 0x82, 0x90, 0x2b, 0x41, 0x00, 0x2a, 0xe6, 0x2c, 0xc5, 
-0x00, 0x77, 0x11, 0x57, 0x11, 0x00, 0x11, 0x00, 0x11, 0x17, 0x11, 0x00, 0x11, 0x2e, 0x03, 0x03, 
-0x00, 0x00, 0x87, 0x80, 0x30, 0x03, 0x03, 0x00, 0x00, 0xf1, 0xf2, 0x31, 0x43, 0x00, 0x6e, 0x4e, 
-0xfa, 0xfb, 0x32, 0x43, 0x00, 0x2c, 0x3f, 0xfc, 0xfd, 0x33, 0x43, 0x00, 0x3b, 0x2e, 0x3c, 0xae, 
-0x34, 0x43, 0x00, 0x3a, 0x2f, 0x3e, 0xaf, 0x35, 0x41, 0x00, 0x21, 0xf5, 0x39, 0x00, 0x00, 0x20, 
-0x56, 0x41, 0x00, 0x3c, 0x3e, 0x00, 0x60, 0x07, 0x61, 0x85, 0x65, 0x8a, 0x75, 0x97, 0x41, 0xb7, 
-0x45, 0xd4, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x0d, 0x61, 0xc6, 0x65, 0xbd, 0x69, 0xa9, 0x6f, 0xe4, 
-0x75, 0xf4, 0x6e, 0xa4, 0x41, 0xc7, 0x45, 0xbe, 0x49, 0xb8, 0x4f, 0xe5, 0x55, 0xf6, 0x4e, 0xa5, 
-0x20, 0x7e, 0x5e, 0x11, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x67, 0x86, 
-0x6a, 0xa6, 0x73, 0xf9, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x47, 0x8f, 
-0x4a, 0xa7, 0x53, 0xdd, 0x20, 0x5e, 0x22, 0x09, 0x65, 0x89, 0x69, 0x8b, 0x75, 0x81, 0x79, 0x98, 
-0x45, 0xd3, 0x49, 0xd8, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x00, 0x51, 0x20, 0x01, 0x04, 0x00, 
-0x00, 0x4e, 0x47, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 
-0x75, 0x34, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x01, 0x00, 0xe1, 0x24, 0x9c, 0x06, 0x02, 
-0x03, 0x00, 0x00, 0xd5, 0x07, 0x01, 0x03, 0x00, 0xca, 0x11, 0x43, 0x03, 0x00, 0x00, 0xbd, 0xbe, 
-0x12, 0x43, 0x00, 0x65, 0x45, 0xf1, 0xf2, 0x15, 0x43, 0x03, 0x00, 0x00, 0xf7, 0xef, 0x16, 0x43, 
-0x00, 0x75, 0x55, 0x9e, 0x9f, 0x17, 0x43, 0x00, 0x69, 0x49, 0x9b, 0x9d, 0x18, 0x43, 0x00, 0x6f, 
-0x4f, 0xfc, 0xfd, 0x19, 0x43, 0x03, 0x00, 0x00, 0xfa, 0xfb, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x1f, 
-0x41, 0x00, 0x73, 0x53, 0x20, 0x43, 0x03, 0x00, 0x00, 0xd0, 0xd1, 0x24, 0x43, 0x03, 0x00, 0x00, 
-0x94, 0x99, 0x25, 0x43, 0x03, 0x00, 0x00, 0xe7, 0xe8, 0x28, 0x00, 0x01, 0xcb, 0x29, 0x01, 0x03, 
-0xc8, 0xc9, 0x30, 0x43, 0x03, 0x00, 0x00, 0xc6, 0xc7, 0x31, 0x43, 0x00, 0x6e, 0x4e, 0xa4, 0xa5, 
-0x39, 0x00, 0x00, 0x20, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 
-0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x0d, 0x65, 
-0xa6, 0x69, 0x84, 0x6e, 0xe4, 0x6f, 0xa8, 0x73, 0xf9, 0x75, 0x86, 0x45, 0xa7, 0x49, 0x8e, 0x4e, 
-0xe5, 0x4f, 0xa9, 0x53, 0xdd, 0x55, 0x8f, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 
-0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 
-0x5e, 0x27, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6e, 0xec, 0x6f, 0xa2, 0x75, 0xa3, 0x41, 
-0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4e, 0xed, 0x4f, 0xe0, 0x55, 0xe9, 0x20, 0x27, 0x00, 0xdf, 0xfc, 
-0x01, 0x04, 0x00, 0x00, 0x50, 0x48, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x5a, 0x03, 0x22, 0x01, 0x29, 0x01, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x29, 0x01, 
-0x00, 0x00, 0xb5, 0x01, 0xa0, 0x01, 0xac, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x00, 0xa6, 0x7c, 
-0x03, 0x02, 0x01, 0x00, 0x22, 0x40, 0x04, 0x02, 0x01, 0x00, 0x2f, 0x23, 0x05, 0x02, 0x01, 0x00, 
-0x28, 0xac, 0x06, 0x02, 0x01, 0x00, 0x29, 0xab, 0x07, 0x02, 0x01, 0x00, 0xad, 0xaa, 0x08, 0x03, 
-0x01, 0x00, 0x21, 0x5f, 0x1f, 0x09, 0x02, 0x01, 0x00, 0xa8, 0x23, 0x0a, 0x02, 0x01, 0x00, 0x3f, 
-0xf5, 0x0b, 0x03, 0x03, 0x00, 0xa0, 0x5c, 0x1c, 0x0c, 0x02, 0x00, 0x2d, 0x2b, 0x2a, 0x0d, 0x02, 
-0x07, 0xcc, 0xcc, 0xc9, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 
-0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x02, 0x00, 
-0xf6, 0x9e, 0x5b, 0x1b, 0x02, 0x03, 0xc8, 0xc8, 0x5d, 0x1e, 0x42, 0x00, 0x61, 0x41, 0x24, 0x1f, 
-0x42, 0x03, 0x00, 0x00, 0x26, 0x20, 0x42, 0x03, 0x00, 0x00, 0x40, 0x21, 0x42, 0x03, 0x00, 0x00, 
-0x5b, 0x22, 0x42, 0x03, 0x00, 0x00, 0x5d, 0x23, 0x42, 0x03, 0x00, 0x00, 0x7c, 0x24, 0x42, 0x03, 
-0x00, 0x00, 0x9c, 0x25, 0x42, 0x03, 0x00, 0x00, 0xf1, 0x27, 0x42, 0x00, 0xa4, 0xa5, 0x7e, 0x28, 
-0x42, 0x00, 0x87, 0x80, 0x7b, 0x29, 0x03, 0x00, 0x27, 0xfa, 0x5c, 0x1c, 0x2b, 0x42, 0x03, 0xcb, 
-0xcb, 0x7d, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x31, 0x41, 0x00, 0x6e, 0x4e, 0x33, 0x02, 0x01, 0x00, 
-0x3b, 0x3c, 0x34, 0x02, 0x05, 0x00, 0x3a, 0xca, 0x35, 0x02, 0x00, 0x3d, 0x25, 0x3e, 0x39, 0x00, 
-0x00, 0x20, 0x56, 0x01, 0x00, 0x3c, 0x3e, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x60, 
-0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 
-0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 
-0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 
-0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 
-0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 
-0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 
-0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 
-0x99, 0x55, 0x9a, 0x20, 0xf9, 0x00, 0x0a, 0x02, 0x03, 0x00, 0x00, 0x15, 0x1a, 0x01, 0x03, 0x00, 
-0xa0, 0x00, 0x60, 0x06, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x20, 0x60, 
-0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x06, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 
-0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 0x27, 0x07, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 
-0x75, 0xa3, 0x45, 0x90, 0x20, 0x27, 0x22, 0x0a, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 
-0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x00, 0xd8, 0xb5, 0x00, 
-0x09, 0x00, 0x00, 0x53, 0x51, 0x2c, 0xc4, 0x01, 0x53, 0x51, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x03, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 
-0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x01, 
-0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0xf5, 
-0x08, 0x02, 0x03, 0x00, 0x00, 0x7b, 0x09, 0x02, 0x03, 0x00, 0x00, 0x7d, 0x0a, 0x03, 0x03, 0x00, 
-0x00, 0x5b, 0x1b, 0x0b, 0x03, 0x03, 0x00, 0x00, 0x5d, 0x1d, 0x1a, 0x41, 0x00, 0x89, 0xd3, 0x1b, 
-0x01, 0x00, 0x27, 0x40, 0x28, 0x41, 0x00, 0x87, 0x80, 0x29, 0x02, 0x00, 0x60, 0xaa, 0x7c, 0x2b, 
-0x03, 0x00, 0x23, 0x7e, 0x5c, 0x1c, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x12, 0x42, 
-0x03, 0x00, 0x00, 0xaa, 0x29, 0x01, 0x03, 0x00, 0xa0, 0x00, 0x04, 0x01, 0x01, 0x00, 0x15, 0x1a, 
-0x41, 0x02, 0x89, 0xa0, 0x00, 0xa8, 0x61, 0x03, 0x04, 0xc0, 0x01, 0x53, 0x51, 0x05, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x03, 0x30, 0x02, 0x9b, 0x02, 0x00, 
-0x00, 0x52, 0x03, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00, 0x5a, 0x03, 0x2f, 0x01, 0x36, 0x01, 0x00, 
-0x00, 0xb5, 0x01, 0xbd, 0x01, 0xd5, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x02, 0x02, 0x07, 0x00, 0x00, 0xc8, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x03, 0x07, 0x00, 
-0x00, 0xc9, 0x1e, 0x06, 0x02, 0x07, 0x00, 0x00, 0xca, 0x08, 0x02, 0x07, 0x00, 0x00, 0xcb, 0x09, 
-0x02, 0x03, 0x00, 0x00, 0xfa, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xcc, 0x0c, 0x02, 0x07, 0x00, 0x00, 
-0xcd, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xce, 0x10, 0x42, 0x03, 0x00, 0x00, 0x5c, 0x11, 0x42, 0x03, 
-0x00, 0x00, 0x7c, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0xc4, 0x00, 0x7a, 0x2c, 0x5a, 0x2c, 0x00, 
-0x2c, 0x1a, 0x2c, 0x00, 0x2c, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 
-0x41, 0x00, 0x6f, 0x4f, 0x1a, 0x42, 0x00, 0x87, 0x80, 0xf6, 0x1b, 0x02, 0x00, 0x40, 0x27, 0x9e, 
-0x1e, 0x41, 0x00, 0x61, 0x41, 0x21, 0x42, 0x03, 0x00, 0x00, 0x5b, 0x22, 0x42, 0x03, 0x00, 0x00, 
-0x5d, 0x27, 0x42, 0x00, 0x89, 0xd3, 0x24, 0x28, 0x03, 0x00, 0x5b, 0x7b, 0xe1, 0x1b, 0x29, 0x03, 
-0x04, 0x5c, 0x7c, 0x00, 0x1c, 0x2b, 0x03, 0x00, 0x5d, 0x7d, 0xcf, 0x1d, 0x2c, 0xc4, 0x00, 0x79, 
-0x15, 0x59, 0x15, 0x00, 0x15, 0x19, 0x15, 0x00, 0x15, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x2f, 0x42, 
-0x03, 0x00, 0x00, 0x40, 0x30, 0x42, 0x03, 0x00, 0x00, 0x7b, 0x31, 0x42, 0x00, 0x6e, 0x4e, 0x7d, 
-0x32, 0x42, 0x03, 0x00, 0x00, 0xf5, 0x33, 0x02, 0x01, 0x00, 0x3b, 0x3c, 0x34, 0x02, 0x01, 0x00, 
-0x3a, 0x3e, 0x39, 0x00, 0x00, 0x20, 0x56, 0x01, 0x00, 0x3c, 0x3e, 0x00, 0x12, 0x42, 0x03, 0x00, 
-0x00, 0xd5, 0x00, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 
-0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 
-0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xf8, 0x03, 0x61, 0x86, 0x41, 
-0x8f, 0x20, 0xf8, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 
-0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0xef, 0x0d, 0x61, 0xa0, 0x65, 
-0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 
-0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0xef, 0xf9, 0x0c, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 
-0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 
-0xf9, 0xf7, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0xf7, 0x00, 0x1b, 0x02, 0x07, 0x00, 0x00, 0xa0, 
-0x27, 0x41, 0x02, 0x89, 0xa0, 0x2b, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x32, 0x42, 0x03, 0x00, 0x00, 
-0x15, 0x00, 0x7e, 0x03, 0x6e, 0xa4, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x06, 0x61, 0x83, 0x65, 0x88, 
-0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x20, 0x5e, 0xf8, 0x03, 0x61, 0x86, 0x41, 0x8f, 0x20, 0xf8, 
-0x60, 0x06, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x20, 0x60, 0x27, 0x07, 
-0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x45, 0x90, 0x20, 0x27, 0x22, 0x0a, 
-0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x4f, 0x99, 
-0x55, 0x9a, 0x20, 0x22, 0x2c, 0x03, 0x63, 0x87, 0x43, 0x80, 0x20, 0x2c, 0x00, 0x02, 0x02, 0x03, 
-0x00, 0x00, 0x7e, 0x03, 0x02, 0x07, 0x00, 0x00, 0xc8, 0x05, 0x02, 0x07, 0x00, 0x00, 0xca, 0x06, 
-0x02, 0x07, 0x00, 0x00, 0xcb, 0x07, 0x02, 0x07, 0x00, 0x00, 0xcc, 0x08, 0x02, 0x03, 0x00, 0x00, 
-0x60, 0x09, 0x02, 0x07, 0x00, 0x00, 0xcd, 0x0a, 0x02, 0x07, 0x00, 0x00, 0xce, 0x0b, 0x02, 0x07, 
-0x00, 0x00, 0xcf, 0x0c, 0x02, 0x07, 0x00, 0x00, 0xd0, 0x0d, 0x02, 0x07, 0x00, 0x00, 0xd1, 0x12, 
-0x42, 0x03, 0x00, 0x00, 0xaa, 0x13, 0x41, 0x00, 0x72, 0x52, 0x14, 0x41, 0x00, 0x74, 0x54, 0x1f, 
-0x42, 0x00, 0x73, 0x53, 0xd0, 0x20, 0x42, 0x00, 0x64, 0x44, 0xd1, 0x25, 0x42, 0x03, 0x00, 0x00, 
-0x88, 0x26, 0x42, 0x00, 0x6c, 0x4c, 0x9d, 0x00, 0xf3, 0x13, 0x63, 0x9f, 0x64, 0xd4, 0x65, 0xd8, 
-0x6c, 0x96, 0x6e, 0xe5, 0x72, 0xfd, 0x73, 0xe7, 0x74, 0x9c, 0x7a, 0xa7, 0x43, 0xac, 0x44, 0xd2, 
-0x45, 0xb7, 0x4c, 0x95, 0x4e, 0xd5, 0x52, 0xfc, 0x53, 0xe6, 0x54, 0x9b, 0x5a, 0xa6, 0x20, 0xf3, 
-0x5e, 0x07, 0x61, 0x83, 0x69, 0x8c, 0x6f, 0x93, 0x41, 0xb6, 0x49, 0xd7, 0x4f, 0xe2, 0x20, 0x5e, 
-0xf4, 0x03, 0x61, 0xc7, 0x41, 0xc6, 0x20, 0xf4, 0xf8, 0x03, 0x75, 0x85, 0x55, 0xde, 0x20, 0xf8, 
-0xf2, 0x05, 0x61, 0xa5, 0x65, 0xa9, 0x41, 0xa4, 0x45, 0xa8, 0x20, 0xf2, 0xfa, 0x03, 0x7a, 0xbe, 
-0x5a, 0xbd, 0x20, 0xfa, 0xef, 0x19, 0x61, 0xa0, 0x63, 0x86, 0x65, 0x82, 0x69, 0xa1, 0x6c, 0x92, 
-0x6e, 0xe4, 0x6f, 0xa2, 0x72, 0xea, 0x73, 0x98, 0x75, 0xa3, 0x79, 0xec, 0x7a, 0xab, 0x41, 0xb5, 
-0x43, 0x8f, 0x45, 0x90, 0x49, 0xd6, 0x4c, 0x91, 0x4e, 0xe3, 0x4f, 0xe0, 0x52, 0xe8, 0x53, 0x97, 
-0x55, 0xe9, 0x59, 0xed, 0x5a, 0x8d, 0x20, 0xef, 0xf1, 0x05, 0x6f, 0x8b, 0x75, 0xfb, 0x4f, 0x8a, 
-0x55, 0xeb, 0x20, 0xf1, 0xf9, 0x09, 0x61, 0x84, 0x65, 0x89, 0x6f, 0x94, 0x75, 0x81, 0x41, 0x8e, 
-0x45, 0xd3, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0xf9, 0xf7, 0x07, 0x63, 0x87, 0x73, 0xad, 0x74, 0xee, 
-0x43, 0x80, 0x53, 0xb8, 0x54, 0xdd, 0x20, 0xf7, 0x00, 0x07, 0x55, 0x01, 0x04, 0x00, 0x00, 0x54, 
-0x4a, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x75, 0x41, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x32, 0x75, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
-0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0x22, 0x40, 0x04, 0x02, 0x01, 0x00, 0xfc, 
-0x23, 0x05, 0x02, 0x05, 0x00, 0x3b, 0xa0, 0x07, 0x02, 0x01, 0x00, 0x3a, 0x5e, 0x08, 0x02, 0x01, 
-0x00, 0x3f, 0x26, 0x09, 0x02, 0x03, 0x00, 0x00, 0x24, 0x0c, 0x43, 0x00, 0xf3, 0xf2, 0x2d, 0x5f, 
-0x0d, 0x43, 0x00, 0xf7, 0xf6, 0x3d, 0x2b, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x43, 0x00, 0xf9, 
-0xf8, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x42, 0x00, 
-0xa5, 0x85, 0xfd, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 
-0xe8, 0x98, 0x18, 0x43, 0x00, 0xfb, 0xfa, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x42, 
-0x00, 0xe5, 0x95, 0x5b, 0x1b, 0x42, 0x00, 0xea, 0x9a, 0x5d, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 
-0x43, 0x00, 0xde, 0xdd, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 
-0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 
-0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 
-0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 0x00, 0x2a, 0x04, 0x1f, 0x00, 
-0x00, 0x00, 0x00, 0x78, 0x2b, 0x02, 0x01, 0x00, 0x2f, 0x7c, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 
-0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 
-0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x43, 0x00, 0xf5, 0xf4, 0xec, 0x9c, 0x33, 
-0x42, 0x00, 0xa1, 0x81, 0x3c, 0x34, 0x42, 0x00, 0xee, 0x9e, 0x3e, 0x35, 0x02, 0x00, 0x2e, 0x2c, 
-0x2f, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 
-0x00, 0x52, 0x6f, 0x01, 0x04, 0x00, 0x00, 0x54, 0x4d, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x03, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xe7, 0x61, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x62, 0xe7, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
-0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x03, 0x03, 0x00, 0x00, 0x5b, 0x7b, 0x1b, 0x03, 0x03, 0x00, 
-0x00, 0x5d, 0x7d, 0x29, 0x03, 0x03, 0x00, 0x00, 0x60, 0x7e, 0x2b, 0x03, 0x03, 0x00, 0x00, 0x5c, 
-0x7c, 0x00, 0x10, 0x43, 0x00, 0x84, 0x8e, 0x71, 0x51, 0x12, 0x42, 0x03, 0x00, 0x00, 0xaa, 0x1a, 
-0x41, 0x00, 0xe5, 0xd5, 0x1b, 0x41, 0x00, 0x94, 0x99, 0x29, 0x41, 0x00, 0xa7, 0xa6, 0x2b, 0x41, 
-0x00, 0xad, 0xb8, 0x2d, 0x43, 0x00, 0xec, 0xed, 0x78, 0x58, 0x2e, 0x43, 0x00, 0x87, 0x80, 0x63, 
-0x43, 0x2f, 0x43, 0x00, 0x81, 0x9a, 0x76, 0x56, 0x00, 0x0c, 0xc3, 0x00, 0xf1, 0x0c, 0xf0, 0x00, 
-0x2d, 0x82, 0x5f, 0x82, 0x0d, 0x43, 0x00, 0xeb, 0x9b, 0x3d, 0x2b, 0x10, 0x41, 0x00, 0xf3, 0xf2, 
-0x11, 0x41, 0x00, 0xa2, 0x82, 0x12, 0x41, 0x00, 0xa5, 0x85, 0x13, 0xc1, 0x00, 0xe0, 0x00, 0x90, 
-0x13, 0x14, 0x41, 0x00, 0xe2, 0x92, 0x15, 0x41, 0x00, 0xa9, 0x89, 0x16, 0x41, 0x00, 0xe3, 0x93, 
-0x17, 0x41, 0x00, 0xa8, 0x88, 0x18, 0x41, 0x00, 0xae, 0x8e, 0x19, 0x41, 0x00, 0xaf, 0x8f, 0x1a, 
-0x41, 0x00, 0xfb, 0xfa, 0x1b, 0x41, 0x00, 0xf5, 0xf4, 0x1e, 0x41, 0x00, 0xa0, 0x80, 0x1f, 0x41, 
-0x00, 0xe1, 0x91, 0x20, 0x41, 0x00, 0xa4, 0x84, 0x21, 0x41, 0x00, 0xe4, 0x94, 0x22, 0x41, 0x00, 
-0xa3, 0x83, 0x23, 0x41, 0x00, 0xe5, 0x95, 0x24, 0x41, 0x00, 0xa6, 0x86, 0x25, 0x41, 0x00, 0xaa, 
-0x8a, 0x26, 0x41, 0x00, 0xab, 0x8b, 0x28, 0x43, 0x00, 0xed, 0x9d, 0x27, 0x22, 0x29, 0x41, 0x00, 
-0xf9, 0xf8, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x2b, 0x41, 0x00, 0xe8, 0x98, 0x2c, 
-0x41, 0x00, 0xa7, 0x87, 0x2d, 0x41, 0x00, 0xef, 0x9f, 0x2e, 0x41, 0x00, 0xe7, 0x97, 0x2f, 0x41, 
-0x00, 0xf7, 0xf6, 0x30, 0x41, 0x00, 0xa1, 0x81, 0x31, 0x41, 0x00, 0xad, 0x8d, 0x32, 0x41, 0x00, 
-0xac, 0x8c, 0x35, 0x43, 0x00, 0xee, 0x9e, 0x2f, 0x3f, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x7a, 0x00, 0x85, 0x83, 0x06, 0x09, 0x00, 0x00, 0x55, 0x52, 0x2c, 0x00, 0x00, 0x55, 0x41, 
-0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x03, 0xd2, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x50, 0x03, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x04, 0xc4, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x65, 0x04, 0xe7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x51, 0x03, 0xac, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x51, 0x03, 0xd3, 0x02, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x04, 0x99, 0x04, 
-0x00, 0x00, 0x00, 0x00, 0x6b, 0x04, 0xc1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x28, 0x03, 0x7f, 0x05, 
-0x00, 0x00, 0x00, 0x00, 0x28, 0x03, 0xa8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x62, 0x03, 0x6a, 0x06, 
-0x00, 0x00, 0x00, 0x00, 0x62, 0x03, 0x94, 0x05, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xed, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x00, 0x40, 0x04, 0x02, 0x03, 0x00, 0x00, 0x23, 
-0x05, 0x02, 0x03, 0x00, 0x00, 0xcf, 0x07, 0x02, 0x03, 0x00, 0x00, 0x5e, 0x08, 0x02, 0x03, 0x00, 
-0x00, 0x26, 0x09, 0x02, 0x03, 0x00, 0x00, 0x24, 0x1a, 0x02, 0x03, 0x00, 0x00, 0x5b, 0x1b, 0x02, 
-0x03, 0x00, 0x00, 0x5d, 0x2b, 0x02, 0x03, 0x00, 0x00, 0x7c, 0x33, 0x02, 0x03, 0x00, 0x00, 0x3c, 
-0x34, 0x02, 0x03, 0x00, 0x00, 0x3e, 0x35, 0x02, 0x03, 0x00, 0x00, 0x2f, 0x00, 0x12, 0x42, 0x03, 
-0x00, 0x00, 0xd5, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0xfc, 0x05, 0x02, 
-0x05, 0x00, 0x3b, 0xa0, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 
-0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 
-0xaa, 0x8a, 0x14, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x43, 0x00, 
-0xa3, 0x83, 0xf3, 0xf2, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 
-0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xf9, 0xf8, 0x1e, 0x41, 0x00, 
-0xe4, 0x94, 0x1f, 0x41, 0x00, 0xf7, 0xf6, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 
-0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 
-0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 
-0x86, 0x28, 0x41, 0x00, 0xf5, 0xf4, 0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 0x00, 0x2a, 0x04, 0x1f, 
-0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 
-0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 
-0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 
-0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 0x00, 0x2e, 0x2c, 0x56, 0x41, 0x00, 0xf3, 
-0xf2, 0x00, 0x05, 0x02, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 
-0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 
-0xfc, 0x05, 0x02, 0x01, 0x00, 0x3b, 0xfd, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 
-0x3f, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 
-0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x41, 0x00, 0xa5, 0x85, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 
-0x43, 0x00, 0xa3, 0x83, 0xf3, 0xf2, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 
-0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xf9, 0xf8, 0x1e, 
-0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xf7, 0xf6, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 
-0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 
-0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 
-0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xf5, 0xf4, 0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 0x00, 0x2a, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 0x41, 0x00, 0xef, 
-0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 
-0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 
-0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 0x00, 0x2e, 0x2c, 0x56, 0x41, 
-0x00, 0xf3, 0xf2, 0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x7b, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x05, 0x02, 0x05, 0x00, 0x3b, 0xa0, 0x07, 0x01, 
-0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 
-0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x42, 0x00, 0xa5, 
-0x85, 0xfb, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x43, 0x00, 0xa3, 0x83, 0xfd, 0xfc, 0x17, 0x41, 
-0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 
-0xe5, 0x95, 0x1b, 0x41, 0x00, 0xf5, 0xf4, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xf9, 
-0xf8, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 
-0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 
-0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xf3, 0xf2, 
-0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x2b, 
-0x01, 0x01, 0x00, 0x2f, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 
-0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 
-0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 
-0x9e, 0x35, 0x01, 0x00, 0x2e, 0x2c, 0x56, 0x41, 0x00, 0xfd, 0xfc, 0x00, 0x05, 0x02, 0x07, 0x00, 
-0x00, 0xa0, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfb, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7d, 
-0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x05, 0x02, 0x01, 0x00, 0x3b, 0xfb, 0x07, 0x01, 0x01, 0x00, 
-0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 
-0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x41, 0x00, 0xa5, 0x85, 0x15, 
-0x41, 0x00, 0xad, 0x8d, 0x16, 0x43, 0x00, 0xa3, 0x83, 0xfd, 0xfc, 0x17, 0x41, 0x00, 0xe8, 0x98, 
-0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 
-0x41, 0x00, 0xf5, 0xf4, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xf9, 0xf8, 0x20, 0x41, 
-0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 
-0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 
-0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xf3, 0xf2, 0x29, 0xc1, 0x00, 
-0xf1, 0x29, 0xf0, 0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x2b, 0x01, 0x01, 0x00, 
-0x2f, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 
-0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 
-0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 
-0x00, 0x2e, 0x2c, 0x56, 0x41, 0x00, 0xfd, 0xfc, 0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 0xfb, 0x36, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 
-0x00, 0xfc, 0x05, 0x02, 0x05, 0x00, 0x3b, 0xa0, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 
-0x00, 0x3f, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 
-0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x15, 0x41, 0x00, 0xad, 
-0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 
-0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xf5, 0xf4, 0x1e, 
-0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0x69, 0x49, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 
-0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 
-0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 
-0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xf3, 0xf2, 0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 0x00, 0x2a, 
-0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 0x41, 0x00, 0xef, 
-0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 
-0x30, 0x41, 0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 
-0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 0x00, 0x2e, 0x2c, 0x00, 0x05, 
-0x02, 0x07, 0x00, 0x00, 0xa0, 0x12, 0x02, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 
-0x00, 0x00, 0x81, 0x00, 0x03, 0x01, 0x01, 0x00, 0x22, 0x04, 0x01, 0x01, 0x00, 0xfc, 0x05, 0x02, 
-0x01, 0x00, 0x3b, 0xfd, 0x07, 0x01, 0x01, 0x00, 0x3a, 0x08, 0x01, 0x01, 0x00, 0x3f, 0x10, 0x41, 
-0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 
-0xaa, 0x8a, 0x14, 0x41, 0x00, 0xa5, 0x85, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 
-0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 
-0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xf5, 0xf4, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 
-0x41, 0x00, 0x69, 0x49, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 
-0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 
-0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 
-0x00, 0xf3, 0xf2, 0x29, 0xc1, 0x00, 0xf1, 0x29, 0xf0, 0x00, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x82, 0x2b, 0x01, 0x01, 0x00, 0x2f, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 
-0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xa8, 0x88, 
-0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 
-0x41, 0x00, 0xee, 0x9e, 0x35, 0x01, 0x00, 0x2e, 0x2c, 0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 0xfd, 
-0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x51, 0x07, 0x07, 0x09, 0xd1, 0x01, 0x55, 
-0x52, 0x2c, 0xd1, 0x01, 0x55, 0x41, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x50, 0x03, 0xe7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x50, 0x03, 0xf0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x65, 0x04, 0xec, 0x02, 0x00, 0x00, 0x00, 0x00, 0x65, 0x04, 0xf6, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x51, 0x03, 0xec, 0x03, 0x00, 0x00, 0x00, 0x00, 0x51, 0x03, 0xf5, 0x02, 0x00, 0x00, 
-0x00, 0x00, 0x6b, 0x04, 0xf1, 0x04, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x04, 0xfb, 0x03, 0x00, 0x00, 
-0x00, 0x00, 0x28, 0x03, 0xf0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x28, 0x03, 0xfa, 0x04, 0x00, 0x00, 
-0x00, 0x00, 0x62, 0x03, 0xf4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x62, 0x03, 0xff, 0x05, 0x00, 0x00, 
-0x00, 0x00, 0x5a, 0x03, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x00, 0x40, 
-0x04, 0x02, 0x03, 0x00, 0x00, 0x23, 0x05, 0x02, 0x03, 0x00, 0x00, 0x24, 0x07, 0x02, 0x03, 0x00, 
-0x00, 0x5e, 0x08, 0x02, 0x03, 0x00, 0x00, 0x26, 0x09, 0x03, 0x03, 0x00, 0x00, 0x2a, 0x1f, 0x0d, 
-0x03, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x1a, 0x02, 0x03, 0x00, 0x00, 0x5b, 0x1b, 0x02, 0x03, 0x00, 
-0x00, 0x5d, 0x33, 0x02, 0x03, 0x00, 0x00, 0x3c, 0x34, 0x02, 0x03, 0x00, 0x00, 0x3e, 0x00, 0x12, 
-0x42, 0x03, 0x00, 0x00, 0xd5, 0x00, 0x02, 0x01, 0x00, 0xfc, 0x31, 0x03, 0x01, 0x00, 0x2d, 0x32, 
-0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 0x01, 0x00, 0x22, 0x34, 0x06, 0x01, 0x00, 0x3a, 0x35, 0x07, 
-0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 0x38, 0x0a, 0x01, 
-0x00, 0x3f, 0x39, 0x0b, 0x01, 0x00, 0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 0x0d, 0x01, 0x00, 
-0x3b, 0x5c, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 
-0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x15, 0x41, 0x00, 0xad, 
-0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 
-0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xf3, 0xf2, 0x1e, 
-0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xa8, 0x88, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 
-0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 
-0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 
-0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xf5, 0xf4, 0x29, 0x01, 0x00, 0x60, 0x2b, 0x2a, 0x04, 0x1f, 
-0x00, 0x00, 0x00, 0x00, 0x78, 0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 
-0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 
-0x00, 0xf7, 0xf6, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 
-0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x41, 0x00, 0xf9, 0xf8, 0x00, 0x12, 0x42, 0x03, 
-0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x02, 0x01, 0x00, 0xfc, 
-0x31, 0x03, 0x01, 0x00, 0x2d, 0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 0x01, 0x00, 0x22, 0x34, 
-0x06, 0x01, 0x00, 0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 0x00, 0x2e, 0x37, 0x09, 
-0x01, 0x00, 0x5f, 0x38, 0x0a, 0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 0x00, 0x25, 0x30, 0x0c, 0x01, 
-0x00, 0x21, 0x3d, 0x0d, 0x01, 0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 
-0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x41, 0x00, 0xa5, 
-0x85, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 
-0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 
-0x41, 0x00, 0xf3, 0xf2, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xa8, 0x88, 0x20, 0x41, 
-0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 
-0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 
-0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xf5, 0xf4, 0x29, 0x01, 0x00, 
-0x60, 0x2b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 
-0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 
-0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xf7, 0xf6, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 
-0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x41, 0x00, 0xf9, 
-0xf8, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x02, 0x01, 0x00, 0x21, 0x31, 
-0x03, 0x01, 0x00, 0x2d, 0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 0x01, 0x00, 0x22, 0x34, 0x06, 
-0x01, 0x00, 0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 0x00, 0x2e, 0x37, 0x09, 0x01, 
-0x00, 0x5f, 0x38, 0x0a, 0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 0x00, 0x25, 0x30, 0x0c, 0x01, 0x00, 
-0x21, 0x3d, 0x0d, 0x01, 0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 
-0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x42, 0x00, 0xa5, 0x85, 
-0xfb, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 
-0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 
-0x41, 0x00, 0xfd, 0xfc, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 0xa8, 0x88, 0x20, 0x41, 
-0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 
-0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 
-0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xf3, 0xf2, 0x29, 0x01, 0x00, 
-0x60, 0x2b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 
-0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 
-0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xf9, 0xf8, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 
-0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 0x35, 0x41, 0x00, 0xf5, 
-0xf4, 0x00, 0x12, 0x42, 0x03, 0x00, 0x00, 0xfb, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7d, 
-0x00, 0x02, 0x01, 0x00, 0x21, 0x31, 0x03, 0x01, 0x00, 0x2d, 0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 
-0x05, 0x01, 0x00, 0x22, 0x34, 0x06, 0x01, 0x00, 0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 
-0x01, 0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 0x38, 0x0a, 0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 
-0x00, 0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 0x0d, 0x01, 0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 
-0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 
-0x8a, 0x14, 0x41, 0x00, 0xa5, 0x85, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 
-0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 
-0x41, 0x00, 0xe5, 0x95, 0x1b, 0x41, 0x00, 0xfd, 0xfc, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 
-0x00, 0xa8, 0x88, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 
-0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 
-0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 
-0xf3, 0xf2, 0x29, 0x01, 0x00, 0x60, 0x2b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x2b, 
-0x01, 0x00, 0x29, 0x28, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 
-0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0xf9, 0xf8, 0x31, 0x41, 0x00, 
-0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 
-0x9e, 0x35, 0x41, 0x00, 0xf5, 0xf4, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 
-0x02, 0x01, 0x00, 0xfc, 0x31, 0x03, 0x01, 0x00, 0x2d, 0x32, 0x04, 0x01, 0x00, 0x2f, 0x33, 0x05, 
-0x01, 0x00, 0x22, 0x34, 0x06, 0x01, 0x00, 0x3a, 0x35, 0x07, 0x01, 0x00, 0x2c, 0x36, 0x08, 0x01, 
-0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 0x38, 0x0a, 0x01, 0x00, 0x3f, 0x39, 0x0b, 0x01, 0x00, 
-0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 0x0d, 0x01, 0x00, 0x3b, 0x5c, 0x10, 0x41, 0x00, 0xa9, 
-0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 
-0x14, 0x42, 0x00, 0xa5, 0x85, 0xfd, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 
-0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 0x1a, 
-0x41, 0x00, 0xe5, 0x95, 0x1b, 0x10, 0x00, 0x00, 0x1e, 0x41, 0x00, 0xe4, 0x94, 0x1f, 0x41, 0x00, 
-0xa8, 0x88, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 
-0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 
-0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 0x28, 0x41, 0x00, 0xf3, 
-0xf2, 0x29, 0x01, 0x00, 0x60, 0x2b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2b, 0x01, 
-0x00, 0x29, 0x28, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 
-0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0x69, 0x49, 0x31, 0x41, 0x00, 0xe2, 
-0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 0x41, 0x00, 0xee, 0x9e, 
-0x35, 0x41, 0x00, 0xf5, 0xf4, 0x00, 0x12, 0x02, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 
-0x00, 0x00, 0x00, 0x81, 0x00, 0x02, 0x01, 0x00, 0xfc, 0x31, 0x03, 0x01, 0x00, 0x2d, 0x32, 0x04, 
-0x01, 0x00, 0x2f, 0x33, 0x05, 0x01, 0x00, 0x22, 0x34, 0x06, 0x01, 0x00, 0x3a, 0x35, 0x07, 0x01, 
-0x00, 0x2c, 0x36, 0x08, 0x01, 0x00, 0x2e, 0x37, 0x09, 0x01, 0x00, 0x5f, 0x38, 0x0a, 0x01, 0x00, 
-0x3f, 0x39, 0x0b, 0x01, 0x00, 0x25, 0x30, 0x0c, 0x01, 0x00, 0x21, 0x3d, 0x0d, 0x01, 0x00, 0x3b, 
-0x5c, 0x10, 0x41, 0x00, 0xa9, 0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 
-0x13, 0x41, 0x00, 0xaa, 0x8a, 0x14, 0x41, 0x00, 0xa5, 0x85, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 
-0x41, 0x00, 0xa3, 0x83, 0x17, 0x41, 0x00, 0xe8, 0x98, 0x18, 0x41, 0x00, 0xe9, 0x99, 0x19, 0x41, 
-0x00, 0xa7, 0x87, 0x1a, 0x41, 0x00, 0xe5, 0x95, 0x1b, 0x10, 0x00, 0x00, 0x1e, 0x41, 0x00, 0xe4, 
-0x94, 0x1f, 0x41, 0x00, 0xa8, 0x88, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 0xa0, 0x80, 
-0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 0x00, 0xae, 
-0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 0xa6, 0x86, 
-0x28, 0x41, 0x00, 0xf3, 0xf2, 0x29, 0x01, 0x00, 0x60, 0x2b, 0x2a, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x82, 0x2b, 0x01, 0x00, 0x29, 0x28, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 0x41, 0x00, 0xe7, 
-0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 0x00, 0x69, 0x49, 
-0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x41, 0x00, 0xa1, 0x81, 0x34, 
-0x41, 0x00, 0xee, 0x9e, 0x35, 0x41, 0x00, 0xf5, 0xf4, 0x00, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x83, 0x00, 0xfe, 0x98, 0x09, 0x09, 0x00, 0x00, 0x55, 0x58, 0x2c, 0x67, 0x00, 0x55, 0x58, 
-0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x03, 0xa8, 0x00, 
-0xad, 0x03, 0x00, 0x00, 0x52, 0x03, 0xa8, 0x01, 0xad, 0x03, 0x00, 0x00, 0xb5, 0x01, 0xa2, 0x02, 
-0x5e, 0x03, 0x00, 0x00, 0x45, 0x75, 0x28, 0x04, 0x8f, 0x04, 0x00, 0x00, 0x47, 0x75, 0x14, 0x05, 
-0xa3, 0x05, 0x00, 0x00, 0x48, 0x75, 0x38, 0x06, 0xbe, 0x06, 0x00, 0x00, 0x49, 0x75, 0x4f, 0x07, 
-0x06, 0x08, 0x00, 0x00, 0x4a, 0x75, 0x83, 0x08, 0xf1, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x03, 0x00, 
-0xca, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0x41, 0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 
-0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 0x6f, 0x4f, 0x1e, 0x41, 0x00, 0x61, 0x41, 0x28, 
-0x01, 0x03, 0xcb, 0xcc, 0x29, 0x01, 0x03, 0xc8, 0xc9, 0x2e, 0x41, 0x00, 0x63, 0x43, 0x31, 0x41, 
-0x00, 0x6e, 0x4e, 0x39, 0x00, 0x00, 0x20, 0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0xad, 0xfb, 0x03, 
-0x02, 0x03, 0x00, 0x00, 0xfd, 0x04, 0x02, 0x03, 0x00, 0x00, 0xfc, 0x05, 0x03, 0x03, 0x00, 0x00, 
-0xcf, 0x9c, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x07, 0x02, 0x03, 0x00, 0x00, 0xac, 0x08, 0x02, 
-0x03, 0x00, 0x00, 0xab, 0x09, 0x02, 0x03, 0x00, 0x00, 0xf3, 0x0c, 0x02, 0x03, 0x00, 0x00, 0xbe, 
-0x0d, 0x03, 0x03, 0x00, 0x00, 0x9e, 0xf6, 0x10, 0x03, 0x03, 0x00, 0x00, 0x84, 0x8e, 0x11, 0x03, 
-0x03, 0x00, 0x00, 0x86, 0x8f, 0x12, 0x03, 0x03, 0x00, 0x00, 0x82, 0x90, 0x13, 0x02, 0x03, 0x00, 
-0x00, 0xa9, 0x14, 0x03, 0x03, 0x00, 0x00, 0xe7, 0xe8, 0x15, 0x03, 0x03, 0x00, 0x00, 0x81, 0x9a, 
-0x16, 0x03, 0x03, 0x00, 0x00, 0xa3, 0xe9, 0x17, 0x03, 0x03, 0x00, 0x00, 0xa1, 0xd6, 0x18, 0x83, 
-0x03, 0x00, 0x18, 0x00, 0x18, 0xa2, 0x18, 0xe0, 0x00, 0x19, 0x03, 0x03, 0x00, 0x00, 0x94, 0x99, 
-0x1a, 0x02, 0x03, 0x00, 0x00, 0xae, 0x1b, 0x02, 0x03, 0x00, 0x00, 0xaf, 0x1e, 0x03, 0x03, 0x00, 
-0x00, 0xa0, 0xb5, 0x1f, 0x03, 0x03, 0x00, 0x00, 0xe1, 0xf5, 0x20, 0x03, 0x03, 0x00, 0x00, 0xd0, 
-0xd1, 0x21, 0x02, 0x03, 0x00, 0x00, 0x9f, 0x26, 0x03, 0x03, 0x00, 0x00, 0x9b, 0x9d, 0x27, 0x03, 
-0x03, 0x00, 0x00, 0xf4, 0xf8, 0x28, 0x03, 0x03, 0x00, 0x00, 0xef, 0xf9, 0x29, 0x02, 0x03, 0x00, 
-0x00, 0xee, 0x2b, 0x03, 0x03, 0x00, 0x00, 0xaa, 0xdd, 0x2c, 0x03, 0x03, 0x00, 0x00, 0x91, 0x92, 
-0x2e, 0x03, 0x03, 0x00, 0x00, 0xb8, 0xbd, 0x31, 0x03, 0x03, 0x00, 0x00, 0xa4, 0xa5, 0x32, 0x02, 
-0x03, 0x00, 0x00, 0xe6, 0x33, 0x03, 0x03, 0x00, 0x00, 0x87, 0x80, 0x34, 0x02, 0x03, 0x00, 0x00, 
-0xfa, 0x35, 0x02, 0x03, 0x00, 0x00, 0xa8, 0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0xad, 0xfb, 0x03, 
-0x02, 0x03, 0x00, 0x00, 0xfd, 0x04, 0x02, 0x03, 0x00, 0x00, 0xfc, 0x05, 0x03, 0x03, 0x00, 0x00, 
-0xcf, 0x9c, 0x07, 0x02, 0x03, 0x00, 0x00, 0xac, 0x08, 0x02, 0x03, 0x00, 0x00, 0xab, 0x09, 0x02, 
-0x03, 0x00, 0x00, 0xf3, 0x0c, 0x02, 0x03, 0x00, 0x00, 0xbe, 0x0d, 0x03, 0x03, 0x00, 0x00, 0x9e, 
-0xf6, 0x10, 0x03, 0x03, 0x00, 0x00, 0x84, 0x8e, 0x11, 0x03, 0x03, 0x00, 0x00, 0x86, 0x8f, 0x12, 
-0x03, 0x03, 0x00, 0x00, 0x82, 0x90, 0x13, 0x02, 0x03, 0x00, 0x00, 0xa9, 0x14, 0x03, 0x03, 0x00, 
-0x00, 0xe7, 0xe8, 0x15, 0x03, 0x03, 0x00, 0x00, 0x81, 0x9a, 0x16, 0x03, 0x03, 0x00, 0x00, 0xa3, 
-0xe9, 0x17, 0x03, 0x03, 0x00, 0x00, 0xa1, 0xd6, 0x18, 0x83, 0x03, 0x00, 0x18, 0x00, 0x18, 0xa2, 
-0x18, 0xe0, 0x00, 0x19, 0x03, 0x03, 0x00, 0x00, 0x94, 0x99, 0x1a, 0x02, 0x03, 0x00, 0x00, 0xae, 
-0x1b, 0x02, 0x03, 0x00, 0x00, 0xaf, 0x1e, 0x03, 0x03, 0x00, 0x00, 0xa0, 0xb5, 0x1f, 0x03, 0x03, 
-0x00, 0x00, 0xe1, 0xf5, 0x20, 0x03, 0x03, 0x00, 0x00, 0xd0, 0xd1, 0x21, 0x02, 0x03, 0x00, 0x00, 
-0x9f, 0x26, 0x03, 0x03, 0x00, 0x00, 0x9b, 0x9d, 0x27, 0x03, 0x03, 0x00, 0x00, 0xf4, 0xf8, 0x28, 
-0x03, 0x03, 0x00, 0x00, 0xef, 0xf9, 0x29, 0x02, 0x03, 0x00, 0x00, 0xee, 0x2b, 0x03, 0x03, 0x00, 
-0x00, 0xaa, 0xdd, 0x2c, 0x03, 0x03, 0x00, 0x00, 0x91, 0x92, 0x2e, 0x03, 0x03, 0x00, 0x00, 0xb8, 
-0xbd, 0x31, 0x03, 0x03, 0x00, 0x00, 0xa4, 0xa5, 0x32, 0x02, 0x03, 0x00, 0x00, 0xe6, 0x33, 0x03, 
-0x03, 0x00, 0x00, 0x87, 0x80, 0x34, 0x02, 0x03, 0x00, 0x00, 0xfa, 0x35, 0x02, 0x03, 0x00, 0x00, 
-0xa8, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0xad, 0x03, 0x02, 0x03, 0x00, 0x00, 0xfd, 0x05, 0x03, 
-0x07, 0x00, 0x00, 0x00, 0x9c, 0x07, 0x02, 0x03, 0x00, 0x00, 0xac, 0x08, 0x02, 0x03, 0x00, 0x00, 
-0xab, 0x0c, 0x02, 0x03, 0x00, 0x00, 0x9d, 0x0d, 0x03, 0x07, 0x00, 0x00, 0x00, 0xf6, 0x10, 0x03, 
-0x03, 0x00, 0x00, 0x84, 0x8e, 0x11, 0x03, 0x03, 0x00, 0x00, 0x86, 0x8f, 0x12, 0x03, 0x03, 0x00, 
-0x00, 0x82, 0x90, 0x15, 0x03, 0x03, 0x00, 0x00, 0x81, 0x9a, 0x16, 0x02, 0x03, 0x00, 0x00, 0xa3, 
-0x17, 0x02, 0x03, 0x00, 0x00, 0xa1, 0x18, 0x02, 0x03, 0x00, 0x00, 0xa2, 0x19, 0x03, 0x03, 0x00, 
-0x00, 0x94, 0x99, 0x1a, 0x02, 0x03, 0x00, 0x00, 0xae, 0x1b, 0x02, 0x03, 0x00, 0x00, 0xaf, 0x1e, 
-0x02, 0x03, 0x00, 0x00, 0xa0, 0x1f, 0x03, 0x03, 0x00, 0x00, 0xe1, 0x15, 0x21, 0x02, 0x03, 0x00, 
-0x00, 0x9f, 0x27, 0x03, 0x03, 0x00, 0x00, 0x14, 0xf8, 0x2b, 0x02, 0x03, 0x00, 0x00, 0xaa, 0x2c, 
-0x03, 0x03, 0x00, 0x00, 0x91, 0x92, 0x2e, 0x03, 0x07, 0x00, 0x00, 0x00, 0x9b, 0x31, 0x03, 0x03, 
-0x00, 0x00, 0xa4, 0xa5, 0x32, 0x02, 0x03, 0x00, 0x00, 0xe6, 0x33, 0x03, 0x03, 0x00, 0x00, 0x87, 
-0x80, 0x34, 0x02, 0x03, 0x00, 0x00, 0xfa, 0x35, 0x02, 0x03, 0x00, 0x00, 0xa8, 0x00, 0x60, 0x06, 
-0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x20, 0x60, 0x7e, 0x03, 0x6e, 0xa4, 
-0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x06, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 
-0x20, 0x5e, 0x27, 0x09, 0x61, 0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 
-0x43, 0x80, 0x45, 0x90, 0x20, 0x27, 0x22, 0x0a, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 
-0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x00, 0x60, 0x0b, 0x61, 
-0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 
-0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 
-0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 
-0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0xef, 0x0f, 0x61, 
-0xa0, 0x63, 0x87, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x79, 0xec, 0x41, 0xb5, 0x43, 
-0x80, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x59, 0xed, 0x20, 0x27, 0xf9, 0x0c, 0x61, 
-0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 
-0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x20, 0x22, 0x00, 0x05, 0x03, 0x03, 0x00, 0x00, 0xcf, 0x9c, 0x06, 
-0x02, 0x03, 0x00, 0x00, 0xd5, 0x0c, 0x02, 0x03, 0x00, 0x00, 0xbe, 0x11, 0x03, 0x03, 0x00, 0x00, 
-0x86, 0x8f, 0x13, 0x02, 0x03, 0x00, 0x00, 0xa9, 0x18, 0x03, 0x03, 0x00, 0x00, 0xab, 0xac, 0x1a, 
-0x02, 0x03, 0xcc, 0x00, 0xae, 0x1b, 0x02, 0x03, 0xcd, 0x00, 0xaf, 0x1e, 0x03, 0x03, 0x00, 0x00, 
-0x91, 0x92, 0x1f, 0x03, 0x07, 0x00, 0x00, 0x00, 0xf5, 0x26, 0x41, 0x00, 0x6c, 0x4c, 0x27, 0x03, 
-0x03, 0x00, 0x00, 0xf4, 0xf8, 0x28, 0x01, 0x02, 0x27, 0xcb, 0x2b, 0x03, 0x03, 0x00, 0x00, 0xaa, 
-0xdd, 0x2e, 0x03, 0x03, 0x00, 0x00, 0xb8, 0xbd, 0x32, 0x42, 0x00, 0x6d, 0x4d, 0xe6, 0x00, 0x60, 
-0x07, 0x61, 0x85, 0x65, 0x8a, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x55, 0xeb, 0x20, 0x60, 0x7e, 
-0x09, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x75, 0xe7, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x55, 
-0xe8, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 
-0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0x22, 0x09, 0x65, 0x89, 0x69, 
-0x8b, 0x75, 0x81, 0x79, 0x98, 0x45, 0xd3, 0x49, 0xd8, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x27, 
-0x0d, 0x61, 0xee, 0x65, 0xd0, 0x69, 0xf6, 0x6e, 0xec, 0x6f, 0xfa, 0x75, 0xfc, 0x41, 0xef, 0x45, 
-0xd1, 0x49, 0xf7, 0x4e, 0xed, 0x4f, 0xfb, 0x55, 0xfd, 0x20, 0x5b, 0x2d, 0x0b, 0x63, 0x87, 0x6c, 
-0x9b, 0x6d, 0x9e, 0x6e, 0xa6, 0x6f, 0xf1, 0x43, 0x80, 0x4c, 0x9d, 0x4d, 0x9f, 0x4e, 0xa7, 0x4f, 
-0xf2, 0x20, 0x5d, 0x00, 0x02, 0x03, 0x07, 0x00, 0x00, 0x00, 0xfb, 0x03, 0x02, 0x03, 0x00, 0x00, 
-0xfd, 0x04, 0x02, 0x03, 0x00, 0x00, 0xfc, 0x05, 0x03, 0x03, 0x00, 0x00, 0xcf, 0x9c, 0x06, 0x02, 
-0x03, 0x00, 0x00, 0xd5, 0x0d, 0x03, 0x07, 0x00, 0x00, 0x00, 0xf6, 0x11, 0x41, 0x00, 0x77, 0x57, 
-0x14, 0x41, 0x00, 0x74, 0x54, 0x18, 0x03, 0x03, 0x00, 0x00, 0xab, 0xac, 0x1a, 0x02, 0x03, 0x00, 
-0x00, 0xa6, 0x1b, 0x02, 0x03, 0x00, 0x00, 0xa7, 0x1e, 0x03, 0x03, 0x00, 0x00, 0x91, 0x92, 0x1f, 
-0x43, 0x00, 0x73, 0x53, 0xe1, 0xf5, 0x20, 0x41, 0x00, 0x64, 0x44, 0x24, 0x02, 0x03, 0x00, 0x00, 
-0xf2, 0x26, 0x41, 0x00, 0x6c, 0x4c, 0x27, 0x03, 0x03, 0x00, 0x00, 0xf4, 0xf8, 0x29, 0x02, 0x03, 
-0x00, 0x00, 0xee, 0x2b, 0x02, 0x03, 0x00, 0x00, 0xaa, 0x31, 0x03, 0x03, 0x00, 0x00, 0xbd, 0xbe, 
-0x32, 0x02, 0x03, 0x00, 0x00, 0xe6, 0x33, 0x02, 0x03, 0x00, 0x00, 0xae, 0x34, 0x02, 0x03, 0x00, 
-0x00, 0xaf, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 
-0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 
-0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 0x7e, 0x5e, 0x17, 0x61, 0x83, 0x65, 
-0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x77, 0xf7, 0x73, 0xf9, 0x64, 0xd0, 0x6c, 0x9b, 0x6e, 
-0x9e, 0x74, 0xe7, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x53, 0xdd, 0x57, 
-0xef, 0x44, 0xd1, 0x4c, 0x9d, 0x4e, 0x9f, 0x54, 0xe8, 0x20, 0x5e, 0x27, 0x0d, 0x61, 0xa0, 0x65, 
-0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x63, 0x87, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 
-0xe0, 0x55, 0xe9, 0x43, 0x80, 0x20, 0x27, 0x22, 0x0f, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6e, 
-0xa9, 0x6f, 0x94, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4e, 0xb8, 0x4f, 
-0x99, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0xad, 0x06, 0x02, 
-0x03, 0x00, 0x00, 0xd5, 0x12, 0x03, 0x03, 0x00, 0x00, 0xfa, 0xfb, 0x15, 0x03, 0x03, 0x00, 0x00, 
-0xec, 0xed, 0x18, 0x03, 0x03, 0x00, 0x00, 0xab, 0xac, 0x1a, 0x43, 0x00, 0x86, 0x8f, 0x5b, 0x7b, 
-0x1b, 0x43, 0x00, 0x9b, 0x9d, 0x5d, 0x7d, 0x1e, 0x03, 0x03, 0x00, 0x00, 0x91, 0x92, 0x1f, 0x03, 
-0x07, 0x00, 0x00, 0x00, 0xf5, 0x20, 0x03, 0x03, 0x00, 0x00, 0xd0, 0xd1, 0x22, 0x03, 0x03, 0x00, 
-0x00, 0xa9, 0xb8, 0x24, 0x03, 0x03, 0x00, 0x00, 0xbd, 0xbe, 0x27, 0x03, 0x07, 0x00, 0x00, 0x00, 
-0xf8, 0x2b, 0x02, 0x07, 0x00, 0x00, 0xcd, 0x30, 0x03, 0x03, 0x00, 0x00, 0xe7, 0xe8, 0x31, 0x03, 
-0x03, 0x00, 0x00, 0xa6, 0xa7, 0x32, 0x02, 0x03, 0x00, 0x00, 0xe6, 0x33, 0x02, 0x03, 0x00, 0x00, 
-0xae, 0x34, 0x02, 0x03, 0x00, 0x00, 0xaf, 0x35, 0x02, 0x03, 0x00, 0x00, 0xa8, 0x00, 0x60, 0x0b, 
-0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 
-0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x05, 0x61, 0xc6, 0x6e, 0xa4, 0x41, 0xc7, 0x4e, 0xa5, 
-0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 
-0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 0x20, 0x5e, 0x27, 0x0d, 0x61, 0xa0, 0x65, 0x82, 
-0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x63, 0x87, 0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 
-0x55, 0xe9, 0x43, 0x80, 0x20, 0x27, 0x22, 0x11, 0x61, 0x84, 0x65, 0x89, 0x86, 0xf1, 0x69, 0x8b, 
-0x6f, 0x94, 0x9b, 0x9e, 0x75, 0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x8f, 0xf2, 0x49, 0xd8, 
-0x4f, 0x99, 0x9d, 0x9f, 0x55, 0x9a, 0x59, 0xf3, 0x20, 0x22, 0xaa, 0x09, 0x61, 0x9c, 0x69, 0xf4, 
-0x6f, 0xe1, 0x9b, 0xfc, 0x41, 0xcf, 0x49, 0xf6, 0x4f, 0xee, 0x9d, 0xfd, 0x20, 0xaa, 0x00, 0x05, 
-0x02, 0x03, 0x00, 0x00, 0xcf, 0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x11, 0x03, 0x03, 0x00, 0x00, 
-0x94, 0x99, 0x12, 0x03, 0x03, 0x00, 0x00, 0x86, 0x8f, 0x13, 0x03, 0x03, 0x00, 0x00, 0x9c, 0xe6, 
-0x15, 0x03, 0x03, 0x00, 0x00, 0xec, 0xed, 0x16, 0x03, 0x03, 0x00, 0x00, 0xe1, 0xee, 0x17, 0x03, 
-0x03, 0x00, 0x00, 0x84, 0x8e, 0x18, 0x03, 0x03, 0x00, 0x00, 0xab, 0xac, 0x19, 0x03, 0x03, 0x00, 
-0x00, 0x9b, 0x9d, 0x1a, 0x02, 0x03, 0x00, 0x00, 0xa6, 0x1b, 0x02, 0x03, 0x00, 0x00, 0xa7, 0x1e, 
-0x03, 0x03, 0x00, 0x00, 0x91, 0x92, 0x1f, 0x03, 0x07, 0x00, 0x00, 0x00, 0xf5, 0x20, 0x03, 0x03, 
-0x00, 0x00, 0xd0, 0xd1, 0x21, 0x03, 0x03, 0x00, 0x00, 0x9f, 0x9e, 0x22, 0x03, 0x03, 0x00, 0x00, 
-0xa9, 0xb8, 0x23, 0x03, 0x03, 0x00, 0x00, 0xbd, 0xbe, 0x24, 0x03, 0x03, 0x00, 0x00, 0xf7, 0xef, 
-0x27, 0x03, 0x07, 0x00, 0x00, 0x00, 0xf8, 0x2b, 0x02, 0x03, 0x00, 0x00, 0xaa, 0x2e, 0x03, 0x03, 
-0x00, 0x00, 0xfa, 0xfb, 0x2f, 0x03, 0x03, 0x00, 0x00, 0xf9, 0xdd, 0x30, 0x03, 0x03, 0x00, 0x00, 
-0xe7, 0xe8, 0x31, 0x03, 0x03, 0x00, 0x00, 0xa8, 0xad, 0x33, 0x02, 0x03, 0x00, 0x00, 0xae, 0x34, 
-0x02, 0x03, 0x00, 0x00, 0xaf, 0x00, 0x60, 0x0b, 0x61, 0x85, 0x65, 0x8a, 0x69, 0x8d, 0x6f, 0x95, 
-0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x49, 0xde, 0x4f, 0xe3, 0x55, 0xeb, 0x20, 0x60, 0x7e, 0x0d, 
-0x61, 0xc6, 0x65, 0xfc, 0x69, 0xf1, 0x6f, 0xe4, 0x75, 0xf4, 0x6e, 0xa4, 0x41, 0xc7, 0x45, 0xfd, 
-0x49, 0xf2, 0x4f, 0xe5, 0x55, 0xf6, 0x4e, 0xa5, 0x20, 0x7e, 0x5e, 0x0b, 0x61, 0x83, 0x65, 0x88, 
-0x69, 0x8c, 0x6f, 0x93, 0x75, 0x96, 0x41, 0xb6, 0x45, 0xd2, 0x49, 0xd7, 0x4f, 0xe2, 0x55, 0xea, 
-0x20, 0x5e, 0x27, 0x0d, 0x61, 0xa0, 0x65, 0x82, 0x69, 0xa1, 0x6f, 0xa2, 0x75, 0xa3, 0x63, 0x87, 
-0x41, 0xb5, 0x45, 0x90, 0x49, 0xd6, 0x4f, 0xe0, 0x55, 0xe9, 0x43, 0x80, 0x20, 0x27, 0x22, 0x09, 
-0x65, 0x89, 0x69, 0x8b, 0x75, 0x81, 0x79, 0x98, 0x45, 0xd3, 0x49, 0xd8, 0x55, 0x9a, 0x59, 0xf3, 
-0x20, 0x22, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0xad, 0x05, 0x03, 0x03, 0x00, 0x00, 0xcf, 0x9c, 
-0x06, 0x02, 0x03, 0x00, 0x00, 0xd5, 0x10, 0x02, 0x03, 0x00, 0x00, 0xa6, 0x18, 0x03, 0x03, 0x00, 
-0x00, 0xab, 0xac, 0x19, 0x02, 0x03, 0x00, 0x00, 0xa7, 0x1a, 0x43, 0x00, 0x9e, 0x9f, 0x5b, 0x7b, 
-0x1b, 0x43, 0x00, 0x9b, 0x9d, 0x5d, 0x7d, 0x1e, 0x03, 0x03, 0x00, 0x00, 0x91, 0x92, 0x1f, 0x03, 
-0x07, 0x00, 0x00, 0x00, 0xf5, 0x27, 0x03, 0x07, 0x00, 0x00, 0x00, 0xf8, 0x29, 0x02, 0x07, 0x00, 
-0x00, 0xcd, 0x2b, 0x02, 0x03, 0x00, 0x00, 0xaa, 0x32, 0x02, 0x03, 0x00, 0x00, 0xe6, 0x33, 0x02, 
-0x03, 0x00, 0x00, 0xae, 0x34, 0x02, 0x03, 0x00, 0x00, 0xaf, 0x35, 0x02, 0x03, 0x00, 0x00, 0xa8, 
-0x00, 0x60, 0x07, 0x61, 0x85, 0x65, 0x8a, 0x75, 0x97, 0x41, 0xb7, 0x45, 0xd4, 0x55, 0xeb, 0x20, 
-0x60, 0x7e, 0x07, 0x61, 0xc6, 0x6e, 0xa4, 0x6f, 0xe4, 0x41, 0xc7, 0x4e, 0xa5, 0x4f, 0xe5, 0x20, 
-0x7e, 0x5e, 0x0f, 0x61, 0x83, 0x65, 0x88, 0x9e, 0xd0, 0x69, 0x8c, 0x6f, 0x93, 0x9b, 0xfa, 0x75, 
-0x96, 0x41, 0xb6, 0x45, 0xd2, 0x9f, 0xd1, 0x49, 0xd7, 0x4f, 0xe2, 0x9d, 0xfb, 0x55, 0xea, 0x20, 
-0x5e, 0x27, 0x11, 0x61, 0xa0, 0x65, 0x82, 0x9e, 0xf1, 0x69, 0xa1, 0x6f, 0xa2, 0x9b, 0xec, 0x75, 
-0xa3, 0x63, 0x87, 0x41, 0xb5, 0x45, 0x90, 0x9f, 0xf2, 0x49, 0xd6, 0x4f, 0xe0, 0x9d, 0xed, 0x55, 
-0xe9, 0x43, 0x80, 0x20, 0x27, 0x22, 0x0d, 0x61, 0x84, 0x65, 0x89, 0x69, 0x8b, 0x6f, 0x94, 0x75, 
-0x81, 0x79, 0x98, 0x41, 0x8e, 0x45, 0xd3, 0x49, 0xd8, 0x4f, 0x99, 0x55, 0x9a, 0x59, 0xf3, 0x20, 
-0x22, 0xee, 0x0d, 0x61, 0x86, 0x65, 0xbd, 0x9e, 0xe7, 0x69, 0xa9, 0x6f, 0xf4, 0x9b, 0xfc, 0x41, 
-0x8f, 0x45, 0xbe, 0x9f, 0xe8, 0x49, 0xb8, 0x4f, 0xf6, 0x9d, 0xfd, 0x20, 0xee, 0x00, 0x49, 0x4d, 
-0x01, 0x04, 0x00, 0x00, 0x55, 0x5a, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x62, 0xf3, 0x39, 0x01, 0x00, 0x00, 0x00, 0x00, 0x62, 0xf3, 0x44, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0x22, 0x40, 
-0x04, 0x02, 0x01, 0x00, 0xfc, 0x23, 0x05, 0x02, 0x01, 0x00, 0x3b, 0xfd, 0x07, 0x02, 0x01, 0x00, 
-0x3a, 0x5e, 0x08, 0x02, 0x01, 0x00, 0x3f, 0x26, 0x09, 0x02, 0x03, 0x00, 0x00, 0x24, 0x0c, 0x43, 
-0x00, 0xf3, 0xf2, 0x2d, 0x5f, 0x0d, 0x43, 0x00, 0xf9, 0xf8, 0x3d, 0x2b, 0x10, 0x41, 0x00, 0xa9, 
-0x89, 0x11, 0x41, 0x00, 0xe6, 0x96, 0x12, 0x41, 0x00, 0xe3, 0x93, 0x13, 0x41, 0x00, 0xaa, 0x8a, 
-0x14, 0x41, 0x00, 0xa5, 0x85, 0x15, 0x41, 0x00, 0xad, 0x8d, 0x16, 0x41, 0x00, 0xa3, 0x83, 0x17, 
-0x41, 0x00, 0xe8, 0x98, 0x18, 0x43, 0x00, 0xf7, 0xf6, 0xe9, 0x99, 0x19, 0x41, 0x00, 0xa7, 0x87, 
-0x1a, 0x42, 0x00, 0xe5, 0x95, 0x5b, 0x1b, 0x42, 0x00, 0xea, 0x9a, 0x5d, 0x1e, 0x41, 0x00, 0xe4, 
-0x94, 0x1f, 0x43, 0x00, 0xf5, 0xf4, 0xeb, 0x9b, 0x20, 0x41, 0x00, 0xa2, 0x82, 0x21, 0x41, 0x00, 
-0xa0, 0x80, 0x22, 0x41, 0x00, 0xaf, 0x8f, 0x23, 0xc1, 0x00, 0xe0, 0x00, 0x90, 0x23, 0x24, 0x41, 
-0x00, 0xae, 0x8e, 0x25, 0x41, 0x00, 0xab, 0x8b, 0x26, 0x41, 0x00, 0xa4, 0x84, 0x27, 0x41, 0x00, 
-0xa6, 0x86, 0x28, 0x41, 0x00, 0xed, 0x9d, 0x29, 0x41, 0x00, 0xf1, 0xf0, 0x2a, 0x04, 0x1f, 0x00, 
-0x00, 0x00, 0x00, 0x78, 0x2b, 0x02, 0x01, 0x00, 0x2f, 0x7c, 0x2c, 0x41, 0x00, 0xef, 0x9f, 0x2d, 
-0x41, 0x00, 0xe7, 0x97, 0x2e, 0x41, 0x00, 0xe1, 0x91, 0x2f, 0x41, 0x00, 0xac, 0x8c, 0x30, 0x41, 
-0x00, 0xa8, 0x88, 0x31, 0x41, 0x00, 0xe2, 0x92, 0x32, 0x41, 0x00, 0xec, 0x9c, 0x33, 0x42, 0x00, 
-0xa1, 0x81, 0x3c, 0x34, 0x42, 0x00, 0xee, 0x9e, 0x3e, 0x35, 0x01, 0x00, 0x2e, 0x2c, 0x00, 0x05, 
-0x02, 0x03, 0x00, 0x00, 0xfd, 0x36, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x38, 0xbe, 
-0x01, 0x09, 0x00, 0x00, 0x56, 0x49, 0x2c, 0xcd, 0x01, 0x56, 0x49, 0x02, 0x02, 0x00, 0x00, 0x00, 
-0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x75, 0x34, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x00, 
-0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-0x43, 0x00, 0xe5, 0xc5, 0x31, 0x21, 0x03, 0x43, 0x00, 0xe2, 0xc2, 0x32, 0x40, 0x04, 0x43, 0x00, 
-0xea, 0xca, 0x33, 0x23, 0x05, 0x43, 0x00, 0xf4, 0xd4, 0x34, 0x24, 0x06, 0x03, 0x03, 0xc8, 0xc8, 
-0x35, 0x25, 0x07, 0x03, 0x03, 0xc9, 0xc9, 0x36, 0x5e, 0x08, 0x03, 0x03, 0xca, 0xca, 0x37, 0x26, 
-0x09, 0x03, 0x03, 0xcb, 0xcb, 0x38, 0x2a, 0x0a, 0x03, 0x03, 0xcc, 0xcc, 0x39, 0x28, 0x0b, 0xc3, 
-0x00, 0xf0, 0x00, 0xd0, 0x0b, 0x30, 0x81, 0x29, 0x81, 0x12, 0x41, 0x00, 0x65, 0x45, 0x15, 0x41, 
-0x00, 0x79, 0x59, 0x16, 0x41, 0x00, 0x75, 0x55, 0x17, 0x41, 0x00, 0x69, 0x49, 0x18, 0x41, 0x00, 
-0x6f, 0x4f, 0x1a, 0x43, 0x00, 0xdf, 0xbf, 0x5b, 0x7b, 0x1b, 0x43, 0x00, 0xbd, 0xb4, 0x5d, 0x7d, 
-0x1e, 0x41, 0x00, 0x61, 0x41, 0x39, 0x00, 0x00, 0x20, 0x00, 0x60, 0x19, 0x61, 0xe0, 0xe5, 0xa2, 
-0xe2, 0xa5, 0x65, 0xe8, 0xea, 0xab, 0x69, 0xec, 0x6f, 0xf2, 0xf4, 0xb0, 0xbd, 0xb6, 0x75, 0xf9, 
-0xdf, 0xd7, 0x79, 0xcf, 0x41, 0xc0, 0xc5, 0x82, 0xc2, 0x85, 0x45, 0xc8, 0xca, 0x8b, 0x49, 0xcc, 
-0x4f, 0xd2, 0xd4, 0x90, 0xb4, 0x96, 0x55, 0xd9, 0xbf, 0xbb, 0x59, 0x9f, 0x20, 0x60, 0x22, 0x19, 
-0x61, 0xe4, 0xe5, 0xc6, 0xe2, 0xa6, 0x65, 0xeb, 0xea, 0xac, 0x69, 0xef, 0x6f, 0xf6, 0xf4, 0xb1, 
-0xbd, 0xb7, 0x75, 0xfc, 0xdf, 0xd8, 0x79, 0xd6, 0x41, 0xc4, 0xc5, 0x02, 0xc2, 0x86, 0x45, 0xcb, 
-0xca, 0x8c, 0x49, 0x9b, 0x4f, 0x99, 0xd4, 0x91, 0xb4, 0x97, 0x55, 0x9c, 0xbf, 0xbc, 0x59, 0x14, 
-0x20, 0x22, 0x7e, 0x19, 0x61, 0xe3, 0xe5, 0xc7, 0xe2, 0xe7, 0x65, 0xa8, 0xea, 0xad, 0x69, 0xee, 
-0x6f, 0xf5, 0xf4, 0xb2, 0xbd, 0xde, 0x75, 0xfb, 0xdf, 0xe6, 0x79, 0xdb, 0x41, 0xc3, 0xc5, 0x05, 
-0xc2, 0x06, 0x45, 0x88, 0xca, 0x8d, 0x49, 0xce, 0x4f, 0xa0, 0xd4, 0x92, 0xb4, 0xb3, 0x55, 0x9d, 
-0xbf, 0xff, 0x59, 0x19, 0x20, 0x7e, 0x27, 0x19, 0x61, 0xe1, 0xe5, 0xa1, 0xe2, 0xa4, 0x65, 0xe9, 
-0xea, 0xaa, 0x69, 0xed, 0x6f, 0xf3, 0xf4, 0xaf, 0xbd, 0xbe, 0x75, 0xfa, 0xdf, 0xd1, 0x79, 0xfd, 
-0x41, 0xc1, 0xc5, 0x81, 0xc2, 0x84, 0x45, 0xc9, 0xca, 0x8a, 0x49, 0xcd, 0x4f, 0xd3, 0xd4, 0x8f, 
-0xb4, 0x95, 0x55, 0xda, 0xbf, 0xba, 0x59, 0xdd, 0x20, 0x27, 0x2e, 0x19, 0x61, 0xd5, 0xe5, 0xa3, 
-0xe2, 0xa7, 0x65, 0xa9, 0xea, 0xae, 0x69, 0xb8, 0x6f, 0xf7, 0xf4, 0xb5, 0xbd, 0xfe, 0x75, 0xf8, 
-0xdf, 0xf1, 0x79, 0xdc, 0x41, 0x80, 0xc5, 0x83, 0xc2, 0x87, 0x45, 0x89, 0xca, 0x8e, 0x49, 0x98, 
-0x4f, 0x9a, 0xd4, 0x93, 0xb4, 0x94, 0x55, 0x9e, 0xbf, 0xb9, 0x59, 0x1e, 0x20, 0x2e, 0x00, 0x5c, 
-0x00, 0x00 };
+0x20, 0x6f, 0x66, 0x20, 0x33, 0x04, 0x00, 0x04, 0x00, 0x00, 0x41, 0x5a, 0x13, 0x00, 0x13, 0x00, 
+0x00, 0x42, 0x4c, 0x2c, 0x00, 0x00, 0x42, 0x59, 0x2c, 0xcf, 0x01, 0x42, 0x4c, 0x2c, 0xcf, 0x01, 
+0x42, 0x59, 0x04, 0x00, 0x04, 0x00, 0x00, 0x42, 0x4e, 0x13, 0x00, 0x13, 0x00, 0x00, 0x45, 0x54, 
+0x2c, 0x00, 0x00, 0x45, 0x45, 0x2c, 0xc6, 0x01, 0x45, 0x54, 0x2c, 0xc6, 0x01, 0x45, 0x45, 0x04, 
+0x00, 0x04, 0x00, 0x00, 0x46, 0x4f, 0x04, 0x00, 0x04, 0x00, 0x00, 0x48, 0x59, 0x04, 0x00, 0x04, 
+0x00, 0x00, 0x4b, 0x41, 0x04, 0x00, 0x04, 0x00, 0x00, 0x4b, 0x4b, 0x04, 0x00, 0x04, 0x00, 0x00, 
+0x4b, 0x59, 0x09, 0x00, 0x09, 0x00, 0x00, 0x4c, 0x54, 0x2c, 0xd4, 0x00, 0x4c, 0x54, 0x04, 0x00, 
+0x04, 0xd2, 0x00, 0x4c, 0x54, 0x04, 0x00, 0x04, 0xd3, 0x00, 0x4c, 0x54, 0x04, 0x00, 0x04, 0xdd, 
+0x00, 0x4c, 0x54, 0x04, 0x00, 0x04, 0xc8, 0x01, 0x4c, 0x54, 0x04, 0x00, 0x04, 0x00, 0x00, 0x4c, 
+0x56, 0x04, 0x00, 0x04, 0xc7, 0x01, 0x4c, 0x56, 0x09, 0x00, 0x09, 0x00, 0x00, 0x4d, 0x4b, 0x2c, 
+0xc1, 0x01, 0x4d, 0x4b, 0x09, 0x00, 0x09, 0x00, 0x00, 0x4d, 0x4e, 0x2c, 0x00, 0x00, 0x4d, 0x4f, 
+0x09, 0x00, 0x09, 0x00, 0x00, 0x4d, 0x54, 0x2c, 0x00, 0x00, 0x4d, 0x4c, 0x09, 0x00, 0x09, 0x2f, 
+0x00, 0x4d, 0x54, 0x2c, 0x2f, 0x00, 0x4d, 0x4c, 0x04, 0x00, 0x04, 0x00, 0x00, 0x4e, 0x45, 0x04, 
+0x00, 0x04, 0x00, 0x00, 0x4e, 0x47, 0x04, 0x00, 0x04, 0x00, 0x00, 0x50, 0x48, 0x09, 0x00, 0x09, 
+0x00, 0x00, 0x53, 0x51, 0x2c, 0xc4, 0x01, 0x53, 0x51, 0x04, 0x00, 0x04, 0xc0, 0x01, 0x53, 0x51, 
+0x04, 0x00, 0x04, 0x00, 0x00, 0x54, 0x4a, 0x04, 0x00, 0x04, 0x00, 0x00, 0x54, 0x4d, 0x09, 0x00, 
+0x09, 0x00, 0x00, 0x55, 0x52, 0x2c, 0x00, 0x00, 0x55, 0x41, 0x09, 0x00, 0x09, 0xd1, 0x01, 0x55, 
+0x52, 0x2c, 0xd1, 0x01, 0x55, 0x41, 0x09, 0x00, 0x09, 0x00, 0x00, 0x55, 0x58, 0x2c, 0x67, 0x00, 
+0x55, 0x58, 0x04, 0x00, 0x04, 0x00, 0x00, 0x55, 0x5a, 0x09, 0x00, 0x09, 0x00, 0x00, 0x56, 0x49, 
+0x2c, 0xcd, 0x01, 0x56, 0x49 };
+
+static const kcl_builtin_layout layout_keybrd3sys_layouts[32] = {
+{ 53, 55, 621 }, { 60, 678, 1218 }, { 82, 1898, 521 }, { 89, 2421, 844 },
+{ 111, 3267, 481 }, { 118, 3750, 351 }, { 125, 4103, 865 }, { 132, 4970, 368 },
+{ 139, 5340, 325 }, { 146, 5667, 1377 }, { 158, 7046, 923 }, { 165, 7971, 1417 },
+{ 172, 9390, 1571 }, { 179, 10963, 2139 }, { 186, 13104, 1163 }, { 193, 14269, 1534 },
+{ 200, 15805, 872 }, { 212, 16679, 354 }, { 224, 17035, 169 }, { 236, 17206, 127 },
+{ 248, 17335, 501 }, { 255, 17838, 289 }, { 262, 18129, 509 }, { 269, 18640, 182 },
+{ 281, 18824, 866 }, { 288, 19692, 342 }, { 295, 20036, 368 }, { 302, 20406, 1668 },
+{ 314, 22076, 1800 }, { 326, 23878, 2457 }, { 338, 26337, 334 }, { 345, 26673, 447 }
+};
+
+static const Bit8u layout_keybrd3sys_compressed[10118] = {
+0xdd, 0x7d, 0x09, 0x58, 0x54, 0xc7, 0xb6, 0x6e, 0xed, 0xde, 0x9b, 0x49, 0xe1, 0x0b, 0xa8, 0xa8, 
+0x80, 0x91, 0x06, 0xc1, 0xee, 0x96, 0x06, 0x54, 0xc0, 0xc4, 0x24, 0x0e, 0xbb, 0x5b, 0x92, 0x10, 
+0x07, 0x92, 0x28, 0x26, 0x4e, 0x28, 0x31, 0x9c, 0x1c, 0x72, 0x8c, 0xdc, 0x68, 0x38, 0x89, 0x8a, 
+0x1c, 0x04, 0xc4, 0x59, 0x9c, 0x27, 0xa6, 0x76, 0x62, 0x70, 0xbc, 0xef, 0xbe, 0x10, 0x7d, 0xef, 
+0x5e, 0xcc, 0xd1, 0x38, 0xa2, 0x39, 0xa2, 0xe2, 0x70, 0xef, 0x13, 0x8d, 0x23, 0x8a, 0x20, 0x32, 
+0xcf, 0x39, 0x77, 0xad, 0xaa, 0xdd, 0x74, 0x37, 0x34, 0x08, 0x6a, 0x6e, 0xf2, 0x3d, 0xfd, 0x52, 
+0x05, 0xd8, 0xec, 0xbd, 0xfe, 0xb5, 0x56, 0xad, 0xa1, 0x6a, 0xad, 0xca, 0x58, 0xed, 0xbb, 0x84, 
+0xe3, 0x7c, 0xde, 0x0f, 0x9f, 0x3b, 0x2f, 0xe2, 0xeb, 0xa8, 0x70, 0xf9, 0x87, 0xe1, 0xf3, 0x22, 
+0xe7, 0xfe, 0x73, 0x4c, 0xf0, 0x44, 0xf9, 0xec, 0xc8, 0xcf, 0xc3, 0xff, 0x25, 0xec, 0x8b, 0xf0, 
+0xf9, 0x72, 0x6f, 0xf9, 0x9c, 0x88, 0xcf, 0xe6, 0x85, 0xcd, 0x5b, 0x20, 0x1f, 0xe0, 0x27, 0x8f, 
+0xfc, 0x93, 0xdc, 0x6f, 0x8e, 0x4c, 0x20, 0x44, 0x9c, 0x6a, 0xc1, 0x13, 0xf8, 0x63, 0x4b, 0x4c, 
+0xff, 0x4c, 0xa2, 0xe3, 0x67, 0x4f, 0xa6, 0x70, 0x6c, 0xde, 0xc3, 0xbe, 0xbf, 0x17, 0x2a, 0x63, 
+0xf3, 0x46, 0xfa, 0x73, 0x62, 0x4d, 0x46, 0xd3, 0xf9, 0x7d, 0x22, 0x7d, 0xcb, 0xfe, 0xf0, 0x32, 
+0x8e, 0xb8, 0x8f, 0x16, 0x60, 0x54, 0x0c, 0xb0, 0xe0, 0x79, 0xa2, 0xf3, 0x98, 0x60, 0xc9, 0x71, 
+0xe4, 0x2d, 0x6b, 0x19, 0xbc, 0x6c, 0xa0, 0x0d, 0xfc, 0xfc, 0xed, 0x41, 0xdd, 0x60, 0x1c, 0xb5, 
+0xa8, 0x3b, 0x8c, 0x9e, 0x8b, 0x55, 0x3c, 0x51, 0x29, 0x67, 0x4c, 0xf3, 0x92, 0x11, 0x75, 0xf4, 
+0x74, 0x3f, 0xfc, 0xd0, 0x3b, 0xfe, 0x38, 0x8e, 0x0c, 0x90, 0x11, 0x9f, 0x51, 0xbe, 0xc4, 0x0a, 
+0x7e, 0x59, 0x6d, 0x0d, 0x83, 0x8f, 0xbd, 0x48, 0xb2, 0x57, 0x38, 0x88, 0xe4, 0xe1, 0x96, 0x1e, 
+0x22, 0xb9, 0xb7, 0xb1, 0xa7, 0x48, 0xf6, 0xad, 0xec, 0x25, 0x92, 0xbd, 0x4b, 0x1d, 0x45, 0x72, 
+0x70, 0x4d, 0x6f, 0x91, 0xec, 0x8e, 0xef, 0x23, 0x92, 0x47, 0xdb, 0xfa, 0x8a, 0xe4, 0xf1, 0x76, 
+0x27, 0x91, 0x64, 0x2e, 0x73, 0x16, 0xc9, 0x83, 0xcd, 0x2e, 0x22, 0x29, 0xde, 0xd1, 0x5f, 0x24, 
+0xf7, 0x37, 0xb9, 0x8a, 0xe4, 0x49, 0xb2, 0x5c, 0x24, 0xbb, 0xe2, 0xdc, 0x44, 0xa2, 0x8b, 0x75, 
+0x17, 0xc9, 0xe1, 0xa4, 0x01, 0xc7, 0xc9, 0x2f, 0x64, 0xdd, 0x00, 0x0f, 0x91, 0x1c, 0x5a, 0xeb, 
+0x29, 0x92, 0xfd, 0xab, 0x06, 0x8a, 0x64, 0x4f, 0x82, 0x42, 0x24, 0x19, 0x89, 0x4a, 0x91, 0x94, 
+0xa6, 0x0e, 0x12, 0x5c, 0x11, 0xd5, 0x77, 0x6a, 0x91, 0x94, 0xa5, 0x7b, 0x8b, 0xa4, 0x68, 0xab, 
+0x8f, 0x48, 0xee, 0xac, 0xf7, 0x15, 0xc9, 0x81, 0xd5, 0x83, 0x45, 0x92, 0xb5, 0x7c, 0x88, 0x48, 
+0xee, 0x6e, 0x18, 0x2a, 0x92, 0x92, 0x14, 0x3f, 0x91, 0xec, 0x5c, 0xe2, 0x2f, 0x92, 0xa7, 0x69, 
+0x94, 0xe8, 0x4a, 0x24, 0xba, 0xdc, 0x41, 0x4b, 0xaa, 0xab, 0xbe, 0xfd, 0x04, 0x28, 0x69, 0x6a, 
+0x04, 0x4a, 0x6a, 0x6b, 0xe0, 0xd1, 0xbf, 0x36, 0xc3, 0xa3, 0xeb, 0xeb, 0xe0, 0xf3, 0x95, 0x15, 
+0xfe, 0xc7, 0x49, 0xb9, 0xff, 0x33, 0x32, 0x8c, 0xbd, 0x66, 0x81, 0x31, 0x5c, 0x2d, 0xf9, 0xf2, 
+0x03, 0x00, 0xac, 0x25, 0xcd, 0x53, 0x9e, 0x0b, 0x59, 0x4b, 0xfe, 0xdc, 0x64, 0x02, 0x5a, 0x0b, 
+0xcf, 0x7e, 0x41, 0xd8, 0x48, 0x71, 0x0b, 0xf0, 0x85, 0x6a, 0x2d, 0x10, 0xdd, 0x11, 0x74, 0x2d, 
+0x40, 0x01, 0xf0, 0x5a, 0x61, 0xe7, 0x12, 0x32, 0xd2, 0xff, 0x27, 0x0a, 0xe7, 0xa9, 0x7f, 0x9a, 
+0xbf, 0x1e, 0xd3, 0x22, 0x52, 0x72, 0x5c, 0xe8, 0x49, 0x88, 0x66, 0x9c, 0x1a, 0x86, 0x29, 0xea, 
+0x8b, 0x1c, 0x7c, 0x05, 0xc3, 0x94, 0xee, 0x66, 0xb5, 0x2f, 0x81, 0x8e, 0x1f, 0xf1, 0x79, 0x1c, 
+0x9b, 0x7f, 0xa1, 0xdf, 0xff, 0x45, 0x38, 0x2b, 0x63, 0xf3, 0x6d, 0xfa, 0xf3, 0x3f, 0xf3, 0xdf, 
+0xf3, 0x6c, 0xbe, 0x4e, 0x7f, 0xfe, 0x09, 0xbf, 0x47, 0x60, 0xf3, 0x39, 0xfa, 0xf3, 0xa9, 0xfc, 
+0x7f, 0xd2, 0xdf, 0xfb, 0x98, 0x27, 0xa4, 0x63, 0x6d, 0x85, 0x0f, 0x80, 0xb6, 0xc2, 0x38, 0xc0, 
+0x02, 0xc7, 0x8b, 0x56, 0x38, 0x86, 0xea, 0xb5, 0x15, 0x46, 0x8f, 0x6e, 0x38, 0x1e, 0xea, 0x8e, 
+0xe3, 0x61, 0x67, 0x1c, 0xa7, 0xb9, 0xe0, 0x38, 0xc3, 0x0b, 0xc7, 0x68, 0x53, 0x95, 0x85, 0xd1, 
+0x97, 0xf4, 0xd0, 0xc0, 0x74, 0x95, 0xf0, 0x20, 0x45, 0x77, 0x0b, 0x99, 0x05, 0x79, 0x5b, 0x67, 
+0x45, 0x57, 0x00, 0x0c, 0xa3, 0xba, 0xc9, 0xac, 0x08, 0xd1, 0x75, 0xa7, 0xa3, 0x91, 0x42, 0x6b, 
+0x40, 0xba, 0x8d, 0x4c, 0xbc, 0x5a, 0x10, 0x6f, 0x65, 0x05, 0x13, 0xb0, 0x16, 0x04, 0xdc, 0xdc, 
+0xd4, 0x47, 0x0b, 0x22, 0x7e, 0xbc, 0xbd, 0x2f, 0xaa, 0x8f, 0x91, 0x88, 0x61, 0x85, 0x29, 0x98, 
+0x80, 0xb5, 0x20, 0xe0, 0xe2, 0x1d, 0x5d, 0x12, 0x71, 0x69, 0x6a, 0x75, 0x95, 0x0a, 0x74, 0x4f, 
+0xf5, 0x8c, 0xe8, 0x55, 0xdc, 0x0b, 0xe8, 0xf3, 0x35, 0xab, 0xe7, 0x28, 0x62, 0xf3, 0x9a, 0x1e, 
+0x00, 0x8a, 0xaa, 0x26, 0x16, 0x14, 0x0e, 0x85, 0xdd, 0xd8, 0xa2, 0xc9, 0x12, 0x7c, 0x58, 0xef, 
+0x8d, 0xcf, 0x85, 0x6f, 0x50, 0xee, 0xdf, 0x0b, 0xfd, 0xc2, 0x97, 0x41, 0x6f, 0x84, 0x7b, 0x11, 
+0xc3, 0x2d, 0xc0, 0x50, 0xd6, 0x5a, 0xf6, 0x00, 0x38, 0xf7, 0x18, 0x00, 0xde, 0xb3, 0x17, 0xe4, 
+0x5d, 0xf4, 0xe8, 0x22, 0x20, 0x3e, 0x7d, 0x06, 0x10, 0x67, 0x65, 0x27, 0x2e, 0x03, 0xc4, 0x05, 
+0x57, 0x61, 0x41, 0x1f, 0x38, 0x08, 0x78, 0xab, 0x6b, 0xea, 0x1b, 0x00, 0xef, 0x36, 0x5c, 0xd0, 
+0x95, 0x55, 0x80, 0x37, 0xe7, 0x07, 0x3d, 0xde, 0x7d, 0xfb, 0x01, 0x6f, 0x79, 0x45, 0x5a, 0x3a, 
+0xe0, 0x7d, 0x52, 0x82, 0x78, 0x77, 0x02, 0xde, 0x1b, 0x85, 0x03, 0x80, 0xde, 0xbb, 0x80, 0xf6, 
+0xda, 0x75, 0x40, 0x9b, 0x7f, 0x09, 0xd0, 0x66, 0x64, 0x02, 0xda, 0xc7, 0xc5, 0x60, 0x6a, 0x6a, 
+0xeb, 0x54, 0x22, 0x49, 0x58, 0x2a, 0x21, 0x8d, 0x66, 0x48, 0x8f, 0x93, 0x5b, 0xea, 0x5f, 0x08, 
+0x60, 0x6d, 0x6c, 0x02, 0xac, 0xf7, 0xee, 0x03, 0xd6, 0xcb, 0x57, 0x00, 0xeb, 0xca, 0x55, 0x47, 
+0x8e, 0x02, 0xd6, 0x07, 0x0f, 0x01, 0x6b, 0xe9, 0x53, 0xc0, 0xba, 0x6b, 0x37, 0x60, 0x4d, 0x49, 
+0x6d, 0x23, 0xe9, 0x8b, 0x12, 0xe2, 0xc5, 0xc6, 0x88, 0x61, 0x78, 0xdb, 0x2c, 0x60, 0xe0, 0xe9, 
+0xa3, 0xdf, 0x07, 0x6f, 0xcc, 0xcb, 0xe0, 0x95, 0x30, 0xfe, 0x8d, 0x68, 0xad, 0xd1, 0x65, 0x6a, 
+0x26, 0xc8, 0xa8, 0x99, 0xb1, 0x20, 0xe6, 0xfe, 0x8c, 0x8d, 0x1a, 0x43, 0xe6, 0x72, 0x6d, 0x8d, 
+0x8d, 0x40, 0x4c, 0x8d, 0x8e, 0x4c, 0x24, 0x03, 0x87, 0xf0, 0x1a, 0x12, 0x37, 0x34, 0x46, 0xd0, 
+0x10, 0x77, 0xbf, 0x01, 0x16, 0x1a, 0xee, 0xbc, 0xff, 0x22, 0xcb, 0x31, 0xd6, 0xca, 0x80, 0x69, 
+0xc4, 0xc5, 0x6a, 0x8c, 0xb5, 0xf7, 0xb0, 0x68, 0xe2, 0x6a, 0xad, 0x11, 0x56, 0xbe, 0x71, 0xd6, 
+0x66, 0x8c, 0xf5, 0xcc, 0x37, 0xa7, 0x93, 0x7e, 0xdd, 0x34, 0x64, 0xd9, 0xf0, 0xd0, 0xee, 0x1a, 
+0xb2, 0x74, 0xf0, 0x68, 0xdb, 0x31, 0xd6, 0xaa, 0xba, 0x19, 0xe4, 0x75, 0x3b, 0x94, 0xc3, 0x62, 
+0xfb, 0x53, 0x24, 0xac, 0xbf, 0xd8, 0x7f, 0x7d, 0xff, 0x0d, 0xfd, 0xb9, 0xfe, 0xa4, 0xbf, 0xc3, 
+0x29, 0x30, 0xda, 0x53, 0xd5, 0x09, 0xea, 0xb5, 0x6a, 0x67, 0x35, 0x51, 0xf7, 0xd0, 0x92, 0xf0, 
+0xc0, 0xd3, 0x67, 0x7a, 0x82, 0x2b, 0x26, 0x9b, 0xb6, 0x03, 0xdb, 0x17, 0x4c, 0x01, 0xb6, 0x47, 
+0x85, 0x00, 0xdb, 0x23, 0x82, 0xee, 0x3c, 0x05, 0xcf, 0x11, 0x19, 0x7c, 0xff, 0x81, 0x13, 0xfe, 
+0x73, 0x6d, 0x99, 0xf3, 0x98, 0xd7, 0xce, 0xe5, 0x11, 0xd2, 0xdf, 0x45, 0x6b, 0xe9, 0xa1, 0x23, 
+0x57, 0xfb, 0x9f, 0x22, 0x5f, 0xdb, 0x7f, 0x64, 0x4f, 0xe0, 0xaf, 0x03, 0xfc, 0xe7, 0x8a, 0x1f, 
+0xaa, 0x2f, 0x94, 0xe3, 0x94, 0x75, 0x70, 0x20, 0x4e, 0xfb, 0x0f, 0x28, 0x4e, 0x91, 0xaf, 0x86, 
+0x8e, 0x1f, 0x4a, 0xe0, 0xaf, 0x1d, 0xfc, 0xa7, 0x14, 0x65, 0x5b, 0x2f, 0x00, 0xfb, 0xd3, 0xd2, 
+0xbd, 0xb4, 0x24, 0x39, 0x75, 0xd0, 0x43, 0xf5, 0x29, 0xf2, 0xad, 0xc3, 0x27, 0x0e, 0x04, 0xfe, 
+0xf6, 0x81, 0xff, 0x80, 0xf7, 0xb3, 0xb5, 0x43, 0xb4, 0x64, 0xee, 0x84, 0x3d, 0x7b, 0x81, 0xe3, 
+0xea, 0x51, 0x7e, 0x5a, 0xf2, 0xb6, 0xcf, 0x3b, 0x87, 0xfc, 0xb5, 0xe4, 0x2d, 0xdf, 0x91, 0x87, 
+0x03, 0x44, 0xe2, 0x56, 0x3d, 0x9c, 0x10, 0xf9, 0x64, 0x91, 0xbc, 0x33, 0x92, 0xcc, 0x7a, 0x2d, 
+0x6c, 0x69, 0xf8, 0xca, 0xb4, 0xfc, 0x88, 0x35, 0x91, 0x9b, 0x93, 0x1b, 0xa2, 0xb6, 0x8a, 0x47, 
+0x02, 0x0b, 0xd2, 0x2f, 0x05, 0xdd, 0x0a, 0xbe, 0x97, 0xda, 0x18, 0xf2, 0x44, 0x3e, 0x2b, 0xb4, 
+0x7b, 0x58, 0x7c, 0xf8, 0xf2, 0x88, 0xd5, 0x91, 0x1b, 0xa3, 0xb6, 0x88, 0x3f, 0x04, 0x5e, 0x0e, 
+0xba, 0x1e, 0x7c, 0x37, 0xa4, 0x58, 0x1e, 0xea, 0x6e, 0x13, 0xbe, 0x22, 0x62, 0x55, 0xd4, 0x92, 
+0x05, 0xdb, 0x02, 0xaf, 0x04, 0xdd, 0x08, 0xd9, 0x31, 0xa5, 0x52, 0xee, 0xae, 0xe8, 0x19, 0xa6, 
+0x0b, 0x8f, 0x4b, 0x2b, 0x8f, 0xd8, 0x19, 0xb9, 0x2b, 0xb9, 0x24, 0x6a, 0xf7, 0xdc, 0x94, 0xd9, 
+0xcb, 0xc4, 0x9c, 0xc0, 0x75, 0xe9, 0x15, 0x41, 0xd7, 0x82, 0x7f, 0x49, 0x2d, 0x0d, 0x79, 0x3c, 
+0xe1, 0xa2, 0x36, 0x56, 0xae, 0xf0, 0x7c, 0x2d, 0x2c, 0x31, 0x3c, 0x23, 0xad, 0x28, 0x22, 0x3b, 
+0x32, 0x37, 0xb9, 0x29, 0xaa, 0x4a, 0x4c, 0x0a, 0xcc, 0x4c, 0x7f, 0x14, 0x74, 0x34, 0xf8, 0x58, 
+0x6a, 0x73, 0x48, 0x8d, 0xdc, 0x93, 0xfc, 0x3c, 0x96, 0x07, 0x77, 0x16, 0x38, 0x09, 0xdc, 0x59, 
+0x60, 0xa0, 0xfa, 0x34, 0x07, 0x5f, 0xc1, 0x10, 0x68, 0xc9, 0x9b, 0xd3, 0x8c, 0xe9, 0x74, 0xb4, 
+0xe2, 0xfb, 0x72, 0xa3, 0x39, 0x74, 0x47, 0x97, 0x64, 0xd7, 0x64, 0xe8, 0x9e, 0xfe, 0x4e, 0xe7, 
+0x69, 0xfc, 0x10, 0xd9, 0x44, 0x98, 0xa7, 0x0b, 0x39, 0xdc, 0xc9, 0x0e, 0x34, 0x87, 0xe7, 0x31, 
+0xa8, 0x1a, 0x2d, 0x20, 0xcb, 0x53, 0x52, 0x2c, 0xe0, 0xbb, 0x8b, 0x1e, 0x1e, 0xb8, 0xce, 0x06, 
+0x5a, 0xc3, 0xd7, 0xbe, 0x8b, 0x16, 0xd9, 0x08, 0x1c, 0x51, 0x4e, 0x9b, 0xe6, 0xd2, 0x0d, 0x66, 
+0xd5, 0x8c, 0x19, 0xaf, 0x77, 0x87, 0x1f, 0x8f, 0x58, 0xbc, 0xd8, 0x56, 0x20, 0x5e, 0xa3, 0xa6, 
+0x4f, 0xef, 0x67, 0xc7, 0xf1, 0xe7, 0xcf, 0xc2, 0x1a, 0x0c, 0x0f, 0x34, 0x52, 0x00, 0x11, 0x14, 
+0x00, 0x56, 0x5d, 0x64, 0x30, 0x2c, 0xb8, 0x25, 0x3b, 0x20, 0x62, 0xb8, 0xff, 0xa0, 0xba, 0x1a, 
+0x96, 0x5c, 0x98, 0x08, 0x11, 0xc3, 0xfc, 0x89, 0xb0, 0x9a, 0x36, 0x6d, 0x57, 0x8e, 0x11, 0x12, 
+0xd6, 0xe6, 0x85, 0xf6, 0x57, 0x71, 0xfc, 0x85, 0x73, 0x5e, 0x3c, 0x51, 0x0c, 0xda, 0xbf, 0x1f, 
+0x8c, 0xe4, 0xc2, 0xa9, 0x4c, 0x8e, 0x22, 0xc8, 0xd1, 0x0f, 0x4d, 0x3c, 0x38, 0x40, 0x58, 0xf4, 
+0x23, 0x03, 0x04, 0xe2, 0x3d, 0x33, 0x3a, 0xda, 0x95, 0x4a, 0x90, 0x07, 0x09, 0x46, 0x47, 0x13, 
+0xb4, 0x09, 0xe9, 0xb0, 0xf4, 0xe7, 0x7d, 0xec, 0xaa, 0x45, 0xbf, 0x78, 0x0c, 0xd6, 0xef, 0x17, 
+0xef, 0xc1, 0xaa, 0xfd, 0xcb, 0x58, 0x58, 0xb5, 0x73, 0xc6, 0xa9, 0xf1, 0xa7, 0x37, 0x2e, 0x92, 
+0x59, 0x28, 0xcb, 0x15, 0x54, 0x96, 0xd7, 0x45, 0x5d, 0x60, 0x69, 0xd0, 0x4e, 0x90, 0xe5, 0x19, 
+0xf9, 0xac, 0x18, 0x3e, 0xf2, 0x7e, 0xf0, 0x03, 0x79, 0x4c, 0x68, 0xcf, 0xb0, 0xfc, 0xf0, 0xcb, 
+0x11, 0x05, 0x51, 0xd7, 0xbe, 0x58, 0xfa, 0x97, 0xc7, 0x73, 0x9e, 0xcc, 0x2d, 0x99, 0xb7, 0x0a, 
+0xe4, 0x77, 0x24, 0x28, 0x37, 0xe4, 0xf4, 0x7b, 0x9b, 0xc7, 0x3e, 0x1a, 0x57, 0x3c, 0xe1, 0xe9, 
+0xc7, 0x2b, 0xe5, 0xa1, 0x65, 0x76, 0xb3, 0x97, 0x85, 0xc7, 0xcd, 0x2d, 0x8a, 0xdc, 0x35, 0x7f, 
+0xdb, 0xc2, 0xbd, 0xda, 0xd8, 0xc0, 0x75, 0x13, 0xee, 0x05, 0xff, 0x32, 0x71, 0xeb, 0xd4, 0x35, 
+0xf2, 0x32, 0x85, 0xd5, 0xec, 0x4b, 0xf3, 0xaf, 0x2e, 0xbc, 0xa1, 0xfd, 0x61, 0xe2, 0xb1, 0xa9, 
+0x17, 0xe5, 0x0a, 0x42, 0x49, 0xca, 0xbf, 0x44, 0x69, 0x28, 0x7a, 0x84, 0x34, 0x80, 0xbe, 0xa1, 
+0xb6, 0x31, 0x5d, 0x43, 0x4d, 0x43, 0x3d, 0x8b, 0xb1, 0x0a, 0x3b, 0x3d, 0x77, 0x4f, 0xe4, 0x7d, 
+0xf1, 0xcc, 0x84, 0xbd, 0x94, 0x96, 0x76, 0xf4, 0xae, 0xec, 0xb5, 0x30, 0x1d, 0xbe, 0x1d, 0x75, 
+0x2c, 0x6a, 0xf7, 0x82, 0x12, 0x31, 0x07, 0xdf, 0x8f, 0xfa, 0x15, 0xf2, 0x78, 0x4a, 0xa9, 0xbc, 
+0xec, 0xaf, 0x16, 0xf3, 0xf3, 0x17, 0x16, 0x4d, 0xbc, 0x34, 0xf5, 0x91, 0xfc, 0xaf, 0xc4, 0x12, 
+0xfd, 0xc6, 0x55, 0x16, 0x2c, 0x50, 0x3a, 0xea, 0x0b, 0xbd, 0xf8, 0xd7, 0xc0, 0xbc, 0xea, 0x28, 
+0x39, 0xb5, 0x65, 0x2f, 0x4d, 0x8e, 0xa2, 0x63, 0x72, 0x14, 0x40, 0x4e, 0xfd, 0xc2, 0xda, 0x89, 
+0x85, 0x53, 0xcb, 0x5a, 0x91, 0xa3, 0x22, 0x9c, 0x8e, 0xd0, 0xe1, 0xb7, 0xe6, 0x08, 0x49, 0xfc, 
+0x85, 0x03, 0x2d, 0x7f, 0x37, 0x58, 0x90, 0x99, 0x5b, 0x3e, 0x63, 0x5a, 0xa2, 0xb8, 0x26, 0x1a, 
+0xd5, 0x95, 0xd1, 0x79, 0x06, 0xff, 0x2d, 0xb7, 0x8d, 0x33, 0x58, 0x54, 0xa1, 0x55, 0xee, 0x81, 
+0xab, 0x04, 0x23, 0x8f, 0x8b, 0xd2, 0x1a, 0x91, 0xe1, 0x1a, 0xb1, 0xe1, 0x71, 0x89, 0xb8, 0x74, 
+0xe3, 0x71, 0x85, 0xbc, 0x8e, 0xc9, 0xc7, 0x88, 0xc5, 0xb6, 0x1c, 0xac, 0x0f, 0x3b, 0x19, 0x2c, 
+0x8e, 0xe8, 0xf6, 0x57, 0x87, 0x46, 0x48, 0x4c, 0xba, 0xe0, 0xa2, 0x11, 0xf2, 0x2f, 0x9d, 0xa3, 
+0xab, 0x03, 0x16, 0xc6, 0xfa, 0x0d, 0x4a, 0xad, 0x90, 0x9c, 0x9a, 0x07, 0xeb, 0x82, 0xec, 0xaf, 
+0xf6, 0x02, 0x5f, 0x35, 0xc8, 0xb0, 0x20, 0x86, 0x22, 0x0b, 0x1f, 0x9a, 0x2c, 0x0b, 0x1e, 0x96, 
+0xc5, 0x74, 0xc3, 0xaa, 0x98, 0xde, 0xcf, 0x84, 0xdb, 0xbf, 0x39, 0x93, 0xeb, 0x6d, 0xc3, 0x12, 
+0xd0, 0x20, 0x46, 0x6e, 0x42, 0x93, 0x28, 0xae, 0x45, 0xa3, 0x18, 0xbc, 0x3d, 0x64, 0x87, 0xbc, 
+0x1e, 0x56, 0x27, 0xa4, 0x68, 0x76, 0x84, 0xcb, 0x73, 0xd6, 0x80, 0x67, 0x3f, 0xef, 0xa2, 0x21, 
+0xab, 0x57, 0xc5, 0x28, 0xf1, 0xeb, 0x73, 0x88, 0xcd, 0x91, 0xcc, 0xe2, 0x91, 0x36, 0x30, 0xb5, 
+0x16, 0xf8, 0x6e, 0x7c, 0x33, 0xe8, 0x95, 0x1d, 0x9a, 0x52, 0xe9, 0x6d, 0xdb, 0xc4, 0x3d, 0xf0, 
+0xae, 0xbd, 0xc1, 0x19, 0x21, 0x99, 0x53, 0xb6, 0xca, 0x15, 0xee, 0xd6, 0xf8, 0x2e, 0x7c, 0x93, 
+0xb8, 0x96, 0xbe, 0xc3, 0x9d, 0x34, 0x86, 0xa2, 0x88, 0xdf, 0x9f, 0xc2, 0x9b, 0x0d, 0xf8, 0xd9, 
+0x9f, 0x78, 0xfe, 0x43, 0x8e, 0xcd, 0x63, 0x3a, 0x0c, 0xd8, 0x65, 0x10, 0x20, 0xee, 0x19, 0xe2, 
+0xc6, 0x6b, 0x49, 0xd1, 0xc3, 0xa1, 0xa3, 0x05, 0x2d, 0xd9, 0xb8, 0x01, 0xfc, 0xa7, 0x96, 0xec, 
+0xd4, 0xf9, 0x7b, 0x58, 0x6a, 0x49, 0x76, 0x56, 0x80, 0xa7, 0x95, 0x86, 0x3c, 0x7e, 0x34, 0xcc, 
+0x1a, 0x32, 0x11, 0xeb, 0x67, 0xe4, 0x8d, 0x98, 0x81, 0x31, 0x36, 0x98, 0x0c, 0xbd, 0x39, 0x08, 
+0x3c, 0xe8, 0x9a, 0xd5, 0xc3, 0xc1, 0x83, 0xee, 0xde, 0x35, 0xd8, 0x8e, 0x27, 0x4a, 0xd5, 0x08, 
+0x2f, 0x7b, 0x0c, 0x2a, 0x21, 0x40, 0x89, 0x8f, 0x03, 0xf1, 0x3f, 0x29, 0x06, 0x2b, 0x95, 0x99, 
+0xd1, 0xeb, 0x38, 0xb9, 0xd3, 0xeb, 0x17, 0x02, 0xaa, 0x50, 0x5d, 0x05, 0xaa, 0x90, 0x9a, 0x02, 
+0xaa, 0x90, 0xb4, 0x16, 0x54, 0x61, 0xfd, 0x3a, 0x08, 0x4f, 0x92, 0x77, 0x38, 0x6b, 0x49, 0x63, 
+0xc3, 0xb4, 0x45, 0x60, 0x2f, 0x9b, 0x9b, 0x66, 0x2c, 0x06, 0x8d, 0x28, 0x2d, 0x01, 0x7b, 0xb9, 
+0x34, 0x01, 0x02, 0x94, 0x15, 0xcb, 0x21, 0x40, 0x59, 0x82, 0x01, 0xe8, 0xfe, 0x7d, 0x10, 0xa0, 
+0x6c, 0xde, 0x04, 0x01, 0x4a, 0xd9, 0x53, 0x30, 0x75, 0xe9, 0x69, 0x60, 0xea, 0x1e, 0xdc, 0x57, 
+0x80, 0x32, 0x14, 0x2a, 0x65, 0x44, 0xf1, 0xab, 0xbb, 0x21, 0xe8, 0x26, 0xb7, 0x1c, 0xc1, 0xa2, 
+0x2e, 0x4b, 0x84, 0xd0, 0xe4, 0xde, 0x5d, 0xd0, 0xa2, 0x55, 0x2b, 0x21, 0x34, 0xd9, 0xba, 0x65, 
+0x30, 0xa6, 0x88, 0xa0, 0x4f, 0xdb, 0xb7, 0x81, 0x9b, 0x3c, 0x78, 0x00, 0xd5, 0xe9, 0x10, 0x55, 
+0xa7, 0xc3, 0xa8, 0x4e, 0xb7, 0x6f, 0xfa, 0x8e, 0x32, 0x24, 0x8d, 0xde, 0xb3, 0x78, 0x60, 0xf0, 
+0x58, 0xd1, 0xca, 0x2c, 0x83, 0x3f, 0xa7, 0x63, 0xce, 0xe3, 0xef, 0x38, 0x36, 0x67, 0xb2, 0xef, 
+0x4b, 0x43, 0x64, 0x6c, 0x5e, 0x42, 0x7f, 0xfe, 0x66, 0xd4, 0x38, 0x9e, 0xcd, 0x2c, 0xcf, 0xef, 
+0x4c, 0xc6, 0xd4, 0x36, 0x57, 0xea, 0x54, 0x7e, 0xd4, 0x12, 0x2f, 0x7a, 0xd2, 0x78, 0x91, 0x6e, 
+0x0f, 0x18, 0xe5, 0xbd, 0x1c, 0xd9, 0xb2, 0xc5, 0x81, 0x23, 0x3b, 0x76, 0xf4, 0xe0, 0xc8, 0xc6, 
+0x8d, 0x3d, 0x39, 0xb2, 0x62, 0x45, 0x2f, 0x8e, 0x24, 0x24, 0x38, 0x72, 0x64, 0xf5, 0xea, 0xde, 
+0x1c, 0x89, 0x8b, 0xeb, 0xc3, 0x91, 0x6d, 0xdb, 0xfa, 0x72, 0xe0, 0x0a, 0x9d, 0x38, 0x92, 0x98, 
+0xe8, 0xcc, 0x91, 0xb4, 0x34, 0x08, 0x18, 0x93, 0x93, 0xfb, 0x73, 0x64, 0xd3, 0x26, 0x57, 0x8e, 
+0x2c, 0x5b, 0x26, 0xe7, 0xc8, 0xd2, 0xa5, 0x6e, 0x1c, 0x89, 0x8d, 0x75, 0xe7, 0xc8, 0xda, 0xb5, 
+0x03, 0x38, 0xb2, 0x6e, 0x9d, 0x07, 0x47, 0xd6, 0xac, 0xf1, 0xe4, 0xc8, 0xca, 0x95, 0x03, 0x39, 
+0x12, 0x1f, 0x0f, 0xd2, 0x48, 0x4a, 0x52, 0x72, 0x64, 0xeb, 0x56, 0xd0, 0xf4, 0x5d, 0xbb, 0x8c, 
+0x24, 0x02, 0x16, 0x98, 0x23, 0xa9, 0xa9, 0xde, 0x1c, 0xd9, 0xbe, 0xdd, 0x87, 0x23, 0xeb, 0xd7, 
+0xfb, 0x72, 0x64, 0xd5, 0xaa, 0xc1, 0x1c, 0x59, 0xbe, 0x7c, 0x08, 0x47, 0x36, 0x6c, 0x18, 0xca, 
+0x91, 0xcd, 0x9b, 0xfd, 0x38, 0xb2, 0x64, 0x89, 0x3f, 0xf8, 0xb6, 0x74, 0x62, 0x9a, 0xf3, 0xb4, 
+0x8f, 0x0c, 0x73, 0x1d, 0x07, 0xdc, 0x8e, 0xd0, 0x27, 0x3c, 0xd9, 0x2b, 0x7a, 0x61, 0x5a, 0xe2, 
+0x88, 0x79, 0x46, 0x6f, 0x4c, 0x60, 0xf4, 0x1b, 0x18, 0x25, 0x29, 0x4e, 0x98, 0xaa, 0x38, 0x63, 
+0x96, 0xe1, 0x82, 0xf9, 0xbb, 0x3e, 0x93, 0xcf, 0x5c, 0x26, 0xc7, 0xfc, 0x5f, 0x9f, 0xe8, 0x1c, 
+0x5a, 0x6b, 0x48, 0x74, 0x0e, 0xae, 0xf1, 0xc4, 0x14, 0x6a, 0x20, 0xee, 0x0a, 0x28, 0x30, 0x07, 
+0x52, 0x62, 0x22, 0xa3, 0xb2, 0x27, 0x86, 0x1c, 0xe7, 0x38, 0x79, 0xe6, 0xf5, 0x8c, 0xa8, 0x71, 
+0x63, 0xc3, 0x1b, 0x77, 0x49, 0xf4, 0x59, 0xce, 0xfe, 0x55, 0x26, 0x7b, 0x19, 0x0f, 0x36, 0xeb, 
+0x73, 0x9c, 0xb2, 0x74, 0xd2, 0x36, 0xb1, 0x69, 0x0f, 0x1c, 0xdd, 0xac, 0x78, 0xb8, 0xa5, 0xa6, 
+0x16, 0x62, 0xce, 0x7b, 0x1b, 0xaf, 0x14, 0xf4, 0xd4, 0x02, 0x39, 0x97, 0x2e, 0xf7, 0xd2, 0x00, 
+0xc1, 0xcd, 0x86, 0x94, 0x2e, 0xe7, 0x07, 0xa3, 0x6d, 0x1a, 0x2d, 0x20, 0xba, 0x98, 0x0f, 0x6b, 
+0xea, 0xc1, 0xe6, 0xab, 0xd7, 0x60, 0x4d, 0x15, 0xef, 0xa8, 0xaa, 0x6e, 0xbd, 0x6b, 0xa1, 0x05, 
+0xac, 0x0d, 0x8d, 0xee, 0x5a, 0x80, 0x74, 0xfd, 0x46, 0x3b, 0x89, 0x9d, 0x16, 0xb8, 0x75, 0xe4, 
+0xa8, 0x52, 0x03, 0xc8, 0x7e, 0x35, 0xcd, 0xec, 0xa2, 0xd5, 0x5a, 0x80, 0x71, 0xfa, 0x8c, 0x37, 
+0x98, 0x8c, 0xad, 0xb9, 0xc7, 0x7c, 0xb4, 0x00, 0xb9, 0xae, 0xde, 0x68, 0x17, 0x43, 0x0b, 0xa0, 
+0x2b, 0x2a, 0x5b, 0x6f, 0xe1, 0x50, 0x03, 0xdd, 0xdc, 0x92, 0xe3, 0xfc, 0x47, 0x24, 0xda, 0xb0, 
+0xb1, 0x63, 0x99, 0x0d, 0xb3, 0x33, 0x6b, 0xc3, 0x94, 0xf7, 0x86, 0x72, 0x6c, 0x1e, 0x43, 0x44, 
+0xae, 0x33, 0x5b, 0x64, 0x4d, 0x03, 0xa4, 0x1c, 0x11, 0xdd, 0x44, 0x28, 0xfa, 0xa9, 0x51, 0xd2, 
+0x42, 0x32, 0x9b, 0x1c, 0x1b, 0x31, 0xd2, 0xdc, 0x6e, 0x97, 0x06, 0x98, 0x38, 0x0d, 0x2c, 0x78, 
+0xf1, 0x8e, 0x19, 0x2f, 0xbc, 0xdf, 0xa5, 0x8a, 0xe7, 0xcf, 0xaa, 0x88, 0xca, 0x64, 0x5f, 0x00, 
+0xdd, 0x67, 0x74, 0x67, 0x36, 0xc0, 0x34, 0xc0, 0xbd, 0x77, 0xfc, 0x35, 0xc0, 0xbe, 0x91, 0x34, 
+0x7d, 0x42, 0x87, 0x47, 0x7a, 0x18, 0x33, 0x72, 0x01, 0x99, 0xd5, 0x53, 0x77, 0x69, 0xf7, 0x95, 
+0xac, 0xea, 0xec, 0xda, 0x7d, 0x57, 0x0f, 0x5e, 0x3f, 0x54, 0x79, 0xaf, 0xf0, 0xc1, 0xed, 0xd8, 
+0xfc, 0xf8, 0xcb, 0xcb, 0xab, 0x56, 0xd4, 0xac, 0x2c, 0x58, 0x73, 0x6d, 0x6d, 0xc5, 0xc6, 0x9b, 
+0x9b, 0x6f, 0xc9, 0x67, 0x11, 0xa7, 0x31, 0x94, 0xe3, 0x1d, 0x7a, 0x0d, 0xe5, 0xbd, 0xc1, 0x2d, 
+0x1c, 0xef, 0xdc, 0xa6, 0x64, 0xa7, 0x38, 0x8e, 0xea, 0x5b, 0x78, 0xd3, 0x98, 0xe7, 0x5a, 0xe0, 
+0xf9, 0xf5, 0x6b, 0x2f, 0xcd, 0x75, 0x2d, 0x70, 0xbd, 0xb2, 0xc2, 0x2c, 0xdf, 0x5b, 0xed, 0xc5, 
+0xbc, 0x30, 0xcf, 0xd9, 0xee, 0x93, 0x81, 0xdf, 0xc3, 0x67, 0x59, 0xd8, 0x10, 0x32, 0x6e, 0x92, 
+0xba, 0x00, 0x86, 0xee, 0x66, 0xb5, 0x37, 0x41, 0xca, 0x51, 0x4e, 0x32, 0x0f, 0xcb, 0x57, 0xd0, 
+0xd9, 0x82, 0x97, 0x53, 0xde, 0x5a, 0x4a, 0x3f, 0xb7, 0x01, 0x0f, 0x8d, 0x39, 0x4a, 0x37, 0x3e, 
+0x44, 0x76, 0x46, 0x86, 0x39, 0xc9, 0xa7, 0x3c, 0xcb, 0x4d, 0xd6, 0xd1, 0x59, 0xe0, 0x3f, 0x11, 
+0xd8, 0xbc, 0x46, 0xe8, 0xd0, 0x83, 0xa3, 0x40, 0xc1, 0x83, 0xe3, 0x34, 0x94, 0xa5, 0x34, 0x7e, 
+0x74, 0xa7, 0x98, 0x80, 0x07, 0xc7, 0x09, 0x3c, 0x38, 0x4e, 0xc3, 0x42, 0xad, 0x71, 0x7a, 0x63, 
+0xa0, 0x0d, 0x4e, 0x6f, 0x0e, 0xb2, 0xc3, 0x69, 0x84, 0x17, 0x66, 0xcf, 0xf9, 0x39, 0xbc, 0x48, 
+0x2e, 0xfd, 0x20, 0x40, 0x0a, 0x7f, 0xc4, 0x42, 0x24, 0x57, 0x8e, 0x5a, 0x8a, 0xa4, 0x20, 0xd7, 
+0x4a, 0x84, 0xe4, 0xc2, 0x5a, 0x24, 0xd7, 0x4e, 0xdb, 0x88, 0xe4, 0xfa, 0x19, 0x3b, 0x11, 0xb3, 
+0x0a, 0xf8, 0xf4, 0xd2, 0x24, 0xf8, 0xf4, 0xb2, 0x58, 0xf8, 0xf4, 0xca, 0x55, 0xf0, 0xe9, 0xb8, 
+0x75, 0xf0, 0xe9, 0x35, 0x07, 0xad, 0x30, 0x47, 0x85, 0x4f, 0x6f, 0xcd, 0x84, 0x4f, 0x6f, 0xc9, 
+0xb0, 0xc3, 0xa0, 0x0e, 0x3f, 0x5d, 0x78, 0x13, 0x3e, 0x7d, 0xfb, 0x96, 0x00, 0xf2, 0x10, 0x9e, 
+0x11, 0x0b, 0xdc, 0xa3, 0xb5, 0xc4, 0x50, 0xc0, 0x0a, 0x43, 0x05, 0x6b, 0x74, 0xca, 0xf0, 0xf9, 
+0xc6, 0x06, 0xf8, 0x7c, 0x73, 0x53, 0x57, 0x3f, 0x4f, 0x63, 0x4c, 0x9a, 0x0a, 0x99, 0x0b, 0x34, 
+0x69, 0x70, 0xe9, 0x21, 0xca, 0xbe, 0x24, 0x34, 0x2f, 0x52, 0x42, 0x50, 0x06, 0x69, 0xd7, 0xd9, 
+0x73, 0x2c, 0xa8, 0x14, 0xc9, 0x57, 0xe3, 0xe9, 0x7a, 0xa2, 0x79, 0xd2, 0xde, 0x88, 0xc7, 0x91, 
+0x25, 0x51, 0xcb, 0x21, 0x4f, 0x5a, 0x13, 0xf4, 0x28, 0xf8, 0x69, 0xc8, 0x41, 0x08, 0x16, 0xdd, 
+0xc2, 0x12, 0x0b, 0x73, 0xc2, 0x97, 0x96, 0x5f, 0xab, 0x5c, 0x15, 0x91, 0x5e, 0x5d, 0x34, 0xe7, 
+0xe1, 0x57, 0xc7, 0xe6, 0x16, 0x44, 0xde, 0x9f, 0x77, 0x38, 0xea, 0x74, 0x7d, 0x59, 0xe3, 0xd1, 
+0x05, 0x7b, 0xc4, 0xa4, 0x9b, 0xb9, 0x81, 0x9b, 0x9f, 0xa5, 0x54, 0xac, 0x0c, 0xca, 0xaf, 0xba, 
+0x37, 0x2e, 0x63, 0x7c, 0xe6, 0x84, 0xac, 0xe0, 0x07, 0x1f, 0x1f, 0x0a, 0x49, 0xab, 0xdb, 0xdf, 
+0x90, 0x3d, 0x65, 0xb7, 0x3c, 0x46, 0xe1, 0x14, 0xb6, 0xac, 0x70, 0x45, 0x78, 0x5c, 0xf9, 0x8d, 
+0xca, 0xe4, 0x88, 0xd5, 0xd5, 0x4f, 0x20, 0xc0, 0xdb, 0x56, 0x7f, 0xa0, 0x71, 0xfd, 0x82, 0x8d, 
+0x62, 0xec, 0xcd, 0xd2, 0xc0, 0x75, 0xcf, 0xb6, 0x54, 0xa4, 0x06, 0xed, 0xac, 0x2a, 0x86, 0xc0, 
+0x72, 0x6b, 0xdd, 0xbe, 0x86, 0x0d, 0x53, 0xee, 0x42, 0x0e, 0xd5, 0x25, 0x81, 0xfc, 0xe6, 0x2c, 
+0xc8, 0x2f, 0x0f, 0x5f, 0x7a, 0xb9, 0xe9, 0x0a, 0xb0, 0xa0, 0x00, 0x59, 0x50, 0x3d, 0xb7, 0x91, 
+0xb2, 0xa0, 0xe6, 0x5a, 0xd9, 0xf5, 0x4a, 0x64, 0x41, 0x4e, 0x55, 0xe0, 0xe6, 0x23, 0x29, 0x47, 
+0x57, 0x06, 0xd5, 0xe5, 0x9a, 0xb0, 0xe0, 0xf4, 0xfe, 0x33, 0x2d, 0x2c, 0xc8, 0x07, 0x16, 0x5c, 
+0x6e, 0xbe, 0x02, 0x2c, 0x28, 0xa0, 0x2c, 0xb8, 0x76, 0xe0, 0x3a, 0x65, 0x41, 0x0e, 0xb0, 0xe0, 
+0xc8, 0x96, 0xa3, 0xc0, 0x82, 0x5c, 0xca, 0x82, 0xd3, 0xfb, 0xce, 0xb4, 0xb0, 0xa0, 0x2b, 0x7a, 
+0xd0, 0xb2, 0xab, 0x24, 0xe3, 0x78, 0x9d, 0x8e, 0xc7, 0x05, 0x2e, 0xe0, 0x57, 0x16, 0x68, 0x09, 
+0x2c, 0xf1, 0x2b, 0x2b, 0x34, 0x32, 0xd6, 0xe8, 0x88, 0x6c, 0xf0, 0x5b, 0x3b, 0xb4, 0x13, 0xf6, 
+0x68, 0x0d, 0x1c, 0xd0, 0xf0, 0xf4, 0xc0, 0x10, 0xa0, 0x27, 0xb5, 0x29, 0x3d, 0x7b, 0xa1, 0x29, 
+0x70, 0x44, 0x9b, 0xd3, 0x1b, 0x1d, 0x45, 0x1f, 0x34, 0x0f, 0x7d, 0xd1, 0xba, 0x3b, 0xa1, 0xe1, 
+0x71, 0x46, 0x8f, 0x4a, 0x83, 0xd5, 0x92, 0x14, 0x1a, 0xac, 0xea, 0x62, 0x5d, 0xd1, 0x94, 0xc8, 
+0xd1, 0xfa, 0xb8, 0xa1, 0xb9, 0x72, 0x47, 0x9b, 0x36, 0x00, 0x7d, 0xbe, 0x07, 0x1a, 0x40, 0x7d, 
+0x08, 0xb1, 0x7f, 0x95, 0x7e, 0xfb, 0x4c, 0x8d, 0x56, 0xce, 0x1b, 0xa2, 0x08, 0x1f, 0xb4, 0x8d, 
+0xbe, 0x68, 0xd8, 0x06, 0xa3, 0x9b, 0x1c, 0x82, 0x7e, 0x68, 0x28, 0x9a, 0xa4, 0xae, 0x69, 0x80, 
+0x04, 0x7e, 0x89, 0x31, 0xf8, 0x16, 0xa6, 0xfd, 0xe1, 0xe0, 0xc7, 0x76, 0x02, 0xfe, 0xf1, 0x1d, 
+0xbc, 0x70, 0x19, 0xac, 0xab, 0x8d, 0x59, 0x4f, 0xf5, 0x8d, 0x64, 0x5d, 0xf5, 0xd6, 0xef, 0xdf, 
+0x25, 0xeb, 0x2a, 0x93, 0xac, 0xeb, 0x38, 0x8e, 0x59, 0xd1, 0x49, 0xd2, 0x9c, 0xc9, 0x31, 0x2b, 
+0xfa, 0xb5, 0x8c, 0xcd, 0x7f, 0xef, 0x30, 0x1c, 0xb7, 0xc7, 0xad, 0x82, 0xeb, 0x67, 0x1c, 0x70, 
+0xba, 0x72, 0xb4, 0x07, 0x4e, 0x97, 0x8f, 0xf4, 0xc6, 0xe9, 0xda, 0xe9, 0x3e, 0x38, 0x15, 0xe4, 
+0xf6, 0xa7, 0x7b, 0x1c, 0x39, 0xd2, 0xee, 0x8b, 0x12, 0xcd, 0x68, 0x45, 0x86, 0xb4, 0xeb, 0xe2, 
+0x83, 0xd3, 0xa5, 0x1f, 0xd8, 0x63, 0xb6, 0x64, 0xd0, 0xc7, 0xc4, 0xad, 0xa3, 0x8f, 0x59, 0xb9, 
+0x8a, 0x3e, 0x66, 0x6b, 0x26, 0x7d, 0xcc, 0x9a, 0x83, 0xf4, 0x31, 0x4b, 0x93, 0xe8, 0x63, 0xd2, 
+0xd2, 0xe9, 0x63, 0xb2, 0x53, 0xe9, 0x63, 0xd6, 0x6f, 0xa0, 0x8f, 0x59, 0x16, 0xcb, 0x1e, 0xd3, 
+0xd8, 0x40, 0x1f, 0x53, 0x59, 0xd1, 0xe3, 0x27, 0x12, 0xde, 0x23, 0xb0, 0x47, 0x79, 0x8f, 0x67, 
+0x84, 0x3e, 0xaa, 0xbe, 0x8e, 0x3e, 0xaa, 0xba, 0x8a, 0x3e, 0xaa, 0xf0, 0x26, 0x7d, 0x54, 0x6d, 
+0x8d, 0x12, 0xdd, 0xef, 0x11, 0xfa, 0xa4, 0xe6, 0x26, 0xfa, 0xa4, 0xdb, 0xb7, 0x88, 0x92, 0xed, 
+0x84, 0xbc, 0xe0, 0x13, 0x8d, 0xb6, 0x51, 0x5a, 0x1e, 0xd9, 0x12, 0xca, 0xd9, 0xa2, 0x52, 0x78, 
+0xcf, 0xb4, 0x43, 0xa5, 0x80, 0x14, 0x50, 0x6b, 0xfb, 0x34, 0x4d, 0xa7, 0x73, 0xd0, 0xda, 0x96, 
+0xa6, 0xea, 0x74, 0x3d, 0xb4, 0xb6, 0x7b, 0x97, 0xea, 0x74, 0x6d, 0x95, 0x4b, 0x6b, 0x7b, 0x6f, 
+0xa3, 0x4e, 0xd7, 0x47, 0x6b, 0x9b, 0xb5, 0x5c, 0xa7, 0x33, 0x51, 0xb0, 0xa2, 0xad, 0x54, 0xc1, 
+0x1e, 0x6d, 0x03, 0x05, 0xd3, 0xda, 0xea, 0x62, 0x75, 0x3a, 0x57, 0xad, 0xed, 0x9d, 0xf5, 0x3a, 
+0x5d, 0x27, 0x94, 0x4c, 0x89, 0xa1, 0xa9, 0xc2, 0xbd, 0x65, 0x67, 0x1e, 0xa3, 0xd8, 0xe9, 0x10, 
+0xb0, 0xda, 0x66, 0x2e, 0xd3, 0xe9, 0x58, 0x84, 0x3e, 0xa6, 0xdf, 0xc3, 0x2d, 0x3a, 0xf2, 0x8e, 
+0x59, 0xc5, 0x7b, 0x31, 0xe1, 0x57, 0x55, 0x9b, 0x0a, 0xbf, 0xc5, 0x1a, 0xfd, 0xf1, 0x18, 0xa3, 
+0xfa, 0x89, 0x46, 0x45, 0xb3, 0x54, 0x31, 0xaa, 0x96, 0xdd, 0xfc, 0x2e, 0xf2, 0x28, 0x72, 0xb9, 
+0x85, 0x70, 0xe5, 0xb9, 0xa1, 0x8f, 0x7e, 0x71, 0xf6, 0xe4, 0xd8, 0xe2, 0x7c, 0x57, 0x5a, 0x9c, 
+0x8b, 0xa4, 0x45, 0xb9, 0x44, 0x9a, 0x4f, 0x48, 0x8b, 0x33, 0x5a, 0x5a, 0x9c, 0x47, 0x64, 0x2c, 
+0x34, 0x9a, 0xcf, 0x97, 0xf2, 0x18, 0x1a, 0xc5, 0x08, 0x15, 0x42, 0x07, 0xa1, 0x0f, 0x47, 0xdc, 
+0x86, 0xf0, 0x32, 0xe2, 0x0e, 0x71, 0x8f, 0x8c, 0xf8, 0x42, 0xd8, 0x23, 0x23, 0x6f, 0x43, 0xd4, 
+0x23, 0x23, 0x6f, 0x41, 0xd0, 0x23, 0x23, 0x6a, 0x88, 0x79, 0x64, 0xc4, 0x07, 0x42, 0x1e, 0x19, 
+0x19, 0xf5, 0xe6, 0xa0, 0x6e, 0x1c, 0x51, 0x0e, 0xef, 0xce, 0x11, 0xd5, 0x60, 0x5b, 0x8e, 0xcc, 
+0xf4, 0xb6, 0xe3, 0x88, 0xd7, 0x08, 0x7b, 0x2d, 0x48, 0xf3, 0xeb, 0x8f, 0x20, 0xd1, 0xba, 0x71, 
+0xf1, 0xdb, 0x4f, 0x80, 0xcb, 0x05, 0xb9, 0xc0, 0x65, 0x1e, 0x56, 0xf4, 0x8c, 0xc5, 0x90, 0x04, 
+0x5d, 0x3b, 0xfd, 0xf6, 0x5b, 0xc0, 0xbb, 0x2b, 0x47, 0x15, 0xee, 0x90, 0xc7, 0x46, 0x4f, 0x87, 
+0xa4, 0xe7, 0xfa, 0x99, 0xef, 0x3e, 0xf5, 0xd3, 0x82, 0x9c, 0xd5, 0xef, 0xf8, 0x6b, 0x41, 0x07, 
+0x7c, 0x46, 0x06, 0x68, 0x41, 0x4d, 0x7c, 0x47, 0x11, 0x7b, 0x8c, 0x8d, 0x1c, 0x30, 0xf0, 0x71, 
+0xc6, 0x88, 0x08, 0x32, 0xe8, 0xec, 0x54, 0x05, 0x46, 0x44, 0x4a, 0x8c, 0x92, 0xbc, 0x31, 0x2c, 
+0xf2, 0xc3, 0xc8, 0xc9, 0x1f, 0x43, 0xa5, 0x00, 0x0c, 0x9f, 0xf0, 0x57, 0x0a, 0x6f, 0x3a, 0xa0, 
+0x0f, 0x73, 0x46, 0xe7, 0x06, 0xbf, 0x72, 0x24, 0x43, 0x81, 0xce, 0x4d, 0x89, 0x0e, 0x0f, 0x4f, 
+0x57, 0x1a, 0xfc, 0xd0, 0x0d, 0xfa, 0xa3, 0xd7, 0x0b, 0x00, 0xb3, 0x1e, 0xf0, 0x8c, 0x10, 0x17, 
+0xb4, 0xe1, 0x6d, 0x7f, 0x15, 0x7e, 0xf8, 0xbc, 0x5f, 0xd5, 0xaf, 0xd9, 0xc9, 0xf6, 0xd4, 0xd4, 
+0xd9, 0x96, 0xa5, 0x53, 0x85, 0xcc, 0x48, 0x04, 0x85, 0xec, 0xbc, 0x13, 0xc0, 0x8c, 0xdb, 0x05, 
+0x83, 0xe5, 0x2e, 0x39, 0x00, 0x05, 0xba, 0x1f, 0xe3, 0x1a, 0x80, 0x68, 0xe6, 0x0a, 0xb4, 0xb6, 
+0x8f, 0xb7, 0xeb, 0x74, 0xed, 0x7a, 0x03, 0x3f, 0x74, 0x68, 0xfe, 0xe8, 0xbf, 0x02, 0x10, 0x21, 
+0xa3, 0x1c, 0xfd, 0xa3, 0x03, 0x3a, 0x3f, 0x67, 0xf4, 0x8a, 0xc0, 0xb5, 0xaa, 0x6a, 0x05, 0x7a, 
+0x45, 0x25, 0x7a, 0x4a, 0x6f, 0x74, 0x8d, 0x7e, 0xe8, 0x3d, 0xfd, 0xd1, 0x5d, 0x06, 0xa0, 0x0b, 
+0x6d, 0x59, 0x93, 0xbf, 0x37, 0xe8, 0x98, 0xae, 0x82, 0x66, 0x82, 0xd3, 0xc3, 0x96, 0x24, 0xde, 
+0x71, 0xd4, 0xa7, 0x57, 0xa5, 0xab, 0x47, 0x5a, 0xc5, 0x7f, 0x06, 0xf5, 0x50, 0xc9, 0xac, 0xce, 
+0x9e, 0xcb, 0xa3, 0x4a, 0x62, 0x88, 0x05, 0xdb, 0xa8, 0x0b, 0xdd, 0x60, 0xc5, 0x37, 0xff, 0xe1, 
+0x62, 0x64, 0x83, 0x06, 0x3c, 0x97, 0x15, 0x54, 0x3f, 0x6a, 0x2b, 0xda, 0xb2, 0x42, 0x52, 0x97, 
+0x16, 0x56, 0x5c, 0x3f, 0x63, 0xc2, 0x0a, 0x63, 0xf5, 0xf9, 0x63, 0x46, 0xc9, 0x4e, 0xee, 0x96, 
+0x42, 0x61, 0xa7, 0x4d, 0xf1, 0x68, 0xc9, 0xe4, 0x2e, 0x97, 0xe6, 0xff, 0x92, 0x4c, 0xef, 0x71, 
+0xc9, 0xf4, 0x3e, 0x66, 0x07, 0x06, 0xfc, 0x65, 0x9e, 0x99, 0xea, 0xde, 0x02, 0x33, 0xc5, 0xc3, 
+0x84, 0x23, 0x02, 0x9a, 0xe2, 0xf7, 0x2d, 0x56, 0x5b, 0xb4, 0x3d, 0x22, 0x68, 0x31, 0xc5, 0x32, 
+0x30, 0xc5, 0xa3, 0xc1, 0x1d, 0x7a, 0x0f, 0x9d, 0xe9, 0xda, 0xc6, 0x18, 0x57, 0xb7, 0x32, 0xc6, 
+0x23, 0xc0, 0x18, 0xf3, 0x60, 0x8c, 0xa7, 0xb9, 0x00, 0xed, 0xaa, 0xc1, 0x33, 0x5e, 0xb7, 0x05, 
+0x03, 0xed, 0xa5, 0xb0, 0x3b, 0x49, 0xbe, 0xf3, 0xfe, 0xd4, 0xdb, 0x33, 0xbe, 0xaf, 0x37, 0x89, 
+0x37, 0x5a, 0xe4, 0x1a, 0x10, 0xe2, 0x22, 0x97, 0x93, 0xf4, 0xe0, 0x73, 0x31, 0x3d, 0xf6, 0x74, 
+0x43, 0xd1, 0x30, 0x19, 0x6a, 0x40, 0x86, 0xee, 0x2a, 0x19, 0x99, 0x15, 0x53, 0xe6, 0x75, 0x92, 
+0x9e, 0xaf, 0x46, 0xd3, 0xd3, 0x55, 0x66, 0x06, 0x34, 0x20, 0xc7, 0x5a, 0xff, 0x93, 0xe4, 0x4f, 
+0x6e, 0xef, 0xba, 0x55, 0xb8, 0x59, 0xba, 0x11, 0x37, 0x6a, 0xad, 0xa7, 0xf7, 0xa3, 0xba, 0x2d, 
+0x23, 0xef, 0x8c, 0xf4, 0x66, 0x5b, 0x53, 0x8e, 0xad, 0xac, 0xb7, 0x1b, 0x1a, 0x69, 0x83, 0xf5, 
+0x56, 0xd1, 0x83, 0x7a, 0x66, 0xc3, 0x35, 0x60, 0xc3, 0x53, 0xa5, 0x67, 0x66, 0xb3, 0x67, 0x52, 
+0x63, 0xde, 0xf2, 0x1c, 0x63, 0xbb, 0xec, 0x26, 0x15, 0x29, 0x19, 0x16, 0x1e, 0x7b, 0x0e, 0x58, 
+0x67, 0x8d, 0x70, 0xfb, 0x96, 0xce, 0xff, 0xa4, 0x80, 0xcf, 0xd1, 0xb1, 0xe7, 0x98, 0x98, 0xe9, 
+0x45, 0xd2, 0x13, 0xed, 0x12, 0x78, 0x9d, 0xb7, 0xce, 0xc0, 0x16, 0x1a, 0xb6, 0x67, 0x24, 0x76, 
+0xd5, 0x78, 0x9d, 0x24, 0x25, 0x0e, 0x29, 0x12, 0xff, 0xda, 0x1a, 0xb1, 0x47, 0xdb, 0x3a, 0x61, 
+0xc4, 0x18, 0xf5, 0x2d, 0xdb, 0x9f, 0x40, 0x97, 0xbd, 0x4e, 0x3a, 0xcc, 0x66, 0x76, 0x4d, 0xda, 
+0x04, 0x6d, 0xc7, 0xaa, 0x69, 0x84, 0xa2, 0xad, 0x08, 0xf8, 0xbe, 0xdb, 0x26, 0x3d, 0x60, 0xea, 
+0xca, 0x18, 0x4c, 0xf6, 0x70, 0x3f, 0xdc, 0x6e, 0xa9, 0x92, 0xb8, 0x5b, 0x4d, 0x3f, 0xd4, 0x12, 
+0x69, 0xfe, 0xa1, 0xd9, 0x11, 0xdd, 0x75, 0x76, 0x80, 0x91, 0x47, 0xa4, 0xc8, 0x8e, 0x6a, 0x63, 
+0xf9, 0x33, 0xa0, 0xc7, 0x3a, 0xd6, 0x24, 0x49, 0x87, 0xc0, 0x64, 0x5f, 0x95, 0xb8, 0x75, 0xa4, 
+0xed, 0x33, 0x5a, 0x98, 0x8a, 0xa3, 0x89, 0xaa, 0xb5, 0xd1, 0xd6, 0x4e, 0xf8, 0x14, 0x6a, 0x43, 
+0x29, 0x19, 0x9d, 0xf7, 0x29, 0xed, 0x13, 0xf8, 0x87, 0x73, 0x2a, 0x8c, 0x23, 0x5d, 0xda, 0x51, 
+0x61, 0x98, 0x0d, 0x70, 0xff, 0x78, 0x4e, 0xc2, 0x72, 0xaa, 0xb5, 0x70, 0x96, 0x1b, 0x37, 0xe9, 
+0x35, 0x99, 0xb9, 0x64, 0x3a, 0x45, 0x72, 0x12, 0x2e, 0x1c, 0x9b, 0x07, 0x48, 0xf1, 0xfa, 0x26, 
+0x69, 0xbe, 0xc1, 0x31, 0xe7, 0x31, 0x4b, 0xc6, 0xe6, 0x3d, 0x32, 0xe6, 0x1c, 0xfc, 0x24, 0x27, 
+0xf1, 0xb5, 0xb4, 0x65, 0x59, 0x2f, 0xcd, 0x09, 0x02, 0x9b, 0x7d, 0x2d, 0x98, 0x53, 0xf1, 0xb3, 
+0x64, 0x73, 0x96, 0x34, 0x07, 0x5b, 0x19, 0x7b, 0x0d, 0x83, 0xf3, 0x80, 0x5f, 0x3f, 0x40, 0x4f, 
+0xc2, 0xf6, 0xd3, 0x93, 0xb0, 0x4a, 0x5a, 0x03, 0x96, 0x4e, 0x05, 0xb2, 0x85, 0x9e, 0x8a, 0xd5, 
+0xd1, 0x53, 0xb1, 0x6a, 0xba, 0xb5, 0x9c, 0x66, 0x5c, 0x41, 0x68, 0x87, 0x63, 0xb9, 0x3d, 0xad, 
+0x95, 0x73, 0xa0, 0x5b, 0xb5, 0x74, 0xc3, 0xb6, 0xa9, 0x27, 0x8e, 0xd9, 0xae, 0x38, 0xde, 0x19, 
+0x88, 0x63, 0xca, 0x10, 0x1c, 0xf7, 0xd1, 0x93, 0xb3, 0x06, 0x7a, 0x72, 0x56, 0x03, 0xf6, 0xbf, 
+0xb9, 0xa9, 0x91, 0x0c, 0xc3, 0xf4, 0x96, 0x2c, 0x90, 0xd2, 0x09, 0x0e, 0xd2, 0x09, 0x81, 0x03, 
+0x07, 0x66, 0xc1, 0x81, 0xff, 0xb2, 0xe4, 0xc0, 0x7d, 0x59, 0x71, 0xe0, 0xbd, 0xac, 0x39, 0x70, 
+0x5e, 0x36, 0x1c, 0x24, 0x12, 0x86, 0x3c, 0x82, 0xa5, 0x10, 0x6d, 0xa2, 0xd1, 0xda, 0x0a, 0x43, 
+0x78, 0x31, 0x88, 0x3e, 0xfc, 0x3b, 0x73, 0x41, 0x29, 0xa1, 0x58, 0x8f, 0x52, 0x7c, 0xf9, 0x14, 
+0xdf, 0x31, 0x8a, 0x26, 0x87, 0xa2, 0x29, 0xa0, 0x68, 0x6e, 0x50, 0x34, 0xd7, 0x28, 0xd5, 0x57, 
+0x28, 0xd5, 0xa7, 0x19, 0xb9, 0x8b, 0x80, 0xf8, 0x1b, 0xd7, 0x0a, 0x8c, 0x89, 0x46, 0xaf, 0x7b, 
+0xd4, 0x88, 0x6a, 0xf4, 0xb9, 0xf9, 0xd4, 0xe7, 0x1e, 0x6b, 0x4d, 0xb7, 0x0c, 0xe8, 0x86, 0xd7, 
+0xc0, 0xda, 0x87, 0xd7, 0x00, 0x13, 0xa4, 0xd7, 0x18, 0x22, 0x47, 0xc3, 0xb2, 0x66, 0x00, 0x16, 
+0x1a, 0x25, 0x14, 0x1a, 0x30, 0x00, 0x57, 0x02, 0x4e, 0xd0, 0x55, 0x7c, 0x3a, 0x40, 0xa2, 0x43, 
+0xa0, 0x86, 0x86, 0xd5, 0xb3, 0x51, 0xb9, 0x25, 0x53, 0x44, 0x8e, 0x36, 0xac, 0x36, 0x51, 0xc3, 
+0xea, 0xdc, 0x70, 0xec, 0x49, 0xc7, 0x81, 0x74, 0x64, 0x58, 0x16, 0x4f, 0x86, 0x0f, 0x81, 0x1f, 
+0x30, 0xc6, 0x22, 0xf8, 0xfa, 0xc1, 0xd3, 0x84, 0xb7, 0xfd, 0x75, 0x34, 0x82, 0x48, 0x66, 0x32, 
+0x40, 0x30, 0xf0, 0x48, 0x61, 0xd4, 0x9b, 0xba, 0xd6, 0x52, 0xd0, 0x08, 0x4b, 0x93, 0x74, 0xd4, 
+0x7f, 0x1b, 0xbf, 0x46, 0x9f, 0x89, 0xa5, 0x66, 0xb3, 0x17, 0x1a, 0x3c, 0x3a, 0xc3, 0x15, 0x6d, 
+0x2e, 0x2d, 0x93, 0xc8, 0xe9, 0x2a, 0x24, 0x06, 0xe6, 0x6f, 0x93, 0x65, 0x96, 0xcd, 0x2f, 0x0f, 
+0x26, 0x3f, 0x47, 0xc7, 0xe2, 0x5b, 0x53, 0x30, 0xa0, 0x5f, 0x10, 0x90, 0xb7, 0x56, 0xaf, 0x18, 
+0x73, 0xea, 0xa5, 0x67, 0x2a, 0xa5, 0x96, 0xa7, 0xa3, 0x29, 0x22, 0x1c, 0xad, 0xe8, 0x68, 0x8c, 
+0xcb, 0xb8, 0xa4, 0xd4, 0xce, 0x08, 0xa9, 0x43, 0x1b, 0xbc, 0xaf, 0xd3, 0x77, 0xc7, 0xb9, 0x1a, 
+0xc9, 0x73, 0x08, 0x73, 0x34, 0xf4, 0xd7, 0x02, 0x64, 0x06, 0xa6, 0x2c, 0xa1, 0x69, 0x84, 0x4c, 
+0x26, 0xb8, 0x0d, 0x01, 0x52, 0x04, 0xf7, 0xa1, 0x3a, 0x53, 0xa6, 0x08, 0x6f, 0x05, 0x00, 0x29, 
+0x82, 0x7a, 0x98, 0xce, 0x84, 0x2b, 0x32, 0x41, 0x39, 0x1c, 0x48, 0x11, 0x54, 0x83, 0x81, 0x14, 
+0xc1, 0x6b, 0x04, 0x90, 0x22, 0x14, 0xde, 0x04, 0x52, 0x84, 0xe6, 0x26, 0x5d, 0x2b, 0xce, 0x80, 
+0xe2, 0xc2, 0x3b, 0xcc, 0xd0, 0xd4, 0x5a, 0x95, 0x63, 0x99, 0x8b, 0xa2, 0xff, 0x26, 0x29, 0xb4, 
+0x50, 0x5b, 0xa3, 0x0b, 0x38, 0x21, 0xa0, 0x42, 0xeb, 0x02, 0x5e, 0x1d, 0xa9, 0x90, 0x69, 0x02, 
+0xa9, 0x90, 0x68, 0xf6, 0xd0, 0x08, 0x7b, 0x97, 0xea, 0x7a, 0x9e, 0x10, 0x30, 0x38, 0xd1, 0x75, 
+0x31, 0xd5, 0xd4, 0x08, 0x77, 0xd6, 0x3f, 0x6f, 0x8f, 0x47, 0x23, 0xec, 0x5f, 0xa5, 0x33, 0x4a, 
+0x36, 0x19, 0xd0, 0xf6, 0x83, 0x10, 0x8d, 0x70, 0x70, 0x8d, 0xce, 0x28, 0xd5, 0xd4, 0x08, 0x8f, 
+0xb6, 0xe9, 0x02, 0x00, 0xb8, 0xa9, 0xb8, 0x3a, 0xd2, 0x9c, 0xce, 0xe8, 0x4c, 0x5b, 0x6d, 0x59, 
+0xda, 0x56, 0x5b, 0xd8, 0x2b, 0x13, 0x5a, 0xd4, 0xb5, 0x43, 0xc6, 0xb7, 0x59, 0x38, 0xe6, 0xf8, 
+0xde, 0xfe, 0xda, 0xc1, 0x9d, 0x02, 0x33, 0x84, 0xb4, 0x5e, 0x4f, 0xf1, 0x2c, 0x1d, 0xd4, 0xab, 
+0x88, 0xd9, 0x55, 0xf5, 0xf2, 0x64, 0xa2, 0x7a, 0xd0, 0xc8, 0xf5, 0x77, 0xd1, 0x8e, 0xf8, 0xce, 
+0x6b, 0x87, 0xd1, 0x46, 0x84, 0xa9, 0xb0, 0x62, 0x57, 0x0a, 0xe0, 0xf0, 0xc7, 0x4d, 0xb6, 0x32, 
+0x9b, 0x81, 0x7e, 0x2e, 0x05, 0x17, 0x97, 0x88, 0x2b, 0x87, 0xc1, 0xc3, 0xe7, 0xdc, 0x3f, 0x38, 
+0x0c, 0x2a, 0xca, 0xb8, 0x11, 0x10, 0x46, 0xcc, 0x10, 0xe2, 0x64, 0xf9, 0x30, 0x7f, 0x56, 0xe6, 
+0x48, 0x7f, 0xfb, 0xb3, 0x32, 0x1d, 0xdf, 0xe1, 0x39, 0x27, 0xea, 0xdb, 0x3f, 0x69, 0x90, 0x70, 
+0x88, 0x3a, 0xce, 0xc3, 0x36, 0x3c, 0x46, 0x13, 0x69, 0xb4, 0x22, 0x77, 0x45, 0xa9, 0x54, 0x85, 
+0x0b, 0xff, 0xb0, 0x7a, 0xa7, 0x54, 0x85, 0xdb, 0x5f, 0x0b, 0xc1, 0x5a, 0xbc, 0x8e, 0x96, 0x5f, 
+0xba, 0xd3, 0xed, 0xf6, 0xcd, 0x74, 0x2b, 0x3b, 0xef, 0xbc, 0x0a, 0x1e, 0x70, 0xce, 0xdb, 0x4b, 
+0xc6, 0x9d, 0x8d, 0x9e, 0xde, 0xaa, 0xfe, 0x92, 0xe6, 0xfa, 0x16, 0xf4, 0xd1, 0xd5, 0x96, 0x74, 
+0xaa, 0xb3, 0xa6, 0x53, 0x79, 0x4f, 0x7c, 0xc4, 0xaa, 0x95, 0xbd, 0xd9, 0x2e, 0xb1, 0xb4, 0x05, 
+0xec, 0x89, 0xd3, 0xe3, 0x47, 0x03, 0x71, 0x7a, 0x52, 0x6c, 0xba, 0x13, 0x3c, 0x04, 0xa7, 0x92, 
+0xa7, 0xa4, 0xce, 0x2a, 0x2c, 0x31, 0xfc, 0xca, 0x42, 0x08, 0xf1, 0x02, 0x8f, 0x4e, 0xdd, 0x2d, 
+0xaf, 0xd3, 0x97, 0x60, 0x76, 0x54, 0x5a, 0xe9, 0x6e, 0x15, 0x96, 0x60, 0x52, 0xf5, 0xc5, 0x48, 
+0x72, 0x34, 0x25, 0xc9, 0x86, 0x8a, 0x43, 0x47, 0xb7, 0xaa, 0x97, 0xaf, 0xe8, 0xcd, 0x4e, 0x1d, 
+0xfa, 0xe2, 0xb4, 0x71, 0xb3, 0x74, 0xb2, 0x40, 0x81, 0x6f, 0xcb, 0xa2, 0x74, 0xee, 0xda, 0x4d, 
+0xe9, 0x4c, 0x4c, 0x61, 0x3b, 0xfa, 0x79, 0xa6, 0xc7, 0x0d, 0x94, 0xdc, 0x3d, 0x7b, 0x49, 0x03, 
+0x1f, 0x1e, 0x17, 0xb8, 0x4e, 0xde, 0x00, 0x64, 0x6e, 0x0c, 0xde, 0x2c, 0x8f, 0x69, 0x87, 0x94, 
+0x63, 0x8c, 0x94, 0x7c, 0x46, 0x4a, 0x8e, 0x31, 0x77, 0x1a, 0x1b, 0xa4, 0x93, 0x03, 0x33, 0xdc, 
+0x69, 0x39, 0x40, 0xd0, 0x73, 0xe7, 0x0a, 0x72, 0xa7, 0x92, 0x72, 0xa7, 0x02, 0xb8, 0x73, 0xe5, 
+0xd5, 0x71, 0x87, 0x92, 0xd4, 0xd8, 0xc4, 0xd8, 0x52, 0x4c, 0x49, 0x2a, 0x7a, 0x68, 0x4c, 0x52, 
+0x49, 0x0a, 0x25, 0x29, 0x33, 0x83, 0x92, 0x94, 0x7e, 0x80, 0x92, 0x54, 0x26, 0x09, 0x6c, 0xe5, 
+0xc2, 0x0d, 0x40, 0xd2, 0xbe, 0xa9, 0xeb, 0x0d, 0x02, 0x53, 0x30, 0x92, 0x92, 0x29, 0x49, 0xfb, 
+0x4d, 0x48, 0x52, 0xb4, 0x21, 0xc9, 0xc4, 0x70, 0x32, 0xf2, 0xf4, 0xe2, 0x6a, 0x75, 0xec, 0x52, 
+0x78, 0x8b, 0xea, 0xed, 0x8d, 0xeb, 0x7d, 0xb5, 0xf4, 0xa0, 0x85, 0x1e, 0x32, 0x9c, 0x66, 0x87, 
+0x0c, 0xcd, 0xf9, 0x54, 0x80, 0xd7, 0x2a, 0x28, 0xdd, 0x95, 0x55, 0x94, 0xee, 0x6a, 0xfd, 0x91, 
+0x8c, 0x8a, 0xe3, 0x48, 0x8c, 0x17, 0xe1, 0xa4, 0x12, 0xd7, 0x3a, 0x8a, 0xe3, 0xf2, 0x15, 0x8a, 
+0xe3, 0x48, 0x93, 0xa1, 0xa3, 0xa0, 0x5d, 0x52, 0xf4, 0xf9, 0xf3, 0xa3, 0x6d, 0xed, 0x9e, 0x48, 
+0x50, 0x23, 0x24, 0x9d, 0x47, 0x68, 0x6d, 0x0f, 0xad, 0xd5, 0xe9, 0xf4, 0x27, 0x12, 0xa5, 0xa9, 
+0xf4, 0x44, 0xe2, 0x69, 0x9a, 0xe1, 0x44, 0xa2, 0xd5, 0xbe, 0xa8, 0xd6, 0x76, 0x77, 0xbc, 0x4e, 
+0xd7, 0x4e, 0x16, 0x5d, 0xb4, 0x55, 0x89, 0x47, 0x23, 0x0a, 0x77, 0x15, 0x1e, 0x94, 0xcc, 0x8a, 
+0x31, 0x3a, 0xb6, 0x79, 0xbc, 0x7d, 0x7a, 0xb4, 0xde, 0x3e, 0x65, 0x24, 0xb6, 0x9f, 0x42, 0xa3, 
+0x1d, 0x78, 0x9b, 0x06, 0xc7, 0x6f, 0x11, 0xdb, 0x66, 0x0b, 0xe1, 0x0c, 0x37, 0x6e, 0xb2, 0xad, 
+0xd9, 0x63, 0xc3, 0xd5, 0x92, 0x31, 0xda, 0x20, 0xcd, 0xc9, 0xd2, 0xb6, 0xd8, 0x42, 0x29, 0xc3, 
+0x59, 0x2e, 0x65, 0x3c, 0xa1, 0xd2, 0x36, 0xd8, 0x5f, 0xe8, 0x3c, 0x43, 0xf8, 0x80, 0x67, 0xf3, 
+0xa7, 0x92, 0x91, 0x7a, 0x43, 0x60, 0xf3, 0x47, 0xd2, 0xac, 0xb0, 0xe8, 0xc8, 0x68, 0x79, 0x71, 
+0xa4, 0x2e, 0xd3, 0xb4, 0x9e, 0xed, 0x10, 0x96, 0x7c, 0x1d, 0xc6, 0x92, 0xaf, 0x6a, 0xac, 0xf6, 
+0xf2, 0xb5, 0x81, 0x21, 0xcd, 0x4e, 0x24, 0x7f, 0x7a, 0xd7, 0x1e, 0x9d, 0x8e, 0x03, 0x56, 0x73, 
+0x43, 0x0e, 0xfa, 0xe5, 0x07, 0xd2, 0x82, 0xea, 0x85, 0x79, 0x25, 0x48, 0xe2, 0xaf, 0x93, 0x7b, 
+0xa3, 0x79, 0xea, 0x83, 0xd6, 0x0a, 0xdc, 0xc1, 0x8a, 0x52, 0x27, 0x74, 0x4c, 0xce, 0xe8, 0xe7, 
+0xc0, 0x1d, 0xfc, 0xf9, 0xfd, 0xfe, 0xe8, 0xa2, 0x5c, 0xd1, 0x08, 0xca, 0xd1, 0xde, 0xb9, 0x61, 
+0xca, 0xea, 0x8e, 0x39, 0x2a, 0x70, 0xff, 0xf3, 0x31, 0x1e, 0x98, 0xb7, 0x02, 0xf7, 0xbf, 0x99, 
+0x34, 0x10, 0xf3, 0x5b, 0x05, 0x9a, 0x3b, 0x25, 0x47, 0x14, 0x75, 0x2a, 0x8e, 0x78, 0x8f, 0x6a, 
+0x29, 0x93, 0x01, 0x6f, 0xf0, 0x08, 0xf8, 0x5e, 0xf2, 0x14, 0xf8, 0xfe, 0x99, 0x06, 0xf8, 0xbe, 
+0x7a, 0xa7, 0x2f, 0x56, 0x96, 0x03, 0xdf, 0xff, 0xe5, 0xc3, 0x21, 0x68, 0x55, 0x37, 0xde, 0x05, 
+0xce, 0xc7, 0xeb, 0xfc, 0xb0, 0x64, 0xcd, 0x1f, 0x4b, 0xd6, 0x02, 0xb0, 0xd2, 0x73, 0xb2, 0x08, 
+0xb6, 0x15, 0xd0, 0xf2, 0xe0, 0xce, 0x8d, 0xeb, 0xdb, 0x0c, 0x60, 0x1d, 0x25, 0xb0, 0x58, 0x1e, 
+0x2b, 0x81, 0xdd, 0x92, 0x61, 0x00, 0xdb, 0x0e, 0xca, 0xe5, 0x2b, 0x9c, 0x30, 0x34, 0x77, 0xc6, 
+0xb0, 0x5e, 0x8f, 0x32, 0x2d, 0xfd, 0xe5, 0x50, 0x2e, 0xf4, 0xc2, 0xa6, 0x14, 0x35, 0xb6, 0xd1, 
+0x98, 0x45, 0x89, 0x69, 0x7e, 0x5b, 0x8c, 0x89, 0x29, 0x80, 0x71, 0x5b, 0x16, 0xf1, 0x02, 0x8b, 
+0x67, 0xd2, 0xa9, 0x63, 0x80, 0x78, 0xac, 0xad, 0x3c, 0x1b, 0x1b, 0xba, 0x24, 0xcf, 0xdb, 0xb7, 
+0x9c, 0x71, 0x2b, 0x46, 0x8f, 0xb4, 0xb6, 0xa6, 0xcb, 0x48, 0xf3, 0x8d, 0x91, 0x46, 0xbf, 0x42, 
+0x79, 0xfe, 0xad, 0x1d, 0x79, 0x1a, 0x81, 0xdd, 0x52, 0x6c, 0x0c, 0x96, 0xcc, 0xfb, 0xb8, 0xb1, 
+0xa9, 0x23, 0xb0, 0xe9, 0x07, 0x9c, 0xb1, 0x3e, 0x58, 0x0f, 0xb6, 0xe8, 0xe1, 0xcb, 0x89, 0x35, 
+0x46, 0x0f, 0xb6, 0xac, 0x6b, 0x60, 0x4b, 0x52, 0x18, 0xd8, 0xd7, 0xd9, 0x63, 0xe2, 0x94, 0x08, 
+0xda, 0x0b, 0x43, 0x61, 0x7d, 0x61, 0x85, 0x01, 0xae, 0x1e, 0x69, 0xe1, 0x2d, 0x23, 0xa4, 0xb8, 
+0x55, 0x64, 0x16, 0x27, 0x44, 0x4c, 0x7d, 0x9f, 0x11, 0x27, 0x6c, 0x8c, 0x72, 0xc6, 0x2e, 0x2a, 
+0x8a, 0x54, 0xff, 0x1a, 0x40, 0xdc, 0x9c, 0xdf, 0x45, 0xc4, 0x40, 0x98, 0x31, 0xe2, 0x58, 0x2f, 
+0x6c, 0xef, 0x02, 0xc4, 0x47, 0x9a, 0xf4, 0x88, 0x6f, 0x5c, 0x6f, 0xab, 0xc8, 0xa7, 0x73, 0x4c, 
+0xf0, 0x56, 0xd7, 0x00, 0xde, 0x6b, 0x15, 0xa6, 0xa8, 0xee, 0x6f, 0xb2, 0xc7, 0xf0, 0xd0, 0x01, 
+0xa3, 0xc7, 0x1e, 0x68, 0xa8, 0x0d, 0x6e, 0xe0, 0xc0, 0x6a, 0x47, 0xb4, 0xbc, 0xbd, 0xd1, 0xe8, 
+0xf6, 0x41, 0x93, 0xdc, 0x17, 0x63, 0x48, 0x27, 0x34, 0xdf, 0xce, 0x68, 0x9c, 0x5d, 0xd0, 0xb8, 
+0xf7, 0x47, 0x0f, 0xe2, 0x8a, 0x9e, 0x42, 0x8e, 0x1e, 0xc0, 0x0d, 0x63, 0x56, 0x2c, 0xdb, 0x5e, 
+0x35, 0x00, 0x7d, 0x81, 0x07, 0x46, 0xaa, 0x9e, 0xe8, 0x51, 0x06, 0xe2, 0x26, 0xad, 0x02, 0xcd, 
+0xb9, 0x59, 0x34, 0xc5, 0x3b, 0xd4, 0x18, 0x8f, 0x7a, 0xa3, 0x95, 0xf7, 0x41, 0xe7, 0xe3, 0x8b, 
+0xfe, 0x62, 0x30, 0xba, 0x9b, 0x21, 0x18, 0x01, 0x0f, 0x45, 0x6f, 0xd5, 0x4a, 0x7a, 0x2d, 0x62, 
+0x2a, 0xf9, 0x82, 0xb7, 0x21, 0x64, 0xfc, 0x58, 0xf5, 0x71, 0x6e, 0xfc, 0x58, 0x6b, 0xc1, 0x5c, 
+0x44, 0xca, 0x6a, 0x47, 0xfe, 0xcc, 0x3f, 0x91, 0x9a, 0x5e, 0xd5, 0x1c, 0x6b, 0x72, 0x9d, 0xc0, 
+0xb3, 0x79, 0x9d, 0x8c, 0x35, 0xbb, 0x7a, 0x72, 0xc6, 0xcd, 0xae, 0xc3, 0xa3, 0x08, 0xed, 0x2a, 
+0x7a, 0x6e, 0x1f, 0x1a, 0xfa, 0xa1, 0x18, 0x56, 0xd6, 0x2b, 0xd8, 0x90, 0x01, 0xa1, 0xa4, 0xbf, 
+0xa1, 0x5f, 0x62, 0x16, 0x2e, 0x15, 0x65, 0x37, 0x18, 0x54, 0xdd, 0x61, 0x18, 0x61, 0x0b, 0xfa, 
+0x3b, 0x0a, 0x93, 0xfd, 0x41, 0x74, 0xb7, 0x67, 0x3a, 0xdd, 0xed, 0x89, 0x76, 0x64, 0xcd, 0x66, 
+0x04, 0xfe, 0x62, 0xb3, 0x99, 0x1b, 0xfe, 0x70, 0x9a, 0x3b, 0x8e, 0x33, 0x14, 0x82, 0x6d, 0x68, 
+0x28, 0x21, 0xfd, 0x41, 0xf1, 0xab, 0xab, 0x55, 0x82, 0xed, 0xf4, 0x68, 0x42, 0xfa, 0x81, 0x7f, 
+0x19, 0x3d, 0x5a, 0x7d, 0x8a, 0x2c, 0x70, 0x9c, 0xe2, 0x48, 0xe0, 0xaf, 0x13, 0xfc, 0xe7, 0x8b, 
+0x1f, 0x1f, 0x3d, 0x18, 0xc7, 0x45, 0x74, 0xcf, 0x6b, 0xb1, 0x1f, 0xa4, 0x23, 0xc0, 0x31, 0xe2, 
+0xf3, 0x56, 0x80, 0x60, 0xeb, 0x3d, 0x93, 0x10, 0xd7, 0xc9, 0x1c, 0xb6, 0x83, 0x49, 0xed, 0x12, 
+0x20, 0xfa, 0x75, 0xeb, 0x41, 0xf4, 0x1b, 0x36, 0xf6, 0xd0, 0x90, 0xac, 0x6c, 0xec, 0xa3, 0xbc, 
+0x73, 0xb7, 0x17, 0xf6, 0xf0, 0x01, 0x39, 0x95, 0xea, 0xaa, 0x16, 0x72, 0x7a, 0x63, 0xd7, 0x21, 
+0xe8, 0xc0, 0x91, 0xa3, 0x7d, 0xb1, 0x53, 0xd0, 0x09, 0x1b, 0x07, 0x9d, 0x35, 0xa0, 0x51, 0x4b, 
+0x5c, 0x34, 0x24, 0x2e, 0x3e, 0x16, 0x33, 0x92, 0x9d, 0xa8, 0x05, 0xf7, 0xe5, 0xd8, 0x3f, 0xe8, 
+0x86, 0xed, 0x86, 0xee, 0xd8, 0x93, 0x38, 0x00, 0x5b, 0x10, 0x41, 0x0b, 0xd6, 0x26, 0x79, 0x62, 
+0xcf, 0xe2, 0x40, 0x6c, 0x31, 0x54, 0x68, 0x20, 0x34, 0xdb, 0xac, 0xd4, 0x90, 0x2d, 0x5b, 0x37, 
+0x0d, 0xb2, 0x18, 0x45, 0x5a, 0x1c, 0x50, 0x31, 0xe0, 0x59, 0xee, 0xb8, 0xa2, 0x05, 0x0f, 0x68, 
+0xc3, 0x8e, 0x64, 0x1f, 0x34, 0xd7, 0xbe, 0xd8, 0xb3, 0x38, 0x18, 0xad, 0xf7, 0x10, 0x6c, 0x77, 
+0x1c, 0xaa, 0x81, 0x95, 0xd5, 0xcc, 0x50, 0x5c, 0x04, 0xb6, 0x34, 0x37, 0x0f, 0x93, 0x9e, 0x83, 
+0x9e, 0x96, 0x27, 0x67, 0x6d, 0x09, 0x77, 0x0e, 0x20, 0x85, 0x07, 0x5e, 0x6d, 0xc5, 0x57, 0x43, 
+0xc7, 0xde, 0x9a, 0x6d, 0x86, 0x6d, 0x5d, 0x57, 0x2d, 0x2c, 0xc4, 0xf4, 0x34, 0x77, 0x2d, 0x2c, 
+0xed, 0xcc, 0x0c, 0x05, 0xc7, 0xe7, 0xe5, 0xf9, 0x68, 0x61, 0xe1, 0x2d, 0x8b, 0xa5, 0x39, 0x81, 
+0xbb, 0x8d, 0xa1, 0x13, 0x23, 0xf0, 0x0a, 0x0b, 0xf2, 0x14, 0x16, 0xb3, 0x13, 0xbf, 0xc8, 0xd7, 
+0x26, 0xbd, 0x77, 0x49, 0xae, 0x08, 0xb5, 0x0b, 0x8b, 0x9f, 0x7d, 0x20, 0x62, 0xf5, 0xfc, 0xa2, 
+0xa8, 0x2d, 0x0b, 0xb3, 0xc4, 0x1f, 0xb4, 0x07, 0x83, 0xae, 0x4f, 0x7c, 0x18, 0x52, 0x3c, 0x35, 
+0x5b, 0x1e, 0x6a, 0xcc, 0x63, 0x58, 0x1b, 0xd9, 0xbf, 0x1f, 0x8b, 0x17, 0xbe, 0x08, 0x8b, 0x4d, 
+0x98, 0xbb, 0x88, 0xbc, 0x1f, 0xc6, 0xe1, 0x4a, 0x9b, 0xa0, 0x86, 0x21, 0xb8, 0xe3, 0x7a, 0xe2, 
+0xf7, 0x5b, 0xd7, 0x13, 0xb7, 0x77, 0x7a, 0xd8, 0x34, 0xc4, 0x8d, 0x97, 0x11, 0x6f, 0x5a, 0xc9, 
+0xe1, 0x4e, 0x0f, 0x0f, 0x3d, 0xfc, 0xdf, 0xd6, 0xef, 0x63, 0xfa, 0x60, 0xf1, 0x2a, 0x99, 0xf9, 
+0xc6, 0x40, 0x57, 0x1b, 0x19, 0x51, 0xbf, 0x39, 0xa8, 0x9b, 0x8c, 0x78, 0x0e, 0x57, 0x76, 0x97, 
+0x91, 0x51, 0x83, 0x55, 0xb6, 0xb4, 0xa2, 0xd8, 0x0e, 0xed, 0x86, 0x3d, 0x1a, 0x32, 0x93, 0x22, 
+0xef, 0x8c, 0xc4, 0x5e, 0x68, 0xad, 0xda, 0xd6, 0x78, 0x17, 0xde, 0xd4, 0x57, 0x1b, 0xef, 0x5b, 
+0x69, 0xa8, 0x36, 0xce, 0x5e, 0xa1, 0xaf, 0x36, 0xde, 0xb9, 0xc4, 0x0d, 0x77, 0x8c, 0xdc, 0xd1, 
+0x72, 0xb1, 0xf0, 0x95, 0x95, 0x1c, 0x7b, 0xa2, 0x19, 0xd2, 0x07, 0xb0, 0x7b, 0x12, 0x80, 0xb7, 
+0x87, 0x93, 0x14, 0x60, 0xc6, 0x46, 0x78, 0x99, 0xb9, 0xd9, 0x00, 0x1c, 0x80, 0xcf, 0x33, 0xe2, 
+0x8b, 0x16, 0x71, 0x30, 0x1a, 0xd2, 0x21, 0x68, 0x16, 0x87, 0xa2, 0x1d, 0xf4, 0xd3, 0x80, 0xe5, 
+0xc2, 0x32, 0xe3, 0x5d, 0x71, 0x23, 0x03, 0xb0, 0xd8, 0xd8, 0xb7, 0x75, 0x9d, 0xf1, 0x27, 0x59, 
+0x04, 0x79, 0x8c, 0x5d, 0x91, 0xe3, 0xc7, 0xc9, 0x78, 0x63, 0xae, 0x99, 0xfe, 0x09, 0xe1, 0xdf, 
+0x31, 0x5b, 0xab, 0x2d, 0x18, 0x5b, 0xa5, 0x68, 0x66, 0x95, 0xe0, 0x4b, 0x5d, 0x0a, 0xab, 0x46, 
+0x2b, 0x60, 0xd5, 0x68, 0x4f, 0x58, 0x35, 0xda, 0x2d, 0x9a, 0x33, 0x6e, 0xbe, 0x87, 0x8d, 0x03, 
+0xf7, 0x59, 0x99, 0x51, 0x11, 0x06, 0xf5, 0x98, 0x33, 0x1f, 0x51, 0xc2, 0xef, 0x8e, 0x56, 0x69, 
+0x20, 0x04, 0x9b, 0x05, 0xf6, 0x66, 0x40, 0x4c, 0x80, 0xd0, 0x1d, 0x1b, 0x31, 0xfb, 0x4d, 0xd6, 
+0x92, 0x63, 0xb9, 0x60, 0x86, 0x86, 0xc4, 0x10, 0x1b, 0x5f, 0x24, 0xd5, 0x17, 0x49, 0x95, 0x91, 
+0x76, 0xff, 0x84, 0xf0, 0xfe, 0x66, 0x49, 0xed, 0xc1, 0x33, 0x8a, 0x78, 0x46, 0x11, 0xcf, 0x28, 
+0xe2, 0xcd, 0x51, 0xc4, 0x53, 0x8a, 0x20, 0x61, 0x00, 0x62, 0xb0, 0x76, 0x89, 0x12, 0xf0, 0xaf, 
+0x55, 0x58, 0xda, 0x3e, 0x21, 0x90, 0x35, 0x13, 0x73, 0x66, 0xdf, 0x3d, 0x2e, 0x6a, 0x0c, 0x59, 
+0xd9, 0xf9, 0x66, 0x62, 0x21, 0x6e, 0xe8, 0x39, 0x7d, 0x33, 0x31, 0x51, 0xbc, 0xea, 0x66, 0xe2, 
+0x5a, 0x75, 0x99, 0xa1, 0x99, 0xf8, 0xce, 0xd3, 0x5e, 0x3c, 0xcd, 0xd4, 0x1d, 0xb5, 0x64, 0xc1, 
+0x94, 0x92, 0x52, 0xa3, 0x13, 0x27, 0x8c, 0x59, 0xf6, 0x1f, 0x70, 0x1e, 0xf3, 0x5a, 0xde, 0x79, 
+0xda, 0x45, 0x4c, 0x3c, 0x52, 0x2e, 0xea, 0xbb, 0x88, 0x13, 0xec, 0xd7, 0xb2, 0x2e, 0x62, 0xb4, 
+0x5a, 0x6b, 0x6e, 0xc9, 0x19, 0xbb, 0xdc, 0x78, 0xda, 0x80, 0x49, 0x6d, 0x58, 0xd6, 0x41, 0x0f, 
+0x0c, 0x50, 0x3c, 0x79, 0xda, 0x8c, 0x49, 0xfb, 0x8b, 0x93, 0x53, 0xdb, 0xf4, 0x17, 0x93, 0xad, 
+0x9e, 0x2a, 0xdc, 0x0f, 0x07, 0xbb, 0xd0, 0xb6, 0xbb, 0x98, 0xa7, 0x1b, 0x03, 0x83, 0x71, 0x2a, 
+0xaf, 0xa0, 0x6d, 0xc6, 0x0d, 0x8d, 0x43, 0xb5, 0x44, 0x3d, 0xaa, 0xa9, 0xb9, 0xe3, 0x46, 0x63, 
+0x2b, 0xec, 0x72, 0x63, 0xdd, 0x77, 0xb4, 0xf3, 0xce, 0x2e, 0xec, 0x74, 0x78, 0x6e, 0x44, 0x76, 
+0xe4, 0xfd, 0xa8, 0xaa, 0xb9, 0x7b, 0xc4, 0x33, 0x81, 0xc7, 0x82, 0x8e, 0x06, 0x3f, 0x08, 0xa9, 
+0x99, 0xb0, 0x57, 0x1e, 0x13, 0xea, 0x60, 0xe8, 0xc2, 0xfb, 0x22, 0xf1, 0xcb, 0x8c, 0xf9, 0xf5, 
+0x86, 0x5e, 0xbc, 0xf7, 0x92, 0x3e, 0xc8, 0x9c, 0x58, 0x68, 0xbe, 0x01, 0x99, 0x7c, 0x24, 0xa7, 
+0x62, 0x7f, 0x8f, 0xa9, 0x9c, 0x79, 0xb1, 0x07, 0x44, 0xf9, 0x93, 0x7f, 0x33, 0xa3, 0x72, 0xd8, 
+0xf3, 0x7b, 0xc7, 0x23, 0x85, 0xb5, 0x0d, 0x5a, 0x81, 0xb3, 0xc8, 0xa3, 0x55, 0x7f, 0xb9, 0xc7, 
+0xa8, 0x48, 0xca, 0x2b, 0x1c, 0x59, 0xcb, 0x68, 0x6f, 0x2d, 0xc8, 0x22, 0x2d, 0x9d, 0xba, 0x8a, 
+0xe4, 0x54, 0x2a, 0x8f, 0xa6, 0x66, 0x27, 0xfc, 0xb7, 0x86, 0x46, 0x43, 0x6b, 0xaf, 0x9c, 0x75, 
+0xbd, 0x7a, 0x68, 0x69, 0x4f, 0xb8, 0x27, 0x6b, 0x7e, 0x55, 0x12, 0xee, 0x3c, 0x2d, 0xb6, 0x1e, 
+0x4c, 0xb3, 0xf9, 0x33, 0x52, 0x93, 0xb6, 0xbe, 0x94, 0xc4, 0x7c, 0x83, 0xa2, 0x5d, 0x78, 0x46, 
+0x44, 0xc2, 0xdc, 0xfb, 0x91, 0x59, 0xf3, 0xeb, 0xa3, 0x12, 0x03, 0x33, 0x83, 0xd6, 0x4e, 0x78, 
+0x10, 0x9c, 0x3d, 0xb1, 0x30, 0x24, 0xa9, 0x83, 0xa6, 0x54, 0xa9, 0x79, 0x70, 0x6e, 0x09, 0xb6, 
+0x0f, 0x62, 0x07, 0x76, 0xd0, 0xb5, 0x09, 0xa5, 0xd8, 0xaa, 0x28, 0x57, 0x90, 0xdb, 0x4d, 0xc8, 
+0xa2, 0x0f, 0xdf, 0xef, 0xa8, 0x1b, 0x74, 0x2a, 0xef, 0xce, 0xa9, 0x38, 0x16, 0xee, 0xe0, 0x9c, 
+0xc3, 0xe9, 0xb8, 0x03, 0x66, 0xba, 0x41, 0x65, 0x10, 0xc6, 0x64, 0x44, 0x1b, 0x5a, 0x3f, 0x7c, 
+0x07, 0x60, 0x4f, 0xa8, 0xf2, 0x80, 0x25, 0x8c, 0xaa, 0xfd, 0xd8, 0x00, 0x72, 0x70, 0x1f, 0xb6, 
+0x4f, 0xbb, 0xcd, 0x74, 0xc5, 0x6b, 0x69, 0xb2, 0x06, 0xd0, 0x6b, 0x69, 0xaa, 0xbb, 0xe3, 0xa5, 
+0x35, 0xd3, 0xfb, 0xd9, 0x82, 0x71, 0xf7, 0x1a, 0x64, 0x27, 0xb3, 0xba, 0x70, 0xe1, 0x5c, 0xfb, 
+0xbd, 0xa1, 0x32, 0x52, 0x93, 0x86, 0xed, 0x6e, 0x67, 0xcf, 0xce, 0xe8, 0xaf, 0xc1, 0x93, 0x56, 
+0x7a, 0x80, 0x37, 0x50, 0x4e, 0x43, 0x1a, 0xe3, 0x68, 0x68, 0x00, 0x0d, 0x97, 0x3c, 0xe8, 0xc1, 
+0x9e, 0x27, 0x8e, 0xe5, 0xe0, 0xec, 0xf6, 0xec, 0x8d, 0x51, 0x62, 0x71, 0xc6, 0x22, 0x15, 0x4f, 
+0x14, 0x0d, 0xd3, 0xfb, 0x79, 0x69, 0xf8, 0xf3, 0xe7, 0x17, 0xb7, 0x6d, 0xad, 0xb6, 0x20, 0x6f, 
+0xe5, 0x05, 0xc8, 0xc8, 0x08, 0xcf, 0x91, 0x54, 0x63, 0x8d, 0x63, 0xa1, 0x97, 0x6e, 0x1d, 0x35, 
+0x6e, 0xe5, 0x2c, 0x61, 0xd2, 0xe8, 0x44, 0xdb, 0x28, 0x3d, 0xd1, 0x74, 0x74, 0xc6, 0x98, 0x98, 
+0xcc, 0xb2, 0x34, 0x90, 0x80, 0xed, 0xda, 0x73, 0xf7, 0xd0, 0x55, 0x62, 0x69, 0x78, 0x21, 0x08, 
+0xdd, 0xca, 0xf0, 0x9a, 0xc0, 0x75, 0x72, 0x85, 0x7b, 0x37, 0xd3, 0x47, 0x4b, 0x5b, 0x50, 0x37, 
+0x72, 0xd0, 0x89, 0x4c, 0xfc, 0x48, 0x7d, 0x92, 0x9b, 0xf8, 0x91, 0x85, 0xcc, 0x9c, 0x13, 0x19, 
+0xc7, 0xee, 0x28, 0xe2, 0x37, 0x49, 0xba, 0xb0, 0xc6, 0xe4, 0x9e, 0x17, 0xd0, 0x05, 0xb3, 0x8e, 
+0xbb, 0xa5, 0x77, 0xad, 0x9a, 0x1e, 0x03, 0x2c, 0xa2, 0xe7, 0xb2, 0x8b, 0xbb, 0xf1, 0xb4, 0x5b, 
+0x11, 0x25, 0x4e, 0x66, 0xbc, 0x0e, 0xd9, 0xc1, 0x8a, 0x2b, 0x78, 0xef, 0xc4, 0x68, 0x25, 0xe6, 
+0xf0, 0x58, 0xa2, 0xb3, 0x2f, 0xda, 0x8b, 0x07, 0x07, 0x32, 0xbd, 0x9f, 0x9e, 0xdd, 0x74, 0xda, 
+0xa7, 0xa2, 0xb8, 0xf1, 0x71, 0x8e, 0xce, 0xa2, 0x6c, 0x85, 0x8e, 0x64, 0x85, 0xf1, 0xc2, 0xdf, 
+0x91, 0x64, 0xb3, 0x77, 0x00, 0x4c, 0x92, 0x48, 0x1e, 0x2c, 0x4b, 0x96, 0x31, 0x52, 0x87, 0x71, 
+0x48, 0xba, 0x2f, 0x37, 0x8c, 0xaa, 0x6f, 0x2e, 0x77, 0x95, 0xeb, 0x28, 0xd6, 0xb0, 0x22, 0xe4, 
+0x2c, 0x03, 0x80, 0x5b, 0x61, 0xe7, 0xfa, 0xd3, 0xf3, 0x8c, 0x3c, 0x6b, 0x1c, 0xcf, 0x53, 0x20, 
+0x0d, 0xf4, 0x3c, 0xe3, 0x82, 0x2d, 0x8e, 0x3f, 0xd3, 0xf3, 0x8c, 0x7f, 0x18, 0x07, 0xe9, 0x4c, 
+0x7d, 0x4f, 0x4a, 0x11, 0xa5, 0x21, 0x9e, 0x34, 0x6a, 0x71, 0x06, 0xbc, 0x35, 0x2e, 0x32, 0x32, 
+0x5a, 0x91, 0xc6, 0x6a, 0x26, 0x8c, 0xe3, 0x78, 0x0d, 0xb0, 0xc5, 0x43, 0xc9, 0x93, 0x69, 0x8b, 
+0xee, 0xb8, 0xa8, 0x78, 0x01, 0xfc, 0x57, 0x3f, 0xe0, 0xca, 0x8c, 0xc5, 0x17, 0x5f, 0x57, 0x9f, 
+0x94, 0x02, 0x79, 0x8c, 0xc9, 0xa8, 0xda, 0x9a, 0xc6, 0xf2, 0xa0, 0xc2, 0x8b, 0x69, 0x37, 0x74, 
+0xb5, 0x71, 0x37, 0x74, 0x1b, 0x1d, 0xee, 0xac, 0xae, 0xd6, 0xf1, 0x61, 0x89, 0x62, 0x92, 0xbc, 
+0xae, 0x3d, 0x9d, 0x7f, 0x31, 0x5d, 0xae, 0xe5, 0x67, 0x2f, 0xd3, 0xc6, 0xca, 0x6b, 0x89, 0x8b, 
+0x8c, 0x1d, 0xad, 0x80, 0x40, 0xbd, 0xe8, 0x97, 0x94, 0x74, 0x47, 0x62, 0x5e, 0xa3, 0x5b, 0x88, 
+0x31, 0xd1, 0xfe, 0xce, 0xe9, 0xb9, 0x9a, 0xbd, 0x52, 0xad, 0xcf, 0xc0, 0xa8, 0x84, 0xe9, 0x59, 
+0x55, 0x1e, 0x95, 0xed, 0x79, 0x7a, 0xca, 0x79, 0x81, 0xaa, 0xea, 0x2c, 0x7a, 0x62, 0xf5, 0x33, 
+0x95, 0xf0, 0x3f, 0xe8, 0x89, 0xd5, 0x45, 0x2a, 0xe7, 0x7c, 0x2a, 0xe7, 0x4b, 0x4c, 0x21, 0xf5, 
+0x39, 0xfd, 0x37, 0x93, 0x5c, 0x35, 0x60, 0xdf, 0xf3, 0xe5, 0x1a, 0xc8, 0xc9, 0x2f, 0x51, 0x3b, 
+0xb3, 0x7c, 0xa0, 0x06, 0x92, 0xf4, 0x54, 0x52, 0xd9, 0x73, 0x76, 0xfa, 0xe7, 0x05, 0xe1, 0x37, 
+0xe6, 0x6c, 0x99, 0xfb, 0x60, 0x5e, 0xf3, 0xfc, 0xa2, 0x6f, 0x52, 0x16, 0x66, 0x6a, 0x0f, 0x8c, 
+0xb9, 0x1c, 0x78, 0x64, 0xdc, 0xe6, 0x09, 0x57, 0x3f, 0x6e, 0x9a, 0xf8, 0x70, 0x52, 0xf2, 0xd4, 
+0x0c, 0x79, 0x65, 0xa8, 0x55, 0x58, 0x3c, 0x62, 0x14, 0x7f, 0x40, 0xb6, 0xcb, 0x43, 0xab, 0xf8, 
+0xb0, 0x33, 0xe2, 0x69, 0x79, 0x55, 0x1d, 0x1f, 0xb5, 0x34, 0xe4, 0x96, 0xbc, 0xae, 0xc2, 0x22, 
+0x6c, 0x6f, 0x78, 0xb6, 0xb8, 0x27, 0x30, 0x4b, 0x5e, 0xd1, 0xc0, 0x2f, 0x3c, 0x36, 0x35, 0x57, 
+0xde, 0x50, 0xe6, 0x14, 0xa6, 0x9b, 0x9d, 0x88, 0xb8, 0xe7, 0x6c, 0x00, 0x67, 0xb0, 0x6b, 0x5e, 
+0xf1, 0xfc, 0x6d, 0x28, 0x82, 0x85, 0xfb, 0xc5, 0x1c, 0x6d, 0x12, 0x8a, 0x61, 0xdc, 0x7a, 0xdc, 
+0x78, 0xfe, 0xf8, 0xd1, 0xc4, 0xad, 0x28, 0x0e, 0xdc, 0x11, 0x2f, 0xb7, 0x88, 0x5c, 0x15, 0xd5, 
+0x18, 0xbc, 0x12, 0x04, 0x57, 0x5e, 0xdf, 0x36, 0x53, 0xa9, 0xaf, 0xb5, 0x9a, 0xbd, 0x6c, 0xfe, 
+0xc1, 0x6f, 0x9e, 0x6a, 0x63, 0x27, 0x1e, 0x9d, 0x54, 0x08, 0xe2, 0xb1, 0x0a, 0x41, 0xd7, 0x30, 
+0xe9, 0x83, 0x8e, 0xe2, 0xf7, 0xa1, 0x51, 0xb4, 0xef, 0x12, 0xe6, 0x97, 0xef, 0x07, 0xb4, 0xc5, 
+0xae, 0x71, 0x5a, 0x0d, 0x5f, 0x5b, 0x43, 0x3b, 0xc5, 0x69, 0x7b, 0x6b, 0x7d, 0xdd, 0xf3, 0x3b, 
+0x32, 0xb1, 0x41, 0xbc, 0xdd, 0xee, 0x40, 0x2d, 0xb9, 0x55, 0xd8, 0xf5, 0xae, 0xcc, 0x17, 0xe8, 
+0x0e, 0xc4, 0x6b, 0xbc, 0x5a, 0xf5, 0x07, 0x42, 0x62, 0xa2, 0x6e, 0x13, 0xb8, 0x7f, 0x4c, 0x3b, 
+0x5b, 0x27, 0x8d, 0x17, 0xcc, 0xf2, 0x55, 0x6f, 0x6e, 0x23, 0xd8, 0x25, 0x70, 0x45, 0x61, 0xec, 
+0x52, 0xb8, 0x22, 0x5d, 0x87, 0xfc, 0x75, 0xa6, 0x86, 0x75, 0x91, 0x0b, 0x35, 0xac, 0x8b, 0x55, 
+0x38, 0x41, 0xf4, 0x8b, 0x13, 0x58, 0x0f, 0x7b, 0x2d, 0x49, 0x58, 0xfb, 0xf5, 0x47, 0x4c, 0x73, 
+0xf1, 0x32, 0xa7, 0xab, 0x2e, 0x78, 0xd5, 0x88, 0x0a, 0x37, 0xd7, 0x20, 0xa8, 0x3b, 0x78, 0xd4, 
+0x5b, 0x4b, 0x4a, 0x4a, 0xbf, 0xfb, 0x14, 0x72, 0xd9, 0x65, 0xb1, 0x60, 0x52, 0xb4, 0x64, 0xc9, 
+0x8e, 0xbf, 0x4e, 0x26, 0xb6, 0x3f, 0x91, 0x72, 0xdb, 0x67, 0xc4, 0x3b, 0x6e, 0x66, 0x9c, 0x1d, 
+0x5e, 0xf9, 0x44, 0x65, 0x52, 0x59, 0xe1, 0x80, 0x9c, 0x34, 0x57, 0x4b, 0x97, 0xbd, 0xa2, 0x9d, 
+0xe3, 0xc8, 0xc6, 0x06, 0x17, 0xa9, 0x38, 0xac, 0xe3, 0xba, 0xe8, 0x8c, 0x44, 0x93, 0x7e, 0x84, 
+0xd2, 0x54, 0x85, 0xbb, 0x0a, 0x8f, 0xe6, 0x25, 0x29, 0x2c, 0xf0, 0x42, 0x61, 0xeb, 0x37, 0xfd, 
+0xcb, 0xd2, 0x7d, 0x50, 0x12, 0xbe, 0xb8, 0x09, 0xda, 0x6a, 0xd3, 0x3f, 0x00, 0x4f, 0x1c, 0x0c, 
+0xed, 0xfa, 0x0b, 0xc9, 0xd2, 0x78, 0x4b, 0xf0, 0x72, 0x21, 0x1f, 0x43, 0xaa, 0x14, 0x22, 0xbe, 
+0x66, 0x96, 0xed, 0xec, 0xce, 0xbd, 0x0f, 0xf9, 0xcb, 0x1c, 0x9b, 0xab, 0xe8, 0xf7, 0xe1, 0xc2, 
+0x49, 0x19, 0x9b, 0x8b, 0xa4, 0xdb, 0xd1, 0x0e, 0xf0, 0x6c, 0xbe, 0x22, 0xdd, 0x8e, 0xb6, 0x5d, 
+0x60, 0xf3, 0x71, 0xfa, 0x73, 0x25, 0xff, 0x37, 0x0b, 0x36, 0x67, 0xb1, 0xdd, 0x7f, 0xfe, 0x4b, 
+0x4b, 0x36, 0x6f, 0xb2, 0x60, 0xde, 0xb3, 0xf4, 0x95, 0xdd, 0x92, 0xd6, 0xe5, 0x9b, 0xd1, 0xd0, 
+0x7d, 0x36, 0x99, 0xb9, 0x22, 0xab, 0xc3, 0xb6, 0x67, 0xec, 0x1f, 0xaf, 0xac, 0x68, 0xe7, 0x9a, 
+0xbf, 0xfa, 0x3a, 0x7d, 0x03, 0x6e, 0x6d, 0x4d, 0x97, 0x16, 0x58, 0x17, 0xae, 0x42, 0x6b, 0xef, 
+0xca, 0x3f, 0xda, 0x7b, 0x3b, 0x19, 0x15, 0xd2, 0xf8, 0x8e, 0xac, 0xe6, 0xb6, 0x37, 0x03, 0x34, 
+0xd1, 0x2b, 0xd1, 0x9a, 0x9f, 0x03, 0xd9, 0x70, 0xc7, 0xdf, 0xff, 0x0c, 0xe2, 0x85, 0x2f, 0x89, 
+0xd8, 0x08, 0xeb, 0x22, 0xf3, 0x17, 0xdf, 0xb5, 0x2b, 0xd9, 0x46, 0x93, 0xcb, 0xde, 0xcc, 0xe3, 
+0xa4, 0xab, 0x95, 0xe2, 0xac, 0xaf, 0xeb, 0x12, 0xce, 0xca, 0x8a, 0x56, 0x97, 0x01, 0xbc, 0x38, 
+0xce, 0xe6, 0x26, 0x73, 0xf7, 0xdc, 0x2d, 0x36, 0x7f, 0xcf, 0x5d, 0x27, 0x84, 0xfa, 0xdb, 0x83, 
+0x8d, 0x79, 0x49, 0xb0, 0x46, 0x30, 0xff, 0xf6, 0x12, 0x6b, 0xb6, 0x83, 0x8b, 0x39, 0x0d, 0x50, 
+0x23, 0x82, 0x5e, 0x0a, 0x6a, 0xec, 0x0b, 0x42, 0xd5, 0x8b, 0xd4, 0x58, 0x81, 0x97, 0xbc, 0xf8, 
+0x62, 0xfd, 0x9f, 0x80, 0x1a, 0xf7, 0xe2, 0x50, 0x8d, 0x40, 0xc6, 0x93, 0x8f, 0xac, 0xac, 0x6c, 
+0x2e, 0x71, 0xe0, 0x85, 0x60, 0x78, 0x8e, 0x17, 0x2a, 0x92, 0xbc, 0xd0, 0x33, 0xc9, 0x0b, 0x95, 
+0x48, 0x5e, 0xa8, 0x46, 0xf2, 0x42, 0x25, 0x92, 0x17, 0xaa, 0x96, 0xbc, 0x50, 0xb9, 0xe4, 0x85, 
+0x1a, 0x25, 0x2f, 0xf4, 0x4c, 0xf2, 0x42, 0x0d, 0x92, 0x17, 0xaa, 0x92, 0xbc, 0xd0, 0x3f, 0x25, 
+0x2f, 0xf4, 0xb8, 0xb5, 0x17, 0x32, 0x9b, 0x08, 0xb5, 0xf1, 0x42, 0x1e, 0x26, 0x5e, 0x08, 0xa3, 
+0x8b, 0x41, 0xae, 0x76, 0xb4, 0x5a, 0xa0, 0x9f, 0xb1, 0x37, 0x32, 0xf6, 0x43, 0x7a, 0x0f, 0x84, 
+0x91, 0x1f, 0x16, 0x3b, 0x7a, 0xb7, 0x94, 0xce, 0xba, 0x9b, 0x29, 0x9d, 0x9d, 0x89, 0x25, 0xa8, 
+0xa3, 0xb0, 0xce, 0xd1, 0x13, 0x5b, 0xf0, 0xdc, 0x46, 0xd8, 0x81, 0x36, 0x4c, 0x7f, 0x09, 0x7d, 
+0xaf, 0xac, 0xd0, 0x2b, 0x41, 0xd6, 0xf2, 0xae, 0xda, 0x6b, 0x8e, 0xcc, 0xf2, 0x32, 0xba, 0xa3, 
+0x46, 0xa5, 0x6c, 0x47, 0x05, 0x6a, 0x6b, 0xcc, 0xaa, 0x00, 0x5a, 0x93, 0xd6, 0xa1, 0xdf, 0x2b, 
+0xe7, 0x42, 0xa7, 0x56, 0xc2, 0x2b, 0x62, 0xc2, 0xc2, 0x17, 0x65, 0x42, 0x8b, 0x9f, 0xd2, 0x57, 
+0xbc, 0xbe, 0x52, 0x25, 0x68, 0x7c, 0x2e, 0xfe, 0xe6, 0xa6, 0x17, 0xc4, 0x0f, 0x96, 0xc0, 0x08, 
+0x7f, 0x74, 0x47, 0xf8, 0xe9, 0xd5, 0x51, 0xe6, 0xf0, 0x57, 0x57, 0x91, 0x56, 0xfe, 0xeb, 0x95, 
+0x73, 0xa1, 0x53, 0x4a, 0xf0, 0x8a, 0x98, 0x10, 0xf3, 0xa2, 0x4c, 0x30, 0xba, 0x82, 0xe1, 0x77, 
+0xb0, 0x04, 0xf6, 0x84, 0xbc, 0x12, 0xf8, 0xb1, 0x1d, 0xc1, 0x8f, 0x08, 0xea, 0x40, 0x07, 0x4c, 
+0x1d, 0xde, 0xef, 0x61, 0x08, 0x5e, 0x15, 0x0f, 0xe2, 0x5e, 0x94, 0x07, 0x2d, 0x9e, 0xf0, 0xd7, 
+0x6d, 0x36, 0x98, 0x8f, 0x7d, 0xaa, 0xfe, 0x02, 0x06, 0x1b, 0xb3, 0x9b, 0xf3, 0x73, 0xa4, 0xdd, 
+0xc6, 0x2c, 0x72, 0x90, 0x47, 0x4f, 0x95, 0xc5, 0xe1, 0x9c, 0xc3, 0xed, 0x92, 0x85, 0xc2, 0x1c, 
+0x18, 0xa5, 0x14, 0x92, 0xc0, 0x5d, 0xbd, 0x17, 0xd5, 0xcb, 0x62, 0x37, 0xf8, 0xb4, 0xf7, 0xa3, 
+0xde, 0xb4, 0x3c, 0x06, 0x3e, 0x2e, 0x28, 0x2a, 0xd8, 0xca, 0x12, 0xdc, 0xd7, 0x07, 0x51, 0xf1, 
+0xd6, 0xe5, 0xd6, 0x6d, 0xf3, 0x2b, 0xba, 0x8f, 0xdf, 0xee, 0xe6, 0x32, 0xdd, 0x89, 0x53, 0x72, 
+0xfc, 0xf9, 0x0b, 0x74, 0x5b, 0xbe, 0x55, 0xc5, 0x27, 0xbd, 0x46, 0xe7, 0x60, 0x23, 0x75, 0x8a, 
+0xcd, 0xd4, 0x29, 0x36, 0xd1, 0x4b, 0x74, 0x2e, 0xea, 0xcf, 0x08, 0x68, 0x8f, 0x0a, 0xf5, 0x8d, 
+0xfb, 0x69, 0x86, 0x56, 0x69, 0xcb, 0x3a, 0x36, 0xe8, 0xd9, 0x4d, 0x8d, 0x3d, 0x4e, 0x09, 0x6b, 
+0x1d, 0x70, 0x4a, 0x4c, 0xa2, 0x07, 0x5a, 0x71, 0xeb, 0x7a, 0xe2, 0x27, 0xb2, 0x7b, 0xb1, 0xf3, 
+0x17, 0x47, 0x9c, 0x96, 0xec, 0xa0, 0x87, 0x5c, 0xbb, 0x1f, 0xd3, 0x43, 0xae, 0x9d, 0xd7, 0xfa, 
+0xc6, 0xf3, 0xa4, 0x2f, 0xe9, 0xbb, 0xab, 0xef, 0x2f, 0xc4, 0x89, 0xdd, 0x28, 0x4b, 0x3d, 0xed, 
+0x21, 0xea, 0x69, 0x0f, 0xd3, 0xd3, 0x2e, 0x5d, 0x0e, 0xbd, 0x27, 0xf6, 0x4e, 0xb5, 0x9c, 0x1d, 
+0xed, 0xb8, 0xd1, 0xd6, 0x18, 0xfd, 0x69, 0x0e, 0xbd, 0x80, 0xa0, 0x8e, 0xde, 0x43, 0x50, 0x56, 
+0x8f, 0x55, 0xad, 0xe4, 0x29, 0xdd, 0x17, 0xd8, 0x57, 0xa8, 0xe6, 0x59, 0x6d, 0x27, 0x4e, 0x47, 
+0x73, 0x87, 0xf0, 0xb4, 0xb6, 0x73, 0xa8, 0x8c, 0xde, 0xa5, 0xc8, 0x8e, 0x75, 0x8c, 0x5a, 0x61, 
+0xb2, 0x3a, 0xc0, 0xff, 0xff, 0x3d, 0x72, 0x9c, 0x0e, 0x32, 0xe0, 0xac, 0x38, 0xd2, 0x04, 0x32, 
+0x05, 0x9b, 0xca, 0xe2, 0x20, 0xf3, 0x60, 0xf5, 0xf8, 0xf0, 0x83, 0xbb, 0xfb, 0xe0, 0xb8, 0xb3, 
+0x2f, 0x8e, 0xbb, 0xcc, 0x01, 0xc3, 0x51, 0xc7, 0x70, 0x39, 0x32, 0x40, 0x14, 0x49, 0xaf, 0x3a, 
+0x9a, 0xe4, 0xef, 0x6b, 0xa1, 0x1d, 0x5f, 0x97, 0xfc, 0x5c, 0xda, 0x3b, 0x75, 0x56, 0x60, 0x63, 
+0x7c, 0x9b, 0x25, 0x16, 0xad, 0xb6, 0x7b, 0x5e, 0xf0, 0x1b, 0x5f, 0x9c, 0xa9, 0x68, 0x77, 0xd7, 
+0x18, 0x0b, 0x78, 0x8d, 0x16, 0x1b, 0x53, 0x30, 0x89, 0xcb, 0x4c, 0x97, 0xfa, 0xb2, 0xeb, 0x91, 
+0x81, 0x97, 0x17, 0x28, 0x2f, 0x7f, 0x96, 0x94, 0x64, 0xfd, 0x06, 0x57, 0x56, 0xab, 0xcd, 0xba, 
+0x11, 0x25, 0xad, 0xe0, 0x64, 0x8a, 0xf3, 0x92, 0x36, 0x48, 0x6a, 0x30, 0x54, 0x43, 0xbe, 0x1a, 
+0xff, 0xb0, 0xed, 0xc1, 0xa4, 0x0d, 0x43, 0x16, 0x55, 0xc4, 0xb0, 0x85, 0x3c, 0x6a, 0x1f, 0x9d, 
+0xd9, 0x5b, 0x90, 0xed, 0xc2, 0x9e, 0x86, 0xe7, 0x47, 0xd4, 0xcc, 0x2d, 0x89, 0x6c, 0x88, 0x6a, 
+0x12, 0xcb, 0x02, 0x2f, 0x05, 0xd5, 0x4e, 0x28, 0x0d, 0x6e, 0x0c, 0x69, 0x96, 0x4f, 0xf3, 0xee, 
+0x3e, 0x7b, 0xd9, 0x9c, 0xe4, 0xaf, 0xd2, 0xe6, 0x66, 0x44, 0x96, 0x6b, 0x63, 0xc7, 0xa5, 0x8e, 
+0x4f, 0x9f, 0x90, 0x19, 0x5c, 0x21, 0x9f, 0x01, 0x6b, 0x0d, 0x29, 0x6e, 0xdf, 0xd6, 0x48, 0xca, 
+0x06, 0x4e, 0xe0, 0xdb, 0x4f, 0xe8, 0x2e, 0xb4, 0x01, 0x3c, 0x21, 0x19, 0x54, 0x91, 0x32, 0xf5, 
+0xe0, 0xf1, 0xf4, 0x17, 0x56, 0x08, 0x2d, 0x1a, 0xc3, 0x7f, 0xa8, 0x30, 0xe6, 0x83, 0xb4, 0x2c, 
+0xa8, 0x66, 0x51, 0x5d, 0xca, 0x3d, 0x26, 0xe9, 0x12, 0x55, 0x49, 0xaa, 0x4a, 0x87, 0x3b, 0x2f, 
+0xf5, 0x3e, 0x06, 0xbe, 0x7c, 0x5b, 0x3b, 0xbf, 0xfe, 0xf3, 0xfc, 0x39, 0xc9, 0x73, 0xd3, 0xbe, 
+0x29, 0x32, 0xf0, 0x68, 0x62, 0xe1, 0x27, 0x65, 0x63, 0x2e, 0x8d, 0x4b, 0x9d, 0x90, 0x3e, 0xe9, 
+0x91, 0xe9, 0xb5, 0xa6, 0xec, 0x6e, 0x68, 0xa6, 0x09, 0x78, 0x2b, 0xb4, 0xfb, 0x6b, 0x4c, 0x13, 
+0xe6, 0x66, 0x1b, 0xeb, 0xc2, 0x84, 0xa3, 0xa8, 0x0d, 0xf4, 0x70, 0x97, 0xad, 0x4a, 0xe9, 0x5a, 
+0x57, 0x9e, 0x1e, 0xb8, 0xd2, 0x75, 0x56, 0x52, 0xaa, 0x67, 0x86, 0x16, 0x74, 0x83, 0x16, 0x06, 
+0x24, 0xa7, 0x4a, 0x85, 0x01, 0x2d, 0xba, 0x20, 0x19, 0x0c, 0x77, 0x7a, 0xa9, 0xce, 0x51, 0x0f, 
+0x86, 0x5c, 0xc1, 0x6a, 0xc3, 0xe9, 0x59, 0xc4, 0xcf, 0x83, 0x99, 0x69, 0xa2, 0x4c, 0xc9, 0xc8, 
+0x6c, 0xcb, 0x14, 0xfd, 0xfa, 0x6a, 0x8f, 0x35, 0x16, 0xc8, 0x1a, 0x64, 0xcc, 0xf3, 0x0f, 0x66, 
+0xcd, 0xc2, 0x77, 0x40, 0xf8, 0x89, 0xe5, 0xb8, 0x14, 0x92, 0xd3, 0xf4, 0x0c, 0x48, 0xaa, 0xc0, 
+0xe5, 0x90, 0x9a, 0xce, 0x58, 0xb0, 0xcf, 0x26, 0x2c, 0x25, 0xa2, 0x2a, 0xf2, 0x4e, 0x72, 0x93, 
+0x78, 0x31, 0xa8, 0x26, 0xf8, 0x69, 0x6a, 0xb3, 0x7c, 0x1f, 0x4b, 0x3a, 0x2f, 0x32, 0xb6, 0x38, 
+0x30, 0xf3, 0xd2, 0x43, 0x5a, 0x26, 0xf4, 0x32, 0xeb, 0x87, 0x12, 0x93, 0xa8, 0xb1, 0xbd, 0xf3, 
+0xb4, 0x0f, 0xb3, 0x57, 0x12, 0xcb, 0x9c, 0x98, 0xe9, 0x34, 0xa7, 0x46, 0x26, 0x7c, 0xa3, 0x45, 
+0x04, 0xe9, 0x69, 0x12, 0xfb, 0x06, 0x30, 0xf6, 0x79, 0xb0, 0x2b, 0xcd, 0x5b, 0xb8, 0x88, 0x3a, 
+0xe5, 0xc3, 0x04, 0xe3, 0xcb, 0x2e, 0x32, 0x37, 0xe6, 0x69, 0xd6, 0xc1, 0xce, 0xa9, 0x18, 0xd6, 
+0x05, 0x34, 0x45, 0x94, 0xb7, 0xd4, 0x05, 0x34, 0x07, 0x55, 0xb4, 0xd4, 0x05, 0xbc, 0x08, 0x5f, 
+0xcd, 0xd5, 0x09, 0x30, 0x55, 0x32, 0x59, 0x61, 0xf6, 0x94, 0x05, 0x7a, 0xb6, 0x50, 0x4e, 0x80, 
+0x3e, 0xa5, 0xa5, 0xb7, 0xa3, 0x4f, 0x12, 0x68, 0xda, 0x4c, 0xfd, 0x33, 0x83, 0xde, 0xbe, 0xca, 
+0xb4, 0xb6, 0x30, 0xad, 0x57, 0xd1, 0x6b, 0x08, 0x2b, 0x2d, 0x1f, 0x81, 0x25, 0x37, 0x30, 0x68, 
+0xe9, 0x97, 0x10, 0x5c, 0x6a, 0x23, 0x85, 0xe7, 0x60, 0x7a, 0xaf, 0x7a, 0xeb, 0x5b, 0xd5, 0x29, 
+0x4c, 0x3b, 0xf3, 0x76, 0x14, 0xe1, 0x3e, 0xb5, 0x0b, 0x4b, 0x0c, 0xcf, 0xa5, 0xf7, 0xad, 0x57, 
+0x81, 0xea, 0x24, 0x05, 0x1e, 0xa3, 0xb7, 0xad, 0xd7, 0x80, 0xfa, 0x3c, 0x25, 0x41, 0xe3, 0xf1, 
+0x70, 0x22, 0x64, 0x6a, 0x47, 0x87, 0x3e, 0x9f, 0x55, 0x0e, 0x67, 0x87, 0x12, 0x95, 0x5d, 0x39, 
+0xf4, 0xa1, 0xfb, 0x3a, 0x1d, 0x1c, 0xfa, 0xd4, 0xd7, 0xe9, 0x0f, 0x7d, 0x3a, 0x11, 0xda, 0xe2, 
+0x19, 0x51, 0x07, 0x27, 0x3e, 0xd5, 0x55, 0x5d, 0x3f, 0xf1, 0x11, 0x49, 0xf9, 0xb3, 0x57, 0x70, 
+0x1b, 0xa4, 0x85, 0xe9, 0xed, 0x9b, 0x6f, 0x1e, 0xc3, 0x4a, 0xb8, 0xc9, 0x41, 0xea, 0x9f, 0xb9, 
+0xc9, 0x41, 0x1d, 0xd5, 0xa1, 0x0c, 0x8b, 0xf2, 0x87, 0x65, 0xd0, 0x96, 0x99, 0x32, 0x2d, 0x79, 
+0x70, 0x8a, 0xde, 0xbf, 0x7c, 0xf7, 0x04, 0xbd, 0x7f, 0xb9, 0x38, 0x8f, 0xde, 0xbf, 0x5c, 0x55, 
+0x40, 0x6f, 0x6f, 0x3c, 0x7b, 0x96, 0xde, 0xde, 0x78, 0xee, 0x1c, 0xbd, 0xbd, 0x31, 0x2f, 0x8f, 
+0xde, 0xde, 0x78, 0xfe, 0x3c, 0x5e, 0x9f, 0xc1, 0x5f, 0xb8, 0x30, 0x5c, 0xd9, 0xfd, 0x27, 0xf2, 
+0x8c, 0xe4, 0x77, 0x1f, 0xbc, 0x44, 0xb5, 0xa4, 0xfd, 0xa2, 0x0a, 0x2d, 0xb9, 0xfd, 0x23, 0x55, 
+0xec, 0xdc, 0xef, 0xe9, 0xa5, 0x6d, 0x61, 0x22, 0x2b, 0x42, 0x71, 0x0a, 0xfb, 0xe5, 0xc1, 0xae, 
+0xbb, 0x7b, 0xc3, 0x1f, 0x15, 0xef, 0x8f, 0x28, 0x89, 0xac, 0xa8, 0xfa, 0xd7, 0xdc, 0x1f, 0xa2, 
+0xea, 0x6f, 0x5f, 0x5f, 0x70, 0x51, 0xfc, 0xfb, 0xa9, 0xb8, 0x13, 0x4b, 0x03, 0xcf, 0xe6, 0xad, 
+0x0a, 0xba, 0x10, 0x7c, 0xb9, 0x60, 0xdd, 0xf7, 0x5b, 0x42, 0xfe, 0xf3, 0xc7, 0x7f, 0x9f, 0x92, 
+0x2e, 0x9f, 0xe5, 0xee, 0x14, 0x76, 0xff, 0xc1, 0xe9, 0xbb, 0x19, 0xe1, 0x4f, 0x8a, 0x0f, 0x44, 
+0x94, 0x45, 0xd6, 0x54, 0xfd, 0xaf, 0xdc, 0x23, 0x51, 0x4d, 0xb7, 0x6f, 0x2c, 0xb8, 0x26, 0x9e, 
+0x3c, 0x25, 0x3b, 0x91, 0x18, 0x78, 0x3e, 0x6f, 0x75, 0x50, 0x72, 0xf0, 0xf6, 0x82, 0xf5, 0xdf, 
+0x6f, 0x0d, 0x49, 0xf9, 0xf1, 0x3f, 0xa6, 0xf4, 0x92, 0xbb, 0xc7, 0x38, 0x85, 0xdd, 0x7b, 0x70, 
+0xe6, 0x6e, 0x51, 0x78, 0x56, 0xf1, 0xc1, 0x88, 0xa7, 0x91, 0xd5, 0x55, 0xff, 0x96, 0x7b, 0x2b, 
+0xaa, 0xf1, 0xf6, 0xc3, 0x05, 0xff, 0x4f, 0xfc, 0xe9, 0x94, 0xc5, 0x09, 0xcb, 0xc0, 0xe5, 0x79, 
+0x6b, 0x82, 0xfe, 0x11, 0xac, 0x2b, 0xd8, 0xf0, 0xfd, 0xff, 0x0e, 0x49, 0xfd, 0xf1, 0x9f, 0x53, 
+0x9c, 0x68, 0xab, 0xfb, 0x9d, 0x07, 0x3b, 0xef, 0xee, 0x09, 0x7f, 0x5c, 0xbc, 0x2f, 0xa2, 0x34, 
+0xb2, 0xb2, 0xea, 0x70, 0xee, 0xb1, 0xa8, 0x86, 0xdb, 0x97, 0x16, 0x34, 0x8b, 0xc7, 0x4f, 0x2d, 
+0x39, 0x91, 0x10, 0x78, 0x2e, 0x6f, 0x65, 0xd0, 0xcf, 0xc1, 0x57, 0x0a, 0x92, 0xbe, 0xdf, 0x1c, 
+0xf2, 0x5f, 0x3f, 0xfe, 0xdf, 0x29, 0x85, 0x72, 0x85, 0x8f, 0x53, 0xd8, 0xd5, 0x07, 0xbb, 0xef, 
+0x66, 0x86, 0x67, 0x17, 0x1f, 0x8a, 0x38, 0x1a, 0x59, 0x5b, 0x95, 0x93, 0xfb, 0x6b, 0x54, 0xdd, 
+0xed, 0xf2, 0x05, 0x37, 0xc5, 0xd8, 0x53, 0xf1, 0x27, 0x96, 0x05, 0xae, 0xc8, 0x5b, 0x1b, 0xb4, 
+0x2d, 0x78, 0x47, 0xc1, 0xc6, 0xef, 0x37, 0x85, 0xa4, 0xfd, 0xf8, 0x7f, 0xa6, 0xf4, 0x97, 0xfb, 
+0xe0, 0xff, 0x4f, 0xe0, 0xbf, 0x01 };
+
+static const kcl_builtin_library layout_libraries[3] = {
+	{ layout_keyboardsys_index, 582, layout_keyboardsys_layouts, 35, layout_keyboardsys_compressed, 11142, 33196 },
+	{ layout_keybrd2sys_index, 285, layout_keybrd2sys_layouts, 21, layout_keybrd2sys_compressed, 7222, 25431 },
+	{ layout_keybrd3sys_index, 357, layout_keybrd3sys_layouts, 32, layout_keybrd3sys_compressed, 10118, 27122 }
+};
@@ -21,6 +21,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <map>
+#include <vector>
+#include <chrono>
 #include "dosbox.h"
 #include "dos_inc.h"
 #include "drives.h"
@@ -28,6 +31,7 @@
 #include "cross.h"
 #include "bios.h"
 #include "bios_disk.h"
+#include "dbp_memstats.h"
 
 #define IMGTYPE_FLOPPY 0
 #define IMGTYPE_ISO    1
@@ -132,6 +136,31 @@ bool fatFile::Read(Bit8u * data, Bit16u *size) {
 			*size = sizecount;
 			return true; 
 		}
+		//DBP: Read runs of whole consecutive sectors directly into the target buffer with one disk access
+		Bit32u sectsize = myDrive->getSectorSize();
+		if (curSectOff == 0 && sizedec >= sectsize * 2 && filelength - seekpos >= sectsize * 2) {
+			// Sectors inside a cluster are always consecutive, only check the chain at cluster boundaries
+			Bit32u maxrun = (sizedec < filelength - seekpos ? sizedec : filelength - seekpos) / sectsize;
+			Bit32u clustsects = myDrive->getClusterSize() / sectsize, run = clustsects - (seekpos / sectsize) % clustsects;
+			if (run > maxrun) run = maxrun;
+			while (run != maxrun && myDrive->getAbsoluteSectFromBytePos(firstCluster, seekpos + run * sectsize) == currentSector + run)
+				run = (maxrun - run > clustsects ? run + clustsects : maxrun);
+			if (run > 1) {
+				myDrive->readSectors(currentSector, run, data + sizecount);
+				sizecount += (Bit16u)(run * sectsize);
+				sizedec -= (Bit16u)(run * sectsize);
+				seekpos += run * sectsize;
+				currentSector = myDrive->getAbsoluteSectFromBytePos(firstCluster, seekpos);
+				if(currentSector == 0) {
+					/* EOC reached before EOF */
+					*size = sizecount;
+					loadedSector = false;
+					return true;
+				}
+				myDrive->readSector(currentSector, sectorBuffer);
+				continue;
+			}
+		}
 		data[sizecount++] = sectorBuffer[curSectOff++];
 		seekpos++;
 		if(curSectOff >= myDrive->getSectorSize()) {
@@ -409,6 +438,72 @@ void fatDrive::setClusterValue(Bit32u clustNum, Bit32u clustValue) {
 	}
 }
 
+// Index of the entries of a directory, read once and then used for path lookups and directory listings
+struct fatDirEntry {
+	direntry entry;
+	Bit16u pos;
+	char key[12];
+	char name[DOS_NAMELENGTH_ASCII];
+	fatDirEntry *nextSameKey;
+};
+
+struct fatDirIndex {
+	std::vector<fatDirEntry> entries; // in directory order
+	std::vector<Bit32u> clusters;
+	StringToPointerHashMap<fatDirEntry> keys;
+	size_t memSize; // charged to the disk memory stats while it is in the cache
+};
+
+struct fatDirCache {
+	enum { MAX_ENTRIES = 32768 };
+	std::map<Bit32u, fatDirIndex*> dirs; // by first cluster, 0 is the root directory
+	std::map<Bit32u, Bit32u> owners; // cluster to first cluster of the indexed directory using it
+	Bit32u numEntries = 0;
+	Bit32u diskWrites = 0; // write_counter of the disk after the last write made by this drive
+	bool disabled = false;
+
+	~fatDirCache() { Clear(); }
+
+	void Clear() {
+		for (auto& it : dirs) { DBP_MemStats_Free(DBPMEM_DISK, it.second->memSize); delete it.second; }
+		dirs.clear();
+		owners.clear();
+		numEntries = 0;
+	}
+
+	void Drop(Bit32u dirClustNumber) {
+		std::map<Bit32u, fatDirIndex*>::iterator it = dirs.find(dirClustNumber);
+		if (it == dirs.end()) return;
+		for (Bit32u clust : it->second->clusters) owners.erase(clust);
+		numEntries -= (Bit32u)it->second->entries.size();
+		DBP_MemStats_Free(DBPMEM_DISK, it->second->memSize);
+		delete it->second;
+		dirs.erase(it);
+	}
+};
+
+// Space padded 8.3 key as compared by WildFileCmp, names from directory entries are split at the last dot
+static void fatEntryKey(const char* name, char key[12]) {
+	memset(key, ' ', 11);
+	key[11] = '\0';
+	const char* ext = strrchr(name, '.');
+	size_t namelen = (ext ? (size_t)(ext - name) : strlen(name));
+	memcpy(key, name, (namelen > 8 ? 8 : namelen));
+	if (ext && *(++ext)) memcpy(key + 8, ext, (strlen(ext) > 3 ? 3 : strlen(ext)));
+	upcase(key);
+}
+
+// Search patterns are split at the first dot by DOS_DTA::SetupSearch
+static void fatPatternKey(const char* pattern, char key[12]) {
+	memset(key, ' ', 11);
+	key[11] = '\0';
+	const char* ext = strchr(pattern, '.');
+	size_t namelen = (ext ? (size_t)(ext - pattern) : strlen(pattern));
+	memcpy(key, pattern, (namelen > 8 ? 8 : namelen));
+	if (ext && *(++ext)) memcpy(key + 8, ext, (strlen(ext) > 3 ? 3 : strlen(ext)));
+	upcase(key);
+}
+
 bool fatDrive::getEntryName(char *fullname, char *entname) {
 	char dirtoken[DOS_PATHLENGTH];
 
@@ -436,6 +531,7 @@ bool fatDrive::getFileDirEntry(char const * const filename, direntry * useEntry,
 	Bit32u currentClust = 0;
 
 	direntry foundEntry;
+	Bit32u entryPos;
 	char * findDir;
 	char * findFile;
 	strcpy(dirtoken,filename);
@@ -447,17 +543,10 @@ bool fatDrive::getFileDirEntry(char const * const filename, direntry * useEntry,
 		findDir = strtok(dirtoken,"\\");
 		findFile = findDir;
 		while(findDir != NULL) {
-			imgDTA->SetupSearch(0,DOS_ATTR_DIRECTORY,findDir);
-			imgDTA->SetDirID(0);
-			
 			findFile = findDir;
-			if(!FindNextInternal(currentClust, *imgDTA, &foundEntry)) break;
-			else {
-				//Found something. See if it's a directory (findfirst always finds regular files)
-				char find_name[DOS_NAMELENGTH_ASCII];Bit16u find_date,find_time;Bit32u find_size;Bit8u find_attr;
-				imgDTA->GetResult(find_name,find_size,find_date,find_time,find_attr);
-				if(!(find_attr & DOS_ATTR_DIRECTORY)) break;
-			}
+			if(!findDirEntry(currentClust, findDir, DOS_ATTR_DIRECTORY, &foundEntry, &entryPos)) break;
+			//Found something. See if it's a directory (findfirst always finds regular files)
+			if(!(foundEntry.attrib & DOS_ATTR_DIRECTORY)) break;
 
 			currentClust = foundEntry.loFirstClust;
 			findDir = strtok(NULL,"\\");
@@ -467,13 +556,11 @@ bool fatDrive::getFileDirEntry(char const * const filename, direntry * useEntry,
 	}
 
 	/* Search found directory for our file */
-	imgDTA->SetupSearch(0,0x7,findFile);
-	imgDTA->SetDirID(0);
-	if(!FindNextInternal(currentClust, *imgDTA, &foundEntry)) return false;
+	if(!findDirEntry(currentClust, findFile, 0x7, &foundEntry, &entryPos)) return false;
 
 	memcpy(useEntry, &foundEntry, sizeof(direntry));
 	*dirClust = (Bit32u)currentClust;
-	*subEntry = ((Bit32u)imgDTA->GetDirID()-1);
+	*subEntry = entryPos;
 	return true;
 }
 
@@ -482,6 +569,7 @@ bool fatDrive::getDirClustNum(char *dir, Bit32u *clustNum, bool parDir) {
 	char dirtoken[DOS_PATHLENGTH];
 	Bit32u currentClust = 0;
 	direntry foundEntry;
+	Bit32u entryPos;
 	char * findDir;
 	strcpy(dirtoken,dir);
 
@@ -490,17 +578,14 @@ bool fatDrive::getDirClustNum(char *dir, Bit32u *clustNum, bool parDir) {
 		//LOG_MSG("Testing for dir %s", dir);
 		findDir = strtok(dirtoken,"\\");
 		while(findDir != NULL) {
-			imgDTA->SetupSearch(0,DOS_ATTR_DIRECTORY,findDir);
-			imgDTA->SetDirID(0);
+			char * findName = findDir;
 			findDir = strtok(NULL,"\\");
 			if(parDir && (findDir == NULL)) break;
 
-			char find_name[DOS_NAMELENGTH_ASCII];Bit16u find_date,find_time;Bit32u find_size;Bit8u find_attr;
-			if(!FindNextInternal(currentClust, *imgDTA, &foundEntry)) {
+			if(!findDirEntry(currentClust, findName, DOS_ATTR_DIRECTORY, &foundEntry, &entryPos)) {
 				return false;
 			} else {
-				imgDTA->GetResult(find_name,find_size,find_date,find_time,find_attr);
-				if(!(find_attr &DOS_ATTR_DIRECTORY)) return false;
+				if(!(foundEntry.attrib &DOS_ATTR_DIRECTORY)) return false;
 			}
 			currentClust = foundEntry.loFirstClust;
 
@@ -523,14 +608,28 @@ Bit8u fatDrive::readSector(Bit32u sectnum, void * data) {
 	return loadedDisk->Read_Sector(head, cylinder, sector, data);
 }	
 
+Bit8u fatDrive::readSectors(Bit32u sectnum, Bit32u count, void * data) {
+	if (absolute) return loadedDisk->Read_AbsoluteSectors(sectnum, count, data);
+	for (Bit8u* out = (Bit8u*)data; count; sectnum++, count--, out += getSectorSize())
+		if (Bit8u res = readSector(sectnum, out)) return res;
+	return 0;
+}
+
 Bit8u fatDrive::writeSector(Bit32u sectnum, void * data) {
-	if (absolute) return loadedDisk->Write_AbsoluteSector(sectnum, data);
-	Bit32u cylindersize = bootbuffer.headcount * bootbuffer.sectorspertrack;
-	Bit32u cylinder = sectnum / cylindersize;
-	sectnum %= cylindersize;
-	Bit32u head = sectnum / bootbuffer.sectorspertrack;
-	Bit32u sector = sectnum % bootbuffer.sectorspertrack + 1L;
-	return loadedDisk->Write_Sector(head, cylinder, sector, data);
+	if (dircache) dirCacheSectorWritten(sectnum);
+	Bit8u res;
+	if (absolute) res = loadedDisk->Write_AbsoluteSector(sectnum, data);
+	else {
+		Bit32u cylindersize = bootbuffer.headcount * bootbuffer.sectorspertrack;
+		Bit32u cylinder = sectnum / cylindersize;
+		sectnum %= cylindersize;
+		Bit32u head = sectnum / bootbuffer.sectorspertrack;
+		Bit32u sector = sectnum % bootbuffer.sectorspertrack + 1L;
+		res = loadedDisk->Write_Sector(head, cylinder, sector, data);
+	}
+	/* Our own write was handled above, only writes through other paths (INT 13h, IDE) invalidate the whole index */
+	if (dircache && dircache->diskWrites == loadedDisk->write_counter - 1) dircache->diskWrites = loadedDisk->write_counter;
+	return res;
 }
 
 Bit32u fatDrive::getSectorCount(void) {
@@ -697,7 +796,7 @@ bool fatDrive::allocateCluster(Bit32u useCluster, Bit32u prevCluster) {
 	return true;
 }
 
-fatDrive::fatDrive(const char *sysFilename, Bit32u bytesector, Bit32u cylsector, Bit32u headscyl, Bit32u cylinders, Bit32u startSector) : loadedDisk(NULL) {
+fatDrive::fatDrive(const char *sysFilename, Bit32u bytesector, Bit32u cylsector, Bit32u headscyl, Bit32u cylinders, Bit32u startSector) : loadedDisk(NULL), dircache(NULL) {
 	created_successfully = true;
 	#ifdef C_DBP_SUPPORT_DISK_MOUNT_DOSFILE
 	DOS_File *diskfile;
@@ -911,7 +1010,7 @@ fatDrive::fatDrive(const char *sysFilename, Bit32u bytesector, Bit32u cylsector,
 	strcat(info, sysFilename);
 }
 
-fatDrive::~fatDrive() { if (loadedDisk) delete loadedDisk; }
+fatDrive::~fatDrive() { if (loadedDisk) delete loadedDisk; delete dircache; }
 
 bool fatDrive::AllocationInfo(Bit16u *_bytes_sector, Bit8u *_sectors_cluster, Bit16u *_total_clusters, Bit16u *_free_clusters) {
 	Bit32u hs, cy, sect,sectsize;
@@ -1115,6 +1214,134 @@ static void copyDirEntry(const direntry *src, direntry *dst) {
 	var_write(&dst->entrysize, src->entrysize);
 }
 
+static void getDirEntryName(const direntry *entry, char *find_name) {
+	char extension[4];
+	memset(find_name,0,DOS_NAMELENGTH_ASCII);
+	memset(extension,0,4);
+	memcpy(find_name,&entry->entryname[0],8);
+	memcpy(extension,&entry->entryname[8],3);
+	trimString(&find_name[0]);
+	trimString(&extension[0]);
+	
+	//if(!(entry->attrib & DOS_ATTR_DIRECTORY))
+	if (extension[0]!=0) {
+		strcat(find_name, ".");
+		strcat(find_name, extension);
+	}
+}
+
+fatDirIndex* fatDrive::getDirIndex(Bit32u dirClustNumber) {
+	if (!dircache) dircache = new fatDirCache();
+	if (dircache->disabled) return NULL;
+	if (dircache->diskWrites != loadedDisk->write_counter) {
+		/* The disk was written without going through this drive (INT 13h, IDE), any indexed directory might have changed */
+		dircache->Clear();
+		dircache->diskWrites = loadedDisk->write_counter;
+	}
+	std::map<Bit32u, fatDirIndex*>::iterator it = dircache->dirs.find(dirClustNumber);
+	if (it != dircache->dirs.end()) return it->second;
+	if (dircache->numEntries > fatDirCache::MAX_ENTRIES) dircache->Clear();
+
+	/* Read the whole directory with the same end conditions as FindNextInternal */
+	fatDirIndex* idx = new fatDirIndex;
+	direntry sectbuf[16]; /* 16 directory entries per sector */
+	Bit32u dirPos = 0, clust = dirClustNumber, clustSect = 0;
+	for (bool done = false; !done;) {
+		if(dirClustNumber==0) {
+			if(dirPos >= bootbuffer.rootdirentries) break;
+			readSector(firstRootDirSect+dirPos/16,sectbuf);
+		} else {
+			if(clustSect == bootbuffer.sectorspercluster) {
+				Bit32u testvalue = getClusterValue(clust);
+				if(testvalue >= (fattype == FAT12 ? 0xff8u : (fattype == FAT16 ? 0xfff8u : 0xfffffff8u))) break;
+				clust = testvalue;
+				clustSect = 0;
+			}
+			if(clustSect == 0) {
+				/* Fall back to reading sectors one by one on broken or looping cluster chains */
+				if(clust < 2 || clust >= CountOfClusters + 2 || idx->clusters.size() > CountOfClusters) { delete idx; return NULL; }
+				idx->clusters.push_back(clust);
+			}
+			readSector(getClustFirstSect(clust)+clustSect++,sectbuf);
+		}
+		for (Bit32u entryoffset = dirPos % 16; entryoffset != 16; entryoffset++, dirPos++) {
+			if (dirPos > 0xFFFF || (dirClustNumber==0 && dirPos >= bootbuffer.rootdirentries) || sectbuf[entryoffset].entryname[0] == 0x00) { done = true; break; }
+			if (sectbuf[entryoffset].entryname[0] == 0xe5) continue;
+			idx->entries.resize(idx->entries.size() + 1);
+			fatDirEntry& e = idx->entries.back();
+			copyDirEntry(&sectbuf[entryoffset], &e.entry);
+			e.pos = (Bit16u)dirPos;
+			getDirEntryName(&sectbuf[entryoffset], e.name);
+			fatEntryKey(e.name, e.key);
+			e.nextSameKey = NULL;
+		}
+	}
+
+	for (fatDirEntry& e : idx->entries) {
+		fatDirEntry* first = idx->keys.Get(e.key, 11);
+		if (!first) idx->keys.Put(e.key, &e, 11);
+		else if (!memcmp(first->key, e.key, 11)) {
+			while (first->nextSameKey) first = first->nextSameKey;
+			first->nextSameKey = &e;
+		}
+		// else: hash collision, lookups for this key will notice the mismatch and search without the index
+	}
+	for (Bit32u c : idx->clusters) dircache->owners[c] = dirClustNumber;
+	dircache->numEntries += (Bit32u)idx->entries.size();
+	dircache->dirs[dirClustNumber] = idx;
+	/* Count the map nodes in dirs and owners with a rough size of a red-black tree node */
+	idx->memSize = sizeof(fatDirIndex) + idx->entries.capacity() * sizeof(fatDirEntry) + idx->clusters.capacity() * sizeof(Bit32u)
+		+ idx->keys.Capacity() * (sizeof(Bit32u) + sizeof(fatDirEntry*)) + (idx->clusters.size() + 1) * 48;
+	DBP_MemStats_Alloc(DBPMEM_DISK, idx->memSize);
+	return idx;
+}
+
+bool fatDrive::findDirEntry(Bit32u dirClustNumber, const char* name, Bit8u attrs, direntry *foundEntry, Bit32u *entryPos) {
+	fatDirIndex* idx = (strpbrk(name, "*?") ? NULL : getDirIndex(dirClustNumber));
+	if (idx) {
+		char key[12];
+		fatPatternKey(name, key);
+		fatDirEntry* e = idx->keys.Get(key, 11);
+		if (!e || !memcmp(e->key, key, 11)) {
+			for (; e; e = e->nextSameKey) {
+				if (~attrs & e->entry.attrib & (DOS_ATTR_DIRECTORY | DOS_ATTR_VOLUME | DOS_ATTR_SYSTEM | DOS_ATTR_HIDDEN)) continue;
+				memcpy(foundEntry, &e->entry, sizeof(direntry));
+				*entryPos = e->pos;
+				return true;
+			}
+			DOS_SetError(DOSERR_NO_MORE_FILES);
+			return false;
+		}
+	}
+	imgDTA->SetupSearch(0,attrs,(char*)name);
+	imgDTA->SetDirID(0);
+	if(!FindNextInternal(dirClustNumber, *imgDTA, foundEntry)) return false;
+	*entryPos = ((Bit32u)imgDTA->GetDirID()-1);
+	return true;
+}
+
+void fatDrive::dirCacheSectorWritten(Bit32u sectnum) {
+	if (dircache->dirs.empty()) return;
+	if (sectnum >= firstDataSector) {
+		std::map<Bit32u, Bit32u>::iterator it = dircache->owners.find((sectnum - firstDataSector) / bootbuffer.sectorspercluster + 2);
+		if (it != dircache->owners.end()) dircache->Drop(it->second);
+	} else if (sectnum >= firstRootDirSect) {
+		dircache->Drop(0);
+	} else if (sectnum >= bootbuffer.reservedsectors + partSectOff && bootbuffer.sectorsperfat) {
+		/* Drop directories whose cluster chain is stored in this FAT sector */
+		Bit32u fatByte = ((sectnum - bootbuffer.reservedsectors - partSectOff) % bootbuffer.sectorsperfat) * bootbuffer.bytespersector;
+		Bit32u fatByteEnd = fatByte + bootbuffer.bytespersector;
+		Bit32u firstClust = (fattype == FAT12 ? fatByte * 2 / 3 : (fattype == FAT16 ? fatByte / 2 : fatByte / 4));
+		Bit32u endClust = (fattype == FAT12 ? fatByteEnd * 2 / 3 + 1 : (fattype == FAT16 ? fatByteEnd / 2 : fatByteEnd / 4));
+		for (std::map<Bit32u, Bit32u>::iterator it; (it = dircache->owners.lower_bound(firstClust)) != dircache->owners.end() && it->first < endClust;)
+			dircache->Drop(it->second);
+	}
+}
+
+void fatDrive::EmptyCache(void) {
+	if (dircache) dircache->Clear();
+}
+
 bool fatDrive::FindNextInternal(Bit32u dirClustNumber, DOS_DTA &dta, direntry *foundEntry) {
 	direntry sectbuf[16]; /* 16 directory entries per sector */
 	Bit32u logentsector; /* Logical entry sector */
@@ -1124,11 +1351,32 @@ bool fatDrive::FindNextInternal(Bit32u dirClustNumber, DOS_DTA &dta, direntry *f
 	Bit16u dirPos;
 	char srch_pattern[DOS_NAMELENGTH_ASCII];
 	char find_name[DOS_NAMELENGTH_ASCII];
-	char extension[4];
 
 	dta.GetSearchParams(attrs, srch_pattern);
 	dirPos = dta.GetDirID();
 
+	fatDirIndex* idx = (attrs != DOS_ATTR_VOLUME ? getDirIndex(dirClustNumber) : NULL);
+	if (idx) {
+		/* Continue after the last returned entry without reading the directory sectors again */
+		std::vector<fatDirEntry>::iterator e = idx->entries.begin(), end = idx->entries.end();
+		for (size_t count = idx->entries.size(); count;) {
+			size_t step = count / 2;
+			if (e[step].pos < dirPos) { e += step + 1; count -= step + 1; }
+			else count = step;
+		}
+		for (; e != end; ++e) {
+			if (~attrs & e->entry.attrib & (DOS_ATTR_DIRECTORY | DOS_ATTR_VOLUME | DOS_ATTR_SYSTEM | DOS_ATTR_HIDDEN) ) continue;
+			if (!WildFileCmp(e->name,srch_pattern)) continue;
+			dta.SetDirID((Bit16u)(e->pos + 1));
+			memcpy(foundEntry, &e->entry, sizeof(direntry));
+			dta.SetResult(e->name, foundEntry->entrysize, foundEntry->modDate, foundEntry->modTime, foundEntry->attrib);
+			return true;
+		}
+		if (idx->entries.size()) dta.SetDirID((Bit16u)(idx->entries.back().pos + 1));
+		DOS_SetError(DOSERR_NO_MORE_FILES);
+		return false;
+	}
+
 nextfile:
 	logentsector = dirPos / 16;
 	entryoffset = dirPos % 16;
@@ -1159,18 +1407,7 @@ nextfile:
 		DOS_SetError(DOSERR_NO_MORE_FILES);
 		return false;
 	}
-	memset(find_name,0,DOS_NAMELENGTH_ASCII);
-	memset(extension,0,4);
-	memcpy(find_name,&sectbuf[entryoffset].entryname[0],8);
-	memcpy(extension,&sectbuf[entryoffset].entryname[8],3);
-	trimString(&find_name[0]);
-	trimString(&extension[0]);
-	
-	//if(!(sectbuf[entryoffset].attrib & DOS_ATTR_DIRECTORY))
-	if (extension[0]!=0) {
-		strcat(find_name, ".");
-		strcat(find_name, extension);
-	}
+	getDirEntryName(&sectbuf[entryoffset], find_name);
 
 	/* Compare attributes to search attributes */
 
@@ -1509,3 +1746,49 @@ bool fatDrive::TestDir(char *dir) {
 	return getDirClustNum(dir, &dummyClust, false);
 }
 
+
+void fatDrive::RunLookupBenchmark(Bit32u rounds) {
+	// Open every file and test every directory on the drive, once reading directory sectors on each lookup and once with the directory index
+	struct Local {
+		static void CollectPaths(const char* path, bool is_dir, Bit32u size, Bit16u date, Bit16u time, Bit8u attr, Bitu data) {
+			((std::vector<std::string>*)data)->push_back(std::string(1, (is_dir ? 'D' : 'F')).append(path));
+		}
+		static Bit64u Now() {
+			return (Bit64u)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+	};
+	std::vector<std::string> paths;
+	DriveFileIterator(this, Local::CollectPaths, (Bitu)&paths);
+	if (!dircache) dircache = new fatDirCache();
+
+	Bit32u results[2][2];
+	for (int cached = 0; cached != 2; cached++) {
+		dircache->Clear();
+		dircache->disabled = !cached;
+		const Bit16u save_errorcode = dos.errorcode;
+		Bit32u found = 0, checksum = 0;
+		Bit64u start = Local::Now();
+		for (Bit32u round = 0; round != rounds; round++) {
+			for (std::string& p : paths) {
+				if (p[0] == 'D') { found += (TestDir(&p[1]) ? 1 : 0); continue; }
+				DOS_File* df;
+				if (!FileOpen(&df, &p[1], OPEN_READ)) continue;
+				df->AddRef();
+				Bit32u size = 0;
+				df->Seek(&size, DOS_SEEK_END);
+				checksum = (checksum * 31 + size) * 31 + ((Bit32u)df->date << 16 | df->time);
+				df->Close();
+				delete df;
+				found++;
+			}
+		}
+		dos.errorcode = save_errorcode;
+		results[cached][0] = found;
+		results[cached][1] = checksum;
+		LOG_MSG("[DOSBOX] FAT lookup benchmark %s directory index: %u of %u lookups succeeded in %u ms (checksum %08x)",
+			(cached ? "with" : "without"), found, (Bit32u)paths.size() * rounds, (Bit32u)((Local::Now() - start) / 1000), checksum);
+	}
+	if (results[0][0] != results[1][0] || results[0][1] != results[1][1])
+		LOG_MSG("[DOSBOX] FAT lookup benchmark results differ between directory index and sector reads");
+	dircache->disabled = false;
+}
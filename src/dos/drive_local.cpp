@@ -34,6 +34,139 @@
 #include "support.h"
 #include "cross.h"
 #include "inout.h"
+#include "dbp_threads.h"
+#include <deque>
+#include <vector>
+
+// Guest writes to local files are queued and done by a background thread so slow storage doesn't stall emulation.
+// Any other access to a file (read, seek, close, date query) first waits for the writes queued for it.
+// Path based queries (open, stat, find, attributes) wait for all queued writes as they can't tell which handle refers to the path.
+// A failed write is latched in the file and reported by the next write, flush or close of it.
+static struct localFileWriteBehind
+{
+	struct Op { localFile* file; Bit32u pos; std::vector<Bit8u> data; };
+	enum { MAX_OP_SIZE = 1024*1024, MAX_QUEUED = 4*1024*1024 };
+	std::deque<Op> queue;
+	Mutex mutex;
+	Semaphore work, done;
+	Bit32u queued_bytes, pending_ops;
+	bool running, idle, waiting, stop;
+
+	static Thread::RET_t THREAD_CC ThreadFunc(void* p)
+	{
+		localFileWriteBehind& wb = *(localFileWriteBehind*)p;
+		Op op;
+		wb.mutex.Lock();
+		for (;;)
+		{
+			while (wb.queue.empty() && !wb.stop)
+			{
+				wb.idle = true;
+				wb.mutex.Unlock();
+				wb.work.Wait();
+				wb.mutex.Lock();
+			}
+			if (wb.queue.empty()) break;
+			Op& front = wb.queue.front();
+			op.file = front.file;
+			op.pos = front.pos;
+			op.data.swap(front.data);
+			wb.queue.pop_front();
+			wb.mutex.Unlock();
+
+			FILE* f = op.file->fhandle;
+			errno = 0;
+			bool failed = (fseek(f, (long)op.pos, SEEK_SET) || fwrite(&op.data[0], op.data.size(), 1, f) != 1 || fflush(f));
+			int err = (failed ? (errno ? errno : EIO) : 0);
+
+			wb.mutex.Lock();
+			if (failed && !op.file->wb_error) op.file->wb_error = err;
+			op.file->wb_pending--;
+			wb.pending_ops--;
+			wb.queued_bytes -= (Bit32u)op.data.size();
+			if (wb.waiting) { wb.waiting = false; wb.done.Post(); }
+		}
+		wb.running = false;
+		if (wb.waiting) { wb.waiting = false; wb.done.Post(); }
+		wb.mutex.Unlock();
+		return 0;
+	}
+
+	// Needs to be called with the mutex locked, returns with the mutex locked
+	void WaitWhile(const Bit32u& counter, Bit32u limit = 0)
+	{
+		while (counter > limit)
+		{
+			waiting = true;
+			mutex.Unlock();
+			done.Wait();
+			mutex.Lock();
+		}
+	}
+
+	void Queue(localFile* file, Bit32u pos, const Bit8u* data, Bit32u size)
+	{
+		mutex.Lock();
+		if (!running)
+		{
+			running = true;
+			idle = stop = false;
+			Thread::StartDetached(ThreadFunc, this);
+		}
+		Op* last = (queue.empty() ? NULL : &queue.back());
+		if (last && last->file == file && last->pos + last->data.size() == pos && last->data.size() + size <= MAX_OP_SIZE)
+		{
+			// append to a sequential write that hasn't started yet
+			last->data.insert(last->data.end(), data, data + size);
+		}
+		else
+		{
+			queue.push_back(Op());
+			Op& op = queue.back();
+			op.file = file;
+			op.pos = pos;
+			op.data.assign(data, data + size);
+			file->wb_pending++;
+			pending_ops++;
+		}
+		queued_bytes += size;
+		if (idle) { idle = false; work.Post(); }
+		WaitWhile(queued_bytes, MAX_QUEUED);
+		mutex.Unlock();
+	}
+} localfile_wb;
+
+void localFile::WaitWriteBehind(void) {
+	localfile_wb.mutex.Lock();
+	localfile_wb.WaitWhile(wb_pending);
+	localfile_wb.mutex.Unlock();
+}
+
+int localFile::TakeWriteBehindError(void) {
+	localfile_wb.mutex.Lock();
+	int err = wb_error;
+	wb_error = 0;
+	localfile_wb.mutex.Unlock();
+	if (err) LOG_MSG("[DOSBOX] Error while writing to file %s: %s", GetName(), strerror(err));
+	return err;
+}
+
+void DBP_LocalFileWriteBarrier(bool stop_thread) {
+	localFileWriteBehind& wb = localfile_wb;
+	wb.mutex.Lock();
+	wb.WaitWhile(wb.pending_ops);
+	if (stop_thread && wb.running) {
+		wb.stop = true;
+		if (wb.idle) { wb.idle = false; wb.work.Post(); }
+		while (wb.running) {
+			wb.waiting = true;
+			wb.mutex.Unlock();
+			wb.done.Wait();
+			wb.mutex.Lock();
+		}
+	}
+	wb.mutex.Unlock();
+}
 
 
 bool localDrive::FileCreate(DOS_File * * file,char * name,Bit16u /*attributes*/) {
@@ -43,6 +176,7 @@ bool localDrive::FileCreate(DOS_File * * file,char * name,Bit16u /*attributes*/)
 	strcat(newname,name);
 	CROSS_FILENAME(newname);
 	char* temp_name = dirCache.GetExpandName(newname); //Can only be used in till a new drive_cache action is preformed */
+	DBP_LocalFileWriteBarrier();
 	/* Test if file exists (so we need to truncate it). don't add to dirCache then */
 	bool existing_file = false;
 	
@@ -83,6 +217,7 @@ bool localDrive::FileOpen(DOS_File * * file,char * name,Bit32u flags) {
 	strcat(newname,name);
 	CROSS_FILENAME(newname);
 	dirCache.ExpandName(newname);
+	DBP_LocalFileWriteBarrier();
 
 	//Flush the buffer of handles for the same file. (Betrayal in Antara)
 	Bit8u i,drive=DOS_DRIVES;
@@ -145,6 +280,7 @@ bool localDrive::FileUnlink(char * name) {
 	strcat(newname,name);
 	CROSS_FILENAME(newname);
 	char *fullname = dirCache.GetExpandName(newname);
+	DBP_LocalFileWriteBarrier();
 	if (unlink(fullname)) {
 		//Unlink failed for some reason try finding it.
 		struct stat buffer;
@@ -191,6 +327,7 @@ bool localDrive::FindFirst(char * _dir,DOS_DTA & dta,bool fcb_findfirst) {
 	if (allocation.mediaid==0xF0 ) {
 		EmptyCache(); //rescan floppie-content on each findfirst
 	}
+	DBP_LocalFileWriteBarrier();
     
 	char end[2]={CROSS_FILESPLIT,0};
 	if (tempDir[strlen(tempDir)-1]!=CROSS_FILESPLIT) strcat(tempDir,end);
@@ -247,6 +384,7 @@ bool localDrive::FindNext(DOS_DTA & dta) {
 
 	dta.GetSearchParams(srch_attr,srch_pattern);
 	Bit16u id = dta.GetDirID();
+	DBP_LocalFileWriteBarrier();
 
 again:
 	if (!dirCache.FindNext(id,dir_ent)) {
@@ -297,6 +435,7 @@ bool localDrive::GetFileAttr(char * name,Bit16u * attr) {
 	strcat(newname,name);
 	CROSS_FILENAME(newname);
 	dirCache.ExpandName(newname);
+	DBP_LocalFileWriteBarrier();
 
 	struct stat status;
 	if (stat(newname,&status)==0) {
@@ -358,6 +497,7 @@ bool localDrive::TestDir(char * dir) {
 }
 
 bool localDrive::Rename(char * oldname,char * newname) {
+	DBP_LocalFileWriteBarrier();
 	char newold[CROSS_LEN];
 	strcpy(newold,basedir);
 	strcat(newold,oldname);
@@ -388,6 +528,7 @@ bool localDrive::FileExists(const char* name) {
 	strcat(newname,name);
 	CROSS_FILENAME(newname);
 	dirCache.ExpandName(newname);
+	DBP_LocalFileWriteBarrier();
 	struct stat temp_stat;
 	if(stat(newname,&temp_stat)!=0) return false;
 	if(temp_stat.st_mode & S_IFDIR) return false;
@@ -400,6 +541,7 @@ bool localDrive::FileStat(const char* name, FileStat_Block * const stat_block) {
 	strcat(newname,name);
 	CROSS_FILENAME(newname);
 	dirCache.ExpandName(newname);
+	DBP_LocalFileWriteBarrier();
 	struct stat temp_stat;
 	if(stat(newname,&temp_stat)!=0) return false;
 	/* Convert the stat to a FileStat */
@@ -472,6 +614,7 @@ bool localFile::Read(Bit8u * data,Bit16u * size) {
 		DOS_SetError(DOSERR_ACCESS_DENIED);
 		return false;
 	}
+	WaitWriteBehind();
 	if (last_action==WRITE) fseek(fhandle,ftell(fhandle),SEEK_SET);
 	last_action=READ;
 	*size=(Bit16u)fread(data,1,*size,fhandle);
@@ -488,14 +631,27 @@ bool localFile::Write(Bit8u * data,Bit16u * size) {
 		DOS_SetError(DOSERR_ACCESS_DENIED);
 		return false;
 	}
-	if (last_action==READ) fseek(fhandle,ftell(fhandle),SEEK_SET);
-	last_action=WRITE;
+	if (int err = TakeWriteBehindError()) {
+		// report a full disk like DOS does with a short write, everything else as a failed write
+		if (err == ENOSPC) { *size = 0; return true; }
+		DOS_SetError(DOSERR_ACCESS_DENIED);
+		return false;
+	}
 	if(*size==0){  
+		WaitWriteBehind();
+		if (last_action==READ) fseek(fhandle,ftell(fhandle),SEEK_SET);
+		last_action=WRITE;
         return (!ftruncate(fileno(fhandle),ftell(fhandle)));
     }
     else 
     {
-		*size=(Bit16u)fwrite(data,1,*size,fhandle);
+		// without queued writes the host file position is the DOS file position
+		localfile_wb.mutex.Lock();
+		if (!wb_pending) wb_pos=(Bit32u)ftell(fhandle);
+		localfile_wb.mutex.Unlock();
+		localfile_wb.Queue(this,wb_pos,data,*size);
+		wb_pos+=*size;
+		last_action=WRITE;
 		return true;
     }
 }
@@ -510,6 +666,7 @@ bool localFile::Seek(Bit32u * pos,Bit32u type) {
 	//TODO Give some doserrorcode;
 		return false;//ERROR
 	}
+	WaitWriteBehind();
 	int ret=fseek(fhandle,*reinterpret_cast<Bit32s*>(pos),seektype);
 	if (ret!=0) {
 		// Out of file range, pretend everythings ok 
@@ -530,9 +687,14 @@ bool localFile::Seek(Bit32u * pos,Bit32u type) {
 bool localFile::Close() {
 	// only close if one reference left
 	if (refCtr==1) {
+		WaitWriteBehind();
 		if(fhandle) fclose(fhandle);
 		fhandle = 0;
 		open = false;
+		if (TakeWriteBehindError()) {
+			DOS_SetError(DOSERR_ACCESS_DENIED);
+			return false;
+		}
 	};
 	return true;
 }
@@ -544,6 +706,8 @@ Bit16u localFile::GetInformation(void) {
 
 localFile::localFile(const char* _name, FILE * handle) {
 	fhandle=handle;
+	wb_pending=wb_pos=0;
+	wb_error=0;
 	open=true;
 	UpdateDateTimeFromHost();
 
@@ -555,12 +719,17 @@ localFile::localFile(const char* _name, FILE * handle) {
 	SetName(_name);
 }
 
+localFile::~localFile() {
+	WaitWriteBehind();
+}
+
 void localFile::FlagReadOnlyMedium(void) {
 	read_only_medium = true;
 }
 
 bool localFile::UpdateDateTimeFromHost(void) {
 	if(!open) return false;
+	WaitWriteBehind();
 	struct stat temp_stat;
 	fstat(fileno(fhandle),&temp_stat);
 	struct tm * ltime;
@@ -573,11 +742,17 @@ bool localFile::UpdateDateTimeFromHost(void) {
 	return true;
 }
 
-void localFile::Flush(void) {
+bool localFile::Flush(void) {
+	WaitWriteBehind();
 	if (last_action==WRITE) {
 		fseek(fhandle,ftell(fhandle),SEEK_SET);
 		last_action=NONE;
 	}
+	if (TakeWriteBehindError()) {
+		DOS_SetError(DOSERR_ACCESS_DENIED);
+		return false;
+	}
+	return true;
 }
 
 
@@ -398,6 +398,7 @@ bool Overlay_Drive::FileOpen(DOS_File * * file,char * name,Bit32u flags) {
 		DOS_SetError(DOSERR_ACCESS_CODE_INVALID);
 		return false;
 	}
+	DBP_LocalFileWriteBarrier();
 
 	//Flush the buffer of handles for the same file. (Betrayal in Antara)
 	Bit8u i,drive = DOS_DRIVES;
@@ -461,6 +462,7 @@ bool Overlay_Drive::FileCreate(DOS_File * * file,char * name,Bit16u /*attributes
 	//check if leading part of filename is a deleted directory
 	if (check_if_leading_is_deleted(name)) return false;
 
+	DBP_LocalFileWriteBarrier();
 	FILE* f = create_file_in_overlay(name,"wb+");
 	if(!f) {
 		if (logoverlay) LOG_MSG("File creation in overlay system failed %s",name);
@@ -735,6 +737,7 @@ bool Overlay_Drive::FindNext(DOS_DTA & dta) {
 
 	dta.GetSearchParams(srch_attr,srch_pattern);
 	Bit16u id = dta.GetDirID();
+	DBP_LocalFileWriteBarrier();
 
 again:
 	if (!dirCache.FindNext(id,dir_ent)) {
@@ -822,6 +825,7 @@ bool Overlay_Drive::FileUnlink(char * name) {
 //TODO check the basedir for file existence in order if we need to add the file to deleted file list.
 	Bit32u a = GetTicks();
 	if (logoverlay) LOG_MSG("calling unlink on %s",name);
+	DBP_LocalFileWriteBarrier();
 	char basename[CROSS_LEN];
 	strcpy(basename,basedir);
 	strcat(basename,name);
@@ -907,6 +911,7 @@ bool Overlay_Drive::GetFileAttr(char * name,Bit16u * attr) {
 	strcpy(overlayname,overlaydir);
 	strcat(overlayname,name);
 	CROSS_FILENAME(overlayname);
+	DBP_LocalFileWriteBarrier();
 
 	struct stat status;
 	if (stat(overlayname,&status)==0) {
@@ -1065,6 +1070,7 @@ bool Overlay_Drive::FileExists(const char* name) {
 	strcpy(overlayname,overlaydir);
 	strcat(overlayname,name);
 	CROSS_FILENAME(overlayname);
+	DBP_LocalFileWriteBarrier();
 	struct stat temp_stat;
 	if(stat(overlayname,&temp_stat)==0 && (temp_stat.st_mode & S_IFDIR)==0) return true;
 	
@@ -1170,6 +1176,7 @@ bool Overlay_Drive::FileStat(const char* name, FileStat_Block * const stat_block
 	strcpy(overlayname,overlaydir);
 	strcat(overlayname,name);
 	CROSS_FILENAME(overlayname);
+	DBP_LocalFileWriteBarrier();
 	struct stat temp_stat;
 	if(stat(overlayname,&temp_stat) != 0) {
 		if (is_deleted_file(name)) return false;
@@ -81,6 +81,7 @@ public:
 		source[0] = '\0';
 	}
 
+	const char* Target() { return target; }
 	bool IsRedirect() { return type != TDELETE; }
 	bool IsDelete()   { return type == TDELETE; }
 	Type  RedirectType()   { DBP_ASSERT(type != TDELETE); return (Type)type; }
@@ -147,6 +148,7 @@ struct unionDriveImpl
 	StringToPointerHashMap<Union_Modification> modifications;
 	std::vector<Union_Search> searches;
 	std::vector<Bit16u> free_search_ids;
+	std::vector<std::string> scratch_dirs;
 	std::string save_file;
 	Bit32u save_size;
 	bool writable, autodelete_under, autodelete_over, dirty;
@@ -180,6 +182,14 @@ struct unionDriveImpl
 			delete &over;
 	}
 
+	bool IsScratch(const char* path)
+	{
+		// Entries inside scratch directories stay in the memory overlay and are never written to the save file
+		for (const std::string& dir : scratch_dirs)
+			if (!strncmp(path, dir.c_str(), dir.size()) && path[dir.size()] == '\\') return true;
+		return false;
+	}
+
 	bool ExistInOverOrUnder(char* path, bool* out_is_file, bool* out_in_under)
 	{
 		bool file_in_under = under.FileExists(path), dir_in_under = under.TestDir(path), is_file = (over.FileExists(path) || file_in_under);
@@ -308,12 +318,14 @@ struct unionDriveImpl
 			Bit32u local_file_offset, save_size;
 			Bit16u file_count;
 			bool failed;
+			unionDriveImpl* impl;
 			std::vector<Bit8u> central_dir;
 			std::string mods;
 
 			static void WriteFiles(const char* path, bool is_dir, Bit32u size, Bit16u date, Bit16u time, Bit8u attr, Bitu data)
 			{
 				Saver& s = *(Saver*)data;
+				if (s.impl->IsScratch(path)) return;
 				Bit8u buf[4096];
 				Bit16u pathLen = (Bit16u)(strlen(path) + (is_dir ? 1 : 0));
 				Bit32u crc32 = 0, extAttr = (is_dir ? 0x10 : 0);
@@ -401,10 +413,12 @@ struct unionDriveImpl
 		s.local_file_offset = s.save_size = 0;
 		s.file_count = 0;
 		s.failed = false;
+		s.impl = impl;
 		DriveFileIterator(s.drv, Saver::WriteFiles, (Bitu)&s);
 
 		for (StringToPointerHashMap<Union_Modification>::Iterator it = impl->modifications.begin(), end = impl->modifications.end(); it != end; ++it)
-			(*it)->Serialize(s.mods);
+			if (!impl->IsScratch((*it)->Target()))
+				(*it)->Serialize(s.mods);
 		if (s.mods.size())
 			Saver::WriteFiles("FILEMODS.DBP", false, (Bit32u)s.mods.size(), 0, 0, 0, (Bitu)&s);
 
@@ -449,10 +463,10 @@ struct unionDriveImpl
 		dirty = true;
 	}
 
-	void ForceCloseFileAndScheduleSave(DOS_Drive* drv, const char* path)
+	void ForceCloseFileAndScheduleSave(DOS_Drive* drv, const char* path, const char* path2 = NULL)
 	{
 		DriveForceCloseFile(drv, path);
-		ScheduleSave();
+		if (!IsScratch(path) || (path2 && !IsScratch(path2))) ScheduleSave();
 	}
 };
 
@@ -484,7 +498,7 @@ struct Union_WriteHandle : public DOS_File
 	{
 		if (dirty)
 		{
-			impl->ScheduleSave();
+			if (!impl->IsScratch(name)) impl->ScheduleSave();
 			dirty = false;
 		}
 		if (refCtr == 1)
@@ -591,6 +605,22 @@ void unionDrive::AddUnder(DOS_Drive& add_under, bool autodelete_under)
 	impl->autodelete_under = true;
 }
 
+void unionDrive::SetScratchDirs(const char* dirs)
+{
+	// Comma separated list of directories (i.e. "TEMP,TMP") whose contents are kept in memory only
+	impl->scratch_dirs.clear();
+	for (const char *p = dirs, *end; p && *p; p = (*end ? end + 1 : end))
+	{
+		for (end = p; *end && *end != ','; end++) {}
+		const char *a = p, *b = end;
+		while (a < b && (*a == ' ' || *a == '\\' || *a == '/')) a++;
+		while (b > a && (b[-1] == ' ' || b[-1] == '\\' || b[-1] == '/')) b--;
+		if (a == b) continue;
+		impl->scratch_dirs.emplace_back(a, b - a);
+		for (char& c : impl->scratch_dirs.back()) c = (c == '/' ? '\\' : (char)toupper(c));
+	}
+}
+
 bool unionDrive::IsShadowedDrive(const DOS_Drive* drv) const
 {
 	if (this == drv || &impl->over == drv || &impl->under == drv) return true;
@@ -702,7 +732,7 @@ bool unionDrive::FileCreate(DOS_File** file, char * path, Bit16u attributes)
 		}
 	}
 	*file = new Union_WriteHandle(impl, real_file, OPEN_READWRITE, path_org, false);
-	impl->ScheduleSave();
+	if (!impl->IsScratch(path)) impl->ScheduleSave();
 	return TRUE_RESET_DOSERR;
 }
 
@@ -733,7 +763,7 @@ bool unionDrive::Rename(char * oldpath, char * newpath)
 		const char *oldlastslash = strrchr(oldpath, '\\'), *newlastslash = strrchr(newpath, '\\');
 		if ((oldlastslash || newlastslash) && (oldlastslash - oldpath) != (newlastslash - newpath) && memcmp(oldpath, newpath, (newlastslash - newpath))) return FALSE_SET_DOSERR(ACCESS_DENIED);
 	}
-	impl->ForceCloseFileAndScheduleSave(this, oldpath);
+	impl->ForceCloseFileAndScheduleSave(this, oldpath, newpath);
 	if (new_m) //means (new_m->IsDelete())
 	{
 		delete new_m;
@@ -786,7 +816,7 @@ bool unionDrive::MakeDir(char* dir_path)
 	DOSPATH_REMOVE_ENDINGDOTS(dir_path);
 	const Bit16u save_errorcode = dos.errorcode;
 	if (!impl->UnionPrepareCreate(dir_path, false) || !impl->over.MakeDir(dir_path)) return false;
-	impl->ScheduleSave();
+	if (!impl->IsScratch(dir_path)) impl->ScheduleSave();
 	return TRUE_RESET_DOSERR;
 }
 
@@ -20,6 +20,7 @@
 #include "dos_inc.h"
 #include "drives.h"
 #include "inout.h"
+#include "dbp_memstats.h"
 
 #include <vector>
 
@@ -1163,6 +1164,17 @@ struct Zip_MemoryUnpacker : ZIP_Unpacker
 {
 	std::vector<Bit8u> mem_data;
 
+	~Zip_MemoryUnpacker()
+	{
+		DBP_MemStats_Free(DBPMEM_ZIP, mem_data.size());
+	}
+
+	void AllocData(Bit32u size)
+	{
+		mem_data.resize(size);
+		DBP_MemStats_Alloc(DBPMEM_ZIP, size);
+	}
+
 	Bit32u Read(const Zip_File& f, Bit32u seek_ofs, void *res_buf, Bit32u res_n)
 	{
 		if ((size_t)seek_ofs > mem_data.size()) seek_ofs = (Bit32u)mem_data.size();
@@ -1180,7 +1192,7 @@ struct Zip_ShrinkUnpacker : Zip_MemoryUnpacker
 		Bit8u* in_buf = (Bit8u*)(unshrink + 1);
 		if (archive.Read(f.data_ofs, in_buf, f.comp_size) == f.comp_size)
 		{
-			mem_data.resize(f.uncomp_size);
+			AllocData(f.uncomp_size);
 			unshrink->in_start = unshrink->in_cur = in_buf;
 			unshrink->in_end = in_buf + f.comp_size;
 			unshrink->out_start = unshrink->out_cur = &mem_data[0];
@@ -1200,7 +1212,7 @@ struct Zip_ImplodeUnpacker : Zip_MemoryUnpacker
 		Bit8u* in_buf = (Bit8u*)(explode + 1);
 		if (archive.Read(f.data_ofs, in_buf, f.comp_size) == f.comp_size)
 		{
-			mem_data.resize(f.uncomp_size);
+			AllocData(f.uncomp_size);
 			explode->in_start = explode->in_cur = in_buf;
 			explode->in_end = in_buf + f.comp_size;
 			explode->out_start = explode->out_cur = &mem_data[0];
@@ -1217,7 +1229,7 @@ struct Zip_DeflateMemoryUnpacker : Zip_MemoryUnpacker
 	Zip_DeflateMemoryUnpacker(Zip_Archive& archive, const Zip_File& f)
 	{
 		DBP_ASSERT(f.ofs_past_header);
-		mem_data.resize(f.uncomp_size);
+		AllocData(f.uncomp_size);
 
 		miniz::tinfl_decompressor inflator;
 		Bit64u ofs = f.data_ofs, ofs_last_read = 0;
@@ -1278,7 +1290,7 @@ struct Zip_DeflateUnpacker : ZIP_Unpacker
 		Bit8u write_buf[WRITE_BLOCK];
 	};
 
-	Bit32u cursor_block;
+	Bit32u cursor_block, cursor_count_tagged;
 	SeekCursor* cursors;
 
 	enum { SEEK_CURSOR_MAX_DEFL = 128 + (sizeof(SeekCursor) + 9) / 10 * 11, SEEK_CACHE_CURSOR_STEPS = 20 };
@@ -1295,6 +1307,7 @@ struct Zip_DeflateUnpacker : ZIP_Unpacker
 			:                                  ( 256*1024); //  0~12 MB,  2~48 cursors
 		Bit32u cursor_count = (f.uncomp_size + (cursor_block - 1)) / cursor_block;
 		cursors = (SeekCursor*)calloc(cursor_count, sizeof(SeekCursor));
+		DBP_MemStats_Alloc(DBPMEM_ZIP, (cursor_count_tagged = cursor_count) * sizeof(SeekCursor));
 		Reset(f);
 
 		// Read seek cache file for larger files
@@ -1343,6 +1356,7 @@ struct Zip_DeflateUnpacker : ZIP_Unpacker
 	~Zip_DeflateUnpacker()
 	{
 		free(cursors);
+		DBP_MemStats_Free(DBPMEM_ZIP, cursor_count_tagged * sizeof(SeekCursor));
 		if (seek_cache) delete seek_cache;
 	}
 
@@ -1611,6 +1625,101 @@ struct Zip_Search
 	Bit32u index;
 };
 
+// Parsed directory tree of a large archive stored in a file to skip parsing the central directory when the same archive gets mounted again
+// The file is keyed by the archive size and modification time plus the end of central directory record, which are all cheap to check
+struct Zip_DirCache
+{
+	enum { MAGIC = 0x435A4244, MIN_ENTRIES = 1000 };
+	struct Header
+	{
+		Bit32u magic, rec_size, solo_root, num_files, num_dirs;
+		Bit8u ecdh[22]; // MZ_ZIP_END_OF_CENTRAL_DIR_HEADER_SIZE
+		Bit16u root_date, root_time;
+		Bit64u archive_size, mtime, cdir_ofs, cdir_size, total_files, total_decomp_size;
+	};
+	struct Record
+	{
+		Bit64u ofs;
+		Bit32u comp_size, uncomp_size, parent; // parent is 0 for the root or the index of the parent directory plus 1
+		Bit16u date, time, attr;
+		Bit8u bit_flags, method;
+		char name[DOS_NAMELENGTH_ASCII];
+	};
+	Header hdr;
+	std::vector<Record> recs;
+	StringToPointerHashMap<void> dir_idx;
+
+	void AddRecord(const char* dos_path, const char* p_dos, Zip_Entry& e)
+	{
+		recs.emplace_back();
+		Record& r = recs.back();
+		memset(&r, 0, sizeof(r));
+		r.parent = (p_dos == dos_path ? 0 : (Bit32u)(size_t)dir_idx.Get(dos_path, (Bit32u)(p_dos - dos_path - 1)));
+		r.date = e.date;
+		r.time = e.time;
+		r.attr = e.attr;
+		memcpy(r.name, e.name, sizeof(r.name));
+		if (e.IsDirectory())
+		{
+			r.ofs = e.AsDirectory()->ofs;
+			dir_idx.Put(dos_path, (void*)(size_t)(++hdr.num_dirs));
+		}
+		else
+		{
+			Zip_File& f = *e.AsFile();
+			r.ofs = f.data_ofs;
+			r.comp_size = f.comp_size;
+			r.uncomp_size = f.uncomp_size;
+			r.bit_flags = f.bit_flags;
+			r.method = f.method;
+			hdr.num_files++;
+		}
+	}
+
+	void Save(const char* path)
+	{
+		FILE* f = fopen_wrap(path, "wb");
+		if (!f) return;
+		bool failed = !fwrite(&hdr, sizeof(hdr), 1, f) || (recs.size() && !fwrite(&recs[0], sizeof(Record) * recs.size(), 1, f));
+		fclose(f);
+		if (failed) remove(path);
+	}
+
+	bool Load(const char* path)
+	{
+		FILE* f = fopen_wrap(path, "rb");
+		if (!f) return false;
+		Header key = hdr;
+		bool valid = (fread(&hdr, sizeof(hdr), 1, f) && hdr.magic == key.magic && hdr.rec_size == key.rec_size && hdr.solo_root == key.solo_root
+			&& !memcmp(hdr.ecdh, key.ecdh, sizeof(hdr.ecdh)) && hdr.archive_size == key.archive_size && hdr.mtime == key.mtime
+			&& hdr.cdir_ofs == key.cdir_ofs && hdr.cdir_size == key.cdir_size && hdr.total_files == key.total_files
+			&& hdr.num_files <= key.total_files); // directories can be implied by paths so only files are limited by the number of entries
+		if (valid && (fseek_wrap(f, 0, SEEK_END) || ftell_wrap(f) != (Bit64s)(sizeof(hdr) + ((Bit64u)hdr.num_files + hdr.num_dirs) * sizeof(Record)) || fseek_wrap(f, (Bit64s)sizeof(hdr), SEEK_SET)))
+			valid = false;
+		if (valid)
+		{
+			recs.resize((size_t)hdr.num_files + hdr.num_dirs);
+			valid = (recs.empty() || fread(&recs[0], sizeof(Record) * recs.size(), 1, f));
+		}
+		fclose(f);
+
+		// The file is not trusted, validate all records before building anything (parents always precede their children)
+		Bit32u num_files = 0, num_dirs = 0;
+		for (const Record& r : recs)
+		{
+			if (!valid) break;
+			valid = (r.parent <= num_dirs && r.name[0] && memchr(r.name, '\0', sizeof(r.name)));
+			if (r.attr & DOS_ATTR_DIRECTORY) { num_dirs++; continue; }
+			num_files++;
+			if (!ZIP_Unpacker::MethodSupported(r.method) || (r.ofs + r.comp_size) > hdr.archive_size || (!r.method && r.comp_size != r.uncomp_size)) valid = false;
+		}
+		if (valid && num_files == hdr.num_files && num_dirs == hdr.num_dirs) return true;
+		hdr = key;
+		recs.clear();
+		return false;
+	}
+};
+
 struct zipDriveImpl
 {
 	Zip_Archive archive;
@@ -1645,7 +1754,7 @@ struct zipDriveImpl
 		MZ_ZIP_LDH_FILENAME_LEN_OFS = 26, MZ_ZIP_LDH_EXTRA_LEN_OFS = 28,
 	};
 
-	zipDriveImpl(DOS_File* _zip, bool enter_solo_root_dir) : root(DOS_ATTR_VOLUME|DOS_ATTR_DIRECTORY, "", 0xFFFF, 0xFFFF, 0), archive(_zip), total_decomp_size(0)
+	zipDriveImpl(DOS_File* _zip, bool enter_solo_root_dir, const char* cache_path, Bit64u cache_mtime) : root(DOS_ATTR_VOLUME|DOS_ATTR_DIRECTORY, "", 0xFFFF, 0xFFFF, 0), archive(_zip), total_decomp_size(0)
 	{
 		// Basic sanity checks - reject files which are too small.
 		if (archive.size < MZ_ZIP_END_OF_CENTRAL_DIR_HEADER_SIZE)
@@ -1671,6 +1780,9 @@ struct zipDriveImpl
 		Bit64u cdir_size   = MZ_READ_LE32(buf + MZ_ZIP_ECDH_CDIR_SIZE_OFS);
 		Bit64u cdir_ofs    = MZ_READ_LE32(buf + MZ_ZIP_ECDH_CDIR_OFS_OFS);
 
+		Bit8u ecdh[MZ_ZIP_END_OF_CENTRAL_DIR_HEADER_SIZE];
+		memcpy(ecdh, buf, sizeof(ecdh));
+
 		if ((cdir_ofs == 0xFFFFFFFF || cdir_size == 0xFFFFFFFF || total_files == 0xFFFF)
 			&& ecdh_ofs >= (MZ_ZIP64_END_OF_CENTRAL_DIR_LOCATOR_SIZE + MZ_ZIP64_END_OF_CENTRAL_DIR_HEADER_SIZE)
 			&& archive.Read(ecdh_ofs - MZ_ZIP64_END_OF_CENTRAL_DIR_LOCATOR_SIZE, buf, MZ_ZIP64_END_OF_CENTRAL_DIR_LOCATOR_SIZE) == MZ_ZIP64_END_OF_CENTRAL_DIR_LOCATOR_SIZE
@@ -1693,10 +1805,35 @@ struct zipDriveImpl
 			|| ((cdir_ofs + cdir_size) > archive.size)
 			) return;
 
+		// Large archives store their parsed tree in a cache file, check it before reading the central directory
+		Zip_DirCache* cache = NULL;
+		if (cache_path && total_files >= Zip_DirCache::MIN_ENTRIES)
+		{
+			cache = new Zip_DirCache;
+			memset(&cache->hdr, 0, sizeof(cache->hdr));
+			cache->hdr.magic = Zip_DirCache::MAGIC;
+			cache->hdr.rec_size = (Bit32u)sizeof(Zip_DirCache::Record);
+			cache->hdr.solo_root = enter_solo_root_dir;
+			memcpy(cache->hdr.ecdh, ecdh, sizeof(ecdh));
+			cache->hdr.archive_size = archive.size;
+			cache->hdr.mtime = cache_mtime;
+			cache->hdr.cdir_ofs = cdir_ofs;
+			cache->hdr.cdir_size = cdir_size;
+			cache->hdr.total_files = total_files;
+			if (cache->Load(cache_path))
+			{
+				LoadDirCache(*cache);
+				delete cache;
+				return;
+			}
+			cache->recs.reserve((size_t)total_files);
+		}
+
 		void* m_central_dir = malloc((size_t)cdir_size);
 		if (archive.Read(cdir_ofs, m_central_dir, (Bit32u)cdir_size) != cdir_size)
 		{
 			free(m_central_dir);
+			delete cache;
 			return;
 		}
 		const Bit8u *cdir_start = (const Bit8u*)m_central_dir, *cdir_end = cdir_start + cdir_size, *p = cdir_start;
@@ -1806,6 +1943,7 @@ struct zipDriveImpl
 					}
 					zfile = new Zip_File(DOS_ATTR_ARCHIVE, p_dos, file_date, file_time, local_header_ofs, (Bit32u)comp_size, (Bit32u)decomp_size, (Bit8u)bit_flag, (Bit8u)method);
 					parent->entries.Put(p_dos, zfile);
+					if (cache) cache->AddRecord(dos_path, p_dos, *zfile);
 					skip_zip_entry:
 					break;
 				}
@@ -1816,6 +1954,7 @@ struct zipDriveImpl
 					zdir = new Zip_Directory(DOS_ATTR_DIRECTORY, p_dos, file_date, file_time, local_header_ofs);
 					parent->entries.Put(p_dos, zdir);
 					directories.Put(dos_path, zdir);
+					if (cache) cache->AddRecord(dos_path, p_dos, *zdir);
 				}
 				if (n + 1 >= nEnd) break;
 				parent = zdir;
@@ -1826,6 +1965,45 @@ struct zipDriveImpl
 		}
 		free(m_central_dir);
 		if (root.time == 0xFFFF) root.time = root.date = 0;
+
+		if (cache)
+		{
+			// Records are stored in creation order so a rebuild ends up with the same hash map layout (and directory listing order)
+			cache->hdr.total_decomp_size = total_decomp_size;
+			cache->hdr.root_date = root.date;
+			cache->hdr.root_time = root.time;
+			cache->Save(cache_path);
+			delete cache;
+		}
+	}
+
+	void LoadDirCache(const Zip_DirCache& cache)
+	{
+		// Directory paths are never built as strings, the hash of the parent path is continued with the separator and name
+		std::vector<Zip_Directory*> dirs(cache.hdr.num_dirs);
+		std::vector<Bit32u> dir_hashes(cache.hdr.num_dirs);
+		Bit32u num_dirs = 0;
+		for (const Zip_DirCache::Record& r : cache.recs)
+		{
+			Zip_Directory* parent = (r.parent ? dirs[r.parent - 1] : &root);
+			Bit32u hash_init = (r.parent ? StringToPointerHashMap<void>::Hash("\\", 0xFFFF, dir_hashes[r.parent - 1]) : (Bit32u)0x811c9dc5);
+			if (r.attr & DOS_ATTR_DIRECTORY)
+			{
+				Zip_Directory* zdir = new Zip_Directory(r.attr, r.name, r.date, r.time, r.ofs);
+				dirs[num_dirs] = zdir;
+				dir_hashes[num_dirs++] = StringToPointerHashMap<void>::Hash(r.name, 0xFFFF, hash_init);
+				parent->entries.Put(r.name, zdir);
+				directories.Put(r.name, zdir, 0xFFFF, hash_init);
+			}
+			else
+			{
+				Zip_File* zfile = new Zip_File(r.attr, r.name, r.date, r.time, r.ofs, r.comp_size, r.uncomp_size, r.bit_flags, r.method);
+				parent->entries.Put(r.name, zfile);
+			}
+		}
+		total_decomp_size = cache.hdr.total_decomp_size;
+		root.date = cache.hdr.root_date;
+		root.time = cache.hdr.root_time;
 	}
 
 	bool SetOfsPastHeader(Zip_File& f)
@@ -1852,7 +2030,7 @@ struct zipDriveImpl
 	}
 };
 
-zipDrive::zipDrive(DOS_File* zip, bool enter_solo_root_dir) : impl(new zipDriveImpl(zip, enter_solo_root_dir))
+zipDrive::zipDrive(DOS_File* zip, bool enter_solo_root_dir, const char* cache_path, Bit64u cache_mtime) : impl(new zipDriveImpl(zip, enter_solo_root_dir, cache_path, cache_mtime))
 {
 	label.SetLabel("ZIP", false, true);
 }
@@ -2036,17 +2214,19 @@ bool zipDrive::isRemote(void) { return false; }
 bool zipDrive::isRemovable(void) { return false; }
 Bits zipDrive::UnMount(void) { delete this; return 0;  }
 
-void zipDrive::Uncompress(const Bit8u* src, Bit32u src_len, Bit8u* trg, Bit32u trg_len)
+bool zipDrive::Uncompress(const Bit8u* src, Bit32u src_len, Bit8u* trg, Bit32u trg_len)
 {
+	// Returns false if the data is corrupt or doesn't inflate to exactly trg_len bytes
 	miniz::tinfl_decompressor inflator;
 	miniz::tinfl_init(&inflator);
 	const Bit8u *src_end = src + src_len, *trg_start = trg, *trg_end = trg + trg_len;
-	for (miniz::tinfl_status status = miniz::TINFL_STATUS_HAS_MORE_OUTPUT; status == miniz::TINFL_STATUS_HAS_MORE_OUTPUT;)
+	miniz::tinfl_status status = miniz::TINFL_STATUS_HAS_MORE_OUTPUT;
+	while (status == miniz::TINFL_STATUS_HAS_MORE_OUTPUT && trg != trg_end)
 	{
 		Bit32u in_size = (Bit32u)(src_end - src), out_size = (Bit32u)(trg_end - trg);
 		status = miniz::tinfl_decompress(&inflator, src, &in_size, (Bit8u*)trg_start, trg, &out_size, miniz::TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
 		src += in_size;
 		trg += out_size;
-		DBP_ASSERT(status == miniz::TINFL_STATUS_HAS_MORE_OUTPUT || status == miniz::TINFL_STATUS_DONE);
 	}
+	return (status == miniz::TINFL_STATUS_DONE && trg == trg_end);
 }
@@ -25,6 +25,7 @@
 #include "mapper.h"
 #include "support.h"
 #include "setup.h"
+#include "dbp_simd.h"
 
 bool WildFileCmp(const char * file, const char * wild) 
 {
@@ -541,11 +542,7 @@ bool DriveCreateFile(DOS_Drive* drv, const char* path, const Bit8u* buf, Bit32u
 
 Bit32u DriveCalculateCRC32(const Bit8u *ptr, size_t len, Bit32u crc)
 {
-	// Karl Malbrain's compact CRC-32. See "A compact CCITT crc16 and crc32 C implementation that balances processor cache usage against speed": http://www.geocities.com/malbrain/
-	static const Bit32u s_crc32[16] = { 0, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c, 0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c };
-	Bit32u crcu32 = (Bit32u)~crc;
-	while (len--) { Bit8u b = *ptr++; crcu32 = (crcu32 >> 4) ^ s_crc32[(crcu32 & 0xF) ^ (b & 0xF)]; crcu32 = (crcu32 >> 4) ^ s_crc32[(crcu32 & 0xF) ^ (b >> 4)]; }
-	return ~crcu32;
+	return DBP_SIMD.CRC32(ptr, len, crc);
 }
 
 //DBP: utility function to evaluate an entire drives filesystem
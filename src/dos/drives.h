@@ -178,9 +178,11 @@ public:
 	virtual bool isRemote(void);
 	virtual bool isRemovable(void);
 	virtual Bits UnMount(void);
-	virtual void EmptyCache(void){}
+	virtual void EmptyCache(void);
+	void RunLookupBenchmark(Bit32u rounds);
 public:
 	Bit8u readSector(Bit32u sectnum, void * data);
+	Bit8u readSectors(Bit32u sectnum, Bit32u count, void * data);
 	Bit8u writeSector(Bit32u sectnum, void * data);
 	Bit32u getAbsoluteSectFromBytePos(Bit32u startClustNum, Bit32u bytePos);
 	Bit32u getSectorCount(void);
@@ -201,6 +203,9 @@ private:
 	void setClusterValue(Bit32u clustNum, Bit32u clustValue);
 	Bit32u getClustFirstSect(Bit32u clustNum);
 	bool FindNextInternal(Bit32u dirClustNumber, DOS_DTA & dta, direntry *foundEntry);
+	bool findDirEntry(Bit32u dirClustNumber, const char* name, Bit8u attrs, direntry *foundEntry, Bit32u *entryPos);
+	struct fatDirIndex* getDirIndex(Bit32u dirClustNumber);
+	void dirCacheSectorWritten(Bit32u sectnum);
 	bool getDirClustNum(char * dir, Bit32u * clustNum, bool parDir);
 	bool getFileDirEntry(char const * const filename, direntry * useEntry, Bit32u * dirClust, Bit32u * subEntry);
 	bool addDirectoryEntry(Bit32u dirClustNumber, direntry useEntry);
@@ -231,6 +236,8 @@ private:
 
 	Bit8u fatSectBuffer[1024];
 	Bit32u curFatSect;
+
+	struct fatDirCache* dircache;
 };
 
 
@@ -652,7 +659,7 @@ private:
 
 class zipDrive : public DOS_Drive {
 public:
-	zipDrive(DOS_File* zip, bool enter_solo_root_dir);
+	zipDrive(DOS_File* zip, bool enter_solo_root_dir, const char* cache_path = NULL, Bit64u cache_mtime = 0);
 	virtual ~zipDrive();
 	virtual bool FileOpen(DOS_File * * file, char * name,Bit32u flags);
 	virtual bool FileCreate(DOS_File * * file, char * name,Bit16u attributes);
@@ -672,7 +679,7 @@ public:
 	virtual bool isRemote(void);
 	virtual bool isRemovable(void);
 	virtual Bits UnMount(void);
-	static void Uncompress(const Bit8u* src, Bit32u src_len, Bit8u* trg, Bit32u trg_len);
+	static bool Uncompress(const Bit8u* src, Bit32u src_len, Bit8u* trg, Bit32u trg_len);
 private:
 	struct zipDriveImpl* impl;
 };
@@ -682,6 +689,7 @@ public:
 	unionDrive(DOS_Drive& under, DOS_Drive& over, bool autodelete_under = false, bool autodelete_over = false);
 	unionDrive(DOS_Drive& under, const char* save_file = NULL, bool autodelete_under = false, bool strict_mode = false);
 	void AddUnder(DOS_Drive& add_under, bool autodelete_under = false);
+	void SetScratchDirs(const char* dirs);
 	bool IsShadowedDrive(const DOS_Drive* drv) const;
 	virtual ~unionDrive();
 	virtual bool FileOpen(DOS_File * * file, char * name,Bit32u flags);
@@ -555,6 +555,9 @@ void DOSBOX_Init(void) {
 	Pint = secprop->Add_int("vmemsize", Property::Changeable::OnlyAtStart,2);
 	Pint->SetMinMax(0,8);
 	Pint->Set_help("Amount of video memory in megabytes.");
+
+	Pbool = secprop->Add_bool("lowmemory", Property::Changeable::OnlyAtStart, false);
+	Pbool->Set_help("Reduce host memory usage by sizing the dynamic core cache to the amount of emulated memory and by storing changes to read-only disk images in a temporary file.");
 #endif
 
 #ifdef C_DBP_ENABLE_CAPTURE
@@ -666,6 +669,10 @@ void DOSBOX_Init(void) {
 
 	Pstring = Pmulti_remain->GetSection()->Add_string("parameters",Property::Changeable::Always,"");
 
+	Pbool = secprop->Add_bool("skippolling",Property::Changeable::Always,false);
+	Pbool->Set_help("Detect loops busy polling for vertical retrace or keyboard input and skip ahead\n"
+		"to the next event that can change the polled status.");
+
 #ifdef C_DBP_ENABLE_MAPPER
 	Pint = secprop->Add_int("cycleup",Property::Changeable::Always,10);
 	Pint->SetMinMax(1,1000000);
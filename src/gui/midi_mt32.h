@@ -19,18 +19,20 @@
 #include "mixer.h"
 #include "support.h"
 #include "cross.h"
+#include "dbp_memstats.h"
 #include "mt32emu.h"
 
 static void MIDI_MT32_CallBack(Bitu len);
 
 struct MidiHandler_mt32 : public MidiHandler
 {
-	MidiHandler_mt32() : MidiHandler(), chan(NULL), mo(NULL), f_control(NULL), f_pcm(NULL), syn(NULL) {}
+	MidiHandler_mt32() : MidiHandler(), chan(NULL), mo(NULL), f_control(NULL), f_pcm(NULL), syn(NULL), syn_memstat_size(0) {}
 	MixerChannel*   chan;
 	MixerObject*    mo;
 	FILE*           f_control;
 	FILE*           f_pcm;
 	MT32Emu::Synth* syn;
+	size_t          syn_memstat_size;
 
 	const char * GetName(void) { return "mt32"; };
 
@@ -178,7 +180,7 @@ struct MidiHandler_mt32 : public MidiHandler
 	{
 		if (f_control) { fclose(f_control);        f_control = NULL; }
 		if (f_pcm)     { fclose(f_pcm);            f_pcm     = NULL; }
-		if (syn)       { syn->close(); delete syn; syn       = NULL; }
+		if (syn)       { syn->close(); delete syn; syn       = NULL; DBP_MemStats_Free(DBPMEM_MT32, syn_memstat_size); }
 		if (chan)      { chan->Enable(false);      chan      = NULL; }
 		if (mo)        { delete mo;                mo        = NULL; } // also deletes chan!
 	};
@@ -192,6 +194,7 @@ struct MidiHandler_mt32 : public MidiHandler
 		RomFile pcm_rom_file(f_pcm);         fclose(f_pcm);     f_pcm     = NULL;
 
 		syn = new MT32Emu::Synth(NULL);
+		DBP_MemStats_Alloc(DBPMEM_MT32, (syn_memstat_size = sizeof(MT32Emu::Synth) + control_rom_file.size + pcm_rom_file.size)); // approximate, the synth keeps decoded copies of both ROMs
 		const MT32Emu::ROMImage *control = MT32Emu::ROMImage::makeROMImage(&control_rom_file), *pcm = MT32Emu::ROMImage::makeROMImage(&pcm_rom_file);
 		syn->open(*control, *pcm, MT32Emu::DEFAULT_MAX_PARTIALS, MT32Emu::AnalogOutputMode_ACCURATE);
 		MT32Emu::ROMImage::freeROMImage(control);
@@ -199,6 +202,7 @@ struct MidiHandler_mt32 : public MidiHandler
 
 		if (!syn->isOpen())
 		{
+			DBP_MemStats_Free(DBPMEM_MT32, syn_memstat_size);
 			delete syn;
 			syn = NULL;
 			return false;
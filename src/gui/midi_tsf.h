@@ -17,10 +17,32 @@
  */
 
 #include "mixer.h"
+#include "dbp_memstats.h"
 
 #define STB_VORBIS_HEADER_ONLY
 #include "../dos/stb_vorbis.inl"
 
+// Prefix each TSF allocation with its size so the loaded SoundFont can be accounted for
+static void* MIDI_TSF_Realloc(void* ptr, size_t size)
+{
+	size_t *p = (ptr ? (size_t*)ptr - 2 : NULL), oldsize = (p ? p[0] : 0);
+	size_t *res = (size_t*)realloc(p, size + sizeof(size_t) * 2);
+	if (!res) return NULL;
+	DBP_MemStats_Free(DBPMEM_SOUNDFONT, oldsize);
+	DBP_MemStats_Alloc(DBPMEM_SOUNDFONT, (res[0] = size));
+	return res + 2;
+}
+static void MIDI_TSF_Free(void* ptr)
+{
+	if (!ptr) return;
+	size_t* p = (size_t*)ptr - 2;
+	DBP_MemStats_Free(DBPMEM_SOUNDFONT, p[0]);
+	free(p);
+}
+#define TSF_MALLOC(size) MIDI_TSF_Realloc(NULL, size)
+#define TSF_REALLOC MIDI_TSF_Realloc
+#define TSF_FREE MIDI_TSF_Free
+
 #define TSF_IMPLEMENTATION
 #define TSF_STATIC
 #include "tsf.h"
@@ -27,6 +27,8 @@
 #include "dosbox.h"
 #include "video.h"
 #include "render.h"
+#include "dbp_simd.h"
+#include "dbp_memstats.h"
 #include "setup.h"
 #include "control.h"
 #include "mapper.h"
@@ -42,6 +44,9 @@ Render_t render;
 ScalerLineHandler_t RENDER_DrawLine;
 
 static void RENDER_CallBack( GFX_CallBackFunctions_t function );
+#ifndef C_DBP_ENABLE_SCALERCACHE
+static void RENDER_ResetLineVersions(void);
+#endif
 
 static void Check_Palette(void) {
 	/* Clean up any previous changed palette data */
@@ -85,6 +90,9 @@ static void Check_Palette(void) {
 		}
 		break;
 	}
+#ifndef C_DBP_ENABLE_SCALERCACHE
+	if (render.pal.changed) RENDER_ResetLineVersions();
+#endif
 	/* Setup pal index to startup values */
 	render.pal.first=256;
 	render.pal.last=0;
@@ -101,6 +109,92 @@ void RENDER_SetPal(Bit8u entry,Bit8u red,Bit8u green,Bit8u blue) {
 static void RENDER_EmptyLineHandler(const void * src) {
 }
 
+#ifndef C_DBP_ENABLE_SCALERCACHE
+/* Copy of the source lines of the last drawn frame with a version number for each line that gets renewed whenever the
+   content of the line changes. Each of the two output buffers remembers which version of every line it holds, so a
+   line that is the same as the last time it was drawn into the buffer is left alone. On a static SVGA desktop only
+   the lines under the old and new position of the hardware mouse cursor (which gets composited into the source line)
+   get converted. */
+static struct RENDER_LineVersions { const Bit8u* buffer; Bit32u version[SCALER_MAXHEIGHT]; Bit8u lines[SCALER_MAXHEIGHT]; } render_versions[2];
+static RENDER_LineVersions *render_versionWrite, *render_versionPrev;
+static Bit8u* render_srcCache;
+static Bitu render_srcBytes, render_srcLines, render_srcCacheSize;
+static Bit32u render_srcVersion[SCALER_MAXHEIGHT], render_versionCounter; /* 0 marks an unknown line */
+
+static void RENDER_ResetLineVersions(void) {
+	render_versions[0].buffer = render_versions[1].buffer = NULL;
+	render_versionWrite = render_versionPrev = NULL;
+	memset(render_srcVersion, 0, sizeof(render_srcVersion));
+	render_versionCounter = 0;
+}
+
+static void RENDER_SetupLineVersions(void) {
+	Bitu bytes;
+	switch (render.scale.inMode) {
+		case scalerMode8: bytes = render.src.width; break;
+		case scalerMode15: case scalerMode16: bytes = render.src.width * 2; break;
+		default: bytes = render.src.width * 4; break;
+	}
+	Bitu lines = (render.src.height < SCALER_MAXHEIGHT ? render.src.height : SCALER_MAXHEIGHT);
+	if (bytes != render_srcBytes || lines > render_srcLines || render_versionCounter > 0xF0000000) {
+		/* Nothing is known about the content of either buffer when the source layout changes (or the versions run out) */
+		RENDER_ResetLineVersions();
+		if (bytes * lines > render_srcCacheSize) {
+			DBP_MemStats_Free(DBPMEM_VGA, render_srcCacheSize);
+			render_srcCache = (Bit8u*)realloc(render_srcCache, (render_srcCacheSize = bytes * lines));
+			DBP_MemStats_Alloc(DBPMEM_VGA, render_srcCacheSize);
+		}
+		render_srcBytes = bytes;
+		render_srcLines = lines;
+	}
+
+	const Bit8u *buffer = render.scale.outWrite, *prevBuffer = buffer + render.scale.outCompare;
+	render_versionWrite = render_versionPrev = NULL;
+	for (Bitu i = 0; i != 2; i++) {
+		if (render_versions[i].buffer == buffer) render_versionWrite = &render_versions[i];
+		if (render_versions[i].buffer == prevBuffer) render_versionPrev = &render_versions[i];
+	}
+	if (!render_versionWrite || !render.scale.outIntact) {
+		/* Nothing is known about the current content of the buffer, all lines need to be converted */
+		render_versionWrite = &render_versions[render_versionPrev == &render_versions[0] ? 1 : 0];
+		render_versionWrite->buffer = buffer;
+		memset(render_versionWrite->version, 0, sizeof(render_versionWrite->version));
+	}
+}
+
+static void RENDER_CompareLineHandler(const void * src) {
+	Bit8u* line = render.scale.outWrite;
+	Bitu inLine = render.scale.inLine++, lines;
+	if (GCC_LIKELY(inLine < render_srcLines)) {
+		/* Compare the source line with the copy of the last frame to get its version */
+		Bit8u* cache = render_srcCache + inLine * render_srcBytes;
+		Bit32u& version = render_srcVersion[inLine];
+		if (!version || !DBP_SIMD.MemEqual(cache, src, render_srcBytes)) {
+			memcpy(cache, src, render_srcBytes);
+			version = ++render_versionCounter;
+		}
+		if (render_versionWrite->version[inLine] == version) {
+			/* The buffer already holds this line */
+			lines = render_versionWrite->lines[inLine];
+			render.scale.outWrite += render.scale.outPitch * lines;
+		} else {
+			render.scale.lineHandler( src );
+			lines = (Bitu)(render.scale.outWrite - line) / render.scale.outPitch;
+			render_versionWrite->version[inLine] = version;
+			render_versionWrite->lines[inLine] = (Bit8u)lines;
+		}
+		/* The line is unchanged on screen if the previous frame's buffer holds the same version */
+		if (!render_versionPrev || render_versionPrev->version[inLine] != version)
+			render.scale.outChanged = true;
+	} else {
+		render.scale.lineHandler( src );
+		lines = (Bitu)(render.scale.outWrite - line) / render.scale.outPitch;
+		render.scale.outChanged = true;
+	}
+	render.scale.outLine += lines;
+}
+#endif
+
 #ifdef C_DBP_ENABLE_SCALERCACHE
 static void RENDER_StartLineHandler(const void * s) {
 	if (s) {
@@ -172,9 +266,20 @@ bool RENDER_StartUpdate(void) {
 	render.scale.outWrite = 0;
 	render.scale.outPitch = 0;
 #ifndef C_DBP_ENABLE_SCALERCACHE
+	render.scale.outCompare = 0;
+	render.scale.outIntact = false;
 	if (GCC_UNLIKELY(!GFX_StartUpdate( render.scale.outWrite, render.scale.outPitch )))
 		return false;
-	RENDER_DrawLine = render.scale.lineHandler;
+	if (render.scale.outCompare) {
+		/* Track if any line differs from the previous frame */
+		render.scale.outChanged = false;
+		RENDER_SetupLineVersions();
+		RENDER_DrawLine = RENDER_CompareLineHandler;
+	} else {
+		render.scale.outChanged = true;
+		RENDER_ResetLineVersions();
+		RENDER_DrawLine = render.scale.lineHandler;
+	}
 #else
 	Scaler_ChangedLines[0] = 0;
 	Scaler_ChangedLineIndex = 0;
@@ -298,6 +403,9 @@ static void RENDER_Reset( void ) {
 	Bitu width=render.src.width;
 	Bitu height=render.src.height;
 	bool dblw=render.src.dblw;
+#ifndef C_DBP_ENABLE_SCALERCACHE
+	RENDER_ResetLineVersions();
+#endif
 	bool dblh=render.src.dblh;
 
 	double gfx_scalew;
@@ -708,6 +816,17 @@ static bool RENDER_GetShader(std::string& shader_path, char *old_src) {
 }
 #endif
 
+static void RENDER_ShutDown(Section* /*sec*/) {
+#ifndef C_DBP_ENABLE_SCALERCACHE
+	/* The copy of the source lines can be up to width * height * 4 bytes, the next frame allocates it again if needed */
+	RENDER_ResetLineVersions();
+	DBP_MemStats_Free(DBPMEM_VGA, render_srcCacheSize);
+	free(render_srcCache);
+	render_srcCache = NULL;
+	render_srcBytes = render_srcLines = render_srcCacheSize = 0;
+#endif
+}
+
 void RENDER_Init(Section * sec) {
 	Section_prop * section=static_cast<Section_prop *>(sec);
 
@@ -794,6 +913,7 @@ void RENDER_Init(Section * sec) {
 
 	if(!running) render.updating=true;
 	running = true;
+	sec->AddDestroyFunction(&RENDER_ShutDown,true);
 
 #ifdef C_DBP_ENABLE_MAPPER
 	MAPPER_AddHandler(DecreaseFrameSkip,MK_f7,MMOD1,"decfskip","Dec Fskip");
@@ -822,6 +942,7 @@ void DBPSerialize_Render(DBPArchive& ar)
 	if (ar.version < 5) { Bitu old; ar.Serialize(old); }
 	ar.Serialize(render_offset);
 	if (ar.version >= 2 && ar.version < 5) { Bit32u old; ar.Serialize(old); }
+	if (ar.mode == DBPArchive::MODE_LOAD) RENDER_ResetLineVersions();
 #else
 	ar.Serialize(Scaler_ChangedLineIndex)
 	ar.Serialize(render_offset);
@@ -23,6 +23,7 @@
 
 #include "dosbox.h"
 #include "render.h"
+#include "dbp_simd.h"
 #include <string.h>
 
 Bit8u Scaler_Aspect[SCALER_MAXHEIGHT];
@@ -49,6 +49,17 @@ static void conc4d(SCALERNAME,SBPP,DBPP,R)(const void *s) {
 	render.scale.cacheRead += render.scale.cachePitch;
 #endif
 	PTYPE * line0=(PTYPE *)(render.scale.outWrite);
+#if !defined(C_DBP_ENABLE_SCALERCACHE) && !defined(WORDS_BIGENDIAN) && DBPP == 32 && SCALERWIDTH == 1 && SCALERHEIGHT == 1 && (SBPP == 8 || SBPP == 9 || SBPP == 15 || SBPP == 16)
+	//DBP: Without scaling and cache this is only a pixel format conversion, use the runtime selected kernel (same result as PMAKE)
+#if SBPP == 8 || SBPP == 9
+	DBP_SIMD.PaletteToXRGB(line0, src, render.src.width, render.pal.lut.b32);
+#elif SBPP == 15
+	DBP_SIMD.RGB15ToXRGB(line0, src, render.src.width);
+#else
+	DBP_SIMD.RGB16ToXRGB(line0, src, render.src.width);
+#endif
+	hadChange = 1;
+#else
 	for (Bits x=render.src.width;x>0;) {
 #ifdef C_DBP_ENABLE_SCALERCACHE
 #if (SBPP == 9)
@@ -141,6 +152,7 @@ static void conc4d(SCALERNAME,SBPP,DBPP,R)(const void *s) {
 #endif //defined(SCALERLINEAR)
 		}
 	}
+#endif
 #if defined(SCALERLINEAR) 
 	Bitu scaleLines = SCALERHEIGHT;
 #else
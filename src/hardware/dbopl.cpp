@@ -95,6 +95,9 @@ namespace DBOPL {
 //Has to fit within 16bit lookuptable
 #define MUL_SH		16
 
+//DBP: Maximum number of samples an operator evaluates at once in the block pipeline
+#define BLOCK_SAMPLES	64
+
 //Check some ranges
 #if ENV_EXTRA > 3
 #error Too many envelope bits
@@ -601,6 +604,127 @@ Bits INLINE Operator::GetSample( Bits modulation ) {
 	}
 }
 
+//DBP: Produces the same envelope values as calling ForwardVolume for each sample
+//Only attack, decay and release step through the samples, off and sustain levels are constant
+//The envelope state is kept in locals because the compiler can't tell the output doesn't alias the members
+//Returns true if the envelope is constant for the whole run (off or sustaining)
+bool Operator::BlockVolume( Bit32u count, Bit32u* vol ) {
+	const Bit32u level = currentLevel;
+	Bit32s env = volume;
+	Bit32u rate = rateIndex;
+	switch ( state ) {
+	case OFF:
+		vol[0] = level + ENV_MAX;
+		return true;
+	case SUSTAIN:
+		if ( reg20 & MASK_SUSTAIN ) {
+			vol[0] = level + env;
+			return true;
+		}
+		break;
+	}
+	Bit32u i = 0;
+	while ( i < count ) {
+		switch ( state ) {
+		case OFF:
+			for ( ; i < count; i++ )
+				vol[i] = level + ENV_MAX;
+			break;
+		case ATTACK:
+			for ( const Bit32u add = attackAdd; i < count; i++ ) {
+				rate += add;
+				Bit32s change = rate >> RATE_SH;
+				rate &= RATE_MASK;
+				if ( change ) {
+					env += ( (~env) * change ) >> 3;
+					if ( env < ENV_MIN ) {
+						env = ENV_MIN;
+						rate = 0;
+						SetState( DECAY );
+						vol[i++] = level + ENV_MIN;
+						break;
+					}
+				}
+				vol[i] = level + env;
+			}
+			break;
+		case DECAY:
+			for ( const Bit32u add = decayAdd; i < count; i++ ) {
+				rate += add;
+				env += rate >> RATE_SH;
+				rate &= RATE_MASK;
+				if ( GCC_UNLIKELY(env >= sustainLevel) ) {
+					if ( GCC_UNLIKELY(env >= ENV_MAX) ) {
+						env = ENV_MAX;
+						SetState( OFF );
+					} else {
+						rate = 0;
+						SetState( SUSTAIN );
+					}
+					vol[i++] = level + env;
+					break;
+				}
+				vol[i] = level + env;
+			}
+			break;
+		case SUSTAIN:
+			if ( reg20 & MASK_SUSTAIN ) {
+				for ( ; i < count; i++ )
+					vol[i] = level + env;
+				break;
+			}
+			//In sustain phase, but not sustaining, do regular release
+			/* FALLTHROUGH */
+		case RELEASE:
+			for ( const Bit32u add = releaseAdd; i < count; i++ ) {
+				rate += add;
+				env += rate >> RATE_SH;
+				rate &= RATE_MASK;
+				if ( GCC_UNLIKELY(env >= ENV_MAX) ) {
+					env = ENV_MAX;
+					SetState( OFF );
+					vol[i++] = level + ENV_MAX;
+					break;
+				}
+				vol[i] = level + env;
+			}
+			break;
+		}
+	}
+	volume = env;
+	rateIndex = rate;
+	return false;
+}
+
+//DBP: Operator state for a run of samples, the envelope of the whole run is evaluated up front into vol
+//Get then only needs to advance the phase and look up the wave, same as GetSample does
+//The volumes live outside of this so the phase counter can stay in a register while the output is written
+struct BlockOperator {
+	Operator* op;
+	const Bit32u* vol;
+	Bit32u phase, add;
+
+	INLINE void Start( Operator* o, Bit32u count, Bit32u* volbuf ) {
+		op = o;
+		vol = volbuf;
+		phase = o->waveIndex;
+		add = o->waveCurrent;
+		o->waveIndex = phase + add * count;
+		if ( o->BlockVolume( count, volbuf ) ) {
+			for ( Bit32u i = 1; i < count; i++ )
+				volbuf[i] = volbuf[0];
+		}
+	}
+
+	INLINE Bits Get( Bitu i, Bits modulation ) {
+		phase += add;
+		Bitu v = vol[i];
+		if ( ENV_SILENT( v ) )
+			return 0;
+		return op->GetWave( ( phase >> WAVE_SH ) + modulation, v );
+	}
+};
+
 Operator::Operator() {
 	chanData = 0;
 	freqMul = 0;
@@ -897,61 +1021,81 @@ Channel* Channel::BlockTemplate( Chip* chip, Bit32u samples, Bit32s* output ) {
 		Op( 4 )->Prepare( chip );
 		Op( 5 )->Prepare( chip );
 	}
-	for ( Bitu i = 0; i < samples; i++ ) {
-		//Early out for percussion handlers
-		if ( mode == sm2Percussion ) {
-			GeneratePercussion<false>( chip, output + i );
-			continue;	//Prevent some unitialized value bitching
-		} else if ( mode == sm3Percussion ) {
-			GeneratePercussion<true>( chip, output + i * 2 );
-			continue;	//Prevent some unitialized value bitching
+	//Early out for percussion handlers
+	if ( mode == sm2Percussion || mode == sm3Percussion ) {
+		for ( Bitu i = 0; i < samples; i++ ) {
+			if ( mode == sm2Percussion ) {
+				GeneratePercussion<false>( chip, output + i );
+			} else {
+				GeneratePercussion<true>( chip, output + i * 2 );
+			}
 		}
-
-		//Do unsigned shift so we can shift out all bits but still stay in 10 bit range otherwise
-		Bit32s mod = (Bit32u)((old[0] + old[1])) >> feedback;
-		old[0] = old[1];
-		old[1] = Op(0)->GetSample( mod );
-		Bit32s sample;
-		Bit32s out0 = old[0];
-		if ( mode == sm2AM || mode == sm3AM ) {
-			sample = out0 + Op(1)->GetSample( 0 );
-		} else if ( mode == sm2FM || mode == sm3FM ) {
-			sample = Op(1)->GetSample( out0 );
-		} else if ( mode == sm3FMFM ) {
-			Bits next = Op(1)->GetSample( out0 ); 
-			next = Op(2)->GetSample( next );
-			sample = Op(3)->GetSample( next );
-		} else if ( mode == sm3AMFM ) {
-			sample = out0;
-			Bits next = Op(1)->GetSample( 0 ); 
-			next = Op(2)->GetSample( next );
-			sample += Op(3)->GetSample( next );
-		} else if ( mode == sm3FMAM ) {
-			sample = Op(1)->GetSample( out0 );
-			Bits next = Op(2)->GetSample( 0 );
-			sample += Op(3)->GetSample( next );
-		} else if ( mode == sm3AMAM ) {
-			sample = out0;
-			Bits next = Op(1)->GetSample( 0 ); 
-			sample += Op(2)->GetSample( next );
-			sample += Op(3)->GetSample( 0 );
+		samples = 0;
+	}
+
+	//DBP: The envelope of an operator doesn't depend on the other operators of the channel
+	//So it gets evaluated for a run of samples at once and the sample loop only does the phase and wave lookups
+	BlockOperator bop[ 4 ];
+	Bit32u vol[ 4 ][ BLOCK_SAMPLES ];
+	Bit32u count;
+	for ( Bit32u done = 0; done < samples; done += count ) {
+		count = ( samples - done < BLOCK_SAMPLES ? samples - done : BLOCK_SAMPLES );
+		bop[0].Start( Op(0), count, vol[0] );
+		bop[1].Start( Op(1), count, vol[1] );
+		if ( mode > sm4Start ) {
+			bop[2].Start( Op(2), count, vol[2] );
+			bop[3].Start( Op(3), count, vol[3] );
 		}
-		switch( mode ) {
-		case sm2AM:
-		case sm2FM:
-			output[ i ] += sample;
-			break;
-		case sm3AM:
-		case sm3FM:
-		case sm3FMFM:
-		case sm3AMFM:
-		case sm3FMAM:
-		case sm3AMAM:
-			output[ i * 2 + 0 ] += sample & maskLeft;
-			output[ i * 2 + 1 ] += sample & maskRight;
-			break;
-		default:break; //DBP: Avoid warnings
+		Bit32s old0 = old[0], old1 = old[1];
+		for ( Bitu j = 0, i = done; j < count; j++, i++ ) {
+			//Do unsigned shift so we can shift out all bits but still stay in 10 bit range otherwise
+			Bit32s mod = (Bit32u)((old0 + old1)) >> feedback;
+			old0 = old1;
+			old1 = bop[0].Get( j, mod );
+			Bit32s sample;
+			Bit32s out0 = old0;
+			if ( mode == sm2AM || mode == sm3AM ) {
+				sample = out0 + bop[1].Get( j, 0 );
+			} else if ( mode == sm2FM || mode == sm3FM ) {
+				sample = bop[1].Get( j, out0 );
+			} else if ( mode == sm3FMFM ) {
+				Bits next = bop[1].Get( j, out0 );
+				next = bop[2].Get( j, next );
+				sample = bop[3].Get( j, next );
+			} else if ( mode == sm3AMFM ) {
+				sample = out0;
+				Bits next = bop[1].Get( j, 0 );
+				next = bop[2].Get( j, next );
+				sample += bop[3].Get( j, next );
+			} else if ( mode == sm3FMAM ) {
+				sample = bop[1].Get( j, out0 );
+				Bits next = bop[2].Get( j, 0 );
+				sample += bop[3].Get( j, next );
+			} else if ( mode == sm3AMAM ) {
+				sample = out0;
+				Bits next = bop[1].Get( j, 0 );
+				sample += bop[2].Get( j, next );
+				sample += bop[3].Get( j, 0 );
+			}
+			switch( mode ) {
+			case sm2AM:
+			case sm2FM:
+				output[ i ] += sample;
+				break;
+			case sm3AM:
+			case sm3FM:
+			case sm3FMFM:
+			case sm3AMFM:
+			case sm3FMAM:
+			case sm3AMAM:
+				output[ i * 2 + 0 ] += sample & maskLeft;
+				output[ i * 2 + 1 ] += sample & maskRight;
+				break;
+			default:break; //DBP: Avoid warnings
+			}
 		}
+		old[0] = old0;
+		old[1] = old1;
 	}
 	switch( mode ) {
 	case sm2AM:
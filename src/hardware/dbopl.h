@@ -151,6 +151,9 @@ public:
 
 	Bits GetSample( Bits modulation );
 	Bits GetWave( Bitu index, Bitu vol );
+
+	//DBP: Evaluate the envelope for a run of samples at once, returns true if only vol[0] was filled because it stays constant
+	bool BlockVolume( Bit32u count, Bit32u* vol );
 public:
 	Operator();
 };
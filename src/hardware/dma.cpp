@@ -25,6 +25,7 @@
 #include "pic.h"
 #include "paging.h"
 #include "setup.h"
+#include "dbp_audiolog.h"
 
 DmaController *DmaControllers[2];
 
@@ -286,6 +287,7 @@ DmaChannel::DmaChannel(Bit8u num, bool dma16) {
 
 Bitu DmaChannel::Read(Bitu want, Bit8u * buffer) {
 	Bitu done=0;
+	Bit8u * start=buffer;
 	curraddr &= dma_wrapping;
 again:
 	Bitu left=(currcnt+1);
@@ -313,6 +315,7 @@ again:
 			DoCallBack(DMA_MASKED);
 		}
 	}
+	if (GCC_UNLIKELY(DBP_AudioLog_Recording || DBP_AudioLog_Replaying)) DBP_AudioLog_DmaRead(channum, start, done << DMA16);
 	return done;
 }
 
@@ -29,6 +29,7 @@
 #include "shell.h"
 #include "math.h"
 #include "regs.h"
+#include "dbp_memstats.h"
 using namespace std;
 
 //Extra bits of precision over normal gus
@@ -816,8 +817,8 @@ public:
 		if(!section->Get_bool("gus")) return;
 	
 		memset(&myGUS,0,sizeof(myGUS));
-		GUSRam = new Bit8u[GUSRAM_SIZE];
-		memset(GUSRam,0,GUSRAM_SIZE);
+		GUSRam = (Bit8u*)calloc(GUSRAM_SIZE, 1); // only committed when samples get uploaded, like MemBase
+		DBP_MemStats_Alloc(DBPMEM_GUS, GUSRAM_SIZE);
 	
 		myGUS.portbase = section->Get_hex("gusbase") - 0x200;
 		int dma_val = section->Get_int("gusdma");
@@ -898,7 +899,8 @@ public:
 		}
 
 		memset(&myGUS,0,sizeof(myGUS));
-		delete[] GUSRam;
+		if (GUSRam) DBP_MemStats_Free(DBPMEM_GUS, GUSRAM_SIZE);
+		free(GUSRam);
 		GUSRam = NULL;
 		//DBP: Added cleanup for restart support
 		gus_chan=0;
@@ -2515,14 +2515,11 @@ static void IDE_DelayedCommand(Bitu dev_idx/*which IDE device*/) {
 				if ((512*ata->multiple_sector_count) > sizeof(ata->sector))
 					E_Exit("SECTOR OVERFLOW");
 
-				for (unsigned int cc=0;cc < IDEMIN((Bitu)ata->multiple_sector_count,(Bitu)sectcount);cc++) {
-					/* it would be great if the disk object had a "read multiple sectors" member function */
-					if (disk->Read_AbsoluteSector(sectorn+cc, ata->sector+(cc*512)) != 0) {
-						LOG_MSG("ATA read failed");
-						ata->abort_error();
-						dev->raise_irq();
-						return;
-					}
+				if (disk->Read_AbsoluteSectors(sectorn, (Bit32u)IDEMIN((Bitu)ata->multiple_sector_count,(Bitu)sectcount), ata->sector) != 0) {
+					LOG_MSG("ATA read failed");
+					ata->abort_error();
+					dev->raise_irq();
+					return;
 				}
 
 				/* NTS: the way this command works is that the drive reads ONE sector, then fires the IRQ
@@ -2581,14 +2578,11 @@ static void IDE_DelayedCommand(Bitu dev_idx/*which IDE device*/) {
 						((unsigned int)ata->lba[0] - 1));
 				}
 
-				for (unsigned int cc=0;cc < IDEMIN((Bitu)ata->multiple_sector_count,(Bitu)sectcount);cc++) {
-					/* it would be great if the disk object had a "write multiple sectors" member function */
-					if (disk->Write_AbsoluteSector(sectorn+cc, ata->sector+(cc*512)) != 0) {
-						LOG_MSG("Failed to write sector");
-						ata->abort_error();
-						dev->raise_irq();
-						return;
-					}
+				if (disk->Write_AbsoluteSectors(sectorn, (Bit32u)IDEMIN((Bitu)ata->multiple_sector_count,(Bitu)sectcount), ata->sector) != 0) {
+					LOG_MSG("Failed to write sector");
+					ata->abort_error();
+					dev->raise_irq();
+					return;
 				}
 
 				for (unsigned int cc=0;cc < IDEMIN((Bitu)ata->multiple_sector_count,(Bitu)sectcount);cc++) {
@@ -24,6 +24,7 @@
 #include "cpu.h"
 #include "../src/cpu/lazyflags.h"
 #include "callback.h"
+#include "dbp_audiolog.h"
 
 /*
   DBP: Added replacement of IOFaultCore with fake I/O code from DOSBox-X by Jonathan Campbell
@@ -305,6 +306,8 @@ void log_io(Bitu width, bool write, Bitu port, Bitu val) {
 
 void IO_WriteB(Bitu port,Bitu val) {
 	log_io(0, true, port, val);
+	if (GCC_UNLIKELY(DBP_AudioLog_Recording)) DBP_AudioLog_PortWrite(port, val, 1);
+	if (GCC_UNLIKELY(DBP_AudioLog_Replaying) && DBP_AudioLog_IsGuestAccessBlocked(port, val, false)) return;
 	if (GCC_UNLIKELY(GETFLAG(VM) && (CPU_IO_Exception(port,1)))) {
 #ifdef C_DBP_OLD_IO_FAULT_QUEUE
 		LazyFlags old_lflags;
@@ -348,6 +351,8 @@ void IO_WriteB(Bitu port,Bitu val) {
 
 void IO_WriteW(Bitu port,Bitu val) {
 	log_io(1, true, port, val);
+	if (GCC_UNLIKELY(DBP_AudioLog_Recording)) DBP_AudioLog_PortWrite(port, val, 2);
+	if (GCC_UNLIKELY(DBP_AudioLog_Replaying) && DBP_AudioLog_IsGuestAccessBlocked(port, val, false)) return;
 	if (GCC_UNLIKELY(GETFLAG(VM) && (CPU_IO_Exception(port,2)))) {
 #ifdef C_DBP_OLD_IO_FAULT_QUEUE
 		LazyFlags old_lflags;
@@ -391,6 +396,8 @@ void IO_WriteW(Bitu port,Bitu val) {
 
 void IO_WriteD(Bitu port,Bitu val) {
 	log_io(2, true, port, val);
+	if (GCC_UNLIKELY(DBP_AudioLog_Recording)) DBP_AudioLog_PortWrite(port, val, 4);
+	if (GCC_UNLIKELY(DBP_AudioLog_Replaying) && DBP_AudioLog_IsGuestAccessBlocked(port, val, false)) return;
 	if (GCC_UNLIKELY(GETFLAG(VM) && (CPU_IO_Exception(port,4)))) {
 #ifdef C_DBP_OLD_IO_FAULT_QUEUE
 		LazyFlags old_lflags;
@@ -431,6 +438,7 @@ void IO_WriteD(Bitu port,Bitu val) {
 
 Bitu IO_ReadB(Bitu port) {
 	Bitu retval;
+	if (GCC_UNLIKELY(DBP_AudioLog_Replaying) && DBP_AudioLog_IsGuestAccessBlocked(port, 0, true)) return 0xff;
 	if (GCC_UNLIKELY(GETFLAG(VM) && (CPU_IO_Exception(port,1)))) {
 #ifdef C_DBP_OLD_IO_FAULT_QUEUE
 		LazyFlags old_lflags;
@@ -477,6 +485,7 @@ Bitu IO_ReadB(Bitu port) {
 
 Bitu IO_ReadW(Bitu port) {
 	Bitu retval;
+	if (GCC_UNLIKELY(DBP_AudioLog_Replaying) && DBP_AudioLog_IsGuestAccessBlocked(port, 0, true)) return 0xffff;
 	if (GCC_UNLIKELY(GETFLAG(VM) && (CPU_IO_Exception(port,2)))) {
 #ifdef C_DBP_OLD_IO_FAULT_QUEUE
 		LazyFlags old_lflags;
@@ -522,6 +531,7 @@ Bitu IO_ReadW(Bitu port) {
 
 Bitu IO_ReadD(Bitu port) {
 	Bitu retval;
+	if (GCC_UNLIKELY(DBP_AudioLog_Replaying) && DBP_AudioLog_IsGuestAccessBlocked(port, 0, true)) return 0xffffffff;
 	if (GCC_UNLIKELY(GETFLAG(VM) && (CPU_IO_Exception(port,4)))) {
 #ifdef C_DBP_OLD_IO_FAULT_QUEUE
 		LazyFlags old_lflags;
@@ -24,6 +24,8 @@
 #include "mem.h"
 #include "mixer.h"
 #include "timer.h"
+#include "cpu.h"
+#include "regs.h"
 
 #define KEYBUFSIZE 32
 #define KEYDELAY 0.300f			//Considering 20-30 khz serial clock and 11 bits/char
@@ -102,6 +104,7 @@ static Bitu read_p60(Bitu /*port*/,Bitu /*iolen*/) {
 		keyb.scheduled = true;
 		PIC_AddEvent(KEYBOARD_TransferBuffer,KEYDELAY);
 	}
+	if (CPU_SkipPolling) CPU_PollingCheck(SegPhys(cs),reg_eip,0x60,keyb.p60data,0xFFFFFF00,0);
 	return keyb.p60data;
 }
 
@@ -234,6 +237,7 @@ static void write_p64(Bitu /*port*/,Bitu val,Bitu /*iolen*/) {
 
 static Bitu read_p64(Bitu /*port*/,Bitu /*iolen*/) {
 	Bit8u status = 0x1c | (keyb.p60changed ? 0x1 : 0x0);
+	if (CPU_SkipPolling) CPU_PollingCheck(SegPhys(cs),reg_eip,0x64,status,0xFFFFFF00,0);
 	return status;
 }
 
@@ -23,6 +23,7 @@
 #include "setup.h"
 #include "paging.h"
 #include "regs.h"
+#include "dbp_memstats.h"
 
 #include <string.h>
 
@@ -566,6 +567,7 @@ class MEMORY:public Module_base{
 private:
 	IO_ReadHandleObject ReadHandler;
 	IO_WriteHandleObject WriteHandler;
+	size_t memstat_size;
 public:	
 	MEMORY(Section* configuration):Module_base(configuration){
 		Bitu i;
@@ -586,11 +588,11 @@ public:
 			LOG_MSG("Stick with the default values unless you are absolutely certain.");
 		}
 #endif
-		MemBase = new(std::nothrow) Bit8u[memsize*1024*1024];
+		//DBP: Use calloc instead of new and memset, large zeroed allocations are mapped by the OS on demand
+		//     which means memory never touched by the emulated machine doesn't get committed.
+		MemBase = (HostPt)calloc(memsize*1024*1024, 1);
 		if (!MemBase) E_Exit("Can't allocate main memory of %" sBitfs(d) " MB",memsize);
-		/* Clear the memory, as new doesn't always give zeroed memory
-		 * (Visual C debug mode). We want zeroed memory though. */
-		memset((void*)MemBase,0,memsize*1024*1024);
+		DBP_MemStats_Alloc(DBPMEM_RAM, (memstat_size = memsize*1024*1024 + (memsize*1024*1024/4096)*(sizeof(PageHandler*)+sizeof(MemHandle))));
 		memory.pages = (memsize*1024*1024)/4096;
 		/* Allocate the data for the different page information blocks */
 		memory.phandlers=new  PageHandler * [memory.pages];
@@ -622,7 +624,8 @@ public:
 		MEM_A20_Enable(false);
 	}
 	~MEMORY(){
-		delete [] MemBase;
+		DBP_MemStats_Free(DBPMEM_RAM, memstat_size);
+		free(MemBase);
 		delete [] memory.phandlers;
 		delete [] memory.mhandles;
 	}
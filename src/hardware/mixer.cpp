@@ -26,6 +26,7 @@
 #include <string.h>
 #include <sys/types.h>
 #include <math.h>
+#include <atomic>
 
 #ifdef C_DBP_NATIVE_MIDI
 #if defined (WIN32)
@@ -53,6 +54,11 @@
 #include "hardware.h"
 #include "programs.h"
 #include "midi.h"
+#include "dbp_memstats.h"
+#include "dbp_profiler.h"
+#include "dbp_audiolog.h"
+#include "dbp_threads.h"
+#include "dbp_simd.h"
 
 #define MIXER_SSIZE 4
 
@@ -101,6 +107,17 @@ static struct {
 
 Bit8u MixTemp[MIXER_BUFSIZE];
 
+// Single producer (emulation thread) single consumer (frontend thread) ring of mixed output samples
+// Used with variable latency so the frontend can take audio without pausing the emulation thread
+static struct {
+	Bit16s frames[MIXER_BUFSIZE][2];
+	std::atomic<Bit32u> write, read;
+	std::atomic<Bit32u> want;
+	std::atomic<bool> waiting;
+	Semaphore sem;
+	bool enabled;
+} mixer_ring;
+
 MixerChannel * MIXER_AddChannel(MIXER_Handler handler,Bitu freq,const char * name) {
 	MixerChannel * chan=new MixerChannel();
 	chan->scale = 1.0;
@@ -497,6 +514,7 @@ static Bit32u calc_tickadd(Bit32u freq) {
 
 /* Mix a certain amount of new samples */
 static void MIXER_MixData(Bitu needed) {
+	if (GCC_UNLIKELY(DBP_AudioLog_Replaying)) DBP_AudioLog_MixBegin();
 	MixerChannel * chan=mixer.channels;
 	while (chan) {
 		chan->Mix(needed);
@@ -519,15 +537,67 @@ static void MIXER_MixData(Bitu needed) {
 		CAPTURE_AddWave( mixer.freq, added, (Bit16s*)convert );
 	}
 #endif
+	if (GCC_UNLIKELY(DBP_AudioLog_Replaying)) {
+		Bit16s convert[1024][2];
+		for (Bitu readpos=(mixer.pos+mixer.done)&MIXER_BUFMASK, left=needed-mixer.done; left;) {
+			Bitu added=(left>1024 ? 1024 : left);
+			for (Bitu i=0;i<added;i++) {
+				Bits sample=mixer.work[readpos][0] >> MIXER_VOLSHIFT;
+				convert[i][0]=MIXER_CLIP(sample);
+				sample=mixer.work[readpos][1] >> MIXER_VOLSHIFT;
+				convert[i][1]=MIXER_CLIP(sample);
+				readpos=(readpos+1)&MIXER_BUFMASK;
+			}
+			DBP_AudioLog_MixEnd((Bit16s*)convert, added, mixer.freq);
+			left-=added;
+		}
+	}
 	//Reset the the tick_add for constant speed
 	if( Mixer_irq_important() )
 		mixer.tick_add = calc_tickadd(mixer.freq);
 	mixer.done = needed;
 }
 
+static void MIXER_PushRing(void) {
+	Bitu count = mixer.done;
+	for (MixerChannel * chan=mixer.channels;chan;chan=chan->next) {
+		if (chan->done>count) chan->done-=count;
+		else chan->done=0;
+	}
+	mixer.done = 0;
+	mixer.needed -= count;
+	mixer.tick_add = calc_tickadd(mixer.freq);
+
+	// Drop samples when the frontend isn't taking them fast enough (same limit as MIXER_CallBack)
+	Bit32u write = mixer_ring.write.load(std::memory_order_relaxed);
+	Bit32u level = write - mixer_ring.read.load(std::memory_order_acquire);
+	Bitu space = (level < mixer.max_needed ? mixer.max_needed - level : 0);
+	for (Bitu pos = mixer.pos, i = 0; i != count;) {
+		// Convert in runs that don't cross the wrap of either buffer
+		Bitu ringpos = (write + i) & MIXER_BUFMASK, run = count - i;
+		if (run > MIXER_BUFSIZE - pos) run = MIXER_BUFSIZE - pos;
+		if (i < space) {
+			if (run > space - i) run = space - i;
+			if (run > MIXER_BUFSIZE - ringpos) run = MIXER_BUFSIZE - ringpos;
+			DBP_SIMD.MixToS16(mixer_ring.frames[ringpos], mixer.work[pos], run * 2, MIXER_VOLSHIFT);
+		}
+		else memset(mixer.work[pos], 0, run * sizeof(mixer.work[0]));
+		i += run;
+		pos = (pos + run) & MIXER_BUFMASK;
+	}
+	mixer.pos = (mixer.pos + count) & MIXER_BUFMASK;
+	if (count > space) count = space;
+	if (!count) return;
+	mixer_ring.write.store(write + (Bit32u)count, std::memory_order_seq_cst);
+	if (mixer_ring.waiting.load(std::memory_order_acquire) && level + count >= mixer_ring.want.load(std::memory_order_relaxed) && mixer_ring.waiting.exchange(false))
+		mixer_ring.sem.Post();
+}
+
 static void MIXER_Mix(void) {
+	DBP_ProfilerScope prof(DBPPROF_MIXER);
 	SDL_LockAudio();
 	MIXER_MixData(mixer.needed);
+	if (mixer_ring.enabled) MIXER_PushRing();
 	mixer.tick_counter += mixer.tick_add;
 	mixer.needed+=(mixer.tick_counter >> TICK_SHIFT);
 	mixer.tick_counter &= TICK_MASK;
@@ -535,6 +605,7 @@ static void MIXER_Mix(void) {
 }
 
 static void MIXER_Mix_NoSound(void) {
+	DBP_ProfilerScope prof(DBPPROF_MIXER);
 	MIXER_MixData(mixer.needed);
 	/* Clear piece we've just generated */
 	for (Bitu i=0;i<mixer.needed;i++) {
@@ -657,15 +728,13 @@ MIXER_CallBack(void * /*userdata*/, uint8_t *stream, int len) {
 			pos++;
 		}
 	} else {
-		while (reduce--) {
-			pos &= MIXER_BUFMASK;
-			sample=mixer.work[pos][0]>>MIXER_VOLSHIFT;
-			*output++=MIXER_CLIP(sample);
-			sample=mixer.work[pos][1]>>MIXER_VOLSHIFT;
-			*output++=MIXER_CLIP(sample);
-			mixer.work[pos][0]=0;
-			mixer.work[pos][1]=0;
-			pos++;
+		while (reduce) {
+			Bitu run = MIXER_BUFSIZE - pos;
+			if (run > reduce) run = reduce;
+			DBP_SIMD.MixToS16(output, mixer.work[pos], run * 2, MIXER_VOLSHIFT);
+			output += run * 2;
+			reduce -= run;
+			pos = (pos + run) & MIXER_BUFMASK;
 		}
 	}
 }
@@ -673,6 +742,7 @@ MIXER_CallBack(void * /*userdata*/, uint8_t *stream, int len) {
 #undef INDEX_SHIFT_LOCAL
 
 static void MIXER_Stop(Section* /*sec*/) {
+	DBP_MemStats_Free(DBPMEM_MIXER, sizeof(mixer.work) + sizeof(MixTemp));
 }
 
 class MIXER : public Program {
@@ -762,6 +832,7 @@ MixerObject::~MixerObject(){
 
 void MIXER_Init(Section* sec) {
 	sec->AddDestroyFunction(&MIXER_Stop);
+	DBP_MemStats_Alloc(DBPMEM_MIXER, sizeof(mixer.work) + sizeof(MixTemp));
 
 	Section_prop * section=static_cast<Section_prop *>(sec);
 	/* Read out config section */
@@ -834,6 +905,54 @@ Bit32u DBP_MIXER_DoneSamplesCount()
 	return mixer.done;
 }
 
+void DBP_MIXER_SetOutputRing(bool enable)
+{
+	// Must only be called while the emulation thread is paused
+	if (mixer_ring.enabled == enable) return;
+	mixer_ring.enabled = enable;
+	mixer_ring.read.store(mixer_ring.write.load());
+}
+
+Bit32u DBP_MIXER_OutputRingCount()
+{
+	return mixer_ring.write.load(std::memory_order_acquire) - mixer_ring.read.load(std::memory_order_relaxed);
+}
+
+bool DBP_MIXER_OutputRingWaiting()
+{
+	return mixer_ring.waiting.load(std::memory_order_relaxed);
+}
+
+bool DBP_MIXER_OutputRingWait(Bit32u count)
+{
+	// Blocks until the emulation thread has pushed count samples or DBP_MIXER_OutputRingWake gets called
+	if (count > mixer.max_needed) count = (Bit32u)mixer.max_needed; // ring never fills beyond this
+	if (DBP_MIXER_OutputRingCount() >= count) return true;
+	mixer_ring.want.store(count, std::memory_order_relaxed);
+	mixer_ring.waiting.store(true, std::memory_order_seq_cst);
+	if (DBP_MIXER_OutputRingCount() < count || !mixer_ring.waiting.exchange(false))
+		mixer_ring.sem.Wait(); // either woken up or consume the post the producer made while we checked
+	return (DBP_MIXER_OutputRingCount() >= count);
+}
+
+void DBP_MIXER_OutputRingWake()
+{
+	if (mixer_ring.waiting.exchange(false)) mixer_ring.sem.Post();
+}
+
+Bit32u DBP_MIXER_OutputRingRead(Bit16s* stream, Bit32u count)
+{
+	Bit32u read = mixer_ring.read.load(std::memory_order_relaxed), have = mixer_ring.write.load(std::memory_order_acquire) - read;
+	if (count > have) count = have;
+	for (Bit32u i = 0; i != count; i++, stream += 2) {
+		const Bit16s* in = mixer_ring.frames[(read + i) & MIXER_BUFMASK];
+		stream[0] = in[0];
+		stream[1] = in[1];
+	}
+	mixer_ring.read.store(read + count, std::memory_order_release);
+	return count;
+}
+
 #include <dbp_serialize.h>
 
 DBPArchiveOptional::DBPArchiveOptional(DBPArchive& ar_outer, MixerChannel* chan) : DBPArchiveOptional(ar_outer, chan, (chan && chan->ever_enabled))
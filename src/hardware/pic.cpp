@@ -23,6 +23,7 @@
 #include "pic.h"
 #include "timer.h"
 #include "setup.h"
+#include "dbp_profiler.h"
 
 #define PIC_QUEUESIZE 512
 
@@ -154,6 +155,8 @@ void PIC_Controller::deactivate() {
 
 void PIC_Controller::start_irq(Bit8u val) {
 	irr &= ~(1<<(val));
+	//DBP: PIT 0 skips expiries that can't be observed until IRQ 0 gets acknowledged
+	if (val == 0 && this == &master) TIMER_IRQ0Acknowledged();
 	if (!auto_eoi) {
 		active_irq = val;
 		isr |= 1<<(val);
@@ -359,6 +362,12 @@ void PIC_runIRQs(void) {
 	PIC_IRQCheck = 0;
 }
 
+bool PIC_IsIRQPending(Bitu irq) {
+	Bitu t = irq>7 ? (irq - 8): irq;
+	PIC_Controller * pic=&pics[irq>7 ? 1 : 0];
+	return (pic->irr & (1 << t)) != 0;
+}
+
 void PIC_SetIRQMask(Bitu irq, bool masked) {
 	Bitu t = irq>7 ? (irq - 8): irq;
 	PIC_Controller * pic=&pics[irq>7 ? 1 : 0];
@@ -480,16 +489,19 @@ bool PIC_RunQueue(void) {
 	/* Check the queue for an entry */
 	Bits index_nd=PIC_TickIndexND();
 	InEventService = true;
-	while (pic_queue.next_entry && (pic_queue.next_entry->index*CPU_CycleMax<=index_nd)) {
-		PICEntry * entry=pic_queue.next_entry;
-		pic_queue.next_entry=entry->next;
+	{
+		DBP_ProfilerScope prof(DBPPROF_PICEVENT); // restores the outer context, this can run nested in a timer tick or another event
+		while (pic_queue.next_entry && (pic_queue.next_entry->index*CPU_CycleMax<=index_nd)) {
+			PICEntry * entry=pic_queue.next_entry;
+			pic_queue.next_entry=entry->next;
 
-		srv_lag = entry->index;
-		(entry->pic_event)(entry->value); // call the event handler
+			srv_lag = entry->index;
+			(entry->pic_event)(entry->value); // call the event handler
 
-		/* Put the entry in the free list */
-		entry->next=pic_queue.free_entry;
-		pic_queue.free_entry=entry;
+			/* Put the entry in the free list */
+			entry->next=pic_queue.free_entry;
+			pic_queue.free_entry=entry;
+		}
 	}
 	InEventService = false;
 
@@ -550,6 +562,7 @@ void TIMER_AddTick(void) {
 		entry=entry->next;
 	}
 	/* Call our list of ticker handlers */
+	DBP_ProfilerScope prof(DBPPROF_TIMERTICK);
 	TickerBlock * ticker=firstticker;
 	while (ticker) {
 		TickerBlock * nextticker=ticker->next;
@@ -647,6 +660,7 @@ void DBPSerialize_PIC(DBPArchive& ar)
 	DBP_SERIALIZE_EXTERN_POINTER_LIST(PIC_EventHandler, unionDrive);
 	DBP_SERIALIZE_EXTERN_POINTER_LIST(PIC_EventHandler, IDEController);
 	DBP_SERIALIZE_EXTERN_POINTER_LIST(PIC_EventHandler, Voodoo);
+	DBP_SERIALIZE_EXTERN_POINTER_LIST(PIC_EventHandler, AudioLog);
 
 	float pic_indices[PIC_QUEUESIZE];
 	Bitu pic_values[PIC_QUEUESIZE];
@@ -672,7 +686,7 @@ void DBPSerialize_PIC(DBPArchive& ar)
 	ar.SerializeArray(pics).Serialize(PIC_Ticks).Serialize(PIC_IRQCheck).Serialize(pic_count);
 	ar.SerializeBytes(pic_indices, pic_count * sizeof(*pic_indices));
 	ar.SerializeBytes(pic_values, pic_count * sizeof(*pic_values));
-	ar.SerializePointers((void**)pic_events, pic_count, false, 14,
+	ar.SerializePointers((void**)pic_events, pic_count, false, 15,
 		DBP_SERIALIZE_GET_POINTER_LIST(PIC_EventHandler, VGA),
 		DBP_SERIALIZE_GET_POINTER_LIST(PIC_EventHandler, VGA_Draw),
 		DBP_SERIALIZE_GET_POINTER_LIST(PIC_EventHandler, SERIAL),
@@ -686,7 +700,8 @@ void DBPSerialize_PIC(DBPArchive& ar)
 		DBP_SERIALIZE_GET_POINTER_LIST(PIC_EventHandler, MOUSE),
 		DBP_SERIALIZE_GET_POINTER_LIST(PIC_EventHandler, unionDrive),
 		DBP_SERIALIZE_GET_POINTER_LIST(PIC_EventHandler, IDEController),
-		DBP_SERIALIZE_GET_POINTER_LIST(PIC_EventHandler, Voodoo));
+		DBP_SERIALIZE_GET_POINTER_LIST(PIC_EventHandler, Voodoo),
+		DBP_SERIALIZE_GET_POINTER_LIST(PIC_EventHandler, AudioLog));
 
 	if (pic_count < 16)
 	{
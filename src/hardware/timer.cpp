@@ -65,19 +65,49 @@ static Bit8u latched_timerstatus;
 // reprogrammed.
 static bool latched_timerstatus_locked;
 
-static void PIT0_Event(Bitu /*val*/) {
+// Number of periods covered by the scheduled PIT 0 event if it is coalescing expiries (0 if not)
+static Bit32u pit0_coalesced;
+
+static void PIT0_Event(Bitu val) {
+	// If the previous request hasn't been acknowledged yet (IRQ 0 masked, interrupts disabled or the handler
+	// not keeping up with the rate), raising it again has no effect and this expiry can't be observed
+	const bool unacknowledged = PIC_IsIRQPending(0);
 	PIC_ActivateIRQ(0);
 	if (pit[0].mode != 0) {
-		pit[0].start += pit[0].delay;
+		// val is the number of periods this event covered (0 is the same as 1)
+		pit[0].start += (val > 1 ? pit[0].delay * val : pit[0].delay);
 
 		if (GCC_UNLIKELY(pit[0].update_count)) {
 			pit[0].delay=(1000.0f/((float)PIT_TICK_RATE/(float)pit[0].cntr));
 			pit[0].update_count=false;
 		}
-		PIC_AddEvent(PIT0_Event,pit[0].delay);
+
+		// Until IRQ 0 gets acknowledged, further expiries have no observable effect either (counter reads
+		// are calculated from start) so service all expiries up to the next millisecond with a single event.
+		// Once acknowledged, the event gets realigned to the next period boundary (see PIT0_EndCoalescing).
+		Bit32u periods = 1;
+		if (unacknowledged && pit[0].delay < 0.5f) periods = (Bit32u)(1.0f / pit[0].delay);
+		pit0_coalesced = (periods > 1 ? periods : 0);
+		PIC_AddEvent(PIT0_Event,pit[0].delay * periods,periods);
 	}
 }
 
+static void PIT0_EndCoalescing() {
+	// Reschedule the coalescing event to the next period boundary
+	if (!pit0_coalesced || pit[0].mode == 0) return;
+	double now = PIC_FullIndex();
+	double passed = floor((now - pit[0].start) / pit[0].delay);
+	if (passed > pit0_coalesced - 1) passed = pit0_coalesced - 1;
+	if (passed > 0) pit[0].start += pit[0].delay * passed;
+	pit0_coalesced = 0;
+	PIC_RemoveEvents(PIT0_Event);
+	PIC_AddEvent(PIT0_Event,(float)(pit[0].start + pit[0].delay - now));
+}
+
+void TIMER_IRQ0Acknowledged(void) {
+	PIT0_EndCoalescing();
+}
+
 static bool counter_output(Bitu counter) {
 	PIT_Block * p=&pit[counter];
 	double index=PIC_FullIndex()-p->start;
@@ -228,8 +258,10 @@ static void write_latch(Bitu port,Bitu val,Bitu /*iolen*/) {
 			// until the old one has run out. This might apply to other modes too.
 			// This is not fixed for PIT2 yet!!
 			p->update_count=true;
+			PIT0_EndCoalescing(); // apply at the next expiry
 			return;
 		}
+		if (counter == 0) PIT0_EndCoalescing();
 		p->start=PIC_FullIndex();
 		p->delay=(1000.0f/((float)PIT_TICK_RATE/(float)p->cntr));
 
@@ -238,6 +270,7 @@ static void write_latch(Bitu port,Bitu val,Bitu /*iolen*/) {
 			if (p->new_mode || p->mode == 0 ) {
 				if(p->mode==0) PIC_RemoveEvents(PIT0_Event); // DoWhackaDo demo
 				PIC_AddEvent(PIT0_Event,p->delay);
+				pit0_coalesced = 0;
 			} else LOG(LOG_PIT,LOG_NORMAL)("PIT 0 Timer set without new control word");
 			LOG(LOG_PIT,LOG_NORMAL)("PIT 0 Timer at %.4f Hz mode %d",1000.0/p->delay,p->mode);
 			break;
@@ -340,6 +373,7 @@ static void write_p43(Bitu /*port*/,Bitu val,Bitu /*iolen*/) {
 
 			if (latch == 0) {
 				PIC_RemoveEvents(PIT0_Event);
+				pit0_coalesced = 0;
 				if((mode != 0)&& !old_output) {
 					PIC_ActivateIRQ(0);
 				} else {
@@ -457,6 +491,7 @@ public:
 		latched_timerstatus_locked=false;
 		gate2 = false;
 		PIC_AddEvent(PIT0_Event,pit[0].delay);
+		pit0_coalesced = 0;
 	}
 	~TIMER(){
 		PIC_RemoveEvents(PIT0_Event);
@@ -479,4 +514,7 @@ DBP_SERIALIZE_SET_POINTER_LIST(PIC_EventHandler, TIMER, PIT0_Event);
 void DBPSerialize_Timer(DBPArchive& ar)
 {
 	ar.SerializeArray(pit) << gate2 << latched_timerstatus << latched_timerstatus_locked;
+
+	// The number of coalesced periods is stored in the event value, assume the maximum (clamped when realigning)
+	if (ar.mode == DBPArchive::MODE_LOAD) pit0_coalesced = (pit[0].mode != 0 && !pit[0].new_mode ? 0xFFFFFFFF : 0);
 }
@@ -26,6 +26,7 @@
 #include "pic.h"
 #include "inout.h"
 #include "setup.h"
+#include "dbp_memstats.h"
 
 
 #ifndef C_VGARAM_CHECKED
@@ -939,12 +940,16 @@ void VGA_StartUpdateLFB(void) {
 	MEM_SetLFB(vga.s3.la_window << 4 ,vga.vmemsize/4096, vga.lfb.handler, &vgaph.mmio);
 }
 
+static Bit32u vga_memstats_size;
+
 static void VGA_Memory_ShutDown(Section * /*sec*/) {
+	DBP_MemStats_Free(DBPMEM_VGA, vga_memstats_size);
+	vga_memstats_size = 0;
 #ifndef C_DBP_LIBRETRO
 	delete[] vga.mem.linear_orgptr;
 	delete[] vga.fastmem_orgptr;
 #else
-	delete[] vga.mem.linear_orgptr;
+	free(vga.mem.linear_orgptr);
 #endif
 #ifdef VGA_KEEP_CHANGES
 	delete[] vga.changes.map;
@@ -974,8 +979,8 @@ void VGA_SetupMemory(Section* sec) {
 	Bit32u vga_fastmemofs = vga_allocsize;
 	vga_allocsize+=(vga.vmemsize<<1)+4096+16;
 
-	vga.mem.linear_orgptr = new Bit8u[vga_allocsize];
-	memset(vga.mem.linear_orgptr,0,vga_allocsize);
+	vga.mem.linear_orgptr = (Bit8u*)calloc(vga_allocsize, 1); // only committed when used, like MemBase
+	DBP_MemStats_Alloc(DBPMEM_VGA, (vga_memstats_size = vga_allocsize));
 
 	vga.mem.linear = (Bit8u*)(((Bitu)vga.mem.linear_orgptr                  + 16-1) & ~(16-1));
 	vga.fastmem    = (Bit8u*)(((Bitu)vga.mem.linear_orgptr + vga_fastmemofs + 16-1) & ~(16-1));
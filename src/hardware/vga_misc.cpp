@@ -21,6 +21,8 @@
 #include "inout.h"
 #include "pic.h"
 #include "vga.h"
+#include "cpu.h"
+#include "regs.h"
 #include <math.h>
 
 
@@ -52,6 +54,19 @@ Bitu vga_read_p3da(Bitu /*port*/,Bitu /*iolen*/) {
 			retval |= 1;
 		}
 	}
+	if (CPU_SkipPolling) {
+		// Let the polling loop detection know when the status can change next
+		double next = vga.draw.delay.vtotal;
+		if (timeInFrame < vga.draw.delay.vrstart) next = vga.draw.delay.vrstart;
+		else if (timeInFrame <= vga.draw.delay.vrend) next = vga.draw.delay.vrend;
+		if (timeInFrame < vga.draw.delay.vdend) {
+			if (vga.draw.delay.vdend < next) next = vga.draw.delay.vdend;
+			double timeInLine=fmod(timeInFrame,vga.draw.delay.htotal);
+			double lineNext=(timeInLine < vga.draw.delay.hblkstart ? vga.draw.delay.hblkstart : (timeInLine <= vga.draw.delay.hblkend ? vga.draw.delay.hblkend : vga.draw.delay.htotal));
+			if (timeInFrame - timeInLine + lineNext < next) next = timeInFrame - timeInLine + lineNext;
+		}
+		CPU_PollingCheck(SegPhys(cs),reg_eip,0x3da,retval,0xFFFFFF00,vga.draw.delay.framestart + next);
+	}
 	return retval;
 }
 
@@ -75,6 +75,9 @@
 #include "pci_bus.h"
 #include "control.h"
 #include "dbp_threads.h"
+#include "dbp_memstats.h"
+#include <chrono>
+#include <atomic>
 
 #ifndef DOSBOX_VOODOO_TYPES_H
 #define DOSBOX_VOODOO_TYPES_H
@@ -275,6 +278,10 @@ enum { TRIANGLE_THREADS = 3, TRIANGLE_WORKERS = TRIANGLE_THREADS + 1 };
 /* maximum number of TMUs */
 #define MAX_TMU					2
 
+/* number of decoded textures cached per TMU and page size of the texture RAM write tracking */
+#define TEXCACHE_ENTRIES		64
+#define TEXCACHE_PAGE_SHIFT		12
+
 #ifdef C_DBP_ENABLE_VOODOO_OPENGL
 /* maximum number of rasterizers */
 #define MAX_RASTERIZERS			1024
@@ -757,6 +764,21 @@ struct ncc_table
 	rgb_t *				palette;				/* pointer to associated RGB palette */
 	rgb_t *				palettea;				/* pointer to associated ARGB palette */
 	rgb_t				texel[256];				/* texel lookup */
+	UINT32				serial;					/* incremented when texel or palette change */
+};
+
+struct texcache_entry
+{
+	const rgb_t *		lookup;					/* lookup used to decode (NULL if entry is unused) */
+	UINT32				lookupserial;			/* NCC/palette serial at decode time */
+	UINT64				ramserial;				/* texture RAM write serial at decode time */
+	UINT32				lodoffset[9];			/* texture RAM offset of each LOD */
+	UINT32				wmask, hmask;			/* texture width/height */
+	UINT8				format, lodlo, lodhi;	/* texture format and decoded LOD range */
+	UINT32				used;					/* tick of last use */
+	UINT32				texeloffset[10];		/* offset of each LOD in texels */
+	UINT32				texelalloc;				/* allocated number of texels */
+	rgb_t *				texels;					/* decoded 32-bit ARGB texels */
 };
 
 struct tmu_state
@@ -798,6 +820,14 @@ struct tmu_state
 
 	rgb_t				palette[256];			/* palette lookup table */
 	rgb_t				palettea[256];			/* palette+alpha lookup table */
+
+	const rgb_t *		decoded;				/* decoded texels of the current texture (or NULL) */
+	const UINT32 *		decodedlod;				/* offset of each LOD in decoded */
+	texcache_entry *	texcache;				/* cache of decoded textures */
+	UINT64 *			texcache_pages;			/* RAM write serial of each texture RAM page */
+	UINT64				texcache_ramserial;		/* incremented on each texture RAM change */
+	UINT32				texcache_tick;			/* incremented on each lookup */
+	texcache_entry *	texcache_last;			/* entry found in the last lookup */
 };
 
 struct tmu_shared_state
@@ -1996,7 +2026,9 @@ do																				\
 		t *= smax + 1;															\
 																				\
 		/* fetch texel data */													\
-		if (TEXMODE_FORMAT(TEXMODE) < 8)										\
+		if ((TT)->decoded)														\
+			c_local.u = (TT)->decoded[(TT)->decodedlod[ilod] + t + s];			\
+		else if (TEXMODE_FORMAT(TEXMODE) < 8)									\
 		{																		\
 			texel0 = *(UINT8 *)&(TT)->ram[(texbase + t + s) & (TT)->mask];		\
 			c_local.u = (LOOKUP)[texel0];										\
@@ -2057,7 +2089,15 @@ do																				\
 		t1 *= smax + 1;															\
 																				\
 		/* fetch texel data */													\
-		if (TEXMODE_FORMAT(TEXMODE) < 8)										\
+		if ((TT)->decoded)														\
+		{																		\
+			const rgb_t *dec = (TT)->decoded + (TT)->decodedlod[ilod];			\
+			texel0 = dec[t + s];												\
+			texel1 = dec[t + s1];												\
+			texel2 = dec[t1 + s];												\
+			texel3 = dec[t1 + s1];												\
+		}																		\
+		else if (TEXMODE_FORMAT(TEXMODE) < 8)									\
 		{																		\
 			texel0 = *(UINT8 *)&(TT)->ram[(texbase + t + s) & (TT)->mask];		\
 			texel1 = *(UINT8 *)&(TT)->ram[(texbase + t + s1) & (TT)->mask];		\
@@ -3015,6 +3055,66 @@ iterated W    = 18.32 [48 bits]
 
 static voodoo_state *v;
 
+/* LFB write mode validated once for runs of consecutive LFB writes */
+static struct lfb_direct_state
+{
+	bool				valid;					/* false if the state needs to be validated again */
+	bool				direct;					/* writes can be stored without the general path */
+	UINT32				lfbmode, fbzmode;		/* register values the state was validated for */
+	UINT32				rowpixels;				/* row stride the state was validated for */
+	UINT16 *			dest;					/* selected RGB buffer */
+	UINT32				destmax;				/* number of pixels in the RGB buffer */
+} lfb_direct;
+
+/* render statistics gathered while the detailed performance display is enabled */
+enum { VOODOO_PERF_STATES = 64, VOODOO_PERF_TOP = 8 };
+struct voodoo_perf_render_state
+{
+	UINT32				hash;					/* hash of the registers below (0 if unused) */
+	UINT32				fbzcp, fbzmode, alphamode, fogmode, texmode0, texmode1;
+	UINT32				triangles;
+	UINT64				pixels;
+};
+struct voodoo_perf_counters
+{
+	UINT32				triangles;				/* triangles rendered */
+	UINT64				pixels_in, pixels_out;	/* pixels rasterized and written */
+	UINT64				zfunc_fail, afunc_fail, chroma_fail;
+	UINT64				raster_usec;			/* wall time spent rasterizing */
+	UINT64				worker_usec;			/* time spent by all workers */
+	UINT32				threaded;				/* triangles split over the worker threads */
+};
+struct voodoo_perf_interval
+{
+	/* added to by the emulation thread, read and cleared by the frontend thread */
+	std::atomic<UINT32>	triangles, threaded;
+	std::atomic<UINT64>	pixels_in, pixels_out, raster_usec, worker_usec;
+};
+struct voodoo_perf_worker
+{
+	/* only written by its own worker while a triangle is rendered, read after all workers are done */
+	stats_block			stats;					/* padded to 64 bytes */
+	UINT64				usec;
+	UINT32				pixels;					/* pixels rasterized, stats.pixels_in only counts clipped ones */
+	UINT8				pad[64 - sizeof(UINT64) - sizeof(UINT32)];	/* keep workers off each other's cache line */
+};
+static struct voodoo_perf_state
+{
+	volatile bool		enabled;				/* set by the frontend thread */
+	std::atomic<bool>	reset;					/* frontend request to clear everything, done on the emulation thread */
+	voodoo_perf_interval interval;
+	voodoo_perf_counters total;					/* emulation thread only, reported after it stopped */
+	voodoo_perf_render_state states[VOODOO_PERF_STATES];
+	voodoo_perf_worker	work[TRIANGLE_WORKERS];	/* statistics of the current triangle per worker */
+	bool				work_timed;				/* current triangle gets measured, set before the workers start */
+	bool				work_threaded;			/* current triangle was split over the threads */
+} voodoo_perf;
+
+static INLINE UINT64 voodoo_perf_usec()
+{
+	return (UINT64)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 /* fast dither lookup */
 static UINT8 dither4_lookup[256*16*2];
 static UINT8 dither2_lookup[256*16*2];
@@ -3591,6 +3691,7 @@ static void init_fbi(voodoo_state *v, fbi_state *f, int fbmem)
 	/* allocate frame buffer RAM and set pointers */
 	DBP_ASSERT(fbmem >= 1); //VOODOO: invalid frame buffer memory size requested
 	f->ram = (UINT8*)malloc(fbmem);
+	DBP_MemStats_Alloc(DBPMEM_VOODOO, (size_t)fbmem);
 	f->mask = (UINT32)(fbmem - 1);
 	f->rgboffs[0] = f->rgboffs[1] = f->rgboffs[2] = 0;
 	f->auxoffs = (UINT32)(~0);
@@ -3677,6 +3778,7 @@ static void init_tmu(voodoo_state *v, tmu_state *t, voodoo_reg *reg, int tmem)
 	if (tmem <= 1) E_Exit("VOODOO: invalid texture buffer memory size requested");
 	/* allocate texture RAM */
 	t->ram = (UINT8*)malloc(tmem);
+	DBP_MemStats_Alloc(DBPMEM_VOODOO, (size_t)tmem);
 	t->mask = (UINT32)(tmem - 1);
 	t->reg = reg;
 	t->regdirty = true;
@@ -3716,6 +3818,16 @@ static void init_tmu(voodoo_state *v, tmu_state *t, voodoo_reg *reg, int tmem)
 
 	t->lodmin=0;
 	t->lodmax=0;
+
+	/* allocate the decoded texture cache and the texture RAM write tracking */
+	t->decoded = NULL;
+	t->texcache = (texcache_entry*)calloc(TEXCACHE_ENTRIES, sizeof(texcache_entry));
+	t->texcache_pages = (UINT64*)calloc((size_t)(tmem >> TEXCACHE_PAGE_SHIFT) + 1, sizeof(UINT64));
+	DBP_MemStats_Alloc(DBPMEM_VOODOO, TEXCACHE_ENTRIES * sizeof(texcache_entry) + ((tmem >> TEXCACHE_PAGE_SHIFT) + 1) * sizeof(UINT64));
+	t->texcache_ramserial = 1;
+	t->texcache_tick = 0;
+	t->texcache_last = t->texcache;
+	t->ncc[0].serial = t->ncc[1].serial = 0;
 }
 
 
@@ -3742,6 +3854,7 @@ static void voodoo_swap_buffers(voodoo_state *v)
 	/* rotate the buffers */
 	if (v->type < VOODOO_2 || !v->fbi.vblank_dont_swap)
 	{
+		lfb_direct.valid = false;
 		if (v->fbi.rgboffs[2] == (UINT32)(~0))
 		{
 			v->fbi.frontbuf = (UINT8)(1 - v->fbi.frontbuf);
@@ -3843,6 +3956,7 @@ static void recompute_video_memory(voodoo_state *v)
 	}
 
 	/* reset our front/back buffers if they are out of range */
+	lfb_direct.valid = false;
 	if (v->fbi.rgboffs[2] == (UINT32)(~0))
 	{
 		if (v->fbi.frontbuf == 2)
@@ -3871,6 +3985,7 @@ static void ncc_table_write(ncc_table *n, UINT32 regnum, UINT32 data)
 		if (n->palette[index] != palette_entry) {
 			/* set the ARGB for this palette index */
 			n->palette[index] = palette_entry;
+			n->serial++;
 #ifdef C_DBP_ENABLE_VOODOO_OPENGL
 			v->ogl_palette_changed = true;
 #endif
@@ -3883,6 +3998,7 @@ static void ncc_table_write(ncc_table *n, UINT32 regnum, UINT32 data)
 			UINT32 r = ((data >> 10) & 0xfc) | ((data >> 16) & 0x03);
 			UINT32 g = ((data >>  4) & 0xfc) | ((data >> 10) & 0x03);
 			UINT32 b = ((data <<  2) & 0xfc) | ((data >>  4) & 0x03);
+			if (n->palettea[index] != MAKE_ARGB(a, r, g, b)) n->serial++;
 			n->palettea[index] = MAKE_ARGB(a, r, g, b);
 		}
 
@@ -3956,6 +4072,7 @@ static void ncc_table_update(ncc_table *n)
 
 	/* no longer dirty */
 	n->dirty = false;
+	n->serial++;
 }
 
 
@@ -4135,6 +4252,148 @@ static void prepare_tmu(tmu_state *t)
 	t->lodbasetemp = (-lodbase + (12 << 8)) / 2;
 }
 
+/*************************************
+ *
+ *  Decoded texture cache
+ *
+ *************************************/
+
+static void texcache_invalidate_ram(tmu_state *t, UINT32 offset)
+{
+	t->texcache_pages[offset >> TEXCACHE_PAGE_SHIFT] = ++t->texcache_ramserial;
+}
+
+static void texcache_reset(tmu_state *t)
+{
+	for (int i = 0; i < TEXCACHE_ENTRIES; i++)
+		t->texcache[i].lookup = NULL;
+	t->decoded = NULL;
+}
+
+static void texcache_free(tmu_state *t)
+{
+	for (int i = 0; i < TEXCACHE_ENTRIES; i++)
+	{
+		free(t->texcache[i].texels);
+		DBP_MemStats_Free(DBPMEM_VOODOO, t->texcache[i].texelalloc * sizeof(rgb_t));
+	}
+	free(t->texcache);
+	free(t->texcache_pages);
+	DBP_MemStats_Free(DBPMEM_VOODOO, TEXCACHE_ENTRIES * sizeof(texcache_entry) + (((t->mask + 1) >> TEXCACHE_PAGE_SHIFT) + 1) * sizeof(UINT64));
+}
+
+static bool texcache_ram_changed(const tmu_state *t, const texcache_entry *e)
+{
+	/* check the write serials of all pages covered by the decoded LODs */
+	UINT32 bppscale = e->format >> 3, pagemask = t->mask >> TEXCACHE_PAGE_SHIFT;
+	for (int lod = e->lodlo; lod <= e->lodhi; lod++)
+	{
+		UINT32 bytes = (((e->wmask >> lod) + 1) * ((e->hmask >> lod) + 1)) << bppscale;
+		UINT32 page = e->lodoffset[lod] >> TEXCACHE_PAGE_SHIFT;
+		UINT32 pageend = (e->lodoffset[lod] + bytes - 1) >> TEXCACHE_PAGE_SHIFT;
+		for (;; page++)
+		{
+			if (t->texcache_pages[page & pagemask] > e->ramserial) return true;
+			if (page == pageend) break;
+		}
+	}
+	return false;
+}
+
+static void texcache_decode(const tmu_state *t, texcache_entry *e)
+{
+	UINT32 count = 0;
+	for (int lod = e->lodlo; lod <= e->lodhi; lod++)
+		count += ((e->wmask >> lod) + 1) * ((e->hmask >> lod) + 1);
+	if (count > e->texelalloc)
+	{
+		DBP_MemStats_Free(DBPMEM_VOODOO, e->texelalloc * sizeof(rgb_t));
+		e->texels = (rgb_t*)realloc(e->texels, count * sizeof(rgb_t));
+		e->texelalloc = count;
+		DBP_MemStats_Alloc(DBPMEM_VOODOO, e->texelalloc * sizeof(rgb_t));
+	}
+
+	/* convert each texel the same way the texture pipeline does */
+	const rgb_t *lookup = e->lookup;
+	rgb_t *out = e->texels;
+	memset(e->texeloffset, 0, sizeof(e->texeloffset));
+	for (int lod = e->lodlo; lod <= e->lodhi; lod++)
+	{
+		UINT32 texbase = e->lodoffset[lod], n = ((e->wmask >> lod) + 1) * ((e->hmask >> lod) + 1);
+		e->texeloffset[lod] = (UINT32)(out - e->texels);
+		if (e->format < 8)
+			for (UINT32 i = 0; i != n; i++)
+				*(out++) = lookup[*(UINT8 *)&t->ram[(texbase + i) & t->mask]];
+		else if (e->format >= 10 && e->format <= 12)
+			for (UINT32 i = 0; i != n; i++)
+				*(out++) = lookup[*(UINT16 *)&t->ram[(texbase + 2*i) & t->mask]];
+		else
+			for (UINT32 i = 0; i != n; i++)
+			{
+				UINT32 texel = *(UINT16 *)&t->ram[(texbase + 2*i) & t->mask];
+				*(out++) = (lookup[texel & 0xff] & 0xffffff) | ((texel & 0xff00) << 16);
+			}
+	}
+}
+
+static void texcache_prepare(tmu_state *t)
+{
+	/* textures of unsupported formats or with out of range LODs are read directly */
+	t->decoded = NULL;
+	INT32 lodlo = (t->lodmin < t->lodmax ? t->lodmin : t->lodmax) >> 8;
+	INT32 lodhi = (t->lodmin < t->lodmax ? t->lodmax : t->lodmin) >> 8;
+	if (!t->lookup || lodlo > 8 || (lodhi >= 8 && !((t->lodmask >> 8) & 1)))
+		return;
+	if (lodhi < 8 && !((t->lodmask >> lodhi) & 1))
+		lodhi++;
+
+	/* textures using NCC or palette lookups also depend on those tables */
+	UINT8 format = (UINT8)TEXMODE_FORMAT(t->reg[textureMode].u);
+	bool dynamiclookup = (t->lookup == t->palette || t->lookup == t->palettea || t->lookup == t->ncc[0].texel || t->lookup == t->ncc[1].texel);
+	UINT32 lookupserial = (dynamiclookup ? t->ncc[0].serial + t->ncc[1].serial : 0);
+	UINT32 tick = ++t->texcache_tick;
+
+	texcache_entry *e = t->texcache_last, *oldest = NULL;
+	for (int i = -1; i < TEXCACHE_ENTRIES; e = &t->texcache[++i])
+	{
+		if (e->lookup == t->lookup && e->format == format && e->lookupserial == lookupserial
+			&& e->wmask == t->wmask && e->hmask == t->hmask && e->lodlo == lodlo && e->lodhi == lodhi
+			&& !memcmp(e->lodoffset, t->lodoffset, sizeof(e->lodoffset)))
+			goto found;
+		if (i >= 0 && (!oldest || !e->lookup || (oldest->lookup && (INT32)(e->used - oldest->used) < 0)))
+			oldest = e;
+	}
+
+	/* not cached, decode into the least recently used entry */
+	e = oldest;
+	e->lookup = t->lookup;
+	e->format = format;
+	e->lookupserial = lookupserial;
+	e->wmask = t->wmask;
+	e->hmask = t->hmask;
+	e->lodlo = (UINT8)lodlo;
+	e->lodhi = (UINT8)lodhi;
+	memcpy(e->lodoffset, t->lodoffset, sizeof(e->lodoffset));
+	e->ramserial = t->texcache_ramserial;
+	texcache_decode(t, e);
+	goto done;
+
+	found:
+	if (e->ramserial != t->texcache_ramserial)
+	{
+		/* texture RAM was written since decoding, decode again if it affected this texture */
+		if (texcache_ram_changed(t, e))
+			texcache_decode(t, e);
+		e->ramserial = t->texcache_ramserial;
+	}
+
+	done:
+	e->used = tick;
+	t->texcache_last = e;
+	t->decoded = e->texels;
+	t->decodedlod = e->texeloffset;
+}
+
 static INLINE INT32 round_coordinate(float value)
 {
 	INT32 result = (INT32)value;
@@ -4190,6 +4449,8 @@ static void update_statistics(voodoo_state *v, bool accumulate)
 
 static void triangle_worker_work(triangle_worker& tworker, INT32 worktstart, INT32 worktend)
 {
+	UINT64 workstart = (voodoo_perf.work_timed ? voodoo_perf_usec() : 0);
+
 	/* determine the number of TMUs involved */
 	UINT32 tmus = 0, texmode0 = 0, texmode1 = 0;
 	if (!FBIINIT3_DISABLE_TMUS(v->reg[fbiInit3].u) && FBZCP_TEXTURE_ENABLE(v->reg[fbzColorPath].u))
@@ -4215,6 +4476,7 @@ static void triangle_worker_work(triangle_worker& tworker, INT32 worktstart, INT
 	float dxdy_v2v3 = (v3.y == v2.y) ? 0.0f : (v3.x - v2.x) / (v3.y - v2.y);
 
 	stats_block my_stats = {0};
+	UINT32 rasterpix = 0;
 	INT32 from = tworker.totalpix * worktstart / TRIANGLE_WORKERS;
 	INT32 to   = tworker.totalpix * worktend   / TRIANGLE_WORKERS;
 	for (INT32 curscan = tworker.v1y, scanend = tworker.v3y, sumpix = 0, lastsum = 0; curscan != scanend && lastsum < to; lastsum = sumpix, curscan++)
@@ -4246,9 +4508,16 @@ static void triangle_worker_work(triangle_worker& tworker, INT32 worktstart, INT
 		if (sumpix > to)
 			extent.stopx -= (sumpix - to);
 
+		rasterpix += (UINT32)(extent.stopx - extent.startx);
 		raster_generic(v, tmus, texmode0, texmode1, tworker.drawbuf, curscan, &extent, my_stats);
 	}
 	sum_statistics(&v->thread_stats[worktstart], &my_stats);
+	if (workstart)
+	{
+		voodoo_perf.work[worktstart].stats = my_stats;
+		voodoo_perf.work[worktstart].usec = voodoo_perf_usec() - workstart;
+		voodoo_perf.work[worktstart].pixels = rasterpix;
+	}
 }
 
 static Thread::RET_t THREAD_CC triangle_worker_thread_func(void* p)
@@ -4259,6 +4528,7 @@ static Thread::RET_t THREAD_CC triangle_worker_thread_func(void* p)
 		tworker.sembegin[tnum].Wait();
 		if (tworker.threads_active)
 			triangle_worker_work(tworker, tnum, tnum + 1);
+		std::atomic_thread_fence(std::memory_order_release); // publish the statistics before signaling done
 		tworker.done[tnum] = true;
 	}
 	return 0;
@@ -4324,9 +4594,82 @@ static void triangle_worker_run(triangle_worker& tworker)
 
 	for (size_t i = 0; i != TRIANGLE_THREADS; i++) tworker.done[i] = false;
 	for (size_t i = 0; i != TRIANGLE_THREADS; i++) tworker.sembegin[i].Post();
+	voodoo_perf.work_threaded = true;
 	triangle_worker_work(tworker, TRIANGLE_THREADS, TRIANGLE_WORKERS);
 	recheckdone:
 	for (size_t i = 0; i != TRIANGLE_THREADS; i++) if (!tworker.done[i]) goto recheckdone;
+	std::atomic_thread_fence(std::memory_order_acquire); // see the statistics written by the workers
+}
+
+/*-------------------------------------------------
+    voodoo_perf_clear - reset all statistics
+    (emulation thread only)
+-------------------------------------------------*/
+static void voodoo_perf_clear()
+{
+	voodoo_perf_interval& iv = voodoo_perf.interval;
+	iv.triangles = 0; iv.threaded = 0; iv.pixels_in = 0; iv.pixels_out = 0; iv.raster_usec = 0; iv.worker_usec = 0;
+	memset(&voodoo_perf.total, 0, sizeof(voodoo_perf.total));
+	memset(voodoo_perf.states, 0, sizeof(voodoo_perf.states));
+}
+
+/*-------------------------------------------------
+    voodoo_perf_add_triangle - accumulate the
+    statistics of the last rendered triangle
+-------------------------------------------------*/
+static void voodoo_perf_add_triangle(voodoo_state *v, UINT64 rasterstart, UINT32 texmode0, UINT32 texmode1)
+{
+	voodoo_perf_counters tri = {0};
+	tri.triangles = 1;
+	tri.raster_usec = voodoo_perf_usec() - rasterstart;
+	for (size_t i = 0; i != TRIANGLE_WORKERS; i++)
+	{
+		const stats_block& s = voodoo_perf.work[i].stats;
+		tri.pixels_in += voodoo_perf.work[i].pixels;
+		tri.pixels_out += s.pixels_out;
+		tri.zfunc_fail += s.zfunc_fail;
+		tri.afunc_fail += s.afunc_fail;
+		tri.chroma_fail += s.chroma_fail;
+		tri.worker_usec += voodoo_perf.work[i].usec;
+	}
+	tri.threaded = (voodoo_perf.work_threaded ? 1 : 0);
+
+	voodoo_perf_counters& c = voodoo_perf.total;
+	c.triangles += tri.triangles; c.pixels_in += tri.pixels_in; c.pixels_out += tri.pixels_out;
+	c.zfunc_fail += tri.zfunc_fail; c.afunc_fail += tri.afunc_fail; c.chroma_fail += tri.chroma_fail;
+	c.raster_usec += tri.raster_usec; c.worker_usec += tri.worker_usec; c.threaded += tri.threaded;
+
+	voodoo_perf_interval& iv = voodoo_perf.interval;
+	iv.triangles.fetch_add(tri.triangles, std::memory_order_relaxed);
+	iv.threaded.fetch_add(tri.threaded, std::memory_order_relaxed);
+	iv.pixels_in.fetch_add(tri.pixels_in, std::memory_order_relaxed);
+	iv.pixels_out.fetch_add(tri.pixels_out, std::memory_order_relaxed);
+	iv.raster_usec.fetch_add(tri.raster_usec, std::memory_order_relaxed);
+	iv.worker_usec.fetch_add(tri.worker_usec, std::memory_order_relaxed);
+
+	/* group by a hash of the raw register values, unlike find_rasterizer (OpenGL build only) which
+	   hashes normalized values into RASTER_HASH_SIZE buckets, so the reported values are what the game set */
+	UINT32 regs[6] = { v->reg[fbzColorPath].u, v->reg[fbzMode].u, v->reg[alphaMode].u, v->reg[fogMode].u, texmode0, texmode1 };
+	UINT32 hash = 0;
+	for (int i = 0; i != 6; i++)
+		hash = ((hash << 1) | (hash >> 31)) ^ regs[i];
+	if (!hash) hash = 1;
+
+	/* find or add the render state, states beyond the table size are not tracked */
+	for (UINT32 n = 0, i = hash % VOODOO_PERF_STATES; n != VOODOO_PERF_STATES; n++, i = (i + 1) % VOODOO_PERF_STATES)
+	{
+		voodoo_perf_render_state& s = voodoo_perf.states[i];
+		if (!s.hash)
+		{
+			s.hash = hash;
+			s.fbzcp = regs[0]; s.fbzmode = regs[1]; s.alphamode = regs[2]; s.fogmode = regs[3]; s.texmode0 = regs[4]; s.texmode1 = regs[5];
+		}
+		else if (s.hash != hash || s.fbzcp != regs[0] || s.fbzmode != regs[1] || s.alphamode != regs[2] || s.fogmode != regs[3] || s.texmode0 != regs[4] || s.texmode1 != regs[5])
+			continue;
+		s.triangles++;
+		s.pixels += tri.pixels_in;
+		break;
+	}
 }
 
 /*-------------------------------------------------
@@ -4516,8 +4859,12 @@ static void triangle(voodoo_state *v)
 	if (texcount >= 1)
 	{
 		prepare_tmu(&v->tmu[0]);
+		texcache_prepare(&v->tmu[0]);
 		if (texcount >= 2)
+		{
 			prepare_tmu(&v->tmu[1]);
+			texcache_prepare(&v->tmu[1]);
+		}
 	}
 
 	triangle_worker& tworker = v->tworker;
@@ -4525,7 +4872,20 @@ static void triangle(voodoo_state *v)
 	tworker.drawbuf = drawbuf;
 	tworker.v1y = v1y;
 	tworker.v3y = v3y;
-	triangle_worker_run(tworker);
+	if (voodoo_perf.enabled)
+	{
+		if (voodoo_perf.reset.exchange(false)) voodoo_perf_clear();
+		UINT32 texmode0 = (texcount >= 1 ? v->tmu[0].reg[textureMode].u : 0), texmode1 = (texcount >= 2 ? v->tmu[1].reg[textureMode].u : 0);
+		memset(voodoo_perf.work, 0, sizeof(voodoo_perf.work));
+		voodoo_perf.work_timed = true;
+		voodoo_perf.work_threaded = false;
+		UINT64 rasterstart = voodoo_perf_usec();
+		triangle_worker_run(tworker);
+		voodoo_perf.work_timed = false;
+		voodoo_perf_add_triangle(v, rasterstart, texmode0, texmode1);
+	}
+	else
+		triangle_worker_run(tworker);
 
 	/* update stats */
 	v->reg[fbiTrianglesOut].u++;
@@ -5362,6 +5722,7 @@ static void register_w(UINT32 offset, UINT32 data) {
 				v->reg[regnum].u = data;
 				v->alt_regmap = (FBIINIT3_TRI_REGISTER_REMAP(data) > 0);
 				v->fbi.yorigin = FBIINIT3_YORIGIN_SUBTRACT(v->reg[fbiInit3].u);
+				lfb_direct.valid = false;
 				recompute_video_memory(v);
 			}
 			break;
@@ -5506,6 +5867,83 @@ default_case:
  *  Voodoo LFB writes
  *
  *************************************/
+
+/* 2D overlays and movies are drawn with long runs of LFB writes in the same mode. Instead of decoding
+   the mode for every word, it is checked once and 16-bit RGB 5-6-5 pixels that bypass the pixel
+   pipeline are stored directly. */
+static void lfb_direct_validate(lfb_direct_state& d)
+{
+	UINT32 lfbmode = v->reg[lfbMode].u;
+	d.valid = true;
+	d.lfbmode = lfbmode;
+	d.fbzmode = v->reg[fbzMode].u;
+	d.rowpixels = v->fbi.rowpixels;
+	d.direct = (
+		#ifdef C_DBP_ENABLE_VOODOO_OPENGL
+		!v->ogl &&
+		#endif
+		!LFBMODE_ENABLE_PIXEL_PIPELINE(lfbmode) && !LFBMODE_BYTE_SWIZZLE_WRITES(lfbmode) && !LFBMODE_WORD_SWAP_WRITES(lfbmode)
+		&& LFBMODE_WRITE_FORMAT(lfbmode) == 0 && (LFBMODE_RGBA_LANES(lfbmode) & 1) == 0 && LFBMODE_WRITE_BUFFER_SELECT(lfbmode) <= 1);
+	if (!d.direct) return;
+
+	UINT32 rgboffs = v->fbi.rgboffs[LFBMODE_WRITE_BUFFER_SELECT(lfbmode) == 0 ? v->fbi.frontbuf : v->fbi.backbuf];
+	d.dest = (UINT16 *)(v->fbi.ram + rgboffs);
+	d.destmax = (v->fbi.mask + 1 - rgboffs) / 2;
+}
+
+/* Returns false if the write needs to go through lfb_w. */
+static bool lfb_w_direct(UINT32 offset, UINT32 data, UINT32 mem_mask)
+{
+	lfb_direct_state& d = lfb_direct;
+	if (!d.valid || d.lfbmode != v->reg[lfbMode].u || d.fbzmode != v->reg[fbzMode].u || d.rowpixels != v->fbi.rowpixels)
+		lfb_direct_validate(d);
+	if (!d.direct)
+		return false;
+
+	/* compute X,Y of the first of the two pixels */
+	offset <<= 1;
+	INT32 x = (offset << 0) & ((1 << 10) - 1);
+	INT32 y = (offset >> 10) & ((1 << 10) - 1);
+	INT32 scry = (LFBMODE_Y_ORIGIN(d.lfbmode) ? ((v->fbi.yorigin - y) & 0x3ff) : y);
+	UINT32 bufoffs = scry * d.rowpixels + x;
+
+	if (!FBZMODE_ENABLE_DITHERING(d.fbzmode))
+	{
+		/* without dithering, extracting 5-6-5 to 8-8-8 and reducing it again is the identity */
+		if (ACCESSING_BITS_0_15)
+		{
+			if (bufoffs < d.destmax)
+				d.dest[bufoffs] = (UINT16)data;
+			v->reg[fbiPixelsOut].u++;
+		}
+		if (ACCESSING_BITS_16_31)
+		{
+			if (bufoffs + 1 < d.destmax)
+				d.dest[bufoffs + 1] = (UINT16)(data >> 16);
+			v->reg[fbiPixelsOut].u++;
+		}
+		return true;
+	}
+
+	DECLARE_DITHER_POINTERS;
+	COMPUTE_DITHER_POINTERS(d.fbzmode, y);
+	(void)dither4; (void)dither;
+	for (int pix = 0; pix != 2; pix++, bufoffs++, x++, data >>= 16)
+	{
+		if (!(mem_mask & (0xffff << (pix * 16))))
+			continue;
+		int r, g, b;
+		EXTRACT_565_TO_888(data, r, g, b);
+		if (bufoffs < d.destmax)
+		{
+			APPLY_DITHER(d.fbzmode, x, dither_lookup, r, g, b);
+			d.dest[bufoffs] = (UINT16)((r << 11) | (g << 5) | b);
+		}
+		v->reg[fbiPixelsOut].u++;
+	}
+	return true;
+}
+
 static void lfb_w(UINT32 offset, UINT32 data, UINT32 mem_mask) {
 	//LOG(LOG_VOODOO,LOG_WARN)("V3D:WR LFB offset %X value %08X", offset, data);
 	UINT16 *dest, *depth;
@@ -6190,6 +6628,9 @@ static INT32 texture_w(UINT32 offset, UINT32 data) {
 			changed = true;
 		}
 
+		if (changed)
+			texcache_invalidate_ram(t, tbaseaddr);
+
 #ifdef C_DBP_ENABLE_VOODOO_OPENGL
 		if (changed && v->ogl && v->active) {
 			voodoo_ogl_texture_clear(t->lodoffset[lod],tmunum);
@@ -6236,6 +6677,9 @@ static INT32 texture_w(UINT32 offset, UINT32 data) {
 			changed = true;
 		}
 
+		if (changed)
+			texcache_invalidate_ram(t, tbaseaddr << 1);
+
 #ifdef C_DBP_ENABLE_VOODOO_OPENGL
 		if (changed && v->ogl && v->active) {
 			voodoo_ogl_texture_clear(t->lodoffset[lod],tmunum);
@@ -6439,7 +6883,10 @@ static void voodoo_w(UINT32 offset, UINT32 data, UINT32 mask) {
 	if ((offset & (0xc00000/4)) == 0)
 		register_w(offset, data);
 	else if ((offset & (0x800000/4)) == 0)
-		lfb_w(offset, data, mask);
+	{
+		if (!lfb_w_direct(offset, data, mask))
+			lfb_w(offset, data, mask);
+	}
 	else
 		texture_w(offset, data);
 }
@@ -6465,6 +6912,7 @@ static UINT32 voodoo_r(UINT32 offset) {
 static void voodoo_init(UINT8 type) {
 	DBP_ASSERT(!v);
 	v = new voodoo_state;
+	DBP_MemStats_Alloc(DBPMEM_VOODOO, sizeof(voodoo_state));
 	#ifdef C_DBP_ENABLE_VOODOO_OPENGL
 	v->ogl = (emulation_type == VOODOO_EMU_TYPE_ACCELERATED);
 	#endif
@@ -6658,17 +7106,23 @@ static void voodoo_shutdown() {
 			voodoo_ogl_shutdown(v);
 #endif
 		free(v->fbi.ram);
+		DBP_MemStats_Free(DBPMEM_VOODOO, (size_t)v->fbi.mask + 1);
 		if (v->tmu[0].ram != NULL) {
 			free(v->tmu[0].ram);
+			DBP_MemStats_Free(DBPMEM_VOODOO, (size_t)v->tmu[0].mask + 1);
+			texcache_free(&v->tmu[0]);
 			v->tmu[0].ram = NULL;
 		}
 		if (v->tmu[1].ram != NULL) {
 			free(v->tmu[1].ram);
+			DBP_MemStats_Free(DBPMEM_VOODOO, (size_t)v->tmu[1].mask + 1);
+			texcache_free(&v->tmu[1]);
 			v->tmu[1].ram = NULL;
 		}
 		v->active=false;
 		triangle_worker_shutdown(v->tworker);
 		delete v;
+		DBP_MemStats_Free(DBPMEM_VOODOO, sizeof(voodoo_state));
 		v = NULL;
 	}
 }
@@ -7126,6 +7580,50 @@ bool VOODOO_SRGB() { return voodoo_srgb; }
 bool VOODOO_Stat() { return voodoo_stat; }
 #endif
 
+void VOODOO_SetPerfStats(bool enable) {
+	// Called on the frontend thread, the emulation thread clears the statistics before the next triangle
+	if (enable && !voodoo_perf.enabled) voodoo_perf.reset = true;
+	voodoo_perf.enabled = enable;
+}
+
+bool VOODOO_GetPerfSummary(char* buf, size_t bufsize, Bit32u frames) {
+	// Render statistics since the last call, averaged per frame
+	if (!v || !voodoo_perf.enabled || !frames) return false;
+	voodoo_perf_interval& iv = voodoo_perf.interval;
+	UINT32 triangles = iv.triangles.exchange(0), threaded = iv.threaded.exchange(0);
+	UINT64 pixels_in = iv.pixels_in.exchange(0), pixels_out = iv.pixels_out.exchange(0), raster_usec = iv.raster_usec.exchange(0), worker_usec = iv.worker_usec.exchange(0);
+	UINT32 busy = (raster_usec ? (UINT32)(worker_usec * 100 / (raster_usec * (threaded ? TRIANGLE_WORKERS : 1))) : 0);
+	snprintf(buf, bufsize, "%u tris, %u/%u kpix in/out, %.1f Mpix/s, %.2f ms, %u%% worker use",
+		triangles / frames, (unsigned)(pixels_in / frames / 1000), (unsigned)(pixels_out / frames / 1000),
+		(raster_usec ? (double)pixels_in / raster_usec : 0.0), raster_usec / 1000.0 / frames, busy);
+	return true;
+}
+
+bool VOODOO_GetPerfReportLine(Bitu line, char* buf, size_t bufsize) {
+	// Totals since enabling the statistics followed by the render states with the most pixels
+	const voodoo_perf_counters& c = voodoo_perf.total;
+	if (!voodoo_perf.enabled || voodoo_perf.reset || !c.triangles) return false;
+	if (line == 0) { snprintf(buf, bufsize, "Triangles: %u (%u threaded), Pixels in: %llu, out: %llu, Z fail: %llu, Alpha fail: %llu, Chroma fail: %llu", c.triangles, c.threaded, (unsigned long long)c.pixels_in, (unsigned long long)c.pixels_out, (unsigned long long)c.zfunc_fail, (unsigned long long)c.afunc_fail, (unsigned long long)c.chroma_fail); return true; }
+	if (line == 1) { snprintf(buf, bufsize, "Raster time: %llu ms, Worker time: %llu ms, Throughput: %.1f Mpix/s", (unsigned long long)(c.raster_usec / 1000), (unsigned long long)(c.worker_usec / 1000), (c.raster_usec ? (double)c.pixels_in / c.raster_usec : 0.0)); return true; }
+	if (line == 2) { snprintf(buf, bufsize, "%-8s %8s %6s %8s %8s %8s %8s %8s %8s %8s", "Hash", "Tris", "Pix%", "ColPath", "FbzMode", "Alpha", "Fog", "Tex0", "Tex1", "Pixels"); return true; }
+
+	// Select the n-th largest render state by pixel count
+	const voodoo_perf_render_state* top = NULL;
+	for (Bitu n = 3; n <= line; n++)
+	{
+		const voodoo_perf_render_state* next = NULL;
+		for (const voodoo_perf_render_state& s : voodoo_perf.states)
+			if (s.hash && (!top || s.pixels < top->pixels || (s.pixels == top->pixels && &s > top)) && (!next || s.pixels > next->pixels))
+				next = &s;
+		if (!next) return false;
+		top = next;
+	}
+	if (!top || line >= 3 + VOODOO_PERF_TOP) return false;
+	snprintf(buf, bufsize, "%08X %8u %5.1f%% %08X %08X %08X %08X %08X %08X %8llu", top->hash, top->triangles, (c.pixels_in ? top->pixels * 100.0 / c.pixels_in : 0.0),
+		top->fbzcp, top->fbzmode, top->alphamode, top->fogmode, top->texmode0, top->texmode1, (unsigned long long)top->pixels);
+	return true;
+}
+
 void VOODOO_Destroy(Section* /*sec*/) {
 	voodoo_shutdown();
 }
@@ -7190,6 +7688,7 @@ void DBPSerialize_Voodoo(DBPArchive& ar)
 		// Serialize the frame buffer RAM and everything else in fbi_state
 		ar.SerializeSparse(v->fbi.ram, v->fbi.mask + 1);
 		ar.SerializeBytes(v->fbi.rgboffs, (Bit8u*)((&v->fbi)+1)-(Bit8u*)v->fbi.rgboffs);
+		lfb_direct.valid = false;
 
 		for (tmu_state& tmu : v->tmu)
 		{
@@ -7230,6 +7729,7 @@ void DBPSerialize_Voodoo(DBPArchive& ar)
 			{
 				tmu.texel[1] = tmu.texel[9] = tmu.ncc[texel19Ncc].texel;
 				tmu.lookup = (lookup == 100 ? tmu.ncc[0].texel : (lookup == 101 ? tmu.ncc[1].texel : tmu.texel[lookup]));
+				texcache_reset(&tmu);
 			}
 		}
 	}
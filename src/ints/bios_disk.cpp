@@ -27,6 +27,8 @@
 #include "dos_inc.h" /* for Drives[] */
 #include "../dos/drives.h"
 #include "mapper.h"
+#include "dbp_memstats.h"
+#include "control.h"
 
 //DBP: for mem_readb_inline and mem_writeb_inline
 #include "paging.h"
@@ -34,31 +36,135 @@
 #ifdef C_DBP_SUPPORT_DISK_MOUNT_DOSFILE
 struct discardDisk
 {
-	std::vector<Bit8u*> tempwrites;
-	
+	// Sectors written to a read-only image are kept in a sparse two level table which maps sector numbers to storage slots.
+	// Slot storage is allocated in slabs of multiple sectors. In low memory mode, slots beyond a limit spill into a temporary file.
+	// If writing to that file fails, spilling stops and all further slots (including the one that failed) are kept in memory.
+	enum ddDefs : Bit32u
+	{
+		LEAF_BITS         = 10,
+		LEAF_SECTORS      = (1 << LEAF_BITS),
+		SLAB_SECTORS      = 256,
+		LOWMEM_LIMIT      = 16*1024*1024,
+	};
+
+	std::vector<Bit32u*> leafs; // each leaf maps LEAF_SECTORS sectors to slot numbers + 1 (0 if not written)
+	std::vector<Bit8u*>  slabs;
+	Bit32u               slot_size = 0, slot_count = 0, mem_slots = (Bit32u)-1, spill_end = (Bit32u)-1; // slots in [mem_slots, spill_end) are in spillFile
+	FILE*                spillFile = NULL;
+
+	discardDisk()
+	{
+		if (static_cast<Section_prop *>(control->GetSection("dosbox"))->Get_bool("lowmemory"))
+			mem_slots = 0; // determined on first write once the sector size is known
+	}
+
 	~discardDisk()
 	{
-		for (Bit8u* p : tempwrites)
-			delete p;
+		for (Bit32u* leaf : leafs)
+			if (leaf) { free(leaf); DBP_MemStats_Free(DBPMEM_DISK, LEAF_SECTORS * sizeof(Bit32u)); }
+		for (Bit8u* slab : slabs)
+			{ free(slab); DBP_MemStats_Free(DBPMEM_DISK, SLAB_SECTORS * slot_size); }
+		if (spillFile)
+			fclose(spillFile);
 	}
 
-	bool Read_AbsoluteSector(Bit32u sectnum, void* data, Bit32u sector_size)
+	Bit32u GetSlot(Bit32u sectnum) const
 	{
-		const Bit8u* tempwrite = (tempwrites.size() <= sectnum ? NULL : tempwrites[sectnum]);
-		if (!tempwrite) return false;
-		memcpy(data, tempwrite, sector_size);
-		return true;
+		const Bit32u leafidx = (sectnum >> LEAF_BITS);
+		const Bit32u* leaf = (leafidx < leafs.size() ? leafs[leafidx] : NULL);
+		return (leaf ? leaf[sectnum & (LEAF_SECTORS - 1)] : 0);
 	}
 
-	void Write_AbsoluteSector(Bit32u sectnum, const void* data, Bit32u sector_size)
+	bool HasSector(Bit32u sectnum) const
 	{
-		if (tempwrites.size() <= sectnum)
-			tempwrites.resize(sectnum + 1);
+		return (GetSlot(sectnum) != 0);
+	}
+
+	// Index into the memory slabs for a slot index, or (Bit32u)-1 if the slot is stored in spillFile
+	Bit32u MemIndex(Bit32u idx) const
+	{
+		if (idx < mem_slots) return idx;
+		if (idx < spill_end) return (Bit32u)-1;
+		return mem_slots + (idx - spill_end);
+	}
+
+	// Returns the new slot number (index + 1) or 0 if no memory was available for it
+	Bit32u AddSlot()
+	{
+		const Bit32u memidx = MemIndex(slot_count);
+		if (memidx != (Bit32u)-1 && (memidx % SLAB_SECTORS) == 0)
+		{
+			Bit8u* slab = (Bit8u*)malloc(SLAB_SECTORS * slot_size);
+			if (!slab) return 0;
+			slabs.push_back(slab);
+			DBP_MemStats_Alloc(DBPMEM_DISK, SLAB_SECTORS * slot_size);
+		}
+		return ++slot_count;
+	}
+
+	// Returns 0 on success, otherwise a BIOS disk error code
+	Bit8u Read_AbsoluteSector(Bit32u sectnum, void* data, Bit32u sector_size)
+	{
+		const Bit32u slot = GetSlot(sectnum), memidx = MemIndex(slot - 1);
+		DBP_ASSERT(slot && sector_size == slot_size);
+		if (memidx != (Bit32u)-1)
+			memcpy(data, slabs[memidx / SLAB_SECTORS] + (memidx % SLAB_SECTORS) * slot_size, slot_size);
+		else if (fseek_wrap(spillFile, (Bit64u)(slot - 1 - mem_slots) * slot_size, SEEK_SET) || !fread(data, slot_size, 1, spillFile))
+		{
+			LOG_MSG("[DOSBOX] Unable to read disk changes from temporary file");
+			return 0x04;
+		}
+		return 0x00;
+	}
+
+	// Returns 0 on success, otherwise a BIOS disk error code
+	Bit8u Write_AbsoluteSector(Bit32u sectnum, const void* data, Bit32u sector_size)
+	{
+		const Bit32u leafidx = (sectnum >> LEAF_BITS);
+		if (leafidx >= leafs.size())
+			leafs.resize(leafidx + 1);
+		if (!leafs[leafidx])
+		{
+			if ((leafs[leafidx] = (Bit32u*)calloc(LEAF_SECTORS, sizeof(Bit32u))) == NULL) return 0x05;
+			DBP_MemStats_Alloc(DBPMEM_DISK, LEAF_SECTORS * sizeof(Bit32u));
+		}
+
+		Bit32u& slot = leafs[leafidx][sectnum & (LEAF_SECTORS - 1)];
+		if (!slot)
+		{
+			if (!slot_size)
+			{
+				slot_size = sector_size;
+				if (!mem_slots) mem_slots = (LOWMEM_LIMIT / slot_size + SLAB_SECTORS - 1) / SLAB_SECTORS * SLAB_SECTORS;
+			}
+			if (slot_count == mem_slots && !spillFile && (spillFile = tmpfile()) == NULL)
+			{
+				LOG_MSG("[DOSBOX] Unable to create temporary file for disk changes, keeping them all in memory");
+				mem_slots = (Bit32u)-1;
+			}
+			if ((slot = AddSlot()) == 0) return 0x05;
+		}
+		DBP_ASSERT(sector_size == slot_size);
+
+		Bit32u memidx = MemIndex(slot - 1);
+		if (memidx == (Bit32u)-1)
+		{
+			if (!fseek_wrap(spillFile, (Bit64u)(slot - 1 - mem_slots) * slot_size, SEEK_SET) && fwrite(data, slot_size, 1, spillFile))
+				return 0x00;
 
-		Bit8u*& tempwrite = tempwrites[sectnum];
-		if (!tempwrite)
-			tempwrite = (Bit8u*)malloc(sector_size);
-		memcpy(tempwrite, data, sector_size);
+			// Stop spilling and move this sector into memory, its old place in the file stays unused
+			if (spill_end == (Bit32u)-1)
+			{
+				LOG_MSG("[DOSBOX] Unable to write disk changes to temporary file, keeping further changes in memory");
+				spill_end = slot_count;
+			}
+			const Bit32u memslot = AddSlot();
+			if (!memslot) return 0x05;
+			slot = memslot;
+			memidx = MemIndex(slot - 1);
+		}
+		memcpy(slabs[memidx / SLAB_SECTORS] + (memidx % SLAB_SECTORS) * slot_size, data, slot_size);
+		return 0x00;
 	}
 };
 
@@ -190,6 +296,11 @@ struct differencingDisk
 		return false;
 	}
 
+	bool HasDiff(Bit32u sectnum) const
+	{
+		return (sectnum < diffSectors.size() && diffSectors[sectnum].cursor != NULL_CURSOR);
+	}
+
 	bool GetDiff(Bit32u sectnum, void* data)
 	{
 		Bit32u cursor = (sectnum >= diffSectors.size() ? NULL_CURSOR : diffSectors[sectnum].cursor);
@@ -263,11 +374,13 @@ struct fatFromDOSDrive
 	DOS_File*             openFiles[KEEPOPENCOUNT];
 	Bit32u                openIndex[KEEPOPENCOUNT];
 	Bit32u                openCursor = 0;
+	size_t                memStatSize = 0;
 
 	~fatFromDOSDrive()
 	{
 		for (DOS_File* df : openFiles)
 			if (df) { df->Close(); delete df; }
+		DBP_MemStats_Free(DBPMEM_FATEMU, memStatSize);
 	}
 
 	fatFromDOSDrive(DOS_Drive* drv, Bit32u freeSpaceMB = 0, const char* inSavePath = NULL, Bit32u serial = 0, const StringToPointerHashMap<void>* fileFilter = NULL) : drive(drv)
@@ -649,6 +762,9 @@ struct fatFromDOSDrive
 
 		if (inSavePath)
 			difference.SetupSave(inSavePath, sect_disk_end);
+
+		memStatSize = sizeof(*this) + (root.capacity() + dirs.capacity()) * sizeof(direntry) + files.capacity() * sizeof(ffddFile) + fileAtSector.capacity() * sizeof(Bit32u) + fat.capacity();
+		DBP_MemStats_Alloc(DBPMEM_FATEMU, memStatSize);
 	}
 
 	static void chs_write(Bit8u* chs, Bit32u lba)
@@ -899,32 +1015,59 @@ Bit8u imageDisk::Read_Sector(Bit32u head,Bit32u cylinder,Bit32u sector,void * da
 }
 
 Bit8u imageDisk::Read_AbsoluteSector(Bit32u sectnum, void * data) {
+	return Read_AbsoluteSectors(sectnum, 1, data);
+}
+
+Bit8u imageDisk::Read_AbsoluteSectors(Bit32u sectnum, Bit32u count, void * data) {
 	#ifdef C_DBP_SUPPORT_DISK_MOUNT_DOSFILE
+	Bit8u* out = (Bit8u*)data;
 	#ifdef C_DBP_SUPPORT_DISK_FAT_EMULATOR
-	if (ffdd) return ffdd->ReadSector(sectnum, data);
-	#endif
-
-	if (discard && discard->Read_AbsoluteSector(sectnum, data, sector_size))
+	if (ffdd) {
+		for (; count; sectnum++, count--, out += sector_size)
+			if (Bit8u res = ffdd->ReadSector(sectnum, out)) return res;
 		return 0x00;
+	}
+	#endif
 
-	if (differencing && differencing->GetDiff(sectnum, data))
-		return 0x00;
+	while (count) {
+		if (discard && discard->HasSector(sectnum)) {
+			if (Bit8u res = discard->Read_AbsoluteSector(sectnum, out, sector_size)) return res;
+			sectnum++; count--; out += sector_size;
+			continue;
+		}
+		if (differencing && differencing->GetDiff(sectnum, out)) {
+			sectnum++; count--; out += sector_size;
+			continue;
+		}
 
-	Bit64u bytenum = (Bit64u)sectnum * sector_size;
-	if (last_action==WRITE || bytenum!=current_fpos) dos_file->Seek64(&bytenum, DOS_SEEK_SET);
-	DBP_ASSERT(sector_size <= 0xFFFF);
-	Bit16u read_size = (Bit16u)sector_size;
-	size_t ret=dos_file->Read((Bit8u*)data, &read_size)?read_size:0;
+		// Read the run of sectors not stored in an overlay with a single file read
+		Bit32u run = 1;
+		while (run != count && !(discard && discard->HasSector(sectnum + run)) && !(differencing && differencing->HasDiff(sectnum + run))) run++;
+
+		Bit64u bytenum = (Bit64u)sectnum * sector_size;
+		if (last_action==WRITE || bytenum!=current_fpos) dos_file->Seek64(&bytenum, DOS_SEEK_SET);
+		DBP_ASSERT(sector_size <= 0x8000);
+		Bit32u ret = 0;
+		for (Bit32u remain = run * sector_size; remain;) {
+			Bit16u read_size = (Bit16u)(remain > 0x8000 ? 0x8000 : remain);
+			if (!dos_file->Read(out + ret, &read_size) || !read_size) break;
+			ret += read_size;
+			remain -= read_size;
+		}
+		current_fpos=bytenum+ret;
+		last_action=READ;
+		sectnum += run; count -= run; out += run * sector_size;
+	}
 	#else
 	Bit32u bytenum;
 
 	bytenum = sectnum * sector_size;
 
 	if (last_action==WRITE || bytenum!=current_fpos) fseek_wrap(diskimg,bytenum,SEEK_SET);
-	size_t ret=fread(data, 1, sector_size, diskimg);
-	#endif
+	size_t ret=fread(data, 1, sector_size * count, diskimg);
 	current_fpos=bytenum+ret;
 	last_action=READ;
+	#endif
 
 	return 0x00;
 }
@@ -938,34 +1081,57 @@ Bit8u imageDisk::Write_Sector(Bit32u head,Bit32u cylinder,Bit32u sector,void * d
 }
 
 Bit8u imageDisk::Write_AbsoluteSector(Bit32u sectnum, void *data) {
+	return Write_AbsoluteSectors(sectnum, 1, data);
+}
+
+Bit8u imageDisk::Write_AbsoluteSectors(Bit32u sectnum, Bit32u count, void *data) {
+	Bit8u* in = (Bit8u*)data;
+	write_counter++;
 	#ifdef C_DBP_SUPPORT_DISK_FAT_EMULATOR
-	if (ffdd) return ffdd->WriteSector(sectnum, data);
+	if (ffdd) {
+		for (; count; sectnum++, count--, in += sector_size)
+			if (Bit8u res = ffdd->WriteSector(sectnum, in)) return res;
+		return 0x00;
+	}
 	#endif
 
 	#ifdef C_DBP_SUPPORT_DISK_MOUNT_DOSFILE
 	if (discard)
 	{
-		discard->Write_AbsoluteSector(sectnum, data, sector_size);
+		for (; count; sectnum++, count--, in += sector_size)
+			if (Bit8u res = discard->Write_AbsoluteSector(sectnum, in, sector_size)) return res;
 		return 0x00;
 	}
 
 	if (differencing)
 	{
-		Bit64u unmodified_fpos = (Bit64u)sectnum * differencingDisk::BYTESPERSECTOR;
-		if (unmodified_fpos != current_fpos) dos_file->Seek64(&unmodified_fpos, DOS_SEEK_SET);
-		current_fpos = unmodified_fpos + differencingDisk::BYTESPERSECTOR;
-		Bit8u buf[differencingDisk::BYTESPERSECTOR];
-		Bit16u read_size = (Bit16u)differencingDisk::BYTESPERSECTOR;
-		const void* unmodified = (dos_file->Read(buf, &read_size) ? buf : NULL);
-		differencing->WriteDiff(sectnum, data, unmodified);
+		// Read the unmodified sectors in batches to compare against
+		enum { BATCH = 32 };
+		Bit8u buf[differencingDisk::BYTESPERSECTOR * BATCH];
+		for (Bit32u batch; count; sectnum += batch, count -= batch)
+		{
+			batch = (count > BATCH ? BATCH : count);
+			Bit64u unmodified_fpos = (Bit64u)sectnum * differencingDisk::BYTESPERSECTOR;
+			if (unmodified_fpos != current_fpos) dos_file->Seek64(&unmodified_fpos, DOS_SEEK_SET);
+			current_fpos = unmodified_fpos + differencingDisk::BYTESPERSECTOR * batch;
+			Bit16u read_size = (Bit16u)(differencingDisk::BYTESPERSECTOR * batch);
+			if (!dos_file->Read(buf, &read_size)) read_size = 0;
+			for (Bit32u i = 0; i != batch; i++, in += differencingDisk::BYTESPERSECTOR)
+				differencing->WriteDiff(sectnum + i, in, ((i + 1) * differencingDisk::BYTESPERSECTOR <= read_size ? buf + i * differencingDisk::BYTESPERSECTOR : NULL));
+		}
 		return 0x00;
 	}
 
 	Bit64u bytenum = (Bit64u)sectnum * sector_size;
 	if (last_action==READ || bytenum!=current_fpos) dos_file->Seek64(&bytenum, DOS_SEEK_SET);
-	DBP_ASSERT(sector_size <= 0xFFFF);
-	Bit16u write_size = (Bit16u)sector_size;
-	size_t ret=dos_file->Write((Bit8u*)data, &write_size)?write_size:0;
+	DBP_ASSERT(sector_size <= 0x8000);
+	Bit32u ret = 0;
+	for (Bit32u remain = count * sector_size; remain;) {
+		Bit16u write_size = (Bit16u)(remain > 0x8000 ? 0x8000 : remain);
+		if (!dos_file->Write(in + ret, &write_size) || !write_size) break;
+		ret += write_size;
+		remain -= write_size;
+	}
 	#else
 	Bit32u bytenum;
 
@@ -974,7 +1140,7 @@ Bit8u imageDisk::Write_AbsoluteSector(Bit32u sectnum, void *data) {
 	//LOG_MSG("Writing sectors to %ld at bytenum %d", sectnum, bytenum);
 
 	if (last_action==READ || bytenum!=current_fpos) fseek_wrap(diskimg,bytenum,SEEK_SET);
-	size_t ret=fwrite(data, 1, sector_size, diskimg);
+	size_t ret=fwrite(data, 1, sector_size * count, diskimg);
 	#endif
 	current_fpos=bytenum+ret;
 	last_action=WRITE;
@@ -1232,10 +1398,11 @@ static void readDAP(Bit16u seg, Bit16u off, DAP& dap) {
 #endif
 
 static Bitu INT13_DiskHandler(void) {
+	enum { SECTBATCH = 32 }; //DBP: Transfer multiple sectors with one disk access
 	Bit16u segat, bufptr;
-	Bit8u sectbuf[512];
+	Bit8u sectbuf[512*SECTBATCH];
 	Bit8u  drivenum;
-	Bitu  i,t;
+	Bitu  i,t,n;
 	last_drive = reg_dl;
 	drivenum = GetDosDriveNumber(reg_dl);
 	bool any_images = false;
@@ -1316,8 +1483,10 @@ static Bitu INT13_DiskHandler(void) {
 
 		segat = SegValue(es);
 		bufptr = reg_bx;
-		for(i=0;i<reg_al;i++) {
-			last_status = imageDiskList[drivenum]->Read_Sector((Bit32u)reg_dh, (Bit32u)(reg_ch | ((reg_cl & 0xc0)<< 2)), (Bit32u)((reg_cl & 63)+i), sectbuf);
+		for(i=0;i<reg_al;i+=n) {
+			imageDisk* disk = imageDiskList[drivenum];
+			n = (reg_al - i > SECTBATCH ? SECTBATCH : reg_al - i);
+			last_status = disk->Read_AbsoluteSectors(((Bit32u)(reg_ch | ((reg_cl & 0xc0)<< 2)) * disk->heads + reg_dh) * disk->sectors + (reg_cl & 63) + i - 1, n, sectbuf);
 			if((last_status != 0x00) || (killRead)) {
 				LOG_MSG("Error in disk read");
 				killRead = false;
@@ -1326,7 +1495,7 @@ static Bitu INT13_DiskHandler(void) {
 				return CBRET_NONE;
 			}
 			//DBP: Changed loop to use mem_writeb_inline
-			for(t=0;t<512;t++) {
+			for(t=0;t<512*n;t++) {
 				//real_writeb(segat,bufptr,sectbuf[t]);
 				mem_writeb_inline((segat<<4)+bufptr,sectbuf[t]);
 				bufptr++;
@@ -1345,16 +1514,18 @@ static Bitu INT13_DiskHandler(void) {
 
 
 		bufptr = reg_bx;
-		for(i=0;i<reg_al;i++) {
+		for(i=0;i<reg_al;i+=n) {
 			//DBP: Changed loop to use mem_readb_inline (and fixed sector size like write)
-			DBP_ASSERT(imageDiskList[drivenum]->getSectSize() == 512);
-			for(t=0;t<512;t++) {
+			imageDisk* disk = imageDiskList[drivenum];
+			DBP_ASSERT(disk->getSectSize() == 512);
+			n = (reg_al - i > SECTBATCH ? SECTBATCH : reg_al - i);
+			for(t=0;t<512*n;t++) {
 				//sectbuf[t] = real_readb(SegValue(es),bufptr);
 				sectbuf[t] = mem_readb_inline((SegValue(es)<<4)+bufptr);
 				bufptr++;
 			}
 
-			last_status = imageDiskList[drivenum]->Write_Sector((Bit32u)reg_dh, (Bit32u)(reg_ch | ((reg_cl & 0xc0) << 2)), (Bit32u)((reg_cl & 63) + i), &sectbuf[0]);
+			last_status = disk->Write_AbsoluteSectors(((Bit32u)(reg_ch | ((reg_cl & 0xc0) << 2)) * disk->heads + reg_dh) * disk->sectors + (reg_cl & 63) + i - 1, n, &sectbuf[0]);
 			if(last_status != 0x00) {
             CALLBACK_SCF(true);
 				return CBRET_NONE;
@@ -1527,8 +1698,9 @@ static Bitu INT13_DiskHandler(void) {
 
 		segat = dap.seg;
 		bufptr = dap.off;
-		for(i=0;i<dap.num;i++) {
-			last_status = imageDiskList[drivenum]->Read_AbsoluteSector(dap.sector+i, sectbuf);
+		for(i=0;i<dap.num;i+=n) {
+			n = (dap.num - i > SECTBATCH ? SECTBATCH : dap.num - i);
+			last_status = imageDiskList[drivenum]->Read_AbsoluteSectors(dap.sector+i, n, sectbuf);
 
 			////DBP: Omitted for now
 			//IDE_EmuINT13DiskReadByBIOS_LBA(reg_dl,dap.sector+i);
@@ -1541,7 +1713,7 @@ static Bitu INT13_DiskHandler(void) {
 				return CBRET_NONE;
 			}
 			//DBP: Changed loop to use mem_writeb_inline
-			for(t=0;t<512;t++) {
+			for(t=0;t<512*n;t++) {
 				//real_writeb(segat,bufptr,sectbuf[t]);
 				mem_writeb_inline((segat<<4)+bufptr,sectbuf[t]);
 				bufptr++;
@@ -1560,16 +1732,17 @@ static Bitu INT13_DiskHandler(void) {
 		/* Read Disk Address Packet */
 		readDAP(SegValue(ds),reg_si,dap);
 		bufptr = dap.off;
-		for(i=0;i<dap.num;i++) {
+		for(i=0;i<dap.num;i+=n) {
 			//DBP: Changed loop to use mem_readb_inline (and fixed sector size like write)
 			DBP_ASSERT(imageDiskList[drivenum]->getSectSize() == 512);
-			for(t=0;t<512;t++) {
+			n = (dap.num - i > SECTBATCH ? SECTBATCH : dap.num - i);
+			for(t=0;t<512*n;t++) {
 				//sectbuf[t] = real_readb(dap.seg,bufptr);
 				sectbuf[t] = mem_readb_inline((dap.seg<<4)+bufptr);
 				bufptr++;
 			}
 
-			last_status = imageDiskList[drivenum]->Write_AbsoluteSector(dap.sector+i, &sectbuf[0]);
+			last_status = imageDiskList[drivenum]->Write_AbsoluteSectors(dap.sector+i, n, &sectbuf[0]);
 			if(last_status != 0x00) {
 				CALLBACK_SCF(true);
 				return CBRET_NONE;
@@ -25,6 +25,7 @@
 #include "regs.h"
 #include "inout.h"
 #include "dos_inc.h"
+#include "cpu.h"
 #ifdef C_DBP_USE_SDL
 #include "SDL.h"
 #else
@@ -504,6 +505,13 @@ static bool IsEnhancedKey(Bit16u &key) {
 	return false;
 }
 
+/* The caller's return address is read from the real mode interrupt frame. In protected or
+   virtual 8086 mode the frame and segment values can't be used as is, so no check is done. */
+static void INT16_PollingCheck(void) {
+	if (cpu.pmode) return;
+	CPU_PollingCheck(mem_readw(SegPhys(ss)+reg_sp+2)<<4,mem_readw(SegPhys(ss)+reg_sp)-2,0x16,0,0xFFFF0000,0);
+}
+
 static Bitu INT16_Handler(void) {
 	Bit16u temp=0;
 	switch (reg_ah) {
@@ -542,6 +550,7 @@ static Bitu INT16_Handler(void) {
 				}
 			} else {
 				/* no key available, return key at buffer head anyway */
+				if (CPU_SkipPolling) INT16_PollingCheck();
 				break;
 			}
 //			CALLBACK_Idle();
@@ -556,6 +565,8 @@ static Bitu INT16_Handler(void) {
 				/* special enhanced key, clear low part before returning key */
 				temp&=0xff00;
 			}
+		} else if (CPU_SkipPolling) {
+			INT16_PollingCheck();
 		}
 		reg_ax=temp;
 		break;
@@ -698,6 +698,57 @@ void INT10_TeletypeOutput(Bit8u chr,Bit8u attr) {
 	INT10_TeletypeOutputAttr(chr,attr,CurMode->type!=M_TEXT);
 }
 
+Bit16u INT10_TeletypeOutputString(const Bit8u * str,Bit16u count,Bit8u attr,bool useattr) {
+	/* Same as calling INT10_TeletypeOutputAttr for each character in text modes but writes straight
+	   into text memory and only updates the cursor once at the end. Returns the number of characters
+	   handled, stops early on characters that need the regular path (beep). */
+	if (CurMode->type!=M_TEXT) return 0;
+	Bit8u page=real_readb(BIOSMEM_SEG,BIOSMEM_CURRENT_PAGE);
+	BIOS_NCOLS;BIOS_NROWS;
+	Bit8u cur_row=CURSOR_POS_ROW(page);
+	Bit8u cur_col=CURSOR_POS_COL(page);
+	if (cur_col>=ncols || cur_row>=nrows) return 0;
+	PhysPt base=CurMode->pstart+page*real_readw(BIOSMEM_SEG,BIOSMEM_PAGE_SIZE);
+	Bit16u done=0;
+	for (;done<count;done++) {
+		Bit8u chr=str[done];
+		Bit8u prev_row=cur_row, prev_col=cur_col;
+		switch (chr) {
+		case 7:
+			goto finish;
+		case 8:
+			if(cur_col>0) cur_col--;
+			break;
+		case '\r':
+			cur_col=0;
+			break;
+		case '\n':
+			cur_row++;
+			break;
+		default:
+			{
+				PhysPt where=base+(cur_row*ncols+cur_col)*2;
+				mem_writeb(where,chr);
+				if (useattr) mem_writeb(where+1,attr);
+				cur_col++;
+			}
+		}
+		if(cur_col==ncols) {
+			cur_col=0;
+			cur_row++;
+		}
+		if(cur_row==nrows) {
+			// Fill with given attribute or with the one at the previous cursor position like the single character path
+			Bit8u fill=(useattr ? attr : mem_readb(base+(prev_row*ncols+prev_col)*2+1));
+			INT10_ScrollWindow(0,0,(Bit8u)(nrows-1),(Bit8u)(ncols-1),-1,fill,page);
+			cur_row--;
+		}
+	}
+finish:
+	if (done) INT10_SetCursorPos(cur_row,cur_col,page);
+	return done;
+}
+
 void INT10_WriteString(Bit8u row,Bit8u col,Bit8u flag,Bit8u attr,PhysPt string,Bit16u count,Bit8u page) {
 	Bit8u cur_row=CURSOR_POS_ROW(page);
 	Bit8u cur_col=CURSOR_POS_COL(page);